@@ -0,0 +1,210 @@
+#include "unicorn/bidi.hpp"
+#include "unicorn/unit-test.hpp"
+#include "unicorn/utf.hpp"
+#include <string>
+#include <vector>
+
+using namespace RS;
+using namespace RS::Unicorn;
+using namespace std::literals;
+
+namespace {
+
+    Ustring format_levels(const BidiResolver& bidi) {
+        Ustring s;
+        for (auto lev: bidi.levels())
+            s += char('0' + lev % 10);
+        return s;
+    }
+
+    Ustring format_order(const std::vector<size_t>& order) {
+        Ustring s;
+        for (auto i: order) {
+            if (! s.empty())
+                s += ',';
+            s += std::to_string(i);
+        }
+        return s;
+    }
+
+    Ustring visual_text(BidiResolver& bidi) {
+        std::u32string v;
+        TRY(bidi.visual(0, bidi.size(), v));
+        return to_utf8(v);
+    }
+
+}
+
+void test_unicorn_bidi_levels() {
+
+    BidiResolver bidi;
+
+    TRY(bidi.resolve(""s));
+    TEST(bidi.empty());
+    TEST_EQUAL(format_levels(bidi), "");
+
+    TRY(bidi.resolve("abc"s));
+    TEST_EQUAL(bidi.size(), 3);
+    TEST_EQUAL(bidi.paragraph_level(0), 0);
+    TEST_EQUAL(format_levels(bidi), "000");
+
+    TRY(bidi.resolve("אבג"s));
+    TEST_EQUAL(bidi.paragraph_level(0), 1);
+    TEST_EQUAL(format_levels(bidi), "111");
+    TEST_EQUAL(format_order(bidi.offsets()), "0,2,4");
+
+    TRY(bidi.resolve("אבג"s, Bidi::ltr));
+    TEST_EQUAL(bidi.paragraph_level(0), 0);
+    TEST_EQUAL(format_levels(bidi), "111");
+
+    TRY(bidi.resolve("abc"s, Bidi::rtl));
+    TEST_EQUAL(bidi.paragraph_level(0), 1);
+    TEST_EQUAL(format_levels(bidi), "222");
+
+    TRY(bidi.resolve("abc אבג def"s));
+    TEST_EQUAL(format_levels(bidi), "00001110000");
+
+    // Numbers in right to left text (W2, W7, I1-I2)
+    TRY(bidi.resolve("אב 123"s));
+    TEST_EQUAL(format_levels(bidi), "111222");
+    TRY(bidi.resolve("ا 12"s));
+    TEST_EQUAL(format_levels(bidi), "1122");
+    TRY(bidi.resolve("abc 1.5%"s));
+    TEST_EQUAL(format_levels(bidi), "00000000");
+    TRY(bidi.resolve("א 1.5%"s));
+    TEST_EQUAL(format_levels(bidi), "112222");
+
+    // Bracket pairs (N0)
+    TRY(bidi.resolve("א(b)ג"s));
+    TEST_EQUAL(format_levels(bidi), "11211");
+    TRY(bidi.resolve("a(ב)c"s));
+    TEST_EQUAL(format_levels(bidi), "00100");
+    TRY(bidi.resolve("א a(b) ג"s, Bidi::ltr));
+    TEST_EQUAL(format_levels(bidi), "10000001");
+
+    // Isolates and embeddings
+    TRY(bidi.resolve("a\u2067b\u2069c"s));
+    TEST_EQUAL(format_levels(bidi), "00200");
+    TRY(bidi.resolve("a\u2067ב\u2069c"s));
+    TEST_EQUAL(format_levels(bidi), "00100");
+    TRY(bidi.resolve("\u2068א\u2069abc"s));
+    TEST_EQUAL(bidi.paragraph_level(0), 0);
+    TEST_EQUAL(format_levels(bidi), "010000");
+    TRY(bidi.resolve("\u2067abc"s));
+    TEST_EQUAL(bidi.paragraph_level(0), 0);
+    TEST_EQUAL(format_levels(bidi), "0222");
+    TRY(bidi.resolve("a\u202eb\u202cc"s));
+    TEST_EQUAL(format_levels(bidi), "00110");
+    TRY(bidi.resolve("\u202aab \u202c"s, Bidi::rtl));
+    TEST_EQUAL(format_levels(bidi), "12222");
+
+    // sos and eos come from the explicit levels, not from neighbouring
+    // sequences that have already been through I1-I2 (X10)
+    TRY(bidi.resolve("א 1\u202b!b\u202c"s, Bidi::ltr));
+    TEST_EQUAL(format_levels(bidi), "1122122");
+    TRY(bidi.resolve("\u0661\u202b!b\u202c"s, Bidi::ltr));
+    TEST_EQUAL(format_levels(bidi), "22122");
+
+    // Overflow beyond the maximum depth
+    Ustring deep;
+    for (size_t i = 0; i < 200; ++i)
+        deep += "\u2067";
+    deep += "abc";
+    TRY(bidi.resolve(deep));
+    TEST_EQUAL(bidi.size(), 203);
+    TEST_EQUAL(int(bidi.levels().back()), 126);
+
+    // Multiple paragraphs
+    TRY(bidi.resolve("abc\nאבג"s));
+    TEST_EQUAL(bidi.paragraph_level(0), 0);
+    TEST_EQUAL(bidi.paragraph_level(3), 0);
+    TEST_EQUAL(bidi.paragraph_level(4), 1);
+    TEST_EQUAL(format_levels(bidi), "0000111");
+
+    // Other encodings
+    TRY(bidi.resolve(u"aבc"s));
+    TEST_EQUAL(format_levels(bidi), "010");
+    TRY(bidi.resolve(U"א\U00010900c"s));
+    TEST_EQUAL(format_levels(bidi), "112");
+
+}
+
+void test_unicorn_bidi_reordering() {
+
+    BidiResolver bidi;
+    std::vector<size_t> order;
+
+    TRY(bidi.resolve("abc"s));
+    TRY(bidi.reorder(0, bidi.size(), order));
+    TEST_EQUAL(format_order(order), "0,1,2");
+    TEST_EQUAL(visual_text(bidi), "abc");
+
+    TRY(bidi.resolve("אבג"s));
+    TEST_EQUAL(visual_text(bidi), "גבא");
+
+    TRY(bidi.resolve("abc אבג def"s));
+    TRY(bidi.reorder(0, bidi.size(), order));
+    TEST_EQUAL(format_order(order), "0,1,2,3,6,5,4,7,8,9,10");
+    TEST_EQUAL(visual_text(bidi), "abc גבא def");
+
+    TRY(bidi.resolve("אב 123"s));
+    TRY(bidi.reorder(0, bidi.size(), order));
+    TEST_EQUAL(format_order(order), "3,4,5,2,1,0");
+    TEST_EQUAL(visual_text(bidi), "123 בא");
+
+    // Mirrored brackets (L4)
+    TRY(bidi.resolve("א(b)ג"s));
+    TEST_EQUAL(visual_text(bidi), "ג(b)א");
+
+    // Segment separators and trailing whitespace (L1)
+    TRY(bidi.resolve("ab\tcd"s, Bidi::rtl));
+    TRY(bidi.reorder(0, bidi.size(), order));
+    TEST_EQUAL(format_order(order), "3,4,2,0,1");
+    TRY(bidi.resolve("\u202aab \u202c"s, Bidi::rtl));
+    TRY(bidi.reorder(0, bidi.size(), order));
+    TEST_EQUAL(format_order(order), "4,3,1,2,0");
+
+    // Partial lines
+    TRY(bidi.resolve("abc אבג def"s));
+    TRY(bidi.reorder(4, 6, order));
+    TEST_EQUAL(format_order(order), "5,4");
+    TRY(bidi.reorder(2, 100, order));
+    TEST_EQUAL(format_order(order), "2,3,6,5,4,7,8,9,10");
+    TRY(bidi.reorder(20, 30, order));
+    TEST(order.empty());
+
+}
+
+void test_unicorn_bidi_long_text() {
+
+    // Unbalanced and deeply nested controls must still resolve in linear
+    // time, and the working buffers are reused between calls
+
+    BidiResolver bidi;
+    Ustring text;
+
+    for (size_t i = 0; i < 100'000; ++i)
+        text += "(a ";
+    TRY(bidi.resolve(text, Bidi::rtl));
+    TEST_EQUAL(bidi.size(), 300'000);
+    TEST_EQUAL(int(bidi.levels()[0]), 1);
+    TEST_EQUAL(int(bidi.levels()[1]), 2);
+
+    text.clear();
+    for (size_t i = 0; i < 100'000; ++i)
+        text += "\u2067א";
+    TRY(bidi.resolve(text));
+    TEST_EQUAL(bidi.size(), 200'000);
+    TEST_EQUAL(int(bidi.levels().back()), 125);
+
+    text.clear();
+    for (size_t i = 0; i < 100'000; ++i)
+        text += "א(\u2069";
+    TRY(bidi.resolve(text));
+    TEST_EQUAL(bidi.size(), 300'000);
+    TEST_EQUAL(bidi.paragraph_level(0), 1);
+
+    TRY(bidi.resolve("abc"s));
+    TEST_EQUAL(format_levels(bidi), "000");
+
+}
@@ -0,0 +1,541 @@
+#include "unicorn/bidi.hpp"
+#include <algorithm>
+#include <array>
+#include <numeric>
+
+namespace RS::Unicorn {
+
+    namespace {
+
+        using BC = Bidi_Class;
+
+        constexpr size_t npos = size_t(-1);
+        constexpr size_t max_brackets = 63;
+
+        constexpr BC bc(uint8_t t) noexcept { return BC(t); }
+        constexpr uint8_t bc(BC t) noexcept { return uint8_t(t); }
+
+        constexpr bool is_isolate_initiator(BC t) noexcept {
+            return t == BC::LRI || t == BC::RLI || t == BC::FSI;
+        }
+
+        constexpr bool is_isolate_control(BC t) noexcept {
+            return is_isolate_initiator(t) || t == BC::PDI;
+        }
+
+        // Characters removed by X9
+
+        constexpr bool is_removed_class(BC t) noexcept {
+            return t == BC::BN || t == BC::LRE || t == BC::LRO || t == BC::PDF || t == BC::RLE || t == BC::RLO;
+        }
+
+        // Neutral and isolate formatting characters (NI in UAX9)
+
+        constexpr bool is_ni(BC t) noexcept {
+            return t == BC::B || t == BC::S || t == BC::WS || t == BC::ON || is_isolate_control(t);
+        }
+
+        // Strong direction for the purposes of N0 and N1, where EN and AN
+        // count as R
+
+        constexpr BC strong_direction(BC t) noexcept {
+            switch (t) {
+                case BC::L:   return BC::L;
+                case BC::AL:
+                case BC::AN:
+                case BC::EN:
+                case BC::R:   return BC::R;
+                default:      return BC::Default;
+            }
+        }
+
+        constexpr BC level_direction(int level) noexcept {
+            return level % 2 ? BC::R : BC::L;
+        }
+
+        constexpr uint8_t next_odd(uint8_t level) noexcept { return uint8_t((level + 1) | 1); }
+        constexpr uint8_t next_even(uint8_t level) noexcept { return uint8_t((level + 2) & ~1); }
+
+        // Canonical equivalents of the angle brackets (BD16)
+
+        constexpr char32_t canonical_bracket(char32_t c) noexcept {
+            switch (c) {
+                case 0x2329:  return 0x3008;
+                case 0x232a:  return 0x3009;
+                default:      return c;
+            }
+        }
+
+    }
+
+    int BidiResolver::paragraph_level(size_t pos) const noexcept {
+        auto it = std::upper_bound(paras.begin(), paras.end(), pos,
+            [] (size_t p, const Paragraph& para) { return p < para.begin; });
+        if (it == paras.begin())
+            return 0;
+        return std::prev(it)->level;
+    }
+
+    void BidiResolver::reorder(size_t begin, size_t end, std::vector<size_t>& order) {
+        end = std::min(end, size());
+        begin = std::min(begin, end);
+        order.resize(end - begin);
+        std::iota(order.begin(), order.end(), begin);
+        if (begin == end)
+            return;
+        apply_line_rules(begin, end);
+        uint8_t highest = 0, lowest_odd = max_depth + 2;
+        for (auto lev: line_levels) {
+            highest = std::max(highest, lev);
+            if (lev % 2)
+                lowest_odd = std::min(lowest_odd, lev);
+        }
+        // L2: reverse every maximal run at or above each level, from the
+        // highest level down to the lowest odd level
+        size_t n = order.size();
+        auto level_at = [&] (size_t i) { return line_levels[order[i] - begin]; };
+        for (int lev = highest; lev >= lowest_odd; --lev) {
+            for (size_t i = 0; i < n;) {
+                if (level_at(i) < lev) {
+                    ++i;
+                    continue;
+                }
+                size_t j = i + 1;
+                while (j < n && level_at(j) >= lev)
+                    ++j;
+                std::reverse(order.begin() + i, order.begin() + j);
+                i = j;
+            }
+        }
+    }
+
+    void BidiResolver::visual(size_t begin, size_t end, std::u32string& dst) {
+        reorder(begin, end, seq);
+        dst.clear();
+        for (auto i: seq) {
+            char32_t c = chars[i];
+            // L4: mirror characters at odd levels
+            if (line_levels[i - begin] % 2 && char_is_bidi_mirrored(c)) {
+                char32_t m = bidi_mirroring_glyph(c);
+                if (m != 0)
+                    c = m;
+            }
+            dst += c;
+        }
+    }
+
+    void BidiResolver::resolve_text(uint32_t flags) {
+        size_t n = chars.size();
+        lvls.resize(n);
+        initial.resize(n);
+        types.resize(n);
+        explicit_lvls.resize(n);
+        matching.resize(n);
+        run_index.resize(n);
+        paras.clear();
+        for (size_t i = 0; i < n; ++i)
+            initial[i] = bc(bidi_class(chars[i]));
+        std::copy(initial.begin(), initial.end(), types.begin());
+        // P1: split into paragraphs, keeping each separator with the
+        // paragraph it ends
+        size_t start = 0;
+        for (size_t i = 0; i < n; ++i) {
+            if (bc(initial[i]) == BC::B) {
+                paras.push_back({start, i + 1, 0});
+                start = i + 1;
+            }
+        }
+        if (start < n)
+            paras.push_back({start, n, 0});
+        for (auto& para: paras)
+            resolve_paragraph(para, flags);
+    }
+
+    void BidiResolver::resolve_paragraph(Paragraph& para, uint32_t flags) {
+        // BD9: match isolate initiators with PDIs
+        stack.clear();
+        for (size_t i = para.begin; i < para.end; ++i) {
+            matching[i] = npos;
+            auto t = bc(initial[i]);
+            if (is_isolate_initiator(t)) {
+                stack.push_back(i);
+            } else if (t == BC::PDI && ! stack.empty()) {
+                matching[stack.back()] = i;
+                matching[i] = stack.back();
+                stack.pop_back();
+            }
+        }
+        // P2-P3: paragraph level
+        if (flags & Bidi::rtl)
+            para.level = 1;
+        else if (flags & Bidi::ltr)
+            para.level = 0;
+        else
+            para.level = first_strong(para.begin, para.end) == BC::R ? 1 : 0;
+        resolve_explicit(para);
+        resolve_sequences(para);
+        // Removed characters take the level of the preceding character, so
+        // they do not break up runs when reordering
+        for (size_t i = para.begin; i < para.end; ++i)
+            if (bc(types[i]) == BC::BN)
+                lvls[i] = i == para.begin ? para.level : lvls[i - 1];
+    }
+
+    void BidiResolver::resolve_explicit(const Paragraph& para) {
+        // X1-X8: the directional status stack never grows past max_depth+2
+        // entries, so it lives on the stack
+        struct Status {
+            uint8_t level;
+            BC override;
+            bool isolate;
+        };
+        std::array<Status, max_depth + 2> status;
+        size_t sp = 0;
+        status[sp++] = {para.level, BC::Default, false};
+        int overflow_isolates = 0;
+        int overflow_embeddings = 0;
+        int valid_isolates = 0;
+        auto apply_top = [&] (size_t i) {
+            auto& top = status[sp - 1];
+            lvls[i] = top.level;
+            if (top.override != BC::Default)
+                types[i] = bc(top.override);
+        };
+        for (size_t i = para.begin; i < para.end; ++i) {
+            auto t = bc(initial[i]);
+            switch (t) {
+                case BC::RLE: case BC::LRE: case BC::RLO: case BC::LRO: {
+                    // X2-X5
+                    bool rtl = t == BC::RLE || t == BC::RLO;
+                    uint8_t lev = status[sp - 1].level;
+                    uint8_t next = rtl ? next_odd(lev) : next_even(lev);
+                    if (next <= max_depth && overflow_isolates == 0 && overflow_embeddings == 0) {
+                        BC ov = t == BC::RLO ? BC::R : t == BC::LRO ? BC::L : BC::Default;
+                        status[sp++] = {next, ov, false};
+                    } else if (overflow_isolates == 0) {
+                        ++overflow_embeddings;
+                    }
+                    lvls[i] = status[sp - 1].level;
+                    types[i] = bc(BC::BN);
+                    break;
+                }
+                case BC::RLI: case BC::LRI: case BC::FSI: {
+                    // X5a-X5c
+                    apply_top(i);
+                    bool rtl = t == BC::RLI;
+                    if (t == BC::FSI) {
+                        size_t stop = matching[i] == npos ? para.end : matching[i];
+                        rtl = first_strong(i + 1, stop) == BC::R;
+                    }
+                    uint8_t lev = status[sp - 1].level;
+                    uint8_t next = rtl ? next_odd(lev) : next_even(lev);
+                    if (next <= max_depth && overflow_isolates == 0 && overflow_embeddings == 0) {
+                        ++valid_isolates;
+                        status[sp++] = {next, BC::Default, true};
+                    } else {
+                        ++overflow_isolates;
+                    }
+                    break;
+                }
+                case BC::PDI: {
+                    // X6a
+                    if (overflow_isolates > 0) {
+                        --overflow_isolates;
+                    } else if (valid_isolates > 0) {
+                        overflow_embeddings = 0;
+                        while (! status[sp - 1].isolate)
+                            --sp;
+                        --sp;
+                        --valid_isolates;
+                    }
+                    apply_top(i);
+                    break;
+                }
+                case BC::PDF: {
+                    // X7
+                    if (overflow_isolates > 0) {
+                        // Do nothing
+                    } else if (overflow_embeddings > 0) {
+                        --overflow_embeddings;
+                    } else if (! status[sp - 1].isolate && sp >= 2) {
+                        --sp;
+                    }
+                    lvls[i] = status[sp - 1].level;
+                    types[i] = bc(BC::BN);
+                    break;
+                }
+                case BC::B: {
+                    // X8
+                    lvls[i] = para.level;
+                    break;
+                }
+                case BC::BN: {
+                    lvls[i] = status[sp - 1].level;
+                    break;
+                }
+                default: {
+                    // X6
+                    apply_top(i);
+                    break;
+                }
+            }
+        }
+    }
+
+    void BidiResolver::resolve_sequences(const Paragraph& para) {
+        // X10: divide the paragraph into level runs, ignoring removed
+        // characters, then chain them into isolating run sequences. The
+        // explicit levels are kept because sos and eos must be found from
+        // them, not from the levels of sequences already resolved.
+        std::copy(lvls.begin() + para.begin, lvls.begin() + para.end, explicit_lvls.begin() + para.begin);
+        runs.clear();
+        size_t last = npos;
+        for (size_t i = para.begin; i < para.end; ++i) {
+            if (bc(types[i]) == BC::BN)
+                continue;
+            if (last == npos || lvls[i] != lvls[last]) {
+                run_index[i] = runs.size();
+                runs.push_back({i, i, false});
+            } else {
+                runs.back().last = i;
+            }
+            last = i;
+        }
+        for (size_t r = 0; r < runs.size(); ++r) {
+            if (runs[r].done)
+                continue;
+            seq.clear();
+            for (size_t cur = r;;) {
+                auto& run = runs[cur];
+                run.done = true;
+                for (size_t i = run.first; i <= run.last; ++i)
+                    if (bc(types[i]) != BC::BN)
+                        seq.push_back(i);
+                size_t pdi = matching[run.last];
+                if (! is_isolate_initiator(bc(initial[run.last])) || pdi == npos)
+                    break;
+                cur = run_index[pdi];
+                if (runs[cur].first != pdi || runs[cur].done)
+                    break;
+            }
+            resolve_sequence(para);
+        }
+    }
+
+    void BidiResolver::resolve_sequence(const Paragraph& para) {
+        size_t len = seq.size();
+        size_t first = seq.front(), last = seq.back();
+        uint8_t level = explicit_lvls[first];
+        auto type = [&] (size_t k) -> BC { return bc(types[seq[k]]); };
+        auto set_type = [&] (size_t k, BC t) { types[seq[k]] = bc(t); };
+        // Start and end of sequence types, from the higher of the adjacent
+        // levels
+        size_t i = first;
+        while (i > para.begin && bc(types[i - 1]) == BC::BN)
+            --i;
+        uint8_t before = i > para.begin ? explicit_lvls[i - 1] : para.level;
+        uint8_t after = para.level;
+        if (! is_isolate_initiator(bc(initial[last]))) {
+            i = last + 1;
+            while (i < para.end && bc(types[i]) == BC::BN)
+                ++i;
+            if (i < para.end)
+                after = explicit_lvls[i];
+        }
+        BC sos = level_direction(std::max(level, before));
+        BC eos = level_direction(std::max(level, after));
+        // W1: NSM takes the type of the previous character, or ON after an
+        // isolate initiator or PDI
+        BC prev = sos;
+        for (size_t k = 0; k < len; ++k) {
+            if (type(k) == BC::NSM)
+                set_type(k, is_isolate_control(prev) ? BC::ON : prev);
+            prev = type(k);
+        }
+        // W2: EN after AL becomes AN; W3: AL becomes R
+        prev = sos;
+        for (size_t k = 0; k < len; ++k) {
+            auto t = type(k);
+            if (t == BC::EN && prev == BC::AL)
+                set_type(k, BC::AN);
+            else if (t == BC::L || t == BC::R || t == BC::AL)
+                prev = t;
+            if (t == BC::AL)
+                set_type(k, BC::R);
+        }
+        // W4: a single separator between two numbers of the same type
+        for (size_t k = 1; k + 1 < len; ++k) {
+            auto t = type(k), l = type(k - 1), r = type(k + 1);
+            if (t == BC::ES && l == BC::EN && r == BC::EN)
+                set_type(k, BC::EN);
+            else if (t == BC::CS && l == r && (l == BC::EN || l == BC::AN))
+                set_type(k, l);
+        }
+        // W5: terminators adjacent to EN
+        for (size_t k = 0; k < len;) {
+            if (type(k) != BC::ET) {
+                ++k;
+                continue;
+            }
+            size_t j = k + 1;
+            while (j < len && type(j) == BC::ET)
+                ++j;
+            if ((k > 0 && type(k - 1) == BC::EN) || (j < len && type(j) == BC::EN))
+                for (size_t m = k; m < j; ++m)
+                    set_type(m, BC::EN);
+            k = j;
+        }
+        // W6: remaining separators and terminators become ON
+        for (size_t k = 0; k < len; ++k) {
+            auto t = type(k);
+            if (t == BC::ES || t == BC::ET || t == BC::CS)
+                set_type(k, BC::ON);
+        }
+        // W7: EN after L becomes L
+        prev = sos;
+        for (size_t k = 0; k < len; ++k) {
+            auto t = type(k);
+            if (t == BC::EN && prev == BC::L)
+                set_type(k, BC::L);
+            else if (t == BC::L || t == BC::R)
+                prev = t;
+        }
+        // N0: bracket pairs
+        BC e = level_direction(level);
+        resolve_brackets(e, sos);
+        // N1-N2: runs of neutrals take the surrounding direction if both
+        // sides agree, otherwise the embedding direction
+        for (size_t k = 0; k < len;) {
+            if (! is_ni(type(k))) {
+                ++k;
+                continue;
+            }
+            size_t j = k + 1;
+            while (j < len && is_ni(type(j)))
+                ++j;
+            BC leading = k == 0 ? sos : strong_direction(type(k - 1));
+            BC trailing = j == len ? eos : strong_direction(type(j));
+            BC dir = leading == trailing ? leading : e;
+            for (size_t m = k; m < j; ++m)
+                set_type(m, dir);
+            k = j;
+        }
+        // I1-I2: implicit levels
+        for (size_t k = 0; k < len; ++k) {
+            auto t = type(k);
+            auto& lev = lvls[seq[k]];
+            if (lev % 2 == 0) {
+                if (t == BC::R)
+                    lev += 1;
+                else if (t == BC::AN || t == BC::EN)
+                    lev += 2;
+            } else if (t == BC::L || t == BC::EN || t == BC::AN) {
+                lev += 1;
+            }
+        }
+    }
+
+    void BidiResolver::resolve_brackets(BC e, BC sos) {
+        // BD16: identify bracket pairs, giving up on further openings if
+        // the stack overflows
+        size_t len = seq.size();
+        auto type = [&] (size_t k) -> BC { return bc(types[seq[k]]); };
+        std::array<std::pair<char32_t, size_t>, max_brackets> brackets;
+        size_t sp = 0;
+        pairs.clear();
+        for (size_t k = 0; k < len; ++k) {
+            if (type(k) != BC::ON)
+                continue;
+            char32_t c = chars[seq[k]];
+            char kind = bidi_paired_bracket_type(c);
+            if (kind == 'o') {
+                if (sp == max_brackets)
+                    break;
+                brackets[sp++] = {canonical_bracket(bidi_paired_bracket(c)), k};
+            } else if (kind == 'c') {
+                char32_t cc = canonical_bracket(c);
+                for (size_t s = sp; s > 0; --s) {
+                    if (brackets[s - 1].first == cc) {
+                        pairs.push_back({brackets[s - 1].second, k});
+                        sp = s - 1;
+                        break;
+                    }
+                }
+            }
+        }
+        std::sort(pairs.begin(), pairs.end(),
+            [] (const BracketPair& a, const BracketPair& b) { return a.open < b.open; });
+        // N0: resolve each pair from the strong types inside it, falling
+        // back on the preceding context
+        BC opposite = e == BC::L ? BC::R : BC::L;
+        for (auto& pair: pairs) {
+            bool found_e = false, found_opposite = false;
+            for (size_t k = pair.open + 1; k < pair.close && ! found_e; ++k) {
+                auto d = strong_direction(type(k));
+                if (d == e)
+                    found_e = true;
+                else if (d == opposite)
+                    found_opposite = true;
+            }
+            BC dir;
+            if (found_e) {
+                dir = e;
+            } else if (found_opposite) {
+                BC context = sos;
+                for (size_t k = pair.open; k > 0; --k) {
+                    auto d = strong_direction(type(k - 1));
+                    if (d != BC::Default) {
+                        context = d;
+                        break;
+                    }
+                }
+                dir = context == opposite ? opposite : e;
+            } else {
+                continue;
+            }
+            for (auto k: {pair.open, pair.close}) {
+                types[seq[k]] = bc(dir);
+                for (++k; k < len && bc(initial[seq[k]]) == BC::NSM; ++k)
+                    types[seq[k]] = bc(dir);
+            }
+        }
+    }
+
+    BC BidiResolver::first_strong(size_t begin, size_t end) const noexcept {
+        // P2: skip isolates, including unterminated ones
+        for (size_t i = begin; i < end; ++i) {
+            auto t = bc(initial[i]);
+            if (t == BC::L)
+                return BC::L;
+            if (t == BC::R || t == BC::AL)
+                return BC::R;
+            if (is_isolate_initiator(t)) {
+                if (matching[i] == npos)
+                    break;
+                i = matching[i];
+            }
+        }
+        return BC::Default;
+    }
+
+    void BidiResolver::apply_line_rules(size_t begin, size_t end) {
+        // L1: segment and paragraph separators, and any whitespace or
+        // isolate controls before them or at the end of the line, revert
+        // to the paragraph level
+        line_levels.assign(lvls.begin() + begin, lvls.begin() + end);
+        bool trailing = true;
+        for (size_t i = end; i-- > begin;) {
+            auto t = bc(initial[i]);
+            auto& lev = line_levels[i - begin];
+            if (t == BC::S || t == BC::B) {
+                lev = uint8_t(paragraph_level(i));
+                trailing = true;
+            } else if (trailing && (t == BC::WS || is_isolate_control(t) || is_removed_class(t))) {
+                lev = uint8_t(paragraph_level(i));
+            } else {
+                trailing = false;
+            }
+        }
+    }
+
+}
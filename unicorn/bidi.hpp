@@ -0,0 +1,82 @@
+#pragma once
+
+#include "unicorn/character.hpp"
+#include "unicorn/utf.hpp"
+#include "unicorn/utility.hpp"
+#include <string>
+#include <vector>
+
+namespace RS::Unicorn {
+
+    struct Bidi {
+        static constexpr uint32_t ltr = setbit<0>;  // Paragraph direction is left to right
+        static constexpr uint32_t rtl = setbit<1>;  // Paragraph direction is right to left
+    };
+
+    class BidiResolver {
+    public:
+        static constexpr int max_depth = 125;
+        BidiResolver() = default;
+        template <typename C> void resolve(const std::basic_string<C>& text, uint32_t flags = 0);
+        size_t size() const noexcept { return chars.size(); }
+        bool empty() const noexcept { return chars.empty(); }
+        const std::u32string& text() const noexcept { return chars; }
+        const std::vector<uint8_t>& levels() const noexcept { return lvls; }
+        const std::vector<size_t>& offsets() const noexcept { return ofs; }
+        int paragraph_level(size_t pos) const noexcept;
+        void reorder(size_t begin, size_t end, std::vector<size_t>& order);
+        void visual(size_t begin, size_t end, std::u32string& dst);
+    private:
+        struct Paragraph {
+            size_t begin;
+            size_t end;
+            uint8_t level;
+        };
+        struct LevelRun {
+            size_t first;
+            size_t last;
+            bool done;
+        };
+        struct BracketPair {
+            size_t open;
+            size_t close;
+        };
+        // Input
+        std::u32string chars;                 // Decoded text
+        std::vector<size_t> ofs;              // Code unit offset of each character
+        // Results
+        std::vector<uint8_t> lvls;            // Resolved embedding levels
+        std::vector<Paragraph> paras;         // Paragraph boundaries and levels
+        // Working buffers, kept between calls
+        std::vector<uint8_t> initial;         // Original bidi classes
+        std::vector<uint8_t> types;           // Bidi classes as resolved so far
+        std::vector<uint8_t> explicit_lvls;   // Embedding levels from X1-X8, before I1-I2
+        std::vector<size_t> matching;         // Matching PDI for each isolate initiator, and vice versa
+        std::vector<size_t> stack;            // Isolate initiators and other stacks
+        std::vector<size_t> seq;              // Characters in the current isolating run sequence
+        std::vector<LevelRun> runs;           // Level runs in the current paragraph
+        std::vector<size_t> run_index;        // Index of the level run starting at each character
+        std::vector<BracketPair> pairs;       // Bracket pairs in the current sequence
+        std::vector<uint8_t> line_levels;     // Levels after applying L1 to a line
+        void resolve_text(uint32_t flags);
+        void resolve_paragraph(Paragraph& para, uint32_t flags);
+        void resolve_explicit(const Paragraph& para);
+        void resolve_sequences(const Paragraph& para);
+        void resolve_sequence(const Paragraph& para);
+        void resolve_brackets(Bidi_Class e, Bidi_Class sos);
+        Bidi_Class first_strong(size_t begin, size_t end) const noexcept;
+        void apply_line_rules(size_t begin, size_t end);
+    };
+
+    template <typename C>
+    void BidiResolver::resolve(const std::basic_string<C>& text, uint32_t flags) {
+        chars.clear();
+        ofs.clear();
+        for (auto i = utf_begin(text), e = utf_end(text); i != e; ++i) {
+            chars.push_back(*i);
+            ofs.push_back(i.offset());
+        }
+        resolve_text(flags);
+    }
+
+}
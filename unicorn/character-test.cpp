@@ -1377,6 +1377,26 @@ void test_unicorn_character_case_folding_properties() {
     TEST_EQUAL(char_to_full_case(0x130, buf, Case::fold), 2);    TEST_EQUAL(buf[0], 0x69); TEST_EQUAL(buf[1], 0x307);
     TEST_EQUAL(char_to_full_case(0xfb03, buf, Case::fold), 3);   TEST_EQUAL(buf[0], 0x66); TEST_EQUAL(buf[1], 0x66); TEST_EQUAL(buf[2], 0x69);
 
+    TEST_EQUAL(char_to_nfkc_casefold('@', buf), 1);      TEST_EQUAL(buf[0], '@');
+    TEST_EQUAL(char_to_nfkc_casefold('A', buf), 1);      TEST_EQUAL(buf[0], 'a');
+    TEST_EQUAL(char_to_nfkc_casefold('a', buf), 1);      TEST_EQUAL(buf[0], 'a');
+    TEST_EQUAL(char_to_nfkc_casefold(0xa0, buf), 1);     TEST_EQUAL(buf[0], 0x20);
+    TEST_EQUAL(char_to_nfkc_casefold(0xad, buf), 0);
+    TEST_EQUAL(char_to_nfkc_casefold(0xdf, buf), 2);     TEST_EQUAL(buf[0], 0x73); TEST_EQUAL(buf[1], 0x73);
+    TEST_EQUAL(char_to_nfkc_casefold(0xe9, buf), 1);     TEST_EQUAL(buf[0], 0xe9);
+    TEST_EQUAL(char_to_nfkc_casefold(0xc9, buf), 1);     TEST_EQUAL(buf[0], 0xe9);
+    TEST_EQUAL(char_to_nfkc_casefold(0x130, buf), 2);    TEST_EQUAL(buf[0], 0x69); TEST_EQUAL(buf[1], 0x307);
+    TEST_EQUAL(char_to_nfkc_casefold(0x1f0, buf), 1);    TEST_EQUAL(buf[0], 0x1f0);
+    TEST_EQUAL(char_to_nfkc_casefold(0x1e96, buf), 1);   TEST_EQUAL(buf[0], 0x1e96);
+    TEST_EQUAL(char_to_nfkc_casefold(0x1fb7, buf), 2);   TEST_EQUAL(buf[0], 0x1fb6); TEST_EQUAL(buf[1], 0x3b9);
+    TEST_EQUAL(char_to_nfkc_casefold(0x1fd3, buf), 1);   TEST_EQUAL(buf[0], 0x390);
+    TEST_EQUAL(char_to_nfkc_casefold(0x1e9e, buf), 2);   TEST_EQUAL(buf[0], 0x73); TEST_EQUAL(buf[1], 0x73);
+    TEST_EQUAL(char_to_nfkc_casefold(0x2126, buf), 1);   TEST_EQUAL(buf[0], 0x3c9);
+    TEST_EQUAL(char_to_nfkc_casefold(0x3392, buf), 3);   TEST_EQUAL(buf[0], 0x6d); TEST_EQUAL(buf[1], 0x68); TEST_EQUAL(buf[2], 0x7a);
+    TEST_EQUAL(char_to_nfkc_casefold(0xfb03, buf), 3);   TEST_EQUAL(buf[0], 0x66); TEST_EQUAL(buf[1], 0x66); TEST_EQUAL(buf[2], 0x69);
+    TEST_EQUAL(char_to_nfkc_casefold(0xfdfa, buf), 18);  TEST_EQUAL(buf[0], 0x635); TEST_EQUAL(buf[17], 0x645);
+    TEST_EQUAL(char_to_nfkc_casefold(0xe0001, buf), 0);
+
 }
 
 void test_unicorn_character_names() {
@@ -1474,8 +1494,17 @@ void test_unicorn_character_decomposition_properties() {
         if (entry.second > 1)
             FAIL("U+" + hex(entry.first) + " appears in " + std::to_string(entry.second) + " decomposition tables");
 
-    for (auto&& entry: UnicornDetail::composition_table)
-        TEST_EQUAL(combining_class(entry.key[0]), 0);
+    size_t compositions = 0;
+    for (auto&& entry: UnicornDetail::composition_table) {
+        if (entry.key != 0) {
+            char32_t u1 = char32_t(entry.key >> 32), u2 = char32_t(entry.key & 0xffffffff);
+            TEST_EQUAL(combining_class(u1), 0);
+            TEST_EQUAL(canonical_composition(u1, u2), entry.value);
+            ++compositions;
+        }
+    }
+    TEST_COMPARE(compositions, >, 900);
+    TEST_COMPARE(compositions * 2, <=, UnicornDetail::composition_table.size());
 
     TEST_EQUAL(combining_class(0), 0);
     TEST_EQUAL(combining_class('A'), 0);
@@ -1513,6 +1542,50 @@ void test_unicorn_character_decomposition_properties() {
     TEST_EQUAL(canonical_composition(0x79, 0x308), 0xff);
     TEST_EQUAL(canonical_composition(0x1111, 0x1171), 0xd4cc); // Hangul
     TEST_EQUAL(canonical_composition(0xd4cc, 0x11b6), 0xd4db); // Hangul
+    TEST_EQUAL(canonical_composition(0xd4cc, 0x11a7), 0);      // Hangul (not a trailing consonant)
+    TEST_EQUAL(canonical_composition(0xd4db, 0x11b6), 0);      // Hangul (already LVT)
+    TEST_EQUAL(canonical_composition(0x1111, 0x1176), 0);      // Hangul (archaic vowel)
+
+    DECOMPOSITION_TEST(full_canonical, 'A', 0, std::u32string{});
+    DECOMPOSITION_TEST(full_canonical, 0xc0, 2, (std::u32string{'A',0x300}));
+    DECOMPOSITION_TEST(full_canonical, 0x1e69, 3, (std::u32string{'s',0x323,0x307}));
+    DECOMPOSITION_TEST(full_canonical, 0x1f82, 4, (std::u32string{0x3b1,0x313,0x300,0x345}));
+    DECOMPOSITION_TEST(full_canonical, 0xd4cc, 2, (std::u32string{0x1111,0x1171}));
+    DECOMPOSITION_TEST(full_canonical, 0xd4db, 3, (std::u32string{0x1111,0x1171,0x11b6}));
+    DECOMPOSITION_TEST(full_canonical, 0x2126, 1, (std::u32string{0x3a9}));
+    DECOMPOSITION_TEST(full_canonical, 0x1e9b, 2, (std::u32string{0x17f,0x307}));
+    DECOMPOSITION_TEST(full_compatibility, 'A', 0, std::u32string{});
+    DECOMPOSITION_TEST(full_compatibility, 0xbd, 3, (std::u32string{'1',0x2044,'2'}));
+    DECOMPOSITION_TEST(full_compatibility, 0x1e9b, 2, (std::u32string{'s',0x307}));
+    DECOMPOSITION_TEST(full_compatibility, 0xd4db, 3, (std::u32string{0x1111,0x1171,0x11b6}));
+    DECOMPOSITION_TEST(full_compatibility, 0x3300, 5, (std::u32string{0x30a2,0x30cf,0x309a,0x30fc,0x30c8}));
+
+    // Full decompositions must match recursive application of the single-step decompositions
+
+    auto recursive = [&buf] (char32_t c, bool compat) {
+        std::u32string out{c};
+        for (size_t i = 0; i < out.size();) {
+            size_t n = compat ? compatibility_decomposition(out[i], buf) : canonical_decomposition(out[i], buf);
+            if (n == 0)
+                ++i;
+            else
+                out.replace(i, 1, buf, n);
+        }
+        return out;
+    };
+
+    for (char32_t c = 0; c <= 0x10ffff; ++c) {
+        if (c == 0xd800)
+            c = 0xe000;
+        size_t n = full_canonical_decomposition(c, buf);
+        TEST_COMPARE(n, <=, max_full_canonical_decomposition);
+        std::u32string full = n == 0 ? std::u32string{c} : std::u32string(buf, n);
+        TEST_EQUAL(full, recursive(c, false));
+        n = full_compatibility_decomposition(c, buf);
+        TEST_COMPARE(n, <=, max_compatibility_decomposition);
+        full = n == 0 ? std::u32string{c} : std::u32string(buf, n);
+        TEST_EQUAL(full, recursive(c, true));
+    }
 
 }
 
@@ -1987,7 +2060,10 @@ void test_unicorn_character_test_all_the_things() {
     DECOMPOSE_ALL_THE_THINGS(char_to_full_lowercase);
     DECOMPOSE_ALL_THE_THINGS(char_to_full_titlecase);
     DECOMPOSE_ALL_THE_THINGS(char_to_full_casefold);
+    DECOMPOSE_ALL_THE_THINGS(char_to_nfkc_casefold);
     DECOMPOSE_ALL_THE_THINGS(canonical_decomposition);
     DECOMPOSE_ALL_THE_THINGS(compatibility_decomposition);
+    DECOMPOSE_ALL_THE_THINGS(full_canonical_decomposition);
+    DECOMPOSE_ALL_THE_THINGS(full_compatibility_decomposition);
 
 }
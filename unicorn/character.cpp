@@ -382,6 +382,28 @@ namespace RS::Unicorn {
         }
     }
 
+    size_t char_to_nfkc_casefold(char32_t c, char32_t* dst) noexcept {
+        using namespace UnicornDetail;
+        if (c <= last_ascii_char) {
+            *dst = c >= U'A' && c <= U'Z' ? c + 32 : c;
+            return 1;
+        }
+        std::array<char32_t, 3> value;
+        value[0] = not_found;
+        value = table_lookup(short_nfkc_casefold_table, c, value);
+        if (value[0] != not_found) {
+            size_t i = 0;
+            for (; i < value.size() && value[i]; ++i)
+                *dst++ = value[i];
+            return i;
+        }
+        auto n = extended_table_lookup(c, dst, long_nfkc_casefold_table);
+        if (n)
+            return n;
+        *dst = c;
+        return 1;
+    }
+
     // Character names
 
     namespace {
@@ -613,50 +635,59 @@ namespace RS::Unicorn {
 
     namespace {
 
+        // Hangul syllables are decomposed and composed arithmetically
+        // (Unicode Standard, chapter 3.12)
+
         static constexpr uint32_t sbase = 0xac00;
         static constexpr uint32_t lbase = 0x1100;
         static constexpr uint32_t vbase = 0x1161;
         static constexpr uint32_t tbase = 0x11a7;
+        static constexpr uint32_t lcount = 19;
+        static constexpr uint32_t vcount = 21;
         static constexpr uint32_t tcount = 28;
         static constexpr uint32_t ncount = 588;
+        static constexpr uint32_t scount = 11172;
 
-        size_t hangul_decomposition(char32_t c, char32_t* dst) {
-            auto type = hangul_syllable_type(c);
-            if (type != Hangul_Syllable_Type::LV && type != Hangul_Syllable_Type::LVT)
-                return 0;
+        // Two-part decomposition (LV or L+V, LVT to LV+T)
+
+        size_t hangul_decomposition(char32_t c, char32_t* dst) noexcept {
             uint32_t sindex = c - sbase;
-            if (type == Hangul_Syllable_Type::LV) {
-                uint32_t lindex = sindex / ncount;
-                uint32_t vindex = (sindex % ncount) / tcount;
-                dst[0] = lbase + lindex;
-                dst[1] = vbase + vindex;
+            if (sindex >= scount)
+                return 0;
+            uint32_t tindex = sindex % tcount;
+            if (tindex == 0) {
+                dst[0] = lbase + sindex / ncount;
+                dst[1] = vbase + (sindex % ncount) / tcount;
             } else {
-                uint32_t lvindex = (sindex / tcount) * tcount;
-                uint32_t tindex = sindex % tcount;
-                dst[0] = sbase + lvindex;
+                dst[0] = c - tindex;
                 dst[1] = tbase + tindex;
             }
             return 2;
         }
 
-        char32_t hangul_composition(char32_t u1, char32_t u2) noexcept {
-            auto type1 = hangul_syllable_type(u1), type2 = hangul_syllable_type(u2);
-            if (type1 == Hangul_Syllable_Type::L && type2 == Hangul_Syllable_Type::V) {
-                uint32_t lindex = u1 - lbase;
-                uint32_t vindex = u2 - vbase;
-                uint32_t lvindex = lindex * ncount + vindex * tcount;
-                return sbase + lvindex;
-            } else if (type1 == Hangul_Syllable_Type::LV && type2 == Hangul_Syllable_Type::T) {
-                char32_t lv[2];
-                hangul_decomposition(u1, lv);
-                uint32_t lindex = lv[0] - lbase;
-                uint32_t vindex = lv[1] - vbase;
-                uint32_t tindex = u2 - tbase;
-                uint32_t lvindex = lindex * ncount + vindex * tcount;
-                return sbase + lvindex + tindex;
-            } else {
+        // Full decomposition into jamo (L+V or L+V+T)
+
+        size_t hangul_full_decomposition(char32_t c, char32_t* dst) noexcept {
+            uint32_t sindex = c - sbase;
+            if (sindex >= scount)
                 return 0;
-            }
+            dst[0] = lbase + sindex / ncount;
+            dst[1] = vbase + (sindex % ncount) / tcount;
+            uint32_t tindex = sindex % tcount;
+            if (tindex == 0)
+                return 2;
+            dst[2] = tbase + tindex;
+            return 3;
+        }
+
+        char32_t hangul_composition(char32_t u1, char32_t u2) noexcept {
+            uint32_t lindex = u1 - lbase, vindex = u2 - vbase;
+            if (lindex < lcount && vindex < vcount)
+                return sbase + lindex * ncount + vindex * tcount;
+            uint32_t sindex = u1 - sbase, tindex = u2 - tbase;
+            if (sindex < scount && sindex % tcount == 0 && tindex - 1 < tcount - 1)
+                return u1 + tindex;
+            return 0;
         }
 
     }
@@ -666,12 +697,9 @@ namespace RS::Unicorn {
     }
 
     char32_t canonical_composition(char32_t u1, char32_t u2) noexcept {
-        using namespace UnicornDetail;
-        char32_t c(hangul_composition(u1, u2));
-        if (! c) {
-            std::array<char32_t, 2> key{{u1, u2}};
-            c = table_lookup(composition_table, key, char32_t(0));
-        }
+        char32_t c = hangul_composition(u1, u2);
+        if (! c)
+            c = UnicornDetail::pair_hash_lookup(UnicornDetail::composition_table, u1, u2);
         return c;
     }
 
@@ -693,6 +721,28 @@ namespace RS::Unicorn {
         return n;
     }
 
+    size_t full_canonical_decomposition(char32_t c, char32_t* dst) noexcept {
+        using namespace UnicornDetail;
+        if (c < 0xc0)
+            return 0;
+        size_t n(hangul_full_decomposition(c, dst));
+        if (! n)
+            n = extended_table_lookup(c, dst, full_canonical_table);
+        return n;
+    }
+
+    size_t full_compatibility_decomposition(char32_t c, char32_t* dst) noexcept {
+        using namespace UnicornDetail;
+        if (c < 0xa0)
+            return 0;
+        size_t n(hangul_full_decomposition(c, dst));
+        if (! n)
+            n = extended_table_lookup(c, dst, short_full_compatibility_table);
+        if (! n)
+            n = extended_table_lookup(c, dst, long_full_compatibility_table);
+        return n;
+    }
+
     // Enumeration properties
 
     East_Asian_Width east_asian_width(char32_t c) noexcept {
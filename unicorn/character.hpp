@@ -64,6 +64,8 @@ namespace RS::Unicorn {
     constexpr size_t max_case_decomposition           = 3;               // Maximum length of a full case mapping
     constexpr size_t max_canonical_decomposition      = 2;               // Maximum length of a canonical decomposition
     constexpr size_t max_compatibility_decomposition  = 18;              // Maximum length of a compatibility decomposition
+    constexpr size_t max_full_canonical_decomposition = 4;               // Maximum length of a fully expanded canonical decomposition
+    constexpr size_t max_nfkc_casefold_mapping        = 18;              // Maximum length of an NFKC_Casefold mapping
 
     // Exceptions
 
@@ -228,6 +230,7 @@ namespace RS::Unicorn {
     size_t char_to_full_titlecase(char32_t c, char32_t* dst) noexcept;
     size_t char_to_full_casefold(char32_t c, char32_t* dst) noexcept;
     size_t char_to_full_case(char32_t c, char32_t* dst, Case k) noexcept;
+    size_t char_to_nfkc_casefold(char32_t c, char32_t* dst) noexcept;
 
     // Character names
 
@@ -250,6 +253,8 @@ namespace RS::Unicorn {
     char32_t canonical_composition(char32_t u1, char32_t u2) noexcept;
     size_t canonical_decomposition(char32_t c, char32_t* dst) noexcept;
     size_t compatibility_decomposition(char32_t c, char32_t* dst) noexcept;
+    size_t full_canonical_decomposition(char32_t c, char32_t* dst) noexcept;
+    size_t full_compatibility_decomposition(char32_t c, char32_t* dst) noexcept;
 
     // Enumeration properties
 
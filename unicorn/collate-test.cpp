@@ -0,0 +1,120 @@
+#include "unicorn/collate.hpp"
+#include "unicorn/string.hpp"
+#include "unicorn/unit-test.hpp"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace RS;
+using namespace RS::Unicorn;
+using namespace std::literals;
+
+namespace {
+
+    Ustring sort_collated(Strings list, uint32_t flags = 0) {
+        Collator col(flags);
+        std::stable_sort(list.begin(), list.end(), [&col] (const Ustring& a, const Ustring& b) { return col.compare(a, b) == -1; });
+        return to_str(list);
+    }
+
+}
+
+void test_unicorn_collate_compare() {
+
+    TEST_EQUAL(collation_compare(""s, ""s), 0);
+    TEST_EQUAL(collation_compare(""s, "a"s), -1);
+    TEST_EQUAL(collation_compare("a"s, ""s), 1);
+    TEST_EQUAL(collation_compare("a"s, "b"s), -1);
+    TEST_EQUAL(collation_compare("a"s, "A"s), -1);
+    TEST_EQUAL(collation_compare("A"s, "b"s), -1);
+    TEST_EQUAL(collation_compare("resume"s, "résumé"s), -1);
+    TEST_EQUAL(collation_compare("rôle"s, "roles"s), -1);
+    TEST_EQUAL(collation_compare("role"s, "rôle"s), -1);
+    TEST_EQUAL(collation_compare("9"s, "10"s), 1);
+    TEST_EQUAL(collation_compare("abc"s, "αβγ"s), -1);
+    TEST_EQUAL(collation_compare("\u00e9"s, "e\u0301"s), 0);
+    TEST_EQUAL(collation_compare("a\0b"s, "ab"s), 0);
+
+    // Strength
+    TEST_EQUAL(collation_compare("résumé"s, "RESUME"s, Collate::primary), 0);
+    TEST_EQUAL(collation_compare("résumé"s, "RESUME"s, Collate::secondary), 1);
+    TEST_EQUAL(collation_compare("résumé"s, "RÉSUMÉ"s, Collate::secondary), 0);
+    TEST_EQUAL(collation_compare("résumé"s, "RÉSUMÉ"s), -1);
+
+    // Variable weighting
+    TEST_EQUAL(collation_compare("de-Luge"s, "deluge"s), -1);
+    TEST_EQUAL(collation_compare("de-Luge"s, "deluge"s, Collate::shifted), 1);
+    TEST_EQUAL(collation_compare("de-luge"s, "deluge"s, Collate::shifted), -1);
+    TEST_EQUAL(collation_compare("de-luge"s, "deluge"s, Collate::shifted | Collate::secondary), 0);
+    TEST_EQUAL(collation_compare("de luge"s, "de-luge"s, Collate::shifted | Collate::primary), 0);
+
+    // Contractions, including discontiguous matches
+    TEST_EQUAL(collation_compare("\u0439"s, "\u0438\u0306"s), 0);
+    TEST_EQUAL(collation_compare("\u0439"s, "\u0438"s, Collate::primary), 1);
+    TEST_EQUAL(collation_compare("\u0438\u0323\u0306"s, "\u0438"s, Collate::primary), 1);
+    TEST_EQUAL(collation_compare("\u0438\u0323\u0306"s, "\u0439"s, Collate::primary), 0);
+    TEST_EQUAL(collation_key("\u0438\u0323\u0306"s, Collate::primary), collation_key("\u0439"s, Collate::primary));
+
+    // Implicit weights
+    TEST_EQUAL(collation_compare("z"s, "一"s), -1);
+    TEST_EQUAL(collation_compare("一"s, "丁"s), -1);
+    TEST_EQUAL(collation_compare("丁"s, "㐀"s), -1);
+    TEST_EQUAL(collation_compare("\U00017000"s, "一"s), -1);
+    TEST_EQUAL(collation_compare("一"s, "\U000e0080"s), -1);
+    TEST_EQUAL(collation_compare("\U00017000"s, "\U00018d00"s), -1);
+    TEST_EQUAL(collation_compare("\U00017001"s, "\U00018d01"s), -1);
+    TEST_EQUAL(collation_compare("\U00018aff"s, "\U00018d00"s), -1);
+    TEST_EQUAL(collation_compare("\U00018d00"s, "\U00018d01"s), -1);
+    TEST_EQUAL(collation_compare("\U00017000"s, "\U00018d00"s, Collate::primary), -1);
+    TEST_EQUAL(collation_compare("\U00018d08"s, "一"s), -1);
+    TEST_EQUAL(collation_compare("一"s, "\U00018d09"s), -1);
+    TEST_EQUAL(collation_compare("\U00018d09"s, "\U000e0080"s), -1);
+
+    TEST_EQUAL(sort_collated({"pêche", "Péché", "peach", "pèche", "péché"}), "[peach,péché,Péché,pèche,pêche]");
+    TEST_EQUAL(sort_collated({"zebra", "Ångström", "apple", "Zoo", "angle", "Apple"}), "[angle,Ångström,apple,Apple,zebra,Zoo]");
+
+    StringCompare<Strcmp::less | Strcmp::collate> less;
+    StringCompare<Strcmp::triple | Strcmp::collate | Strcmp::icase> triple_icase;
+    StringCompare<Strcmp::triple | Strcmp::collate | Strcmp::fallback> triple_fallback;
+    TEST(less("résumé"s, "rose"s));
+    TEST(! less("rose"s, "résumé"s));
+    TEST_EQUAL(triple_icase("Résumé"s, "résumé"s), 0);
+    TEST_EQUAL(triple_icase("resume"s, "résumé"s), -1);
+    TEST_EQUAL(triple_fallback("a\0b"s, "ab"s), -1);
+
+}
+
+void test_unicorn_collate_keys() {
+
+    // Sort keys must order strings the same way as incremental comparison
+
+    Strings samples = {
+        "", " ", "-", "a", "A", "á", "Á", "à", "ab", "a b", "a-b", "aB", "Ab", "abc",
+        "b", "B", "co-op", "coop", "co op", "Coop", "cote", "côte", "coté", "côté",
+        "\u00e9", "e\u0301", "ë", "ss", "ß", "SS", "ﬃ", "ffi", "9", "10", "½",
+        "α", "Α", "ά", "\u0438", "\u0439", "\u0438\u0306", "\u0438\u0323\u0306", "一", "㐀", "\U00020000",
+        "\U00017000", "\u0378", "\uac00", "\uac01", "\u1100\u1161", "a\0"s, "\u00ad",
+    };
+
+    for (uint32_t flags: {0u, Collate::primary, Collate::secondary, Collate::shifted, Collate::shifted | Collate::secondary}) {
+        Collator col(flags);
+        for (auto& a: samples) {
+            Ustring ka = col.key(a);
+            for (auto& b: samples) {
+                Ustring kb = col.key(b);
+                int c = ka.compare(kb);
+                c = c < 0 ? -1 : c == 0 ? 0 : 1;
+                TEST_EQUAL(col.compare(a, b), c);
+                TEST_EQUAL(col.compare(b, a), - c);
+            }
+        }
+    }
+
+    Strings list = samples;
+    Strings expect = samples;
+    std::stable_sort(expect.begin(), expect.end(), StringCompare<Strcmp::less | Strcmp::collate>());
+    TRY(str_sort_by_key(list, [] (const Ustring& s) { return collation_key(s); }));
+    TEST(list == expect);
+
+}
+
@@ -0,0 +1,310 @@
+#include "unicorn/collate.hpp"
+#include "unicorn/string.hpp"
+#include "unicorn/ucd-tables.hpp"
+#include "unicorn/utf.hpp"
+#include <algorithm>
+#include <array>
+
+namespace RS::Unicorn {
+
+    namespace {
+
+        using namespace UnicornDetail;
+
+        using ContractionKey = std::array<char32_t, 3>;
+        using WeightList = std::vector<CollationWeights>;
+
+        // Layout of the generated tables (see make-tables)
+
+        constexpr uint32_t contraction_flag = 0x80;
+        constexpr uint32_t element_count_mask = 0x7f;
+        constexpr uint16_t secondary_offset = 0x1f;
+        constexpr uint16_t max_quaternary = 0xffff;
+
+        uint32_t single_entry(char32_t c) noexcept {
+            return table_lookup(collation_single_table, c, uint32_t(0));
+        }
+
+        uint32_t contraction_entry(const ContractionKey& key) noexcept {
+            return table_lookup(collation_contraction_table, key, uint32_t(0));
+        }
+
+        int collation_levels(uint32_t flags) noexcept {
+            if (flags & Collate::primary)
+                return 1;
+            else if (flags & Collate::secondary)
+                return 2;
+            else if (flags & Collate::shifted)
+                return 4;
+            else
+                return 3;
+        }
+
+        // Canonical decomposition, without building an intermediate UTF-8
+        // string, so the buffer can be reused between calls
+
+        void decompose_text(const Ustring& src, std::u32string& dst) {
+            size_t ascii = ascii_run_length(src.data(), src.size());
+            dst.assign(src.begin(), src.begin() + ascii);
+            if (ascii == src.size())
+                return;
+            char32_t buf[max_full_canonical_decomposition];
+            for (auto i = utf_iterator(src, ascii), e = utf_end(src); i != e; ++i) {
+                size_t n = full_canonical_decomposition(*i, buf);
+                if (n)
+                    dst.append(buf, n);
+                else
+                    dst += *i;
+            }
+            auto by_class = [] (char32_t a, char32_t b) { return combining_class(a) < combining_class(b); };
+            for (size_t i = ascii, j = ascii; i < dst.size(); i = j + 1) {
+                while (i < dst.size() && combining_class(dst[i]) == 0)
+                    ++i;
+                for (j = i; j < dst.size() && combining_class(dst[j]) != 0; ++j) {}
+                if (j - i > 1)
+                    std::stable_sort(dst.begin() + i, dst.begin() + j, by_class);
+            }
+        }
+
+        // Generates the collation elements for a decomposed string one at a
+        // time (UTS10 S2), applying variable weighting as it goes (S3.4-3.5)
+
+        class ElementReader {
+        public:
+            ElementReader(std::u32string& text, uint32_t flags) noexcept:
+                chars(text), shifted((flags & Collate::shifted) != 0) {}
+            bool next(CollationWeights& w);
+        private:
+            std::u32string& chars;
+            size_t pos = 0;
+            const uint32_t* element = nullptr;
+            const uint32_t* element_end = nullptr;
+            std::array<uint32_t, 2> implicit;
+            bool shifted = false;
+            bool after_variable = false;
+            void lookup();
+            void derive(char32_t c) noexcept;
+        };
+
+        bool ElementReader::next(CollationWeights& w) {
+            for (;;) {
+                if (element == element_end) {
+                    if (pos == chars.size())
+                        return false;
+                    lookup();
+                }
+                uint32_t e = *element++;
+                auto p = uint16_t(e >> 16), s = uint16_t((e >> 7) & 0x1ff), t = uint16_t((e >> 2) & 0x1f);
+                bool variable = (e & 1) != 0;
+                if (shifted && variable) {
+                    w = {0, 0, 0, p};
+                    after_variable = true;
+                } else if (p == 0 && (s == 0 || (shifted && after_variable))) {
+                    continue;
+                } else {
+                    w = {p, s, t, max_quaternary};
+                    if (p != 0)
+                        after_variable = false;
+                }
+                return true;
+            }
+        }
+
+        void ElementReader::lookup() {
+            char32_t c = chars[pos];
+            uint32_t entry = single_entry(c);
+            if (entry == 0) {
+                derive(c);
+                ++pos;
+                return;
+            }
+            size_t span = 1;
+            if (entry & contraction_flag) {
+                // Find the longest contiguous match, then extend it with any
+                // unblocked non-starters that form a longer match (S2.1)
+                ContractionKey key = {{c, 0, 0}};
+                for (size_t n = std::min(chars.size() - pos, key.size()); n >= 2; --n) {
+                    std::copy_n(chars.begin() + pos, n, key.begin());
+                    std::fill(key.begin() + n, key.end(), 0);
+                    uint32_t match = contraction_entry(key);
+                    if (match) {
+                        entry = match;
+                        span = n;
+                        break;
+                    }
+                }
+                key = {{0, 0, 0}};
+                std::copy_n(chars.begin() + pos, span, key.begin());
+                size_t len = span;
+                int blocking = 0;
+                for (size_t i = pos + span; i < chars.size() && len < key.size();) {
+                    int cc = combining_class(chars[i]);
+                    if (cc == 0)
+                        break;
+                    if (cc > blocking) {
+                        key[len] = chars[i];
+                        uint32_t match = contraction_entry(key);
+                        if (match) {
+                            entry = match;
+                            ++len;
+                            chars.erase(i, 1);
+                            continue;
+                        }
+                        key[len] = 0;
+                    }
+                    blocking = std::max(blocking, cc);
+                    ++i;
+                }
+            }
+            pos += span;
+            element = collation_element_table.begin() + (entry >> 8);
+            element_end = element + (entry & element_count_mask);
+        }
+
+        void ElementReader::derive(char32_t c) noexcept {
+            // Implicit weights for characters not in the table (UTS10 10.1);
+            // the script ranges only apply to assigned characters
+            uint32_t base = 0, offset = 0;
+            KeyValue<char32_t, std::array<char32_t, 3>> t = {c, {{0, 0, 0}}};
+            auto it = std::upper_bound(collation_implicit_table.begin(), collation_implicit_table.end(), t);
+            if (it != collation_implicit_table.begin() && c <= (it - 1)->value[0] && char_is_assigned(c)) {
+                --it;
+                base = it->value[1];
+                offset = c - it->value[2];
+            } else {
+                if (! sparse_set_lookup(unified_ideograph_table, c))
+                    base = 0xfbc0;
+                else if ((c >= 0x4e00 && c <= 0x9fff) || (c >= 0xf900 && c <= 0xfaff))
+                    base = 0xfb40;
+                else
+                    base = 0xfb80;
+                base += c >> 15;
+                offset = c & 0x7fff;
+            }
+            implicit = {{(base << 16) + (0x20 << 7) + (0x02 << 2), (offset | 0x8000) << 16}};
+            element = implicit.data();
+            element_end = element + implicit.size();
+        }
+
+        int compare_level(const WeightList& lhs, const WeightList& rhs, uint16_t CollationWeights::*level) noexcept {
+            auto i = lhs.begin(), j = rhs.begin();
+            for (;;) {
+                while (i != lhs.end() && (*i).*level == 0)
+                    ++i;
+                while (j != rhs.end() && (*j).*level == 0)
+                    ++j;
+                if (i == lhs.end() || j == rhs.end())
+                    return i != lhs.end() ? 1 : j != rhs.end() ? -1 : 0;
+                if ((*i).*level != (*j).*level)
+                    return (*i).*level < (*j).*level ? -1 : 1;
+                ++i;
+                ++j;
+            }
+        }
+
+    }
+
+    namespace UnicornDetail {
+
+        int do_compare_collate(const Ustring& lhs, const Ustring& rhs, uint32_t flags) {
+            return collation_compare(lhs, rhs, flags);
+        }
+
+    }
+
+    // Class Collator
+
+    int Collator::compare(const Ustring& lhs, const Ustring& rhs) {
+        if (lhs == rhs)
+            return 0;
+        decompose_text(lhs, text1);
+        decompose_text(rhs, text2);
+        ElementReader r1(text1, cflags), r2(text2, cflags);
+        CollationWeights w;
+        weights1.clear();
+        weights2.clear();
+        // Compare primary weights as the elements are generated, stopping
+        // at the first difference; the other levels are only needed if all
+        // the primary weights match
+        for (;;) {
+            uint16_t p1 = 0, p2 = 0;
+            while (p1 == 0 && r1.next(w)) {
+                weights1.push_back(w);
+                p1 = w.primary;
+            }
+            while (p2 == 0 && r2.next(w)) {
+                weights2.push_back(w);
+                p2 = w.primary;
+            }
+            if (p1 != p2)
+                return p1 < p2 ? -1 : 1;
+            if (p1 == 0)
+                break;
+        }
+        int levels = collation_levels(cflags), c = 0;
+        if (levels >= 2)
+            c = compare_level(weights1, weights2, &CollationWeights::secondary);
+        if (c == 0 && levels >= 3)
+            c = compare_level(weights1, weights2, &CollationWeights::tertiary);
+        if (c == 0 && levels >= 4)
+            c = compare_level(weights1, weights2, &CollationWeights::quaternary);
+        return c;
+    }
+
+    Ustring Collator::key(const Ustring& str) {
+        // Primary and quaternary weights are written as two bytes, never
+        // starting with a null; secondary and tertiary weights fit in one
+        // nonzero byte; levels are separated by a null byte (UTS10 S3)
+        decompose_text(str, text1);
+        ElementReader reader(text1, cflags);
+        CollationWeights w;
+        weights1.clear();
+        while (reader.next(w))
+            weights1.push_back(w);
+        int levels = collation_levels(cflags);
+        Ustring key;
+        key.reserve(levels * weights1.size() + 4);
+        for (auto& w: weights1) {
+            if (w.primary) {
+                key += char(w.primary >> 8);
+                key += char(w.primary & 0xff);
+            }
+        }
+        if (levels >= 2) {
+            key += '\0';
+            for (auto& w: weights1)
+                if (w.secondary)
+                    key += char(w.secondary - secondary_offset);
+        }
+        if (levels >= 3) {
+            key += '\0';
+            for (auto& w: weights1)
+                if (w.tertiary)
+                    key += char(w.tertiary);
+        }
+        if (levels >= 4) {
+            key += '\0';
+            for (auto& w: weights1) {
+                if (w.quaternary) {
+                    key += char(w.quaternary >> 8);
+                    key += char(w.quaternary & 0xff);
+                }
+            }
+        }
+        return key;
+    }
+
+    // Collation functions
+
+    Ustring collation_key(const Ustring& str, uint32_t flags) {
+        return Collator(flags).key(str);
+    }
+
+    int collation_compare(const Ustring& lhs, const Ustring& rhs, uint32_t flags) {
+        thread_local Collator collator;
+        if (collator.flags() != flags)
+            collator = Collator(flags);
+        return collator.compare(lhs, rhs);
+    }
+
+}
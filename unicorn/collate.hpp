@@ -0,0 +1,44 @@
+#pragma once
+
+#include "unicorn/character.hpp"
+#include "unicorn/utility.hpp"
+#include <string>
+#include <vector>
+
+namespace RS::Unicorn {
+
+    namespace UnicornDetail {
+
+        struct CollationWeights {
+            uint16_t primary;
+            uint16_t secondary;
+            uint16_t tertiary;
+            uint16_t quaternary;
+        };
+
+    }
+
+    struct Collate {
+        static constexpr uint32_t primary    = setbit<0>;  // Compare base characters only
+        static constexpr uint32_t secondary  = setbit<1>;  // Compare base characters and accents, ignoring case
+        static constexpr uint32_t shifted    = setbit<2>;  // Ignore spaces and punctuation except as a final tie break
+    };
+
+    class Collator {
+    public:
+        Collator() = default;
+        explicit Collator(uint32_t flags) noexcept: cflags(flags) {}
+        uint32_t flags() const noexcept { return cflags; }
+        int compare(const Ustring& lhs, const Ustring& rhs);
+        Ustring key(const Ustring& str);
+    private:
+        using weight_list = std::vector<UnicornDetail::CollationWeights>;
+        uint32_t cflags = 0;             // Collation flags
+        std::u32string text1, text2;     // Decomposed text, kept between calls
+        weight_list weights1, weights2;  // Weights of each collation element, kept between calls
+    };
+
+    Ustring collation_key(const Ustring& str, uint32_t flags = 0);
+    int collation_compare(const Ustring& lhs, const Ustring& rhs, uint32_t flags = 0);
+
+}
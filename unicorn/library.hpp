@@ -1,6 +1,8 @@
 #pragma once
 
+#include "unicorn/bidi.hpp"
 #include "unicorn/character.hpp"
+#include "unicorn/collate.hpp"
 #include "unicorn/environment.hpp"
 #include "unicorn/format.hpp"
 #include "unicorn/io.hpp"
@@ -129,3 +129,278 @@ void test_unicorn_normal_normalization() {
     #endif
 
 }
+
+void test_unicorn_normal_streaming() {
+
+    Strings samples = {
+        "",
+        "Hello world\n",
+        "\u1e0a\u0323\u1e0c\u0307\u0044\u0307\u0323\n",
+        "\u0045\u0304\u0300\u0112\u0300\u1e14\u0304\n",
+        "\u1100\uac00\u11a8\u1100\u1161\u11a8\n",
+        "\u05b8\u05b9\u05b1\u0591\u05c3\u05b0\u05ac\u059f\n",
+        "\u0301\u0300abc\u00c5\u212b\u0041\u030a\n",
+        "\ufb01\u3304\u0334\ufef5\u0656\u01c4\u0323\n",
+        "\U0001d15e\U0001d165\U0001d16e\u0f73\u0f75\n",
+    };
+
+    Ustring all = str_join(samples);
+
+    for (auto form: {NFC, NFD, NFKC, NFKD}) {
+        Ustring expect = normalize(all, form);
+        for (size_t chunk = 1; chunk <= 8; ++chunk) {
+            Normalizer norm(form);
+            TEST_EQUAL(norm.form(), form);
+            Ustring result;
+            for (size_t pos = 0; pos < all.size(); pos += chunk)
+                TRY(norm.add(all.substr(pos, chunk), result));
+            TRY(norm.flush(result));
+            TEST_EQUAL(result, expect);
+            TEST_EQUAL(norm.pending(), 0);
+        }
+        Strings out;
+        TRY(normalize_stream(samples, append(out), form));
+        TEST_EQUAL(str_join(out), expect);
+    }
+
+    Normalizer norm;
+    Ustring result;
+    TEST_EQUAL(norm.form(), NFC);
+    TRY(norm.add("A", result));              TEST_EQUAL(result, "");            TEST_EQUAL(norm.pending(), 1);
+    TRY(norm.add("\u030a", result));         TEST_EQUAL(result, "");            TEST_EQUAL(norm.pending(), 2);
+    TRY(norm.add("B\xcc", result));          TEST_EQUAL(result, "\u00c5");      TEST_EQUAL(norm.pending(), 2);
+    TRY(norm.add("\x81", result));           TEST_EQUAL(result, "\u00c5");      TEST_EQUAL(norm.pending(), 2);
+    TRY(norm.flush(result));                 TEST_EQUAL(result, "\u00c5B\u0301");  TEST_EQUAL(norm.pending(), 0);
+    result.clear();
+    TRY(norm.add("xyz\u0301", result));      TEST_EQUAL(result, "xy");
+    TRY(norm.clear());                       TEST_EQUAL(norm.pending(), 0);
+    TRY(norm.flush(result));                 TEST_EQUAL(result, "xy");
+
+}
+
+void test_unicorn_normal_stream_safe() {
+
+    const Ustring acute = "\u0301", cgj = "\u034f";
+    Ustring s, t;
+
+    s = "a" + str_repeat(acute, 30) + "b";
+    TEST_EQUAL(stream_safe(s), s);
+    TEST_EQUAL(normalize(s, NFC, Normalize::stream_safe), "\u00e1" + str_repeat(acute, 29) + "b");
+
+    s = "a" + str_repeat(acute, 40) + "b";
+    TEST_EQUAL(stream_safe(s), "a" + str_repeat(acute, 30) + cgj + str_repeat(acute, 10) + "b");
+    TEST_EQUAL(normalize(s, NFC), "\u00e1" + str_repeat(acute, 39) + "b");
+    TEST_EQUAL(normalize(s, NFC, Normalize::stream_safe), "\u00e1" + str_repeat(acute, 29) + cgj + str_repeat(acute, 10) + "b");
+    TEST_EQUAL(normalize(s, NFD, Normalize::stream_safe), "a" + str_repeat(acute, 30) + cgj + str_repeat(acute, 10) + "b");
+    TRY(stream_safe_in(s));
+    TEST_EQUAL(s, "a" + str_repeat(acute, 30) + cgj + str_repeat(acute, 10) + "b");
+
+    // U+0344 decomposes to two non-starters
+    s = "a" + str_repeat(acute, 29) + "\u0344";
+    TEST_EQUAL(stream_safe(s), "a" + str_repeat(acute, 29) + cgj + "\u0344");
+    s = "a" + str_repeat(acute, 28) + "\u0344";
+    TEST_EQUAL(stream_safe(s), s);
+
+    // U+00A8 has a trailing non-starter in its compatibility decomposition
+    s = "\u00a8" + str_repeat(acute, 30);
+    TEST_EQUAL(stream_safe(s), "\u00a8" + str_repeat(acute, 29) + cgj + acute);
+
+    s = "x" + str_repeat(acute, 10000) + "y";
+    Normalizer norm(NFD, Normalize::stream_safe);
+    TEST_EQUAL(norm.flags(), Normalize::stream_safe);
+    size_t max_pending = 0;
+    t.clear();
+    for (size_t pos = 0; pos < s.size(); pos += 7) {
+        TRY(norm.add(s.substr(pos, 7), t));
+        max_pending = std::max(max_pending, norm.pending());
+    }
+    TRY(norm.flush(t));
+    TEST_COMPARE(max_pending, <=, 32);
+    TEST_EQUAL(t, normalize(s, NFD, Normalize::stream_safe));
+    TEST_EQUAL(t, stream_safe(s));
+
+}
+
+void test_unicorn_normal_nfkc_casefold() {
+
+    // Reference implementation: iterate the separate steps until stable
+
+    auto slow_casefold = [] (const Ustring& src) {
+        Ustring s = src, t;
+        while (s != t) {
+            t = s;
+            s = str_casefold(normalize(s, NFKC));
+            str_remove_in_if(s, char_is_default_ignorable);
+            s = normalize(s, NFC);
+        }
+        return s;
+    };
+
+    Ustring s;
+
+    TEST_EQUAL(str_nfkc_casefold(""), "");
+    TEST_EQUAL(str_nfkc_casefold("Hello World"), "hello world");
+    TEST_EQUAL(str_nfkc_casefold("Stra\u00dfe"), "strasse");
+    TEST_EQUAL(str_nfkc_casefold("STRA\u1e9eE"), "strasse");
+    TEST_EQUAL(str_nfkc_casefold("\u00c9t\u00e9"), "\u00e9t\u00e9");
+    TEST_EQUAL(str_nfkc_casefold("E\u0301te\u0301"), "\u00e9t\u00e9");
+    TEST_EQUAL(str_nfkc_casefold("\ufb01le"), "file");
+    TEST_EQUAL(str_nfkc_casefold("\u2126"), "\u03c9");
+    TEST_EQUAL(str_nfkc_casefold("\u0130"), "i\u0307");
+    TEST_EQUAL(str_nfkc_casefold("co\u00adop"), "coop");
+    TEST_EQUAL(str_nfkc_casefold("e\u00ad\u0301"), "\u00e9");
+    TEST_EQUAL(str_nfkc_casefold("\u3392"), "mhz");
+    TEST_EQUAL(str_nfkc_casefold("\u1f88"), "\u1f00\u03b9");
+    TEST_EQUAL(str_nfkc_casefold("\uff21\uff22\uff23"), "abc");
+    TEST_EQUAL(str_nfkc_casefold("\u1100\u1161\u11a8"), "\uac01");
+
+    TEST_EQUAL(normalize("\u00c9", NFKD, Normalize::casefold), "e\u0301");
+    TEST_EQUAL(normalize("A\u0301\u00ad\u0323", NFKC, Normalize::casefold), "\u1ea1\u0301");
+
+    s = "\u00c5NGSTR\u00d6M";
+    TRY(str_nfkc_casefold_in(s));
+    TEST_EQUAL(s, "\u00e5ngstr\u00f6m");
+
+    for (char32_t c = 0; c < 0x30000; ++c) {
+        if (c == 0xd800)
+            c = 0xe000;
+        s.clear();
+        str_append_char(s, c);
+        TEST_EQUAL(str_nfkc_casefold(s), slow_casefold(s));
+    }
+
+    // For strings, the mapping is applied to each character of the original
+    // string before normalization, which is not the same as iterating the
+    // separate steps when a non-starter maps to a starter (U+0345)
+
+    TEST_EQUAL(str_nfkc_casefold("\u0397\u0345\u0300"), "\u03b7\u1f76");
+    TEST_EQUAL(slow_casefold("\u0397\u0345\u0300"), "\u1f74\u03b9");
+
+    for (auto& row: normalization_test_table) {
+        s.clear();
+        Strings hexcodes;
+        str_split(Ustring(row[0]), overwrite(hexcodes));
+        for (auto&& hc: hexcodes)
+            str_append_char(s, char32_t(strtoul(hc.data(), nullptr, 16)));
+        Ustring t;
+        char32_t buf[max_nfkc_casefold_mapping];
+        for (char32_t c: utf_range(s)) {
+            size_t n = char_to_nfkc_casefold(c, buf);
+            for (size_t i = 0; i < n; ++i)
+                str_append_char(t, buf[i]);
+        }
+        TEST_EQUAL(str_nfkc_casefold(s), normalize(t, NFC));
+    }
+
+}
+
+void test_unicorn_normal_cache() {
+
+    NormalizationCache cache(8, 16, 2);
+    Ustring s;
+
+    TEST_EQUAL(cache.capacity(), 8);
+    TEST_EQUAL(cache.max_length(), 16);
+    TEST_EQUAL(cache.size(), 0);
+
+    TEST_EQUAL(cache.normalize("A\u030a", NFC), "\u00c5");
+    TEST_EQUAL(cache.normalize("A\u030a", NFC), "\u00c5");
+    TEST_EQUAL(cache.normalize("A\u030a", NFD), "A\u030a");
+    TEST_EQUAL(cache.normalize("A\u030a", NFC, Normalize::casefold), "\u00e5");
+    TEST_EQUAL(cache.casefold("A\u030a"), "a\u030a");
+    TEST_EQUAL(cache.casefold("A\u030a"), "a\u030a");
+    TEST_EQUAL(cache.hits(), 2);
+    TEST_EQUAL(cache.misses(), 4);
+    TEST_EQUAL(cache.size(), 4);
+
+    s = "Too long to be cached";
+    TEST_EQUAL(cache.casefold(s), "too long to be cached");
+    TEST_EQUAL(cache.casefold(s), "too long to be cached");
+    TEST_EQUAL(cache.hits(), 2);
+    TEST_EQUAL(cache.misses(), 6);
+    TEST_EQUAL(cache.size(), 4);
+
+    for (int i = 0; i < 100; ++i)
+        TEST_EQUAL(cache.casefold("KEY" + std::to_string(i)), "key" + std::to_string(i));
+    TEST_COMPARE(cache.size(), <=, 8);
+    TEST_EQUAL(cache.misses(), 106);
+
+    TRY(cache.clear());
+    TEST_EQUAL(cache.size(), 0);
+    TEST_EQUAL(cache.hits(), 0);
+    TEST_EQUAL(cache.misses(), 0);
+
+    NormalizationCache disabled(0);
+    TEST_EQUAL(disabled.normalize("A\u030a", NFC), "\u00c5");
+    TEST_EQUAL(disabled.normalize("A\u030a", NFC), "\u00c5");
+    TEST_EQUAL(disabled.hits(), 0);
+    TEST_EQUAL(disabled.misses(), 2);
+    TEST_EQUAL(disabled.size(), 0);
+
+    NormalizationCache uneven(100, 256, 16);
+    for (int i = 0; i < 1000; ++i)
+        TEST_EQUAL(uneven.casefold("KEY" + std::to_string(i)), "key" + std::to_string(i));
+    TEST_COMPARE(uneven.size(), <=, 100);
+
+    Strings keys;
+    for (int i = 0; i < 50; ++i)
+        keys.push_back("Stra\u00dfe" + std::to_string(i) + "E\u0301");
+    NormalizationCache shared(1024);
+    std::vector<std::future<bool>> results;
+    for (int t = 0; t < 4; ++t) {
+        results.push_back(std::async(std::launch::async, [&keys, &shared] {
+            bool ok = true;
+            for (int rep = 0; rep < 20; ++rep) {
+                for (auto& key: keys) {
+                    ok = ok && shared.normalize(key, NFC) == normalize(key, NFC);
+                    ok = ok && shared.casefold(key) == str_casefold(key);
+                }
+            }
+            return ok;
+        }));
+    }
+    for (auto& r: results)
+        TEST(r.get());
+    TEST_EQUAL(shared.hits() + shared.misses(), 4 * 20 * 50 * 2);
+    TEST_COMPARE(shared.misses(), <=, 4 * 50 * 2);
+    TEST_EQUAL(shared.size(), 100);
+
+}
+
+void test_unicorn_normal_parallel() {
+
+    Ustring src;
+    for (size_t i = 0; src.size() < 100'000; ++i) {
+        auto& row = *(std::begin(normalization_test_table) + i % range_count(normalization_test_table));
+        Strings hexcodes;
+        str_split(Ustring(row[0]), overwrite(hexcodes));
+        for (auto&& hc: hexcodes)
+            str_append_char(src, char32_t(strtoul(hc.data(), nullptr, 16)));
+        if (i % 5 == 0)
+            src += ' ';
+        if (i % 7 == 0)
+            src += "\u00ad";
+    }
+    Ustring hangul = str_repeat("\u1100\u1161\u11a8\u0301", 10'000);
+    Ustring marks = "a" + str_repeat("\u0301\u0323", 10'000);
+
+    for (auto form: {NFC, NFD, NFKC, NFKD}) {
+        for (size_t threads: {0, 2, 5}) {
+            TEST_EQUAL(normalize_parallel(src, form, 0, threads), normalize(src, form));
+            TEST_EQUAL(normalize_parallel(src, form, Normalize::stream_safe, threads), normalize(src, form, Normalize::stream_safe));
+            TEST_EQUAL(normalize_parallel(src, form, Normalize::casefold, threads), normalize(src, form, Normalize::casefold));
+            TEST_EQUAL(normalize_parallel(hangul, form, 0, threads), normalize(hangul, form));
+            TEST_EQUAL(normalize_parallel(marks, form, 0, threads), normalize(marks, form));
+        }
+        TEST_EQUAL(normalize_parallel("", form, 0, 4), "");
+        TEST_EQUAL(normalize_parallel("A\u030a", form, 0, 4), normalize("A\u030a", form));
+    }
+
+    // U+FF9E is a starter with no canonical decomposition, but its NFKD is a
+    // non-starter, so it must not end a chunk in stream-safe mode
+    Ustring fill = str_repeat("x", 40'000);
+    Ustring streamed = fill + "a" + str_repeat("\u0301", 29) + "\uff9e" + str_repeat("\u0301", 2) + fill;
+    for (auto form: {NFC, NFD, NFKC, NFKD})
+        TEST_EQUAL(normalize_parallel(streamed, form, Normalize::stream_safe, 2), normalize(streamed, form, Normalize::stream_safe));
+
+}
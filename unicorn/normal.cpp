@@ -22,13 +22,77 @@ characters between them are all non-starters with a lower combining class than
 the second of the pair. Compose characters recursively until no more
 compositions are possible.
 
+Implementation:
+
+All three steps are carried out in a single forward pass. Each character is
+fully decomposed as it is read, using tables of precomputed full
+decompositions instead of repeatedly decomposing the output of each lookup
+(Hangul syllables are decomposed arithmetically). The decomposed characters
+are collected in a segment buffer holding one starter and the non-starters
+that follow it. When the next starter arrives, the non-starters in the buffer
+are sorted (only if they arrived out of order), composed into the starter (for
+NFC and NFKC), and the finished segment is written to the output. A new
+starter is first offered to the previous one for composition, which can only
+succeed if no non-starters were left over between them. Composition pairs are
+looked up in a generated hash table (Hangul again being arithmetic). Nothing
+is ever erased from or inserted into the middle of a string, so the running
+time is linear in the length of the input, apart from the sort of each run of
+non-starters.
+
+The same state is exposed through the Normalizer class for chunked input:
+between calls it holds back only the current segment (which may still
+compose with what follows), plus any incomplete UTF-8 sequence left at the
+end of the previous chunk.
+
+Stream-Safe Text Process (UAX #15, section 13):
+
+A sequence of more than 30 non-starters, counted in the NFKD decompositions of
+the input characters, is broken up by inserting U+034F COMBINING GRAPHEME
+JOINER (a starter with no visible effect). This bounds the length of a
+segment, and therefore the size of the segment buffer and the cost of sorting
+and composing it, no matter how many combining marks the input piles onto one
+base character.
+
+Parallel normalization:
+
+The input is divided into roughly equal chunks, and each chunk boundary is
+moved forward to the next character that is normalization-stable: its full
+decomposition starts with a starter, and (for NFC and NFKC) that starter can
+never be the second character of a canonical composition. Nothing before
+such a character can interact with anything after it, so the chunks can be
+normalized independently and the results concatenated. In stream-safe mode
+the character must also reset the non-starter count of the Stream-Safe Text
+Process, which is counted on NFKD even for the canonical forms: a character
+such as U+FF9E is a starter with no canonical decomposition, but its
+compatibility decomposition is a non-starter, so it is not a boundary there.
+With the NFKC_Casefold mapping, stability is judged on the first character of
+the mapping, and a character that maps to nothing is never a boundary.
+
+NFKC_Casefold:
+
+The NFKC_Casefold property (from DerivedNormalizationProps.txt) maps each
+character to the result of repeatedly applying NFKC, full case folding, and
+removal of default ignorable characters until nothing changes. Applying it to
+a string means mapping each character and then putting the result into NFC.
+Every mapping is already NFKC-stable, so its compatibility decomposition is
+the same as its canonical one, and the mapped characters can be fed straight
+into the NFKC pass above; the whole operation takes one pass over the input
+instead of the three or more passes needed to chain str_casefold() and
+normalize() until they converge.
+
 */
 
 #include "unicorn/normal.hpp"
 #include "unicorn/character.hpp"
+#include "unicorn/string.hpp"
+#include "unicorn/ucd-tables.hpp"
 #include "unicorn/utf.hpp"
 #include <algorithm>
+#include <functional>
+#include <future>
 #include <string>
+#include <thread>
+#include <vector>
 
 using namespace std::literals;
 
@@ -36,93 +100,369 @@ namespace RS::Unicorn {
 
     namespace {
 
-        void apply_decomposition(const Ustring& src, std::u32string& dst, bool k) {
-            auto decompose = k ? compatibility_decomposition : canonical_decomposition;
-            size_t max_decompose = k ? max_compatibility_decomposition : max_canonical_decomposition;
-            std::u32string buf(max_decompose, char32_t(0));
-            dst.reserve(src.size());
-            size_t pos = 0;
-            for (char32_t c: utf_range(src)) {
-                dst.resize(pos + max_decompose);
-                size_t len = decompose(c, &dst[pos]);
-                if (len == 0) {
-                    dst.resize(++pos);
-                    dst.back() = c;
+        constexpr char32_t combining_grapheme_joiner = 0x34f;
+        constexpr char32_t first_combining_mark = 0x300;  // No non-starters below this
+        constexpr size_t max_stream_safe_nonstarters = 30;
+
+        struct NonStarterCount {
+            size_t leading = 0;    // Non-starters before the first starter
+            size_t trailing = 0;   // Non-starters after the last starter
+            bool starter = false;  // Decomposition contains a starter
+        };
+
+        NonStarterCount count_nonstarters(char32_t c) noexcept {
+            NonStarterCount count;
+            char32_t buf[max_compatibility_decomposition];
+            size_t n = full_compatibility_decomposition(c, buf);
+            if (n == 0) {
+                buf[0] = c;
+                n = 1;
+            }
+            for (size_t i = 0; i < n; ++i) {
+                if (buf[i] <= last_ascii_char || combining_class(buf[i]) == 0) {
+                    count.starter = true;
+                    count.trailing = 0;
                 } else {
-                    dst.resize(pos + len);
-                    while (pos < dst.size()) {
-                        len = decompose(dst[pos], &buf[0]);
-                        if (len == 0)
-                            ++pos;
-                        else
-                            dst.replace(pos, 1, &buf[0], len);
-                    }
+                    if (! count.starter)
+                        ++count.leading;
+                    ++count.trailing;
                 }
             }
+            return count;
+        }
+
+        // Returns true if a CGJ needs to be inserted before this character
+
+        bool stream_safe_check(char32_t c, size_t& nonstarters) noexcept {
+            auto count = count_nonstarters(c);
+            bool insert = nonstarters + count.leading > max_stream_safe_nonstarters;
+            if (insert)
+                nonstarters = 0;
+            if (count.starter)
+                nonstarters = count.trailing;
+            else
+                nonstarters += count.leading;
+            return insert;
+        }
+
+        constexpr size_t min_parallel_chunk = 16384;
+
+        // Characters that can be the second character of a canonical
+        // composition, apart from the Hangul jamo
+
+        class CompositionSeconds {
+        public:
+            CompositionSeconds() {
+                for (auto& kv: UnicornDetail::composition_table)
+                    if (kv.key != 0)
+                        table.push_back(char32_t(kv.key & 0xffffffff));
+                std::sort(table.begin(), table.end());
+                table.erase(std::unique(table.begin(), table.end()), table.end());
+            }
+            bool contains(char32_t c) const noexcept { return std::binary_search(table.begin(), table.end(), c); }
+        private:
+            std::vector<char32_t> table;
+        };
+
+        const CompositionSeconds& composition_seconds() {
+            static const CompositionSeconds cs;
+            return cs;
         }
 
-        void apply_ordering(std::u32string& str) {
-            auto i = str.begin(), j = i, e = str.end();
-            while (j != e) {
-                i = std::find_if(j, e, combining_class);
-                if (i == e)
-                    break;
-                j = std::find_if_not(i, e, combining_class);
-                std::stable_sort(i, j, [] (char32_t a, char32_t b)
-                    { return combining_class(a) < combining_class(b); });
+        bool is_stable_boundary(char32_t c, NormalizationForm form, uint32_t flags) {
+            if (c <= last_ascii_char)
+                return true;
+            if (flags & Normalize::stream_safe) {
+                // The non-starter count is only reset by a character whose
+                // NFKD starts with a starter, even if the form is canonical
+                auto count = count_nonstarters(c);
+                if (! count.starter || count.leading != 0)
+                    return false;
+            }
+            bool compat = form == NFKC || form == NFKD;
+            char32_t buf[max_nfkc_casefold_mapping];
+            if (flags & Normalize::casefold) {
+                if (char_to_nfkc_casefold(c, buf) == 0)
+                    return false;
+                c = buf[0];
             }
+            if ((compat ? full_compatibility_decomposition(c, buf) : full_canonical_decomposition(c, buf)) != 0)
+                c = buf[0];
+            if (combining_class(c) != 0)
+                return false;
+            if (form == NFD || form == NFKD)
+                return true;
+            auto hst = hangul_syllable_type(c);
+            return hst != Hangul_Syllable_Type::V && hst != Hangul_Syllable_Type::T && ! composition_seconds().contains(c);
+        }
+
+        // Normalization cache operation tags (nonzero tags are normalization
+        // forms, with the flags in the higher bits)
+
+        constexpr uint32_t casefold_tag = 0;
+
+        Ustring apply_tag(uint32_t tag, const Ustring& src) {
+            if (tag == casefold_tag)
+                return str_casefold(src);
+            else
+                return normalize(src, NormalizationForm(tag & 0xff), tag >> 8);
+        }
+
+    }
+
+    void Normalizer::add(const Ustring& src, Ustring& dst) {
+        size_t pos = 0;
+        if (! partial.empty()) {
+            size_t len = UnicornDetail::utf8_sequence_length(partial[0]);
+            while (pos < src.size() && partial.size() < len && is_nonstart_unit(src[pos]))
+                partial += src[pos++];
+            if (partial.size() < len && pos == src.size())
+                return;
+            for (char32_t c: utf_range(partial))
+                next(c, dst);
+            partial.clear();
+        }
+        size_t end = src.size() - UnicornDetail::utf8_incomplete_tail(src, pos);
+        for (auto i = utf_iterator(src, pos); i.offset() < end; ++i)
+            next(*i, dst);
+        partial.assign(src, end, npos);
+    }
+
+    void Normalizer::flush(Ustring& dst) {
+        for (char32_t c: utf_range(partial))
+            next(c, dst);
+        partial.clear();
+        finish_segment();
+        write_segment(dst);
+        nonstarters = 0;
+    }
+
+    void Normalizer::next(char32_t c, Ustring& dst) {
+        if ((nflags & Normalize::stream_safe) && stream_safe_check(c, nonstarters))
+            decompose(combining_grapheme_joiner, dst);
+        if (nflags & Normalize::casefold) {
+            char32_t buf[max_nfkc_casefold_mapping];
+            size_t n = char_to_nfkc_casefold(c, buf);
+            for (size_t i = 0; i < n; ++i)
+                decompose(buf[i], dst);
+        } else {
+            decompose(c, dst);
         }
+    }
 
-        void apply_composition(std::u32string& str) {
-            if (str.size() < 2)
+    void Normalizer::decompose(char32_t c, Ustring& dst) {
+        char32_t buf[max_compatibility_decomposition];
+        size_t n = nform == NFKC || nform == NFKD ? full_compatibility_decomposition(c, buf) : full_canonical_decomposition(c, buf);
+        if (n == 0)
+            push(c, dst);
+        else
+            for (size_t i = 0; i < n; ++i)
+                push(buf[i], dst);
+    }
+
+    void Normalizer::push(char32_t c, Ustring& dst) {
+        int cc = c < first_combining_mark ? 0 : combining_class(c);
+        if (cc != 0) {
+            if (! seg.empty() && seg.back().cc > cc)
+                unsorted = true;
+            seg.push_back({c, cc});
+            return;
+        }
+        finish_segment();
+        if ((nform == NFC || nform == NFKC) && seg.size() == 1 && seg[0].cc == 0) {
+            char32_t u = canonical_composition(seg[0].code, c);
+            if (u) {
+                seg[0].code = u;
                 return;
-            auto i = str.begin(), e = str.end();
-            while (i != e) {
-                i = std::find_if_not(i, e, combining_class);
-                if (i == e)
-                    break;
-                bool combined = false;
-                int prev_cc = 0;
-                for (auto j = i + 1; j != e; ++j) {
-                    int cc = combining_class(*j);
-                    if (prev_cc == 0 || prev_cc < cc) {
-                        char32_t c = canonical_composition(*i, *j);
-                        if (c) {
-                            *i = c;
-                            str.erase(j);
-                            combined = true;
-                            break;
-                        }
-                    }
-                    if (cc == 0)
-                        break;
-                    prev_cc = cc;
+            }
+        }
+        write_segment(dst);
+        seg.push_back({c, 0});
+    }
+
+    void Normalizer::finish_segment() {
+        if (seg.size() < 2)
+            return;
+        auto marks = seg.begin() + int(seg[0].cc == 0);
+        if (unsorted) {
+            std::stable_sort(marks, seg.end(), [] (const CharClass& a, const CharClass& b) { return a.cc < b.cc; });
+            unsorted = false;
+        }
+        if ((nform != NFC && nform != NFKC) || seg[0].cc != 0)
+            return;
+        size_t w = 1;
+        int prev_cc = 0;
+        for (size_t r = 1; r < seg.size(); ++r) {
+            int cc = seg[r].cc;
+            if (prev_cc < cc) {
+                char32_t u = canonical_composition(seg[0].code, seg[r].code);
+                if (u) {
+                    seg[0].code = u;
+                    continue;
                 }
-                if (! combined)
-                    ++i;
             }
+            seg[w++] = seg[r];
+            prev_cc = cc;
+        }
+        seg.resize(w);
+    }
+
+    void Normalizer::write_segment(Ustring& dst) {
+        auto out = utf_writer(dst);
+        for (auto& cc: seg)
+            *out = cc.code;
+        seg.clear();
+    }
+
+    Ustring normalize(const Ustring& src, NormalizationForm form, uint32_t flags) {
+        Ustring dst;
+        dst.reserve(src.size());
+        Normalizer norm(form, flags);
+        norm.add(src, dst);
+        norm.flush(dst);
+        return dst;
+    }
+
+    void normalize_in(Ustring& src, NormalizationForm form, uint32_t flags) {
+        Ustring dst = normalize(src, form, flags);
+        src.swap(dst);
+    }
+
+    Ustring normalize_parallel(const Ustring& src, NormalizationForm form, uint32_t flags, size_t threads) {
+        if (threads == 0)
+            threads = std::max(size_t(std::thread::hardware_concurrency()), size_t(1));
+        threads = std::min(threads, src.size() / min_parallel_chunk);
+        if (threads <= 1)
+            return normalize(src, form, flags);
+        std::vector<size_t> bounds = {0};
+        size_t chunk = src.size() / threads;
+        for (size_t i = 1; i < threads; ++i) {
+            size_t pos = std::max(i * chunk, bounds.back()), limit = std::min((i + 1) * chunk, src.size());
+            while (pos < limit && is_nonstart_unit(src[pos]))
+                ++pos;
+            auto it = utf_iterator(src, pos);
+            while (it.offset() < limit && ! is_stable_boundary(*it, form, flags))
+                ++it;
+            if (it.offset() > bounds.back() && it.offset() < limit)
+                bounds.push_back(it.offset());
+        }
+        bounds.push_back(src.size());
+        std::vector<std::future<Ustring>> results;
+        for (size_t i = 1; i < bounds.size(); ++i) {
+            size_t begin = bounds[i - 1], end = bounds[i];
+            results.push_back(std::async(std::launch::async, [&src, begin, end, form, flags] {
+                return normalize(src.substr(begin, end - begin), form, flags);
+            }));
         }
+        std::vector<Ustring> parts;
+        size_t total = 0;
+        for (auto& r: results) {
+            parts.push_back(r.get());
+            total += parts.back().size();
+        }
+        Ustring dst;
+        dst.reserve(total);
+        for (auto& part: parts)
+            dst += part;
+        return dst;
+    }
+
+    Ustring stream_safe(const Ustring& src) {
+        Ustring dst;
+        dst.reserve(src.size());
+        auto out = utf_writer(dst);
+        size_t nonstarters = 0;
+        for (char32_t c: utf_range(src)) {
+            if (stream_safe_check(c, nonstarters))
+                *out = combining_grapheme_joiner;
+            *out = c;
+        }
+        return dst;
+    }
 
+    void stream_safe_in(Ustring& src) {
+        Ustring dst = stream_safe(src);
+        src.swap(dst);
     }
 
-    Ustring normalize(const Ustring& src, NormalizationForm form) {
-        using namespace UnicornDetail;
-        std::u32string utf32;
-        apply_decomposition(src, utf32, form == NFKC || form == NFKD);
-        apply_ordering(utf32);
-        if (form == NFC || form == NFKC)
-            apply_composition(utf32);
-        return to_utf8(utf32);
+    Ustring str_nfkc_casefold(const Ustring& src) {
+        return normalize(src, NFKC, Normalize::casefold);
     }
 
-    void normalize_in(Ustring& src, NormalizationForm form) {
-        using namespace UnicornDetail;
-        std::u32string utf32;
-        apply_decomposition(src, utf32, form == NFKC || form == NFKD);
-        apply_ordering(utf32);
-        if (form == NFC || form == NFKC)
-            apply_composition(utf32);
-        recode(utf32, src);
+    void str_nfkc_casefold_in(Ustring& src) {
+        Ustring dst = str_nfkc_casefold(src);
+        src.swap(dst);
+    }
+
+    NormalizationCache::NormalizationCache(size_t capacity, size_t max_length, size_t shards):
+    cap(capacity), maxlen(max_length), nshards(std::max(std::min(shards, capacity), size_t(1))) {
+        // Divide the capacity exactly, with any remainder going to the
+        // first shards
+        this->shards = std::make_unique<Shard[]>(nshards);
+        for (size_t i = 0; i < nshards; ++i)
+            this->shards[i].capacity = cap / nshards + (i < cap % nshards ? 1 : 0);
+    }
+
+    Ustring NormalizationCache::normalize(const Ustring& src, NormalizationForm form, uint32_t flags) {
+        return lookup(uint32_t(form) + (flags << 8), src);
+    }
+
+    Ustring NormalizationCache::casefold(const Ustring& src) {
+        return lookup(casefold_tag, src);
+    }
+
+    size_t NormalizationCache::size() const {
+        size_t n = 0;
+        for (size_t i = 0; i < nshards; ++i) {
+            auto lock = make_lock(shards[i].mutex);
+            n += shards[i].lru.size();
+        }
+        return n;
+    }
+
+    void NormalizationCache::clear() {
+        for (size_t i = 0; i < nshards; ++i) {
+            auto lock = make_lock(shards[i].mutex);
+            shards[i].index.clear();
+            shards[i].lru.clear();
+        }
+        nhits = 0;
+        nmisses = 0;
+    }
+
+    Ustring NormalizationCache::lookup(uint32_t tag, const Ustring& src) {
+        if (cap == 0 || src.size() > maxlen) {
+            ++nmisses;
+            return apply_tag(tag, src);
+        }
+        thread_local Ustring key;
+        key.assign(reinterpret_cast<const char*>(&tag), sizeof(tag));
+        key += src;
+        std::string_view view(key);
+        auto& shard = shards[std::hash<std::string_view>()(view) % nshards];
+        {
+            auto lock = make_lock(shard.mutex);
+            auto it = shard.index.find(view);
+            if (it != shard.index.end()) {
+                ++nhits;
+                shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+                return it->second->value;
+            }
+        }
+        // Compute the result without holding the lock; if another thread
+        // stored the same key in the meantime, keep the existing entry
+        ++nmisses;
+        Ustring value = apply_tag(tag, src);
+        auto lock = make_lock(shard.mutex);
+        if (shard.index.count(view) == 0) {
+            shard.lru.push_front({key, value});
+            shard.index.insert({std::string_view(shard.lru.front().key), shard.lru.begin()});
+            if (shard.lru.size() > shard.capacity) {
+                shard.index.erase(std::string_view(shard.lru.back().key));
+                shard.lru.pop_back();
+            }
+        }
+        return value;
     }
 
 }
@@ -2,12 +2,114 @@
 
 #include "unicorn/character.hpp"
 #include "unicorn/utility.hpp"
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 namespace RS::Unicorn {
 
     RS_ENUM(NormalizationForm, int, 1, NFC, NFD, NFKC, NFKD)
 
-    Ustring normalize(const Ustring& src, NormalizationForm form);
-    void normalize_in(Ustring& src, NormalizationForm form);
+    struct Normalize {
+        static constexpr uint32_t stream_safe  = setbit<0>;  // Apply the UAX15 Stream-Safe Text Process before normalizing
+        static constexpr uint32_t casefold     = setbit<1>;  // Apply the NFKC_Casefold mapping to each character (use with NFKC)
+    };
+
+    Ustring normalize(const Ustring& src, NormalizationForm form, uint32_t flags = 0);
+    void normalize_in(Ustring& src, NormalizationForm form, uint32_t flags = 0);
+    Ustring normalize_parallel(const Ustring& src, NormalizationForm form, uint32_t flags = 0, size_t threads = 0);
+    Ustring stream_safe(const Ustring& src);
+    void stream_safe_in(Ustring& src);
+    Ustring str_nfkc_casefold(const Ustring& src);
+    void str_nfkc_casefold_in(Ustring& src);
+
+    class Normalizer {
+    public:
+        Normalizer() = default;
+        explicit Normalizer(NormalizationForm form, uint32_t flags = 0) noexcept: nform(form), nflags(flags) {}
+        NormalizationForm form() const noexcept { return nform; }
+        uint32_t flags() const noexcept { return nflags; }
+        size_t pending() const noexcept { return seg.size() + partial.size(); }
+        void add(const Ustring& src, Ustring& dst);
+        void flush(Ustring& dst);
+        void clear() noexcept { seg.clear(); partial.clear(); nonstarters = 0; unsorted = false; }
+    private:
+        struct CharClass {
+            char32_t code;  // Decomposed character
+            int cc;         // Canonical combining class
+        };
+        NormalizationForm nform = NFC;  // Normalization form
+        uint32_t nflags = 0;            // Normalization flags
+        std::vector<CharClass> seg;     // Current starter and following non-starters
+        Ustring partial;                // Incomplete UTF-8 sequence at the end of the last chunk
+        size_t nonstarters = 0;         // Consecutive non-starters (for stream-safe mode)
+        bool unsorted = false;          // Non-starters arrived out of order
+        void next(char32_t c, Ustring& dst);
+        void decompose(char32_t c, Ustring& dst);
+        void push(char32_t c, Ustring& dst);
+        void finish_segment();
+        void write_segment(Ustring& dst);
+    };
+
+    template <typename Range, typename OutIter>
+    void normalize_stream(const Range& src, OutIter dst, NormalizationForm form, uint32_t flags = 0) {
+        Normalizer norm(form, flags);
+        Ustring buf;
+        for (auto& chunk: src) {
+            norm.add(chunk, buf);
+            if (! buf.empty()) {
+                *dst++ = buf;
+                buf.clear();
+            }
+        }
+        norm.flush(buf);
+        if (! buf.empty())
+            *dst++ = buf;
+    }
+
+    class NormalizationCache {
+    public:
+        static constexpr size_t default_capacity = 4096;
+        static constexpr size_t default_max_length = 256;
+        static constexpr size_t default_shards = 16;
+        explicit NormalizationCache(size_t capacity = default_capacity, size_t max_length = default_max_length,
+            size_t shards = default_shards);
+        NormalizationCache(const NormalizationCache&) = delete;
+        NormalizationCache(NormalizationCache&&) = delete;
+        NormalizationCache& operator=(const NormalizationCache&) = delete;
+        NormalizationCache& operator=(NormalizationCache&&) = delete;
+        Ustring normalize(const Ustring& src, NormalizationForm form, uint32_t flags = 0);
+        Ustring casefold(const Ustring& src);
+        size_t capacity() const noexcept { return cap; }
+        size_t max_length() const noexcept { return maxlen; }
+        size_t hits() const noexcept { return nhits; }
+        size_t misses() const noexcept { return nmisses; }
+        size_t size() const;
+        void clear();
+    private:
+        struct Entry {
+            Ustring key;    // Operation tag followed by input string
+            Ustring value;  // Result
+        };
+        using EntryList = std::list<Entry>;
+        struct Shard {
+            mutable std::mutex mutex;
+            EntryList lru;  // Most recently used first
+            std::unordered_map<std::string_view, EntryList::iterator> index;  // Keys point into lru
+            size_t capacity = 0;
+        };
+        size_t cap;
+        size_t maxlen;
+        size_t nshards;
+        std::unique_ptr<Shard[]> shards;
+        std::atomic<size_t> nhits {0};
+        std::atomic<size_t> nmisses {0};
+        Ustring lookup(uint32_t tag, const Ustring& src);
+    };
 
 }
@@ -155,6 +155,33 @@ void test_unicorn_segment_graphemes() {
 
     segmentation_test<SplitGraphemes>("Grapheme break test", UnicornDetail::grapheme_break_test_table);
 
+    // Very long clusters must not take quadratic time
+
+    Ustring s = "a" + str_repeat("\u0301", 200'000) + "b";
+    Strings segments;
+    TRY(SplitGraphemes()(s, segments));
+    TEST_EQUAL(segments.size(), 2);
+    TEST_EQUAL(segments[0].size(), 400'001);
+
+    s = "\U0001f469" + str_repeat("\u200d\U0001f469", 100'000) + "\U0001f1e6\U0001f1e6\U0001f1e6";
+    segments.clear();
+    TRY(SplitGraphemes()(s, segments));
+    TEST_EQUAL(segments.size(), 3);
+    TEST_EQUAL(segments[0].size(), 700'004);
+    TEST_EQUAL(segments[1], "\U0001f1e6\U0001f1e6");
+    TEST_EQUAL(segments[2], "\U0001f1e6");
+
+    // Indic conjuncts (GB9c), including a nonspacing mark with ccc=0 after the virama
+
+    s = "क्ंक क्ुक कंक";
+    segments.clear();
+    TRY(SplitGraphemes()(s, segments));
+    TEST_EQUAL(segments.size(), 6);
+    TEST_EQUAL(segments[0], "क्ंक");
+    TEST_EQUAL(segments[2], "क्ुक");
+    TEST_EQUAL(segments[4], "कं");
+    TEST_EQUAL(segments[5], "क");
+
 }
 
 void test_unicorn_segment_words() {
@@ -198,6 +225,23 @@ void test_unicorn_segment_words() {
 
     );
 
+    // The ASCII shortcuts must agree with the property tables
+
+    for (char32_t c = 0; c <= last_ascii_char; ++c)
+        TEST_EQUAL(UnicornDetail::ascii_word_break(c), word_break(c));
+
+    WORD_SEGMENTATION_TEST("a1_b\u00e9c 3.14 x\u0301y", "[a1_b\u00e9c][ ][3.14][ ][x\u0301y]", "[a1_b\u00e9c][3.14][x\u0301y]", "[a1_b\u00e9c][3.14][x\u0301y]");
+
+    // Long runs of ignorable characters must not take quadratic time
+
+    Ustring s = "a" + str_repeat("\u00ad", 200'000) + "'" + str_repeat("\u0301", 200'000) + "b c";
+    Strings segments;
+    TRY(SplitWords()(s, segments));
+    TEST_EQUAL(segments.size(), 3);
+    TEST_EQUAL(segments[0].size(), 800'003);
+    TEST_EQUAL(segments[1], " ");
+    TEST_EQUAL(segments[2], "c");
+
 }
 
 void test_unicorn_segment_lines() {
@@ -254,6 +298,254 @@ void test_unicorn_segment_sentences() {
 
     segmentation_test<SplitSentences>("Sentence break test", UnicornDetail::sentence_break_test_table);
 
+    // Long runs after a terminator must not take quadratic time
+
+    Ustring s = "Hello." + str_repeat(" ", 100'000) + str_repeat("1", 100'000) + " World.";
+    Strings segments;
+    TRY(SplitSentences()(s, segments));
+    TEST_EQUAL(segments.size(), 2);
+    TEST_EQUAL(segments[0].size(), 100'006);
+    TEST_EQUAL(segments[1].size(), 100'007);
+
+    s = "etc." + str_repeat(" ", 100'000) + str_repeat("\u0301", 100'000) + "and more.";
+    segments.clear();
+    TRY(SplitSentences()(s, segments));
+    TEST_EQUAL(segments.size(), 1);
+
+}
+
+void test_unicorn_segment_breaks() {
+
+    Ustring s8 = "Hello \u00e9\u0301 world. \U0001f469\u200d\U0001f469 is here.\r\nNew line";
+    std::u16string s16 = to_utf16(s8);
+    std::u32string s32 = to_utf32(s8);
+    std::vector<size_t> offsets, expect;
+    std::vector<bool> bitmap;
+
+    TRY(grapheme_breaks(Ustring(), offsets));
+    TEST(offsets.empty());
+    TRY(grapheme_breaks(Ustring(), bitmap));
+    TEST_EQUAL(bitmap.size(), 1);
+    TEST(! bitmap[0]);
+
+    auto check = [&] (auto range, auto breaks, auto& src) {
+        expect.clear();
+        for (auto& seg: range(src))
+            expect.push_back(seg.begin().offset());
+        expect.push_back(src.size());
+        TRY(breaks(src, offsets));
+        TEST_EQUAL_RANGE(offsets, expect);
+        TRY(breaks(src, bitmap));
+        TEST_EQUAL(bitmap.size(), src.size() + 1);
+        TEST_EQUAL(size_t(std::count(bitmap.begin(), bitmap.end(), true)), expect.size());
+        for (auto n: expect)
+            TEST(bitmap[n]);
+    };
+
+    #define CHECK_BREAKS(name) \
+        check([] (auto& s) { return name##_range(s); }, [] (auto& s, auto& out) { name##_breaks(s, out); }, s8); \
+        check([] (auto& s) { return name##_range(s); }, [] (auto& s, auto& out) { name##_breaks(s, out); }, s16); \
+        check([] (auto& s) { return name##_range(s); }, [] (auto& s, auto& out) { name##_breaks(s, out); }, s32);
+
+    CHECK_BREAKS(grapheme);
+    CHECK_BREAKS(word);
+    CHECK_BREAKS(sentence);
+
+    #undef CHECK_BREAKS
+
+    Ustring ascii = str_repeat("Hello world\r\n", 100) + "caf\u00e9" + str_repeat("\r\nabc", 100);
+    auto range = grapheme_range(ascii);
+    size_t n = std::distance(range.begin(), range.end());
+    TRY(grapheme_breaks(ascii, offsets));
+    TEST_EQUAL(offsets.size(), n + 1);
+    TEST_EQUAL(n, 1604);
+    TRY(grapheme_breaks(to_utf16(ascii), offsets));
+    TEST_EQUAL(offsets.size(), n + 1);
+
+    TRY(word_breaks(s8, offsets));
+    TEST_EQUAL(to_str(offsets), "[0,5,6,10,11,16,17,18,29,30,32,33,37,38,40,43,44,48]");
+
+}
+
+void test_unicorn_segment_parallel_breaks() {
+
+    // Lines deliberately start with characters whose handling depends on
+    // the preceding context, to check that chunks resynchronize correctly
+
+    Strings lines = {
+        "Hello world. This is a test.",
+        "\u0301Extend at the start of a line.",
+        "\U0001f1e6\U0001f1e7\U0001f1e8 flags",
+        "Mr. Smith went to Washington. he said \"hello.\"  (and left.)",
+        "\u200d\U0001f469 joined",
+        "3.14 and 1,000,000 are numbers; e.g. this one",
+        "\u05d0\u05d1\u05d2 \u4e00\u4e8c\u4e09 \u0e01\u0e32\u0e23",
+        "",
+        "Ends with a full stop.",
+        "lowercase continues the sentence.\r",
+    };
+    Ustring doc;
+    for (size_t i = 0; i < 20'000; ++i) {
+        doc += lines[(i * 7) % lines.size()];
+        doc += i % 3 ? "\n" : "\r\n";
+    }
+    std::u16string doc16 = to_utf16(doc);
+    std::vector<size_t> serial, parallel;
+    std::vector<bool> bitmap;
+
+    TRY(word_breaks_parallel(Ustring(), parallel));
+    TEST(parallel.empty());
+    TRY(word_breaks_parallel(Ustring("Hello"), parallel, 4));
+    TEST_EQUAL(to_str(parallel), "[0,5]");
+
+    #define CHECK_PARALLEL(name, src) \
+        TRY(name##_breaks(src, serial)); \
+        for (size_t threads: {0, 1, 2, 3, 8}) { \
+            TRY(name##_breaks_parallel(src, parallel, threads)); \
+            TEST(parallel == serial); \
+        } \
+        TRY(name##_breaks_parallel(src, bitmap, 4)); \
+        TEST_EQUAL(bitmap.size(), src.size() + 1); \
+        TEST_EQUAL(size_t(std::count(bitmap.begin(), bitmap.end(), true)), serial.size());
+
+    CHECK_PARALLEL(grapheme, doc);
+    CHECK_PARALLEL(word, doc);
+    CHECK_PARALLEL(sentence, doc);
+    CHECK_PARALLEL(word, doc16);
+    CHECK_PARALLEL(sentence, doc16);
+
+    #undef CHECK_PARALLEL
+
+    // No line feeds, so no safe split points
+
+    Ustring flat = str_repeat("One sentence. Another one! ", 2'000);
+    TRY(sentence_breaks(flat, serial));
+    TRY(sentence_breaks_parallel(flat, parallel, 4));
+    TEST(parallel == serial);
+
+}
+
+void test_unicorn_segment_streaming() {
+
+    Strings texts = {
+        "",
+        "Hello world",
+        "Hello \u00e9\u0301 world. \U0001f469\u200d\U0001f469 is here.\r\nNew line",
+        "can't won't 3.14 1,000 e.g. the end. Mr. Smith (he said.) Then \"no.\" ok",
+        "etc. lower case continues. Upper case doesn't.",
+        "\U0001f1e6\U0001f1e7\U0001f1e8\U0001f1e9\U0001f1ea flags",
+        "a" + str_repeat("\u0301", 50) + ".b" + str_repeat("\u00ad", 50) + "c",
+        "end" + str_repeat("\u0301", 20),
+        "\u05d0\u05d1\u05d2 \u4e00\u4e8c\u4e09. \u0e01\u0e32\u0e23 bad",
+    };
+
+    Strings expect, result;
+    GraphemeSegmenter gseg;
+    WordSegmenter wseg;
+    SentenceSegmenter sseg;
+
+    auto feed = [&] (auto& seg, const Ustring& text, size_t chunk) {
+        result.clear();
+        for (size_t pos = 0; pos < text.size(); pos += chunk)
+            TRY(seg.add(text.substr(pos, chunk), result));
+        TRY(seg.flush(result));
+        TEST_EQUAL(seg.pending(), 0);
+    };
+
+    #define CHECK_STREAM(name, seg) \
+        expect.clear(); \
+        for (auto& segment: name##_range(text)) \
+            expect.push_back(u_str(segment)); \
+        for (size_t chunk: {1, 2, 3, 5, 16, 1000}) { \
+            feed(seg, text, chunk); \
+            TEST_EQUAL_RANGE(result, expect); \
+        }
+
+    for (auto& text: texts) {
+        CHECK_STREAM(grapheme, gseg);
+        CHECK_STREAM(word, wseg);
+        CHECK_STREAM(sentence, sseg);
+    }
+
+    #undef CHECK_STREAM
+
+    // Only the current segment and its lookahead are held back
+
+    result.clear();
+    size_t max_pending = 0;
+    for (size_t i = 0; i < 10'000; ++i) {
+        TRY(wseg.add("Hello world. ", result));
+        max_pending = std::max(max_pending, wseg.pending());
+    }
+    TRY(wseg.flush(result));
+    TEST_EQUAL(result.size(), 50'000);
+    TEST_COMPARE(max_pending, <=, 13);
+
+    TRY(gseg.add("abc\xe2\x82", result));
+    TEST_EQUAL(gseg.pending(), 3);
+    TRY(gseg.clear());
+    TEST_EQUAL(gseg.pending(), 0);
+
+    Strings chunks = {"Hello wor", "ld. Goodbye", "\xe2", "\x82\xac world."};
+    result.clear();
+    TRY(segment_stream<SentenceSegmenter>(chunks, append(result)));
+    TEST_EQUAL(to_str(result), "[Hello world. ,Goodbye\u20ac world.]");
+    result.clear();
+    TRY(segment_stream<WordSegmenter>(chunks, append(result)));
+    TEST_EQUAL(result.size(), 10);
+
+}
+
+void test_unicorn_segment_line_break_opportunities() {
+
+    auto breaks = [] (const Ustring& src) {
+        Ustring result;
+        auto range = line_break_opportunities(src);
+        for (auto i = range.begin(); i != range.end(); ++i)
+            result += u_str(*i) + (i.mandatory() ? "!" : "|");
+        return result;
+    };
+
+    TEST_EQUAL(breaks(""), "");
+    TEST_EQUAL(breaks("Hello world"), "Hello |world!");
+    TEST_EQUAL(breaks("Hello  world"), "Hello  |world!");
+    TEST_EQUAL(breaks("  Hello"), "  |Hello!");
+    TEST_EQUAL(breaks("Hello\nworld\n"), "Hello\n!world\n!");
+    TEST_EQUAL(breaks("a\r\nb\rc"), "a\r\n!b\r!c!");
+    TEST_EQUAL(breaks("well-known"), "well-|known!");
+    TEST_EQUAL(breaks("-5 -x"), "-5 |-x!");
+    TEST_EQUAL(breaks("$(12.50) 10% e.g."), "$(12.50) |10% |e.g.!");
+    TEST_EQUAL(breaks("(a) [b]"), "(a) |[b]!");
+    TEST_EQUAL(breaks("a « b» c"), "a |« b» |c!");
+    TEST_EQUAL(breaks("“Hello” (x)"), "“Hello” |(x)!");
+    TEST_EQUAL(breaks("x ” y"), "x ” |y!");
+    TEST_EQUAL(breaks("x ”y"), "x |”y!");
+    TEST_EQUAL(breaks("x ”́"), "x ”́!");
+    TEST_EQUAL(breaks("a .5 a .b"), "a |.5 |a .b!");
+    TEST_EQUAL(breaks("( .5)"), "( .5)!");
+    TEST_EQUAL(breaks("12,345.67% 1/2"), "12,345.67% |1/2!");
+    TEST_EQUAL(breaks("$(.5) $(a)"), "$(.5) |$|(a)!");
+    TEST_EQUAL(breaks("1)% )%"), "1)% )|%!");
+    TEST_EQUAL(breaks("a/1"), "a/|1!");
+    TEST_EQUAL(breaks("Hello, world!"), "Hello, |world!!");
+    TEST_EQUAL(breaks("e\u0301 x\u0301"), "e\u0301 |x\u0301!");
+    TEST_EQUAL(breaks("a\u200bb"), "a\u200b|b!");
+    TEST_EQUAL(breaks("a\u00a0b"), "a\u00a0b!");
+    TEST_EQUAL(breaks("a\u2060 b"), "a\u2060 |b!");
+    TEST_EQUAL(breaks("\u05d0-a"), "\u05d0-a!");
+    TEST_EQUAL(breaks("\u65e5\u672c\u8a9e\u3002\u3042"), "\u65e5|\u672c|\u8a9e\u3002|\u3042!");
+    TEST_EQUAL(breaks("\u30c6\u30a3\u30fc"), "\u30c6\u30a3\u30fc!");
+    TEST_EQUAL(breaks("\ud55c\uad6d\uc5b4"), "\ud55c|\uad6d|\uc5b4!");
+    TEST_EQUAL(breaks("\U0001f44d\U0001f3fb\U0001f44d"), "\U0001f44d\U0001f3fb|\U0001f44d!");
+    TEST_EQUAL(breaks("\U0001f1e6\U0001f1e6\U0001f1e6"), "\U0001f1e6\U0001f1e6|\U0001f1e6!");
+    TEST_EQUAL(breaks("\U0001f469\u200d\U0001f469"), "\U0001f469\u200d\U0001f469!");
+    TEST_EQUAL(breaks("\u1b18\u1b44\u1b0f"), "\u1b18\u1b44\u1b0f!");
+
+    // Long runs must not take quadratic time
+
+    Ustring s = "a" + str_repeat("\u0301", 100'000) + str_repeat(" ", 100'000) + "b";
+    TEST_EQUAL(breaks(s).size(), s.size() + 2);
+
 }
 
 void test_unicorn_segment_paragraphs() {
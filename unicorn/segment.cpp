@@ -1,4 +1,6 @@
 #include "unicorn/segment.hpp"
+#include "unicorn/ucd-tables.hpp"
+#include <array>
 
 using namespace std::literals;
 
@@ -6,9 +8,305 @@ namespace RS::Unicorn {
 
     namespace {
 
-        template <typename P>
-        inline P prop(const std::deque<P>& buf, size_t i) {
-            return i < buf.size() ? buf[i] : P::EOT;
+        // Grapheme cluster break state machine
+
+        // Each state records the class of the previous character, plus the
+        // context needed by the rules that look further back: how far we
+        // are through an emoji ZWJ sequence (GB11), an Indic conjunct
+        // (GB9c), and whether we have seen an odd number of regional
+        // indicators (GB12-13). The reachable states are enumerated at
+        // compile time, giving a table with one transition per character.
+
+        using GB = UnicornDetail::Grapheme_Class;
+
+        struct GraphemeState {
+            int prev = -1;    // Class of previous character (-1 at start of text)
+            int emoji = 0;    // 1 = ExtPict Extend*, 2 = ExtPict Extend* ZWJ
+            int conj = 0;     // 1 = Consonant [Extend Linker]*, 2 = the same containing a Linker
+            bool ri = false;  // Odd number of regional indicators
+            constexpr bool operator==(const GraphemeState& rhs) const noexcept
+                { return prev == rhs.prev && emoji == rhs.emoji && conj == rhs.conj && ri == rhs.ri; }
+        };
+
+        constexpr bool is_grapheme_extend(GB c) noexcept {
+            return c == GB::Extend || c == GB::InCB_Extend || c == GB::InCB_Linker;
+        }
+
+        constexpr bool is_grapheme_break(const GraphemeState& state, GB next) noexcept {
+            // Break at the start and end of text, unless the text is empty.
+            // GB1. sot ÷ Any
+            // GB2. Any ÷ eot
+            if (state.prev < 0)
+                return false;
+            auto prev = GB(state.prev);
+            // Do not break between a CR and LF. Otherwise, break before and after controls.
+            // GB3. CR × LF
+            // GB4. (Control | CR | LF) ÷
+            // GB5. ÷ (Control | CR | LF)
+            if (prev == GB::CR && next == GB::LF)
+                return false;
+            if (prev == GB::Control || prev == GB::CR || prev == GB::LF
+                    || next == GB::Control || next == GB::CR || next == GB::LF)
+                return true;
+            // Do not break Hangul syllable sequences.
+            // GB6. L × (L | V | LV | LVT)
+            // GB7. (LV | V) × (V | T)
+            // GB8. (LVT | T) × T
+            if (prev == GB::L && (next == GB::L || next == GB::V || next == GB::LV || next == GB::LVT))
+                return false;
+            if ((prev == GB::LV || prev == GB::V) && (next == GB::V || next == GB::T))
+                return false;
+            if ((prev == GB::LVT || prev == GB::T) && next == GB::T)
+                return false;
+            // Do not break before extending characters or ZWJ.
+            // GB9. × (Extend | ZWJ)
+            // Do not break before SpacingMarks, or after Prepend characters.
+            // GB9a. × SpacingMark
+            // GB9b. Prepend ×
+            if (is_grapheme_extend(next) || next == GB::ZWJ || next == GB::SpacingMark || prev == GB::Prepend)
+                return false;
+            // Do not break within certain combinations with Indic_Conjunct_Break (InCB)=Linker.
+            // GB9c. \p{InCB=Consonant} [\p{InCB=Extend}\p{InCB=Linker}]* \p{InCB=Linker}
+            //     [\p{InCB=Extend}\p{InCB=Linker}]* × \p{InCB=Consonant}
+            if (state.conj == 2 && next == GB::InCB_Consonant)
+                return false;
+            // Do not break within emoji modifier sequences or emoji zwj sequences.
+            // GB11. \p{Extended_Pictographic} Extend* ZWJ × \p{Extended_Pictographic}
+            if (state.emoji == 2 && next == GB::Extended_Pictographic)
+                return false;
+            // Do not break within emoji flag sequences. That is, do not break
+            // between regional indicator (RI) symbols if there is an odd
+            // number of RI characters before the break point.
+            // GB12. sot (RI RI)* RI × RI
+            // GB13. [^RI] (RI RI)* RI × RI
+            if (prev == GB::Regional_Indicator && state.ri && next == GB::Regional_Indicator)
+                return false;
+            // Otherwise, break everywhere.
+            // GB999. Any ÷ Any
+            return true;
+        }
+
+        constexpr GraphemeState next_grapheme_state(const GraphemeState& state, GB next) noexcept {
+            GraphemeState result;
+            result.prev = int(next);
+            if (next == GB::Extended_Pictographic || (state.emoji == 1 && is_grapheme_extend(next)))
+                result.emoji = 1;
+            else if (state.emoji == 1 && next == GB::ZWJ)
+                result.emoji = 2;
+            if (next == GB::InCB_Consonant)
+                result.conj = 1;
+            else if (state.conj != 0 && (next == GB::InCB_Extend || next == GB::ZWJ))
+                result.conj = state.conj;
+            else if (state.conj != 0 && next == GB::InCB_Linker)
+                result.conj = 2;
+            if (next == GB::Regional_Indicator)
+                result.ri = state.prev != int(GB::Regional_Indicator) || ! state.ri;
+            return result;
+        }
+
+        constexpr size_t max_grapheme_states = 64;
+
+        struct GraphemeMachine {
+            std::array<std::array<uint8_t, UnicornDetail::grapheme_classes>, max_grapheme_states> table {};
+            size_t states = 0;
+        };
+
+        constexpr GraphemeMachine make_grapheme_machine() {
+            GraphemeMachine machine;
+            std::array<GraphemeState, max_grapheme_states> states {};
+            machine.states = 1;
+            for (size_t i = 0; i < machine.states; ++i) {
+                for (size_t k = 0; k < UnicornDetail::grapheme_classes; ++k) {
+                    auto next = next_grapheme_state(states[i], GB(k));
+                    size_t j = 0;
+                    while (j < machine.states && ! (states[j] == next))
+                        ++j;
+                    if (j == machine.states)
+                        states[machine.states++] = next;
+                    machine.table[i][k] = uint8_t(j | (is_grapheme_break(states[i], GB(k)) ? UnicornDetail::grapheme_break_flag : 0));
+                }
+            }
+            return machine;
+        }
+
+        constexpr GraphemeMachine grapheme_machine = make_grapheme_machine();
+
+        static_assert(grapheme_machine.states < UnicornDetail::grapheme_break_flag);
+
+        // Word boundaries
+
+        using WB = Word_Break;
+
+        constexpr bool is_ahletter(WB p) noexcept { return p == WB::ALetter || p == WB::Hebrew_Letter; }
+        constexpr bool is_midletter_q(WB p) noexcept { return p == WB::MidLetter || p == WB::MidNumLet || p == WB::Single_Quote; }
+        constexpr bool is_midnum_q(WB p) noexcept { return p == WB::MidNum || p == WB::MidNumLet || p == WB::Single_Quote; }
+        constexpr bool is_word_newline(WB p) noexcept { return p == WB::CR || p == WB::LF || p == WB::Newline; }
+
+        // Sentence boundaries
+
+        using SB = Sentence_Break;
+
+        constexpr bool is_para_sep(SB p) noexcept { return p == SB::Sep || p == SB::CR || p == SB::LF; }
+        constexpr bool is_sentence_ignorable(SB p) noexcept { return p == SB::Extend || p == SB::Format; }
+
+        // Line breaks
+
+        // The pair table gives the result of the UAX14 rules for each pair
+        // of resolved classes, with and without intervening spaces, after
+        // mandatory breaks, spaces, and combining marks have been dealt
+        // with. The few rules that depend on more context than a pair of
+        // classes are applied separately.
+
+        using LB = Line_Break;
+
+        constexpr size_t line_break_classes = size_t(LB::ZWJ) + 1;
+
+        constexpr bool is_pair_break(LB x, LB y, bool spaced) noexcept {
+            // Break before any character following a zero-width space, even if one or more spaces intervene.
+            // LB8. ZW SP* ÷
+            if (x == LB::ZW)
+                return true;
+            // Do not break before or after Word joiner and related characters.
+            // LB11. × WJ, WJ ×
+            if (y == LB::WJ || (x == LB::WJ && ! spaced))
+                return false;
+            // Do not break after NBSP and related characters.
+            // LB12. GL ×
+            // LB12a. [^SP BA HY] × GL
+            if (! spaced && (x == LB::GL || (y == LB::GL && x != LB::BA && x != LB::HY)))
+                return false;
+            // Do not break before ‘]’ or ‘!’ or ‘/’, even after spaces.
+            // LB13. × CL, × CP, × EX, × SY
+            if (y == LB::CL || y == LB::CP || y == LB::EX || y == LB::SY)
+                return false;
+            // Do not break after ‘[’, even after spaces.
+            // LB14. OP SP* ×
+            if (x == LB::OP)
+                return false;
+            // LB15a-c depend on more context and are checked separately.
+            // Otherwise, do not break before ‘;’, ‘,’, or ‘.’, even after spaces.
+            // LB15d. × IS
+            if (y == LB::IS)
+                return false;
+            // Do not break between closing punctuation and a nonstarter, even with intervening spaces.
+            // LB16. (CL | CP) SP* × NS
+            if ((x == LB::CL || x == LB::CP) && y == LB::NS)
+                return false;
+            // Do not break within ‘——’, even with intervening spaces.
+            // LB17. B2 SP* × B2
+            if (x == LB::B2 && y == LB::B2)
+                return false;
+            // Break after spaces.
+            // LB18. SP ÷
+            if (spaced)
+                return true;
+            // Do not break before or after quotation marks.
+            // LB19. × QU, QU ×
+            if (x == LB::QU || y == LB::QU)
+                return false;
+            // Break before and after unresolved CB.
+            // LB20. ÷ CB, CB ÷
+            if (x == LB::CB || y == LB::CB)
+                return true;
+            // Do not break before hyphen-minus, other hyphens, fixed-width
+            // spaces, small kana, and other non-starters, or after acute
+            // accents.
+            // LB21. × BA, × HY, × NS, BB ×
+            if (y == LB::BA || y == LB::HY || y == LB::NS || x == LB::BB)
+                return false;
+            // LB21b. SY × HL
+            if (x == LB::SY && y == LB::HL)
+                return false;
+            // Do not break before ellipses.
+            // LB22. × IN
+            if (y == LB::IN_)
+                return false;
+            bool x_alpha = x == LB::AL || x == LB::HL;
+            bool y_alpha = y == LB::AL || y == LB::HL;
+            bool x_ideo = x == LB::ID || x == LB::EB || x == LB::EM;
+            bool y_ideo = y == LB::ID || y == LB::EB || y == LB::EM;
+            bool x_hangul = x == LB::JL || x == LB::JV || x == LB::JT || x == LB::H2 || x == LB::H3;
+            bool y_hangul = y == LB::JL || y == LB::JV || y == LB::JT || y == LB::H2 || y == LB::H3;
+            // Do not break between digits and letters.
+            // LB23. (AL | HL) × NU, NU × (AL | HL)
+            if ((x_alpha && y == LB::NU) || (x == LB::NU && y_alpha))
+                return false;
+            // Do not break between numeric prefixes and ideographs, or between ideographs and numeric postfixes.
+            // LB23a. PR × (ID | EB | EM), (ID | EB | EM) × PO
+            if ((x == LB::PR && y_ideo) || (x_ideo && y == LB::PO))
+                return false;
+            // Do not break between numeric prefix/postfix and letters, or between letters and prefix/postfix.
+            // LB24. (PR | PO) × (AL | HL), (AL | HL) × (PR | PO)
+            if (((x == LB::PR || x == LB::PO) && y_alpha) || (x_alpha && (y == LB::PR || y == LB::PO)))
+                return false;
+            // Do not break within numbers (the parts of LB25 that need more
+            // context are checked separately).
+            // LB25. PO × NU, PR × NU, HY × NU, IS × NU
+            if ((x == LB::PO || x == LB::PR || x == LB::HY || x == LB::IS) && y == LB::NU)
+                return false;
+            // Do not break a Korean syllable.
+            // LB26. JL × (JL | JV | H2 | H3), (JV | H2) × (JV | JT), (JT | H3) × JT
+            if (x == LB::JL && (y == LB::JL || y == LB::JV || y == LB::H2 || y == LB::H3))
+                return false;
+            if ((x == LB::JV || x == LB::H2) && (y == LB::JV || y == LB::JT))
+                return false;
+            if ((x == LB::JT || x == LB::H3) && y == LB::JT)
+                return false;
+            // Treat a Korean Syllable Block the same as ID.
+            // LB27. (JL | JV | JT | H2 | H3) × PO, PR × (JL | JV | JT | H2 | H3)
+            if ((x_hangul && y == LB::PO) || (x == LB::PR && y_hangul))
+                return false;
+            // Do not break between alphabetics (“at”).
+            // LB28. (AL | HL) × (AL | HL)
+            if (x_alpha && y_alpha)
+                return false;
+            // Do not break between numeric punctuation and alphabetics (“e.g.”).
+            // LB29. IS × (AL | HL)
+            if (x == LB::IS && y_alpha)
+                return false;
+            // Do not break between an emoji base and an emoji modifier.
+            // LB30b. EB × EM
+            if (x == LB::EB && y == LB::EM)
+                return false;
+            // Otherwise, break everywhere (including around ideographs).
+            // LB31. ALL ÷, ÷ ALL
+            return true;
+        }
+
+        // Each entry holds the break flag without spaces in bit 0, and with
+        // spaces in bit 1.
+
+        using LinePairTable = std::array<std::array<uint8_t, line_break_classes>, line_break_classes>;
+
+        constexpr LinePairTable make_line_pair_table() {
+            LinePairTable table {};
+            for (size_t x = 0; x < line_break_classes; ++x)
+                for (size_t y = 0; y < line_break_classes; ++y)
+                    table[x][y] = uint8_t(int(is_pair_break(LB(x), LB(y), false)) + 2 * int(is_pair_break(LB(x), LB(y), true)));
+            return table;
+        }
+
+        constexpr LinePairTable line_pair_table = make_line_pair_table();
+
+        constexpr char32_t dotted_circle = 0x25cc;
+        constexpr char32_t unicode_hyphen = 0x2010;
+
+        constexpr bool is_mandatory_line_break(LB c) noexcept { return c == LB::BK || c == LB::CR || c == LB::LF || c == LB::NL; }
+        constexpr bool is_line_combining(LB c) noexcept { return c == LB::CM || c == LB::ZWJ; }
+        constexpr bool is_aksara(LB c, char32_t u) noexcept { return c == LB::AK || c == LB::AS || u == dotted_circle; }
+
+        constexpr bool is_before_initial_quote(LB c) noexcept {
+            return c == LB::XX || is_mandatory_line_break(c) || c == LB::OP || c == LB::QU || c == LB::GL || c == LB::SP || c == LB::ZW;
+        }
+
+        constexpr bool is_after_final_quote(LB c) noexcept {
+            return c == LB::XX || is_mandatory_line_break(c) || c == LB::SP || c == LB::GL || c == LB::WJ || c == LB::CL
+                || c == LB::QU || c == LB::CP || c == LB::EX || c == LB::IS || c == LB::SY || c == LB::ZW;
+        }
+
+        bool is_east_asian_wide(char32_t c) noexcept {
+            auto w = east_asian_width(c);
+            return w == East_Asian_Width::F || w == East_Asian_Width::W || w == East_Asian_Width::H;
         }
 
     }
@@ -18,271 +316,427 @@ namespace RS::Unicorn {
         // Unicode Standard Annex #29: Unicode Text Segmentation
         // http://www.unicode.org/reports/tr29
 
-        size_t find_grapheme_break(const std::deque<Grapheme_Cluster_Break>& buf, bool /*eof*/) {
-            using P = Grapheme_Cluster_Break;
-            if (buf.empty())
-                return 0;
-            size_t size = buf.size();
-            for (size_t i = 1; i < size; ++i) {
-                // Break at the start and end of text.
-                // GB1. sot ÷
-                // GB2. ÷ eot
-                // Do not break between a CR and LF. Otherwise, break before and after controls.
-                // GB3. CR × LF
-                // GB4. (Control | CR | LF) ÷
-                // GB5. ÷ (Control | CR | LF)
-                P prev(prop(buf, i - 1));
-                P next(prop(buf, i));
-                if (prev == P::CR && next == P::LF)
-                    continue;
-                if (prev == P::Control || prev == P::CR || prev == P::LF
-                        || next == P::Control || next == P::CR || next == P::LF)
-                    return i;
-                // Do not break Hangul syllable sequences.
-                // GB6. L × (L | V | LV | LVT)
-                if (prev == P::L
-                        && (next == P::L || next == P::V || next == P::LV || next == P::LVT))
-                    continue;
-                // GB7. (LV | V) × (V | T)
-                if ((prev == P::LV || prev == P::V) && (next == P::V || next == P::T))
-                    continue;
-                // GB8. (LVT | T) × T
-                if ((prev == P::LVT || prev == P::T) && next == P::T)
-                    continue;
-                // Do not break between regional indicator symbols.
-                // GB8a. Regional_Indicator × Regional_Indicator
-                if (prev == P::Regional_Indicator && next == P::Regional_Indicator)
-                    continue;
-                // Do not break before extending characters.
-                // GB9. × Extend
-                // Do not break before SpacingMarks, or after Prepend characters.
-                // GB9a. × SpacingMark
-                // GB9b. Prepend ×
-                if (prev == P::Prepend || next == P::Extend || next == P::SpacingMark)
-                    continue;
-                // Otherwise, break everywhere.
-                // GB10. Any ÷ Any
-                return i;
+        unsigned grapheme_transition(unsigned state, char32_t c) noexcept {
+            auto k = sparse_table_lookup(grapheme_class_table, c);
+            return grapheme_machine.table[state][size_t(k)];
+        }
+
+        BreakCheck word_break_check(const WordBreakState& state, char32_t c, Word_Break next, const Word_Break* ahead) noexcept {
+            // Break at the start and end of text, unless the text is empty.
+            // WB1. sot ÷ Any
+            // WB2. Any ÷ eot
+            if (state.raw == WB::SOT)
+                return BreakCheck::no_break;
+            // Do not break within CRLF.
+            // WB3. CR × LF
+            if (state.raw == WB::CR && next == WB::LF)
+                return BreakCheck::no_break;
+            // Otherwise break before and after Newlines (including CR and LF)
+            // WB3a. (Newline | CR | LF) ÷
+            // WB3b. ÷ (Newline | CR | LF)
+            if (is_word_newline(state.raw) || is_word_newline(next))
+                return BreakCheck::do_break;
+            // Do not break within emoji zwj sequences.
+            // WB3c. ZWJ × \p{Extended_Pictographic}
+            if (state.raw == WB::ZWJ && sparse_table_lookup(grapheme_class_table, c) == Grapheme_Class::Extended_Pictographic)
+                return BreakCheck::no_break;
+            // Keep horizontal whitespace together.
+            // WB3d. WSegSpace × WSegSpace
+            if (state.raw == WB::WSegSpace && next == WB::WSegSpace)
+                return BreakCheck::no_break;
+            // Ignore Format and Extend characters, except after sot, CR, LF,
+            // and Newline. This also has the effect of: Any × (Format | Extend | ZWJ)
+            // WB4. X (Extend | Format | ZWJ)* → X
+            if (is_word_ignorable(next))
+                return BreakCheck::no_break;
+            auto prev = state.prev;
+            auto prev2 = state.prev2;
+            // Do not break between most letters.
+            // WB5. AHLetter × AHLetter
+            if (is_ahletter(prev) && is_ahletter(next))
+                return BreakCheck::no_break;
+            // Do not break letters across certain punctuation.
+            // WB6. AHLetter × (MidLetter | MidNumLetQ) AHLetter
+            if (is_ahletter(prev) && is_midletter_q(next)) {
+                if (! ahead)
+                    return BreakCheck::lookahead;
+                if (is_ahletter(*ahead))
+                    return BreakCheck::no_break;
+            }
+            // WB7. AHLetter (MidLetter | MidNumLetQ) × AHLetter
+            if (is_ahletter(prev2) && is_midletter_q(prev) && is_ahletter(next))
+                return BreakCheck::no_break;
+            // WB7a. Hebrew_Letter × Single_Quote
+            if (prev == WB::Hebrew_Letter && next == WB::Single_Quote)
+                return BreakCheck::no_break;
+            // WB7b. Hebrew_Letter × Double_Quote Hebrew_Letter
+            if (prev == WB::Hebrew_Letter && next == WB::Double_Quote) {
+                if (! ahead)
+                    return BreakCheck::lookahead;
+                if (*ahead == WB::Hebrew_Letter)
+                    return BreakCheck::no_break;
+            }
+            // WB7c. Hebrew_Letter Double_Quote × Hebrew_Letter
+            if (prev2 == WB::Hebrew_Letter && prev == WB::Double_Quote && next == WB::Hebrew_Letter)
+                return BreakCheck::no_break;
+            // Do not break within sequences of digits, or digits adjacent to letters.
+            // WB8. Numeric × Numeric
+            // WB9. AHLetter × Numeric
+            // WB10. Numeric × AHLetter
+            if ((is_ahletter(prev) || prev == WB::Numeric) && next == WB::Numeric)
+                return BreakCheck::no_break;
+            if (prev == WB::Numeric && is_ahletter(next))
+                return BreakCheck::no_break;
+            // Do not break within sequences, such as “3.2” or “3,456.789”.
+            // WB11. Numeric (MidNum | MidNumLetQ) × Numeric
+            if (prev2 == WB::Numeric && is_midnum_q(prev) && next == WB::Numeric)
+                return BreakCheck::no_break;
+            // WB12. Numeric × (MidNum | MidNumLetQ) Numeric
+            if (prev == WB::Numeric && is_midnum_q(next)) {
+                if (! ahead)
+                    return BreakCheck::lookahead;
+                if (*ahead == WB::Numeric)
+                    return BreakCheck::no_break;
             }
-            return 0;
+            // Do not break between Katakana.
+            // WB13. Katakana × Katakana
+            if (prev == WB::Katakana && next == WB::Katakana)
+                return BreakCheck::no_break;
+            // Do not break from extenders.
+            // WB13a. (AHLetter | Numeric | Katakana | ExtendNumLet) × ExtendNumLet
+            // WB13b. ExtendNumLet × (AHLetter | Numeric | Katakana)
+            if ((is_ahletter(prev) || prev == WB::Numeric || prev == WB::Katakana || prev == WB::ExtendNumLet)
+                    && next == WB::ExtendNumLet)
+                return BreakCheck::no_break;
+            if (prev == WB::ExtendNumLet && (is_ahletter(next) || next == WB::Numeric || next == WB::Katakana))
+                return BreakCheck::no_break;
+            // Do not break within emoji flag sequences. That is, do not break
+            // between regional indicator (RI) symbols if there is an odd
+            // number of RI characters before the break point.
+            // WB15. sot (RI RI)* RI × RI
+            // WB16. [^RI] (RI RI)* RI × RI
+            if (prev == WB::Regional_Indicator && state.ri && next == WB::Regional_Indicator)
+                return BreakCheck::no_break;
+            // Otherwise, break everywhere (including around ideographs).
+            // WB999. Any ÷ Any
+            return BreakCheck::do_break;
         }
 
-        size_t find_word_break(const std::deque<Word_Break>& buf, bool eof) {
-            using P = Word_Break;
-            if (buf.empty())
-                return 0;
-            size_t size = buf.size();
-            for (size_t i = 1; i < size; ++i) {
-                // Break at the start and end of text.
-                // WB1. sot ÷
-                // WB2. ÷ eot
-                // Do not break within CRLF.
-                // WB3. CR × LF
-                P prev(prop(buf, i - 1));
-                P next(prop(buf, i));
-                if (prev == P::CR && next == P::LF)
-                    continue;
-                // Otherwise break before and after Newlines (including CR and LF)
-                // WB3a. (Newline | CR | LF) ÷
-                // WB3b. ÷ (Newline | CR | LF)
-                if (prev == P::CR || prev == P::LF || prev == P::Newline
-                        || next == P::CR || next == P::LF || next == P::Newline)
-                    return i;
-                // Ignore Format and Extend characters, except when they
-                // appear at the beginning of a region of text.
-                // WB4. X (Extend | Format)* → X
-                if (next == P::Extend || next == P::Format)
-                    continue;
-                size_t j = i;
-                do prev = prop(buf, --j);
-                    while (prev == P::Extend || prev == P::Format);
-                P prev2;
-                do prev2 = prop(buf, --j);
-                    while (prev2 == P::Extend || prev2 == P::Format);
-                j = i;
-                P next2;
-                do next2 = prop(buf, ++j);
-                    while (next2 == P::Extend || next2 == P::Format);
-                // Do not break between most letters.
-                // WB5. (ALetter | Hebrew_Letter) × (ALetter | Hebrew_Letter)
-                if ((prev == P::ALetter || prev == P::Hebrew_Letter)
-                        && (next == P::ALetter || next == P::Hebrew_Letter))
-                    continue;
-                // Do not break letters across certain punctuation.
-                // WB6. (ALetter | Hebrew_Letter) × (MidLetter | MidNumLet | Single_Quote) (ALetter | Hebrew_Letter)
-                if ((prev == P::ALetter || prev == P::Hebrew_Letter)
-                        && (next == P::MidLetter || next == P::MidNumLet || next == P::Single_Quote)) {
-                    if (next2 == P::EOT && ! eof)
-                        return 0;
-                    if (next2 == P::ALetter || next2 == P::Hebrew_Letter)
-                        continue;
+        void word_break_update(WordBreakState& state, Word_Break next) noexcept {
+            bool absorb = is_word_ignorable(next) && state.raw != WB::SOT && ! is_word_newline(state.raw);
+            if (! absorb) {
+                if (next == WB::Regional_Indicator)
+                    state.ri = state.prev != WB::Regional_Indicator || ! state.ri;
+                else
+                    state.ri = false;
+                state.prev2 = state.prev;
+                state.prev = next;
+            }
+            state.raw = next;
+        }
+
+        BreakCheck sentence_break_check(const SentenceBreakState& state, Sentence_Break next, const Sentence_Break* ahead) noexcept {
+            // Break at the start and end of text, unless the text is empty.
+            // SB1. sot ÷ Any
+            // SB2. Any ÷ eot
+            if (state.raw == SB::SOT)
+                return BreakCheck::no_break;
+            // Do not break within CRLF.
+            // SB3. CR × LF
+            if (state.raw == SB::CR && next == SB::LF)
+                return BreakCheck::no_break;
+            // Break after paragraph separators.
+            // SB4. ParaSep ÷
+            if (is_para_sep(state.raw))
+                return BreakCheck::do_break;
+            // Ignore Format and Extend characters, except after sot,
+            // ParaSep, and within CRLF.
+            // SB5. X (Extend | Format)* → X
+            if (is_sentence_ignorable(next))
+                return BreakCheck::no_break;
+            // Do not break after ambiguous terminators like period, if
+            // they are immediately followed by a number or lowercase
+            // letter, if they are between uppercase letters, if the first
+            // following letter (optionally after certain punctuation) is
+            // lowercase, or if they are followed by “continuation”
+            // punctuation such as comma, colon, or semicolon.
+            // SB6. ATerm × Numeric
+            if (state.prev == SB::ATerm && next == SB::Numeric)
+                return BreakCheck::no_break;
+            // SB7. (Upper | Lower) ATerm × Upper
+            if ((state.prev2 == SB::Upper || state.prev2 == SB::Lower) && state.prev == SB::ATerm && next == SB::Upper)
+                return BreakCheck::no_break;
+            if (state.term == 0)
+                // Otherwise, do not break.
+                // SB998. Any × Any
+                return BreakCheck::no_break;
+            // SB8a. SATerm Close* Sp* × (SContinue | SATerm)
+            if (next == SB::SContinue || next == SB::STerm || next == SB::ATerm)
+                return BreakCheck::no_break;
+            // Break after sentence terminators, but include closing
+            // punctuation, trailing spaces, and a paragraph separator (if
+            // present).
+            // SB9. SATerm Close* × (Close | Sp | ParaSep)
+            if (state.term == 1 && (next == SB::Close || next == SB::Sp || is_para_sep(next)))
+                return BreakCheck::no_break;
+            // SB10. SATerm Close* Sp* × (Sp | ParaSep)
+            if (next == SB::Sp || is_para_sep(next))
+                return BreakCheck::no_break;
+            // SB8 is a no-break rule, so it can be tested after the other
+            // no-break rules, avoiding the open-ended lookahead except where
+            // it makes a difference.
+            // SB8. ATerm Close* Sp* × (¬(OLetter | Upper | Lower | ParaSep | SATerm))* Lower
+            if (state.aterm) {
+                if (! ahead)
+                    return BreakCheck::lookahead;
+                if (*ahead == SB::Lower)
+                    return BreakCheck::no_break;
+            }
+            // SB11. SATerm Close* Sp* ParaSep? ÷
+            return BreakCheck::do_break;
+        }
+
+        void sentence_break_update(SentenceBreakState& state, Sentence_Break next) noexcept {
+            bool absorb = is_sentence_ignorable(next) && state.raw != SB::SOT && ! is_para_sep(state.raw);
+            if (! absorb) {
+                if (next == SB::STerm || next == SB::ATerm) {
+                    state.term = 1;
+                    state.aterm = next == SB::ATerm;
+                } else if (next == SB::Close && state.term == 1) {
+                    state.term = 1;
+                } else if (next == SB::Sp && state.term != 0) {
+                    state.term = 2;
+                } else {
+                    state.term = 0;
                 }
-                // WB7. (ALetter | Hebrew_Letter) (MidLetter | MidNumLet | Single_Quote) × (ALetter | Hebrew_Letter)
-                if ((prev2 == P::ALetter || prev2 == P::Hebrew_Letter)
-                        && (prev == P::MidLetter || prev == P::MidNumLet || prev == P::Single_Quote)
-                        && (next == P::ALetter || next == P::Hebrew_Letter))
-                    continue;
-                // WB7a. Hebrew_Letter × Single_Quote
-                if (prev == P::Hebrew_Letter && next == P::Single_Quote)
-                    continue;
-                // WB7b. Hebrew_Letter × Double_Quote Hebrew_Letter
-                if (prev == P::Hebrew_Letter && next == P::Double_Quote) {
-                    if (next2 == P::EOT && ! eof)
-                        return 0;
-                    if (next2 == P::Hebrew_Letter)
-                        continue;
+                state.prev2 = state.prev;
+                state.prev = next;
+            }
+            state.raw = next;
+        }
+
+        Line_Break resolved_line_break(char32_t c) noexcept {
+            // Resolve AI, CB, CJ, SA, SG, and XX into other line breaking classes.
+            // LB1. AI, SG, XX → AL; SA → CM if Mn or Mc, otherwise AL; CJ → NS
+            auto lb = line_break(c);
+            switch (lb) {
+                case LB::AI:
+                case LB::SG:
+                case LB::XX:
+                    return LB::AL;
+                case LB::SA: {
+                    auto gc = char_general_category(c);
+                    return gc == GC::Mn || gc == GC::Mc ? LB::CM : LB::AL;
                 }
-                // WB7c. Hebrew_Letter Double_Quote × Hebrew_Letter
-                if (prev2 == P::Hebrew_Letter && prev == P::Double_Quote && next == P::Hebrew_Letter)
-                    continue;
-                // Do not break within sequences of digits, or digits adjacent to letters.
-                // WB8. Numeric × Numeric
-                // WB9. (ALetter | Hebrew_Letter) × Numeric
-                if ((prev == P::ALetter || prev == P::Hebrew_Letter || prev == P::Numeric)
-                        && next == P::Numeric)
-                    continue;
-                // WB10. Numeric × (ALetter | Hebrew_Letter)
-                if (prev == P::Numeric && (next == P::ALetter || next == P::Hebrew_Letter))
-                    continue;
-                // Do not break within sequences, such as “3.2” or “3,456.789”.
-                // WB11. Numeric (MidNum | MidNumLet | Single_Quote) × Numeric
-                if (prev2 == P::Numeric
-                        && (prev == P::MidNum || prev == P::MidNumLet || prev == P::Single_Quote)
-                        && next == P::Numeric)
-                    continue;
-                // WB12. Numeric × (MidNum | MidNumLet | Single_Quote) Numeric
-                if (prev == P::Numeric
-                        && (next == P::MidNum || next == P::MidNumLet || next == P::Single_Quote)) {
-                    if (next2 == P::EOT && ! eof)
-                        return 0;
-                    if (next2 == P::Numeric)
-                        continue;
+                case LB::CJ:
+                    return LB::NS;
+                default:
+                    return lb;
+            }
+        }
+
+        BreakCheck line_break_check(const LineBreakState& state, char32_t c, Line_Break next, const Line_Break* ahead) noexcept {
+            // Never break at the start of text.
+            // LB2. sot ×
+            if (state.raw == LB::XX)
+                return BreakCheck::no_break;
+            // Always break after hard line breaks, but treat CR LF as one.
+            // LB4. BK !
+            // LB5. CR × LF, CR !, LF !, NL !
+            if (state.raw == LB::CR && next == LB::LF)
+                return BreakCheck::no_break;
+            if (is_mandatory_line_break(state.raw))
+                return BreakCheck::must_break;
+            // Do not break before hard line breaks, spaces, or zero width space.
+            // LB6. × (BK | CR | LF | NL)
+            // LB7. × SP, × ZW
+            if (is_mandatory_line_break(next) || next == LB::SP || next == LB::ZW)
+                return BreakCheck::no_break;
+            // LB8. ZW SP* ÷
+            if (state.prev == LB::ZW)
+                return BreakCheck::do_break;
+            // Do not break after a zero width joiner.
+            // LB8a. ZWJ ×
+            if (state.raw == LB::ZWJ)
+                return BreakCheck::no_break;
+            // Do not break a combining character sequence; treat it as if it
+            // has the line breaking class of the base character.
+            // LB9. X (CM | ZWJ)* → X, where X is not BK, CR, LF, NL, SP, or ZW
+            // Treat any remaining combining mark or ZWJ as AL.
+            // LB10. (CM | ZWJ) → AL
+            if (is_line_combining(next)) {
+                if (! state.space)
+                    return BreakCheck::no_break;
+                next = LB::AL;
+            }
+            // Do not break after an unresolved initial quotation mark, even after spaces.
+            // LB15a. (sot | BK | CR | LF | NL | OP | QU | GL | SP | ZW) [\p{Pi}&QU] SP* ×
+            if (state.quote)
+                return BreakCheck::no_break;
+            // Do not break before an unresolved final quotation mark, even after spaces.
+            // LB15b. × [\p{Pf}&QU] (SP | GL | WJ | CL | QU | CP | EX | IS | SY | BK | CR | LF | NL | ZW | eot)
+            if (next == LB::QU && char_general_category(c) == GC::Pf) {
+                if (! ahead)
+                    return BreakCheck::lookahead;
+                if (is_after_final_quote(ahead[0]))
+                    return BreakCheck::no_break;
+            }
+            auto prev = state.prev;
+            // Break before an IS that begins a number and follows a space.
+            // LB15c. SP ÷ IS NU
+            if (state.space && next == LB::IS && prev != LB::OP) {
+                if (! ahead)
+                    return BreakCheck::lookahead;
+                if (ahead[0] == LB::NU)
+                    return BreakCheck::do_break;
+            }
+            if (! state.space && prev != LB::CB && next != LB::CB) {
+                // Do not break after a word-initial hyphen.
+                // LB20a. (sot | BK | CR | LF | NL | SP | ZW | CB | GL) (HY | ‐) × (AL | HL)
+                if (state.hyphen && (next == LB::AL || next == LB::HL))
+                    return BreakCheck::no_break;
+                // Do not break after the hyphen in Hebrew + Hyphen + non-Hebrew.
+                // LB21a. HL (HY | BA) × [^HL]
+                if (state.prev2 == LB::HL && (prev == LB::HY || prev == LB::BA) && next != LB::HL)
+                    return BreakCheck::no_break;
+                // Do not break within numbers.
+                // LB25. NU (SY | IS)* CL × PO, NU (SY | IS)* CP × PO, NU (SY | IS)* CL × PR, NU (SY | IS)* CP × PR,
+                //     NU (SY | IS)* × PO, NU (SY | IS)* × PR, PO × OP NU, PO × OP IS NU, PR × OP NU, PR × OP IS NU,
+                //     NU (SY | IS)* × NU
+                if (state.number != 0 && (next == LB::PO || next == LB::PR))
+                    return BreakCheck::no_break;
+                if (state.number == 1 && next == LB::NU)
+                    return BreakCheck::no_break;
+                if ((prev == LB::PO || prev == LB::PR) && next == LB::OP) {
+                    if (! ahead)
+                        return BreakCheck::lookahead;
+                    if (ahead[0] == LB::NU || (ahead[0] == LB::IS && ahead[1] == LB::NU))
+                        return BreakCheck::no_break;
                 }
-                // Do not break between Katakana.
-                // WB13. Katakana × Katakana
-                if (prev == P::Katakana && next == P::Katakana)
-                    continue;
-                // Do not break from extenders.
-                // WB13a. (ALetter | Hebrew_Letter | Numeric | Katakana | ExtendNumLet) × ExtendNumLet
-                if ((prev == P::ALetter || prev == P::ExtendNumLet || prev == P::Hebrew_Letter
-                            || prev == P::Katakana || prev == P::Numeric)
-                        && next == P::ExtendNumLet)
-                    continue;
-                // WB13b. ExtendNumLet × (ALetter | Hebrew_Letter | Numeric | Katakana)
-                if (prev == P::ExtendNumLet
-                        && (next == P::ALetter || next == P::Hebrew_Letter || next == P::Katakana
-                            || next == P::Numeric))
-                    continue;
-                // Do not break between regional indicator symbols.
-                // WB13c. Regional_Indicator × Regional_Indicator
-                if (prev == P::Regional_Indicator && next == P::Regional_Indicator)
-                    continue;
-                // Otherwise, break everywhere (including around ideographs).
-                // WB14. Any ÷ Any
-                return i;
+                // Do not break within Brahmic orthographic syllables.
+                // LB28a. AP × (AK | ◌ | AS)
+                //     (AK | ◌ | AS) × (VF | VI)
+                //     (AK | ◌ | AS) VI × (AK | ◌)
+                //     (AK | ◌ | AS) × (AK | ◌ | AS) VF
+                bool prev_aksara = is_aksara(prev, state.prev_char);
+                bool next_aksara = is_aksara(next, c);
+                if (prev == LB::AP && next_aksara)
+                    return BreakCheck::no_break;
+                if (prev_aksara && (next == LB::VF || next == LB::VI))
+                    return BreakCheck::no_break;
+                if (prev == LB::VI && is_aksara(state.prev2, state.prev2_char) && (next == LB::AK || c == dotted_circle))
+                    return BreakCheck::no_break;
+                if (prev_aksara && next_aksara) {
+                    if (! ahead)
+                        return BreakCheck::lookahead;
+                    if (ahead[0] == LB::VF)
+                        return BreakCheck::no_break;
+                }
+                // Do not break between letters, numbers, or ordinary symbols
+                // and opening or closing parentheses, unless they are East
+                // Asian.
+                // LB30. (AL | HL | NU) × [OP-[\p{ea=F}\p{ea=W}\p{ea=H}]]
+                //     [CP-[\p{ea=F}\p{ea=W}\p{ea=H}]] × (AL | HL | NU)
+                if ((prev == LB::AL || prev == LB::HL || prev == LB::NU) && next == LB::OP && ! is_east_asian_wide(c))
+                    return BreakCheck::no_break;
+                if (prev == LB::CP && (next == LB::AL || next == LB::HL || next == LB::NU) && ! is_east_asian_wide(state.prev_char))
+                    return BreakCheck::no_break;
+                // Break between two regional indicator symbols if and only
+                // if there are an even number of regional indicators
+                // preceding the position of the break.
+                // LB30a. sot (RI RI)* RI × RI, [^RI] (RI RI)* RI × RI
+                if (prev == LB::RI && next == LB::RI && state.ri)
+                    return BreakCheck::no_break;
+                // LB30b. [\p{Extended_Pictographic}&\p{Cn}] × EM
+                if (next == LB::EM && char_general_category(state.prev_char) == GC::Cn
+                        && sparse_table_lookup(grapheme_class_table, state.prev_char) == Grapheme_Class::Extended_Pictographic)
+                    return BreakCheck::no_break;
             }
-            return 0;
+            bool brk = line_pair_table[size_t(prev)][size_t(next)] & (state.space ? 2 : 1);
+            return brk ? BreakCheck::do_break : BreakCheck::no_break;
         }
 
-        size_t find_sentence_break(const std::deque<Sentence_Break>& buf, bool eof) {
-            using P = Sentence_Break;
-            if (buf.empty())
-                return 0;
-            size_t size = buf.size();
-            for (size_t i = 1; i < size; ++i) {
-                // Break at the start and end of text.
-                // SB1. sot ÷
-                // SB2. ÷ eot
-                // Do not break within CRLF.
-                // SB3. CR × LF
-                P prev(prop(buf, i - 1));
-                P next(prop(buf, i));
-                if (prev == P::CR && next == P::LF)
-                    continue;
-                // Break after paragraph separators.
-                // SB4. Sep | CR | LF ÷
-                if (prev == P::CR || prev == P::LF || prev == P::Sep)
-                    return i;
-                // Ignore Format and Extend characters, except when they
-                // appear at the beginning of a region of text.
-                // SB5. X (Extend | Format)* → X
-                if (next == P::Extend || next == P::Format)
-                    continue;
-                size_t j = i;
-                do prev = prop(buf, --j);
-                    while (prev == P::Extend || prev == P::Format);
-                P prev2;
-                do prev2 = prop(buf, --j);
-                    while (prev2 == P::Extend || prev2 == P::Format);
-                // Do not break after ambiguous terminators like period, if
-                // they are immediately followed by a number or lowercase
-                // letter, if they are between uppercase letters, if the first
-                // following letter (optionally after certain punctuation) is
-                // lowercase, or if they are followed by “continuation”
-                // punctuation such as comma, colon, or semicolon.
-                // SB6. ATerm × Numeric
-                if (prev == P::ATerm && next == P::Numeric)
-                    continue;
-                // SB7. (Upper | Lower) ATerm × Upper
-                if ((prev2 == P::Upper || prev2 == P::Lower) && prev == P::ATerm && next == P::Upper)
-                    continue;
-                // SB8. ATerm Close* Sp* × (¬(OLetter | Upper | Lower | Sep | CR | LF | STerm | ATerm))* Lower
-                j = i;
-                P pre_cs;
-                do pre_cs = prop(buf, --j);
-                    while (pre_cs == P::Extend || pre_cs == P::Format || pre_cs == P::Sp);
-                while (pre_cs == P::Extend || pre_cs == P::Format || pre_cs == P::Close)
-                    pre_cs = prop(buf, --j);
-                if (pre_cs == P::ATerm) {
-                    j = i;
-                    P post(prop(buf, j));
-                    while (post == P::Extend || post == P::Format
-                            || (post != P::ATerm && post != P::EOT && post != P::CR && post != P::LF && post != P::Lower
-                                && post != P::OLetter && post != P::Sep && post != P::STerm && post != P::Upper))
-                        post = prop(buf, ++j);
-                    if (post == P::EOT && ! eof)
-                        return 0;
-                    if (post == P::Lower)
-                        continue;
+        void line_break_update(LineBreakState& state, char32_t c, Line_Break next) noexcept {
+            auto raw = next;
+            if (next == LB::SP) {
+                state.space = true;
+                state.hyphen = false;
+                state.raw = next;
+                return;
+            }
+            if (is_line_combining(next)) {
+                if (! state.space && state.raw != LB::XX && ! is_mandatory_line_break(state.raw) && state.prev != LB::ZW) {
+                    state.raw = next;
+                    return;
                 }
-                // SB8a. (STerm | ATerm) Close* Sp* × (SContinue | STerm | ATerm)
-                if ((pre_cs == P::ATerm || pre_cs == P::STerm)
-                        && (next == P::ATerm || next == P::SContinue || next == P::STerm))
-                    continue;
-                // Break after sentence terminators, but include closing
-                // punctuation, trailing spaces, and a paragraph separator (if
-                // present).
-                // SB9. (STerm | ATerm) Close* × (Close | Sp | Sep | CR | LF)
-                j = i;
-                P pre_c;
-                do pre_c = prop(buf, --j);
-                    while (pre_c == P::Extend || pre_c == P::Format || pre_c == P::Close);
-                if ((pre_c == P::ATerm || pre_c == P::STerm)
-                        && (next == P::Close || next == P::CR || next == P::LF || next == P::Sep || next == P::Sp))
-                    continue;
-                // SB10. (STerm | ATerm) Close* Sp* × (Sp | Sep | CR | LF)
-                if ((pre_cs == P::ATerm || pre_cs == P::STerm)
-                        && (next == P::CR || next == P::LF || next == P::Sep || next == P::Sp))
-                    continue;
-                // SB11. (STerm | ATerm) Close* Sp* (Sep | CR | LF)? ÷
-                j = i;
-                P pre_csx;
-                do pre_csx = prop(buf, --j);
-                    while (pre_csx == P::Extend || pre_csx == P::Format);
-                if (pre_csx == P::CR || pre_csx == P::LF || pre_csx == P::Sep)
-                    pre_csx = prop(buf, --j);
-                while (pre_csx == P::Extend || pre_csx == P::Format || pre_csx == P::Sp)
-                    pre_csx = prop(buf, --j);
-                while (pre_csx == P::Extend || pre_csx == P::Format || pre_csx == P::Close)
-                    pre_csx = prop(buf, --j);
-                if (pre_csx == P::ATerm || pre_csx == P::STerm)
-                    return i;
-                // Otherwise, do not break.
-                // SB12. Any × Any
+                next = LB::AL;
             }
-            return 0;
+            auto before = state.raw == LB::XX ? LB::XX : state.space ? LB::SP : state.prev;
+            state.hyphen = (next == LB::HY || c == unicode_hyphen)
+                && (before == LB::XX || before == LB::SP || before == LB::ZW || before == LB::CB || before == LB::GL
+                    || is_mandatory_line_break(before));
+            if (next == LB::NU)
+                state.number = 1;
+            else if (state.number == 1 && ! state.space && (next == LB::SY || next == LB::IS))
+                state.number = 1;
+            else if (state.number == 1 && ! state.space && (next == LB::CL || next == LB::CP))
+                state.number = 2;
+            else
+                state.number = 0;
+            state.quote = next == LB::QU && is_before_initial_quote(before) && char_general_category(c) == GC::Pi;
+            state.ri = next == LB::RI && ! (state.prev == LB::RI && ! state.space && state.ri);
+            state.prev2 = state.space ? LB::XX : state.prev;
+            state.prev2_char = state.prev_char;
+            state.prev = next;
+            state.prev_char = c;
+            state.space = false;
+            state.raw = raw;
         }
+    }
 
+    // Streaming segmentation
+
+    template <typename Breaker>
+    void BasicSegmenter<Breaker>::add(const Ustring& src, Strings& dst) {
+        buf += src;
+        scan(buf.size() - UnicornDetail::utf8_incomplete_tail(buf, scanned), false, dst);
+    }
+
+    template <typename Breaker>
+    void BasicSegmenter<Breaker>::flush(Strings& dst) {
+        scan(buf.size(), true, dst);
+        if (! buf.empty())
+            dst.push_back(buf);
+        clear();
     }
 
+    template <typename Breaker>
+    void BasicSegmenter<Breaker>::scan(size_t end, bool final, Strings& dst) {
+        // A break whose lookahead ran into the end of the available text is
+        // not final until more text arrives, so the breaker is rolled back
+        // to just before that character.
+        size_t start = 0;
+        auto j = utf_iterator(buf, end);
+        for (auto i = utf_iterator(buf, scanned); i != j; ++i) {
+            auto saved = breaker;
+            bool brk = breaker(i, j);
+            if (breaker.incomplete && ! final) {
+                breaker = saved;
+                break;
+            }
+            size_t pos = i.offset();
+            if (brk && pos > start) {
+                dst.push_back(buf.substr(start, pos - start));
+                start = pos;
+            }
+            scanned = pos + i.count();
+        }
+        buf.erase(0, start);
+        scanned -= start;
+    }
+
+    template class BasicSegmenter<UnicornDetail::GraphemeBreaker>;
+    template class BasicSegmenter<UnicornDetail::WordBreaker>;
+    template class BasicSegmenter<UnicornDetail::SentenceBreaker>;
+
 }
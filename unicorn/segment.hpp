@@ -4,11 +4,13 @@
 #include "unicorn/utf.hpp"
 #include "unicorn/utility.hpp"
 #include <algorithm>
-#include <deque>
+#include <future>
 #include <iterator>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 
 namespace RS::Unicorn {
 
@@ -30,63 +32,233 @@ namespace RS::Unicorn {
 
     namespace UnicornDetail {
 
-        template <typename Property> using PropertyQuery = Property (*)(char32_t);
-        template <typename Property> using SegmentFunction = size_t (*)(const std::deque<Property>&, bool);
+        // Each breaker is fed the characters of the text in order, and
+        // reports whether there is a boundary before each one. Breakers keep
+        // enough state to need no more than a bounded lookahead (past any
+        // ignorable characters), so every character is examined a constant
+        // number of times.
+
+        enum class BreakCheck: uint8_t {
+            no_break,
+            do_break,
+            must_break,  // Mandatory break (line breaking only)
+            lookahead,   // Need the next significant property
+        };
+
+        // Grapheme break state machine: takes the state after the previous
+        // character (zero at the start of the text) and the next character,
+        // and returns the new state, with grapheme_break_flag set if there
+        // is a grapheme boundary before the character.
+
+        constexpr unsigned grapheme_break_flag = 0x80;
+
+        unsigned grapheme_transition(unsigned state, char32_t c) noexcept;
+
+        // Between two ASCII characters there is always a grapheme boundary
+        // except within CR+LF, and the state after an ASCII character does
+        // not depend on what came before, so the state machine is bypassed
+        // within ASCII runs.
+
+        struct GraphemeBreaker {
+            static constexpr bool ascii_runs = true;
+            static constexpr bool incomplete = false;  // Never looks ahead
+            unsigned state = 0;
+            int ascii = -1;  // Previous character if it was ASCII
+            template <typename I> bool operator()(const I& i, const I& /*end*/) noexcept {
+                return step(*i);
+            }
+            bool step(char32_t c) noexcept {
+                if (ascii >= 0) {
+                    if (c <= last_ascii_char) {
+                        bool brk = ascii != U'\r' || c != U'\n';
+                        ascii = int(c);
+                        return brk;
+                    }
+                    state = grapheme_transition(0, char32_t(ascii)) & ~ grapheme_break_flag;
+                    ascii = -1;
+                }
+                state = grapheme_transition(state, c);
+                bool brk = state & grapheme_break_flag;
+                state &= ~ grapheme_break_flag;
+                if (c <= last_ascii_char)
+                    ascii = int(c);
+                return brk;
+            }
+            template <typename C, typename F> void ascii_run(const C* ptr, size_t pos, size_t end, F& f) noexcept {
+                for (; pos < end; ++pos)
+                    if (step(char32_t(ptr[pos])))
+                        f(pos);
+            }
+        };
 
-        size_t find_grapheme_break(const std::deque<Grapheme_Cluster_Break>& buf, bool eof);
-        size_t find_word_break(const std::deque<Word_Break>& buf, bool eof);
-        size_t find_sentence_break(const std::deque<Sentence_Break>& buf, bool eof);
+        // Word breaks: prev and prev2 are the last two properties after
+        // applying WB4, raw is the property of the last actual character.
+
+        struct WordBreakState {
+            Word_Break raw = Word_Break::SOT;
+            Word_Break prev = Word_Break::SOT;
+            Word_Break prev2 = Word_Break::SOT;
+            bool ri = false;  // Odd number of regional indicators
+        };
+
+        constexpr bool is_word_ignorable(Word_Break p) noexcept {
+            return p == Word_Break::Extend || p == Word_Break::Format || p == Word_Break::ZWJ;
+        }
+
+        constexpr Word_Break ascii_word_break(char32_t c) noexcept {
+            using P = Word_Break;
+            if ((c >= U'A' && c <= U'Z') || (c >= U'a' && c <= U'z'))
+                return P::ALetter;
+            if (c >= U'0' && c <= U'9')
+                return P::Numeric;
+            switch (c) {
+                case U'\n':  return P::LF;
+                case U'\v':  return P::Newline;
+                case U'\f':  return P::Newline;
+                case U'\r':  return P::CR;
+                case U' ':   return P::WSegSpace;
+                case U'"':   return P::Double_Quote;
+                case U'\'':  return P::Single_Quote;
+                case U',':   return P::MidNum;
+                case U'.':   return P::MidNumLet;
+                case U':':   return P::MidLetter;
+                case U';':   return P::MidNum;
+                case U'_':   return P::ExtendNumLet;
+                default:     return P::Other;
+            }
+        }
+
+        // Letters, digits, and connectors never break between each other
+        // (WB5, WB8-10, WB13a-b).
+
+        constexpr bool is_word_continuing(Word_Break p) noexcept {
+            return p == Word_Break::ALetter || p == Word_Break::Hebrew_Letter || p == Word_Break::Numeric
+                || p == Word_Break::ExtendNumLet;
+        }
+
+        BreakCheck word_break_check(const WordBreakState& state, char32_t c, Word_Break next, const Word_Break* ahead) noexcept;
+        void word_break_update(WordBreakState& state, Word_Break next) noexcept;
+
+        struct WordBreaker {
+            static constexpr bool ascii_runs = false;
+            WordBreakState state;
+            bool incomplete = false;  // Last lookahead ran into the end of the text
+            template <typename I> bool operator()(I i, const I& end) noexcept {
+                incomplete = false;
+                auto c = *i;
+                if (c <= last_ascii_char) {
+                    auto next = ascii_word_break(c);
+                    if (is_word_continuing(state.prev) && is_word_continuing(next)) {
+                        state.prev2 = state.prev;
+                        state.raw = state.prev = next;
+                        state.ri = false;
+                        return false;
+                    }
+                }
+                auto next = c <= last_ascii_char ? ascii_word_break(c) : word_break(c);
+                auto check = word_break_check(state, c, next, nullptr);
+                if (check == BreakCheck::lookahead) {
+                    auto ahead = Word_Break::EOT;
+                    for (++i; i != end; ++i) {
+                        auto p = word_break(*i);
+                        if (! is_word_ignorable(p)) {
+                            ahead = p;
+                            break;
+                        }
+                    }
+                    incomplete = i == end;
+                    check = word_break_check(state, c, next, &ahead);
+                }
+                word_break_update(state, next);
+                return check == BreakCheck::do_break;
+            }
+        };
+
+        // Sentence breaks: prev and prev2 are the last two properties after
+        // applying SB5, raw is the property of the last actual character,
+        // term tracks progress through a terminator sequence (1 = SATerm
+        // Close*, 2 = SATerm Close* Sp*).
+
+        struct SentenceBreakState {
+            Sentence_Break raw = Sentence_Break::SOT;
+            Sentence_Break prev = Sentence_Break::SOT;
+            Sentence_Break prev2 = Sentence_Break::SOT;
+            int term = 0;
+            bool aterm = false;  // Terminator sequence started with ATerm
+        };
+
+        // SB8 looks ahead to the first character that is not in its skip set.
+
+        constexpr bool is_sentence_lookahead_stop(Sentence_Break p) noexcept {
+            using P = Sentence_Break;
+            return p == P::OLetter || p == P::Upper || p == P::Lower || p == P::Sep || p == P::CR
+                || p == P::LF || p == P::STerm || p == P::ATerm;
+        }
+
+        BreakCheck sentence_break_check(const SentenceBreakState& state, Sentence_Break next, const Sentence_Break* ahead) noexcept;
+        void sentence_break_update(SentenceBreakState& state, Sentence_Break next) noexcept;
+
+        struct SentenceBreaker {
+            static constexpr bool ascii_runs = false;
+            SentenceBreakState state;
+            bool incomplete = false;  // Last lookahead ran into the end of the text
+            template <typename I> bool operator()(I i, const I& end) noexcept {
+                incomplete = false;
+                auto next = sentence_break(*i);
+                auto check = sentence_break_check(state, next, nullptr);
+                if (check == BreakCheck::lookahead) {
+                    auto ahead = Sentence_Break::EOT;
+                    for (; i != end; ++i) {
+                        auto p = sentence_break(*i);
+                        if (is_sentence_lookahead_stop(p)) {
+                            ahead = p;
+                            break;
+                        }
+                    }
+                    incomplete = i == end;
+                    check = sentence_break_check(state, next, &ahead);
+                }
+                sentence_break_update(state, next);
+                return check == BreakCheck::do_break;
+            }
+        };
 
     }
 
-    template <typename C, typename Property, UnicornDetail::PropertyQuery<Property> PQ, UnicornDetail::SegmentFunction<Property> SF>
+    template <typename C, typename Breaker>
     class BasicSegmentIterator:
-    public ForwardIterator<BasicSegmentIterator<C, Property, PQ, SF>, const Irange<UtfIterator<C>>> {
+    public ForwardIterator<BasicSegmentIterator<C, Breaker>, const Irange<UtfIterator<C>>> {
     public:
         using utf_iterator = UtfIterator<C>;
         BasicSegmentIterator() noexcept {}
-        BasicSegmentIterator(const utf_iterator& i, const utf_iterator& j, uint32_t flags):
-            seg{i, i}, ends(j), next(i), bufsize(initsize), mode(flags) { ++*this; }
+        BasicSegmentIterator(const utf_iterator& i, const utf_iterator& j, uint32_t flags) noexcept:
+            seg{i, i}, ends(j), mode(flags) { if (i != j) breaker(i, j); ++*this; }
         const Irange<utf_iterator>& operator*() const noexcept { return seg; }
         BasicSegmentIterator& operator++() noexcept;
         bool operator==(const BasicSegmentIterator& rhs) const noexcept { return seg.begin() == rhs.seg.begin(); }
     private:
-        static constexpr size_t initsize = 16;
         Irange<utf_iterator> seg;  // Iterator pair marking current segment
-        size_t len = 0;            // Length of segment
         utf_iterator ends;         // End of source string
-        utf_iterator next;         // End of buffer contents
-        std::deque<Property> buf;  // Property lookahead buffer
-        size_t bufsize = 0;        // Current lookahead limit
+        Breaker breaker;           // Break state after the first character of the next segment
         uint32_t mode = 0;         // Mode flags
         bool select_segment() const noexcept;
     };
 
-    template <typename C, typename Property, UnicornDetail::PropertyQuery<Property> PQ, UnicornDetail::SegmentFunction<Property> SF>
-    BasicSegmentIterator<C, Property, PQ, SF>& BasicSegmentIterator<C, Property, PQ, SF>::operator++() noexcept {
+    template <typename C, typename Breaker>
+    BasicSegmentIterator<C, Breaker>& BasicSegmentIterator<C, Breaker>::operator++() noexcept {
         do {
             seg.first = seg.second;
             if (seg.first == ends)
                 break;
-            buf.erase(buf.begin(), buf.begin() + len);
-            for (;;) {
-                while (next != ends && buf.size() < bufsize)
-                    buf.push_back(PQ(*next++));
-                len = SF(buf, next == ends);
-                if (len || next == ends)
+            for (++seg.second; seg.second != ends; ++seg.second)
+                if (breaker(seg.second, ends))
                     break;
-                bufsize += initsize;
-            }
-            if (len == 0)
-                seg.second = ends;
-            else
-                std::advance(seg.second, len);
         } while (! select_segment());
         return *this;
     }
 
-    template <typename C, typename Property, UnicornDetail::PropertyQuery<Property> PQ, UnicornDetail::SegmentFunction<Property> SF>
-    bool BasicSegmentIterator<C, Property, PQ, SF>::select_segment() const noexcept {
+    template <typename C, typename Breaker>
+    bool BasicSegmentIterator<C, Breaker>::select_segment() const noexcept {
         if (mode & Segment::graphic)
             return std::find_if_not(seg.begin(), seg.end(), char_is_white_space) != seg.end();
         else if (mode & Segment::alpha)
@@ -97,7 +269,7 @@ namespace RS::Unicorn {
 
     // Grapheme cluster boundaries
 
-    template <typename C> using GraphemeIterator = BasicSegmentIterator<C, Grapheme_Cluster_Break, grapheme_cluster_break, UnicornDetail::find_grapheme_break>;
+    template <typename C> using GraphemeIterator = BasicSegmentIterator<C, UnicornDetail::GraphemeBreaker>;
 
     template <typename C> Irange<GraphemeIterator<C>>
     grapheme_range(const UtfIterator<C>& i, const UtfIterator<C>& j) {
@@ -116,7 +288,7 @@ namespace RS::Unicorn {
 
     // Word boundaries
 
-    template <typename C> using WordIterator = BasicSegmentIterator<C, Word_Break, word_break, UnicornDetail::find_word_break>;
+    template <typename C> using WordIterator = BasicSegmentIterator<C, UnicornDetail::WordBreaker>;
 
     template <typename C> Irange<WordIterator<C>>
     word_range(const UtfIterator<C>& i, const UtfIterator<C>& j, uint32_t flags = 0) {
@@ -137,7 +309,7 @@ namespace RS::Unicorn {
 
     // Sentence boundaries
 
-    template <typename C> using SentenceIterator = BasicSegmentIterator<C, Sentence_Break, sentence_break, UnicornDetail::find_sentence_break>;
+    template <typename C> using SentenceIterator = BasicSegmentIterator<C, UnicornDetail::SentenceBreaker>;
 
     template <typename C> Irange<SentenceIterator<C>>
     sentence_range(const UtfIterator<C>& i, const UtfIterator<C>& j) {
@@ -154,6 +326,285 @@ namespace RS::Unicorn {
         return sentence_range(utf_range(source));
     }
 
+    // Line break opportunities
+
+    namespace UnicornDetail {
+
+        // Line breaks (UAX14): prev is the resolved class of the last
+        // character that is not a space or an attached combining mark, raw
+        // is the class of the last actual character, prev2 is the class
+        // before prev if they were adjacent. When line_break_check() asks
+        // for lookahead, ahead holds the classes of the next two characters
+        // after c, skipping combining marks (XX at the end of the text).
+
+        struct LineBreakState {
+            Line_Break raw = Line_Break::XX;    // XX = start of text
+            Line_Break prev = Line_Break::XX;
+            Line_Break prev2 = Line_Break::XX;
+            char32_t prev_char = 0;
+            char32_t prev2_char = 0;
+            bool space = false;                 // Spaces since prev
+            bool hyphen = false;                // Prev is a word-initial hyphen
+            bool quote = false;                 // Prev is an initial quotation mark that opens (LB15a)
+            uint8_t number = 0;                 // 1 after NU (SY | IS)*, 2 after NU (SY | IS)* (CL | CP) (LB25)
+            bool ri = false;                    // Odd number of regional indicators
+        };
+
+        Line_Break resolved_line_break(char32_t c) noexcept;
+        BreakCheck line_break_check(const LineBreakState& state, char32_t c, Line_Break next, const Line_Break* ahead) noexcept;
+        void line_break_update(LineBreakState& state, char32_t c, Line_Break next) noexcept;
+
+        struct LineBreaker {
+            LineBreakState state;
+            template <typename I> BreakCheck operator()(I i, const I& end) noexcept {
+                auto c = *i;
+                auto next = resolved_line_break(c);
+                auto check = line_break_check(state, c, next, nullptr);
+                if (check == BreakCheck::lookahead) {
+                    // Combining marks take the class of their base (LB9)
+                    Line_Break ahead[2] = {Line_Break::XX, Line_Break::XX};
+                    for (auto& a: ahead) {
+                        while (i != end && ++i != end) {
+                            a = resolved_line_break(*i);
+                            if (a != Line_Break::CM && a != Line_Break::ZWJ)
+                                break;
+                            a = Line_Break::XX;
+                        }
+                    }
+                    check = line_break_check(state, c, next, ahead);
+                }
+                line_break_update(state, c, next);
+                return check;
+            }
+        };
+
+    }
+
+    template <typename C>
+    class LineBreakIterator:
+    public ForwardIterator<LineBreakIterator<C>, const Irange<UtfIterator<C>>> {
+    public:
+        using utf_iterator = UtfIterator<C>;
+        LineBreakIterator() noexcept {}
+        LineBreakIterator(const utf_iterator& i, const utf_iterator& j) noexcept:
+            seg{i, i}, ends(j) { if (i != j) breaker(i, j); ++*this; }
+        const Irange<utf_iterator>& operator*() const noexcept { return seg; }
+        LineBreakIterator& operator++() noexcept;
+        bool operator==(const LineBreakIterator& rhs) const noexcept { return seg.begin() == rhs.seg.begin(); }
+        bool mandatory() const noexcept { return must; }
+    private:
+        Irange<utf_iterator> seg;           // Iterator pair marking current segment
+        utf_iterator ends;                  // End of source string
+        UnicornDetail::LineBreaker breaker; // Break state after the first character of the next segment
+        bool must = false;                  // Break at end of segment is mandatory
+    };
+
+    template <typename C>
+    LineBreakIterator<C>& LineBreakIterator<C>::operator++() noexcept {
+        using namespace UnicornDetail;
+        seg.first = seg.second;
+        if (seg.first == ends)
+            return *this;
+        must = true;
+        for (++seg.second; seg.second != ends; ++seg.second) {
+            auto check = breaker(seg.second, ends);
+            if (check != BreakCheck::no_break) {
+                must = check == BreakCheck::must_break;
+                break;
+            }
+        }
+        return *this;
+    }
+
+    template <typename C> Irange<LineBreakIterator<C>>
+    line_break_opportunities(const UtfIterator<C>& i, const UtfIterator<C>& j) {
+        return {{i, j}, {j, j}};
+    }
+
+    template <typename C> Irange<LineBreakIterator<C>>
+    line_break_opportunities(const Irange<UtfIterator<C>>& source) {
+        return line_break_opportunities(source.begin(), source.end());
+    }
+
+    template <typename C> Irange<LineBreakIterator<C>>
+    line_break_opportunities(const std::basic_string<C>& source) {
+        return line_break_opportunities(utf_range(source));
+    }
+
+    // Bulk boundary extraction
+
+    namespace UnicornDetail {
+
+        // Reports every boundary in src[begin,end), including both ends;
+        // begin and end must be character boundaries.
+
+        template <typename Breaker, typename C, typename F>
+        void for_each_break(const std::basic_string<C>& src, size_t begin, size_t end, F f) {
+            if (begin >= end)
+                return;
+            auto i = utf_iterator(src, begin), j = utf_iterator(src, end);
+            Breaker breaker;
+            breaker(i, j);
+            f(begin);
+            for (++i; i != j; ++i) {
+                if constexpr (Breaker::ascii_runs) {
+                    if (*i <= last_ascii_char) {
+                        size_t pos = i.offset();
+                        size_t stop = pos + ascii_run_length(src.data() + pos, end - pos);
+                        breaker.ascii_run(src.data(), pos, stop, f);
+                        if (stop == end)
+                            break;
+                        i = i.offset_by(stop - pos);
+                    }
+                }
+                if (breaker(i, j))
+                    f(i.offset());
+            }
+            f(end);
+        }
+
+        template <typename Breaker, typename C, typename F>
+        void for_each_break(const std::basic_string<C>& src, F f) {
+            for_each_break<Breaker>(src, 0, src.size(), f);
+        }
+
+        template <typename Breaker, typename C>
+        void find_breaks(const std::basic_string<C>& src, std::vector<size_t>& dst) {
+            dst.clear();
+            for_each_break<Breaker>(src, [&] (size_t n) { dst.push_back(n); });
+        }
+
+        template <typename Breaker, typename C>
+        void find_breaks(const std::basic_string<C>& src, std::vector<bool>& dst) {
+            dst.assign(src.size() + 1, false);
+            for_each_break<Breaker>(src, [&] (size_t n) { dst[n] = true; });
+        }
+
+        // Every UAX29 rule set always breaks after LF, and a breaker
+        // started just after one is in the same state as at the start of
+        // the text, so each chunk can be processed independently.
+
+        constexpr size_t min_parallel_segment = 16384;
+
+        template <typename Breaker, typename C>
+        void find_breaks_parallel(const std::basic_string<C>& src, std::vector<size_t>& dst, size_t threads) {
+            if (threads == 0)
+                threads = std::max(size_t(std::thread::hardware_concurrency()), size_t(1));
+            threads = std::min(threads, src.size() / min_parallel_segment);
+            std::vector<size_t> bounds = {0};
+            if (threads > 1) {
+                size_t chunk = src.size() / threads;
+                for (size_t i = 1; i < threads; ++i) {
+                    size_t pos = std::max(i * chunk, bounds.back()), limit = std::min((i + 1) * chunk, src.size());
+                    size_t lf = src.find(C('\n'), pos);
+                    if (lf < limit && lf + 1 < src.size())
+                        bounds.push_back(lf + 1);
+                }
+            }
+            if (bounds.size() == 1) {
+                find_breaks<Breaker>(src, dst);
+                return;
+            }
+            bounds.push_back(src.size());
+            std::vector<std::future<std::vector<size_t>>> results;
+            for (size_t i = 1; i < bounds.size(); ++i) {
+                size_t begin = bounds[i - 1], end = bounds[i];
+                results.push_back(std::async(std::launch::async, [&src, begin, end] {
+                    std::vector<size_t> part;
+                    for_each_break<Breaker>(src, begin, end, [&] (size_t n) { part.push_back(n); });
+                    return part;
+                }));
+            }
+            dst.clear();
+            for (auto& r: results) {
+                auto part = r.get();
+                // Each chunk boundary is reported by both adjacent chunks
+                auto it = part.begin();
+                if (! dst.empty())
+                    ++it;
+                dst.insert(dst.end(), it, part.end());
+            }
+        }
+
+        template <typename Breaker, typename C>
+        void find_breaks_parallel(const std::basic_string<C>& src, std::vector<bool>& dst, size_t threads) {
+            std::vector<size_t> offsets;
+            find_breaks_parallel<Breaker>(src, offsets, threads);
+            dst.assign(src.size() + 1, false);
+            for (auto n: offsets)
+                dst[n] = true;
+        }
+
+    }
+
+    template <typename C, typename Out>
+    void grapheme_breaks(const std::basic_string<C>& src, Out& dst) {
+        UnicornDetail::find_breaks<UnicornDetail::GraphemeBreaker>(src, dst);
+    }
+
+    template <typename C, typename Out>
+    void word_breaks(const std::basic_string<C>& src, Out& dst) {
+        UnicornDetail::find_breaks<UnicornDetail::WordBreaker>(src, dst);
+    }
+
+    template <typename C, typename Out>
+    void sentence_breaks(const std::basic_string<C>& src, Out& dst) {
+        UnicornDetail::find_breaks<UnicornDetail::SentenceBreaker>(src, dst);
+    }
+
+    template <typename C, typename Out>
+    void grapheme_breaks_parallel(const std::basic_string<C>& src, Out& dst, size_t threads = 0) {
+        UnicornDetail::find_breaks_parallel<UnicornDetail::GraphemeBreaker>(src, dst, threads);
+    }
+
+    template <typename C, typename Out>
+    void word_breaks_parallel(const std::basic_string<C>& src, Out& dst, size_t threads = 0) {
+        UnicornDetail::find_breaks_parallel<UnicornDetail::WordBreaker>(src, dst, threads);
+    }
+
+    template <typename C, typename Out>
+    void sentence_breaks_parallel(const std::basic_string<C>& src, Out& dst, size_t threads = 0) {
+        UnicornDetail::find_breaks_parallel<UnicornDetail::SentenceBreaker>(src, dst, threads);
+    }
+
+    // Streaming segmentation
+
+    template <typename Breaker>
+    class BasicSegmenter {
+    public:
+        BasicSegmenter() = default;
+        size_t pending() const noexcept { return buf.size(); }
+        void add(const Ustring& src, Strings& dst);
+        void flush(Strings& dst);
+        void clear() noexcept { buf.clear(); breaker = {}; scanned = 0; }
+    private:
+        Ustring buf;         // Current incomplete segment, lookahead, and any incomplete UTF-8 sequence
+        Breaker breaker;     // Break state after the character before scanned
+        size_t scanned = 0;  // Offset in buf of the next character to feed to the breaker
+        void scan(size_t end, bool final, Strings& dst);
+    };
+
+    using GraphemeSegmenter = BasicSegmenter<UnicornDetail::GraphemeBreaker>;
+    using WordSegmenter = BasicSegmenter<UnicornDetail::WordBreaker>;
+    using SentenceSegmenter = BasicSegmenter<UnicornDetail::SentenceBreaker>;
+
+    extern template class BasicSegmenter<UnicornDetail::GraphemeBreaker>;
+    extern template class BasicSegmenter<UnicornDetail::WordBreaker>;
+    extern template class BasicSegmenter<UnicornDetail::SentenceBreaker>;
+
+    template <typename Segmenter, typename Range, typename OutIter>
+    void segment_stream(const Range& src, OutIter dst) {
+        Segmenter segmenter;
+        Strings buf;
+        for (auto& chunk: src) {
+            segmenter.add(chunk, buf);
+            dst = std::copy(buf.begin(), buf.end(), dst);
+            buf.clear();
+        }
+        segmenter.flush(buf);
+        std::copy(buf.begin(), buf.end(), dst);
+    }
+
     // Common base template for line and paragraph iterators
 
     namespace UnicornDetail {
@@ -3,7 +3,9 @@
 #include "unicorn/unit-test.hpp"
 #include "unicorn/utf.hpp"
 #include <iterator>
+#include <string>
 #include <utility>
+#include <vector>
 
 using namespace RS;
 using namespace RS::Unicorn;
@@ -166,6 +168,85 @@ void test_unicorn_string_algorithm_search() {
 
 }
 
+void test_unicorn_string_algorithm_search_long() {
+
+    // Targets long enough to use the two-way search, including periodic
+    // targets and near misses, checked against std::string::find()
+
+    Ustring s, t;
+    Irange<Utf8Iterator> r;
+
+    for (int i = 0; i < 200; ++i)
+        s += "abaabaaab€";
+    s += "abaabaaabaabaaab∈";
+    Strings targets = {
+        "abaabaaab€", "aabaaab€abaab", "abaabaaabaabaaab∈", "baaab€abaabaaab€ab", "aaaaaaaaaaa",
+        "abaabaaab€abaabaaab€abaabaaab€abaabaaab€", "€abaabaaab€abaabaaab", "abaabaaabaabaaab€",
+        "∈lement", "abaabaaab∈",
+    };
+    for (auto& t: targets) {
+        size_t pos = s.find(t);
+        TRY(r = str_search(s, t));
+        TEST_EQUAL(r.first.offset(), pos == npos ? s.size() : pos);
+        TEST_EQUAL(r.second.offset(), pos == npos ? s.size() : pos + t.size());
+        if (pos != npos) {
+            TEST_EQUAL(UnicornDetail::find_substring(s, t, pos + 1), s.find(t, pos + 1));
+            TEST_EQUAL(UnicornDetail::find_substring(s, t, 0, pos + t.size() - 1), s.substr(0, pos + t.size() - 1).find(t));
+        }
+    }
+
+    t = "abaabaaab€abaabaaab€";
+    auto b = utf_iterator(s, 12), e = utf_iterator(s, 33);
+    TRY(r = str_search(b, e, t));
+    TEST_EQUAL(r.first.offset(), 33);
+    TEST_EQUAL(r.second.offset(), 33);
+    e = utf_iterator(s, 36);
+    TRY(r = str_search(b, e, t));
+    TEST_EQUAL(r.first.offset(), 12);
+    TEST_EQUAL(r.second.offset(), 36);
+
+    TEST_EQUAL(str_replace(s, "abaabaaab€", "x"), Ustring(200, 'x') + "abaabaaabaabaaab∈");
+    TEST_EQUAL(str_splitv_at(s, "aaab€").size(), 201u);
+
+}
+
+void test_unicorn_string_algorithm_search_icase() {
+
+    Ustring s = "Straße, STRASSE, strasse, \u1e9e, \u212a k K, ΣΑΣ ς";
+    Irange<Utf8Iterator> r;
+    std::vector<Irange<Utf8Iterator>> v;
+
+    auto offsets = [] (const std::vector<Irange<Utf8Iterator>>& list) {
+        Ustring out;
+        for (auto& m: list)
+            out += "[" + std::to_string(m.first.offset()) + "," + std::to_string(m.second.offset()) + "]";
+        return out;
+    };
+
+    TRY(r = str_search_icase(s, ""));         TEST_EQUAL(r.first.offset(), 0);   TEST_EQUAL(r.second.offset(), 0);
+    TRY(r = str_search_icase(s, "xyz"));      TEST_EQUAL(r.first.offset(), 50);  TEST_EQUAL(r.second.offset(), 50);
+    TRY(r = str_search_icase(s, "STRASSE"));  TEST_EQUAL(r.first.offset(), 0);   TEST_EQUAL(r.second.offset(), 7);
+    TRY(r = str_search_icase(s, "sse"));      TEST_EQUAL(r.first.offset(), 4);   TEST_EQUAL(r.second.offset(), 7);
+    TRY(r = str_search_icase(s, "ΑΣ Σ"));     TEST_EQUAL(r.first.offset(), 43);  TEST_EQUAL(r.second.offset(), 50);
+    TRY(r = str_search_icase(utf_iterator(s, 1), utf_end(s), "straße"));
+    TEST_EQUAL(r.first.offset(), 9);
+    TEST_EQUAL(r.second.offset(), 16);
+    TRY(r = str_search_icase(utf_range(s), "\u1e9e"));
+    TEST_EQUAL(r.first.offset(), 4);
+    TEST_EQUAL(r.second.offset(), 6);
+
+    TRY(v = str_search_all_icase(s, ""));        TEST_EQUAL(offsets(v), "");
+    TRY(v = str_search_all_icase(s, "xyz"));     TEST_EQUAL(offsets(v), "");
+    TRY(v = str_search_all_icase(s, "straße"));  TEST_EQUAL(offsets(v), "[0,7][9,16][18,25]");
+    TRY(v = str_search_all_icase(s, "ss"));      TEST_EQUAL(offsets(v), "[4,6][13,15][22,24][27,30]");
+    TRY(v = str_search_all_icase(s, "s"));       TEST_EQUAL(offsets(v), "[0,1][9,10][13,14][14,15][18,19][22,23][23,24]");
+    TRY(v = str_search_all_icase(s, "k"));       TEST_EQUAL(offsets(v), "[32,35][36,37][38,39]");
+    TRY(v = str_search_all_icase(s, "σ"));       TEST_EQUAL(offsets(v), "[41,43][45,47][48,50]");
+    TRY(v = str_search_all_icase(utf_iterator(s, 9), utf_iterator(s, 30), "STRASSE"));
+    TEST_EQUAL(offsets(v), "[9,16][18,25]");
+
+}
+
 void test_unicorn_string_algorithm_skipws() {
 
     Ustring s;
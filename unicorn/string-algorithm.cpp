@@ -1,8 +1,207 @@
 #include "unicorn/string.hpp"
 #include <algorithm>
+#include <array>
+#include <cstring>
 
 namespace RS::Unicorn {
 
+    namespace {
+
+        constexpr size_t min_two_way_target = 8;
+
+        // Two-way string matching (Crochemore & Perrin 1991), combined with
+        // a bad character shift on the last byte of the target, as used in
+        // several C library implementations of memmem(); linear time in the
+        // worst case, and usually sublinear
+
+        size_t two_way_search(const uint8_t* str, size_t size, const uint8_t* target, size_t tsize) noexcept {
+
+            uint64_t byteset[4] = {0, 0, 0, 0};
+            size_t shift[256] = {};
+            for (size_t i = 0; i < tsize; ++i) {
+                byteset[target[i] >> 6] |= uint64_t(1) << (target[i] & 63);
+                shift[target[i]] = i + 1;
+            }
+
+            // Critical factorization: the longer of the maximal suffixes
+            // under the two byte orderings
+
+            auto maximal_suffix = [target, tsize] (bool reverse, size_t& period) {
+                size_t ip = npos, jp = 0, k = 1;
+                period = 1;
+                while (jp + k < tsize) {
+                    uint8_t a = target[ip + k], b = target[jp + k];
+                    if (a == b) {
+                        if (k == period) {
+                            jp += period;
+                            k = 1;
+                        } else {
+                            ++k;
+                        }
+                    } else if ((a > b) != reverse) {
+                        jp += k;
+                        k = 1;
+                        period = jp - ip;
+                    } else {
+                        ip = jp++;
+                        k = period = 1;
+                    }
+                }
+                return ip;
+            };
+
+            size_t p1 = 0, p2 = 0;
+            size_t ms1 = maximal_suffix(false, p1), ms2 = maximal_suffix(true, p2);
+            size_t ms = ms1, period = p1;
+            if (ms2 + 1 > ms1 + 1) {
+                ms = ms2;
+                period = p2;
+            }
+
+            size_t mem0 = 0;
+            if (std::memcmp(target, target + period, ms + 1) == 0)
+                mem0 = tsize - period;
+            else
+                period = std::max(ms, tsize - ms - 1) + 1;
+
+            size_t pos = 0, mem = 0, k = 0;
+            while (size - pos >= tsize) {
+                const uint8_t* s = str + pos;
+                uint8_t last = s[tsize - 1];
+                if ((byteset[last >> 6] & (uint64_t(1) << (last & 63))) == 0) {
+                    pos += tsize;
+                    mem = 0;
+                    continue;
+                }
+                k = tsize - shift[last];
+                if (k != 0) {
+                    pos += std::max(k, mem);
+                    mem = 0;
+                    continue;
+                }
+                for (k = std::max(ms + 1, mem); k < tsize && target[k] == s[k]; ++k) {}
+                if (k < tsize) {
+                    pos += k - ms;
+                    mem = 0;
+                    continue;
+                }
+                for (k = ms + 1; k > mem && target[k - 1] == s[k - 1]; --k) {}
+                if (k <= mem)
+                    return pos;
+                pos += period;
+                mem = mem0;
+            }
+
+            return npos;
+
+        }
+
+        // Case insensitive search: the target is case folded once, then
+        // compared against the subject one character at a time, folding each
+        // character as it is read, so no copy of the subject is needed
+
+        struct IcaseTarget {
+            std::u32string chars;
+            std::array<bool, 256> starts = {};
+        };
+
+        IcaseTarget make_icase_target(const Ustring& target) {
+            IcaseTarget t;
+            char32_t buf[max_case_decomposition];
+            for (char32_t c: utf_range(target))
+                t.chars.append(buf, char_to_full_casefold(c, buf));
+            if (t.chars.empty())
+                return t;
+            // An ASCII character only matches itself in either case, but
+            // some non-ASCII characters fold to strings that start with an
+            // ASCII letter (e.g. U+212A Kelvin sign), so any multibyte
+            // character has to be checked
+            char32_t first = t.chars[0];
+            if (first <= last_ascii_char) {
+                t.starts[first] = true;
+                t.starts[uint8_t(ascii_toupper(char(first)))] = true;
+            }
+            for (size_t b = 0xc0; b < 0x100; ++b)
+                t.starts[b] = true;
+            return t;
+        }
+
+        size_t match_icase(const char* str, size_t pos, size_t end, const std::u32string& target) noexcept {
+            char32_t buf[max_case_decomposition];
+            for (size_t k = 0; k < target.size();) {
+                if (pos == end)
+                    return npos;
+                auto b = uint8_t(str[pos]);
+                if (b <= last_ascii_char) {
+                    if (char32_t(ascii_tolower(char(b))) != target[k])
+                        return npos;
+                    ++k;
+                    ++pos;
+                } else {
+                    char32_t c = 0;
+                    pos += UnicornDetail::UtfEncoding<char>::decode(str + pos, end - pos, c);
+                    size_t n = char_to_full_casefold(c, buf);
+                    if (n > target.size() - k || ! std::equal(buf, buf + n, target.begin() + k))
+                        return npos;
+                    k += n;
+                }
+            }
+            return pos;
+        }
+
+        size_t find_icase(const Ustring& str, const IcaseTarget& target, size_t pos, size_t end, size_t& match_end) noexcept {
+            auto data = str.data();
+            for (; pos < end; ++pos) {
+                if (target.starts[uint8_t(data[pos])]) {
+                    match_end = match_icase(data, pos, end, target.chars);
+                    if (match_end != npos)
+                        return pos;
+                }
+            }
+            return npos;
+        }
+
+    }
+
+    namespace UnicornDetail {
+
+        size_t find_substring(std::string_view str, std::string_view target, size_t pos, size_t end) noexcept {
+            // Because UTF-8 is self-synchronizing, a byte level match of a
+            // valid target always starts and ends on character boundaries
+            end = std::min(end, str.size());
+            size_t tsize = target.size();
+            if (pos > end || end - pos < tsize)
+                return npos;
+            if (tsize == 0)
+                return pos;
+            auto base = str.data();
+            if (tsize == 1) {
+                auto p = static_cast<const char*>(std::memchr(base + pos, target[0], end - pos));
+                return p ? p - base : npos;
+            }
+            if (tsize < min_two_way_target) {
+                // Short targets: scan for the first byte, then check the
+                // last byte before comparing the rest
+                char first = target[0], last = target[tsize - 1];
+                size_t limit = end - tsize + 1;
+                while (pos < limit) {
+                    auto p = static_cast<const char*>(std::memchr(base + pos, first, limit - pos));
+                    if (! p)
+                        return npos;
+                    pos = p - base;
+                    if (p[tsize - 1] == last && std::memcmp(p + 1, target.data() + 1, tsize - 2) == 0)
+                        return pos;
+                    ++pos;
+                }
+                return npos;
+            }
+            size_t n = two_way_search(reinterpret_cast<const uint8_t*>(base + pos), end - pos,
+                reinterpret_cast<const uint8_t*>(target.data()), tsize);
+            return n == npos ? npos : pos + n;
+        }
+
+    }
+
     size_t str_common(const Ustring& s1, const Ustring& s2, size_t start) noexcept {
         if (start >= s1.size() || start >= s2.size())
             return 0;
@@ -46,7 +245,7 @@ namespace RS::Unicorn {
     }
 
     Utf8Iterator str_find_char(const Ustring& str, char32_t c) {
-        return utf_iterator(str, str.find(str_char(c)));
+        return utf_iterator(str, UnicornDetail::find_substring(str, str_char(c)));
     }
 
     Utf8Iterator str_find_last_char(const Utf8Iterator& b, const Utf8Iterator& e, char32_t c) {
@@ -168,11 +367,10 @@ namespace RS::Unicorn {
     }
 
     Irange<Utf8Iterator> str_search(const Utf8Iterator& b, const Utf8Iterator& e, const Ustring& target) {
-        auto u_target = to_utf32(target);
-        auto ub = u_target.begin(), ue = u_target.end();
-        auto i = std::search(b, e, ub, ue);
-        if (i == e)
-            return {i, i};
+        size_t pos = UnicornDetail::find_substring(b.source(), target, b.offset(), e.offset());
+        if (pos == npos)
+            return {e, e};
+        auto i = b.offset_by(pos - b.offset());
         auto j = i.offset_by(target.size());
         return {i, j};
     }
@@ -185,6 +383,48 @@ namespace RS::Unicorn {
         return str_search(utf_begin(str), utf_end(str), target);
     }
 
+    Irange<Utf8Iterator> str_search_icase(const Utf8Iterator& b, const Utf8Iterator& e, const Ustring& target) {
+        auto t = make_icase_target(target);
+        if (t.chars.empty())
+            return {b, b};
+        size_t match_end = 0;
+        size_t pos = find_icase(b.source(), t, b.offset(), e.offset(), match_end);
+        if (pos == npos)
+            return {e, e};
+        auto i = b.offset_by(pos - b.offset());
+        auto j = i.offset_by(match_end - pos);
+        return {i, j};
+    }
+
+    Irange<Utf8Iterator> str_search_icase(const Irange<Utf8Iterator>& range, const Ustring& target) {
+        return str_search_icase(range.begin(), range.end(), target);
+    }
+
+    Irange<Utf8Iterator> str_search_icase(const Ustring& str, const Ustring& target) {
+        return str_search_icase(utf_begin(str), utf_end(str), target);
+    }
+
+    std::vector<Irange<Utf8Iterator>> str_search_all_icase(const Utf8Iterator& b, const Utf8Iterator& e, const Ustring& target) {
+        std::vector<Irange<Utf8Iterator>> matches;
+        auto t = make_icase_target(target);
+        if (t.chars.empty())
+            return matches;
+        size_t match_end = 0;
+        for (size_t pos = b.offset(); (pos = find_icase(b.source(), t, pos, e.offset(), match_end)) != npos; pos = match_end) {
+            auto i = b.offset_by(pos - b.offset());
+            matches.push_back({i, i.offset_by(match_end - pos)});
+        }
+        return matches;
+    }
+
+    std::vector<Irange<Utf8Iterator>> str_search_all_icase(const Irange<Utf8Iterator>& range, const Ustring& target) {
+        return str_search_all_icase(range.begin(), range.end(), target);
+    }
+
+    std::vector<Irange<Utf8Iterator>> str_search_all_icase(const Ustring& str, const Ustring& target) {
+        return str_search_all_icase(utf_begin(str), utf_end(str), target);
+    }
+
     size_t str_skipws(Utf8Iterator& i, const Utf8Iterator& end) {
         size_t n = 0;
         for (; i != end && char_is_white_space(*i); ++i, ++n) {}
@@ -120,3 +120,68 @@ void test_unicorn_string_case_conversions() {
     s = "ǆǆǆ ǆǆǆ";        TRY(str_initial_titlecase_in(s));  TEST_EQUAL(s, "ǅǆǆ ǆǆǆ");
 
 }
+
+void test_unicorn_string_case_fast_paths() {
+
+    // Mixed ASCII and non-ASCII text, compared with a character by
+    // character mapping
+
+    auto reference = [] (const Ustring& src, size_t (*f)(char32_t, char32_t*)) {
+        std::u32string dst;
+        char32_t buf[max_case_decomposition];
+        for (char32_t c: utf_range(src))
+            dst.append(buf, f(c, buf));
+        return to_utf8(dst);
+    };
+
+    Strings samples = {
+        "Hello World",
+        "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG. the quick brown fox jumps over the lazy dog.",
+        "Content-Type: text/html; charset=UTF-8\r\nX-Forwarded-For: 10.0.0.1",
+        "Grüße aus Köln, ÅNGSTRÖM und straße",
+        "Ǆemal ǅemal ǆemal ŉ ǰ ΐ ﬀ ﬃ",
+        "abc\u0130def \u1e9e XYZ \u0149",
+        "ÀÁÂÃÄÅ àáâãäå ΑΒΓΔ αβγδ АБВГ абвг",
+    };
+
+    for (auto& src: samples) {
+        Ustring s;
+        TEST_EQUAL(str_uppercase(src), reference(src, char_to_full_uppercase));
+        TEST_EQUAL(str_casefold(src), reference(src, char_to_full_casefold));
+        s = src;  TRY(str_uppercase_in(s));  TEST_EQUAL(s, str_uppercase(src));
+        s = src;  TRY(str_lowercase_in(s));  TEST_EQUAL(s, str_lowercase(src));
+        s = src;  TRY(str_casefold_in(s));   TEST_EQUAL(s, str_casefold(src));
+    }
+
+    TEST_EQUAL(str_lowercase("ABC ΑΣ DEF"s), "abc ας def");
+    TEST_EQUAL(str_lowercase("ABCΣ"s), "abcς");
+    TEST_EQUAL(str_lowercase("Σ ABC"s), "σ abc");
+    TEST_EQUAL(str_lowercase("ABC'Σ."s), "abc'ς.");
+    TEST_EQUAL(str_lowercase("ΑΣ'ABC"s), "ασ'abc");
+    TEST_EQUAL(str_lowercase("Α.Σ"s), "α.ς");
+    TEST_EQUAL(str_lowercase("1Σ"s), "1σ");
+    TEST_EQUAL(str_lowercase("ÉΣ'"s), "éς'");
+
+    Ustring s;
+    s = "ABC STRASSE ÄÖÜ";  TRY(str_lowercase_in(s));  TEST_EQUAL(s, "abc strasse äöü");
+    s = "abc straße äöü";   TRY(str_uppercase_in(s));  TEST_EQUAL(s, "ABC STRASSE ÄÖÜ");
+    s = "ΑΣ'ABC ΟΔΟΣ";      TRY(str_lowercase_in(s));  TEST_EQUAL(s, "ασ'abc οδος");
+    s = "ıi";               TRY(str_uppercase_in(s));  TEST_EQUAL(s, "II");
+
+    Ustring big = str_repeat("Hello World ", 10'000) + "ß" + str_repeat(" The End", 1'000);
+    TEST_EQUAL(str_uppercase(big), reference(big, char_to_full_uppercase));
+    TEST_EQUAL(str_casefold(big), reference(big, char_to_full_casefold));
+    s = big;
+    TRY(str_uppercase_in(s));
+    TEST_EQUAL(s, str_uppercase(big));
+
+    // The ASCII fast path for lowercase assumes these are the only
+    // case-ignorable ASCII characters
+
+    Ustring ignorable;
+    for (char32_t c = 0; c < 128; ++c)
+        if (char_is_case_ignorable(c))
+            ignorable += char(c);
+    TEST_EQUAL(ignorable, "'.:^`");
+
+}
@@ -1,22 +1,11 @@
 #include "unicorn/string.hpp"
 #include <algorithm>
+#include <cstring>
 
 namespace RS::Unicorn {
 
     namespace {
 
-        template <typename F>
-        const Ustring casemap_helper(const Ustring& src, F f) {
-            Ustring dst;
-            char32_t buf[max_case_decomposition];
-            auto out = utf_writer(dst);
-            for (auto c: utf_range(src)) {
-                auto n = f(c, buf);
-                std::copy_n(buf, n, out);
-            }
-            return dst;
-        }
-
         template <typename FwdIter>
         bool next_cased(FwdIter i, FwdIter e) {
             if (i == e)
@@ -33,29 +22,189 @@ namespace RS::Unicorn {
             bool last_cased = false;
             char32_t buf[max_case_decomposition];
             template <typename FwdIter, typename OutIter> void convert(FwdIter i, FwdIter e, OutIter to) {
+                auto n = map(i, e);
+                std::copy_n(buf, n, to);
+            }
+            template <typename FwdIter> size_t map(FwdIter i, FwdIter e) {
                 auto n = char_to_full_lowercase(*i, buf);
                 if (buf[0] == sigma && last_cased && ! next_cased(i, e))
                     buf[0] = final_sigma;
-                std::copy_n(buf, n, to);
                 if (! char_is_case_ignorable(*i))
                     last_cased = char_is_cased(*i);
+                return n;
             }
         };
 
+        // Case mapping policies for casemap_helper(). Each one converts
+        // ASCII letters in bulk (skipping any non-ASCII bytes), and maps one
+        // non-ASCII character at a time into buf. Lowercase mapping needs
+        // to know whether the last non-case-ignorable character was cased
+        // (for final sigma); the only case-ignorable ASCII characters are
+        // ' . : ^ `.
+
+        constexpr bool is_ascii_case_ignorable(char c) noexcept {
+            return c == '\'' || c == '.' || c == ':' || c == '^' || c == '`';
+        }
+
+        struct UpperMap {
+            char32_t buf[max_case_decomposition];
+            void ascii(char* ptr, size_t len) noexcept { RS_Detail::ascii_uppercase_block(ptr, len); }
+            template <typename FwdIter> size_t map(FwdIter i, FwdIter /*e*/) { return char_to_full_uppercase(*i, buf); }
+        };
+
+        struct LowerMap: LowerChar {
+            void ascii(char* ptr, size_t len) noexcept {
+                RS_Detail::ascii_lowercase_block(ptr, len);
+                for (size_t i = len; i > 0 && is_ascii(ptr[i - 1]); --i) {
+                    if (! is_ascii_case_ignorable(ptr[i - 1])) {
+                        last_cased = ascii_isalpha(ptr[i - 1]);
+                        break;
+                    }
+                }
+            }
+        };
+
+        struct FoldMap {
+            char32_t buf[max_case_decomposition];
+            void ascii(char* ptr, size_t len) noexcept { RS_Detail::ascii_lowercase_block(ptr, len); }
+            template <typename FwdIter> size_t map(FwdIter i, FwdIter /*e*/) { return char_to_full_casefold(*i, buf); }
+        };
+
+        // Apply a case mapping to src[pos,end), appending the result to dst.
+        // ASCII runs, and runs of characters that map to themselves, are
+        // copied in bulk (ASCII letters are then converted in place); only
+        // characters that actually change are decoded and re-encoded.
+
+        template <typename Map>
+        void casemap_append(const Ustring& src, size_t pos, Ustring& dst, Map& m) {
+            size_t n = src.size(), plain = pos;
+            auto copy_plain = [&] (size_t to) {
+                if (to == plain)
+                    return;
+                size_t base = dst.size();
+                dst.append(src, plain, to - plain);
+                m.ascii(dst.data() + base, to - plain);
+            };
+            auto e = utf_end(src);
+            while (pos < n) {
+                size_t run = ascii_run_length(src.data() + pos, n - pos);
+                if (run > 0) {
+                    // Keep the ASCII run in the pending span; the mapping
+                    // only needs to see it if a changed character follows.
+                    if (pos + run == n)
+                        break;
+                    pos += run;
+                    copy_plain(pos);
+                    plain = pos;
+                }
+                auto i = utf_iterator(src, pos);
+                size_t len = i.count();
+                auto k = m.map(i, e);
+                if (! i.valid() || k != 1 || m.buf[0] != *i) {
+                    copy_plain(pos);
+                    auto out = utf_writer(dst);
+                    std::copy_n(m.buf, k, out);
+                    plain = pos + len;
+                }
+                pos += len;
+            }
+            copy_plain(n);
+        }
+
+        template <typename Map>
+        Ustring casemap_helper(const Ustring& src) {
+            Ustring dst;
+            dst.reserve(src.size());
+            Map m;
+            casemap_append(src, 0, dst, m);
+            return dst;
+        }
+
+        // Total encoded length of the mapping of src[pos,end), used to size
+        // the new string when an in-place mapping has to grow. The context
+        // used for final sigma does not affect the length, so ASCII runs are
+        // only counted, not mapped.
+
+        template <typename Map>
+        size_t casemap_length(const Ustring& src, size_t pos, Map m) {
+            size_t n = src.size(), size = 0;
+            auto e = utf_end(src);
+            while (pos < n) {
+                size_t run = ascii_run_length(src.data() + pos, n - pos);
+                size += run;
+                pos += run;
+                if (pos == n)
+                    break;
+                auto i = utf_iterator(src, pos);
+                auto k = m.map(i, e);
+                for (size_t j = 0; j < k; ++j)
+                    size += code_units<char>(m.buf[j]);
+                pos += i.count();
+            }
+            return size;
+        }
+
+        // Map in place, compacting the string when a mapping is shorter
+        // than the original character. If a mapping would overwrite input
+        // that has not been read yet, the length of the rest of the result
+        // is counted and the remainder is written to a new string reserved
+        // to exactly the right size.
+
+        template <typename Map>
+        void casemap_in_helper(Ustring& str) {
+            Map m;
+            size_t n = str.size(), pos = 0, out = 0;
+            auto e = utf_end(str);
+            char buf[4 * max_case_decomposition];
+            while (pos < n) {
+                size_t run = ascii_run_length(str.data() + pos, n - pos);
+                if (run > 0) {
+                    if (out != pos)
+                        std::memmove(str.data() + out, str.data() + pos, run);
+                    m.ascii(str.data() + out, run);
+                    pos += run;
+                    out += run;
+                    if (pos == n)
+                        break;
+                }
+                auto i = utf_iterator(str, pos);
+                size_t len = i.count();
+                char32_t c = *i;
+                auto k = m.map(i, e);
+                if (i.valid() && k == 1 && m.buf[0] == c) {
+                    if (out != pos)
+                        std::memmove(str.data() + out, str.data() + pos, len);
+                    pos += len;
+                    out += len;
+                    continue;
+                }
+                size_t bytes = 0;
+                for (size_t j = 0; j < k; ++j)
+                    bytes += UnicornDetail::UtfEncoding<char>::encode(m.buf[j], buf + bytes);
+                pos += len;
+                if (out + bytes > pos) {
+                    Ustring dst;
+                    dst.reserve(out + bytes + casemap_length(str, pos, m));
+                    dst.append(str, 0, out);
+                    dst.append(buf, bytes);
+                    casemap_append(str, pos, dst, m);
+                    str.swap(dst);
+                    return;
+                }
+                std::memcpy(str.data() + out, buf, bytes);
+                out += bytes;
+            }
+            str.resize(out);
+        }
+
     }
 
     Ustring str_uppercase(const Ustring& str) {
-        return casemap_helper(str, char_to_full_uppercase);
+        return casemap_helper<UpperMap>(str);
     }
 
     Ustring str_lowercase(const Ustring& str) {
-        Ustring dst;
-        LowerChar lc;
-        auto range = utf_range(str);
-        auto out = utf_writer(dst);
-        for (auto i = range.begin(), e = range.end(); i != e; ++i)
-            lc.convert(i, e, out);
-        return dst;
+        return casemap_helper<LowerMap>(str);
     }
 
     Ustring str_titlecase(const Ustring& str) {
@@ -80,7 +229,7 @@ namespace RS::Unicorn {
     }
 
     Ustring str_casefold(const Ustring& str) {
-        return casemap_helper(str, char_to_full_casefold);
+        return casemap_helper<FoldMap>(str);
     }
 
     Ustring str_case(const Ustring& str, Case c) {
@@ -106,13 +255,11 @@ namespace RS::Unicorn {
     }
 
     void str_uppercase_in(Ustring& str) {
-        auto result = str_uppercase(str);
-        str = std::move(result);
+        casemap_in_helper<UpperMap>(str);
     }
 
     void str_lowercase_in(Ustring& str) {
-        auto result = str_lowercase(str);
-        str = std::move(result);
+        casemap_in_helper<LowerMap>(str);
     }
 
     void str_titlecase_in(Ustring& str) {
@@ -121,18 +268,28 @@ namespace RS::Unicorn {
     }
 
     void str_casefold_in(Ustring& str) {
-        auto result = str_casefold(str);
-        str = std::move(result);
+        casemap_in_helper<FoldMap>(str);
     }
 
     void str_case_in(Ustring& str, Case c) {
-        auto result = str_case(str, c);
-        str = std::move(result);
+        switch (c) {
+            case Case::fold:   str_casefold_in(str); break;
+            case Case::lower:  str_lowercase_in(str); break;
+            case Case::title:  str_titlecase_in(str); break;
+            case Case::upper:  str_uppercase_in(str); break;
+            default:           break;
+        }
     }
 
     void str_initial_titlecase_in(Ustring& str) {
-        auto result = str_initial_titlecase(str);
-        str = std::move(result);
+        if (str.empty())
+            return;
+        auto i = utf_begin(str);
+        char32_t buf[max_case_decomposition];
+        size_t n = char_to_full_titlecase(*i, buf);
+        Ustring initial;
+        recode(buf, n, initial);
+        str.replace(0, i.count(), initial);
     }
 
 }
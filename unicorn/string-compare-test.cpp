@@ -168,6 +168,49 @@ void test_unicorn_string_compare_icase() {
 
 }
 
+void test_unicorn_string_compare_icase_consistency() {
+
+    // The fast paths must agree with comparing the case folded strings
+
+    Strings samples = {
+        "", "a", "A", "b", "B", "z", "Z", "[", "_", "`", "{",
+        "hello", "Hello", "HELLO", "hello world", "HELLO WORLD", "hello!world",
+        "straße", "STRASSE", "strasse", "Straßen", "straßf",
+        "\u212a", "k", "K", "kelvin", "\u212aELVIN",
+        "ﬃ", "ffi", "FFI", "ﬃx", "ffy",
+        "é", "è", "É", "ée", "ÉE", "e\u0301",
+        "Σ", "σ", "ς", "ΣΑΣ", "σας",
+        "ǅ", "ǆ", "Ǆ", "\U00010400", "\U00010428",
+        "abc\u00e9", "abc\u00e8", "ABC\u00c9x",
+    };
+    StringCompare<Strcmp::triple | Strcmp::icase> cmp;
+    StringCompare<Strcmp::triple> basic;
+
+    for (auto& a: samples) {
+        for (auto& b: samples) {
+            int expect = basic(str_casefold(a), str_casefold(b));
+            TEST_EQUAL(cmp(a, b), expect);
+            TEST_EQUAL(CasefoldKey(a).compare(CasefoldKey(b)), expect);
+            TEST_EQUAL(CasefoldKey(a) == CasefoldKey(b), expect == 0);
+            TEST_EQUAL(CasefoldKey(a) < CasefoldKey(b), expect == -1);
+        }
+    }
+
+    Strings words = {"banana", "Apple", "cherry", "APPLE", "Banana", "apple", "straße", "STRASSE"};
+    std::vector<CasefoldKey> keys;
+    for (auto& w: words)
+        keys.emplace_back(w);
+    std::stable_sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    Strings sorted;
+    for (auto& k: keys)
+        sorted.push_back(k.str());
+    TEST_EQUAL(to_str(sorted), "[Apple,banana,cherry,straße]");
+    TEST_EQUAL(keys[3].key(), "strasse");
+    TEST_EQUAL(std::hash<CasefoldKey>()(CasefoldKey("STRASSE"s)), std::hash<CasefoldKey>()(CasefoldKey("Straße"s)));
+
+}
+
 void test_unicorn_string_compare_natural() {
 
     StringCompare<Strcmp::equal | Strcmp::natural> cmp_en;
@@ -235,3 +278,48 @@ void test_unicorn_string_compare_natural() {
     TEST_EQUAL(cmp_tn("+abc 123", "abc 123"), -1);           TEST_EQUAL(cmp_tnf("+abc 123", "abc 123"), -1);
 
 }
+
+void test_unicorn_string_compare_natural_sort_key() {
+
+    Strings samples = {
+        "", "0", "00", "1", "01", "9", "10", "000123", "123", "45", "256", "1000000000000000000000",
+        "a", "A", "abc", "ABC", "abc 123", "ABC 123", "abc 45", "abc 000123", "abc123", "abc 123 456",
+        "abc 123 something", "+abc 123", "abc-123", "abc - 123", "...", "!", "x1y2", "x01y2", "x1y02",
+        "straße 2", "STRASSE 10", "é1", "É01", "é", "αβγ 7", "ΑΒΓ 07", "\U00010400 5",
+    };
+    StringCompare<Strcmp::triple | Strcmp::natural> cmp;
+    StringCompare<Strcmp::triple | Strcmp::natural | Strcmp::fallback> cmp_f;
+
+    for (auto& a: samples) {
+        Ustring ka = natural_sort_key(a), kaf = natural_sort_key(a, Strcmp::fallback);
+        for (auto& b: samples) {
+            Ustring kb = natural_sort_key(b), kbf = natural_sort_key(b, Strcmp::fallback);
+            int c = ka.compare(kb), cf = kaf.compare(kbf);
+            TEST_EQUAL(c < 0 ? -1 : c == 0 ? 0 : 1, cmp(a, b));
+            TEST_EQUAL(cf < 0 ? -1 : cf == 0 ? 0 : 1, cmp_f(a, b));
+        }
+    }
+
+    Strings list = {"file10", "File2", "file1", "file02", "FILE1", "file 1a"};
+    TRY(str_sort_natural(list));
+    TEST_EQUAL(to_str(list), "[file1,FILE1,file 1a,File2,file02,file10]");
+    TRY(str_sort_natural(list, Strcmp::fallback));
+    TEST_EQUAL(to_str(list), "[FILE1,file1,file 1a,File2,file02,file10]");
+
+    Strings big, expect;
+    for (size_t i = 0; i < 50'000; ++i)
+        big.push_back(samples[(i * 7919) % samples.size()] + std::to_string((i * 104729) % 1000));
+    expect = big;
+    StringCompare<Strcmp::less | Strcmp::natural> less;
+    std::stable_sort(expect.begin(), expect.end(), less);
+    Strings list1 = big, list2 = big, list3 = big;
+    TRY(str_sort_natural(list1, 0, 1));
+    TRY(str_sort_natural(list2, 0, 4));
+    TRY(str_sort_natural(list3, 0, 0));
+    TEST(list1 == expect);
+    TEST(list2 == expect);
+    TEST(list3 == expect);
+    TRY(str_sort_by_key(list1, str_casefold, 3));
+    TEST(std::is_sorted(list1.begin(), list1.end(), StringCompare<Strcmp::less | Strcmp::icase>()));
+
+}
@@ -1,5 +1,7 @@
 #include "unicorn/string.hpp"
 #include <algorithm>
+#include <future>
+#include <thread>
 
 namespace RS::Unicorn {
 
@@ -78,6 +80,53 @@ namespace RS::Unicorn {
             Utf8Iterator end;
         };
 
+        // Natural sort keys encode each segment as a tag byte followed by
+        // its content. Number segments (tag 1) sort before text segments
+        // (tag 2), and are encoded as the length of the digit string
+        // (excluding leading zeros) in big endian form, preceded by the
+        // number of bytes in the length, followed by the digits. Text
+        // segments are encoded as the case folded significant characters,
+        // terminated by a null byte, which never occurs in the content.
+        // The end of the key sorts before any tag byte, so a key that runs
+        // out of segments sorts first.
+
+        constexpr char natural_number_tag = '\x01';
+        constexpr char natural_text_tag = '\x02';
+        constexpr size_t min_parallel_sort = 4096;
+
+        void append_natural_number(const Ustring& src, size_t begin, size_t end, Ustring& key) {
+            while (begin < end && src[begin] == '0')
+                ++begin;
+            size_t len = end - begin, bytes = 0;
+            for (size_t n = len; n != 0; n >>= 8)
+                ++bytes;
+            key += natural_number_tag;
+            key += char(bytes);
+            for (size_t i = bytes; i > 0; --i)
+                key += char((len >> (8 * (i - 1))) & 0xff);
+            key.append(src, begin, len);
+        }
+
+        size_t append_natural_text(const Ustring& src, size_t pos, Ustring& key) {
+            char32_t buf[max_case_decomposition];
+            key += natural_text_tag;
+            auto i = utf_iterator(src, pos), e = utf_end(src);
+            for (; i != e; ++i) {
+                char32_t c = *i;
+                if (char_is_ascii_digit(c))
+                    break;
+                if (c < 0x80 && ascii_isalpha(char(c))) {
+                    key += ascii_tolower(char(c));
+                } else if (char_is_significant(c)) {
+                    size_t n = char_to_full_casefold(c, buf);
+                    for (size_t j = 0; j < n; ++j)
+                        str_append_char(key, buf[j]);
+                }
+            }
+            key += '\0';
+            return i.offset();
+        }
+
     }
 
     namespace UnicornDetail {
@@ -91,29 +140,45 @@ namespace RS::Unicorn {
         }
 
         int do_compare_icase(const Ustring& lhs, const Ustring& rhs) {
-            if (lhs.empty() || rhs.empty())
-                return ! rhs.empty() ? -1 : ! lhs.empty() ? 1 : 0;
-            auto u1 = utf_range(lhs), u2 = utf_range(rhs);
-            auto i1 = u1.begin(), i2 = u2.begin();
+            // Skip any identical prefix, backing up to the start of the
+            // character containing the first difference. If one string is
+            // a prefix of the other, the shorter one is less, because no
+            // character case folds to an empty string.
+            size_t n1 = lhs.size(), n2 = rhs.size();
+            size_t i1 = std::mismatch(lhs.begin(), lhs.begin() + std::min(n1, n2), rhs.begin()).first - lhs.begin();
+            if (i1 == n1 || i1 == n2)
+                return n1 < n2 ? -1 : n1 == n2 ? 0 : 1;
+            while (i1 > 0 && (is_nonstart_unit(lhs[i1]) || is_nonstart_unit(rhs[i1])))
+                --i1;
+            size_t i2 = i1;
             char32_t buf1[max_case_decomposition], buf2[max_case_decomposition];
-            size_t p1 = 0, p2 = 0;
-            size_t n1 = char_to_full_casefold(*i1, buf1);
-            size_t n2 = char_to_full_casefold(*i2, buf2);
+            size_t p1 = 0, p2 = 0, m1 = 0, m2 = 0;
             for (;;) {
-                if (p1 == n1) {
+                if (p1 == m1 && p2 == m2) {
+                    // ASCII case folding is just lower casing
+                    for (; i1 < n1 && i2 < n2 && is_ascii(lhs[i1]) && is_ascii(rhs[i2]); ++i1, ++i2) {
+                        char c1 = ascii_tolower(lhs[i1]), c2 = ascii_tolower(rhs[i2]);
+                        if (c1 != c2)
+                            return c1 < c2 ? -1 : 1;
+                    }
+                }
+                if (p1 == m1 && i1 < n1) {
+                    auto i = utf_iterator(lhs, i1);
+                    m1 = char_to_full_casefold(*i, buf1);
                     p1 = 0;
-                    if (++i1 != u1.end())
-                        n1 = char_to_full_casefold(*i1, buf1);
+                    i1 += i.count();
                 }
-                if (p2 == n2) {
+                if (p2 == m2 && i2 < n2) {
+                    auto i = utf_iterator(rhs, i2);
+                    m2 = char_to_full_casefold(*i, buf2);
                     p2 = 0;
-                    if (++i2 != u2.end())
-                        n2 = char_to_full_casefold(*i2, buf2);
+                    i2 += i.count();
                 }
-                if ((p1 == 0 && i1 == u1.end()) || (p2 == 0 && i2 == u2.end()))
-                    return i2 != u2.end() ? -1 : i1 != u1.end() ? 1 : 0;
+                bool end1 = p1 == m1, end2 = p2 == m2;
+                if (end1 || end2)
+                    return ! end2 ? -1 : ! end1 ? 1 : 0;
                 if (buf1[p1] != buf2[p2])
-                    return buf1[p1] < buf2[p2] ? -1 : buf1[p1] == buf2[p2] ? 0 : 1;
+                    return buf1[p1] < buf2[p2] ? -1 : 1;
                 ++p1;
                 ++p2;
             }
@@ -132,4 +197,86 @@ namespace RS::Unicorn {
 
     }
 
+    CasefoldKey::CasefoldKey(const Ustring& str):
+    orig(str), folded(str_casefold(str)) {}
+
+    CasefoldKey::CasefoldKey(Ustring&& str):
+    orig(std::move(str)), folded(str_casefold(orig)) {}
+
+    Ustring natural_sort_key(const Ustring& str, uint32_t flags) {
+        Ustring key;
+        key.reserve(str.size() + 4);
+        size_t i = 0, n = str.size();
+        while (i < n) {
+            if (ascii_isdigit(str[i])) {
+                size_t j = i;
+                while (j < n && ascii_isdigit(str[j]))
+                    ++j;
+                append_natural_number(str, i, j, key);
+                i = j;
+            } else {
+                i = append_natural_text(str, i, key);
+            }
+        }
+        if (flags & Strcmp::fallback) {
+            key += '\0';
+            key += str;
+        }
+        return key;
+    }
+
+    void str_sort_by_key(Strings& list, const SortKeyFunction& key, size_t threads) {
+        // Each chunk of the list has its keys generated and is sorted in
+        // its own thread, then adjacent chunks are merged in parallel until
+        // only one is left. Ties are broken by the original index, so the
+        // sort is stable.
+        using keyed_string = std::pair<Ustring, size_t>;
+        size_t n = list.size();
+        if (threads == 0)
+            threads = std::max(size_t(std::thread::hardware_concurrency()), size_t(1));
+        threads = std::max(std::min(threads, n / min_parallel_sort), size_t(1));
+        std::vector<keyed_string> keyed(n);
+        auto sort_chunk = [&list, &key, &keyed] (size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i)
+                keyed[i] = {key(list[i]), i};
+            std::sort(keyed.begin() + begin, keyed.begin() + end);
+        };
+        std::vector<size_t> bounds;
+        for (size_t i = 0; i < threads; ++i)
+            bounds.push_back(i * n / threads);
+        bounds.push_back(n);
+        if (threads == 1) {
+            sort_chunk(0, n);
+        } else {
+            std::vector<std::future<void>> results;
+            for (size_t i = 1; i < bounds.size(); ++i)
+                results.push_back(std::async(std::launch::async, sort_chunk, bounds[i - 1], bounds[i]));
+            for (auto& r: results)
+                r.get();
+            while (bounds.size() > 2) {
+                std::vector<size_t> merged = {0};
+                results.clear();
+                for (size_t i = 2; i < bounds.size(); i += 2) {
+                    auto begin = keyed.begin() + bounds[i - 2], mid = keyed.begin() + bounds[i - 1], end = keyed.begin() + bounds[i];
+                    results.push_back(std::async(std::launch::async, [begin, mid, end] { std::inplace_merge(begin, mid, end); }));
+                    merged.push_back(bounds[i]);
+                }
+                if (merged.back() != n)
+                    merged.push_back(n);
+                for (auto& r: results)
+                    r.get();
+                bounds.swap(merged);
+            }
+        }
+        Strings sorted;
+        sorted.reserve(n);
+        for (auto& k: keyed)
+            sorted.push_back(std::move(list[k.second]));
+        list.swap(sorted);
+    }
+
+    void str_sort_natural(Strings& list, uint32_t flags, size_t threads) {
+        str_sort_by_key(list, [flags] (const Ustring& s) { return natural_sort_key(s, flags); }, threads);
+    }
+
 }
@@ -52,6 +52,15 @@ void test_unicorn_string_manip_append() {
     t32 = U"§¶ ";     TRY(str_append(s, utf_range(t32)));  TEST_EQUAL(s, "Hello §¶ ");
     t32 = U"€urope";  TRY(str_append(s, utf_range(t32)));  TEST_EQUAL(s, "Hello §¶ €urope");
 
+    s.clear();
+    t16 = u"Hello §¶ €urope";
+    TRY(str_append(s, t16.data(), 9));      TEST_EQUAL(s, "Hello §¶ ");
+    TRY(str_append(s, t16.data() + 9, 6));  TEST_EQUAL(s, "Hello §¶ €urope");
+    s.clear();
+    TRY(str_append(s, utf32_example.data(), 3));  TEST_EQUAL(s, "\xd0\xb0\xe4\xba\x8c\xf0\x90\x8c\x82");
+    s.clear();
+    TRY(str_append(s, utf32_example.data(), utf32_example.size()));  TEST_EQUAL(s, utf8_example);
+
     s.clear();
     TRY(str_append_char(s, 'A'));  TEST_EQUAL(s, "A");
     TRY(str_append_char(s, 'B'));  TEST_EQUAL(s, "AB");
@@ -352,6 +361,25 @@ void test_unicorn_string_manip_concat() {
     TEST_EQUAL(str_concat_with("++", "Hello"), "Hello");
     TEST_EQUAL(str_concat_with("++", "Hello", "world"), "Hello++world");
     TEST_EQUAL(str_concat_with("++", "Hello", "world", "goodbye"), "Hello++world++goodbye");
+    TEST_EQUAL(str_concat_with(u"++"s, "Hello"s, u"world", U"goodbye"s), "Hello++world++goodbye");
+    TEST_EQUAL(str_concat_with(U"\u2014", "€uro", "∈lement"), "€uro\u2014∈lement");
+
+    Ustring s = "Log:";
+    const char* p = nullptr;
+    TRY(s.reserve(100));
+    TRY(p = s.data());
+    TRY(str_append_concat(s, " ", "Hello"s, u" world", U"!"s));
+    TEST_EQUAL(s, "Log: Hello world!");
+    TEST_EQUAL(s.data(), p);
+    TRY(str_append_concat(s));
+    TEST_EQUAL(s, "Log: Hello world!");
+    TRY(str_append_concat_with(s, ", "));
+    TEST_EQUAL(s, "Log: Hello world!");
+    TRY(str_append_concat_with(s, ", ", " a", u"b"s, U"c"));
+    TEST_EQUAL(s, "Log: Hello world! a, b, c");
+    TRY(str_append_concat_with(s, u"/"s, "d", "e"s));
+    TEST_EQUAL(s, "Log: Hello world! a, b, cd/e");
+    TEST_EQUAL(s.data(), p);
 
 }
 
@@ -121,6 +121,50 @@ void test_unicorn_string_manip_fix_right() {
 
 }
 
+void test_unicorn_string_manip_in_place() {
+
+    // Edits that cannot lengthen the string work in the existing buffer
+
+    Ustring s;
+    const char* p = nullptr;
+
+    s = "  Hello   \u2028 wörld  ";
+    p = s.data();
+    TRY(str_squeeze_trim_in(s));           TEST_EQUAL(s, "Hello wörld");     TEST(s.data() == p);
+    TRY(str_replace_in(s, "l", ""));       TEST_EQUAL(s, "Heo wörd");        TEST(s.data() == p);
+    TRY(str_replace_in(s, "ö", "o"));      TEST_EQUAL(s, "Heo word");        TEST(s.data() == p);
+    TRY(str_remove_in(s, "eo"));           TEST_EQUAL(s, "H wrd");           TEST(s.data() == p);
+    TRY(str_casefold_in(s));               TEST_EQUAL(s, "h wrd");           TEST(s.data() == p);
+
+    s = "\u212a\u1e9e \u212a\u1e9e \u212a\u1e9e \u212a\u1e9e";
+    p = s.data();
+    TRY(str_casefold_in(s));               TEST_EQUAL(s, "kss kss kss kss");  TEST(s.data() == p);
+
+    s = "Line one\r\nLine two\u2028Line three\u2029\u2029";
+    p = s.data();
+    TRY(str_unify_lines_in(s));            TEST_EQUAL(s, "Line one\nLine two\nLine three\n\n");  TEST(s.data() == p);
+
+    // Edits that lengthen the string, where the output would get ahead of
+    // the input
+
+    s = "a-b-c-d-e";
+    TRY(str_replace_in(s, "-", "<->"));    TEST_EQUAL(s, "a<->b<->c<->d<->e");
+    TRY(str_replace_in(s, "<->", "=", 2)); TEST_EQUAL(s, "a=b=c<->d<->e");
+    s = "a b  c   d";
+    TRY(str_squeeze_in(s, " \t€"));         TEST_EQUAL(s, "a b c d");
+    s = "a\tb\t c";
+    TRY(str_squeeze_in(s, "€\t "));         TEST_EQUAL(s, "a€b€c");
+    s = "one\ntwo\u2028three";
+    TRY(str_unify_lines_in(s, "\r\n"));    TEST_EQUAL(s, "one\r\ntwo\r\nthree\r\n");
+    s = "\n\n\u2028\u2028";
+    TRY(str_unify_lines_in(s, "\r\n"));    TEST_EQUAL(s, "\r\n\r\n\r\n\r\n");
+    s = "abcabc";
+    TRY(str_translate_in(s, "ac", "€∈"));  TEST_EQUAL(s, "€b∈€b∈");
+    s = "\u0149\u0390 \u0149";
+    TRY(str_casefold_in(s));               TEST_EQUAL(s, "\u02bcn\u03b9\u0308\u0301 \u02bcn");
+
+}
+
 void test_unicorn_string_manip_insert() {
 
     Ustring s, t;
@@ -210,5 +254,17 @@ void test_unicorn_string_manip_join() {
     v = {"Hello"};                  TEST_EQUAL(str_join(v, "\n", true), "Hello\n");
     v = {"Hello","world"};          TEST_EQUAL(str_join(v, "\n", true), "Hello\nworld\n");
     v = {"Hello","world","again"};  TEST_EQUAL(str_join(v, "\n", true), "Hello\nworld\nagain\n");
+    v = {"","",""};                 TEST_EQUAL(str_join(v, "/"), "//");
+
+    std::vector<const char*> cv = {"alpha", "beta", "gamma"};
+    TEST_EQUAL(str_join(cv, ", "), "alpha, beta, gamma");
+    TEST_EQUAL(str_join(str_split_view("alpha beta gamma"), "/"), "alpha/beta/gamma");
+
+    Ustring s = "List:";
+    v = {"Hello","world","again"};
+    TRY(str_append_join(s, v));                 TEST_EQUAL(s, "List:Helloworldagain");
+    TRY(str_append_join(s, v, " ", true));      TEST_EQUAL(s, "List:HelloworldagainHello world again ");
+    v.clear();
+    TRY(str_append_join(s, v, "/", true));      TEST_EQUAL(s, "List:HelloworldagainHello world again ");
 
 }
@@ -2,6 +2,7 @@
 #include "unicorn/character.hpp"
 #include "unicorn/unit-test.hpp"
 #include "unicorn/utf.hpp"
+#include <iterator>
 #include <vector>
 
 using namespace RS;
@@ -111,6 +112,62 @@ void test_unicorn_string_manip_split() {
 
 }
 
+void test_unicorn_string_manip_split_view() {
+
+    Irange<SplitIterator> r;
+
+    TRY(r = str_split_view(""));                      TEST_EQUAL(std::distance(r.begin(), r.end()), 0);  TEST_EQUAL(str_join(r, "/"), "");
+    TRY(r = str_split_view("Hello"));                 TEST_EQUAL(std::distance(r.begin(), r.end()), 1);  TEST_EQUAL(str_join(r, "/"), "Hello");
+    TRY(r = str_split_view("Hello world"));           TEST_EQUAL(std::distance(r.begin(), r.end()), 2);  TEST_EQUAL(str_join(r, "/"), "Hello/world");
+    TRY(r = str_split_view("\t Hello \t world \t"));  TEST_EQUAL(std::distance(r.begin(), r.end()), 2);  TEST_EQUAL(str_join(r, "/"), "Hello/world");
+    TRY(r = str_split_view("\u3000Hello\u3000world"));  TEST_EQUAL(std::distance(r.begin(), r.end()), 2);  TEST_EQUAL(str_join(r, "/"), "Hello/world");
+
+    TRY(r = str_split_at_view("", "<>"));                        TEST_EQUAL(std::distance(r.begin(), r.end()), 1);  TEST_EQUAL(str_join(r, "/"), "");
+    TRY(r = str_split_at_view("<>", "<>"));                      TEST_EQUAL(std::distance(r.begin(), r.end()), 2);  TEST_EQUAL(str_join(r, "/"), "/");
+    TRY(r = str_split_at_view("Hello", "<>"));                   TEST_EQUAL(std::distance(r.begin(), r.end()), 1);  TEST_EQUAL(str_join(r, "/"), "Hello");
+    TRY(r = str_split_at_view("<>Hello<>world<>", "<>"));        TEST_EQUAL(std::distance(r.begin(), r.end()), 4);  TEST_EQUAL(str_join(r, "/"), "/Hello/world/");
+    TRY(r = str_split_at_view("<><>Hello<><>world<><>", "<>"));  TEST_EQUAL(std::distance(r.begin(), r.end()), 7);  TEST_EQUAL(str_join(r, "/"), "//Hello//world//");
+    TRY(r = str_split_at_view("a,b,,c", ","));                   TEST_EQUAL(std::distance(r.begin(), r.end()), 4);  TEST_EQUAL(str_join(r, "/"), "a/b//c");
+    TRY(r = str_split_at_view("Hello", ""));                     TEST_EQUAL(std::distance(r.begin(), r.end()), 1);  TEST_EQUAL(str_join(r, "/"), "Hello");
+
+    TRY(r = str_split_by_view("**Hello**world**", "*"));       TEST_EQUAL(std::distance(r.begin(), r.end()), 2);  TEST_EQUAL(str_join(r, "/"), "Hello/world");
+    TRY(r = str_split_by_view("*****", "@*"));                 TEST_EQUAL(std::distance(r.begin(), r.end()), 0);  TEST_EQUAL(str_join(r, "/"), "");
+    TRY(r = str_split_by_view("a;b,c; d", ",; "));             TEST_EQUAL(std::distance(r.begin(), r.end()), 4);  TEST_EQUAL(str_join(r, "/"), "a/b/c/d");
+    TRY(r = str_split_by_view("“”,“€uro”,“∈lement”", "“”,"));  TEST_EQUAL(std::distance(r.begin(), r.end()), 2);  TEST_EQUAL(str_join(r, "/"), "€uro/∈lement");
+
+    TRY(r = str_split_lines_view(""));              TEST_EQUAL(std::distance(r.begin(), r.end()), 0);  TEST_EQUAL(str_join(r, "/"), "");
+    TRY(r = str_split_lines_view("\n"));            TEST_EQUAL(std::distance(r.begin(), r.end()), 1);  TEST_EQUAL(str_join(r, "/"), "");
+    TRY(r = str_split_lines_view("\n\n\n"));        TEST_EQUAL(std::distance(r.begin(), r.end()), 3);  TEST_EQUAL(str_join(r, "/"), "//");
+    TRY(r = str_split_lines_view("\r\n\r\n\r\n"));  TEST_EQUAL(std::distance(r.begin(), r.end()), 3);  TEST_EQUAL(str_join(r, "/"), "//");
+    TRY(r = str_split_lines_view("one\ntwo"));      TEST_EQUAL(std::distance(r.begin(), r.end()), 2);  TEST_EQUAL(str_join(r, "/"), "one/two");
+
+    Ustring text =
+        "Line one\n\n"
+        "Line two\r\r"
+        "Line three\r\n\r\n"
+        "Line four\f\f"
+        "Line five\u0085\u0085"
+        "Line six\u2028\u2028"
+        "Line seven\u2029\u2029";
+    TRY(r = str_split_lines_view(text));
+    TEST_EQUAL(std::distance(r.begin(), r.end()), 14);
+    TEST_EQUAL(str_join(r, "/"), str_join(str_splitv_lines(text), "/"));
+
+    // Fields are slices of the original string
+
+    text = "alpha,beta\ngamma,,delta\n";
+    Strings v;
+    for (auto line: str_split_lines_view(text)) {
+        for (auto field: str_split_at_view(line, ",")) {
+            TEST(field.data() >= text.data());
+            TEST(field.data() + field.size() <= text.data() + text.size());
+            v.push_back(Ustring(field));
+        }
+    }
+    TEST_EQUAL(str_join(v, "/"), "alpha/beta/gamma//delta");
+
+}
+
 void test_unicorn_string_manip_squeeze() {
 
     Ustring s;
@@ -616,4 +673,22 @@ void test_unicorn_string_manip_wrap() {
     TRY(str_wrap_in(s, Wrap::preserve, Wrap::width=40));
     TEST_EQUAL(s, t);
 
+    // Text without spaces is broken at line break opportunities
+
+    s = "\u65e5\u672c\u8a9e\u306e\u30c6\u30ad\u30b9\u30c8\u3092\u6298\u308a\u8fd4\u3059\u3002";
+    t =
+        "\u65e5\u672c\u8a9e\u306e\u30c6\n"
+        "\u30ad\u30b9\u30c8\u3092\u6298\n"
+        "\u308a\u8fd4\u3059\u3002\n";
+    TEST_EQUAL(str_wrap(s, Wrap::flags=Length::narrow, Wrap::width=10), t);
+
+    s = "A well-known self-evident truth";
+    t =
+        "A well-\n"
+        "known\n"
+        "self-\n"
+        "evident\n"
+        "truth\n";
+    TEST_EQUAL(str_wrap(s, Wrap::width=8), t);
+
 }
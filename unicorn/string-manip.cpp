@@ -1,5 +1,8 @@
 #include "unicorn/string.hpp"
 #include <algorithm>
+#include <array>
+#include <cstring>
+#include <iterator>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -9,14 +12,119 @@ namespace RS::Unicorn {
 
     namespace {
 
+        // Tests characters against a set given as a UTF-8 string, without
+        // converting it to UTF-32 first
+
         class CharIn {
         public:
-            CharIn(const std::u32string& chars) noexcept: x(&chars) {}
-            bool operator()(char32_t c) const noexcept { return x->find(c) != npos; }
+            CharIn(const Ustring& chars) noexcept: x(chars) {}
+            bool operator()(char32_t c) const noexcept {
+                if (c <= last_ascii_char)
+                    return x.find(char(c)) != npos;
+                if (! char_is_unicode(c))
+                    return false;
+                char buf[4];
+                size_t n = UnicornDetail::UtfEncoding<char>::encode(c, buf);
+                return x.find(std::string_view(buf, n)) != npos;
+            }
+        private:
+            std::string_view x;
+        };
+
+        size_t decode_char(const char* src, size_t n, size_t pos, char32_t& c) noexcept {
+            auto b = uint8_t(src[pos]);
+            if (b <= last_ascii_char) {
+                c = b;
+                return 1;
+            }
+            return UnicornDetail::UtfEncoding<char>::decode(src + pos, n - pos, c);
+        }
+
+        // In-place editing. An edit function reads the original text from
+        // left to right and writes its output through a sink, passing the
+        // input position reached so far with each write. The output is
+        // written over the same buffer, so it must never get ahead of the
+        // input; if the edit can lengthen the string, a measuring pass first
+        // finds the furthest the output gets ahead at any point, and the
+        // original text is moved up by that much before editing, so the
+        // string is resized at most once.
+
+        class MeasureSink {
+        public:
+            void write(const char* /*ptr*/, size_t n, size_t in_pos) noexcept {
+                out += n;
+                if (out > in_pos)
+                    ahead = std::max(ahead, out - in_pos);
+            }
+            size_t ahead = 0;
+        private:
+            size_t out = 0;
+        };
+
+        class EditSink {
+        public:
+            explicit EditSink(char* base) noexcept: buf(base) {}
+            void write(const char* ptr, size_t n, size_t /*in_pos*/) noexcept {
+                if (n != 0 && ptr != buf + out)
+                    std::memmove(buf + out, ptr, n);
+                out += n;
+            }
+            size_t size() const noexcept { return out; }
         private:
-            const std::u32string* x;
+            char* buf;
+            size_t out = 0;
         };
 
+        template <typename Edit>
+        void edit_in_place(Ustring& str, Edit edit, bool may_grow) {
+            size_t n = str.size(), shift = 0;
+            if (may_grow) {
+                MeasureSink measure;
+                edit(str.data(), n, measure);
+                shift = measure.ahead;
+                if (shift != 0) {
+                    str.resize(n + shift);
+                    std::memmove(str.data() + shift, str.data(), n);
+                }
+            }
+            EditSink sink(str.data());
+            edit(str.data() + shift, n, sink);
+            str.resize(sink.size());
+        }
+
+        template <typename Pred>
+        void squeeze_in_helper(Ustring& str, bool trim, Pred p, const Ustring& sub) {
+            // Each run of squeezed characters is at least one byte long, so
+            // only a multibyte substitute can lengthen the string
+            auto edit = [&] (const char* src, size_t n, auto& out) {
+                size_t i = 0, span = 0;
+                bool gap = false, kept = false;
+                while (i < n) {
+                    char32_t c = 0;
+                    size_t len = decode_char(src, n, i, c);
+                    if (p(c)) {
+                        if (! gap)
+                            out.write(src + span, i - span, i);
+                        gap = true;
+                    } else if (gap) {
+                        if (! trim || kept)
+                            out.write(sub.data(), sub.size(), i);
+                        gap = false;
+                        kept = true;
+                        span = i;
+                    } else {
+                        kept = true;
+                    }
+                    i += len;
+                }
+                if (! gap)
+                    out.write(src + span, n - span, n);
+                else if (! trim)
+                    out.write(sub.data(), sub.size(), n);
+            };
+            edit_in_place(str, edit, sub.size() > 1);
+        }
+
         void check_whitespace(const Utf8Iterator& i, const Utf8Iterator& j, size_t& linebreaks, size_t& tailspaces) {
             linebreaks = tailspaces = 0;
             auto k = i;
@@ -91,6 +199,17 @@ namespace RS::Unicorn {
             }
         }
 
+        using AsciiSet = std::array<uint64_t, 2>;
+
+        template <typename Pred>
+        AsciiSet make_ascii_set(Pred p) {
+            AsciiSet set = {{0, 0}};
+            for (char32_t c = 0; c <= last_ascii_char; ++c)
+                if (p(c))
+                    set[c >> 6] |= uint64_t(1) << (c & 63);
+            return set;
+        }
+
     }
 
     namespace UnicornDetail {
@@ -438,7 +557,7 @@ namespace RS::Unicorn {
     }
 
     bool str_partition_at(const Ustring& str, Ustring& prefix, Ustring& suffix, const Ustring& delim) {
-        size_t pos = delim.empty() ? npos : str.find(delim);
+        size_t pos = delim.empty() ? npos : UnicornDetail::find_substring(str, delim);
         if (pos == npos) {
             prefix = str;
             suffix.clear();
@@ -501,16 +620,11 @@ namespace RS::Unicorn {
     }
 
     void str_remove_in(Ustring& str, char32_t c) {
-        Ustring dst;
-        std::copy_if(utf_begin(str), utf_end(str), utf_writer(dst), [c] (char32_t x) { return x != c; });
-        str.swap(dst);
+        UnicornDetail::remove_in_helper(str, [c] (char32_t x) { return x == c; });
     }
 
     void str_remove_in(Ustring& str, const Ustring& chars) {
-        Ustring dst;
-        auto uchars = to_utf32(chars);
-        std::copy_if(utf_begin(str), utf_end(str), utf_writer(dst), [&uchars] (char32_t x) { return uchars.find(x) == npos; });
-        str.swap(dst);
+        UnicornDetail::remove_in_helper(str, CharIn(chars));
     }
 
     Ustring str_repeat(const Ustring& str, size_t n) {
@@ -540,7 +654,7 @@ namespace RS::Unicorn {
         Ustring dst;
         size_t i = 0, size = str.size(), tsize = target.size();
         for (size_t k = 0; k < n && i < size; ++k) {
-            auto j = str.find(target, i);
+            auto j = UnicornDetail::find_substring(str, target, i);
             if (j == npos) {
                 dst.append(str, i, npos);
                 i = npos;
@@ -556,8 +670,39 @@ namespace RS::Unicorn {
     }
 
     void str_replace_in(Ustring& str, const Ustring& target, const Ustring& sub, size_t n) {
-        auto result = str_replace(str, target, sub, n);
-        str.swap(result);
+        if (target.empty() || n == 0)
+            return;
+        if (&target == &str || &sub == &str) {
+            auto result = str_replace(str, target, sub, n);
+            str.swap(result);
+            return;
+        }
+        // Replace in place; if the substitute is longer than the target,
+        // count the matches first, and move the original text up far
+        // enough that the output never overwrites unread input
+        size_t size = str.size(), tsize = target.size(), ssize = sub.size(), shift = 0;
+        if (ssize > tsize) {
+            size_t count = 0;
+            for (size_t i = 0; count < n && (i = UnicornDetail::find_substring(str, target, i)) != npos; i += tsize)
+                ++count;
+            if (count == 0)
+                return;
+            shift = count * (ssize - tsize);
+            str.resize(size + shift);
+            std::memmove(str.data() + shift, str.data(), size);
+        }
+        EditSink out(str.data());
+        size_t i = shift, end = shift + size;
+        for (size_t k = 0; k < n; ++k) {
+            size_t j = UnicornDetail::find_substring(str, target, i, end);
+            if (j == npos)
+                break;
+            out.write(str.data() + i, j - i, j);
+            out.write(sub.data(), ssize, j + tsize);
+            i = j + tsize;
+        }
+        out.write(str.data() + i, end - i, end);
+        str.resize(out.size());
     }
 
     Strings str_splitv(const Ustring& src) {
@@ -584,6 +729,22 @@ namespace RS::Unicorn {
         return v;
     }
 
+    Irange<SplitIterator> str_split_view(std::string_view src) {
+        return {{src, SplitIterator::mode::whitespace}, {}};
+    }
+
+    Irange<SplitIterator> str_split_at_view(std::string_view src, std::string_view delim) {
+        return {{src, SplitIterator::mode::at, delim}, {}};
+    }
+
+    Irange<SplitIterator> str_split_by_view(std::string_view src, std::string_view delim) {
+        return {{src, SplitIterator::mode::by, delim}, {}};
+    }
+
+    Irange<SplitIterator> str_split_lines_view(std::string_view src) {
+        return {{src, SplitIterator::mode::lines}, {}};
+    }
+
     Ustring str_squeeze(const Ustring& str) {
         Ustring dst;
         squeeze_helper(str, dst, false);
@@ -609,27 +770,21 @@ namespace RS::Unicorn {
     }
 
     void str_squeeze_in(Ustring& str) {
-        Ustring dst;
-        squeeze_helper(str, dst, false);
-        str.swap(dst);
+        squeeze_in_helper(str, false, char_is_white_space, " ");
     }
 
     void str_squeeze_in(Ustring& str, const Ustring& chars) {
-        Ustring dst;
-        squeeze_helper(str, dst, false, chars);
-        str.swap(dst);
+        if (! chars.empty())
+            squeeze_in_helper(str, false, CharIn(chars), str_char(str_first_char(chars)));
     }
 
     void str_squeeze_trim_in(Ustring& str) {
-        Ustring dst;
-        squeeze_helper(str, dst, true);
-        str.swap(dst);
+        squeeze_in_helper(str, true, char_is_white_space, " ");
     }
 
     void str_squeeze_trim_in(Ustring& str, const Ustring& chars) {
-        Ustring dst;
-        squeeze_helper(str, dst, true, chars);
-        str.swap(dst);
+        if (! chars.empty())
+            squeeze_in_helper(str, true, CharIn(chars), str_char(str_first_char(chars)));
     }
 
     Ustring str_substring(const Ustring& str, size_t offset, size_t count) {
@@ -665,12 +820,35 @@ namespace RS::Unicorn {
     }
 
     void str_translate_in(Ustring& str, const Ustring& target, const Ustring& sub) {
-        auto result = str_translate(str, target, sub);
-        str.swap(result);
+        if (target.empty() || sub.empty())
+            return;
+        auto t = to_utf32(target), s = to_utf32(sub);
+        if (s.size() < t.size())
+            s.resize(t.size(), s.back());
+        bool may_grow = false;
+        for (size_t k = 0; k < t.size() && ! may_grow; ++k)
+            may_grow = code_units<char>(s[k]) > code_units<char>(t[k]);
+        auto edit = [&] (const char* src, size_t n, auto& out) {
+            size_t span = 0;
+            char buf[4];
+            for (size_t i = 0; i < n;) {
+                char32_t c = 0;
+                size_t len = decode_char(src, n, i, c);
+                size_t pos = t.find(c);
+                if (pos != npos && s[pos] != c) {
+                    out.write(src + span, i - span, i);
+                    out.write(buf, UnicornDetail::UtfEncoding<char>::encode(s[pos], buf), i + len);
+                    span = i + len;
+                }
+                i += len;
+            }
+            out.write(src + span, n - span, n);
+        };
+        edit_in_place(str, edit, may_grow);
     }
 
     Ustring str_trim(const Ustring& str, const Ustring& chars) {
-        return str_trim_if(str, CharIn(to_utf32(chars)));
+        return str_trim_if(str, CharIn(chars));
     }
 
     Ustring str_trim(const Ustring& str) {
@@ -678,7 +856,7 @@ namespace RS::Unicorn {
     }
 
     Ustring str_trim_left(const Ustring& str, const Ustring& chars) {
-        return str_trim_left_if(str, CharIn(to_utf32(chars)));
+        return str_trim_left_if(str, CharIn(chars));
     }
 
     Ustring str_trim_left(const Ustring& str) {
@@ -686,7 +864,7 @@ namespace RS::Unicorn {
     }
 
     Ustring str_trim_right(const Ustring& str, const Ustring& chars) {
-        return str_trim_right_if(str, CharIn(to_utf32(chars)));
+        return str_trim_right_if(str, CharIn(chars));
     }
 
     Ustring str_trim_right(const Ustring& str) {
@@ -694,7 +872,7 @@ namespace RS::Unicorn {
     }
 
     void str_trim_in(Ustring& str, const Ustring& chars) {
-        str_trim_in_if(str, CharIn(to_utf32(chars)));
+        str_trim_in_if(str, CharIn(chars));
     }
 
     void str_trim_in(Ustring& str) {
@@ -702,7 +880,7 @@ namespace RS::Unicorn {
     }
 
     void str_trim_left_in(Ustring& str, const Ustring& chars) {
-        str_trim_left_in_if(str, CharIn(to_utf32(chars)));
+        str_trim_left_in_if(str, CharIn(chars));
     }
 
     void str_trim_left_in(Ustring& str) {
@@ -710,7 +888,7 @@ namespace RS::Unicorn {
     }
 
     void str_trim_right_in(Ustring& str, const Ustring& chars) {
-        str_trim_right_in_if(str, CharIn(to_utf32(chars)));
+        str_trim_right_in_if(str, CharIn(chars));
     }
 
     void str_trim_right_in(Ustring& str) {
@@ -751,8 +929,39 @@ namespace RS::Unicorn {
     }
 
     void str_unify_lines_in(Ustring& str, const Ustring& newline) {
-        auto result = str_unify_lines(str, newline);
-        str.swap(result);
+        if (&newline == &str) {
+            auto result = str_unify_lines(str, newline);
+            str.swap(result);
+            return;
+        }
+        // Every line break is at least one byte long, so only a multibyte
+        // newline, or a final line break that has to be added, can lengthen
+        // the string; both are written by the edit so the growth is measured
+        // in one pass
+        if (str.empty())
+            return;
+        bool add_break = ! char_is_line_break(*std::prev(utf_end(str)));
+        auto edit = [&] (const char* src, size_t n, auto& out) {
+            size_t span = 0;
+            for (size_t i = 0; i < n;) {
+                char32_t c = 0;
+                size_t len = decode_char(src, n, i, c);
+                if (char_is_line_break(c)) {
+                    out.write(src + span, i - span, i);
+                    i += len;
+                    if (c == U'\r' && i < n && src[i] == '\n')
+                        ++i;
+                    out.write(newline.data(), newline.size(), i);
+                    span = i;
+                } else {
+                    i += len;
+                }
+            }
+            out.write(src + span, n - span, n);
+            if (add_break)
+                out.write(newline.data(), newline.size(), n);
+        };
+        edit_in_place(str, edit, add_break || newline.size() > 1);
     }
 
     void str_unify_lines_in(Ustring& str, char32_t newline) {
@@ -763,6 +972,131 @@ namespace RS::Unicorn {
         str_unify_lines_in(str, "\n");
     }
 
+    // Class SplitIterator
+
+    // Delimiters are found by scanning bytes: ASCII bytes are looked up in
+    // a bitmap, and only multibyte characters are decoded, and only if the
+    // delimiter set can contain them. A single ASCII delimiter is found
+    // with memchr(), and a delimiter string with the same substring search
+    // as str_search().
+
+    SplitIterator::SplitIterator(std::string_view src, mode m, std::string_view delims):
+    text(src), delim(delims), next(0), smode(m), done(false) {
+        if (smode == mode::whitespace || smode == mode::lines) {
+            static const auto space_set = make_ascii_set(char_is_white_space);
+            static const auto break_set = make_ascii_set(char_is_line_break);
+            auto& set = smode == mode::whitespace ? space_set : break_set;
+            std::copy(set.begin(), set.end(), ascii_set);
+            unicode = true;
+        } else if (smode == mode::by) {
+            int count = 0;
+            for (char c: delim) {
+                auto b = uint8_t(c);
+                if (b <= last_ascii_char) {
+                    if (! (ascii_set[b >> 6] & (uint64_t(1) << (b & 63)))) {
+                        ascii_set[b >> 6] |= uint64_t(1) << (b & 63);
+                        single = b;
+                        ++count;
+                    }
+                } else {
+                    unicode = true;
+                }
+            }
+            if (count != 1 || unicode)
+                single = -1;
+        }
+        ++*this;
+    }
+
+    SplitIterator& SplitIterator::operator++() {
+        if (next == npos) {
+            field = {};
+            done = true;
+            return *this;
+        }
+        size_t n = text.size();
+        if (smode == mode::at || (smode == mode::by && delim.empty())) {
+            size_t j = delim.empty() ? npos : UnicornDetail::find_substring(text, delim, next);
+            if (j == npos) {
+                field = text.substr(next);
+                next = npos;
+            } else {
+                field = text.substr(next, j - next);
+                next = j + delim.size();
+            }
+        } else if (smode == mode::lines) {
+            if (next == n) {
+                field = {};
+                done = true;
+                return *this;
+            }
+            size_t j = find_delim(next), len = 0;
+            field = text.substr(next, j - next);
+            next = j;
+            if (j < n) {
+                is_delim(j, len);
+                next += len;
+                if (text[j] == '\r' && next < n && text[next] == '\n')
+                    ++next;
+            }
+        } else {
+            size_t j = skip_delims(next);
+            if (j == n) {
+                field = {};
+                done = true;
+                return *this;
+            }
+            next = find_delim(j);
+            field = text.substr(j, next - j);
+        }
+        return *this;
+    }
+
+    bool SplitIterator::is_delim(size_t pos, size_t& len) const noexcept {
+        auto b = uint8_t(text[pos]);
+        if (b <= last_ascii_char) {
+            len = 1;
+            return (ascii_set[b >> 6] & (uint64_t(1) << (b & 63))) != 0;
+        }
+        char32_t c = 0;
+        len = UnicornDetail::UtfEncoding<char>::decode(text.data() + pos, text.size() - pos, c);
+        if (! unicode || ! char_is_unicode(c))
+            return false;
+        switch (smode) {
+            case mode::whitespace:  return char_is_white_space(c);
+            case mode::lines:       return char_is_line_break(c);
+            default:                return delim.find(text.substr(pos, len)) != npos;
+        }
+    }
+
+    size_t SplitIterator::find_delim(size_t pos) const noexcept {
+        size_t n = text.size(), len = 0;
+        if (single >= 0) {
+            auto ptr = static_cast<const char*>(std::memchr(text.data() + pos, single, n - pos));
+            return ptr ? ptr - text.data() : n;
+        }
+        while (pos < n) {
+            auto b = uint8_t(text[pos]);
+            if (b <= last_ascii_char || ! unicode) {
+                if (b <= last_ascii_char && (ascii_set[b >> 6] & (uint64_t(1) << (b & 63))))
+                    return pos;
+                ++pos;
+            } else if (is_delim(pos, len)) {
+                return pos;
+            } else {
+                pos += len;
+            }
+        }
+        return n;
+    }
+
+    size_t SplitIterator::skip_delims(size_t pos) const noexcept {
+        size_t n = text.size(), len = 0;
+        while (pos < n && is_delim(pos, len))
+            pos += len;
+        return pos;
+    }
+
     void Wrap::init() {
         if (width_ == npos) {
             auto columns = decnum(cstr(getenv("COLUMNS")));
@@ -807,26 +1141,33 @@ namespace RS::Unicorn {
             } else {
                 j = std::find_if(i, end, char_is_white_space);
                 auto word = u_str(i, j);
-                auto wordlen = str_length(word, flags_ & all_length_flags);
-                if (words > 0) {
-                    if (linewidth + wordlen + spacing_ > size_t(width_)) {
-                        dst += newline_;
-                        words = linewidth = 0;
-                    } else {
-                        dst += ' ';
-                        linewidth += spacing_;
+                size_t gap = spacing_;
+                // Words without spaces (e.g. CJK text) can also be broken
+                // at any UAX14 line break opportunity within them.
+                for (auto& unit: line_break_opportunities(word)) {
+                    auto part = u_str(unit);
+                    auto partlen = str_length(part, flags_ & all_length_flags);
+                    if (words > 0) {
+                        if (linewidth + partlen + gap > size_t(width_)) {
+                            dst += newline_;
+                            words = linewidth = 0;
+                        } else if (gap > 0) {
+                            dst += ' ';
+                            linewidth += gap;
+                        }
                     }
+                    if (words == 0) {
+                        dst.append(spaces, ' ');
+                        linewidth = spaces * spacing_;
+                        spaces = margin2_;
+                    }
+                    dst += part;
+                    ++words;
+                    linewidth += partlen;
+                    if (enforce_ && linewidth > size_t(width_))
+                        throw std::length_error("Word is too long for wrapping width");
+                    gap = 0;
                 }
-                if (words == 0) {
-                    dst.append(spaces, ' ');
-                    linewidth = spaces * spacing_;
-                    spaces = margin2_;
-                }
-                dst += word;
-                ++words;
-                linewidth += wordlen;
-                if (enforce_ && linewidth > size_t(width_))
-                    throw std::length_error("Word is too long for wrapping width");
             }
             i = j;
         }
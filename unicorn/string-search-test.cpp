@@ -0,0 +1,108 @@
+#include "unicorn/string.hpp"
+#include "unicorn/unit-test.hpp"
+#include <string>
+#include <vector>
+
+using namespace RS;
+using namespace RS::Unicorn;
+using namespace std::literals;
+
+namespace {
+
+    Ustring show_matches(const MultiSearcher& ms, const Ustring& str) {
+        Ustring out;
+        for (auto& m: ms.find_all(str))
+            out += "[" + std::to_string(m.offset) + "," + std::to_string(m.count) + "," + std::to_string(m.index) + "]";
+        return out;
+    }
+
+}
+
+void test_unicorn_string_search_multi_searcher() {
+
+    MultiSearcher ms;
+    MultiSearcher::match_type m;
+
+    TEST(ms.empty());
+    TRY(m = ms.find("hello"s));
+    TEST(! m);
+    TEST_EQUAL(show_matches(ms, "hello"s), "");
+
+    TRY((ms = MultiSearcher{{"he", "she", "his", "hers"}}));
+    TEST_EQUAL(ms.size(), 4u);
+    TEST_EQUAL(show_matches(ms, ""s), "");
+    TEST_EQUAL(show_matches(ms, "xyz"s), "");
+    TEST_EQUAL(show_matches(ms, "ushers"s), "[1,3,1]");
+    TEST_EQUAL(show_matches(ms, "hishershe"s), "[0,3,2][3,4,3][7,2,0]");
+    TEST_EQUAL(ms.count("he she his hers"s), 4u);
+    TRY(m = ms.find("ushers"s));
+    TEST(m);
+    TEST_EQUAL(m.offset, 1u);
+    TEST_EQUAL(m.count, 3u);
+    TEST_EQUAL(m.index, 1u);
+    TRY(m = ms.find("hishershe"s, 1));
+    TEST_EQUAL(m.offset, 2u);
+    TEST_EQUAL(m.index, 1u);
+    TRY(m = ms.find("hishershe"s, 3));
+    TEST_EQUAL(m.offset, 3u);
+    TEST_EQUAL(m.index, 3u);
+    TRY(m = ms.find("hishershe"s, 9));
+    TEST(! m);
+
+    // Leftmost longest, with the first of any duplicate patterns
+
+    TRY((ms = MultiSearcher{{"bc", "abcd", "b", "abcd", ""}}));
+    TEST_EQUAL(show_matches(ms, "abcd"s), "[0,4,1]");
+    TEST_EQUAL(show_matches(ms, "abce"s), "[1,2,0]");
+    TEST_EQUAL(show_matches(ms, "abbcb"s), "[1,1,2][2,2,0][4,1,2]");
+    TRY((ms = MultiSearcher{{"a", "aa", "aaa"}}));
+    TEST_EQUAL(show_matches(ms, "aaaaaaa"s), "[0,3,2][3,3,2][6,1,0]");
+    TRY((ms = MultiSearcher{{"abcdef", "cd"}}));
+    TEST_EQUAL(show_matches(ms, "abcdeg abcdef"s), "[2,2,1][7,6,0]");
+    TRY((ms = MultiSearcher{{"aba", "a", "b"}}));
+    TEST_EQUAL(show_matches(ms, "caadab"s), "[1,1,1][2,1,1][4,1,1][5,1,2]");
+
+    // Single start byte
+
+    TRY((ms = MultiSearcher{{"€1", "€2", "€€"}}));
+    TEST_EQUAL(show_matches(ms, "€ €1 €€€2"s), "[4,4,0][9,6,2][15,4,1]");
+
+    // Case insensitive
+
+    TRY((ms = MultiSearcher{{"Hello", "WORLD"}, MultiSearcher::icase}));
+    TEST_EQUAL(show_matches(ms, "hello world, HELLO WORLD"s), "[0,5,0][6,5,1][13,5,0][19,5,1]");
+    TRY((ms = MultiSearcher{{"strasse", "σ", "k"}, MultiSearcher::icase}));
+    TEST_EQUAL(show_matches(ms, "Straße STRASSE"s), "[0,7,0][8,7,0]");
+    TEST_EQUAL(show_matches(ms, "ΣΑΣ ς K"s), "[0,2,1][4,2,1][7,2,1][10,3,2]");
+    TRY((ms = MultiSearcher{{"s", "ß"}, MultiSearcher::icase}));
+    TEST_EQUAL(show_matches(ms, "aßb ss"s), "[1,2,1][5,2,1]");
+    TRY((ms = MultiSearcher{{"s"}, MultiSearcher::icase}));
+    TEST_EQUAL(show_matches(ms, "aßb ss"s), "[5,1,0][6,1,0]");
+    TRY((ms = MultiSearcher{{"ss"}, MultiSearcher::icase}));
+    TEST_EQUAL(show_matches(ms, "aßb sS ẞ"s), "[1,2,0][5,2,0][8,3,0]");
+
+}
+
+void test_unicorn_string_search_multi_replacer() {
+
+    MultiReplacer mr;
+    Ustring s;
+
+    TEST_EQUAL(mr.replace("hello"s), "hello");
+    TEST_THROW(MultiReplacer({"a", "b"}, {"x"}), std::invalid_argument);
+
+    TRY((mr = MultiReplacer{{"a", "b", "ab"}, {"b", "a", "[ab]"}}));
+    TEST_EQUAL(mr.replace(""s), "");
+    TEST_EQUAL(mr.replace("xyz"s), "xyz");
+    TEST_EQUAL(mr.replace("abba"s), "[ab]ab");
+    TEST_EQUAL(mr.replace("a b ab ba"s), "b a [ab] ab");
+
+    TRY((mr = MultiReplacer{{"&", "<", ">", "\""}, {"&amp;", "&lt;", "&gt;", "&quot;"}}));
+    s = "<a href=\"x&y\">€</a>";
+    TRY(mr.replace_in(s));
+    TEST_EQUAL(s, "&lt;a href=&quot;x&amp;y&quot;&gt;€&lt;/a&gt;");
+
+    TRY((mr = MultiReplacer{{"colour", "straße"}, {"color", "street"}, MultiSearcher::icase}));
+    TEST_EQUAL(mr.replace("Colour of the STRASSE, colours of the Straße"s), "color of the street, colors of the street");
+
+}
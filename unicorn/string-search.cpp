@@ -0,0 +1,250 @@
+#include "unicorn/string.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace RS::Unicorn {
+
+    namespace {
+
+        constexpr uint32_t no_output = ~ uint32_t(0);
+
+        // Case folds the text from pos onward, recording the offset in the
+        // original string for each byte of the folded text that starts a
+        // folded character, and npos for the bytes in between; an extra
+        // entry marks the end of the text
+
+        void fold_text(const Ustring& str, size_t pos, Ustring& folded, std::vector<size_t>& origin) {
+            folded.clear();
+            origin.clear();
+            char32_t buf[max_case_decomposition];
+            for (size_t i = pos, n = str.size(); i < n;) {
+                size_t ascii = ascii_run_length(str.data() + i, n - i);
+                for (size_t end = i + ascii; i < end; ++i) {
+                    folded += ascii_tolower(str[i]);
+                    origin.push_back(i);
+                }
+                if (i == n)
+                    break;
+                auto it = utf_iterator(str, i);
+                size_t len = char_to_full_casefold(*it, buf);
+                origin.push_back(i);
+                str_append(folded, buf, len);
+                origin.resize(folded.size(), npos);
+                i = it.offset() + it.count();
+            }
+            origin.push_back(str.size());
+        }
+
+    }
+
+    // Class MultiSearcher
+
+    // Aho-Corasick automaton (Aho & Corasick 1975), converted to a complete
+    // DFA over byte classes so each byte of the subject costs one table
+    // lookup. Bytes that do not occur in any pattern share class 0, which
+    // always leads back to the root.
+
+    MultiSearcher::MultiSearcher(const Strings& patterns, uint32_t flags):
+    pats(patterns), sflags(flags) {
+        Strings keys = pats;
+        if (sflags & icase)
+            for (auto& key: keys)
+                key = str_casefold(key);
+        std::array<bool, 256> used = {};
+        for (auto& key: keys)
+            for (char c: key)
+                used[uint8_t(c)] = true;
+        nclasses = 1;
+        for (size_t b = 0; b < 256; ++b)
+            classes[b] = used[b] ? uint16_t(nclasses++) : 0;
+        delta.assign(nclasses, 0);
+        depth = {0};
+        output = {no_output};
+        dict = {0};
+        size_t nstarts = 0;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            auto& key = keys[i];
+            if (key.empty())
+                continue;
+            uint32_t s = 0;
+            for (char c: key) {
+                size_t slot = s * nclasses + classes[uint8_t(c)];
+                uint32_t t = delta[slot];
+                if (t == 0) {
+                    t = uint32_t(depth.size());
+                    delta[slot] = t;
+                    delta.resize(delta.size() + nclasses, 0);
+                    depth.push_back(depth[s] + 1);
+                    output.push_back(no_output);
+                    dict.push_back(0);
+                }
+                s = t;
+            }
+            if (output[s] == no_output)
+                output[s] = uint32_t(i);
+            auto& start = starts[uint8_t(key[0])];
+            if (! start) {
+                start = true;
+                ++nstarts;
+                first_byte = uint8_t(key[0]);
+            }
+        }
+        if (nstarts != 1)
+            first_byte = -1;
+        if (depth.size() == 1) {
+            delta.clear();
+            return;
+        }
+        // Breadth first traversal to resolve the failure links; missing
+        // transitions are copied from the failure state, which is always
+        // shallower and therefore already complete
+        std::vector<uint32_t> fail(depth.size(), 0);
+        std::vector<uint32_t> queue;
+        for (size_t c = 0; c < nclasses; ++c)
+            if (delta[c])
+                queue.push_back(delta[c]);
+        for (size_t q = 0; q < queue.size(); ++q) {
+            uint32_t s = queue[q], f = fail[s];
+            dict[s] = output[f] == no_output ? dict[f] : f;
+            for (size_t c = 0; c < nclasses; ++c) {
+                uint32_t& t = delta[s * nclasses + c];
+                if (t) {
+                    fail[t] = delta[f * nclasses + c];
+                    queue.push_back(t);
+                } else {
+                    t = delta[f * nclasses + c];
+                }
+            }
+        }
+    }
+
+    size_t MultiSearcher::count(const Ustring& str) const {
+        size_t n = 0;
+        scan(str, 0, [&n] (size_t, size_t, size_t) { ++n; return true; });
+        return n;
+    }
+
+    MultiSearcher::match_type MultiSearcher::find(const Ustring& str, size_t pos) const {
+        match_type m;
+        scan(str, pos, [&m] (size_t ofs, size_t len, size_t index) {
+            m = {ofs, len, index};
+            return false;
+        });
+        return m;
+    }
+
+    MultiSearcher::match_list MultiSearcher::find_all(const Ustring& str, size_t pos) const {
+        match_list list;
+        scan(str, pos, [&list] (size_t ofs, size_t len, size_t index) {
+            list.push_back({ofs, len, index});
+            return true;
+        });
+        return list;
+    }
+
+    template <typename F>
+    void MultiSearcher::scan(const Ustring& str, size_t pos, F emit) const {
+        if (delta.empty() || pos >= str.size())
+            return;
+        auto any = [] (size_t, size_t) { return true; };
+        if (! (sflags & icase)) {
+            scan_text(str.data(), str.size(), pos, any, [&emit] (size_t b, size_t e, size_t index) {
+                return emit(b, e - b, index);
+            });
+        } else if (ascii_run_length(str.data() + pos, str.size() - pos) == str.size() - pos) {
+            auto folded = ascii_lowercase(std::string_view(str).substr(pos));
+            scan_text(folded.data(), folded.size(), 0, any, [&emit,pos] (size_t b, size_t e, size_t index) {
+                return emit(b + pos, e - b, index);
+            });
+        } else {
+            // A match in the folded text is only accepted if it starts and
+            // ends on the boundaries of the original characters
+            Ustring folded;
+            std::vector<size_t> origin;
+            fold_text(str, pos, folded, origin);
+            auto boundary = [&origin] (size_t b, size_t e) { return origin[b] != npos && origin[e] != npos; };
+            scan_text(folded.data(), folded.size(), 0, boundary, [&emit,&origin] (size_t b, size_t e, size_t index) {
+                return emit(origin[b], origin[e] - origin[b], index);
+            });
+        }
+    }
+
+    template <typename A, typename F>
+    void MultiSearcher::scan_text(const char* text, size_t size, size_t pos, A accept, F emit) const {
+        // Leftmost longest non-overlapping matches: a candidate match is held
+        // until no longer match starting at or before it can still be found,
+        // then the search restarts from the root at the end of the match
+        size_t cand_start = npos, cand_end = 0, cand_index = 0;
+        uint32_t s = 0;
+        size_t i = pos;
+        for (;;) {
+            if (s == 0 && cand_start == npos)
+                i = skip(text, size, i);
+            bool more = i < size;
+            if (more) {
+                s = delta[s * nclasses + classes[uint8_t(text[i])]];
+                ++i;
+            } else if (cand_start == npos) {
+                return;
+            }
+            if (cand_start != npos && (! more || i - depth[s] > cand_start)) {
+                if (! emit(cand_start, cand_end, cand_index))
+                    return;
+                i = cand_end;
+                s = 0;
+                cand_start = npos;
+                continue;
+            }
+            for (uint32_t t = output[s] == no_output ? dict[s] : s; t != 0; t = dict[t]) {
+                size_t start = i - depth[t];
+                if (cand_start != npos && start > cand_start)
+                    break;
+                if (accept(start, i)) {
+                    cand_start = start;
+                    cand_end = i;
+                    cand_index = output[t];
+                    break;
+                }
+            }
+        }
+    }
+
+    size_t MultiSearcher::skip(const char* text, size_t size, size_t pos) const noexcept {
+        // Prefilter used while the automaton is at the root: nothing can
+        // match until a byte that starts one of the patterns turns up
+        if (first_byte >= 0) {
+            auto ptr = static_cast<const char*>(std::memchr(text + pos, first_byte, size - pos));
+            return ptr ? ptr - text : size;
+        }
+        while (pos < size && ! starts[uint8_t(text[pos])])
+            ++pos;
+        return pos;
+    }
+
+    // Class MultiReplacer
+
+    MultiReplacer::MultiReplacer(const Strings& patterns, const Strings& substitutes, uint32_t flags):
+    search(patterns, flags), subs(substitutes) {
+        if (subs.size() != patterns.size())
+            throw std::invalid_argument("Inconsistent number of patterns and substitutes");
+    }
+
+    Ustring MultiReplacer::replace(const Ustring& str) const {
+        Ustring result;
+        result.reserve(str.size());
+        size_t prev = 0;
+        search.scan(str, 0, [&] (size_t ofs, size_t len, size_t index) {
+            result.append(str, prev, ofs - prev);
+            result += subs[index];
+            prev = ofs + len;
+            return true;
+        });
+        result.append(str, prev, npos);
+        return result;
+    }
+
+    void MultiReplacer::replace_in(Ustring& str) const {
+        str = replace(str);
+    }
+
+}
@@ -1,13 +1,16 @@
 #pragma once
 
 #include "unicorn/character.hpp"
+#include "unicorn/collate.hpp"
 #include "unicorn/segment.hpp"
 #include "unicorn/utf.hpp"
 #include "unicorn/utility.hpp"
 #include <algorithm>
+#include <array>
 #include <cerrno>
 #include <cmath>
 #include <cstring>
+#include <functional>
 #include <initializer_list>
 #include <iterator>
 #include <limits>
@@ -57,7 +60,7 @@ namespace RS::Unicorn {
     void str_append(Ustring& dst, const C* ptr, size_t n) {
         if (ptr)
             for (auto out = utf_writer(dst); n > 0; --n, ++ptr)
-                *out = char_to_uint(*ptr++);
+                *out = char_to_uint(*ptr);
     }
 
     template <typename C>
@@ -289,6 +292,7 @@ namespace RS::Unicorn {
         int do_compare_basic(const Ustring& lhs, const Ustring& rhs);
         int do_compare_icase(const Ustring& lhs, const Ustring& rhs);
         int do_compare_natural(const Ustring& lhs, const Ustring& rhs);
+        int do_compare_collate(const Ustring& lhs, const Ustring& rhs, uint32_t flags);  // Defined in collate.cpp
 
     }
 
@@ -299,6 +303,7 @@ namespace RS::Unicorn {
         static constexpr uint32_t fallback  = setbit<3>;
         static constexpr uint32_t icase     = setbit<4>;
         static constexpr uint32_t natural   = setbit<5>;
+        static constexpr uint32_t collate   = setbit<6>;
     };
 
     template <uint32_t Flags>
@@ -309,17 +314,21 @@ namespace RS::Unicorn {
         static constexpr bool fallback = (Flags & Strcmp::fallback) != 0;
         static constexpr bool icase = (Flags & Strcmp::icase) != 0;
         static constexpr bool natural = (Flags & Strcmp::natural) != 0;
+        static constexpr bool collate = (Flags & Strcmp::collate) != 0;
         static_assert(int(equal) + int(less) + int(triple) == 1, "Invalid string comparison flags");
+        static_assert(! (natural && collate), "Invalid string comparison flags");
         using result_type = std::conditional_t<triple, int, bool>;
         result_type operator()(const Ustring& lhs, const Ustring& rhs) const {
             using namespace UnicornDetail;
             int c = 0;
+            if constexpr (collate)
+                c = do_compare_collate(lhs, rhs, icase ? Collate::secondary : 0);
             if constexpr (natural)
                 c = do_compare_natural(lhs, rhs);
-            if constexpr (icase)
+            if constexpr (icase && ! collate)
                 if (c == 0)
                     c = do_compare_icase(lhs, rhs);
-            if constexpr (fallback || (! icase && ! natural))
+            if constexpr (fallback || (! icase && ! natural && ! collate))
                 if (c == 0)
                     c = do_compare_basic(lhs, rhs);
             if constexpr (equal)
@@ -331,9 +340,38 @@ namespace RS::Unicorn {
         }
     };
 
+    class CasefoldKey:
+    public LessThanComparable<CasefoldKey> {
+    public:
+        CasefoldKey() = default;
+        explicit CasefoldKey(const Ustring& str);
+        explicit CasefoldKey(Ustring&& str);
+        const Ustring& str() const noexcept { return orig; }
+        const Ustring& key() const noexcept { return folded; }
+        int compare(const CasefoldKey& rhs) const noexcept { int c = folded.compare(rhs.folded); return c < 0 ? -1 : c == 0 ? 0 : 1; }
+        size_t hash() const noexcept { return std::hash<Ustring>()(folded); }
+        friend bool operator==(const CasefoldKey& lhs, const CasefoldKey& rhs) noexcept { return lhs.folded == rhs.folded; }
+        friend bool operator<(const CasefoldKey& lhs, const CasefoldKey& rhs) noexcept { return lhs.folded < rhs.folded; }
+    private:
+        Ustring orig;
+        Ustring folded;
+    };
+
+    using SortKeyFunction = std::function<Ustring(const Ustring&)>;
+
+    Ustring natural_sort_key(const Ustring& str, uint32_t flags = 0);
+    void str_sort_by_key(Strings& list, const SortKeyFunction& key, size_t threads = 0);
+    void str_sort_natural(Strings& list, uint32_t flags = 0, size_t threads = 0);
+
     // Other string algorithms
     // Defined in string-algorithm.cpp
 
+    namespace UnicornDetail {
+
+        size_t find_substring(std::string_view str, std::string_view target, size_t pos = 0, size_t end = npos) noexcept;
+
+    }
+
     size_t str_common(const Ustring& s1, const Ustring& s2, size_t start = 0) noexcept;
     size_t str_common_utf(const Ustring& s1, const Ustring& s2, size_t start = 0) noexcept;
     bool str_expect(Utf8Iterator& i, const Utf8Iterator& end, const Ustring& prefix);
@@ -360,9 +398,68 @@ namespace RS::Unicorn {
     Irange<Utf8Iterator> str_search(const Utf8Iterator& b, const Utf8Iterator& e, const Ustring& target);
     Irange<Utf8Iterator> str_search(const Irange<Utf8Iterator>& range, const Ustring& target);
     Irange<Utf8Iterator> str_search(const Ustring& str, const Ustring& target);
+    Irange<Utf8Iterator> str_search_icase(const Utf8Iterator& b, const Utf8Iterator& e, const Ustring& target);
+    Irange<Utf8Iterator> str_search_icase(const Irange<Utf8Iterator>& range, const Ustring& target);
+    Irange<Utf8Iterator> str_search_icase(const Ustring& str, const Ustring& target);
+    std::vector<Irange<Utf8Iterator>> str_search_all_icase(const Utf8Iterator& b, const Utf8Iterator& e, const Ustring& target);
+    std::vector<Irange<Utf8Iterator>> str_search_all_icase(const Irange<Utf8Iterator>& range, const Ustring& target);
+    std::vector<Irange<Utf8Iterator>> str_search_all_icase(const Ustring& str, const Ustring& target);
     size_t str_skipws(Utf8Iterator& i, const Utf8Iterator& end);
     size_t str_skipws(Utf8Iterator& i);
 
+    // Multiple string search
+    // Defined in string-search.cpp
+
+    class MultiSearcher {
+    public:
+        struct match_type {
+            size_t offset = npos;  // Byte offset of the match in the subject string
+            size_t count = 0;      // Length of the match in bytes
+            size_t index = npos;   // Index of the matching pattern
+            explicit operator bool() const noexcept { return offset != npos; }
+        };
+        using match_list = std::vector<match_type>;
+        static constexpr uint32_t icase = setbit<0>;  // Match case insensitively, using full case folding
+        MultiSearcher() = default;
+        explicit MultiSearcher(const Strings& patterns, uint32_t flags = 0);
+        bool empty() const noexcept { return pats.empty(); }
+        uint32_t flags() const noexcept { return sflags; }
+        const Strings& patterns() const noexcept { return pats; }
+        size_t size() const noexcept { return pats.size(); }
+        size_t count(const Ustring& str) const;
+        match_type find(const Ustring& str, size_t pos = 0) const;
+        match_list find_all(const Ustring& str, size_t pos = 0) const;
+    private:
+        friend class MultiReplacer;
+        Strings pats;                            // Patterns as supplied
+        uint32_t sflags = 0;                     // Search flags
+        std::array<uint16_t, 256> classes = {};  // Byte classes used to index the transition table
+        size_t nclasses = 0;                     // Number of byte classes
+        std::vector<uint32_t> delta;             // Transition table (state * nclasses + class => state)
+        std::vector<uint32_t> depth;             // Length of the path to each state
+        std::vector<uint32_t> output;            // Index of the pattern ending at each state, or no_output
+        std::vector<uint32_t> dict;              // Next state along the failure chain with an output, or 0
+        std::array<bool, 256> starts = {};       // Bytes that can start a match
+        int first_byte = -1;                     // The only byte that can start a match, if there is just one
+        template <typename F> void scan(const Ustring& str, size_t pos, F emit) const;
+        template <typename A, typename F> void scan_text(const char* text, size_t size, size_t pos, A accept, F emit) const;
+        size_t skip(const char* text, size_t size, size_t pos) const noexcept;
+    };
+
+    class MultiReplacer {
+    public:
+        MultiReplacer() = default;
+        MultiReplacer(const Strings& patterns, const Strings& substitutes, uint32_t flags = 0);
+        uint32_t flags() const noexcept { return search.flags(); }
+        const MultiSearcher& searcher() const noexcept { return search; }
+        const Strings& substitutes() const noexcept { return subs; }
+        Ustring replace(const Ustring& str) const;
+        void replace_in(Ustring& str) const;
+    private:
+        MultiSearcher search;
+        Strings subs;
+    };
+
     // String manipulation functions
     // Defined in string-manip.cpp
 
@@ -372,14 +469,45 @@ namespace RS::Unicorn {
 
         Ustring expand_tabs(const Ustring& str, const std::vector<size_t>& tabs, uint32_t flags);
 
-        template <typename DS>
-        void concat_helper(Ustring&, const DS&) {}
+        // Concatenation functions measure their arguments first so the
+        // result can be allocated once. The measured size is exact for UTF-8
+        // strings and a lower bound for other encodings (one byte per code
+        // unit); anything else counts as zero and is left to grow normally.
+
+        template <typename S>
+        size_t concat_size(const S& s) noexcept {
+            if constexpr (std::is_pointer_v<std::decay_t<S>>)
+                return cstr_size(s);
+            else if constexpr (std::is_convertible_v<const S&, std::string_view>)
+                return std::string_view(s).size();
+            else
+                return 0;
+        }
+
+        template <typename C>
+        size_t concat_size(const std::basic_string<C>& s) noexcept {
+            return s.size();
+        }
+
+        inline void concat_reserve(Ustring& dst, size_t n) {
+            // Keep geometric growth when appending to the same buffer repeatedly
+            if (n > dst.capacity())
+                dst.reserve(std::max(n, 2 * dst.capacity()));
+        }
+
+        template <typename... Strings>
+        void concat_append(Ustring& dst, const Strings&... ss) {
+            concat_reserve(dst, dst.size() + (concat_size(ss) + ... + size_t(0)));
+            (str_append(dst, ss), ...);
+        }
+
+        inline void concat_with_append(Ustring&, std::string_view) {}
 
-        template <typename DS, typename S2, typename... Strings>
-        void concat_helper(Ustring& s1, const DS& delim, const S2& s2, const Strings&... ss) {
-            str_append(s1, delim);
-            str_append(s1, s2);
-            concat_helper(s1, delim, ss...);
+        template <typename S1, typename... Strings>
+        void concat_with_append(Ustring& dst, std::string_view delim, const S1& s1, const Strings&... ss) {
+            concat_reserve(dst, dst.size() + concat_size(s1) + (concat_size(ss) + ... + size_t(0)) + sizeof...(ss) * delim.size());
+            str_append(dst, s1);
+            ((dst += delim, str_append(dst, ss)), ...);
         }
 
         template <typename Pred>
@@ -425,8 +553,51 @@ namespace RS::Unicorn {
             src.erase(0, i.offset());
         }
 
+        template <typename Pred>
+        void remove_in_helper(Ustring& src, Pred p) {
+            // Move each run of kept characters down over the removed ones;
+            // the write position never passes the read position
+            auto i = utf_begin(src), e = utf_end(src);
+            size_t out = 0;
+            while (i != e) {
+                auto j = std::find_if(i, e, p);
+                size_t n = j.offset() - i.offset();
+                if (n != 0 && out != i.offset())
+                    std::memmove(src.data() + out, src.data() + i.offset(), n);
+                out += n;
+                if (j == e)
+                    break;
+                i = std::find_if_not(j, e, p);
+            }
+            src.resize(out);
+        }
+
     }
 
+    class SplitIterator:
+    public ForwardIterator<SplitIterator, const std::string_view> {
+    public:
+        enum class mode: uint8_t { whitespace, at, by, lines };
+        SplitIterator() = default;
+        SplitIterator(std::string_view src, mode m, std::string_view delim = {});
+        const std::string_view& operator*() const noexcept { return field; }
+        SplitIterator& operator++();
+        bool operator==(const SplitIterator& rhs) const noexcept { return done == rhs.done && (done || field.data() == rhs.field.data()); }
+    private:
+        std::string_view text;            // Source string
+        Ustring delim;                    // Delimiter string, or set of delimiter characters
+        std::string_view field;           // Current field
+        size_t next = npos;               // Start of the next field, or npos if the current one is the last
+        uint64_t ascii_set[2] = {0, 0};   // ASCII delimiter characters
+        int single = -1;                  // The only delimiter, if there is just one and it is ASCII
+        bool unicode = false;             // Non-ASCII characters can be delimiters
+        mode smode = mode::whitespace;    // Splitting mode
+        bool done = true;                 // End of range
+        bool is_delim(size_t pos, size_t& len) const noexcept;
+        size_t find_delim(size_t pos) const noexcept;
+        size_t skip_delims(size_t pos) const noexcept;
+    };
+
     Ustring str_drop_prefix(const Ustring& str, const Ustring& prefix);
     void str_drop_prefix_in(Ustring& str, const Ustring& prefix) noexcept;
     Ustring str_drop_suffix(const Ustring& str, const Ustring& suffix);
@@ -472,6 +643,10 @@ namespace RS::Unicorn {
     Strings str_splitv_at(const Ustring& src, const Ustring& delim);
     Strings str_splitv_by(const Ustring& src, const Ustring& delim);
     Strings str_splitv_lines(const Ustring& src);
+    Irange<SplitIterator> str_split_view(std::string_view src);
+    Irange<SplitIterator> str_split_at_view(std::string_view src, std::string_view delim);
+    Irange<SplitIterator> str_split_by_view(std::string_view src, std::string_view delim);
+    Irange<SplitIterator> str_split_lines_view(std::string_view src);
     Ustring str_squeeze(const Ustring& str);
     Ustring str_squeeze(const Ustring& str, const Ustring& chars);
     Ustring str_squeeze_trim(const Ustring& str);
@@ -560,55 +735,52 @@ namespace RS::Unicorn {
         w.wrap_in(str);
     }
 
-    template <typename C, typename... Strings>
-    Ustring str_concat(const std::basic_string<C>& s, const Strings&... ss) {
-        Ustring result;
-        UnicornDetail::concat_helper(result, std::basic_string<C>(), s, ss...);
-        return result;
+    template <typename... Strings>
+    void str_append_concat(Ustring& dst, const Strings&... ss) {
+        UnicornDetail::concat_append(dst, ss...);
     }
 
     template <typename C, typename... Strings>
-    Ustring str_concat(const C* s, const Strings&... ss) {
-        Ustring result;
-        UnicornDetail::concat_helper(result, std::basic_string<C>(), cstr(s), ss...);
-        return result;
-    }
-
-    template <typename C>
-    Ustring str_concat_with(const std::basic_string<C>& /*delim*/) {
-        return {};
+    void str_append_concat_with(Ustring& dst, const std::basic_string<C>& delim, const Strings&... ss) {
+        if constexpr (std::is_same_v<C, char>)
+            UnicornDetail::concat_with_append(dst, delim, ss...);
+        else
+            UnicornDetail::concat_with_append(dst, to_utf8(delim), ss...);
     }
 
-    template <typename C>
-    Ustring str_concat_with(const C* /*delim*/) {
-        return {};
+    template <typename C, typename... Strings>
+    void str_append_concat_with(Ustring& dst, const C* delim, const Strings&... ss) {
+        if constexpr (std::is_same_v<C, char>)
+            UnicornDetail::concat_with_append(dst, std::string_view(delim, cstr_size(delim)), ss...);
+        else
+            UnicornDetail::concat_with_append(dst, to_utf8(cstr(delim)), ss...);
     }
 
-    template <typename C1, typename C2, typename... Strings>
-    Ustring str_concat_with(const std::basic_string<C1>& delim, const std::basic_string<C2>& s, const Strings&... ss) {
-        Ustring result = to_utf8(s);
-        UnicornDetail::concat_helper(result, delim, ss...);
+    template <typename C, typename... Strings>
+    Ustring str_concat(const std::basic_string<C>& s, const Strings&... ss) {
+        Ustring result;
+        UnicornDetail::concat_append(result, s, ss...);
         return result;
     }
 
-    template <typename C1, typename C2, typename... Strings>
-    Ustring str_concat_with(const std::basic_string<C1>& delim, const C2* s, const Strings&... ss) {
-        Ustring result = to_utf8(cstr(s));
-        UnicornDetail::concat_helper(result, delim, ss...);
+    template <typename C, typename... Strings>
+    Ustring str_concat(const C* s, const Strings&... ss) {
+        Ustring result;
+        UnicornDetail::concat_append(result, s, ss...);
         return result;
     }
 
-    template <typename C1, typename C2, typename... Strings>
-    Ustring str_concat_with(const C1* delim, const std::basic_string<C2>& s, const Strings&... ss) {
-        Ustring result = to_utf8(s);
-        UnicornDetail::concat_helper(result, cstr(delim), ss...);
+    template <typename C, typename... Strings>
+    Ustring str_concat_with(const std::basic_string<C>& delim, const Strings&... ss) {
+        Ustring result;
+        str_append_concat_with(result, delim, ss...);
         return result;
     }
 
-    template <typename C1, typename C2, typename... Strings>
-    Ustring str_concat_with(const C1* delim, const C2* s, const Strings&... ss) {
-        Ustring result = to_utf8(cstr(s));
-        UnicornDetail::concat_helper(result, cstr(delim), ss...);
+    template <typename C, typename... Strings>
+    Ustring str_concat_with(const C* delim, const Strings&... ss) {
+        Ustring result;
+        str_append_concat_with(result, delim, ss...);
         return result;
     }
 
@@ -637,16 +809,37 @@ namespace RS::Unicorn {
     }
 
     template <typename FwdRange>
-    Ustring str_join(const FwdRange& r, const Ustring& delim, bool term = false) {
+    void str_append_join(Ustring& dst, const FwdRange& r, const Ustring& delim, bool term = false) {
         using std::begin;
         using std::end;
-        Ustring dst;
-        for (auto& s: r) {
-            dst += s;
+        auto b = begin(r), e = end(r);
+        if (b == e)
+            return;
+        using category = typename std::iterator_traits<decltype(b)>::iterator_category;
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+            size_t n = 0, count = 0;
+            for (auto i = b; i != e; ++i, ++count)
+                n += UnicornDetail::concat_size(*i);
+            UnicornDetail::concat_reserve(dst, dst.size() + n + (term ? count : count - 1) * delim.size());
+        }
+        dst += *b;
+        for (auto i = std::next(b); i != e; ++i) {
             dst += delim;
+            dst += *i;
         }
-        if (! term && ! dst.empty() && ! delim.empty())
-            dst.resize(dst.size() - delim.size());
+        if (term)
+            dst += delim;
+    }
+
+    template <typename FwdRange>
+    void str_append_join(Ustring& dst, const FwdRange& r) {
+        str_append_join(dst, r, Ustring());
+    }
+
+    template <typename FwdRange>
+    Ustring str_join(const FwdRange& r, const Ustring& delim, bool term = false) {
+        Ustring dst;
+        str_append_join(dst, r, delim, term);
         return dst;
     }
 
@@ -671,16 +864,12 @@ namespace RS::Unicorn {
 
     template <typename Pred>
     void str_remove_in_if(Ustring& str, Pred p) {
-        Ustring dst;
-        std::copy_if(utf_begin(str), utf_end(str), utf_writer(dst), [p] (char32_t x) { return ! p(x); });
-        str.swap(dst);
+        UnicornDetail::remove_in_helper(str, p);
     }
 
     template <typename Pred>
     void str_remove_in_if_not(Ustring& str, Pred p) {
-        Ustring dst;
-        std::copy_if(utf_begin(str), utf_end(str), utf_writer(dst), p);
-        str.swap(dst);
+        UnicornDetail::remove_in_helper(str, [p] (char32_t x) { return ! p(x); });
     }
 
     template <typename OutIter>
@@ -704,7 +893,7 @@ namespace RS::Unicorn {
         }
         size_t i = 0, dsize = delim.size();
         for (;;) {
-            auto j = src.find(delim, i);
+            auto j = UnicornDetail::find_substring(src, delim, i);
             if (j == npos) {
                 *dst++ = src.substr(i);
                 break;
@@ -1080,3 +1269,5 @@ namespace RS::Unicorn {
     }
 
 }
+
+RS_DEFINE_STD_HASH(RS::Unicorn::CasefoldKey);
@@ -3533,4 +3533,10568 @@ const std::array<KeyValue<char32_t, std::array<char32_t, 3>>, 104> full_casefold
 
 const TableView<char32_t, std::array<char32_t, 3>> full_casefold_table {&full_casefold_array[0], &full_casefold_array[0] + full_casefold_array.size()};
 
+const std::array<KeyValue<char32_t, std::array<char32_t, 3>>, 10482> short_nfkc_casefold_array = {{
+{0x41,{{0x61,0x0,0x0}}},
+{0x42,{{0x62,0x0,0x0}}},
+{0x43,{{0x63,0x0,0x0}}},
+{0x44,{{0x64,0x0,0x0}}},
+{0x45,{{0x65,0x0,0x0}}},
+{0x46,{{0x66,0x0,0x0}}},
+{0x47,{{0x67,0x0,0x0}}},
+{0x48,{{0x68,0x0,0x0}}},
+{0x49,{{0x69,0x0,0x0}}},
+{0x4a,{{0x6a,0x0,0x0}}},
+{0x4b,{{0x6b,0x0,0x0}}},
+{0x4c,{{0x6c,0x0,0x0}}},
+{0x4d,{{0x6d,0x0,0x0}}},
+{0x4e,{{0x6e,0x0,0x0}}},
+{0x4f,{{0x6f,0x0,0x0}}},
+{0x50,{{0x70,0x0,0x0}}},
+{0x51,{{0x71,0x0,0x0}}},
+{0x52,{{0x72,0x0,0x0}}},
+{0x53,{{0x73,0x0,0x0}}},
+{0x54,{{0x74,0x0,0x0}}},
+{0x55,{{0x75,0x0,0x0}}},
+{0x56,{{0x76,0x0,0x0}}},
+{0x57,{{0x77,0x0,0x0}}},
+{0x58,{{0x78,0x0,0x0}}},
+{0x59,{{0x79,0x0,0x0}}},
+{0x5a,{{0x7a,0x0,0x0}}},
+{0xa0,{{0x20,0x0,0x0}}},
+{0xa8,{{0x20,0x308,0x0}}},
+{0xaa,{{0x61,0x0,0x0}}},
+{0xad,{{0x0,0x0,0x0}}},
+{0xaf,{{0x20,0x304,0x0}}},
+{0xb2,{{0x32,0x0,0x0}}},
+{0xb3,{{0x33,0x0,0x0}}},
+{0xb4,{{0x20,0x301,0x0}}},
+{0xb5,{{0x3bc,0x0,0x0}}},
+{0xb8,{{0x20,0x327,0x0}}},
+{0xb9,{{0x31,0x0,0x0}}},
+{0xba,{{0x6f,0x0,0x0}}},
+{0xbc,{{0x31,0x2044,0x34}}},
+{0xbd,{{0x31,0x2044,0x32}}},
+{0xbe,{{0x33,0x2044,0x34}}},
+{0xc0,{{0xe0,0x0,0x0}}},
+{0xc1,{{0xe1,0x0,0x0}}},
+{0xc2,{{0xe2,0x0,0x0}}},
+{0xc3,{{0xe3,0x0,0x0}}},
+{0xc4,{{0xe4,0x0,0x0}}},
+{0xc5,{{0xe5,0x0,0x0}}},
+{0xc6,{{0xe6,0x0,0x0}}},
+{0xc7,{{0xe7,0x0,0x0}}},
+{0xc8,{{0xe8,0x0,0x0}}},
+{0xc9,{{0xe9,0x0,0x0}}},
+{0xca,{{0xea,0x0,0x0}}},
+{0xcb,{{0xeb,0x0,0x0}}},
+{0xcc,{{0xec,0x0,0x0}}},
+{0xcd,{{0xed,0x0,0x0}}},
+{0xce,{{0xee,0x0,0x0}}},
+{0xcf,{{0xef,0x0,0x0}}},
+{0xd0,{{0xf0,0x0,0x0}}},
+{0xd1,{{0xf1,0x0,0x0}}},
+{0xd2,{{0xf2,0x0,0x0}}},
+{0xd3,{{0xf3,0x0,0x0}}},
+{0xd4,{{0xf4,0x0,0x0}}},
+{0xd5,{{0xf5,0x0,0x0}}},
+{0xd6,{{0xf6,0x0,0x0}}},
+{0xd8,{{0xf8,0x0,0x0}}},
+{0xd9,{{0xf9,0x0,0x0}}},
+{0xda,{{0xfa,0x0,0x0}}},
+{0xdb,{{0xfb,0x0,0x0}}},
+{0xdc,{{0xfc,0x0,0x0}}},
+{0xdd,{{0xfd,0x0,0x0}}},
+{0xde,{{0xfe,0x0,0x0}}},
+{0xdf,{{0x73,0x73,0x0}}},
+{0x100,{{0x101,0x0,0x0}}},
+{0x102,{{0x103,0x0,0x0}}},
+{0x104,{{0x105,0x0,0x0}}},
+{0x106,{{0x107,0x0,0x0}}},
+{0x108,{{0x109,0x0,0x0}}},
+{0x10a,{{0x10b,0x0,0x0}}},
+{0x10c,{{0x10d,0x0,0x0}}},
+{0x10e,{{0x10f,0x0,0x0}}},
+{0x110,{{0x111,0x0,0x0}}},
+{0x112,{{0x113,0x0,0x0}}},
+{0x114,{{0x115,0x0,0x0}}},
+{0x116,{{0x117,0x0,0x0}}},
+{0x118,{{0x119,0x0,0x0}}},
+{0x11a,{{0x11b,0x0,0x0}}},
+{0x11c,{{0x11d,0x0,0x0}}},
+{0x11e,{{0x11f,0x0,0x0}}},
+{0x120,{{0x121,0x0,0x0}}},
+{0x122,{{0x123,0x0,0x0}}},
+{0x124,{{0x125,0x0,0x0}}},
+{0x126,{{0x127,0x0,0x0}}},
+{0x128,{{0x129,0x0,0x0}}},
+{0x12a,{{0x12b,0x0,0x0}}},
+{0x12c,{{0x12d,0x0,0x0}}},
+{0x12e,{{0x12f,0x0,0x0}}},
+{0x130,{{0x69,0x307,0x0}}},
+{0x132,{{0x69,0x6a,0x0}}},
+{0x133,{{0x69,0x6a,0x0}}},
+{0x134,{{0x135,0x0,0x0}}},
+{0x136,{{0x137,0x0,0x0}}},
+{0x139,{{0x13a,0x0,0x0}}},
+{0x13b,{{0x13c,0x0,0x0}}},
+{0x13d,{{0x13e,0x0,0x0}}},
+{0x13f,{{0x6c,0xb7,0x0}}},
+{0x140,{{0x6c,0xb7,0x0}}},
+{0x141,{{0x142,0x0,0x0}}},
+{0x143,{{0x144,0x0,0x0}}},
+{0x145,{{0x146,0x0,0x0}}},
+{0x147,{{0x148,0x0,0x0}}},
+{0x149,{{0x2bc,0x6e,0x0}}},
+{0x14a,{{0x14b,0x0,0x0}}},
+{0x14c,{{0x14d,0x0,0x0}}},
+{0x14e,{{0x14f,0x0,0x0}}},
+{0x150,{{0x151,0x0,0x0}}},
+{0x152,{{0x153,0x0,0x0}}},
+{0x154,{{0x155,0x0,0x0}}},
+{0x156,{{0x157,0x0,0x0}}},
+{0x158,{{0x159,0x0,0x0}}},
+{0x15a,{{0x15b,0x0,0x0}}},
+{0x15c,{{0x15d,0x0,0x0}}},
+{0x15e,{{0x15f,0x0,0x0}}},
+{0x160,{{0x161,0x0,0x0}}},
+{0x162,{{0x163,0x0,0x0}}},
+{0x164,{{0x165,0x0,0x0}}},
+{0x166,{{0x167,0x0,0x0}}},
+{0x168,{{0x169,0x0,0x0}}},
+{0x16a,{{0x16b,0x0,0x0}}},
+{0x16c,{{0x16d,0x0,0x0}}},
+{0x16e,{{0x16f,0x0,0x0}}},
+{0x170,{{0x171,0x0,0x0}}},
+{0x172,{{0x173,0x0,0x0}}},
+{0x174,{{0x175,0x0,0x0}}},
+{0x176,{{0x177,0x0,0x0}}},
+{0x178,{{0xff,0x0,0x0}}},
+{0x179,{{0x17a,0x0,0x0}}},
+{0x17b,{{0x17c,0x0,0x0}}},
+{0x17d,{{0x17e,0x0,0x0}}},
+{0x17f,{{0x73,0x0,0x0}}},
+{0x181,{{0x253,0x0,0x0}}},
+{0x182,{{0x183,0x0,0x0}}},
+{0x184,{{0x185,0x0,0x0}}},
+{0x186,{{0x254,0x0,0x0}}},
+{0x187,{{0x188,0x0,0x0}}},
+{0x189,{{0x256,0x0,0x0}}},
+{0x18a,{{0x257,0x0,0x0}}},
+{0x18b,{{0x18c,0x0,0x0}}},
+{0x18e,{{0x1dd,0x0,0x0}}},
+{0x18f,{{0x259,0x0,0x0}}},
+{0x190,{{0x25b,0x0,0x0}}},
+{0x191,{{0x192,0x0,0x0}}},
+{0x193,{{0x260,0x0,0x0}}},
+{0x194,{{0x263,0x0,0x0}}},
+{0x196,{{0x269,0x0,0x0}}},
+{0x197,{{0x268,0x0,0x0}}},
+{0x198,{{0x199,0x0,0x0}}},
+{0x19c,{{0x26f,0x0,0x0}}},
+{0x19d,{{0x272,0x0,0x0}}},
+{0x19f,{{0x275,0x0,0x0}}},
+{0x1a0,{{0x1a1,0x0,0x0}}},
+{0x1a2,{{0x1a3,0x0,0x0}}},
+{0x1a4,{{0x1a5,0x0,0x0}}},
+{0x1a6,{{0x280,0x0,0x0}}},
+{0x1a7,{{0x1a8,0x0,0x0}}},
+{0x1a9,{{0x283,0x0,0x0}}},
+{0x1ac,{{0x1ad,0x0,0x0}}},
+{0x1ae,{{0x288,0x0,0x0}}},
+{0x1af,{{0x1b0,0x0,0x0}}},
+{0x1b1,{{0x28a,0x0,0x0}}},
+{0x1b2,{{0x28b,0x0,0x0}}},
+{0x1b3,{{0x1b4,0x0,0x0}}},
+{0x1b5,{{0x1b6,0x0,0x0}}},
+{0x1b7,{{0x292,0x0,0x0}}},
+{0x1b8,{{0x1b9,0x0,0x0}}},
+{0x1bc,{{0x1bd,0x0,0x0}}},
+{0x1c4,{{0x64,0x17e,0x0}}},
+{0x1c5,{{0x64,0x17e,0x0}}},
+{0x1c6,{{0x64,0x17e,0x0}}},
+{0x1c7,{{0x6c,0x6a,0x0}}},
+{0x1c8,{{0x6c,0x6a,0x0}}},
+{0x1c9,{{0x6c,0x6a,0x0}}},
+{0x1ca,{{0x6e,0x6a,0x0}}},
+{0x1cb,{{0x6e,0x6a,0x0}}},
+{0x1cc,{{0x6e,0x6a,0x0}}},
+{0x1cd,{{0x1ce,0x0,0x0}}},
+{0x1cf,{{0x1d0,0x0,0x0}}},
+{0x1d1,{{0x1d2,0x0,0x0}}},
+{0x1d3,{{0x1d4,0x0,0x0}}},
+{0x1d5,{{0x1d6,0x0,0x0}}},
+{0x1d7,{{0x1d8,0x0,0x0}}},
+{0x1d9,{{0x1da,0x0,0x0}}},
+{0x1db,{{0x1dc,0x0,0x0}}},
+{0x1de,{{0x1df,0x0,0x0}}},
+{0x1e0,{{0x1e1,0x0,0x0}}},
+{0x1e2,{{0x1e3,0x0,0x0}}},
+{0x1e4,{{0x1e5,0x0,0x0}}},
+{0x1e6,{{0x1e7,0x0,0x0}}},
+{0x1e8,{{0x1e9,0x0,0x0}}},
+{0x1ea,{{0x1eb,0x0,0x0}}},
+{0x1ec,{{0x1ed,0x0,0x0}}},
+{0x1ee,{{0x1ef,0x0,0x0}}},
+{0x1f1,{{0x64,0x7a,0x0}}},
+{0x1f2,{{0x64,0x7a,0x0}}},
+{0x1f3,{{0x64,0x7a,0x0}}},
+{0x1f4,{{0x1f5,0x0,0x0}}},
+{0x1f6,{{0x195,0x0,0x0}}},
+{0x1f7,{{0x1bf,0x0,0x0}}},
+{0x1f8,{{0x1f9,0x0,0x0}}},
+{0x1fa,{{0x1fb,0x0,0x0}}},
+{0x1fc,{{0x1fd,0x0,0x0}}},
+{0x1fe,{{0x1ff,0x0,0x0}}},
+{0x200,{{0x201,0x0,0x0}}},
+{0x202,{{0x203,0x0,0x0}}},
+{0x204,{{0x205,0x0,0x0}}},
+{0x206,{{0x207,0x0,0x0}}},
+{0x208,{{0x209,0x0,0x0}}},
+{0x20a,{{0x20b,0x0,0x0}}},
+{0x20c,{{0x20d,0x0,0x0}}},
+{0x20e,{{0x20f,0x0,0x0}}},
+{0x210,{{0x211,0x0,0x0}}},
+{0x212,{{0x213,0x0,0x0}}},
+{0x214,{{0x215,0x0,0x0}}},
+{0x216,{{0x217,0x0,0x0}}},
+{0x218,{{0x219,0x0,0x0}}},
+{0x21a,{{0x21b,0x0,0x0}}},
+{0x21c,{{0x21d,0x0,0x0}}},
+{0x21e,{{0x21f,0x0,0x0}}},
+{0x220,{{0x19e,0x0,0x0}}},
+{0x222,{{0x223,0x0,0x0}}},
+{0x224,{{0x225,0x0,0x0}}},
+{0x226,{{0x227,0x0,0x0}}},
+{0x228,{{0x229,0x0,0x0}}},
+{0x22a,{{0x22b,0x0,0x0}}},
+{0x22c,{{0x22d,0x0,0x0}}},
+{0x22e,{{0x22f,0x0,0x0}}},
+{0x230,{{0x231,0x0,0x0}}},
+{0x232,{{0x233,0x0,0x0}}},
+{0x23a,{{0x2c65,0x0,0x0}}},
+{0x23b,{{0x23c,0x0,0x0}}},
+{0x23d,{{0x19a,0x0,0x0}}},
+{0x23e,{{0x2c66,0x0,0x0}}},
+{0x241,{{0x242,0x0,0x0}}},
+{0x243,{{0x180,0x0,0x0}}},
+{0x244,{{0x289,0x0,0x0}}},
+{0x245,{{0x28c,0x0,0x0}}},
+{0x246,{{0x247,0x0,0x0}}},
+{0x248,{{0x249,0x0,0x0}}},
+{0x24a,{{0x24b,0x0,0x0}}},
+{0x24c,{{0x24d,0x0,0x0}}},
+{0x24e,{{0x24f,0x0,0x0}}},
+{0x2b0,{{0x68,0x0,0x0}}},
+{0x2b1,{{0x266,0x0,0x0}}},
+{0x2b2,{{0x6a,0x0,0x0}}},
+{0x2b3,{{0x72,0x0,0x0}}},
+{0x2b4,{{0x279,0x0,0x0}}},
+{0x2b5,{{0x27b,0x0,0x0}}},
+{0x2b6,{{0x281,0x0,0x0}}},
+{0x2b7,{{0x77,0x0,0x0}}},
+{0x2b8,{{0x79,0x0,0x0}}},
+{0x2d8,{{0x20,0x306,0x0}}},
+{0x2d9,{{0x20,0x307,0x0}}},
+{0x2da,{{0x20,0x30a,0x0}}},
+{0x2db,{{0x20,0x328,0x0}}},
+{0x2dc,{{0x20,0x303,0x0}}},
+{0x2dd,{{0x20,0x30b,0x0}}},
+{0x2e0,{{0x263,0x0,0x0}}},
+{0x2e1,{{0x6c,0x0,0x0}}},
+{0x2e2,{{0x73,0x0,0x0}}},
+{0x2e3,{{0x78,0x0,0x0}}},
+{0x2e4,{{0x295,0x0,0x0}}},
+{0x340,{{0x300,0x0,0x0}}},
+{0x341,{{0x301,0x0,0x0}}},
+{0x343,{{0x313,0x0,0x0}}},
+{0x344,{{0x308,0x301,0x0}}},
+{0x345,{{0x3b9,0x0,0x0}}},
+{0x34f,{{0x0,0x0,0x0}}},
+{0x370,{{0x371,0x0,0x0}}},
+{0x372,{{0x373,0x0,0x0}}},
+{0x374,{{0x2b9,0x0,0x0}}},
+{0x376,{{0x377,0x0,0x0}}},
+{0x37a,{{0x20,0x3b9,0x0}}},
+{0x37e,{{0x3b,0x0,0x0}}},
+{0x37f,{{0x3f3,0x0,0x0}}},
+{0x384,{{0x20,0x301,0x0}}},
+{0x385,{{0x20,0x308,0x301}}},
+{0x386,{{0x3ac,0x0,0x0}}},
+{0x387,{{0xb7,0x0,0x0}}},
+{0x388,{{0x3ad,0x0,0x0}}},
+{0x389,{{0x3ae,0x0,0x0}}},
+{0x38a,{{0x3af,0x0,0x0}}},
+{0x38c,{{0x3cc,0x0,0x0}}},
+{0x38e,{{0x3cd,0x0,0x0}}},
+{0x38f,{{0x3ce,0x0,0x0}}},
+{0x391,{{0x3b1,0x0,0x0}}},
+{0x392,{{0x3b2,0x0,0x0}}},
+{0x393,{{0x3b3,0x0,0x0}}},
+{0x394,{{0x3b4,0x0,0x0}}},
+{0x395,{{0x3b5,0x0,0x0}}},
+{0x396,{{0x3b6,0x0,0x0}}},
+{0x397,{{0x3b7,0x0,0x0}}},
+{0x398,{{0x3b8,0x0,0x0}}},
+{0x399,{{0x3b9,0x0,0x0}}},
+{0x39a,{{0x3ba,0x0,0x0}}},
+{0x39b,{{0x3bb,0x0,0x0}}},
+{0x39c,{{0x3bc,0x0,0x0}}},
+{0x39d,{{0x3bd,0x0,0x0}}},
+{0x39e,{{0x3be,0x0,0x0}}},
+{0x39f,{{0x3bf,0x0,0x0}}},
+{0x3a0,{{0x3c0,0x0,0x0}}},
+{0x3a1,{{0x3c1,0x0,0x0}}},
+{0x3a3,{{0x3c3,0x0,0x0}}},
+{0x3a4,{{0x3c4,0x0,0x0}}},
+{0x3a5,{{0x3c5,0x0,0x0}}},
+{0x3a6,{{0x3c6,0x0,0x0}}},
+{0x3a7,{{0x3c7,0x0,0x0}}},
+{0x3a8,{{0x3c8,0x0,0x0}}},
+{0x3a9,{{0x3c9,0x0,0x0}}},
+{0x3aa,{{0x3ca,0x0,0x0}}},
+{0x3ab,{{0x3cb,0x0,0x0}}},
+{0x3c2,{{0x3c3,0x0,0x0}}},
+{0x3cf,{{0x3d7,0x0,0x0}}},
+{0x3d0,{{0x3b2,0x0,0x0}}},
+{0x3d1,{{0x3b8,0x0,0x0}}},
+{0x3d2,{{0x3c5,0x0,0x0}}},
+{0x3d3,{{0x3cd,0x0,0x0}}},
+{0x3d4,{{0x3cb,0x0,0x0}}},
+{0x3d5,{{0x3c6,0x0,0x0}}},
+{0x3d6,{{0x3c0,0x0,0x0}}},
+{0x3d8,{{0x3d9,0x0,0x0}}},
+{0x3da,{{0x3db,0x0,0x0}}},
+{0x3dc,{{0x3dd,0x0,0x0}}},
+{0x3de,{{0x3df,0x0,0x0}}},
+{0x3e0,{{0x3e1,0x0,0x0}}},
+{0x3e2,{{0x3e3,0x0,0x0}}},
+{0x3e4,{{0x3e5,0x0,0x0}}},
+{0x3e6,{{0x3e7,0x0,0x0}}},
+{0x3e8,{{0x3e9,0x0,0x0}}},
+{0x3ea,{{0x3eb,0x0,0x0}}},
+{0x3ec,{{0x3ed,0x0,0x0}}},
+{0x3ee,{{0x3ef,0x0,0x0}}},
+{0x3f0,{{0x3ba,0x0,0x0}}},
+{0x3f1,{{0x3c1,0x0,0x0}}},
+{0x3f2,{{0x3c3,0x0,0x0}}},
+{0x3f4,{{0x3b8,0x0,0x0}}},
+{0x3f5,{{0x3b5,0x0,0x0}}},
+{0x3f7,{{0x3f8,0x0,0x0}}},
+{0x3f9,{{0x3c3,0x0,0x0}}},
+{0x3fa,{{0x3fb,0x0,0x0}}},
+{0x3fd,{{0x37b,0x0,0x0}}},
+{0x3fe,{{0x37c,0x0,0x0}}},
+{0x3ff,{{0x37d,0x0,0x0}}},
+{0x400,{{0x450,0x0,0x0}}},
+{0x401,{{0x451,0x0,0x0}}},
+{0x402,{{0x452,0x0,0x0}}},
+{0x403,{{0x453,0x0,0x0}}},
+{0x404,{{0x454,0x0,0x0}}},
+{0x405,{{0x455,0x0,0x0}}},
+{0x406,{{0x456,0x0,0x0}}},
+{0x407,{{0x457,0x0,0x0}}},
+{0x408,{{0x458,0x0,0x0}}},
+{0x409,{{0x459,0x0,0x0}}},
+{0x40a,{{0x45a,0x0,0x0}}},
+{0x40b,{{0x45b,0x0,0x0}}},
+{0x40c,{{0x45c,0x0,0x0}}},
+{0x40d,{{0x45d,0x0,0x0}}},
+{0x40e,{{0x45e,0x0,0x0}}},
+{0x40f,{{0x45f,0x0,0x0}}},
+{0x410,{{0x430,0x0,0x0}}},
+{0x411,{{0x431,0x0,0x0}}},
+{0x412,{{0x432,0x0,0x0}}},
+{0x413,{{0x433,0x0,0x0}}},
+{0x414,{{0x434,0x0,0x0}}},
+{0x415,{{0x435,0x0,0x0}}},
+{0x416,{{0x436,0x0,0x0}}},
+{0x417,{{0x437,0x0,0x0}}},
+{0x418,{{0x438,0x0,0x0}}},
+{0x419,{{0x439,0x0,0x0}}},
+{0x41a,{{0x43a,0x0,0x0}}},
+{0x41b,{{0x43b,0x0,0x0}}},
+{0x41c,{{0x43c,0x0,0x0}}},
+{0x41d,{{0x43d,0x0,0x0}}},
+{0x41e,{{0x43e,0x0,0x0}}},
+{0x41f,{{0x43f,0x0,0x0}}},
+{0x420,{{0x440,0x0,0x0}}},
+{0x421,{{0x441,0x0,0x0}}},
+{0x422,{{0x442,0x0,0x0}}},
+{0x423,{{0x443,0x0,0x0}}},
+{0x424,{{0x444,0x0,0x0}}},
+{0x425,{{0x445,0x0,0x0}}},
+{0x426,{{0x446,0x0,0x0}}},
+{0x427,{{0x447,0x0,0x0}}},
+{0x428,{{0x448,0x0,0x0}}},
+{0x429,{{0x449,0x0,0x0}}},
+{0x42a,{{0x44a,0x0,0x0}}},
+{0x42b,{{0x44b,0x0,0x0}}},
+{0x42c,{{0x44c,0x0,0x0}}},
+{0x42d,{{0x44d,0x0,0x0}}},
+{0x42e,{{0x44e,0x0,0x0}}},
+{0x42f,{{0x44f,0x0,0x0}}},
+{0x460,{{0x461,0x0,0x0}}},
+{0x462,{{0x463,0x0,0x0}}},
+{0x464,{{0x465,0x0,0x0}}},
+{0x466,{{0x467,0x0,0x0}}},
+{0x468,{{0x469,0x0,0x0}}},
+{0x46a,{{0x46b,0x0,0x0}}},
+{0x46c,{{0x46d,0x0,0x0}}},
+{0x46e,{{0x46f,0x0,0x0}}},
+{0x470,{{0x471,0x0,0x0}}},
+{0x472,{{0x473,0x0,0x0}}},
+{0x474,{{0x475,0x0,0x0}}},
+{0x476,{{0x477,0x0,0x0}}},
+{0x478,{{0x479,0x0,0x0}}},
+{0x47a,{{0x47b,0x0,0x0}}},
+{0x47c,{{0x47d,0x0,0x0}}},
+{0x47e,{{0x47f,0x0,0x0}}},
+{0x480,{{0x481,0x0,0x0}}},
+{0x48a,{{0x48b,0x0,0x0}}},
+{0x48c,{{0x48d,0x0,0x0}}},
+{0x48e,{{0x48f,0x0,0x0}}},
+{0x490,{{0x491,0x0,0x0}}},
+{0x492,{{0x493,0x0,0x0}}},
+{0x494,{{0x495,0x0,0x0}}},
+{0x496,{{0x497,0x0,0x0}}},
+{0x498,{{0x499,0x0,0x0}}},
+{0x49a,{{0x49b,0x0,0x0}}},
+{0x49c,{{0x49d,0x0,0x0}}},
+{0x49e,{{0x49f,0x0,0x0}}},
+{0x4a0,{{0x4a1,0x0,0x0}}},
+{0x4a2,{{0x4a3,0x0,0x0}}},
+{0x4a4,{{0x4a5,0x0,0x0}}},
+{0x4a6,{{0x4a7,0x0,0x0}}},
+{0x4a8,{{0x4a9,0x0,0x0}}},
+{0x4aa,{{0x4ab,0x0,0x0}}},
+{0x4ac,{{0x4ad,0x0,0x0}}},
+{0x4ae,{{0x4af,0x0,0x0}}},
+{0x4b0,{{0x4b1,0x0,0x0}}},
+{0x4b2,{{0x4b3,0x0,0x0}}},
+{0x4b4,{{0x4b5,0x0,0x0}}},
+{0x4b6,{{0x4b7,0x0,0x0}}},
+{0x4b8,{{0x4b9,0x0,0x0}}},
+{0x4ba,{{0x4bb,0x0,0x0}}},
+{0x4bc,{{0x4bd,0x0,0x0}}},
+{0x4be,{{0x4bf,0x0,0x0}}},
+{0x4c0,{{0x4cf,0x0,0x0}}},
+{0x4c1,{{0x4c2,0x0,0x0}}},
+{0x4c3,{{0x4c4,0x0,0x0}}},
+{0x4c5,{{0x4c6,0x0,0x0}}},
+{0x4c7,{{0x4c8,0x0,0x0}}},
+{0x4c9,{{0x4ca,0x0,0x0}}},
+{0x4cb,{{0x4cc,0x0,0x0}}},
+{0x4cd,{{0x4ce,0x0,0x0}}},
+{0x4d0,{{0x4d1,0x0,0x0}}},
+{0x4d2,{{0x4d3,0x0,0x0}}},
+{0x4d4,{{0x4d5,0x0,0x0}}},
+{0x4d6,{{0x4d7,0x0,0x0}}},
+{0x4d8,{{0x4d9,0x0,0x0}}},
+{0x4da,{{0x4db,0x0,0x0}}},
+{0x4dc,{{0x4dd,0x0,0x0}}},
+{0x4de,{{0x4df,0x0,0x0}}},
+{0x4e0,{{0x4e1,0x0,0x0}}},
+{0x4e2,{{0x4e3,0x0,0x0}}},
+{0x4e4,{{0x4e5,0x0,0x0}}},
+{0x4e6,{{0x4e7,0x0,0x0}}},
+{0x4e8,{{0x4e9,0x0,0x0}}},
+{0x4ea,{{0x4eb,0x0,0x0}}},
+{0x4ec,{{0x4ed,0x0,0x0}}},
+{0x4ee,{{0x4ef,0x0,0x0}}},
+{0x4f0,{{0x4f1,0x0,0x0}}},
+{0x4f2,{{0x4f3,0x0,0x0}}},
+{0x4f4,{{0x4f5,0x0,0x0}}},
+{0x4f6,{{0x4f7,0x0,0x0}}},
+{0x4f8,{{0x4f9,0x0,0x0}}},
+{0x4fa,{{0x4fb,0x0,0x0}}},
+{0x4fc,{{0x4fd,0x0,0x0}}},
+{0x4fe,{{0x4ff,0x0,0x0}}},
+{0x500,{{0x501,0x0,0x0}}},
+{0x502,{{0x503,0x0,0x0}}},
+{0x504,{{0x505,0x0,0x0}}},
+{0x506,{{0x507,0x0,0x0}}},
+{0x508,{{0x509,0x0,0x0}}},
+{0x50a,{{0x50b,0x0,0x0}}},
+{0x50c,{{0x50d,0x0,0x0}}},
+{0x50e,{{0x50f,0x0,0x0}}},
+{0x510,{{0x511,0x0,0x0}}},
+{0x512,{{0x513,0x0,0x0}}},
+{0x514,{{0x515,0x0,0x0}}},
+{0x516,{{0x517,0x0,0x0}}},
+{0x518,{{0x519,0x0,0x0}}},
+{0x51a,{{0x51b,0x0,0x0}}},
+{0x51c,{{0x51d,0x0,0x0}}},
+{0x51e,{{0x51f,0x0,0x0}}},
+{0x520,{{0x521,0x0,0x0}}},
+{0x522,{{0x523,0x0,0x0}}},
+{0x524,{{0x525,0x0,0x0}}},
+{0x526,{{0x527,0x0,0x0}}},
+{0x528,{{0x529,0x0,0x0}}},
+{0x52a,{{0x52b,0x0,0x0}}},
+{0x52c,{{0x52d,0x0,0x0}}},
+{0x52e,{{0x52f,0x0,0x0}}},
+{0x531,{{0x561,0x0,0x0}}},
+{0x532,{{0x562,0x0,0x0}}},
+{0x533,{{0x563,0x0,0x0}}},
+{0x534,{{0x564,0x0,0x0}}},
+{0x535,{{0x565,0x0,0x0}}},
+{0x536,{{0x566,0x0,0x0}}},
+{0x537,{{0x567,0x0,0x0}}},
+{0x538,{{0x568,0x0,0x0}}},
+{0x539,{{0x569,0x0,0x0}}},
+{0x53a,{{0x56a,0x0,0x0}}},
+{0x53b,{{0x56b,0x0,0x0}}},
+{0x53c,{{0x56c,0x0,0x0}}},
+{0x53d,{{0x56d,0x0,0x0}}},
+{0x53e,{{0x56e,0x0,0x0}}},
+{0x53f,{{0x56f,0x0,0x0}}},
+{0x540,{{0x570,0x0,0x0}}},
+{0x541,{{0x571,0x0,0x0}}},
+{0x542,{{0x572,0x0,0x0}}},
+{0x543,{{0x573,0x0,0x0}}},
+{0x544,{{0x574,0x0,0x0}}},
+{0x545,{{0x575,0x0,0x0}}},
+{0x546,{{0x576,0x0,0x0}}},
+{0x547,{{0x577,0x0,0x0}}},
+{0x548,{{0x578,0x0,0x0}}},
+{0x549,{{0x579,0x0,0x0}}},
+{0x54a,{{0x57a,0x0,0x0}}},
+{0x54b,{{0x57b,0x0,0x0}}},
+{0x54c,{{0x57c,0x0,0x0}}},
+{0x54d,{{0x57d,0x0,0x0}}},
+{0x54e,{{0x57e,0x0,0x0}}},
+{0x54f,{{0x57f,0x0,0x0}}},
+{0x550,{{0x580,0x0,0x0}}},
+{0x551,{{0x581,0x0,0x0}}},
+{0x552,{{0x582,0x0,0x0}}},
+{0x553,{{0x583,0x0,0x0}}},
+{0x554,{{0x584,0x0,0x0}}},
+{0x555,{{0x585,0x0,0x0}}},
+{0x556,{{0x586,0x0,0x0}}},
+{0x587,{{0x565,0x582,0x0}}},
+{0x61c,{{0x0,0x0,0x0}}},
+{0x675,{{0x627,0x674,0x0}}},
+{0x676,{{0x648,0x674,0x0}}},
+{0x677,{{0x6c7,0x674,0x0}}},
+{0x678,{{0x64a,0x674,0x0}}},
+{0x958,{{0x915,0x93c,0x0}}},
+{0x959,{{0x916,0x93c,0x0}}},
+{0x95a,{{0x917,0x93c,0x0}}},
+{0x95b,{{0x91c,0x93c,0x0}}},
+{0x95c,{{0x921,0x93c,0x0}}},
+{0x95d,{{0x922,0x93c,0x0}}},
+{0x95e,{{0x92b,0x93c,0x0}}},
+{0x95f,{{0x92f,0x93c,0x0}}},
+{0x9dc,{{0x9a1,0x9bc,0x0}}},
+{0x9dd,{{0x9a2,0x9bc,0x0}}},
+{0x9df,{{0x9af,0x9bc,0x0}}},
+{0xa33,{{0xa32,0xa3c,0x0}}},
+{0xa36,{{0xa38,0xa3c,0x0}}},
+{0xa59,{{0xa16,0xa3c,0x0}}},
+{0xa5a,{{0xa17,0xa3c,0x0}}},
+{0xa5b,{{0xa1c,0xa3c,0x0}}},
+{0xa5e,{{0xa2b,0xa3c,0x0}}},
+{0xb5c,{{0xb21,0xb3c,0x0}}},
+{0xb5d,{{0xb22,0xb3c,0x0}}},
+{0xe33,{{0xe4d,0xe32,0x0}}},
+{0xeb3,{{0xecd,0xeb2,0x0}}},
+{0xedc,{{0xeab,0xe99,0x0}}},
+{0xedd,{{0xeab,0xea1,0x0}}},
+{0xf0c,{{0xf0b,0x0,0x0}}},
+{0xf43,{{0xf42,0xfb7,0x0}}},
+{0xf4d,{{0xf4c,0xfb7,0x0}}},
+{0xf52,{{0xf51,0xfb7,0x0}}},
+{0xf57,{{0xf56,0xfb7,0x0}}},
+{0xf5c,{{0xf5b,0xfb7,0x0}}},
+{0xf69,{{0xf40,0xfb5,0x0}}},
+{0xf73,{{0xf71,0xf72,0x0}}},
+{0xf75,{{0xf71,0xf74,0x0}}},
+{0xf76,{{0xfb2,0xf80,0x0}}},
+{0xf77,{{0xfb2,0xf71,0xf80}}},
+{0xf78,{{0xfb3,0xf80,0x0}}},
+{0xf79,{{0xfb3,0xf71,0xf80}}},
+{0xf81,{{0xf71,0xf80,0x0}}},
+{0xf93,{{0xf92,0xfb7,0x0}}},
+{0xf9d,{{0xf9c,0xfb7,0x0}}},
+{0xfa2,{{0xfa1,0xfb7,0x0}}},
+{0xfa7,{{0xfa6,0xfb7,0x0}}},
+{0xfac,{{0xfab,0xfb7,0x0}}},
+{0xfb9,{{0xf90,0xfb5,0x0}}},
+{0x10a0,{{0x2d00,0x0,0x0}}},
+{0x10a1,{{0x2d01,0x0,0x0}}},
+{0x10a2,{{0x2d02,0x0,0x0}}},
+{0x10a3,{{0x2d03,0x0,0x0}}},
+{0x10a4,{{0x2d04,0x0,0x0}}},
+{0x10a5,{{0x2d05,0x0,0x0}}},
+{0x10a6,{{0x2d06,0x0,0x0}}},
+{0x10a7,{{0x2d07,0x0,0x0}}},
+{0x10a8,{{0x2d08,0x0,0x0}}},
+{0x10a9,{{0x2d09,0x0,0x0}}},
+{0x10aa,{{0x2d0a,0x0,0x0}}},
+{0x10ab,{{0x2d0b,0x0,0x0}}},
+{0x10ac,{{0x2d0c,0x0,0x0}}},
+{0x10ad,{{0x2d0d,0x0,0x0}}},
+{0x10ae,{{0x2d0e,0x0,0x0}}},
+{0x10af,{{0x2d0f,0x0,0x0}}},
+{0x10b0,{{0x2d10,0x0,0x0}}},
+{0x10b1,{{0x2d11,0x0,0x0}}},
+{0x10b2,{{0x2d12,0x0,0x0}}},
+{0x10b3,{{0x2d13,0x0,0x0}}},
+{0x10b4,{{0x2d14,0x0,0x0}}},
+{0x10b5,{{0x2d15,0x0,0x0}}},
+{0x10b6,{{0x2d16,0x0,0x0}}},
+{0x10b7,{{0x2d17,0x0,0x0}}},
+{0x10b8,{{0x2d18,0x0,0x0}}},
+{0x10b9,{{0x2d19,0x0,0x0}}},
+{0x10ba,{{0x2d1a,0x0,0x0}}},
+{0x10bb,{{0x2d1b,0x0,0x0}}},
+{0x10bc,{{0x2d1c,0x0,0x0}}},
+{0x10bd,{{0x2d1d,0x0,0x0}}},
+{0x10be,{{0x2d1e,0x0,0x0}}},
+{0x10bf,{{0x2d1f,0x0,0x0}}},
+{0x10c0,{{0x2d20,0x0,0x0}}},
+{0x10c1,{{0x2d21,0x0,0x0}}},
+{0x10c2,{{0x2d22,0x0,0x0}}},
+{0x10c3,{{0x2d23,0x0,0x0}}},
+{0x10c4,{{0x2d24,0x0,0x0}}},
+{0x10c5,{{0x2d25,0x0,0x0}}},
+{0x10c7,{{0x2d27,0x0,0x0}}},
+{0x10cd,{{0x2d2d,0x0,0x0}}},
+{0x10fc,{{0x10dc,0x0,0x0}}},
+{0x115f,{{0x0,0x0,0x0}}},
+{0x1160,{{0x0,0x0,0x0}}},
+{0x13f8,{{0x13f0,0x0,0x0}}},
+{0x13f9,{{0x13f1,0x0,0x0}}},
+{0x13fa,{{0x13f2,0x0,0x0}}},
+{0x13fb,{{0x13f3,0x0,0x0}}},
+{0x13fc,{{0x13f4,0x0,0x0}}},
+{0x13fd,{{0x13f5,0x0,0x0}}},
+{0x17b4,{{0x0,0x0,0x0}}},
+{0x17b5,{{0x0,0x0,0x0}}},
+{0x180b,{{0x0,0x0,0x0}}},
+{0x180c,{{0x0,0x0,0x0}}},
+{0x180d,{{0x0,0x0,0x0}}},
+{0x180e,{{0x0,0x0,0x0}}},
+{0x180f,{{0x0,0x0,0x0}}},
+{0x1c80,{{0x432,0x0,0x0}}},
+{0x1c81,{{0x434,0x0,0x0}}},
+{0x1c82,{{0x43e,0x0,0x0}}},
+{0x1c83,{{0x441,0x0,0x0}}},
+{0x1c84,{{0x442,0x0,0x0}}},
+{0x1c85,{{0x442,0x0,0x0}}},
+{0x1c86,{{0x44a,0x0,0x0}}},
+{0x1c87,{{0x463,0x0,0x0}}},
+{0x1c88,{{0xa64b,0x0,0x0}}},
+{0x1c89,{{0x1c8a,0x0,0x0}}},
+{0x1c90,{{0x10d0,0x0,0x0}}},
+{0x1c91,{{0x10d1,0x0,0x0}}},
+{0x1c92,{{0x10d2,0x0,0x0}}},
+{0x1c93,{{0x10d3,0x0,0x0}}},
+{0x1c94,{{0x10d4,0x0,0x0}}},
+{0x1c95,{{0x10d5,0x0,0x0}}},
+{0x1c96,{{0x10d6,0x0,0x0}}},
+{0x1c97,{{0x10d7,0x0,0x0}}},
+{0x1c98,{{0x10d8,0x0,0x0}}},
+{0x1c99,{{0x10d9,0x0,0x0}}},
+{0x1c9a,{{0x10da,0x0,0x0}}},
+{0x1c9b,{{0x10db,0x0,0x0}}},
+{0x1c9c,{{0x10dc,0x0,0x0}}},
+{0x1c9d,{{0x10dd,0x0,0x0}}},
+{0x1c9e,{{0x10de,0x0,0x0}}},
+{0x1c9f,{{0x10df,0x0,0x0}}},
+{0x1ca0,{{0x10e0,0x0,0x0}}},
+{0x1ca1,{{0x10e1,0x0,0x0}}},
+{0x1ca2,{{0x10e2,0x0,0x0}}},
+{0x1ca3,{{0x10e3,0x0,0x0}}},
+{0x1ca4,{{0x10e4,0x0,0x0}}},
+{0x1ca5,{{0x10e5,0x0,0x0}}},
+{0x1ca6,{{0x10e6,0x0,0x0}}},
+{0x1ca7,{{0x10e7,0x0,0x0}}},
+{0x1ca8,{{0x10e8,0x0,0x0}}},
+{0x1ca9,{{0x10e9,0x0,0x0}}},
+{0x1caa,{{0x10ea,0x0,0x0}}},
+{0x1cab,{{0x10eb,0x0,0x0}}},
+{0x1cac,{{0x10ec,0x0,0x0}}},
+{0x1cad,{{0x10ed,0x0,0x0}}},
+{0x1cae,{{0x10ee,0x0,0x0}}},
+{0x1caf,{{0x10ef,0x0,0x0}}},
+{0x1cb0,{{0x10f0,0x0,0x0}}},
+{0x1cb1,{{0x10f1,0x0,0x0}}},
+{0x1cb2,{{0x10f2,0x0,0x0}}},
+{0x1cb3,{{0x10f3,0x0,0x0}}},
+{0x1cb4,{{0x10f4,0x0,0x0}}},
+{0x1cb5,{{0x10f5,0x0,0x0}}},
+{0x1cb6,{{0x10f6,0x0,0x0}}},
+{0x1cb7,{{0x10f7,0x0,0x0}}},
+{0x1cb8,{{0x10f8,0x0,0x0}}},
+{0x1cb9,{{0x10f9,0x0,0x0}}},
+{0x1cba,{{0x10fa,0x0,0x0}}},
+{0x1cbd,{{0x10fd,0x0,0x0}}},
+{0x1cbe,{{0x10fe,0x0,0x0}}},
+{0x1cbf,{{0x10ff,0x0,0x0}}},
+{0x1d2c,{{0x61,0x0,0x0}}},
+{0x1d2d,{{0xe6,0x0,0x0}}},
+{0x1d2e,{{0x62,0x0,0x0}}},
+{0x1d30,{{0x64,0x0,0x0}}},
+{0x1d31,{{0x65,0x0,0x0}}},
+{0x1d32,{{0x1dd,0x0,0x0}}},
+{0x1d33,{{0x67,0x0,0x0}}},
+{0x1d34,{{0x68,0x0,0x0}}},
+{0x1d35,{{0x69,0x0,0x0}}},
+{0x1d36,{{0x6a,0x0,0x0}}},
+{0x1d37,{{0x6b,0x0,0x0}}},
+{0x1d38,{{0x6c,0x0,0x0}}},
+{0x1d39,{{0x6d,0x0,0x0}}},
+{0x1d3a,{{0x6e,0x0,0x0}}},
+{0x1d3c,{{0x6f,0x0,0x0}}},
+{0x1d3d,{{0x223,0x0,0x0}}},
+{0x1d3e,{{0x70,0x0,0x0}}},
+{0x1d3f,{{0x72,0x0,0x0}}},
+{0x1d40,{{0x74,0x0,0x0}}},
+{0x1d41,{{0x75,0x0,0x0}}},
+{0x1d42,{{0x77,0x0,0x0}}},
+{0x1d43,{{0x61,0x0,0x0}}},
+{0x1d44,{{0x250,0x0,0x0}}},
+{0x1d45,{{0x251,0x0,0x0}}},
+{0x1d46,{{0x1d02,0x0,0x0}}},
+{0x1d47,{{0x62,0x0,0x0}}},
+{0x1d48,{{0x64,0x0,0x0}}},
+{0x1d49,{{0x65,0x0,0x0}}},
+{0x1d4a,{{0x259,0x0,0x0}}},
+{0x1d4b,{{0x25b,0x0,0x0}}},
+{0x1d4c,{{0x25c,0x0,0x0}}},
+{0x1d4d,{{0x67,0x0,0x0}}},
+{0x1d4f,{{0x6b,0x0,0x0}}},
+{0x1d50,{{0x6d,0x0,0x0}}},
+{0x1d51,{{0x14b,0x0,0x0}}},
+{0x1d52,{{0x6f,0x0,0x0}}},
+{0x1d53,{{0x254,0x0,0x0}}},
+{0x1d54,{{0x1d16,0x0,0x0}}},
+{0x1d55,{{0x1d17,0x0,0x0}}},
+{0x1d56,{{0x70,0x0,0x0}}},
+{0x1d57,{{0x74,0x0,0x0}}},
+{0x1d58,{{0x75,0x0,0x0}}},
+{0x1d59,{{0x1d1d,0x0,0x0}}},
+{0x1d5a,{{0x26f,0x0,0x0}}},
+{0x1d5b,{{0x76,0x0,0x0}}},
+{0x1d5c,{{0x1d25,0x0,0x0}}},
+{0x1d5d,{{0x3b2,0x0,0x0}}},
+{0x1d5e,{{0x3b3,0x0,0x0}}},
+{0x1d5f,{{0x3b4,0x0,0x0}}},
+{0x1d60,{{0x3c6,0x0,0x0}}},
+{0x1d61,{{0x3c7,0x0,0x0}}},
+{0x1d62,{{0x69,0x0,0x0}}},
+{0x1d63,{{0x72,0x0,0x0}}},
+{0x1d64,{{0x75,0x0,0x0}}},
+{0x1d65,{{0x76,0x0,0x0}}},
+{0x1d66,{{0x3b2,0x0,0x0}}},
+{0x1d67,{{0x3b3,0x0,0x0}}},
+{0x1d68,{{0x3c1,0x0,0x0}}},
+{0x1d69,{{0x3c6,0x0,0x0}}},
+{0x1d6a,{{0x3c7,0x0,0x0}}},
+{0x1d78,{{0x43d,0x0,0x0}}},
+{0x1d9b,{{0x252,0x0,0x0}}},
+{0x1d9c,{{0x63,0x0,0x0}}},
+{0x1d9d,{{0x255,0x0,0x0}}},
+{0x1d9e,{{0xf0,0x0,0x0}}},
+{0x1d9f,{{0x25c,0x0,0x0}}},
+{0x1da0,{{0x66,0x0,0x0}}},
+{0x1da1,{{0x25f,0x0,0x0}}},
+{0x1da2,{{0x261,0x0,0x0}}},
+{0x1da3,{{0x265,0x0,0x0}}},
+{0x1da4,{{0x268,0x0,0x0}}},
+{0x1da5,{{0x269,0x0,0x0}}},
+{0x1da6,{{0x26a,0x0,0x0}}},
+{0x1da7,{{0x1d7b,0x0,0x0}}},
+{0x1da8,{{0x29d,0x0,0x0}}},
+{0x1da9,{{0x26d,0x0,0x0}}},
+{0x1daa,{{0x1d85,0x0,0x0}}},
+{0x1dab,{{0x29f,0x0,0x0}}},
+{0x1dac,{{0x271,0x0,0x0}}},
+{0x1dad,{{0x270,0x0,0x0}}},
+{0x1dae,{{0x272,0x0,0x0}}},
+{0x1daf,{{0x273,0x0,0x0}}},
+{0x1db0,{{0x274,0x0,0x0}}},
+{0x1db1,{{0x275,0x0,0x0}}},
+{0x1db2,{{0x278,0x0,0x0}}},
+{0x1db3,{{0x282,0x0,0x0}}},
+{0x1db4,{{0x283,0x0,0x0}}},
+{0x1db5,{{0x1ab,0x0,0x0}}},
+{0x1db6,{{0x289,0x0,0x0}}},
+{0x1db7,{{0x28a,0x0,0x0}}},
+{0x1db8,{{0x1d1c,0x0,0x0}}},
+{0x1db9,{{0x28b,0x0,0x0}}},
+{0x1dba,{{0x28c,0x0,0x0}}},
+{0x1dbb,{{0x7a,0x0,0x0}}},
+{0x1dbc,{{0x290,0x0,0x0}}},
+{0x1dbd,{{0x291,0x0,0x0}}},
+{0x1dbe,{{0x292,0x0,0x0}}},
+{0x1dbf,{{0x3b8,0x0,0x0}}},
+{0x1e00,{{0x1e01,0x0,0x0}}},
+{0x1e02,{{0x1e03,0x0,0x0}}},
+{0x1e04,{{0x1e05,0x0,0x0}}},
+{0x1e06,{{0x1e07,0x0,0x0}}},
+{0x1e08,{{0x1e09,0x0,0x0}}},
+{0x1e0a,{{0x1e0b,0x0,0x0}}},
+{0x1e0c,{{0x1e0d,0x0,0x0}}},
+{0x1e0e,{{0x1e0f,0x0,0x0}}},
+{0x1e10,{{0x1e11,0x0,0x0}}},
+{0x1e12,{{0x1e13,0x0,0x0}}},
+{0x1e14,{{0x1e15,0x0,0x0}}},
+{0x1e16,{{0x1e17,0x0,0x0}}},
+{0x1e18,{{0x1e19,0x0,0x0}}},
+{0x1e1a,{{0x1e1b,0x0,0x0}}},
+{0x1e1c,{{0x1e1d,0x0,0x0}}},
+{0x1e1e,{{0x1e1f,0x0,0x0}}},
+{0x1e20,{{0x1e21,0x0,0x0}}},
+{0x1e22,{{0x1e23,0x0,0x0}}},
+{0x1e24,{{0x1e25,0x0,0x0}}},
+{0x1e26,{{0x1e27,0x0,0x0}}},
+{0x1e28,{{0x1e29,0x0,0x0}}},
+{0x1e2a,{{0x1e2b,0x0,0x0}}},
+{0x1e2c,{{0x1e2d,0x0,0x0}}},
+{0x1e2e,{{0x1e2f,0x0,0x0}}},
+{0x1e30,{{0x1e31,0x0,0x0}}},
+{0x1e32,{{0x1e33,0x0,0x0}}},
+{0x1e34,{{0x1e35,0x0,0x0}}},
+{0x1e36,{{0x1e37,0x0,0x0}}},
+{0x1e38,{{0x1e39,0x0,0x0}}},
+{0x1e3a,{{0x1e3b,0x0,0x0}}},
+{0x1e3c,{{0x1e3d,0x0,0x0}}},
+{0x1e3e,{{0x1e3f,0x0,0x0}}},
+{0x1e40,{{0x1e41,0x0,0x0}}},
+{0x1e42,{{0x1e43,0x0,0x0}}},
+{0x1e44,{{0x1e45,0x0,0x0}}},
+{0x1e46,{{0x1e47,0x0,0x0}}},
+{0x1e48,{{0x1e49,0x0,0x0}}},
+{0x1e4a,{{0x1e4b,0x0,0x0}}},
+{0x1e4c,{{0x1e4d,0x0,0x0}}},
+{0x1e4e,{{0x1e4f,0x0,0x0}}},
+{0x1e50,{{0x1e51,0x0,0x0}}},
+{0x1e52,{{0x1e53,0x0,0x0}}},
+{0x1e54,{{0x1e55,0x0,0x0}}},
+{0x1e56,{{0x1e57,0x0,0x0}}},
+{0x1e58,{{0x1e59,0x0,0x0}}},
+{0x1e5a,{{0x1e5b,0x0,0x0}}},
+{0x1e5c,{{0x1e5d,0x0,0x0}}},
+{0x1e5e,{{0x1e5f,0x0,0x0}}},
+{0x1e60,{{0x1e61,0x0,0x0}}},
+{0x1e62,{{0x1e63,0x0,0x0}}},
+{0x1e64,{{0x1e65,0x0,0x0}}},
+{0x1e66,{{0x1e67,0x0,0x0}}},
+{0x1e68,{{0x1e69,0x0,0x0}}},
+{0x1e6a,{{0x1e6b,0x0,0x0}}},
+{0x1e6c,{{0x1e6d,0x0,0x0}}},
+{0x1e6e,{{0x1e6f,0x0,0x0}}},
+{0x1e70,{{0x1e71,0x0,0x0}}},
+{0x1e72,{{0x1e73,0x0,0x0}}},
+{0x1e74,{{0x1e75,0x0,0x0}}},
+{0x1e76,{{0x1e77,0x0,0x0}}},
+{0x1e78,{{0x1e79,0x0,0x0}}},
+{0x1e7a,{{0x1e7b,0x0,0x0}}},
+{0x1e7c,{{0x1e7d,0x0,0x0}}},
+{0x1e7e,{{0x1e7f,0x0,0x0}}},
+{0x1e80,{{0x1e81,0x0,0x0}}},
+{0x1e82,{{0x1e83,0x0,0x0}}},
+{0x1e84,{{0x1e85,0x0,0x0}}},
+{0x1e86,{{0x1e87,0x0,0x0}}},
+{0x1e88,{{0x1e89,0x0,0x0}}},
+{0x1e8a,{{0x1e8b,0x0,0x0}}},
+{0x1e8c,{{0x1e8d,0x0,0x0}}},
+{0x1e8e,{{0x1e8f,0x0,0x0}}},
+{0x1e90,{{0x1e91,0x0,0x0}}},
+{0x1e92,{{0x1e93,0x0,0x0}}},
+{0x1e94,{{0x1e95,0x0,0x0}}},
+{0x1e9a,{{0x61,0x2be,0x0}}},
+{0x1e9b,{{0x1e61,0x0,0x0}}},
+{0x1e9e,{{0x73,0x73,0x0}}},
+{0x1ea0,{{0x1ea1,0x0,0x0}}},
+{0x1ea2,{{0x1ea3,0x0,0x0}}},
+{0x1ea4,{{0x1ea5,0x0,0x0}}},
+{0x1ea6,{{0x1ea7,0x0,0x0}}},
+{0x1ea8,{{0x1ea9,0x0,0x0}}},
+{0x1eaa,{{0x1eab,0x0,0x0}}},
+{0x1eac,{{0x1ead,0x0,0x0}}},
+{0x1eae,{{0x1eaf,0x0,0x0}}},
+{0x1eb0,{{0x1eb1,0x0,0x0}}},
+{0x1eb2,{{0x1eb3,0x0,0x0}}},
+{0x1eb4,{{0x1eb5,0x0,0x0}}},
+{0x1eb6,{{0x1eb7,0x0,0x0}}},
+{0x1eb8,{{0x1eb9,0x0,0x0}}},
+{0x1eba,{{0x1ebb,0x0,0x0}}},
+{0x1ebc,{{0x1ebd,0x0,0x0}}},
+{0x1ebe,{{0x1ebf,0x0,0x0}}},
+{0x1ec0,{{0x1ec1,0x0,0x0}}},
+{0x1ec2,{{0x1ec3,0x0,0x0}}},
+{0x1ec4,{{0x1ec5,0x0,0x0}}},
+{0x1ec6,{{0x1ec7,0x0,0x0}}},
+{0x1ec8,{{0x1ec9,0x0,0x0}}},
+{0x1eca,{{0x1ecb,0x0,0x0}}},
+{0x1ecc,{{0x1ecd,0x0,0x0}}},
+{0x1ece,{{0x1ecf,0x0,0x0}}},
+{0x1ed0,{{0x1ed1,0x0,0x0}}},
+{0x1ed2,{{0x1ed3,0x0,0x0}}},
+{0x1ed4,{{0x1ed5,0x0,0x0}}},
+{0x1ed6,{{0x1ed7,0x0,0x0}}},
+{0x1ed8,{{0x1ed9,0x0,0x0}}},
+{0x1eda,{{0x1edb,0x0,0x0}}},
+{0x1edc,{{0x1edd,0x0,0x0}}},
+{0x1ede,{{0x1edf,0x0,0x0}}},
+{0x1ee0,{{0x1ee1,0x0,0x0}}},
+{0x1ee2,{{0x1ee3,0x0,0x0}}},
+{0x1ee4,{{0x1ee5,0x0,0x0}}},
+{0x1ee6,{{0x1ee7,0x0,0x0}}},
+{0x1ee8,{{0x1ee9,0x0,0x0}}},
+{0x1eea,{{0x1eeb,0x0,0x0}}},
+{0x1eec,{{0x1eed,0x0,0x0}}},
+{0x1eee,{{0x1eef,0x0,0x0}}},
+{0x1ef0,{{0x1ef1,0x0,0x0}}},
+{0x1ef2,{{0x1ef3,0x0,0x0}}},
+{0x1ef4,{{0x1ef5,0x0,0x0}}},
+{0x1ef6,{{0x1ef7,0x0,0x0}}},
+{0x1ef8,{{0x1ef9,0x0,0x0}}},
+{0x1efa,{{0x1efb,0x0,0x0}}},
+{0x1efc,{{0x1efd,0x0,0x0}}},
+{0x1efe,{{0x1eff,0x0,0x0}}},
+{0x1f08,{{0x1f00,0x0,0x0}}},
+{0x1f09,{{0x1f01,0x0,0x0}}},
+{0x1f0a,{{0x1f02,0x0,0x0}}},
+{0x1f0b,{{0x1f03,0x0,0x0}}},
+{0x1f0c,{{0x1f04,0x0,0x0}}},
+{0x1f0d,{{0x1f05,0x0,0x0}}},
+{0x1f0e,{{0x1f06,0x0,0x0}}},
+{0x1f0f,{{0x1f07,0x0,0x0}}},
+{0x1f18,{{0x1f10,0x0,0x0}}},
+{0x1f19,{{0x1f11,0x0,0x0}}},
+{0x1f1a,{{0x1f12,0x0,0x0}}},
+{0x1f1b,{{0x1f13,0x0,0x0}}},
+{0x1f1c,{{0x1f14,0x0,0x0}}},
+{0x1f1d,{{0x1f15,0x0,0x0}}},
+{0x1f28,{{0x1f20,0x0,0x0}}},
+{0x1f29,{{0x1f21,0x0,0x0}}},
+{0x1f2a,{{0x1f22,0x0,0x0}}},
+{0x1f2b,{{0x1f23,0x0,0x0}}},
+{0x1f2c,{{0x1f24,0x0,0x0}}},
+{0x1f2d,{{0x1f25,0x0,0x0}}},
+{0x1f2e,{{0x1f26,0x0,0x0}}},
+{0x1f2f,{{0x1f27,0x0,0x0}}},
+{0x1f38,{{0x1f30,0x0,0x0}}},
+{0x1f39,{{0x1f31,0x0,0x0}}},
+{0x1f3a,{{0x1f32,0x0,0x0}}},
+{0x1f3b,{{0x1f33,0x0,0x0}}},
+{0x1f3c,{{0x1f34,0x0,0x0}}},
+{0x1f3d,{{0x1f35,0x0,0x0}}},
+{0x1f3e,{{0x1f36,0x0,0x0}}},
+{0x1f3f,{{0x1f37,0x0,0x0}}},
+{0x1f48,{{0x1f40,0x0,0x0}}},
+{0x1f49,{{0x1f41,0x0,0x0}}},
+{0x1f4a,{{0x1f42,0x0,0x0}}},
+{0x1f4b,{{0x1f43,0x0,0x0}}},
+{0x1f4c,{{0x1f44,0x0,0x0}}},
+{0x1f4d,{{0x1f45,0x0,0x0}}},
+{0x1f59,{{0x1f51,0x0,0x0}}},
+{0x1f5b,{{0x1f53,0x0,0x0}}},
+{0x1f5d,{{0x1f55,0x0,0x0}}},
+{0x1f5f,{{0x1f57,0x0,0x0}}},
+{0x1f68,{{0x1f60,0x0,0x0}}},
+{0x1f69,{{0x1f61,0x0,0x0}}},
+{0x1f6a,{{0x1f62,0x0,0x0}}},
+{0x1f6b,{{0x1f63,0x0,0x0}}},
+{0x1f6c,{{0x1f64,0x0,0x0}}},
+{0x1f6d,{{0x1f65,0x0,0x0}}},
+{0x1f6e,{{0x1f66,0x0,0x0}}},
+{0x1f6f,{{0x1f67,0x0,0x0}}},
+{0x1f71,{{0x3ac,0x0,0x0}}},
+{0x1f73,{{0x3ad,0x0,0x0}}},
+{0x1f75,{{0x3ae,0x0,0x0}}},
+{0x1f77,{{0x3af,0x0,0x0}}},
+{0x1f79,{{0x3cc,0x0,0x0}}},
+{0x1f7b,{{0x3cd,0x0,0x0}}},
+{0x1f7d,{{0x3ce,0x0,0x0}}},
+{0x1f80,{{0x1f00,0x3b9,0x0}}},
+{0x1f81,{{0x1f01,0x3b9,0x0}}},
+{0x1f82,{{0x1f02,0x3b9,0x0}}},
+{0x1f83,{{0x1f03,0x3b9,0x0}}},
+{0x1f84,{{0x1f04,0x3b9,0x0}}},
+{0x1f85,{{0x1f05,0x3b9,0x0}}},
+{0x1f86,{{0x1f06,0x3b9,0x0}}},
+{0x1f87,{{0x1f07,0x3b9,0x0}}},
+{0x1f88,{{0x1f00,0x3b9,0x0}}},
+{0x1f89,{{0x1f01,0x3b9,0x0}}},
+{0x1f8a,{{0x1f02,0x3b9,0x0}}},
+{0x1f8b,{{0x1f03,0x3b9,0x0}}},
+{0x1f8c,{{0x1f04,0x3b9,0x0}}},
+{0x1f8d,{{0x1f05,0x3b9,0x0}}},
+{0x1f8e,{{0x1f06,0x3b9,0x0}}},
+{0x1f8f,{{0x1f07,0x3b9,0x0}}},
+{0x1f90,{{0x1f20,0x3b9,0x0}}},
+{0x1f91,{{0x1f21,0x3b9,0x0}}},
+{0x1f92,{{0x1f22,0x3b9,0x0}}},
+{0x1f93,{{0x1f23,0x3b9,0x0}}},
+{0x1f94,{{0x1f24,0x3b9,0x0}}},
+{0x1f95,{{0x1f25,0x3b9,0x0}}},
+{0x1f96,{{0x1f26,0x3b9,0x0}}},
+{0x1f97,{{0x1f27,0x3b9,0x0}}},
+{0x1f98,{{0x1f20,0x3b9,0x0}}},
+{0x1f99,{{0x1f21,0x3b9,0x0}}},
+{0x1f9a,{{0x1f22,0x3b9,0x0}}},
+{0x1f9b,{{0x1f23,0x3b9,0x0}}},
+{0x1f9c,{{0x1f24,0x3b9,0x0}}},
+{0x1f9d,{{0x1f25,0x3b9,0x0}}},
+{0x1f9e,{{0x1f26,0x3b9,0x0}}},
+{0x1f9f,{{0x1f27,0x3b9,0x0}}},
+{0x1fa0,{{0x1f60,0x3b9,0x0}}},
+{0x1fa1,{{0x1f61,0x3b9,0x0}}},
+{0x1fa2,{{0x1f62,0x3b9,0x0}}},
+{0x1fa3,{{0x1f63,0x3b9,0x0}}},
+{0x1fa4,{{0x1f64,0x3b9,0x0}}},
+{0x1fa5,{{0x1f65,0x3b9,0x0}}},
+{0x1fa6,{{0x1f66,0x3b9,0x0}}},
+{0x1fa7,{{0x1f67,0x3b9,0x0}}},
+{0x1fa8,{{0x1f60,0x3b9,0x0}}},
+{0x1fa9,{{0x1f61,0x3b9,0x0}}},
+{0x1faa,{{0x1f62,0x3b9,0x0}}},
+{0x1fab,{{0x1f63,0x3b9,0x0}}},
+{0x1fac,{{0x1f64,0x3b9,0x0}}},
+{0x1fad,{{0x1f65,0x3b9,0x0}}},
+{0x1fae,{{0x1f66,0x3b9,0x0}}},
+{0x1faf,{{0x1f67,0x3b9,0x0}}},
+{0x1fb2,{{0x1f70,0x3b9,0x0}}},
+{0x1fb3,{{0x3b1,0x3b9,0x0}}},
+{0x1fb4,{{0x3ac,0x3b9,0x0}}},
+{0x1fb7,{{0x1fb6,0x3b9,0x0}}},
+{0x1fb8,{{0x1fb0,0x0,0x0}}},
+{0x1fb9,{{0x1fb1,0x0,0x0}}},
+{0x1fba,{{0x1f70,0x0,0x0}}},
+{0x1fbb,{{0x3ac,0x0,0x0}}},
+{0x1fbc,{{0x3b1,0x3b9,0x0}}},
+{0x1fbd,{{0x20,0x313,0x0}}},
+{0x1fbe,{{0x3b9,0x0,0x0}}},
+{0x1fbf,{{0x20,0x313,0x0}}},
+{0x1fc0,{{0x20,0x342,0x0}}},
+{0x1fc1,{{0x20,0x308,0x342}}},
+{0x1fc2,{{0x1f74,0x3b9,0x0}}},
+{0x1fc3,{{0x3b7,0x3b9,0x0}}},
+{0x1fc4,{{0x3ae,0x3b9,0x0}}},
+{0x1fc7,{{0x1fc6,0x3b9,0x0}}},
+{0x1fc8,{{0x1f72,0x0,0x0}}},
+{0x1fc9,{{0x3ad,0x0,0x0}}},
+{0x1fca,{{0x1f74,0x0,0x0}}},
+{0x1fcb,{{0x3ae,0x0,0x0}}},
+{0x1fcc,{{0x3b7,0x3b9,0x0}}},
+{0x1fcd,{{0x20,0x313,0x300}}},
+{0x1fce,{{0x20,0x313,0x301}}},
+{0x1fcf,{{0x20,0x313,0x342}}},
+{0x1fd3,{{0x390,0x0,0x0}}},
+{0x1fd8,{{0x1fd0,0x0,0x0}}},
+{0x1fd9,{{0x1fd1,0x0,0x0}}},
+{0x1fda,{{0x1f76,0x0,0x0}}},
+{0x1fdb,{{0x3af,0x0,0x0}}},
+{0x1fdd,{{0x20,0x314,0x300}}},
+{0x1fde,{{0x20,0x314,0x301}}},
+{0x1fdf,{{0x20,0x314,0x342}}},
+{0x1fe3,{{0x3b0,0x0,0x0}}},
+{0x1fe8,{{0x1fe0,0x0,0x0}}},
+{0x1fe9,{{0x1fe1,0x0,0x0}}},
+{0x1fea,{{0x1f7a,0x0,0x0}}},
+{0x1feb,{{0x3cd,0x0,0x0}}},
+{0x1fec,{{0x1fe5,0x0,0x0}}},
+{0x1fed,{{0x20,0x308,0x300}}},
+{0x1fee,{{0x20,0x308,0x301}}},
+{0x1fef,{{0x60,0x0,0x0}}},
+{0x1ff2,{{0x1f7c,0x3b9,0x0}}},
+{0x1ff3,{{0x3c9,0x3b9,0x0}}},
+{0x1ff4,{{0x3ce,0x3b9,0x0}}},
+{0x1ff7,{{0x1ff6,0x3b9,0x0}}},
+{0x1ff8,{{0x1f78,0x0,0x0}}},
+{0x1ff9,{{0x3cc,0x0,0x0}}},
+{0x1ffa,{{0x1f7c,0x0,0x0}}},
+{0x1ffb,{{0x3ce,0x0,0x0}}},
+{0x1ffc,{{0x3c9,0x3b9,0x0}}},
+{0x1ffd,{{0x20,0x301,0x0}}},
+{0x1ffe,{{0x20,0x314,0x0}}},
+{0x2000,{{0x20,0x0,0x0}}},
+{0x2001,{{0x20,0x0,0x0}}},
+{0x2002,{{0x20,0x0,0x0}}},
+{0x2003,{{0x20,0x0,0x0}}},
+{0x2004,{{0x20,0x0,0x0}}},
+{0x2005,{{0x20,0x0,0x0}}},
+{0x2006,{{0x20,0x0,0x0}}},
+{0x2007,{{0x20,0x0,0x0}}},
+{0x2008,{{0x20,0x0,0x0}}},
+{0x2009,{{0x20,0x0,0x0}}},
+{0x200a,{{0x20,0x0,0x0}}},
+{0x200b,{{0x0,0x0,0x0}}},
+{0x200c,{{0x0,0x0,0x0}}},
+{0x200d,{{0x0,0x0,0x0}}},
+{0x200e,{{0x0,0x0,0x0}}},
+{0x200f,{{0x0,0x0,0x0}}},
+{0x2011,{{0x2010,0x0,0x0}}},
+{0x2017,{{0x20,0x333,0x0}}},
+{0x2024,{{0x2e,0x0,0x0}}},
+{0x2025,{{0x2e,0x2e,0x0}}},
+{0x2026,{{0x2e,0x2e,0x2e}}},
+{0x202a,{{0x0,0x0,0x0}}},
+{0x202b,{{0x0,0x0,0x0}}},
+{0x202c,{{0x0,0x0,0x0}}},
+{0x202d,{{0x0,0x0,0x0}}},
+{0x202e,{{0x0,0x0,0x0}}},
+{0x202f,{{0x20,0x0,0x0}}},
+{0x2033,{{0x2032,0x2032,0x0}}},
+{0x2034,{{0x2032,0x2032,0x2032}}},
+{0x2036,{{0x2035,0x2035,0x0}}},
+{0x2037,{{0x2035,0x2035,0x2035}}},
+{0x203c,{{0x21,0x21,0x0}}},
+{0x203e,{{0x20,0x305,0x0}}},
+{0x2047,{{0x3f,0x3f,0x0}}},
+{0x2048,{{0x3f,0x21,0x0}}},
+{0x2049,{{0x21,0x3f,0x0}}},
+{0x205f,{{0x20,0x0,0x0}}},
+{0x2060,{{0x0,0x0,0x0}}},
+{0x2061,{{0x0,0x0,0x0}}},
+{0x2062,{{0x0,0x0,0x0}}},
+{0x2063,{{0x0,0x0,0x0}}},
+{0x2064,{{0x0,0x0,0x0}}},
+{0x2065,{{0x0,0x0,0x0}}},
+{0x2066,{{0x0,0x0,0x0}}},
+{0x2067,{{0x0,0x0,0x0}}},
+{0x2068,{{0x0,0x0,0x0}}},
+{0x2069,{{0x0,0x0,0x0}}},
+{0x206a,{{0x0,0x0,0x0}}},
+{0x206b,{{0x0,0x0,0x0}}},
+{0x206c,{{0x0,0x0,0x0}}},
+{0x206d,{{0x0,0x0,0x0}}},
+{0x206e,{{0x0,0x0,0x0}}},
+{0x206f,{{0x0,0x0,0x0}}},
+{0x2070,{{0x30,0x0,0x0}}},
+{0x2071,{{0x69,0x0,0x0}}},
+{0x2074,{{0x34,0x0,0x0}}},
+{0x2075,{{0x35,0x0,0x0}}},
+{0x2076,{{0x36,0x0,0x0}}},
+{0x2077,{{0x37,0x0,0x0}}},
+{0x2078,{{0x38,0x0,0x0}}},
+{0x2079,{{0x39,0x0,0x0}}},
+{0x207a,{{0x2b,0x0,0x0}}},
+{0x207b,{{0x2212,0x0,0x0}}},
+{0x207c,{{0x3d,0x0,0x0}}},
+{0x207d,{{0x28,0x0,0x0}}},
+{0x207e,{{0x29,0x0,0x0}}},
+{0x207f,{{0x6e,0x0,0x0}}},
+{0x2080,{{0x30,0x0,0x0}}},
+{0x2081,{{0x31,0x0,0x0}}},
+{0x2082,{{0x32,0x0,0x0}}},
+{0x2083,{{0x33,0x0,0x0}}},
+{0x2084,{{0x34,0x0,0x0}}},
+{0x2085,{{0x35,0x0,0x0}}},
+{0x2086,{{0x36,0x0,0x0}}},
+{0x2087,{{0x37,0x0,0x0}}},
+{0x2088,{{0x38,0x0,0x0}}},
+{0x2089,{{0x39,0x0,0x0}}},
+{0x208a,{{0x2b,0x0,0x0}}},
+{0x208b,{{0x2212,0x0,0x0}}},
+{0x208c,{{0x3d,0x0,0x0}}},
+{0x208d,{{0x28,0x0,0x0}}},
+{0x208e,{{0x29,0x0,0x0}}},
+{0x2090,{{0x61,0x0,0x0}}},
+{0x2091,{{0x65,0x0,0x0}}},
+{0x2092,{{0x6f,0x0,0x0}}},
+{0x2093,{{0x78,0x0,0x0}}},
+{0x2094,{{0x259,0x0,0x0}}},
+{0x2095,{{0x68,0x0,0x0}}},
+{0x2096,{{0x6b,0x0,0x0}}},
+{0x2097,{{0x6c,0x0,0x0}}},
+{0x2098,{{0x6d,0x0,0x0}}},
+{0x2099,{{0x6e,0x0,0x0}}},
+{0x209a,{{0x70,0x0,0x0}}},
+{0x209b,{{0x73,0x0,0x0}}},
+{0x209c,{{0x74,0x0,0x0}}},
+{0x20a8,{{0x72,0x73,0x0}}},
+{0x2100,{{0x61,0x2f,0x63}}},
+{0x2101,{{0x61,0x2f,0x73}}},
+{0x2102,{{0x63,0x0,0x0}}},
+{0x2103,{{0xb0,0x63,0x0}}},
+{0x2105,{{0x63,0x2f,0x6f}}},
+{0x2106,{{0x63,0x2f,0x75}}},
+{0x2107,{{0x25b,0x0,0x0}}},
+{0x2109,{{0xb0,0x66,0x0}}},
+{0x210a,{{0x67,0x0,0x0}}},
+{0x210b,{{0x68,0x0,0x0}}},
+{0x210c,{{0x68,0x0,0x0}}},
+{0x210d,{{0x68,0x0,0x0}}},
+{0x210e,{{0x68,0x0,0x0}}},
+{0x210f,{{0x127,0x0,0x0}}},
+{0x2110,{{0x69,0x0,0x0}}},
+{0x2111,{{0x69,0x0,0x0}}},
+{0x2112,{{0x6c,0x0,0x0}}},
+{0x2113,{{0x6c,0x0,0x0}}},
+{0x2115,{{0x6e,0x0,0x0}}},
+{0x2116,{{0x6e,0x6f,0x0}}},
+{0x2119,{{0x70,0x0,0x0}}},
+{0x211a,{{0x71,0x0,0x0}}},
+{0x211b,{{0x72,0x0,0x0}}},
+{0x211c,{{0x72,0x0,0x0}}},
+{0x211d,{{0x72,0x0,0x0}}},
+{0x2120,{{0x73,0x6d,0x0}}},
+{0x2121,{{0x74,0x65,0x6c}}},
+{0x2122,{{0x74,0x6d,0x0}}},
+{0x2124,{{0x7a,0x0,0x0}}},
+{0x2126,{{0x3c9,0x0,0x0}}},
+{0x2128,{{0x7a,0x0,0x0}}},
+{0x212a,{{0x6b,0x0,0x0}}},
+{0x212b,{{0xe5,0x0,0x0}}},
+{0x212c,{{0x62,0x0,0x0}}},
+{0x212d,{{0x63,0x0,0x0}}},
+{0x212f,{{0x65,0x0,0x0}}},
+{0x2130,{{0x65,0x0,0x0}}},
+{0x2131,{{0x66,0x0,0x0}}},
+{0x2132,{{0x214e,0x0,0x0}}},
+{0x2133,{{0x6d,0x0,0x0}}},
+{0x2134,{{0x6f,0x0,0x0}}},
+{0x2135,{{0x5d0,0x0,0x0}}},
+{0x2136,{{0x5d1,0x0,0x0}}},
+{0x2137,{{0x5d2,0x0,0x0}}},
+{0x2138,{{0x5d3,0x0,0x0}}},
+{0x2139,{{0x69,0x0,0x0}}},
+{0x213b,{{0x66,0x61,0x78}}},
+{0x213c,{{0x3c0,0x0,0x0}}},
+{0x213d,{{0x3b3,0x0,0x0}}},
+{0x213e,{{0x3b3,0x0,0x0}}},
+{0x213f,{{0x3c0,0x0,0x0}}},
+{0x2140,{{0x2211,0x0,0x0}}},
+{0x2145,{{0x64,0x0,0x0}}},
+{0x2146,{{0x64,0x0,0x0}}},
+{0x2147,{{0x65,0x0,0x0}}},
+{0x2148,{{0x69,0x0,0x0}}},
+{0x2149,{{0x6a,0x0,0x0}}},
+{0x2150,{{0x31,0x2044,0x37}}},
+{0x2151,{{0x31,0x2044,0x39}}},
+{0x2153,{{0x31,0x2044,0x33}}},
+{0x2154,{{0x32,0x2044,0x33}}},
+{0x2155,{{0x31,0x2044,0x35}}},
+{0x2156,{{0x32,0x2044,0x35}}},
+{0x2157,{{0x33,0x2044,0x35}}},
+{0x2158,{{0x34,0x2044,0x35}}},
+{0x2159,{{0x31,0x2044,0x36}}},
+{0x215a,{{0x35,0x2044,0x36}}},
+{0x215b,{{0x31,0x2044,0x38}}},
+{0x215c,{{0x33,0x2044,0x38}}},
+{0x215d,{{0x35,0x2044,0x38}}},
+{0x215e,{{0x37,0x2044,0x38}}},
+{0x215f,{{0x31,0x2044,0x0}}},
+{0x2160,{{0x69,0x0,0x0}}},
+{0x2161,{{0x69,0x69,0x0}}},
+{0x2162,{{0x69,0x69,0x69}}},
+{0x2163,{{0x69,0x76,0x0}}},
+{0x2164,{{0x76,0x0,0x0}}},
+{0x2165,{{0x76,0x69,0x0}}},
+{0x2166,{{0x76,0x69,0x69}}},
+{0x2168,{{0x69,0x78,0x0}}},
+{0x2169,{{0x78,0x0,0x0}}},
+{0x216a,{{0x78,0x69,0x0}}},
+{0x216b,{{0x78,0x69,0x69}}},
+{0x216c,{{0x6c,0x0,0x0}}},
+{0x216d,{{0x63,0x0,0x0}}},
+{0x216e,{{0x64,0x0,0x0}}},
+{0x216f,{{0x6d,0x0,0x0}}},
+{0x2170,{{0x69,0x0,0x0}}},
+{0x2171,{{0x69,0x69,0x0}}},
+{0x2172,{{0x69,0x69,0x69}}},
+{0x2173,{{0x69,0x76,0x0}}},
+{0x2174,{{0x76,0x0,0x0}}},
+{0x2175,{{0x76,0x69,0x0}}},
+{0x2176,{{0x76,0x69,0x69}}},
+{0x2178,{{0x69,0x78,0x0}}},
+{0x2179,{{0x78,0x0,0x0}}},
+{0x217a,{{0x78,0x69,0x0}}},
+{0x217b,{{0x78,0x69,0x69}}},
+{0x217c,{{0x6c,0x0,0x0}}},
+{0x217d,{{0x63,0x0,0x0}}},
+{0x217e,{{0x64,0x0,0x0}}},
+{0x217f,{{0x6d,0x0,0x0}}},
+{0x2183,{{0x2184,0x0,0x0}}},
+{0x2189,{{0x30,0x2044,0x33}}},
+{0x222c,{{0x222b,0x222b,0x0}}},
+{0x222d,{{0x222b,0x222b,0x222b}}},
+{0x222f,{{0x222e,0x222e,0x0}}},
+{0x2230,{{0x222e,0x222e,0x222e}}},
+{0x2329,{{0x3008,0x0,0x0}}},
+{0x232a,{{0x3009,0x0,0x0}}},
+{0x2460,{{0x31,0x0,0x0}}},
+{0x2461,{{0x32,0x0,0x0}}},
+{0x2462,{{0x33,0x0,0x0}}},
+{0x2463,{{0x34,0x0,0x0}}},
+{0x2464,{{0x35,0x0,0x0}}},
+{0x2465,{{0x36,0x0,0x0}}},
+{0x2466,{{0x37,0x0,0x0}}},
+{0x2467,{{0x38,0x0,0x0}}},
+{0x2468,{{0x39,0x0,0x0}}},
+{0x2469,{{0x31,0x30,0x0}}},
+{0x246a,{{0x31,0x31,0x0}}},
+{0x246b,{{0x31,0x32,0x0}}},
+{0x246c,{{0x31,0x33,0x0}}},
+{0x246d,{{0x31,0x34,0x0}}},
+{0x246e,{{0x31,0x35,0x0}}},
+{0x246f,{{0x31,0x36,0x0}}},
+{0x2470,{{0x31,0x37,0x0}}},
+{0x2471,{{0x31,0x38,0x0}}},
+{0x2472,{{0x31,0x39,0x0}}},
+{0x2473,{{0x32,0x30,0x0}}},
+{0x2474,{{0x28,0x31,0x29}}},
+{0x2475,{{0x28,0x32,0x29}}},
+{0x2476,{{0x28,0x33,0x29}}},
+{0x2477,{{0x28,0x34,0x29}}},
+{0x2478,{{0x28,0x35,0x29}}},
+{0x2479,{{0x28,0x36,0x29}}},
+{0x247a,{{0x28,0x37,0x29}}},
+{0x247b,{{0x28,0x38,0x29}}},
+{0x247c,{{0x28,0x39,0x29}}},
+{0x2488,{{0x31,0x2e,0x0}}},
+{0x2489,{{0x32,0x2e,0x0}}},
+{0x248a,{{0x33,0x2e,0x0}}},
+{0x248b,{{0x34,0x2e,0x0}}},
+{0x248c,{{0x35,0x2e,0x0}}},
+{0x248d,{{0x36,0x2e,0x0}}},
+{0x248e,{{0x37,0x2e,0x0}}},
+{0x248f,{{0x38,0x2e,0x0}}},
+{0x2490,{{0x39,0x2e,0x0}}},
+{0x2491,{{0x31,0x30,0x2e}}},
+{0x2492,{{0x31,0x31,0x2e}}},
+{0x2493,{{0x31,0x32,0x2e}}},
+{0x2494,{{0x31,0x33,0x2e}}},
+{0x2495,{{0x31,0x34,0x2e}}},
+{0x2496,{{0x31,0x35,0x2e}}},
+{0x2497,{{0x31,0x36,0x2e}}},
+{0x2498,{{0x31,0x37,0x2e}}},
+{0x2499,{{0x31,0x38,0x2e}}},
+{0x249a,{{0x31,0x39,0x2e}}},
+{0x249b,{{0x32,0x30,0x2e}}},
+{0x249c,{{0x28,0x61,0x29}}},
+{0x249d,{{0x28,0x62,0x29}}},
+{0x249e,{{0x28,0x63,0x29}}},
+{0x249f,{{0x28,0x64,0x29}}},
+{0x24a0,{{0x28,0x65,0x29}}},
+{0x24a1,{{0x28,0x66,0x29}}},
+{0x24a2,{{0x28,0x67,0x29}}},
+{0x24a3,{{0x28,0x68,0x29}}},
+{0x24a4,{{0x28,0x69,0x29}}},
+{0x24a5,{{0x28,0x6a,0x29}}},
+{0x24a6,{{0x28,0x6b,0x29}}},
+{0x24a7,{{0x28,0x6c,0x29}}},
+{0x24a8,{{0x28,0x6d,0x29}}},
+{0x24a9,{{0x28,0x6e,0x29}}},
+{0x24aa,{{0x28,0x6f,0x29}}},
+{0x24ab,{{0x28,0x70,0x29}}},
+{0x24ac,{{0x28,0x71,0x29}}},
+{0x24ad,{{0x28,0x72,0x29}}},
+{0x24ae,{{0x28,0x73,0x29}}},
+{0x24af,{{0x28,0x74,0x29}}},
+{0x24b0,{{0x28,0x75,0x29}}},
+{0x24b1,{{0x28,0x76,0x29}}},
+{0x24b2,{{0x28,0x77,0x29}}},
+{0x24b3,{{0x28,0x78,0x29}}},
+{0x24b4,{{0x28,0x79,0x29}}},
+{0x24b5,{{0x28,0x7a,0x29}}},
+{0x24b6,{{0x61,0x0,0x0}}},
+{0x24b7,{{0x62,0x0,0x0}}},
+{0x24b8,{{0x63,0x0,0x0}}},
+{0x24b9,{{0x64,0x0,0x0}}},
+{0x24ba,{{0x65,0x0,0x0}}},
+{0x24bb,{{0x66,0x0,0x0}}},
+{0x24bc,{{0x67,0x0,0x0}}},
+{0x24bd,{{0x68,0x0,0x0}}},
+{0x24be,{{0x69,0x0,0x0}}},
+{0x24bf,{{0x6a,0x0,0x0}}},
+{0x24c0,{{0x6b,0x0,0x0}}},
+{0x24c1,{{0x6c,0x0,0x0}}},
+{0x24c2,{{0x6d,0x0,0x0}}},
+{0x24c3,{{0x6e,0x0,0x0}}},
+{0x24c4,{{0x6f,0x0,0x0}}},
+{0x24c5,{{0x70,0x0,0x0}}},
+{0x24c6,{{0x71,0x0,0x0}}},
+{0x24c7,{{0x72,0x0,0x0}}},
+{0x24c8,{{0x73,0x0,0x0}}},
+{0x24c9,{{0x74,0x0,0x0}}},
+{0x24ca,{{0x75,0x0,0x0}}},
+{0x24cb,{{0x76,0x0,0x0}}},
+{0x24cc,{{0x77,0x0,0x0}}},
+{0x24cd,{{0x78,0x0,0x0}}},
+{0x24ce,{{0x79,0x0,0x0}}},
+{0x24cf,{{0x7a,0x0,0x0}}},
+{0x24d0,{{0x61,0x0,0x0}}},
+{0x24d1,{{0x62,0x0,0x0}}},
+{0x24d2,{{0x63,0x0,0x0}}},
+{0x24d3,{{0x64,0x0,0x0}}},
+{0x24d4,{{0x65,0x0,0x0}}},
+{0x24d5,{{0x66,0x0,0x0}}},
+{0x24d6,{{0x67,0x0,0x0}}},
+{0x24d7,{{0x68,0x0,0x0}}},
+{0x24d8,{{0x69,0x0,0x0}}},
+{0x24d9,{{0x6a,0x0,0x0}}},
+{0x24da,{{0x6b,0x0,0x0}}},
+{0x24db,{{0x6c,0x0,0x0}}},
+{0x24dc,{{0x6d,0x0,0x0}}},
+{0x24dd,{{0x6e,0x0,0x0}}},
+{0x24de,{{0x6f,0x0,0x0}}},
+{0x24df,{{0x70,0x0,0x0}}},
+{0x24e0,{{0x71,0x0,0x0}}},
+{0x24e1,{{0x72,0x0,0x0}}},
+{0x24e2,{{0x73,0x0,0x0}}},
+{0x24e3,{{0x74,0x0,0x0}}},
+{0x24e4,{{0x75,0x0,0x0}}},
+{0x24e5,{{0x76,0x0,0x0}}},
+{0x24e6,{{0x77,0x0,0x0}}},
+{0x24e7,{{0x78,0x0,0x0}}},
+{0x24e8,{{0x79,0x0,0x0}}},
+{0x24e9,{{0x7a,0x0,0x0}}},
+{0x24ea,{{0x30,0x0,0x0}}},
+{0x2a74,{{0x3a,0x3a,0x3d}}},
+{0x2a75,{{0x3d,0x3d,0x0}}},
+{0x2a76,{{0x3d,0x3d,0x3d}}},
+{0x2adc,{{0x2add,0x338,0x0}}},
+{0x2c00,{{0x2c30,0x0,0x0}}},
+{0x2c01,{{0x2c31,0x0,0x0}}},
+{0x2c02,{{0x2c32,0x0,0x0}}},
+{0x2c03,{{0x2c33,0x0,0x0}}},
+{0x2c04,{{0x2c34,0x0,0x0}}},
+{0x2c05,{{0x2c35,0x0,0x0}}},
+{0x2c06,{{0x2c36,0x0,0x0}}},
+{0x2c07,{{0x2c37,0x0,0x0}}},
+{0x2c08,{{0x2c38,0x0,0x0}}},
+{0x2c09,{{0x2c39,0x0,0x0}}},
+{0x2c0a,{{0x2c3a,0x0,0x0}}},
+{0x2c0b,{{0x2c3b,0x0,0x0}}},
+{0x2c0c,{{0x2c3c,0x0,0x0}}},
+{0x2c0d,{{0x2c3d,0x0,0x0}}},
+{0x2c0e,{{0x2c3e,0x0,0x0}}},
+{0x2c0f,{{0x2c3f,0x0,0x0}}},
+{0x2c10,{{0x2c40,0x0,0x0}}},
+{0x2c11,{{0x2c41,0x0,0x0}}},
+{0x2c12,{{0x2c42,0x0,0x0}}},
+{0x2c13,{{0x2c43,0x0,0x0}}},
+{0x2c14,{{0x2c44,0x0,0x0}}},
+{0x2c15,{{0x2c45,0x0,0x0}}},
+{0x2c16,{{0x2c46,0x0,0x0}}},
+{0x2c17,{{0x2c47,0x0,0x0}}},
+{0x2c18,{{0x2c48,0x0,0x0}}},
+{0x2c19,{{0x2c49,0x0,0x0}}},
+{0x2c1a,{{0x2c4a,0x0,0x0}}},
+{0x2c1b,{{0x2c4b,0x0,0x0}}},
+{0x2c1c,{{0x2c4c,0x0,0x0}}},
+{0x2c1d,{{0x2c4d,0x0,0x0}}},
+{0x2c1e,{{0x2c4e,0x0,0x0}}},
+{0x2c1f,{{0x2c4f,0x0,0x0}}},
+{0x2c20,{{0x2c50,0x0,0x0}}},
+{0x2c21,{{0x2c51,0x0,0x0}}},
+{0x2c22,{{0x2c52,0x0,0x0}}},
+{0x2c23,{{0x2c53,0x0,0x0}}},
+{0x2c24,{{0x2c54,0x0,0x0}}},
+{0x2c25,{{0x2c55,0x0,0x0}}},
+{0x2c26,{{0x2c56,0x0,0x0}}},
+{0x2c27,{{0x2c57,0x0,0x0}}},
+{0x2c28,{{0x2c58,0x0,0x0}}},
+{0x2c29,{{0x2c59,0x0,0x0}}},
+{0x2c2a,{{0x2c5a,0x0,0x0}}},
+{0x2c2b,{{0x2c5b,0x0,0x0}}},
+{0x2c2c,{{0x2c5c,0x0,0x0}}},
+{0x2c2d,{{0x2c5d,0x0,0x0}}},
+{0x2c2e,{{0x2c5e,0x0,0x0}}},
+{0x2c2f,{{0x2c5f,0x0,0x0}}},
+{0x2c60,{{0x2c61,0x0,0x0}}},
+{0x2c62,{{0x26b,0x0,0x0}}},
+{0x2c63,{{0x1d7d,0x0,0x0}}},
+{0x2c64,{{0x27d,0x0,0x0}}},
+{0x2c67,{{0x2c68,0x0,0x0}}},
+{0x2c69,{{0x2c6a,0x0,0x0}}},
+{0x2c6b,{{0x2c6c,0x0,0x0}}},
+{0x2c6d,{{0x251,0x0,0x0}}},
+{0x2c6e,{{0x271,0x0,0x0}}},
+{0x2c6f,{{0x250,0x0,0x0}}},
+{0x2c70,{{0x252,0x0,0x0}}},
+{0x2c72,{{0x2c73,0x0,0x0}}},
+{0x2c75,{{0x2c76,0x0,0x0}}},
+{0x2c7c,{{0x6a,0x0,0x0}}},
+{0x2c7d,{{0x76,0x0,0x0}}},
+{0x2c7e,{{0x23f,0x0,0x0}}},
+{0x2c7f,{{0x240,0x0,0x0}}},
+{0x2c80,{{0x2c81,0x0,0x0}}},
+{0x2c82,{{0x2c83,0x0,0x0}}},
+{0x2c84,{{0x2c85,0x0,0x0}}},
+{0x2c86,{{0x2c87,0x0,0x0}}},
+{0x2c88,{{0x2c89,0x0,0x0}}},
+{0x2c8a,{{0x2c8b,0x0,0x0}}},
+{0x2c8c,{{0x2c8d,0x0,0x0}}},
+{0x2c8e,{{0x2c8f,0x0,0x0}}},
+{0x2c90,{{0x2c91,0x0,0x0}}},
+{0x2c92,{{0x2c93,0x0,0x0}}},
+{0x2c94,{{0x2c95,0x0,0x0}}},
+{0x2c96,{{0x2c97,0x0,0x0}}},
+{0x2c98,{{0x2c99,0x0,0x0}}},
+{0x2c9a,{{0x2c9b,0x0,0x0}}},
+{0x2c9c,{{0x2c9d,0x0,0x0}}},
+{0x2c9e,{{0x2c9f,0x0,0x0}}},
+{0x2ca0,{{0x2ca1,0x0,0x0}}},
+{0x2ca2,{{0x2ca3,0x0,0x0}}},
+{0x2ca4,{{0x2ca5,0x0,0x0}}},
+{0x2ca6,{{0x2ca7,0x0,0x0}}},
+{0x2ca8,{{0x2ca9,0x0,0x0}}},
+{0x2caa,{{0x2cab,0x0,0x0}}},
+{0x2cac,{{0x2cad,0x0,0x0}}},
+{0x2cae,{{0x2caf,0x0,0x0}}},
+{0x2cb0,{{0x2cb1,0x0,0x0}}},
+{0x2cb2,{{0x2cb3,0x0,0x0}}},
+{0x2cb4,{{0x2cb5,0x0,0x0}}},
+{0x2cb6,{{0x2cb7,0x0,0x0}}},
+{0x2cb8,{{0x2cb9,0x0,0x0}}},
+{0x2cba,{{0x2cbb,0x0,0x0}}},
+{0x2cbc,{{0x2cbd,0x0,0x0}}},
+{0x2cbe,{{0x2cbf,0x0,0x0}}},
+{0x2cc0,{{0x2cc1,0x0,0x0}}},
+{0x2cc2,{{0x2cc3,0x0,0x0}}},
+{0x2cc4,{{0x2cc5,0x0,0x0}}},
+{0x2cc6,{{0x2cc7,0x0,0x0}}},
+{0x2cc8,{{0x2cc9,0x0,0x0}}},
+{0x2cca,{{0x2ccb,0x0,0x0}}},
+{0x2ccc,{{0x2ccd,0x0,0x0}}},
+{0x2cce,{{0x2ccf,0x0,0x0}}},
+{0x2cd0,{{0x2cd1,0x0,0x0}}},
+{0x2cd2,{{0x2cd3,0x0,0x0}}},
+{0x2cd4,{{0x2cd5,0x0,0x0}}},
+{0x2cd6,{{0x2cd7,0x0,0x0}}},
+{0x2cd8,{{0x2cd9,0x0,0x0}}},
+{0x2cda,{{0x2cdb,0x0,0x0}}},
+{0x2cdc,{{0x2cdd,0x0,0x0}}},
+{0x2cde,{{0x2cdf,0x0,0x0}}},
+{0x2ce0,{{0x2ce1,0x0,0x0}}},
+{0x2ce2,{{0x2ce3,0x0,0x0}}},
+{0x2ceb,{{0x2cec,0x0,0x0}}},
+{0x2ced,{{0x2cee,0x0,0x0}}},
+{0x2cf2,{{0x2cf3,0x0,0x0}}},
+{0x2d6f,{{0x2d61,0x0,0x0}}},
+{0x2e9f,{{0x6bcd,0x0,0x0}}},
+{0x2ef3,{{0x9f9f,0x0,0x0}}},
+{0x2f00,{{0x4e00,0x0,0x0}}},
+{0x2f01,{{0x4e28,0x0,0x0}}},
+{0x2f02,{{0x4e36,0x0,0x0}}},
+{0x2f03,{{0x4e3f,0x0,0x0}}},
+{0x2f04,{{0x4e59,0x0,0x0}}},
+{0x2f05,{{0x4e85,0x0,0x0}}},
+{0x2f06,{{0x4e8c,0x0,0x0}}},
+{0x2f07,{{0x4ea0,0x0,0x0}}},
+{0x2f08,{{0x4eba,0x0,0x0}}},
+{0x2f09,{{0x513f,0x0,0x0}}},
+{0x2f0a,{{0x5165,0x0,0x0}}},
+{0x2f0b,{{0x516b,0x0,0x0}}},
+{0x2f0c,{{0x5182,0x0,0x0}}},
+{0x2f0d,{{0x5196,0x0,0x0}}},
+{0x2f0e,{{0x51ab,0x0,0x0}}},
+{0x2f0f,{{0x51e0,0x0,0x0}}},
+{0x2f10,{{0x51f5,0x0,0x0}}},
+{0x2f11,{{0x5200,0x0,0x0}}},
+{0x2f12,{{0x529b,0x0,0x0}}},
+{0x2f13,{{0x52f9,0x0,0x0}}},
+{0x2f14,{{0x5315,0x0,0x0}}},
+{0x2f15,{{0x531a,0x0,0x0}}},
+{0x2f16,{{0x5338,0x0,0x0}}},
+{0x2f17,{{0x5341,0x0,0x0}}},
+{0x2f18,{{0x535c,0x0,0x0}}},
+{0x2f19,{{0x5369,0x0,0x0}}},
+{0x2f1a,{{0x5382,0x0,0x0}}},
+{0x2f1b,{{0x53b6,0x0,0x0}}},
+{0x2f1c,{{0x53c8,0x0,0x0}}},
+{0x2f1d,{{0x53e3,0x0,0x0}}},
+{0x2f1e,{{0x56d7,0x0,0x0}}},
+{0x2f1f,{{0x571f,0x0,0x0}}},
+{0x2f20,{{0x58eb,0x0,0x0}}},
+{0x2f21,{{0x5902,0x0,0x0}}},
+{0x2f22,{{0x590a,0x0,0x0}}},
+{0x2f23,{{0x5915,0x0,0x0}}},
+{0x2f24,{{0x5927,0x0,0x0}}},
+{0x2f25,{{0x5973,0x0,0x0}}},
+{0x2f26,{{0x5b50,0x0,0x0}}},
+{0x2f27,{{0x5b80,0x0,0x0}}},
+{0x2f28,{{0x5bf8,0x0,0x0}}},
+{0x2f29,{{0x5c0f,0x0,0x0}}},
+{0x2f2a,{{0x5c22,0x0,0x0}}},
+{0x2f2b,{{0x5c38,0x0,0x0}}},
+{0x2f2c,{{0x5c6e,0x0,0x0}}},
+{0x2f2d,{{0x5c71,0x0,0x0}}},
+{0x2f2e,{{0x5ddb,0x0,0x0}}},
+{0x2f2f,{{0x5de5,0x0,0x0}}},
+{0x2f30,{{0x5df1,0x0,0x0}}},
+{0x2f31,{{0x5dfe,0x0,0x0}}},
+{0x2f32,{{0x5e72,0x0,0x0}}},
+{0x2f33,{{0x5e7a,0x0,0x0}}},
+{0x2f34,{{0x5e7f,0x0,0x0}}},
+{0x2f35,{{0x5ef4,0x0,0x0}}},
+{0x2f36,{{0x5efe,0x0,0x0}}},
+{0x2f37,{{0x5f0b,0x0,0x0}}},
+{0x2f38,{{0x5f13,0x0,0x0}}},
+{0x2f39,{{0x5f50,0x0,0x0}}},
+{0x2f3a,{{0x5f61,0x0,0x0}}},
+{0x2f3b,{{0x5f73,0x0,0x0}}},
+{0x2f3c,{{0x5fc3,0x0,0x0}}},
+{0x2f3d,{{0x6208,0x0,0x0}}},
+{0x2f3e,{{0x6236,0x0,0x0}}},
+{0x2f3f,{{0x624b,0x0,0x0}}},
+{0x2f40,{{0x652f,0x0,0x0}}},
+{0x2f41,{{0x6534,0x0,0x0}}},
+{0x2f42,{{0x6587,0x0,0x0}}},
+{0x2f43,{{0x6597,0x0,0x0}}},
+{0x2f44,{{0x65a4,0x0,0x0}}},
+{0x2f45,{{0x65b9,0x0,0x0}}},
+{0x2f46,{{0x65e0,0x0,0x0}}},
+{0x2f47,{{0x65e5,0x0,0x0}}},
+{0x2f48,{{0x66f0,0x0,0x0}}},
+{0x2f49,{{0x6708,0x0,0x0}}},
+{0x2f4a,{{0x6728,0x0,0x0}}},
+{0x2f4b,{{0x6b20,0x0,0x0}}},
+{0x2f4c,{{0x6b62,0x0,0x0}}},
+{0x2f4d,{{0x6b79,0x0,0x0}}},
+{0x2f4e,{{0x6bb3,0x0,0x0}}},
+{0x2f4f,{{0x6bcb,0x0,0x0}}},
+{0x2f50,{{0x6bd4,0x0,0x0}}},
+{0x2f51,{{0x6bdb,0x0,0x0}}},
+{0x2f52,{{0x6c0f,0x0,0x0}}},
+{0x2f53,{{0x6c14,0x0,0x0}}},
+{0x2f54,{{0x6c34,0x0,0x0}}},
+{0x2f55,{{0x706b,0x0,0x0}}},
+{0x2f56,{{0x722a,0x0,0x0}}},
+{0x2f57,{{0x7236,0x0,0x0}}},
+{0x2f58,{{0x723b,0x0,0x0}}},
+{0x2f59,{{0x723f,0x0,0x0}}},
+{0x2f5a,{{0x7247,0x0,0x0}}},
+{0x2f5b,{{0x7259,0x0,0x0}}},
+{0x2f5c,{{0x725b,0x0,0x0}}},
+{0x2f5d,{{0x72ac,0x0,0x0}}},
+{0x2f5e,{{0x7384,0x0,0x0}}},
+{0x2f5f,{{0x7389,0x0,0x0}}},
+{0x2f60,{{0x74dc,0x0,0x0}}},
+{0x2f61,{{0x74e6,0x0,0x0}}},
+{0x2f62,{{0x7518,0x0,0x0}}},
+{0x2f63,{{0x751f,0x0,0x0}}},
+{0x2f64,{{0x7528,0x0,0x0}}},
+{0x2f65,{{0x7530,0x0,0x0}}},
+{0x2f66,{{0x758b,0x0,0x0}}},
+{0x2f67,{{0x7592,0x0,0x0}}},
+{0x2f68,{{0x7676,0x0,0x0}}},
+{0x2f69,{{0x767d,0x0,0x0}}},
+{0x2f6a,{{0x76ae,0x0,0x0}}},
+{0x2f6b,{{0x76bf,0x0,0x0}}},
+{0x2f6c,{{0x76ee,0x0,0x0}}},
+{0x2f6d,{{0x77db,0x0,0x0}}},
+{0x2f6e,{{0x77e2,0x0,0x0}}},
+{0x2f6f,{{0x77f3,0x0,0x0}}},
+{0x2f70,{{0x793a,0x0,0x0}}},
+{0x2f71,{{0x79b8,0x0,0x0}}},
+{0x2f72,{{0x79be,0x0,0x0}}},
+{0x2f73,{{0x7a74,0x0,0x0}}},
+{0x2f74,{{0x7acb,0x0,0x0}}},
+{0x2f75,{{0x7af9,0x0,0x0}}},
+{0x2f76,{{0x7c73,0x0,0x0}}},
+{0x2f77,{{0x7cf8,0x0,0x0}}},
+{0x2f78,{{0x7f36,0x0,0x0}}},
+{0x2f79,{{0x7f51,0x0,0x0}}},
+{0x2f7a,{{0x7f8a,0x0,0x0}}},
+{0x2f7b,{{0x7fbd,0x0,0x0}}},
+{0x2f7c,{{0x8001,0x0,0x0}}},
+{0x2f7d,{{0x800c,0x0,0x0}}},
+{0x2f7e,{{0x8012,0x0,0x0}}},
+{0x2f7f,{{0x8033,0x0,0x0}}},
+{0x2f80,{{0x807f,0x0,0x0}}},
+{0x2f81,{{0x8089,0x0,0x0}}},
+{0x2f82,{{0x81e3,0x0,0x0}}},
+{0x2f83,{{0x81ea,0x0,0x0}}},
+{0x2f84,{{0x81f3,0x0,0x0}}},
+{0x2f85,{{0x81fc,0x0,0x0}}},
+{0x2f86,{{0x820c,0x0,0x0}}},
+{0x2f87,{{0x821b,0x0,0x0}}},
+{0x2f88,{{0x821f,0x0,0x0}}},
+{0x2f89,{{0x826e,0x0,0x0}}},
+{0x2f8a,{{0x8272,0x0,0x0}}},
+{0x2f8b,{{0x8278,0x0,0x0}}},
+{0x2f8c,{{0x864d,0x0,0x0}}},
+{0x2f8d,{{0x866b,0x0,0x0}}},
+{0x2f8e,{{0x8840,0x0,0x0}}},
+{0x2f8f,{{0x884c,0x0,0x0}}},
+{0x2f90,{{0x8863,0x0,0x0}}},
+{0x2f91,{{0x897e,0x0,0x0}}},
+{0x2f92,{{0x898b,0x0,0x0}}},
+{0x2f93,{{0x89d2,0x0,0x0}}},
+{0x2f94,{{0x8a00,0x0,0x0}}},
+{0x2f95,{{0x8c37,0x0,0x0}}},
+{0x2f96,{{0x8c46,0x0,0x0}}},
+{0x2f97,{{0x8c55,0x0,0x0}}},
+{0x2f98,{{0x8c78,0x0,0x0}}},
+{0x2f99,{{0x8c9d,0x0,0x0}}},
+{0x2f9a,{{0x8d64,0x0,0x0}}},
+{0x2f9b,{{0x8d70,0x0,0x0}}},
+{0x2f9c,{{0x8db3,0x0,0x0}}},
+{0x2f9d,{{0x8eab,0x0,0x0}}},
+{0x2f9e,{{0x8eca,0x0,0x0}}},
+{0x2f9f,{{0x8f9b,0x0,0x0}}},
+{0x2fa0,{{0x8fb0,0x0,0x0}}},
+{0x2fa1,{{0x8fb5,0x0,0x0}}},
+{0x2fa2,{{0x9091,0x0,0x0}}},
+{0x2fa3,{{0x9149,0x0,0x0}}},
+{0x2fa4,{{0x91c6,0x0,0x0}}},
+{0x2fa5,{{0x91cc,0x0,0x0}}},
+{0x2fa6,{{0x91d1,0x0,0x0}}},
+{0x2fa7,{{0x9577,0x0,0x0}}},
+{0x2fa8,{{0x9580,0x0,0x0}}},
+{0x2fa9,{{0x961c,0x0,0x0}}},
+{0x2faa,{{0x96b6,0x0,0x0}}},
+{0x2fab,{{0x96b9,0x0,0x0}}},
+{0x2fac,{{0x96e8,0x0,0x0}}},
+{0x2fad,{{0x9751,0x0,0x0}}},
+{0x2fae,{{0x975e,0x0,0x0}}},
+{0x2faf,{{0x9762,0x0,0x0}}},
+{0x2fb0,{{0x9769,0x0,0x0}}},
+{0x2fb1,{{0x97cb,0x0,0x0}}},
+{0x2fb2,{{0x97ed,0x0,0x0}}},
+{0x2fb3,{{0x97f3,0x0,0x0}}},
+{0x2fb4,{{0x9801,0x0,0x0}}},
+{0x2fb5,{{0x98a8,0x0,0x0}}},
+{0x2fb6,{{0x98db,0x0,0x0}}},
+{0x2fb7,{{0x98df,0x0,0x0}}},
+{0x2fb8,{{0x9996,0x0,0x0}}},
+{0x2fb9,{{0x9999,0x0,0x0}}},
+{0x2fba,{{0x99ac,0x0,0x0}}},
+{0x2fbb,{{0x9aa8,0x0,0x0}}},
+{0x2fbc,{{0x9ad8,0x0,0x0}}},
+{0x2fbd,{{0x9adf,0x0,0x0}}},
+{0x2fbe,{{0x9b25,0x0,0x0}}},
+{0x2fbf,{{0x9b2f,0x0,0x0}}},
+{0x2fc0,{{0x9b32,0x0,0x0}}},
+{0x2fc1,{{0x9b3c,0x0,0x0}}},
+{0x2fc2,{{0x9b5a,0x0,0x0}}},
+{0x2fc3,{{0x9ce5,0x0,0x0}}},
+{0x2fc4,{{0x9e75,0x0,0x0}}},
+{0x2fc5,{{0x9e7f,0x0,0x0}}},
+{0x2fc6,{{0x9ea5,0x0,0x0}}},
+{0x2fc7,{{0x9ebb,0x0,0x0}}},
+{0x2fc8,{{0x9ec3,0x0,0x0}}},
+{0x2fc9,{{0x9ecd,0x0,0x0}}},
+{0x2fca,{{0x9ed1,0x0,0x0}}},
+{0x2fcb,{{0x9ef9,0x0,0x0}}},
+{0x2fcc,{{0x9efd,0x0,0x0}}},
+{0x2fcd,{{0x9f0e,0x0,0x0}}},
+{0x2fce,{{0x9f13,0x0,0x0}}},
+{0x2fcf,{{0x9f20,0x0,0x0}}},
+{0x2fd0,{{0x9f3b,0x0,0x0}}},
+{0x2fd1,{{0x9f4a,0x0,0x0}}},
+{0x2fd2,{{0x9f52,0x0,0x0}}},
+{0x2fd3,{{0x9f8d,0x0,0x0}}},
+{0x2fd4,{{0x9f9c,0x0,0x0}}},
+{0x2fd5,{{0x9fa0,0x0,0x0}}},
+{0x3000,{{0x20,0x0,0x0}}},
+{0x3036,{{0x3012,0x0,0x0}}},
+{0x3038,{{0x5341,0x0,0x0}}},
+{0x3039,{{0x5344,0x0,0x0}}},
+{0x303a,{{0x5345,0x0,0x0}}},
+{0x309b,{{0x20,0x3099,0x0}}},
+{0x309c,{{0x20,0x309a,0x0}}},
+{0x309f,{{0x3088,0x308a,0x0}}},
+{0x30ff,{{0x30b3,0x30c8,0x0}}},
+{0x3131,{{0x1100,0x0,0x0}}},
+{0x3132,{{0x1101,0x0,0x0}}},
+{0x3133,{{0x11aa,0x0,0x0}}},
+{0x3134,{{0x1102,0x0,0x0}}},
+{0x3135,{{0x11ac,0x0,0x0}}},
+{0x3136,{{0x11ad,0x0,0x0}}},
+{0x3137,{{0x1103,0x0,0x0}}},
+{0x3138,{{0x1104,0x0,0x0}}},
+{0x3139,{{0x1105,0x0,0x0}}},
+{0x313a,{{0x11b0,0x0,0x0}}},
+{0x313b,{{0x11b1,0x0,0x0}}},
+{0x313c,{{0x11b2,0x0,0x0}}},
+{0x313d,{{0x11b3,0x0,0x0}}},
+{0x313e,{{0x11b4,0x0,0x0}}},
+{0x313f,{{0x11b5,0x0,0x0}}},
+{0x3140,{{0x111a,0x0,0x0}}},
+{0x3141,{{0x1106,0x0,0x0}}},
+{0x3142,{{0x1107,0x0,0x0}}},
+{0x3143,{{0x1108,0x0,0x0}}},
+{0x3144,{{0x1121,0x0,0x0}}},
+{0x3145,{{0x1109,0x0,0x0}}},
+{0x3146,{{0x110a,0x0,0x0}}},
+{0x3147,{{0x110b,0x0,0x0}}},
+{0x3148,{{0x110c,0x0,0x0}}},
+{0x3149,{{0x110d,0x0,0x0}}},
+{0x314a,{{0x110e,0x0,0x0}}},
+{0x314b,{{0x110f,0x0,0x0}}},
+{0x314c,{{0x1110,0x0,0x0}}},
+{0x314d,{{0x1111,0x0,0x0}}},
+{0x314e,{{0x1112,0x0,0x0}}},
+{0x314f,{{0x1161,0x0,0x0}}},
+{0x3150,{{0x1162,0x0,0x0}}},
+{0x3151,{{0x1163,0x0,0x0}}},
+{0x3152,{{0x1164,0x0,0x0}}},
+{0x3153,{{0x1165,0x0,0x0}}},
+{0x3154,{{0x1166,0x0,0x0}}},
+{0x3155,{{0x1167,0x0,0x0}}},
+{0x3156,{{0x1168,0x0,0x0}}},
+{0x3157,{{0x1169,0x0,0x0}}},
+{0x3158,{{0x116a,0x0,0x0}}},
+{0x3159,{{0x116b,0x0,0x0}}},
+{0x315a,{{0x116c,0x0,0x0}}},
+{0x315b,{{0x116d,0x0,0x0}}},
+{0x315c,{{0x116e,0x0,0x0}}},
+{0x315d,{{0x116f,0x0,0x0}}},
+{0x315e,{{0x1170,0x0,0x0}}},
+{0x315f,{{0x1171,0x0,0x0}}},
+{0x3160,{{0x1172,0x0,0x0}}},
+{0x3161,{{0x1173,0x0,0x0}}},
+{0x3162,{{0x1174,0x0,0x0}}},
+{0x3163,{{0x1175,0x0,0x0}}},
+{0x3164,{{0x0,0x0,0x0}}},
+{0x3165,{{0x1114,0x0,0x0}}},
+{0x3166,{{0x1115,0x0,0x0}}},
+{0x3167,{{0x11c7,0x0,0x0}}},
+{0x3168,{{0x11c8,0x0,0x0}}},
+{0x3169,{{0x11cc,0x0,0x0}}},
+{0x316a,{{0x11ce,0x0,0x0}}},
+{0x316b,{{0x11d3,0x0,0x0}}},
+{0x316c,{{0x11d7,0x0,0x0}}},
+{0x316d,{{0x11d9,0x0,0x0}}},
+{0x316e,{{0x111c,0x0,0x0}}},
+{0x316f,{{0x11dd,0x0,0x0}}},
+{0x3170,{{0x11df,0x0,0x0}}},
+{0x3171,{{0x111d,0x0,0x0}}},
+{0x3172,{{0x111e,0x0,0x0}}},
+{0x3173,{{0x1120,0x0,0x0}}},
+{0x3174,{{0x1122,0x0,0x0}}},
+{0x3175,{{0x1123,0x0,0x0}}},
+{0x3176,{{0x1127,0x0,0x0}}},
+{0x3177,{{0x1129,0x0,0x0}}},
+{0x3178,{{0x112b,0x0,0x0}}},
+{0x3179,{{0x112c,0x0,0x0}}},
+{0x317a,{{0x112d,0x0,0x0}}},
+{0x317b,{{0x112e,0x0,0x0}}},
+{0x317c,{{0x112f,0x0,0x0}}},
+{0x317d,{{0x1132,0x0,0x0}}},
+{0x317e,{{0x1136,0x0,0x0}}},
+{0x317f,{{0x1140,0x0,0x0}}},
+{0x3180,{{0x1147,0x0,0x0}}},
+{0x3181,{{0x114c,0x0,0x0}}},
+{0x3182,{{0x11f1,0x0,0x0}}},
+{0x3183,{{0x11f2,0x0,0x0}}},
+{0x3184,{{0x1157,0x0,0x0}}},
+{0x3185,{{0x1158,0x0,0x0}}},
+{0x3186,{{0x1159,0x0,0x0}}},
+{0x3187,{{0x1184,0x0,0x0}}},
+{0x3188,{{0x1185,0x0,0x0}}},
+{0x3189,{{0x1188,0x0,0x0}}},
+{0x318a,{{0x1191,0x0,0x0}}},
+{0x318b,{{0x1192,0x0,0x0}}},
+{0x318c,{{0x1194,0x0,0x0}}},
+{0x318d,{{0x119e,0x0,0x0}}},
+{0x318e,{{0x11a1,0x0,0x0}}},
+{0x3192,{{0x4e00,0x0,0x0}}},
+{0x3193,{{0x4e8c,0x0,0x0}}},
+{0x3194,{{0x4e09,0x0,0x0}}},
+{0x3195,{{0x56db,0x0,0x0}}},
+{0x3196,{{0x4e0a,0x0,0x0}}},
+{0x3197,{{0x4e2d,0x0,0x0}}},
+{0x3198,{{0x4e0b,0x0,0x0}}},
+{0x3199,{{0x7532,0x0,0x0}}},
+{0x319a,{{0x4e59,0x0,0x0}}},
+{0x319b,{{0x4e19,0x0,0x0}}},
+{0x319c,{{0x4e01,0x0,0x0}}},
+{0x319d,{{0x5929,0x0,0x0}}},
+{0x319e,{{0x5730,0x0,0x0}}},
+{0x319f,{{0x4eba,0x0,0x0}}},
+{0x3200,{{0x28,0x1100,0x29}}},
+{0x3201,{{0x28,0x1102,0x29}}},
+{0x3202,{{0x28,0x1103,0x29}}},
+{0x3203,{{0x28,0x1105,0x29}}},
+{0x3204,{{0x28,0x1106,0x29}}},
+{0x3205,{{0x28,0x1107,0x29}}},
+{0x3206,{{0x28,0x1109,0x29}}},
+{0x3207,{{0x28,0x110b,0x29}}},
+{0x3208,{{0x28,0x110c,0x29}}},
+{0x3209,{{0x28,0x110e,0x29}}},
+{0x320a,{{0x28,0x110f,0x29}}},
+{0x320b,{{0x28,0x1110,0x29}}},
+{0x320c,{{0x28,0x1111,0x29}}},
+{0x320d,{{0x28,0x1112,0x29}}},
+{0x320e,{{0x28,0xac00,0x29}}},
+{0x320f,{{0x28,0xb098,0x29}}},
+{0x3210,{{0x28,0xb2e4,0x29}}},
+{0x3211,{{0x28,0xb77c,0x29}}},
+{0x3212,{{0x28,0xb9c8,0x29}}},
+{0x3213,{{0x28,0xbc14,0x29}}},
+{0x3214,{{0x28,0xc0ac,0x29}}},
+{0x3215,{{0x28,0xc544,0x29}}},
+{0x3216,{{0x28,0xc790,0x29}}},
+{0x3217,{{0x28,0xcc28,0x29}}},
+{0x3218,{{0x28,0xce74,0x29}}},
+{0x3219,{{0x28,0xd0c0,0x29}}},
+{0x321a,{{0x28,0xd30c,0x29}}},
+{0x321b,{{0x28,0xd558,0x29}}},
+{0x321c,{{0x28,0xc8fc,0x29}}},
+{0x3220,{{0x28,0x4e00,0x29}}},
+{0x3221,{{0x28,0x4e8c,0x29}}},
+{0x3222,{{0x28,0x4e09,0x29}}},
+{0x3223,{{0x28,0x56db,0x29}}},
+{0x3224,{{0x28,0x4e94,0x29}}},
+{0x3225,{{0x28,0x516d,0x29}}},
+{0x3226,{{0x28,0x4e03,0x29}}},
+{0x3227,{{0x28,0x516b,0x29}}},
+{0x3228,{{0x28,0x4e5d,0x29}}},
+{0x3229,{{0x28,0x5341,0x29}}},
+{0x322a,{{0x28,0x6708,0x29}}},
+{0x322b,{{0x28,0x706b,0x29}}},
+{0x322c,{{0x28,0x6c34,0x29}}},
+{0x322d,{{0x28,0x6728,0x29}}},
+{0x322e,{{0x28,0x91d1,0x29}}},
+{0x322f,{{0x28,0x571f,0x29}}},
+{0x3230,{{0x28,0x65e5,0x29}}},
+{0x3231,{{0x28,0x682a,0x29}}},
+{0x3232,{{0x28,0x6709,0x29}}},
+{0x3233,{{0x28,0x793e,0x29}}},
+{0x3234,{{0x28,0x540d,0x29}}},
+{0x3235,{{0x28,0x7279,0x29}}},
+{0x3236,{{0x28,0x8ca1,0x29}}},
+{0x3237,{{0x28,0x795d,0x29}}},
+{0x3238,{{0x28,0x52b4,0x29}}},
+{0x3239,{{0x28,0x4ee3,0x29}}},
+{0x323a,{{0x28,0x547c,0x29}}},
+{0x323b,{{0x28,0x5b66,0x29}}},
+{0x323c,{{0x28,0x76e3,0x29}}},
+{0x323d,{{0x28,0x4f01,0x29}}},
+{0x323e,{{0x28,0x8cc7,0x29}}},
+{0x323f,{{0x28,0x5354,0x29}}},
+{0x3240,{{0x28,0x796d,0x29}}},
+{0x3241,{{0x28,0x4f11,0x29}}},
+{0x3242,{{0x28,0x81ea,0x29}}},
+{0x3243,{{0x28,0x81f3,0x29}}},
+{0x3244,{{0x554f,0x0,0x0}}},
+{0x3245,{{0x5e7c,0x0,0x0}}},
+{0x3246,{{0x6587,0x0,0x0}}},
+{0x3247,{{0x7b8f,0x0,0x0}}},
+{0x3250,{{0x70,0x74,0x65}}},
+{0x3251,{{0x32,0x31,0x0}}},
+{0x3252,{{0x32,0x32,0x0}}},
+{0x3253,{{0x32,0x33,0x0}}},
+{0x3254,{{0x32,0x34,0x0}}},
+{0x3255,{{0x32,0x35,0x0}}},
+{0x3256,{{0x32,0x36,0x0}}},
+{0x3257,{{0x32,0x37,0x0}}},
+{0x3258,{{0x32,0x38,0x0}}},
+{0x3259,{{0x32,0x39,0x0}}},
+{0x325a,{{0x33,0x30,0x0}}},
+{0x325b,{{0x33,0x31,0x0}}},
+{0x325c,{{0x33,0x32,0x0}}},
+{0x325d,{{0x33,0x33,0x0}}},
+{0x325e,{{0x33,0x34,0x0}}},
+{0x325f,{{0x33,0x35,0x0}}},
+{0x3260,{{0x1100,0x0,0x0}}},
+{0x3261,{{0x1102,0x0,0x0}}},
+{0x3262,{{0x1103,0x0,0x0}}},
+{0x3263,{{0x1105,0x0,0x0}}},
+{0x3264,{{0x1106,0x0,0x0}}},
+{0x3265,{{0x1107,0x0,0x0}}},
+{0x3266,{{0x1109,0x0,0x0}}},
+{0x3267,{{0x110b,0x0,0x0}}},
+{0x3268,{{0x110c,0x0,0x0}}},
+{0x3269,{{0x110e,0x0,0x0}}},
+{0x326a,{{0x110f,0x0,0x0}}},
+{0x326b,{{0x1110,0x0,0x0}}},
+{0x326c,{{0x1111,0x0,0x0}}},
+{0x326d,{{0x1112,0x0,0x0}}},
+{0x326e,{{0xac00,0x0,0x0}}},
+{0x326f,{{0xb098,0x0,0x0}}},
+{0x3270,{{0xb2e4,0x0,0x0}}},
+{0x3271,{{0xb77c,0x0,0x0}}},
+{0x3272,{{0xb9c8,0x0,0x0}}},
+{0x3273,{{0xbc14,0x0,0x0}}},
+{0x3274,{{0xc0ac,0x0,0x0}}},
+{0x3275,{{0xc544,0x0,0x0}}},
+{0x3276,{{0xc790,0x0,0x0}}},
+{0x3277,{{0xcc28,0x0,0x0}}},
+{0x3278,{{0xce74,0x0,0x0}}},
+{0x3279,{{0xd0c0,0x0,0x0}}},
+{0x327a,{{0xd30c,0x0,0x0}}},
+{0x327b,{{0xd558,0x0,0x0}}},
+{0x327c,{{0xcc38,0xace0,0x0}}},
+{0x327d,{{0xc8fc,0xc758,0x0}}},
+{0x327e,{{0xc6b0,0x0,0x0}}},
+{0x3280,{{0x4e00,0x0,0x0}}},
+{0x3281,{{0x4e8c,0x0,0x0}}},
+{0x3282,{{0x4e09,0x0,0x0}}},
+{0x3283,{{0x56db,0x0,0x0}}},
+{0x3284,{{0x4e94,0x0,0x0}}},
+{0x3285,{{0x516d,0x0,0x0}}},
+{0x3286,{{0x4e03,0x0,0x0}}},
+{0x3287,{{0x516b,0x0,0x0}}},
+{0x3288,{{0x4e5d,0x0,0x0}}},
+{0x3289,{{0x5341,0x0,0x0}}},
+{0x328a,{{0x6708,0x0,0x0}}},
+{0x328b,{{0x706b,0x0,0x0}}},
+{0x328c,{{0x6c34,0x0,0x0}}},
+{0x328d,{{0x6728,0x0,0x0}}},
+{0x328e,{{0x91d1,0x0,0x0}}},
+{0x328f,{{0x571f,0x0,0x0}}},
+{0x3290,{{0x65e5,0x0,0x0}}},
+{0x3291,{{0x682a,0x0,0x0}}},
+{0x3292,{{0x6709,0x0,0x0}}},
+{0x3293,{{0x793e,0x0,0x0}}},
+{0x3294,{{0x540d,0x0,0x0}}},
+{0x3295,{{0x7279,0x0,0x0}}},
+{0x3296,{{0x8ca1,0x0,0x0}}},
+{0x3297,{{0x795d,0x0,0x0}}},
+{0x3298,{{0x52b4,0x0,0x0}}},
+{0x3299,{{0x79d8,0x0,0x0}}},
+{0x329a,{{0x7537,0x0,0x0}}},
+{0x329b,{{0x5973,0x0,0x0}}},
+{0x329c,{{0x9069,0x0,0x0}}},
+{0x329d,{{0x512a,0x0,0x0}}},
+{0x329e,{{0x5370,0x0,0x0}}},
+{0x329f,{{0x6ce8,0x0,0x0}}},
+{0x32a0,{{0x9805,0x0,0x0}}},
+{0x32a1,{{0x4f11,0x0,0x0}}},
+{0x32a2,{{0x5199,0x0,0x0}}},
+{0x32a3,{{0x6b63,0x0,0x0}}},
+{0x32a4,{{0x4e0a,0x0,0x0}}},
+{0x32a5,{{0x4e2d,0x0,0x0}}},
+{0x32a6,{{0x4e0b,0x0,0x0}}},
+{0x32a7,{{0x5de6,0x0,0x0}}},
+{0x32a8,{{0x53f3,0x0,0x0}}},
+{0x32a9,{{0x533b,0x0,0x0}}},
+{0x32aa,{{0x5b97,0x0,0x0}}},
+{0x32ab,{{0x5b66,0x0,0x0}}},
+{0x32ac,{{0x76e3,0x0,0x0}}},
+{0x32ad,{{0x4f01,0x0,0x0}}},
+{0x32ae,{{0x8cc7,0x0,0x0}}},
+{0x32af,{{0x5354,0x0,0x0}}},
+{0x32b0,{{0x591c,0x0,0x0}}},
+{0x32b1,{{0x33,0x36,0x0}}},
+{0x32b2,{{0x33,0x37,0x0}}},
+{0x32b3,{{0x33,0x38,0x0}}},
+{0x32b4,{{0x33,0x39,0x0}}},
+{0x32b5,{{0x34,0x30,0x0}}},
+{0x32b6,{{0x34,0x31,0x0}}},
+{0x32b7,{{0x34,0x32,0x0}}},
+{0x32b8,{{0x34,0x33,0x0}}},
+{0x32b9,{{0x34,0x34,0x0}}},
+{0x32ba,{{0x34,0x35,0x0}}},
+{0x32bb,{{0x34,0x36,0x0}}},
+{0x32bc,{{0x34,0x37,0x0}}},
+{0x32bd,{{0x34,0x38,0x0}}},
+{0x32be,{{0x34,0x39,0x0}}},
+{0x32bf,{{0x35,0x30,0x0}}},
+{0x32c0,{{0x31,0x6708,0x0}}},
+{0x32c1,{{0x32,0x6708,0x0}}},
+{0x32c2,{{0x33,0x6708,0x0}}},
+{0x32c3,{{0x34,0x6708,0x0}}},
+{0x32c4,{{0x35,0x6708,0x0}}},
+{0x32c5,{{0x36,0x6708,0x0}}},
+{0x32c6,{{0x37,0x6708,0x0}}},
+{0x32c7,{{0x38,0x6708,0x0}}},
+{0x32c8,{{0x39,0x6708,0x0}}},
+{0x32c9,{{0x31,0x30,0x6708}}},
+{0x32ca,{{0x31,0x31,0x6708}}},
+{0x32cb,{{0x31,0x32,0x6708}}},
+{0x32cc,{{0x68,0x67,0x0}}},
+{0x32cd,{{0x65,0x72,0x67}}},
+{0x32ce,{{0x65,0x76,0x0}}},
+{0x32cf,{{0x6c,0x74,0x64}}},
+{0x32d0,{{0x30a2,0x0,0x0}}},
+{0x32d1,{{0x30a4,0x0,0x0}}},
+{0x32d2,{{0x30a6,0x0,0x0}}},
+{0x32d3,{{0x30a8,0x0,0x0}}},
+{0x32d4,{{0x30aa,0x0,0x0}}},
+{0x32d5,{{0x30ab,0x0,0x0}}},
+{0x32d6,{{0x30ad,0x0,0x0}}},
+{0x32d7,{{0x30af,0x0,0x0}}},
+{0x32d8,{{0x30b1,0x0,0x0}}},
+{0x32d9,{{0x30b3,0x0,0x0}}},
+{0x32da,{{0x30b5,0x0,0x0}}},
+{0x32db,{{0x30b7,0x0,0x0}}},
+{0x32dc,{{0x30b9,0x0,0x0}}},
+{0x32dd,{{0x30bb,0x0,0x0}}},
+{0x32de,{{0x30bd,0x0,0x0}}},
+{0x32df,{{0x30bf,0x0,0x0}}},
+{0x32e0,{{0x30c1,0x0,0x0}}},
+{0x32e1,{{0x30c4,0x0,0x0}}},
+{0x32e2,{{0x30c6,0x0,0x0}}},
+{0x32e3,{{0x30c8,0x0,0x0}}},
+{0x32e4,{{0x30ca,0x0,0x0}}},
+{0x32e5,{{0x30cb,0x0,0x0}}},
+{0x32e6,{{0x30cc,0x0,0x0}}},
+{0x32e7,{{0x30cd,0x0,0x0}}},
+{0x32e8,{{0x30ce,0x0,0x0}}},
+{0x32e9,{{0x30cf,0x0,0x0}}},
+{0x32ea,{{0x30d2,0x0,0x0}}},
+{0x32eb,{{0x30d5,0x0,0x0}}},
+{0x32ec,{{0x30d8,0x0,0x0}}},
+{0x32ed,{{0x30db,0x0,0x0}}},
+{0x32ee,{{0x30de,0x0,0x0}}},
+{0x32ef,{{0x30df,0x0,0x0}}},
+{0x32f0,{{0x30e0,0x0,0x0}}},
+{0x32f1,{{0x30e1,0x0,0x0}}},
+{0x32f2,{{0x30e2,0x0,0x0}}},
+{0x32f3,{{0x30e4,0x0,0x0}}},
+{0x32f4,{{0x30e6,0x0,0x0}}},
+{0x32f5,{{0x30e8,0x0,0x0}}},
+{0x32f6,{{0x30e9,0x0,0x0}}},
+{0x32f7,{{0x30ea,0x0,0x0}}},
+{0x32f8,{{0x30eb,0x0,0x0}}},
+{0x32f9,{{0x30ec,0x0,0x0}}},
+{0x32fa,{{0x30ed,0x0,0x0}}},
+{0x32fb,{{0x30ef,0x0,0x0}}},
+{0x32fc,{{0x30f0,0x0,0x0}}},
+{0x32fd,{{0x30f1,0x0,0x0}}},
+{0x32fe,{{0x30f2,0x0,0x0}}},
+{0x32ff,{{0x4ee4,0x548c,0x0}}},
+{0x3303,{{0x30a2,0x30fc,0x30eb}}},
+{0x3305,{{0x30a4,0x30f3,0x30c1}}},
+{0x3306,{{0x30a6,0x30a9,0x30f3}}},
+{0x3309,{{0x30aa,0x30f3,0x30b9}}},
+{0x330a,{{0x30aa,0x30fc,0x30e0}}},
+{0x330b,{{0x30ab,0x30a4,0x30ea}}},
+{0x330e,{{0x30ac,0x30ed,0x30f3}}},
+{0x330f,{{0x30ac,0x30f3,0x30de}}},
+{0x3310,{{0x30ae,0x30ac,0x0}}},
+{0x3311,{{0x30ae,0x30cb,0x30fc}}},
+{0x3314,{{0x30ad,0x30ed,0x0}}},
+{0x3318,{{0x30b0,0x30e9,0x30e0}}},
+{0x331c,{{0x30b1,0x30fc,0x30b9}}},
+{0x331d,{{0x30b3,0x30eb,0x30ca}}},
+{0x331e,{{0x30b3,0x30fc,0x30dd}}},
+{0x3322,{{0x30bb,0x30f3,0x30c1}}},
+{0x3323,{{0x30bb,0x30f3,0x30c8}}},
+{0x3324,{{0x30c0,0x30fc,0x30b9}}},
+{0x3325,{{0x30c7,0x30b7,0x0}}},
+{0x3326,{{0x30c9,0x30eb,0x0}}},
+{0x3327,{{0x30c8,0x30f3,0x0}}},
+{0x3328,{{0x30ca,0x30ce,0x0}}},
+{0x3329,{{0x30ce,0x30c3,0x30c8}}},
+{0x332a,{{0x30cf,0x30a4,0x30c4}}},
+{0x332c,{{0x30d1,0x30fc,0x30c4}}},
+{0x332f,{{0x30d4,0x30af,0x30eb}}},
+{0x3330,{{0x30d4,0x30b3,0x0}}},
+{0x3331,{{0x30d3,0x30eb,0x0}}},
+{0x3335,{{0x30d5,0x30e9,0x30f3}}},
+{0x3337,{{0x30da,0x30bd,0x0}}},
+{0x3338,{{0x30da,0x30cb,0x30d2}}},
+{0x3339,{{0x30d8,0x30eb,0x30c4}}},
+{0x333a,{{0x30da,0x30f3,0x30b9}}},
+{0x333b,{{0x30da,0x30fc,0x30b8}}},
+{0x333c,{{0x30d9,0x30fc,0x30bf}}},
+{0x333e,{{0x30dc,0x30eb,0x30c8}}},
+{0x333f,{{0x30db,0x30f3,0x0}}},
+{0x3340,{{0x30dd,0x30f3,0x30c9}}},
+{0x3341,{{0x30db,0x30fc,0x30eb}}},
+{0x3342,{{0x30db,0x30fc,0x30f3}}},
+{0x3344,{{0x30de,0x30a4,0x30eb}}},
+{0x3345,{{0x30de,0x30c3,0x30cf}}},
+{0x3346,{{0x30de,0x30eb,0x30af}}},
+{0x3349,{{0x30df,0x30ea,0x0}}},
+{0x334b,{{0x30e1,0x30ac,0x0}}},
+{0x334e,{{0x30e4,0x30fc,0x30c9}}},
+{0x334f,{{0x30e4,0x30fc,0x30eb}}},
+{0x3350,{{0x30e6,0x30a2,0x30f3}}},
+{0x3352,{{0x30ea,0x30e9,0x0}}},
+{0x3353,{{0x30eb,0x30d4,0x30fc}}},
+{0x3355,{{0x30ec,0x30e0,0x0}}},
+{0x3357,{{0x30ef,0x30c3,0x30c8}}},
+{0x3358,{{0x30,0x70b9,0x0}}},
+{0x3359,{{0x31,0x70b9,0x0}}},
+{0x335a,{{0x32,0x70b9,0x0}}},
+{0x335b,{{0x33,0x70b9,0x0}}},
+{0x335c,{{0x34,0x70b9,0x0}}},
+{0x335d,{{0x35,0x70b9,0x0}}},
+{0x335e,{{0x36,0x70b9,0x0}}},
+{0x335f,{{0x37,0x70b9,0x0}}},
+{0x3360,{{0x38,0x70b9,0x0}}},
+{0x3361,{{0x39,0x70b9,0x0}}},
+{0x3362,{{0x31,0x30,0x70b9}}},
+{0x3363,{{0x31,0x31,0x70b9}}},
+{0x3364,{{0x31,0x32,0x70b9}}},
+{0x3365,{{0x31,0x33,0x70b9}}},
+{0x3366,{{0x31,0x34,0x70b9}}},
+{0x3367,{{0x31,0x35,0x70b9}}},
+{0x3368,{{0x31,0x36,0x70b9}}},
+{0x3369,{{0x31,0x37,0x70b9}}},
+{0x336a,{{0x31,0x38,0x70b9}}},
+{0x336b,{{0x31,0x39,0x70b9}}},
+{0x336c,{{0x32,0x30,0x70b9}}},
+{0x336d,{{0x32,0x31,0x70b9}}},
+{0x336e,{{0x32,0x32,0x70b9}}},
+{0x336f,{{0x32,0x33,0x70b9}}},
+{0x3370,{{0x32,0x34,0x70b9}}},
+{0x3371,{{0x68,0x70,0x61}}},
+{0x3372,{{0x64,0x61,0x0}}},
+{0x3373,{{0x61,0x75,0x0}}},
+{0x3374,{{0x62,0x61,0x72}}},
+{0x3375,{{0x6f,0x76,0x0}}},
+{0x3376,{{0x70,0x63,0x0}}},
+{0x3377,{{0x64,0x6d,0x0}}},
+{0x3378,{{0x64,0x6d,0x32}}},
+{0x3379,{{0x64,0x6d,0x33}}},
+{0x337a,{{0x69,0x75,0x0}}},
+{0x337b,{{0x5e73,0x6210,0x0}}},
+{0x337c,{{0x662d,0x548c,0x0}}},
+{0x337d,{{0x5927,0x6b63,0x0}}},
+{0x337e,{{0x660e,0x6cbb,0x0}}},
+{0x3380,{{0x70,0x61,0x0}}},
+{0x3381,{{0x6e,0x61,0x0}}},
+{0x3382,{{0x3bc,0x61,0x0}}},
+{0x3383,{{0x6d,0x61,0x0}}},
+{0x3384,{{0x6b,0x61,0x0}}},
+{0x3385,{{0x6b,0x62,0x0}}},
+{0x3386,{{0x6d,0x62,0x0}}},
+{0x3387,{{0x67,0x62,0x0}}},
+{0x3388,{{0x63,0x61,0x6c}}},
+{0x338a,{{0x70,0x66,0x0}}},
+{0x338b,{{0x6e,0x66,0x0}}},
+{0x338c,{{0x3bc,0x66,0x0}}},
+{0x338d,{{0x3bc,0x67,0x0}}},
+{0x338e,{{0x6d,0x67,0x0}}},
+{0x338f,{{0x6b,0x67,0x0}}},
+{0x3390,{{0x68,0x7a,0x0}}},
+{0x3391,{{0x6b,0x68,0x7a}}},
+{0x3392,{{0x6d,0x68,0x7a}}},
+{0x3393,{{0x67,0x68,0x7a}}},
+{0x3394,{{0x74,0x68,0x7a}}},
+{0x3395,{{0x3bc,0x6c,0x0}}},
+{0x3396,{{0x6d,0x6c,0x0}}},
+{0x3397,{{0x64,0x6c,0x0}}},
+{0x3398,{{0x6b,0x6c,0x0}}},
+{0x3399,{{0x66,0x6d,0x0}}},
+{0x339a,{{0x6e,0x6d,0x0}}},
+{0x339b,{{0x3bc,0x6d,0x0}}},
+{0x339c,{{0x6d,0x6d,0x0}}},
+{0x339d,{{0x63,0x6d,0x0}}},
+{0x339e,{{0x6b,0x6d,0x0}}},
+{0x339f,{{0x6d,0x6d,0x32}}},
+{0x33a0,{{0x63,0x6d,0x32}}},
+{0x33a1,{{0x6d,0x32,0x0}}},
+{0x33a2,{{0x6b,0x6d,0x32}}},
+{0x33a3,{{0x6d,0x6d,0x33}}},
+{0x33a4,{{0x63,0x6d,0x33}}},
+{0x33a5,{{0x6d,0x33,0x0}}},
+{0x33a6,{{0x6b,0x6d,0x33}}},
+{0x33a7,{{0x6d,0x2215,0x73}}},
+{0x33a9,{{0x70,0x61,0x0}}},
+{0x33aa,{{0x6b,0x70,0x61}}},
+{0x33ab,{{0x6d,0x70,0x61}}},
+{0x33ac,{{0x67,0x70,0x61}}},
+{0x33ad,{{0x72,0x61,0x64}}},
+{0x33b0,{{0x70,0x73,0x0}}},
+{0x33b1,{{0x6e,0x73,0x0}}},
+{0x33b2,{{0x3bc,0x73,0x0}}},
+{0x33b3,{{0x6d,0x73,0x0}}},
+{0x33b4,{{0x70,0x76,0x0}}},
+{0x33b5,{{0x6e,0x76,0x0}}},
+{0x33b6,{{0x3bc,0x76,0x0}}},
+{0x33b7,{{0x6d,0x76,0x0}}},
+{0x33b8,{{0x6b,0x76,0x0}}},
+{0x33b9,{{0x6d,0x76,0x0}}},
+{0x33ba,{{0x70,0x77,0x0}}},
+{0x33bb,{{0x6e,0x77,0x0}}},
+{0x33bc,{{0x3bc,0x77,0x0}}},
+{0x33bd,{{0x6d,0x77,0x0}}},
+{0x33be,{{0x6b,0x77,0x0}}},
+{0x33bf,{{0x6d,0x77,0x0}}},
+{0x33c0,{{0x6b,0x3c9,0x0}}},
+{0x33c1,{{0x6d,0x3c9,0x0}}},
+{0x33c3,{{0x62,0x71,0x0}}},
+{0x33c4,{{0x63,0x63,0x0}}},
+{0x33c5,{{0x63,0x64,0x0}}},
+{0x33c7,{{0x63,0x6f,0x2e}}},
+{0x33c8,{{0x64,0x62,0x0}}},
+{0x33c9,{{0x67,0x79,0x0}}},
+{0x33ca,{{0x68,0x61,0x0}}},
+{0x33cb,{{0x68,0x70,0x0}}},
+{0x33cc,{{0x69,0x6e,0x0}}},
+{0x33cd,{{0x6b,0x6b,0x0}}},
+{0x33ce,{{0x6b,0x6d,0x0}}},
+{0x33cf,{{0x6b,0x74,0x0}}},
+{0x33d0,{{0x6c,0x6d,0x0}}},
+{0x33d1,{{0x6c,0x6e,0x0}}},
+{0x33d2,{{0x6c,0x6f,0x67}}},
+{0x33d3,{{0x6c,0x78,0x0}}},
+{0x33d4,{{0x6d,0x62,0x0}}},
+{0x33d5,{{0x6d,0x69,0x6c}}},
+{0x33d6,{{0x6d,0x6f,0x6c}}},
+{0x33d7,{{0x70,0x68,0x0}}},
+{0x33d9,{{0x70,0x70,0x6d}}},
+{0x33da,{{0x70,0x72,0x0}}},
+{0x33db,{{0x73,0x72,0x0}}},
+{0x33dc,{{0x73,0x76,0x0}}},
+{0x33dd,{{0x77,0x62,0x0}}},
+{0x33de,{{0x76,0x2215,0x6d}}},
+{0x33df,{{0x61,0x2215,0x6d}}},
+{0x33e0,{{0x31,0x65e5,0x0}}},
+{0x33e1,{{0x32,0x65e5,0x0}}},
+{0x33e2,{{0x33,0x65e5,0x0}}},
+{0x33e3,{{0x34,0x65e5,0x0}}},
+{0x33e4,{{0x35,0x65e5,0x0}}},
+{0x33e5,{{0x36,0x65e5,0x0}}},
+{0x33e6,{{0x37,0x65e5,0x0}}},
+{0x33e7,{{0x38,0x65e5,0x0}}},
+{0x33e8,{{0x39,0x65e5,0x0}}},
+{0x33e9,{{0x31,0x30,0x65e5}}},
+{0x33ea,{{0x31,0x31,0x65e5}}},
+{0x33eb,{{0x31,0x32,0x65e5}}},
+{0x33ec,{{0x31,0x33,0x65e5}}},
+{0x33ed,{{0x31,0x34,0x65e5}}},
+{0x33ee,{{0x31,0x35,0x65e5}}},
+{0x33ef,{{0x31,0x36,0x65e5}}},
+{0x33f0,{{0x31,0x37,0x65e5}}},
+{0x33f1,{{0x31,0x38,0x65e5}}},
+{0x33f2,{{0x31,0x39,0x65e5}}},
+{0x33f3,{{0x32,0x30,0x65e5}}},
+{0x33f4,{{0x32,0x31,0x65e5}}},
+{0x33f5,{{0x32,0x32,0x65e5}}},
+{0x33f6,{{0x32,0x33,0x65e5}}},
+{0x33f7,{{0x32,0x34,0x65e5}}},
+{0x33f8,{{0x32,0x35,0x65e5}}},
+{0x33f9,{{0x32,0x36,0x65e5}}},
+{0x33fa,{{0x32,0x37,0x65e5}}},
+{0x33fb,{{0x32,0x38,0x65e5}}},
+{0x33fc,{{0x32,0x39,0x65e5}}},
+{0x33fd,{{0x33,0x30,0x65e5}}},
+{0x33fe,{{0x33,0x31,0x65e5}}},
+{0x33ff,{{0x67,0x61,0x6c}}},
+{0xa640,{{0xa641,0x0,0x0}}},
+{0xa642,{{0xa643,0x0,0x0}}},
+{0xa644,{{0xa645,0x0,0x0}}},
+{0xa646,{{0xa647,0x0,0x0}}},
+{0xa648,{{0xa649,0x0,0x0}}},
+{0xa64a,{{0xa64b,0x0,0x0}}},
+{0xa64c,{{0xa64d,0x0,0x0}}},
+{0xa64e,{{0xa64f,0x0,0x0}}},
+{0xa650,{{0xa651,0x0,0x0}}},
+{0xa652,{{0xa653,0x0,0x0}}},
+{0xa654,{{0xa655,0x0,0x0}}},
+{0xa656,{{0xa657,0x0,0x0}}},
+{0xa658,{{0xa659,0x0,0x0}}},
+{0xa65a,{{0xa65b,0x0,0x0}}},
+{0xa65c,{{0xa65d,0x0,0x0}}},
+{0xa65e,{{0xa65f,0x0,0x0}}},
+{0xa660,{{0xa661,0x0,0x0}}},
+{0xa662,{{0xa663,0x0,0x0}}},
+{0xa664,{{0xa665,0x0,0x0}}},
+{0xa666,{{0xa667,0x0,0x0}}},
+{0xa668,{{0xa669,0x0,0x0}}},
+{0xa66a,{{0xa66b,0x0,0x0}}},
+{0xa66c,{{0xa66d,0x0,0x0}}},
+{0xa680,{{0xa681,0x0,0x0}}},
+{0xa682,{{0xa683,0x0,0x0}}},
+{0xa684,{{0xa685,0x0,0x0}}},
+{0xa686,{{0xa687,0x0,0x0}}},
+{0xa688,{{0xa689,0x0,0x0}}},
+{0xa68a,{{0xa68b,0x0,0x0}}},
+{0xa68c,{{0xa68d,0x0,0x0}}},
+{0xa68e,{{0xa68f,0x0,0x0}}},
+{0xa690,{{0xa691,0x0,0x0}}},
+{0xa692,{{0xa693,0x0,0x0}}},
+{0xa694,{{0xa695,0x0,0x0}}},
+{0xa696,{{0xa697,0x0,0x0}}},
+{0xa698,{{0xa699,0x0,0x0}}},
+{0xa69a,{{0xa69b,0x0,0x0}}},
+{0xa69c,{{0x44a,0x0,0x0}}},
+{0xa69d,{{0x44c,0x0,0x0}}},
+{0xa722,{{0xa723,0x0,0x0}}},
+{0xa724,{{0xa725,0x0,0x0}}},
+{0xa726,{{0xa727,0x0,0x0}}},
+{0xa728,{{0xa729,0x0,0x0}}},
+{0xa72a,{{0xa72b,0x0,0x0}}},
+{0xa72c,{{0xa72d,0x0,0x0}}},
+{0xa72e,{{0xa72f,0x0,0x0}}},
+{0xa732,{{0xa733,0x0,0x0}}},
+{0xa734,{{0xa735,0x0,0x0}}},
+{0xa736,{{0xa737,0x0,0x0}}},
+{0xa738,{{0xa739,0x0,0x0}}},
+{0xa73a,{{0xa73b,0x0,0x0}}},
+{0xa73c,{{0xa73d,0x0,0x0}}},
+{0xa73e,{{0xa73f,0x0,0x0}}},
+{0xa740,{{0xa741,0x0,0x0}}},
+{0xa742,{{0xa743,0x0,0x0}}},
+{0xa744,{{0xa745,0x0,0x0}}},
+{0xa746,{{0xa747,0x0,0x0}}},
+{0xa748,{{0xa749,0x0,0x0}}},
+{0xa74a,{{0xa74b,0x0,0x0}}},
+{0xa74c,{{0xa74d,0x0,0x0}}},
+{0xa74e,{{0xa74f,0x0,0x0}}},
+{0xa750,{{0xa751,0x0,0x0}}},
+{0xa752,{{0xa753,0x0,0x0}}},
+{0xa754,{{0xa755,0x0,0x0}}},
+{0xa756,{{0xa757,0x0,0x0}}},
+{0xa758,{{0xa759,0x0,0x0}}},
+{0xa75a,{{0xa75b,0x0,0x0}}},
+{0xa75c,{{0xa75d,0x0,0x0}}},
+{0xa75e,{{0xa75f,0x0,0x0}}},
+{0xa760,{{0xa761,0x0,0x0}}},
+{0xa762,{{0xa763,0x0,0x0}}},
+{0xa764,{{0xa765,0x0,0x0}}},
+{0xa766,{{0xa767,0x0,0x0}}},
+{0xa768,{{0xa769,0x0,0x0}}},
+{0xa76a,{{0xa76b,0x0,0x0}}},
+{0xa76c,{{0xa76d,0x0,0x0}}},
+{0xa76e,{{0xa76f,0x0,0x0}}},
+{0xa770,{{0xa76f,0x0,0x0}}},
+{0xa779,{{0xa77a,0x0,0x0}}},
+{0xa77b,{{0xa77c,0x0,0x0}}},
+{0xa77d,{{0x1d79,0x0,0x0}}},
+{0xa77e,{{0xa77f,0x0,0x0}}},
+{0xa780,{{0xa781,0x0,0x0}}},
+{0xa782,{{0xa783,0x0,0x0}}},
+{0xa784,{{0xa785,0x0,0x0}}},
+{0xa786,{{0xa787,0x0,0x0}}},
+{0xa78b,{{0xa78c,0x0,0x0}}},
+{0xa78d,{{0x265,0x0,0x0}}},
+{0xa790,{{0xa791,0x0,0x0}}},
+{0xa792,{{0xa793,0x0,0x0}}},
+{0xa796,{{0xa797,0x0,0x0}}},
+{0xa798,{{0xa799,0x0,0x0}}},
+{0xa79a,{{0xa79b,0x0,0x0}}},
+{0xa79c,{{0xa79d,0x0,0x0}}},
+{0xa79e,{{0xa79f,0x0,0x0}}},
+{0xa7a0,{{0xa7a1,0x0,0x0}}},
+{0xa7a2,{{0xa7a3,0x0,0x0}}},
+{0xa7a4,{{0xa7a5,0x0,0x0}}},
+{0xa7a6,{{0xa7a7,0x0,0x0}}},
+{0xa7a8,{{0xa7a9,0x0,0x0}}},
+{0xa7aa,{{0x266,0x0,0x0}}},
+{0xa7ab,{{0x25c,0x0,0x0}}},
+{0xa7ac,{{0x261,0x0,0x0}}},
+{0xa7ad,{{0x26c,0x0,0x0}}},
+{0xa7ae,{{0x26a,0x0,0x0}}},
+{0xa7b0,{{0x29e,0x0,0x0}}},
+{0xa7b1,{{0x287,0x0,0x0}}},
+{0xa7b2,{{0x29d,0x0,0x0}}},
+{0xa7b3,{{0xab53,0x0,0x0}}},
+{0xa7b4,{{0xa7b5,0x0,0x0}}},
+{0xa7b6,{{0xa7b7,0x0,0x0}}},
+{0xa7b8,{{0xa7b9,0x0,0x0}}},
+{0xa7ba,{{0xa7bb,0x0,0x0}}},
+{0xa7bc,{{0xa7bd,0x0,0x0}}},
+{0xa7be,{{0xa7bf,0x0,0x0}}},
+{0xa7c0,{{0xa7c1,0x0,0x0}}},
+{0xa7c2,{{0xa7c3,0x0,0x0}}},
+{0xa7c4,{{0xa794,0x0,0x0}}},
+{0xa7c5,{{0x282,0x0,0x0}}},
+{0xa7c6,{{0x1d8e,0x0,0x0}}},
+{0xa7c7,{{0xa7c8,0x0,0x0}}},
+{0xa7c9,{{0xa7ca,0x0,0x0}}},
+{0xa7cb,{{0x264,0x0,0x0}}},
+{0xa7cc,{{0xa7cd,0x0,0x0}}},
+{0xa7d0,{{0xa7d1,0x0,0x0}}},
+{0xa7d6,{{0xa7d7,0x0,0x0}}},
+{0xa7d8,{{0xa7d9,0x0,0x0}}},
+{0xa7da,{{0xa7db,0x0,0x0}}},
+{0xa7dc,{{0x19b,0x0,0x0}}},
+{0xa7f2,{{0x63,0x0,0x0}}},
+{0xa7f3,{{0x66,0x0,0x0}}},
+{0xa7f4,{{0x71,0x0,0x0}}},
+{0xa7f5,{{0xa7f6,0x0,0x0}}},
+{0xa7f8,{{0x127,0x0,0x0}}},
+{0xa7f9,{{0x153,0x0,0x0}}},
+{0xab5c,{{0xa727,0x0,0x0}}},
+{0xab5d,{{0xab37,0x0,0x0}}},
+{0xab5e,{{0x26b,0x0,0x0}}},
+{0xab5f,{{0xab52,0x0,0x0}}},
+{0xab69,{{0x28d,0x0,0x0}}},
+{0xab70,{{0x13a0,0x0,0x0}}},
+{0xab71,{{0x13a1,0x0,0x0}}},
+{0xab72,{{0x13a2,0x0,0x0}}},
+{0xab73,{{0x13a3,0x0,0x0}}},
+{0xab74,{{0x13a4,0x0,0x0}}},
+{0xab75,{{0x13a5,0x0,0x0}}},
+{0xab76,{{0x13a6,0x0,0x0}}},
+{0xab77,{{0x13a7,0x0,0x0}}},
+{0xab78,{{0x13a8,0x0,0x0}}},
+{0xab79,{{0x13a9,0x0,0x0}}},
+{0xab7a,{{0x13aa,0x0,0x0}}},
+{0xab7b,{{0x13ab,0x0,0x0}}},
+{0xab7c,{{0x13ac,0x0,0x0}}},
+{0xab7d,{{0x13ad,0x0,0x0}}},
+{0xab7e,{{0x13ae,0x0,0x0}}},
+{0xab7f,{{0x13af,0x0,0x0}}},
+{0xab80,{{0x13b0,0x0,0x0}}},
+{0xab81,{{0x13b1,0x0,0x0}}},
+{0xab82,{{0x13b2,0x0,0x0}}},
+{0xab83,{{0x13b3,0x0,0x0}}},
+{0xab84,{{0x13b4,0x0,0x0}}},
+{0xab85,{{0x13b5,0x0,0x0}}},
+{0xab86,{{0x13b6,0x0,0x0}}},
+{0xab87,{{0x13b7,0x0,0x0}}},
+{0xab88,{{0x13b8,0x0,0x0}}},
+{0xab89,{{0x13b9,0x0,0x0}}},
+{0xab8a,{{0x13ba,0x0,0x0}}},
+{0xab8b,{{0x13bb,0x0,0x0}}},
+{0xab8c,{{0x13bc,0x0,0x0}}},
+{0xab8d,{{0x13bd,0x0,0x0}}},
+{0xab8e,{{0x13be,0x0,0x0}}},
+{0xab8f,{{0x13bf,0x0,0x0}}},
+{0xab90,{{0x13c0,0x0,0x0}}},
+{0xab91,{{0x13c1,0x0,0x0}}},
+{0xab92,{{0x13c2,0x0,0x0}}},
+{0xab93,{{0x13c3,0x0,0x0}}},
+{0xab94,{{0x13c4,0x0,0x0}}},
+{0xab95,{{0x13c5,0x0,0x0}}},
+{0xab96,{{0x13c6,0x0,0x0}}},
+{0xab97,{{0x13c7,0x0,0x0}}},
+{0xab98,{{0x13c8,0x0,0x0}}},
+{0xab99,{{0x13c9,0x0,0x0}}},
+{0xab9a,{{0x13ca,0x0,0x0}}},
+{0xab9b,{{0x13cb,0x0,0x0}}},
+{0xab9c,{{0x13cc,0x0,0x0}}},
+{0xab9d,{{0x13cd,0x0,0x0}}},
+{0xab9e,{{0x13ce,0x0,0x0}}},
+{0xab9f,{{0x13cf,0x0,0x0}}},
+{0xaba0,{{0x13d0,0x0,0x0}}},
+{0xaba1,{{0x13d1,0x0,0x0}}},
+{0xaba2,{{0x13d2,0x0,0x0}}},
+{0xaba3,{{0x13d3,0x0,0x0}}},
+{0xaba4,{{0x13d4,0x0,0x0}}},
+{0xaba5,{{0x13d5,0x0,0x0}}},
+{0xaba6,{{0x13d6,0x0,0x0}}},
+{0xaba7,{{0x13d7,0x0,0x0}}},
+{0xaba8,{{0x13d8,0x0,0x0}}},
+{0xaba9,{{0x13d9,0x0,0x0}}},
+{0xabaa,{{0x13da,0x0,0x0}}},
+{0xabab,{{0x13db,0x0,0x0}}},
+{0xabac,{{0x13dc,0x0,0x0}}},
+{0xabad,{{0x13dd,0x0,0x0}}},
+{0xabae,{{0x13de,0x0,0x0}}},
+{0xabaf,{{0x13df,0x0,0x0}}},
+{0xabb0,{{0x13e0,0x0,0x0}}},
+{0xabb1,{{0x13e1,0x0,0x0}}},
+{0xabb2,{{0x13e2,0x0,0x0}}},
+{0xabb3,{{0x13e3,0x0,0x0}}},
+{0xabb4,{{0x13e4,0x0,0x0}}},
+{0xabb5,{{0x13e5,0x0,0x0}}},
+{0xabb6,{{0x13e6,0x0,0x0}}},
+{0xabb7,{{0x13e7,0x0,0x0}}},
+{0xabb8,{{0x13e8,0x0,0x0}}},
+{0xabb9,{{0x13e9,0x0,0x0}}},
+{0xabba,{{0x13ea,0x0,0x0}}},
+{0xabbb,{{0x13eb,0x0,0x0}}},
+{0xabbc,{{0x13ec,0x0,0x0}}},
+{0xabbd,{{0x13ed,0x0,0x0}}},
+{0xabbe,{{0x13ee,0x0,0x0}}},
+{0xabbf,{{0x13ef,0x0,0x0}}},
+{0xf900,{{0x8c48,0x0,0x0}}},
+{0xf901,{{0x66f4,0x0,0x0}}},
+{0xf902,{{0x8eca,0x0,0x0}}},
+{0xf903,{{0x8cc8,0x0,0x0}}},
+{0xf904,{{0x6ed1,0x0,0x0}}},
+{0xf905,{{0x4e32,0x0,0x0}}},
+{0xf906,{{0x53e5,0x0,0x0}}},
+{0xf907,{{0x9f9c,0x0,0x0}}},
+{0xf908,{{0x9f9c,0x0,0x0}}},
+{0xf909,{{0x5951,0x0,0x0}}},
+{0xf90a,{{0x91d1,0x0,0x0}}},
+{0xf90b,{{0x5587,0x0,0x0}}},
+{0xf90c,{{0x5948,0x0,0x0}}},
+{0xf90d,{{0x61f6,0x0,0x0}}},
+{0xf90e,{{0x7669,0x0,0x0}}},
+{0xf90f,{{0x7f85,0x0,0x0}}},
+{0xf910,{{0x863f,0x0,0x0}}},
+{0xf911,{{0x87ba,0x0,0x0}}},
+{0xf912,{{0x88f8,0x0,0x0}}},
+{0xf913,{{0x908f,0x0,0x0}}},
+{0xf914,{{0x6a02,0x0,0x0}}},
+{0xf915,{{0x6d1b,0x0,0x0}}},
+{0xf916,{{0x70d9,0x0,0x0}}},
+{0xf917,{{0x73de,0x0,0x0}}},
+{0xf918,{{0x843d,0x0,0x0}}},
+{0xf919,{{0x916a,0x0,0x0}}},
+{0xf91a,{{0x99f1,0x0,0x0}}},
+{0xf91b,{{0x4e82,0x0,0x0}}},
+{0xf91c,{{0x5375,0x0,0x0}}},
+{0xf91d,{{0x6b04,0x0,0x0}}},
+{0xf91e,{{0x721b,0x0,0x0}}},
+{0xf91f,{{0x862d,0x0,0x0}}},
+{0xf920,{{0x9e1e,0x0,0x0}}},
+{0xf921,{{0x5d50,0x0,0x0}}},
+{0xf922,{{0x6feb,0x0,0x0}}},
+{0xf923,{{0x85cd,0x0,0x0}}},
+{0xf924,{{0x8964,0x0,0x0}}},
+{0xf925,{{0x62c9,0x0,0x0}}},
+{0xf926,{{0x81d8,0x0,0x0}}},
+{0xf927,{{0x881f,0x0,0x0}}},
+{0xf928,{{0x5eca,0x0,0x0}}},
+{0xf929,{{0x6717,0x0,0x0}}},
+{0xf92a,{{0x6d6a,0x0,0x0}}},
+{0xf92b,{{0x72fc,0x0,0x0}}},
+{0xf92c,{{0x90ce,0x0,0x0}}},
+{0xf92d,{{0x4f86,0x0,0x0}}},
+{0xf92e,{{0x51b7,0x0,0x0}}},
+{0xf92f,{{0x52de,0x0,0x0}}},
+{0xf930,{{0x64c4,0x0,0x0}}},
+{0xf931,{{0x6ad3,0x0,0x0}}},
+{0xf932,{{0x7210,0x0,0x0}}},
+{0xf933,{{0x76e7,0x0,0x0}}},
+{0xf934,{{0x8001,0x0,0x0}}},
+{0xf935,{{0x8606,0x0,0x0}}},
+{0xf936,{{0x865c,0x0,0x0}}},
+{0xf937,{{0x8def,0x0,0x0}}},
+{0xf938,{{0x9732,0x0,0x0}}},
+{0xf939,{{0x9b6f,0x0,0x0}}},
+{0xf93a,{{0x9dfa,0x0,0x0}}},
+{0xf93b,{{0x788c,0x0,0x0}}},
+{0xf93c,{{0x797f,0x0,0x0}}},
+{0xf93d,{{0x7da0,0x0,0x0}}},
+{0xf93e,{{0x83c9,0x0,0x0}}},
+{0xf93f,{{0x9304,0x0,0x0}}},
+{0xf940,{{0x9e7f,0x0,0x0}}},
+{0xf941,{{0x8ad6,0x0,0x0}}},
+{0xf942,{{0x58df,0x0,0x0}}},
+{0xf943,{{0x5f04,0x0,0x0}}},
+{0xf944,{{0x7c60,0x0,0x0}}},
+{0xf945,{{0x807e,0x0,0x0}}},
+{0xf946,{{0x7262,0x0,0x0}}},
+{0xf947,{{0x78ca,0x0,0x0}}},
+{0xf948,{{0x8cc2,0x0,0x0}}},
+{0xf949,{{0x96f7,0x0,0x0}}},
+{0xf94a,{{0x58d8,0x0,0x0}}},
+{0xf94b,{{0x5c62,0x0,0x0}}},
+{0xf94c,{{0x6a13,0x0,0x0}}},
+{0xf94d,{{0x6dda,0x0,0x0}}},
+{0xf94e,{{0x6f0f,0x0,0x0}}},
+{0xf94f,{{0x7d2f,0x0,0x0}}},
+{0xf950,{{0x7e37,0x0,0x0}}},
+{0xf951,{{0x964b,0x0,0x0}}},
+{0xf952,{{0x52d2,0x0,0x0}}},
+{0xf953,{{0x808b,0x0,0x0}}},
+{0xf954,{{0x51dc,0x0,0x0}}},
+{0xf955,{{0x51cc,0x0,0x0}}},
+{0xf956,{{0x7a1c,0x0,0x0}}},
+{0xf957,{{0x7dbe,0x0,0x0}}},
+{0xf958,{{0x83f1,0x0,0x0}}},
+{0xf959,{{0x9675,0x0,0x0}}},
+{0xf95a,{{0x8b80,0x0,0x0}}},
+{0xf95b,{{0x62cf,0x0,0x0}}},
+{0xf95c,{{0x6a02,0x0,0x0}}},
+{0xf95d,{{0x8afe,0x0,0x0}}},
+{0xf95e,{{0x4e39,0x0,0x0}}},
+{0xf95f,{{0x5be7,0x0,0x0}}},
+{0xf960,{{0x6012,0x0,0x0}}},
+{0xf961,{{0x7387,0x0,0x0}}},
+{0xf962,{{0x7570,0x0,0x0}}},
+{0xf963,{{0x5317,0x0,0x0}}},
+{0xf964,{{0x78fb,0x0,0x0}}},
+{0xf965,{{0x4fbf,0x0,0x0}}},
+{0xf966,{{0x5fa9,0x0,0x0}}},
+{0xf967,{{0x4e0d,0x0,0x0}}},
+{0xf968,{{0x6ccc,0x0,0x0}}},
+{0xf969,{{0x6578,0x0,0x0}}},
+{0xf96a,{{0x7d22,0x0,0x0}}},
+{0xf96b,{{0x53c3,0x0,0x0}}},
+{0xf96c,{{0x585e,0x0,0x0}}},
+{0xf96d,{{0x7701,0x0,0x0}}},
+{0xf96e,{{0x8449,0x0,0x0}}},
+{0xf96f,{{0x8aaa,0x0,0x0}}},
+{0xf970,{{0x6bba,0x0,0x0}}},
+{0xf971,{{0x8fb0,0x0,0x0}}},
+{0xf972,{{0x6c88,0x0,0x0}}},
+{0xf973,{{0x62fe,0x0,0x0}}},
+{0xf974,{{0x82e5,0x0,0x0}}},
+{0xf975,{{0x63a0,0x0,0x0}}},
+{0xf976,{{0x7565,0x0,0x0}}},
+{0xf977,{{0x4eae,0x0,0x0}}},
+{0xf978,{{0x5169,0x0,0x0}}},
+{0xf979,{{0x51c9,0x0,0x0}}},
+{0xf97a,{{0x6881,0x0,0x0}}},
+{0xf97b,{{0x7ce7,0x0,0x0}}},
+{0xf97c,{{0x826f,0x0,0x0}}},
+{0xf97d,{{0x8ad2,0x0,0x0}}},
+{0xf97e,{{0x91cf,0x0,0x0}}},
+{0xf97f,{{0x52f5,0x0,0x0}}},
+{0xf980,{{0x5442,0x0,0x0}}},
+{0xf981,{{0x5973,0x0,0x0}}},
+{0xf982,{{0x5eec,0x0,0x0}}},
+{0xf983,{{0x65c5,0x0,0x0}}},
+{0xf984,{{0x6ffe,0x0,0x0}}},
+{0xf985,{{0x792a,0x0,0x0}}},
+{0xf986,{{0x95ad,0x0,0x0}}},
+{0xf987,{{0x9a6a,0x0,0x0}}},
+{0xf988,{{0x9e97,0x0,0x0}}},
+{0xf989,{{0x9ece,0x0,0x0}}},
+{0xf98a,{{0x529b,0x0,0x0}}},
+{0xf98b,{{0x66c6,0x0,0x0}}},
+{0xf98c,{{0x6b77,0x0,0x0}}},
+{0xf98d,{{0x8f62,0x0,0x0}}},
+{0xf98e,{{0x5e74,0x0,0x0}}},
+{0xf98f,{{0x6190,0x0,0x0}}},
+{0xf990,{{0x6200,0x0,0x0}}},
+{0xf991,{{0x649a,0x0,0x0}}},
+{0xf992,{{0x6f23,0x0,0x0}}},
+{0xf993,{{0x7149,0x0,0x0}}},
+{0xf994,{{0x7489,0x0,0x0}}},
+{0xf995,{{0x79ca,0x0,0x0}}},
+{0xf996,{{0x7df4,0x0,0x0}}},
+{0xf997,{{0x806f,0x0,0x0}}},
+{0xf998,{{0x8f26,0x0,0x0}}},
+{0xf999,{{0x84ee,0x0,0x0}}},
+{0xf99a,{{0x9023,0x0,0x0}}},
+{0xf99b,{{0x934a,0x0,0x0}}},
+{0xf99c,{{0x5217,0x0,0x0}}},
+{0xf99d,{{0x52a3,0x0,0x0}}},
+{0xf99e,{{0x54bd,0x0,0x0}}},
+{0xf99f,{{0x70c8,0x0,0x0}}},
+{0xf9a0,{{0x88c2,0x0,0x0}}},
+{0xf9a1,{{0x8aaa,0x0,0x0}}},
+{0xf9a2,{{0x5ec9,0x0,0x0}}},
+{0xf9a3,{{0x5ff5,0x0,0x0}}},
+{0xf9a4,{{0x637b,0x0,0x0}}},
+{0xf9a5,{{0x6bae,0x0,0x0}}},
+{0xf9a6,{{0x7c3e,0x0,0x0}}},
+{0xf9a7,{{0x7375,0x0,0x0}}},
+{0xf9a8,{{0x4ee4,0x0,0x0}}},
+{0xf9a9,{{0x56f9,0x0,0x0}}},
+{0xf9aa,{{0x5be7,0x0,0x0}}},
+{0xf9ab,{{0x5dba,0x0,0x0}}},
+{0xf9ac,{{0x601c,0x0,0x0}}},
+{0xf9ad,{{0x73b2,0x0,0x0}}},
+{0xf9ae,{{0x7469,0x0,0x0}}},
+{0xf9af,{{0x7f9a,0x0,0x0}}},
+{0xf9b0,{{0x8046,0x0,0x0}}},
+{0xf9b1,{{0x9234,0x0,0x0}}},
+{0xf9b2,{{0x96f6,0x0,0x0}}},
+{0xf9b3,{{0x9748,0x0,0x0}}},
+{0xf9b4,{{0x9818,0x0,0x0}}},
+{0xf9b5,{{0x4f8b,0x0,0x0}}},
+{0xf9b6,{{0x79ae,0x0,0x0}}},
+{0xf9b7,{{0x91b4,0x0,0x0}}},
+{0xf9b8,{{0x96b8,0x0,0x0}}},
+{0xf9b9,{{0x60e1,0x0,0x0}}},
+{0xf9ba,{{0x4e86,0x0,0x0}}},
+{0xf9bb,{{0x50da,0x0,0x0}}},
+{0xf9bc,{{0x5bee,0x0,0x0}}},
+{0xf9bd,{{0x5c3f,0x0,0x0}}},
+{0xf9be,{{0x6599,0x0,0x0}}},
+{0xf9bf,{{0x6a02,0x0,0x0}}},
+{0xf9c0,{{0x71ce,0x0,0x0}}},
+{0xf9c1,{{0x7642,0x0,0x0}}},
+{0xf9c2,{{0x84fc,0x0,0x0}}},
+{0xf9c3,{{0x907c,0x0,0x0}}},
+{0xf9c4,{{0x9f8d,0x0,0x0}}},
+{0xf9c5,{{0x6688,0x0,0x0}}},
+{0xf9c6,{{0x962e,0x0,0x0}}},
+{0xf9c7,{{0x5289,0x0,0x0}}},
+{0xf9c8,{{0x677b,0x0,0x0}}},
+{0xf9c9,{{0x67f3,0x0,0x0}}},
+{0xf9ca,{{0x6d41,0x0,0x0}}},
+{0xf9cb,{{0x6e9c,0x0,0x0}}},
+{0xf9cc,{{0x7409,0x0,0x0}}},
+{0xf9cd,{{0x7559,0x0,0x0}}},
+{0xf9ce,{{0x786b,0x0,0x0}}},
+{0xf9cf,{{0x7d10,0x0,0x0}}},
+{0xf9d0,{{0x985e,0x0,0x0}}},
+{0xf9d1,{{0x516d,0x0,0x0}}},
+{0xf9d2,{{0x622e,0x0,0x0}}},
+{0xf9d3,{{0x9678,0x0,0x0}}},
+{0xf9d4,{{0x502b,0x0,0x0}}},
+{0xf9d5,{{0x5d19,0x0,0x0}}},
+{0xf9d6,{{0x6dea,0x0,0x0}}},
+{0xf9d7,{{0x8f2a,0x0,0x0}}},
+{0xf9d8,{{0x5f8b,0x0,0x0}}},
+{0xf9d9,{{0x6144,0x0,0x0}}},
+{0xf9da,{{0x6817,0x0,0x0}}},
+{0xf9db,{{0x7387,0x0,0x0}}},
+{0xf9dc,{{0x9686,0x0,0x0}}},
+{0xf9dd,{{0x5229,0x0,0x0}}},
+{0xf9de,{{0x540f,0x0,0x0}}},
+{0xf9df,{{0x5c65,0x0,0x0}}},
+{0xf9e0,{{0x6613,0x0,0x0}}},
+{0xf9e1,{{0x674e,0x0,0x0}}},
+{0xf9e2,{{0x68a8,0x0,0x0}}},
+{0xf9e3,{{0x6ce5,0x0,0x0}}},
+{0xf9e4,{{0x7406,0x0,0x0}}},
+{0xf9e5,{{0x75e2,0x0,0x0}}},
+{0xf9e6,{{0x7f79,0x0,0x0}}},
+{0xf9e7,{{0x88cf,0x0,0x0}}},
+{0xf9e8,{{0x88e1,0x0,0x0}}},
+{0xf9e9,{{0x91cc,0x0,0x0}}},
+{0xf9ea,{{0x96e2,0x0,0x0}}},
+{0xf9eb,{{0x533f,0x0,0x0}}},
+{0xf9ec,{{0x6eba,0x0,0x0}}},
+{0xf9ed,{{0x541d,0x0,0x0}}},
+{0xf9ee,{{0x71d0,0x0,0x0}}},
+{0xf9ef,{{0x7498,0x0,0x0}}},
+{0xf9f0,{{0x85fa,0x0,0x0}}},
+{0xf9f1,{{0x96a3,0x0,0x0}}},
+{0xf9f2,{{0x9c57,0x0,0x0}}},
+{0xf9f3,{{0x9e9f,0x0,0x0}}},
+{0xf9f4,{{0x6797,0x0,0x0}}},
+{0xf9f5,{{0x6dcb,0x0,0x0}}},
+{0xf9f6,{{0x81e8,0x0,0x0}}},
+{0xf9f7,{{0x7acb,0x0,0x0}}},
+{0xf9f8,{{0x7b20,0x0,0x0}}},
+{0xf9f9,{{0x7c92,0x0,0x0}}},
+{0xf9fa,{{0x72c0,0x0,0x0}}},
+{0xf9fb,{{0x7099,0x0,0x0}}},
+{0xf9fc,{{0x8b58,0x0,0x0}}},
+{0xf9fd,{{0x4ec0,0x0,0x0}}},
+{0xf9fe,{{0x8336,0x0,0x0}}},
+{0xf9ff,{{0x523a,0x0,0x0}}},
+{0xfa00,{{0x5207,0x0,0x0}}},
+{0xfa01,{{0x5ea6,0x0,0x0}}},
+{0xfa02,{{0x62d3,0x0,0x0}}},
+{0xfa03,{{0x7cd6,0x0,0x0}}},
+{0xfa04,{{0x5b85,0x0,0x0}}},
+{0xfa05,{{0x6d1e,0x0,0x0}}},
+{0xfa06,{{0x66b4,0x0,0x0}}},
+{0xfa07,{{0x8f3b,0x0,0x0}}},
+{0xfa08,{{0x884c,0x0,0x0}}},
+{0xfa09,{{0x964d,0x0,0x0}}},
+{0xfa0a,{{0x898b,0x0,0x0}}},
+{0xfa0b,{{0x5ed3,0x0,0x0}}},
+{0xfa0c,{{0x5140,0x0,0x0}}},
+{0xfa0d,{{0x55c0,0x0,0x0}}},
+{0xfa10,{{0x585a,0x0,0x0}}},
+{0xfa12,{{0x6674,0x0,0x0}}},
+{0xfa15,{{0x51de,0x0,0x0}}},
+{0xfa16,{{0x732a,0x0,0x0}}},
+{0xfa17,{{0x76ca,0x0,0x0}}},
+{0xfa18,{{0x793c,0x0,0x0}}},
+{0xfa19,{{0x795e,0x0,0x0}}},
+{0xfa1a,{{0x7965,0x0,0x0}}},
+{0xfa1b,{{0x798f,0x0,0x0}}},
+{0xfa1c,{{0x9756,0x0,0x0}}},
+{0xfa1d,{{0x7cbe,0x0,0x0}}},
+{0xfa1e,{{0x7fbd,0x0,0x0}}},
+{0xfa20,{{0x8612,0x0,0x0}}},
+{0xfa22,{{0x8af8,0x0,0x0}}},
+{0xfa25,{{0x9038,0x0,0x0}}},
+{0xfa26,{{0x90fd,0x0,0x0}}},
+{0xfa2a,{{0x98ef,0x0,0x0}}},
+{0xfa2b,{{0x98fc,0x0,0x0}}},
+{0xfa2c,{{0x9928,0x0,0x0}}},
+{0xfa2d,{{0x9db4,0x0,0x0}}},
+{0xfa2e,{{0x90de,0x0,0x0}}},
+{0xfa2f,{{0x96b7,0x0,0x0}}},
+{0xfa30,{{0x4fae,0x0,0x0}}},
+{0xfa31,{{0x50e7,0x0,0x0}}},
+{0xfa32,{{0x514d,0x0,0x0}}},
+{0xfa33,{{0x52c9,0x0,0x0}}},
+{0xfa34,{{0x52e4,0x0,0x0}}},
+{0xfa35,{{0x5351,0x0,0x0}}},
+{0xfa36,{{0x559d,0x0,0x0}}},
+{0xfa37,{{0x5606,0x0,0x0}}},
+{0xfa38,{{0x5668,0x0,0x0}}},
+{0xfa39,{{0x5840,0x0,0x0}}},
+{0xfa3a,{{0x58a8,0x0,0x0}}},
+{0xfa3b,{{0x5c64,0x0,0x0}}},
+{0xfa3c,{{0x5c6e,0x0,0x0}}},
+{0xfa3d,{{0x6094,0x0,0x0}}},
+{0xfa3e,{{0x6168,0x0,0x0}}},
+{0xfa3f,{{0x618e,0x0,0x0}}},
+{0xfa40,{{0x61f2,0x0,0x0}}},
+{0xfa41,{{0x654f,0x0,0x0}}},
+{0xfa42,{{0x65e2,0x0,0x0}}},
+{0xfa43,{{0x6691,0x0,0x0}}},
+{0xfa44,{{0x6885,0x0,0x0}}},
+{0xfa45,{{0x6d77,0x0,0x0}}},
+{0xfa46,{{0x6e1a,0x0,0x0}}},
+{0xfa47,{{0x6f22,0x0,0x0}}},
+{0xfa48,{{0x716e,0x0,0x0}}},
+{0xfa49,{{0x722b,0x0,0x0}}},
+{0xfa4a,{{0x7422,0x0,0x0}}},
+{0xfa4b,{{0x7891,0x0,0x0}}},
+{0xfa4c,{{0x793e,0x0,0x0}}},
+{0xfa4d,{{0x7949,0x0,0x0}}},
+{0xfa4e,{{0x7948,0x0,0x0}}},
+{0xfa4f,{{0x7950,0x0,0x0}}},
+{0xfa50,{{0x7956,0x0,0x0}}},
+{0xfa51,{{0x795d,0x0,0x0}}},
+{0xfa52,{{0x798d,0x0,0x0}}},
+{0xfa53,{{0x798e,0x0,0x0}}},
+{0xfa54,{{0x7a40,0x0,0x0}}},
+{0xfa55,{{0x7a81,0x0,0x0}}},
+{0xfa56,{{0x7bc0,0x0,0x0}}},
+{0xfa57,{{0x7df4,0x0,0x0}}},
+{0xfa58,{{0x7e09,0x0,0x0}}},
+{0xfa59,{{0x7e41,0x0,0x0}}},
+{0xfa5a,{{0x7f72,0x0,0x0}}},
+{0xfa5b,{{0x8005,0x0,0x0}}},
+{0xfa5c,{{0x81ed,0x0,0x0}}},
+{0xfa5d,{{0x8279,0x0,0x0}}},
+{0xfa5e,{{0x8279,0x0,0x0}}},
+{0xfa5f,{{0x8457,0x0,0x0}}},
+{0xfa60,{{0x8910,0x0,0x0}}},
+{0xfa61,{{0x8996,0x0,0x0}}},
+{0xfa62,{{0x8b01,0x0,0x0}}},
+{0xfa63,{{0x8b39,0x0,0x0}}},
+{0xfa64,{{0x8cd3,0x0,0x0}}},
+{0xfa65,{{0x8d08,0x0,0x0}}},
+{0xfa66,{{0x8fb6,0x0,0x0}}},
+{0xfa67,{{0x9038,0x0,0x0}}},
+{0xfa68,{{0x96e3,0x0,0x0}}},
+{0xfa69,{{0x97ff,0x0,0x0}}},
+{0xfa6a,{{0x983b,0x0,0x0}}},
+{0xfa6b,{{0x6075,0x0,0x0}}},
+{0xfa6c,{{0x242ee,0x0,0x0}}},
+{0xfa6d,{{0x8218,0x0,0x0}}},
+{0xfa70,{{0x4e26,0x0,0x0}}},
+{0xfa71,{{0x51b5,0x0,0x0}}},
+{0xfa72,{{0x5168,0x0,0x0}}},
+{0xfa73,{{0x4f80,0x0,0x0}}},
+{0xfa74,{{0x5145,0x0,0x0}}},
+{0xfa75,{{0x5180,0x0,0x0}}},
+{0xfa76,{{0x52c7,0x0,0x0}}},
+{0xfa77,{{0x52fa,0x0,0x0}}},
+{0xfa78,{{0x559d,0x0,0x0}}},
+{0xfa79,{{0x5555,0x0,0x0}}},
+{0xfa7a,{{0x5599,0x0,0x0}}},
+{0xfa7b,{{0x55e2,0x0,0x0}}},
+{0xfa7c,{{0x585a,0x0,0x0}}},
+{0xfa7d,{{0x58b3,0x0,0x0}}},
+{0xfa7e,{{0x5944,0x0,0x0}}},
+{0xfa7f,{{0x5954,0x0,0x0}}},
+{0xfa80,{{0x5a62,0x0,0x0}}},
+{0xfa81,{{0x5b28,0x0,0x0}}},
+{0xfa82,{{0x5ed2,0x0,0x0}}},
+{0xfa83,{{0x5ed9,0x0,0x0}}},
+{0xfa84,{{0x5f69,0x0,0x0}}},
+{0xfa85,{{0x5fad,0x0,0x0}}},
+{0xfa86,{{0x60d8,0x0,0x0}}},
+{0xfa87,{{0x614e,0x0,0x0}}},
+{0xfa88,{{0x6108,0x0,0x0}}},
+{0xfa89,{{0x618e,0x0,0x0}}},
+{0xfa8a,{{0x6160,0x0,0x0}}},
+{0xfa8b,{{0x61f2,0x0,0x0}}},
+{0xfa8c,{{0x6234,0x0,0x0}}},
+{0xfa8d,{{0x63c4,0x0,0x0}}},
+{0xfa8e,{{0x641c,0x0,0x0}}},
+{0xfa8f,{{0x6452,0x0,0x0}}},
+{0xfa90,{{0x6556,0x0,0x0}}},
+{0xfa91,{{0x6674,0x0,0x0}}},
+{0xfa92,{{0x6717,0x0,0x0}}},
+{0xfa93,{{0x671b,0x0,0x0}}},
+{0xfa94,{{0x6756,0x0,0x0}}},
+{0xfa95,{{0x6b79,0x0,0x0}}},
+{0xfa96,{{0x6bba,0x0,0x0}}},
+{0xfa97,{{0x6d41,0x0,0x0}}},
+{0xfa98,{{0x6edb,0x0,0x0}}},
+{0xfa99,{{0x6ecb,0x0,0x0}}},
+{0xfa9a,{{0x6f22,0x0,0x0}}},
+{0xfa9b,{{0x701e,0x0,0x0}}},
+{0xfa9c,{{0x716e,0x0,0x0}}},
+{0xfa9d,{{0x77a7,0x0,0x0}}},
+{0xfa9e,{{0x7235,0x0,0x0}}},
+{0xfa9f,{{0x72af,0x0,0x0}}},
+{0xfaa0,{{0x732a,0x0,0x0}}},
+{0xfaa1,{{0x7471,0x0,0x0}}},
+{0xfaa2,{{0x7506,0x0,0x0}}},
+{0xfaa3,{{0x753b,0x0,0x0}}},
+{0xfaa4,{{0x761d,0x0,0x0}}},
+{0xfaa5,{{0x761f,0x0,0x0}}},
+{0xfaa6,{{0x76ca,0x0,0x0}}},
+{0xfaa7,{{0x76db,0x0,0x0}}},
+{0xfaa8,{{0x76f4,0x0,0x0}}},
+{0xfaa9,{{0x774a,0x0,0x0}}},
+{0xfaaa,{{0x7740,0x0,0x0}}},
+{0xfaab,{{0x78cc,0x0,0x0}}},
+{0xfaac,{{0x7ab1,0x0,0x0}}},
+{0xfaad,{{0x7bc0,0x0,0x0}}},
+{0xfaae,{{0x7c7b,0x0,0x0}}},
+{0xfaaf,{{0x7d5b,0x0,0x0}}},
+{0xfab0,{{0x7df4,0x0,0x0}}},
+{0xfab1,{{0x7f3e,0x0,0x0}}},
+{0xfab2,{{0x8005,0x0,0x0}}},
+{0xfab3,{{0x8352,0x0,0x0}}},
+{0xfab4,{{0x83ef,0x0,0x0}}},
+{0xfab5,{{0x8779,0x0,0x0}}},
+{0xfab6,{{0x8941,0x0,0x0}}},
+{0xfab7,{{0x8986,0x0,0x0}}},
+{0xfab8,{{0x8996,0x0,0x0}}},
+{0xfab9,{{0x8abf,0x0,0x0}}},
+{0xfaba,{{0x8af8,0x0,0x0}}},
+{0xfabb,{{0x8acb,0x0,0x0}}},
+{0xfabc,{{0x8b01,0x0,0x0}}},
+{0xfabd,{{0x8afe,0x0,0x0}}},
+{0xfabe,{{0x8aed,0x0,0x0}}},
+{0xfabf,{{0x8b39,0x0,0x0}}},
+{0xfac0,{{0x8b8a,0x0,0x0}}},
+{0xfac1,{{0x8d08,0x0,0x0}}},
+{0xfac2,{{0x8f38,0x0,0x0}}},
+{0xfac3,{{0x9072,0x0,0x0}}},
+{0xfac4,{{0x9199,0x0,0x0}}},
+{0xfac5,{{0x9276,0x0,0x0}}},
+{0xfac6,{{0x967c,0x0,0x0}}},
+{0xfac7,{{0x96e3,0x0,0x0}}},
+{0xfac8,{{0x9756,0x0,0x0}}},
+{0xfac9,{{0x97db,0x0,0x0}}},
+{0xfaca,{{0x97ff,0x0,0x0}}},
+{0xfacb,{{0x980b,0x0,0x0}}},
+{0xfacc,{{0x983b,0x0,0x0}}},
+{0xfacd,{{0x9b12,0x0,0x0}}},
+{0xface,{{0x9f9c,0x0,0x0}}},
+{0xfacf,{{0x2284a,0x0,0x0}}},
+{0xfad0,{{0x22844,0x0,0x0}}},
+{0xfad1,{{0x233d5,0x0,0x0}}},
+{0xfad2,{{0x3b9d,0x0,0x0}}},
+{0xfad3,{{0x4018,0x0,0x0}}},
+{0xfad4,{{0x4039,0x0,0x0}}},
+{0xfad5,{{0x25249,0x0,0x0}}},
+{0xfad6,{{0x25cd0,0x0,0x0}}},
+{0xfad7,{{0x27ed3,0x0,0x0}}},
+{0xfad8,{{0x9f43,0x0,0x0}}},
+{0xfad9,{{0x9f8e,0x0,0x0}}},
+{0xfb00,{{0x66,0x66,0x0}}},
+{0xfb01,{{0x66,0x69,0x0}}},
+{0xfb02,{{0x66,0x6c,0x0}}},
+{0xfb03,{{0x66,0x66,0x69}}},
+{0xfb04,{{0x66,0x66,0x6c}}},
+{0xfb05,{{0x73,0x74,0x0}}},
+{0xfb06,{{0x73,0x74,0x0}}},
+{0xfb13,{{0x574,0x576,0x0}}},
+{0xfb14,{{0x574,0x565,0x0}}},
+{0xfb15,{{0x574,0x56b,0x0}}},
+{0xfb16,{{0x57e,0x576,0x0}}},
+{0xfb17,{{0x574,0x56d,0x0}}},
+{0xfb1d,{{0x5d9,0x5b4,0x0}}},
+{0xfb1f,{{0x5f2,0x5b7,0x0}}},
+{0xfb20,{{0x5e2,0x0,0x0}}},
+{0xfb21,{{0x5d0,0x0,0x0}}},
+{0xfb22,{{0x5d3,0x0,0x0}}},
+{0xfb23,{{0x5d4,0x0,0x0}}},
+{0xfb24,{{0x5db,0x0,0x0}}},
+{0xfb25,{{0x5dc,0x0,0x0}}},
+{0xfb26,{{0x5dd,0x0,0x0}}},
+{0xfb27,{{0x5e8,0x0,0x0}}},
+{0xfb28,{{0x5ea,0x0,0x0}}},
+{0xfb29,{{0x2b,0x0,0x0}}},
+{0xfb2a,{{0x5e9,0x5c1,0x0}}},
+{0xfb2b,{{0x5e9,0x5c2,0x0}}},
+{0xfb2c,{{0x5e9,0x5bc,0x5c1}}},
+{0xfb2d,{{0x5e9,0x5bc,0x5c2}}},
+{0xfb2e,{{0x5d0,0x5b7,0x0}}},
+{0xfb2f,{{0x5d0,0x5b8,0x0}}},
+{0xfb30,{{0x5d0,0x5bc,0x0}}},
+{0xfb31,{{0x5d1,0x5bc,0x0}}},
+{0xfb32,{{0x5d2,0x5bc,0x0}}},
+{0xfb33,{{0x5d3,0x5bc,0x0}}},
+{0xfb34,{{0x5d4,0x5bc,0x0}}},
+{0xfb35,{{0x5d5,0x5bc,0x0}}},
+{0xfb36,{{0x5d6,0x5bc,0x0}}},
+{0xfb38,{{0x5d8,0x5bc,0x0}}},
+{0xfb39,{{0x5d9,0x5bc,0x0}}},
+{0xfb3a,{{0x5da,0x5bc,0x0}}},
+{0xfb3b,{{0x5db,0x5bc,0x0}}},
+{0xfb3c,{{0x5dc,0x5bc,0x0}}},
+{0xfb3e,{{0x5de,0x5bc,0x0}}},
+{0xfb40,{{0x5e0,0x5bc,0x0}}},
+{0xfb41,{{0x5e1,0x5bc,0x0}}},
+{0xfb43,{{0x5e3,0x5bc,0x0}}},
+{0xfb44,{{0x5e4,0x5bc,0x0}}},
+{0xfb46,{{0x5e6,0x5bc,0x0}}},
+{0xfb47,{{0x5e7,0x5bc,0x0}}},
+{0xfb48,{{0x5e8,0x5bc,0x0}}},
+{0xfb49,{{0x5e9,0x5bc,0x0}}},
+{0xfb4a,{{0x5ea,0x5bc,0x0}}},
+{0xfb4b,{{0x5d5,0x5b9,0x0}}},
+{0xfb4c,{{0x5d1,0x5bf,0x0}}},
+{0xfb4d,{{0x5db,0x5bf,0x0}}},
+{0xfb4e,{{0x5e4,0x5bf,0x0}}},
+{0xfb4f,{{0x5d0,0x5dc,0x0}}},
+{0xfb50,{{0x671,0x0,0x0}}},
+{0xfb51,{{0x671,0x0,0x0}}},
+{0xfb52,{{0x67b,0x0,0x0}}},
+{0xfb53,{{0x67b,0x0,0x0}}},
+{0xfb54,{{0x67b,0x0,0x0}}},
+{0xfb55,{{0x67b,0x0,0x0}}},
+{0xfb56,{{0x67e,0x0,0x0}}},
+{0xfb57,{{0x67e,0x0,0x0}}},
+{0xfb58,{{0x67e,0x0,0x0}}},
+{0xfb59,{{0x67e,0x0,0x0}}},
+{0xfb5a,{{0x680,0x0,0x0}}},
+{0xfb5b,{{0x680,0x0,0x0}}},
+{0xfb5c,{{0x680,0x0,0x0}}},
+{0xfb5d,{{0x680,0x0,0x0}}},
+{0xfb5e,{{0x67a,0x0,0x0}}},
+{0xfb5f,{{0x67a,0x0,0x0}}},
+{0xfb60,{{0x67a,0x0,0x0}}},
+{0xfb61,{{0x67a,0x0,0x0}}},
+{0xfb62,{{0x67f,0x0,0x0}}},
+{0xfb63,{{0x67f,0x0,0x0}}},
+{0xfb64,{{0x67f,0x0,0x0}}},
+{0xfb65,{{0x67f,0x0,0x0}}},
+{0xfb66,{{0x679,0x0,0x0}}},
+{0xfb67,{{0x679,0x0,0x0}}},
+{0xfb68,{{0x679,0x0,0x0}}},
+{0xfb69,{{0x679,0x0,0x0}}},
+{0xfb6a,{{0x6a4,0x0,0x0}}},
+{0xfb6b,{{0x6a4,0x0,0x0}}},
+{0xfb6c,{{0x6a4,0x0,0x0}}},
+{0xfb6d,{{0x6a4,0x0,0x0}}},
+{0xfb6e,{{0x6a6,0x0,0x0}}},
+{0xfb6f,{{0x6a6,0x0,0x0}}},
+{0xfb70,{{0x6a6,0x0,0x0}}},
+{0xfb71,{{0x6a6,0x0,0x0}}},
+{0xfb72,{{0x684,0x0,0x0}}},
+{0xfb73,{{0x684,0x0,0x0}}},
+{0xfb74,{{0x684,0x0,0x0}}},
+{0xfb75,{{0x684,0x0,0x0}}},
+{0xfb76,{{0x683,0x0,0x0}}},
+{0xfb77,{{0x683,0x0,0x0}}},
+{0xfb78,{{0x683,0x0,0x0}}},
+{0xfb79,{{0x683,0x0,0x0}}},
+{0xfb7a,{{0x686,0x0,0x0}}},
+{0xfb7b,{{0x686,0x0,0x0}}},
+{0xfb7c,{{0x686,0x0,0x0}}},
+{0xfb7d,{{0x686,0x0,0x0}}},
+{0xfb7e,{{0x687,0x0,0x0}}},
+{0xfb7f,{{0x687,0x0,0x0}}},
+{0xfb80,{{0x687,0x0,0x0}}},
+{0xfb81,{{0x687,0x0,0x0}}},
+{0xfb82,{{0x68d,0x0,0x0}}},
+{0xfb83,{{0x68d,0x0,0x0}}},
+{0xfb84,{{0x68c,0x0,0x0}}},
+{0xfb85,{{0x68c,0x0,0x0}}},
+{0xfb86,{{0x68e,0x0,0x0}}},
+{0xfb87,{{0x68e,0x0,0x0}}},
+{0xfb88,{{0x688,0x0,0x0}}},
+{0xfb89,{{0x688,0x0,0x0}}},
+{0xfb8a,{{0x698,0x0,0x0}}},
+{0xfb8b,{{0x698,0x0,0x0}}},
+{0xfb8c,{{0x691,0x0,0x0}}},
+{0xfb8d,{{0x691,0x0,0x0}}},
+{0xfb8e,{{0x6a9,0x0,0x0}}},
+{0xfb8f,{{0x6a9,0x0,0x0}}},
+{0xfb90,{{0x6a9,0x0,0x0}}},
+{0xfb91,{{0x6a9,0x0,0x0}}},
+{0xfb92,{{0x6af,0x0,0x0}}},
+{0xfb93,{{0x6af,0x0,0x0}}},
+{0xfb94,{{0x6af,0x0,0x0}}},
+{0xfb95,{{0x6af,0x0,0x0}}},
+{0xfb96,{{0x6b3,0x0,0x0}}},
+{0xfb97,{{0x6b3,0x0,0x0}}},
+{0xfb98,{{0x6b3,0x0,0x0}}},
+{0xfb99,{{0x6b3,0x0,0x0}}},
+{0xfb9a,{{0x6b1,0x0,0x0}}},
+{0xfb9b,{{0x6b1,0x0,0x0}}},
+{0xfb9c,{{0x6b1,0x0,0x0}}},
+{0xfb9d,{{0x6b1,0x0,0x0}}},
+{0xfb9e,{{0x6ba,0x0,0x0}}},
+{0xfb9f,{{0x6ba,0x0,0x0}}},
+{0xfba0,{{0x6bb,0x0,0x0}}},
+{0xfba1,{{0x6bb,0x0,0x0}}},
+{0xfba2,{{0x6bb,0x0,0x0}}},
+{0xfba3,{{0x6bb,0x0,0x0}}},
+{0xfba4,{{0x6c0,0x0,0x0}}},
+{0xfba5,{{0x6c0,0x0,0x0}}},
+{0xfba6,{{0x6c1,0x0,0x0}}},
+{0xfba7,{{0x6c1,0x0,0x0}}},
+{0xfba8,{{0x6c1,0x0,0x0}}},
+{0xfba9,{{0x6c1,0x0,0x0}}},
+{0xfbaa,{{0x6be,0x0,0x0}}},
+{0xfbab,{{0x6be,0x0,0x0}}},
+{0xfbac,{{0x6be,0x0,0x0}}},
+{0xfbad,{{0x6be,0x0,0x0}}},
+{0xfbae,{{0x6d2,0x0,0x0}}},
+{0xfbaf,{{0x6d2,0x0,0x0}}},
+{0xfbb0,{{0x6d3,0x0,0x0}}},
+{0xfbb1,{{0x6d3,0x0,0x0}}},
+{0xfbd3,{{0x6ad,0x0,0x0}}},
+{0xfbd4,{{0x6ad,0x0,0x0}}},
+{0xfbd5,{{0x6ad,0x0,0x0}}},
+{0xfbd6,{{0x6ad,0x0,0x0}}},
+{0xfbd7,{{0x6c7,0x0,0x0}}},
+{0xfbd8,{{0x6c7,0x0,0x0}}},
+{0xfbd9,{{0x6c6,0x0,0x0}}},
+{0xfbda,{{0x6c6,0x0,0x0}}},
+{0xfbdb,{{0x6c8,0x0,0x0}}},
+{0xfbdc,{{0x6c8,0x0,0x0}}},
+{0xfbdd,{{0x6c7,0x674,0x0}}},
+{0xfbde,{{0x6cb,0x0,0x0}}},
+{0xfbdf,{{0x6cb,0x0,0x0}}},
+{0xfbe0,{{0x6c5,0x0,0x0}}},
+{0xfbe1,{{0x6c5,0x0,0x0}}},
+{0xfbe2,{{0x6c9,0x0,0x0}}},
+{0xfbe3,{{0x6c9,0x0,0x0}}},
+{0xfbe4,{{0x6d0,0x0,0x0}}},
+{0xfbe5,{{0x6d0,0x0,0x0}}},
+{0xfbe6,{{0x6d0,0x0,0x0}}},
+{0xfbe7,{{0x6d0,0x0,0x0}}},
+{0xfbe8,{{0x649,0x0,0x0}}},
+{0xfbe9,{{0x649,0x0,0x0}}},
+{0xfbea,{{0x626,0x627,0x0}}},
+{0xfbeb,{{0x626,0x627,0x0}}},
+{0xfbec,{{0x626,0x6d5,0x0}}},
+{0xfbed,{{0x626,0x6d5,0x0}}},
+{0xfbee,{{0x626,0x648,0x0}}},
+{0xfbef,{{0x626,0x648,0x0}}},
+{0xfbf0,{{0x626,0x6c7,0x0}}},
+{0xfbf1,{{0x626,0x6c7,0x0}}},
+{0xfbf2,{{0x626,0x6c6,0x0}}},
+{0xfbf3,{{0x626,0x6c6,0x0}}},
+{0xfbf4,{{0x626,0x6c8,0x0}}},
+{0xfbf5,{{0x626,0x6c8,0x0}}},
+{0xfbf6,{{0x626,0x6d0,0x0}}},
+{0xfbf7,{{0x626,0x6d0,0x0}}},
+{0xfbf8,{{0x626,0x6d0,0x0}}},
+{0xfbf9,{{0x626,0x649,0x0}}},
+{0xfbfa,{{0x626,0x649,0x0}}},
+{0xfbfb,{{0x626,0x649,0x0}}},
+{0xfbfc,{{0x6cc,0x0,0x0}}},
+{0xfbfd,{{0x6cc,0x0,0x0}}},
+{0xfbfe,{{0x6cc,0x0,0x0}}},
+{0xfbff,{{0x6cc,0x0,0x0}}},
+{0xfc00,{{0x626,0x62c,0x0}}},
+{0xfc01,{{0x626,0x62d,0x0}}},
+{0xfc02,{{0x626,0x645,0x0}}},
+{0xfc03,{{0x626,0x649,0x0}}},
+{0xfc04,{{0x626,0x64a,0x0}}},
+{0xfc05,{{0x628,0x62c,0x0}}},
+{0xfc06,{{0x628,0x62d,0x0}}},
+{0xfc07,{{0x628,0x62e,0x0}}},
+{0xfc08,{{0x628,0x645,0x0}}},
+{0xfc09,{{0x628,0x649,0x0}}},
+{0xfc0a,{{0x628,0x64a,0x0}}},
+{0xfc0b,{{0x62a,0x62c,0x0}}},
+{0xfc0c,{{0x62a,0x62d,0x0}}},
+{0xfc0d,{{0x62a,0x62e,0x0}}},
+{0xfc0e,{{0x62a,0x645,0x0}}},
+{0xfc0f,{{0x62a,0x649,0x0}}},
+{0xfc10,{{0x62a,0x64a,0x0}}},
+{0xfc11,{{0x62b,0x62c,0x0}}},
+{0xfc12,{{0x62b,0x645,0x0}}},
+{0xfc13,{{0x62b,0x649,0x0}}},
+{0xfc14,{{0x62b,0x64a,0x0}}},
+{0xfc15,{{0x62c,0x62d,0x0}}},
+{0xfc16,{{0x62c,0x645,0x0}}},
+{0xfc17,{{0x62d,0x62c,0x0}}},
+{0xfc18,{{0x62d,0x645,0x0}}},
+{0xfc19,{{0x62e,0x62c,0x0}}},
+{0xfc1a,{{0x62e,0x62d,0x0}}},
+{0xfc1b,{{0x62e,0x645,0x0}}},
+{0xfc1c,{{0x633,0x62c,0x0}}},
+{0xfc1d,{{0x633,0x62d,0x0}}},
+{0xfc1e,{{0x633,0x62e,0x0}}},
+{0xfc1f,{{0x633,0x645,0x0}}},
+{0xfc20,{{0x635,0x62d,0x0}}},
+{0xfc21,{{0x635,0x645,0x0}}},
+{0xfc22,{{0x636,0x62c,0x0}}},
+{0xfc23,{{0x636,0x62d,0x0}}},
+{0xfc24,{{0x636,0x62e,0x0}}},
+{0xfc25,{{0x636,0x645,0x0}}},
+{0xfc26,{{0x637,0x62d,0x0}}},
+{0xfc27,{{0x637,0x645,0x0}}},
+{0xfc28,{{0x638,0x645,0x0}}},
+{0xfc29,{{0x639,0x62c,0x0}}},
+{0xfc2a,{{0x639,0x645,0x0}}},
+{0xfc2b,{{0x63a,0x62c,0x0}}},
+{0xfc2c,{{0x63a,0x645,0x0}}},
+{0xfc2d,{{0x641,0x62c,0x0}}},
+{0xfc2e,{{0x641,0x62d,0x0}}},
+{0xfc2f,{{0x641,0x62e,0x0}}},
+{0xfc30,{{0x641,0x645,0x0}}},
+{0xfc31,{{0x641,0x649,0x0}}},
+{0xfc32,{{0x641,0x64a,0x0}}},
+{0xfc33,{{0x642,0x62d,0x0}}},
+{0xfc34,{{0x642,0x645,0x0}}},
+{0xfc35,{{0x642,0x649,0x0}}},
+{0xfc36,{{0x642,0x64a,0x0}}},
+{0xfc37,{{0x643,0x627,0x0}}},
+{0xfc38,{{0x643,0x62c,0x0}}},
+{0xfc39,{{0x643,0x62d,0x0}}},
+{0xfc3a,{{0x643,0x62e,0x0}}},
+{0xfc3b,{{0x643,0x644,0x0}}},
+{0xfc3c,{{0x643,0x645,0x0}}},
+{0xfc3d,{{0x643,0x649,0x0}}},
+{0xfc3e,{{0x643,0x64a,0x0}}},
+{0xfc3f,{{0x644,0x62c,0x0}}},
+{0xfc40,{{0x644,0x62d,0x0}}},
+{0xfc41,{{0x644,0x62e,0x0}}},
+{0xfc42,{{0x644,0x645,0x0}}},
+{0xfc43,{{0x644,0x649,0x0}}},
+{0xfc44,{{0x644,0x64a,0x0}}},
+{0xfc45,{{0x645,0x62c,0x0}}},
+{0xfc46,{{0x645,0x62d,0x0}}},
+{0xfc47,{{0x645,0x62e,0x0}}},
+{0xfc48,{{0x645,0x645,0x0}}},
+{0xfc49,{{0x645,0x649,0x0}}},
+{0xfc4a,{{0x645,0x64a,0x0}}},
+{0xfc4b,{{0x646,0x62c,0x0}}},
+{0xfc4c,{{0x646,0x62d,0x0}}},
+{0xfc4d,{{0x646,0x62e,0x0}}},
+{0xfc4e,{{0x646,0x645,0x0}}},
+{0xfc4f,{{0x646,0x649,0x0}}},
+{0xfc50,{{0x646,0x64a,0x0}}},
+{0xfc51,{{0x647,0x62c,0x0}}},
+{0xfc52,{{0x647,0x645,0x0}}},
+{0xfc53,{{0x647,0x649,0x0}}},
+{0xfc54,{{0x647,0x64a,0x0}}},
+{0xfc55,{{0x64a,0x62c,0x0}}},
+{0xfc56,{{0x64a,0x62d,0x0}}},
+{0xfc57,{{0x64a,0x62e,0x0}}},
+{0xfc58,{{0x64a,0x645,0x0}}},
+{0xfc59,{{0x64a,0x649,0x0}}},
+{0xfc5a,{{0x64a,0x64a,0x0}}},
+{0xfc5b,{{0x630,0x670,0x0}}},
+{0xfc5c,{{0x631,0x670,0x0}}},
+{0xfc5d,{{0x649,0x670,0x0}}},
+{0xfc5e,{{0x20,0x64c,0x651}}},
+{0xfc5f,{{0x20,0x64d,0x651}}},
+{0xfc60,{{0x20,0x64e,0x651}}},
+{0xfc61,{{0x20,0x64f,0x651}}},
+{0xfc62,{{0x20,0x650,0x651}}},
+{0xfc63,{{0x20,0x651,0x670}}},
+{0xfc64,{{0x626,0x631,0x0}}},
+{0xfc65,{{0x626,0x632,0x0}}},
+{0xfc66,{{0x626,0x645,0x0}}},
+{0xfc67,{{0x626,0x646,0x0}}},
+{0xfc68,{{0x626,0x649,0x0}}},
+{0xfc69,{{0x626,0x64a,0x0}}},
+{0xfc6a,{{0x628,0x631,0x0}}},
+{0xfc6b,{{0x628,0x632,0x0}}},
+{0xfc6c,{{0x628,0x645,0x0}}},
+{0xfc6d,{{0x628,0x646,0x0}}},
+{0xfc6e,{{0x628,0x649,0x0}}},
+{0xfc6f,{{0x628,0x64a,0x0}}},
+{0xfc70,{{0x62a,0x631,0x0}}},
+{0xfc71,{{0x62a,0x632,0x0}}},
+{0xfc72,{{0x62a,0x645,0x0}}},
+{0xfc73,{{0x62a,0x646,0x0}}},
+{0xfc74,{{0x62a,0x649,0x0}}},
+{0xfc75,{{0x62a,0x64a,0x0}}},
+{0xfc76,{{0x62b,0x631,0x0}}},
+{0xfc77,{{0x62b,0x632,0x0}}},
+{0xfc78,{{0x62b,0x645,0x0}}},
+{0xfc79,{{0x62b,0x646,0x0}}},
+{0xfc7a,{{0x62b,0x649,0x0}}},
+{0xfc7b,{{0x62b,0x64a,0x0}}},
+{0xfc7c,{{0x641,0x649,0x0}}},
+{0xfc7d,{{0x641,0x64a,0x0}}},
+{0xfc7e,{{0x642,0x649,0x0}}},
+{0xfc7f,{{0x642,0x64a,0x0}}},
+{0xfc80,{{0x643,0x627,0x0}}},
+{0xfc81,{{0x643,0x644,0x0}}},
+{0xfc82,{{0x643,0x645,0x0}}},
+{0xfc83,{{0x643,0x649,0x0}}},
+{0xfc84,{{0x643,0x64a,0x0}}},
+{0xfc85,{{0x644,0x645,0x0}}},
+{0xfc86,{{0x644,0x649,0x0}}},
+{0xfc87,{{0x644,0x64a,0x0}}},
+{0xfc88,{{0x645,0x627,0x0}}},
+{0xfc89,{{0x645,0x645,0x0}}},
+{0xfc8a,{{0x646,0x631,0x0}}},
+{0xfc8b,{{0x646,0x632,0x0}}},
+{0xfc8c,{{0x646,0x645,0x0}}},
+{0xfc8d,{{0x646,0x646,0x0}}},
+{0xfc8e,{{0x646,0x649,0x0}}},
+{0xfc8f,{{0x646,0x64a,0x0}}},
+{0xfc90,{{0x649,0x670,0x0}}},
+{0xfc91,{{0x64a,0x631,0x0}}},
+{0xfc92,{{0x64a,0x632,0x0}}},
+{0xfc93,{{0x64a,0x645,0x0}}},
+{0xfc94,{{0x64a,0x646,0x0}}},
+{0xfc95,{{0x64a,0x649,0x0}}},
+{0xfc96,{{0x64a,0x64a,0x0}}},
+{0xfc97,{{0x626,0x62c,0x0}}},
+{0xfc98,{{0x626,0x62d,0x0}}},
+{0xfc99,{{0x626,0x62e,0x0}}},
+{0xfc9a,{{0x626,0x645,0x0}}},
+{0xfc9b,{{0x626,0x647,0x0}}},
+{0xfc9c,{{0x628,0x62c,0x0}}},
+{0xfc9d,{{0x628,0x62d,0x0}}},
+{0xfc9e,{{0x628,0x62e,0x0}}},
+{0xfc9f,{{0x628,0x645,0x0}}},
+{0xfca0,{{0x628,0x647,0x0}}},
+{0xfca1,{{0x62a,0x62c,0x0}}},
+{0xfca2,{{0x62a,0x62d,0x0}}},
+{0xfca3,{{0x62a,0x62e,0x0}}},
+{0xfca4,{{0x62a,0x645,0x0}}},
+{0xfca5,{{0x62a,0x647,0x0}}},
+{0xfca6,{{0x62b,0x645,0x0}}},
+{0xfca7,{{0x62c,0x62d,0x0}}},
+{0xfca8,{{0x62c,0x645,0x0}}},
+{0xfca9,{{0x62d,0x62c,0x0}}},
+{0xfcaa,{{0x62d,0x645,0x0}}},
+{0xfcab,{{0x62e,0x62c,0x0}}},
+{0xfcac,{{0x62e,0x645,0x0}}},
+{0xfcad,{{0x633,0x62c,0x0}}},
+{0xfcae,{{0x633,0x62d,0x0}}},
+{0xfcaf,{{0x633,0x62e,0x0}}},
+{0xfcb0,{{0x633,0x645,0x0}}},
+{0xfcb1,{{0x635,0x62d,0x0}}},
+{0xfcb2,{{0x635,0x62e,0x0}}},
+{0xfcb3,{{0x635,0x645,0x0}}},
+{0xfcb4,{{0x636,0x62c,0x0}}},
+{0xfcb5,{{0x636,0x62d,0x0}}},
+{0xfcb6,{{0x636,0x62e,0x0}}},
+{0xfcb7,{{0x636,0x645,0x0}}},
+{0xfcb8,{{0x637,0x62d,0x0}}},
+{0xfcb9,{{0x638,0x645,0x0}}},
+{0xfcba,{{0x639,0x62c,0x0}}},
+{0xfcbb,{{0x639,0x645,0x0}}},
+{0xfcbc,{{0x63a,0x62c,0x0}}},
+{0xfcbd,{{0x63a,0x645,0x0}}},
+{0xfcbe,{{0x641,0x62c,0x0}}},
+{0xfcbf,{{0x641,0x62d,0x0}}},
+{0xfcc0,{{0x641,0x62e,0x0}}},
+{0xfcc1,{{0x641,0x645,0x0}}},
+{0xfcc2,{{0x642,0x62d,0x0}}},
+{0xfcc3,{{0x642,0x645,0x0}}},
+{0xfcc4,{{0x643,0x62c,0x0}}},
+{0xfcc5,{{0x643,0x62d,0x0}}},
+{0xfcc6,{{0x643,0x62e,0x0}}},
+{0xfcc7,{{0x643,0x644,0x0}}},
+{0xfcc8,{{0x643,0x645,0x0}}},
+{0xfcc9,{{0x644,0x62c,0x0}}},
+{0xfcca,{{0x644,0x62d,0x0}}},
+{0xfccb,{{0x644,0x62e,0x0}}},
+{0xfccc,{{0x644,0x645,0x0}}},
+{0xfccd,{{0x644,0x647,0x0}}},
+{0xfcce,{{0x645,0x62c,0x0}}},
+{0xfccf,{{0x645,0x62d,0x0}}},
+{0xfcd0,{{0x645,0x62e,0x0}}},
+{0xfcd1,{{0x645,0x645,0x0}}},
+{0xfcd2,{{0x646,0x62c,0x0}}},
+{0xfcd3,{{0x646,0x62d,0x0}}},
+{0xfcd4,{{0x646,0x62e,0x0}}},
+{0xfcd5,{{0x646,0x645,0x0}}},
+{0xfcd6,{{0x646,0x647,0x0}}},
+{0xfcd7,{{0x647,0x62c,0x0}}},
+{0xfcd8,{{0x647,0x645,0x0}}},
+{0xfcd9,{{0x647,0x670,0x0}}},
+{0xfcda,{{0x64a,0x62c,0x0}}},
+{0xfcdb,{{0x64a,0x62d,0x0}}},
+{0xfcdc,{{0x64a,0x62e,0x0}}},
+{0xfcdd,{{0x64a,0x645,0x0}}},
+{0xfcde,{{0x64a,0x647,0x0}}},
+{0xfcdf,{{0x626,0x645,0x0}}},
+{0xfce0,{{0x626,0x647,0x0}}},
+{0xfce1,{{0x628,0x645,0x0}}},
+{0xfce2,{{0x628,0x647,0x0}}},
+{0xfce3,{{0x62a,0x645,0x0}}},
+{0xfce4,{{0x62a,0x647,0x0}}},
+{0xfce5,{{0x62b,0x645,0x0}}},
+{0xfce6,{{0x62b,0x647,0x0}}},
+{0xfce7,{{0x633,0x645,0x0}}},
+{0xfce8,{{0x633,0x647,0x0}}},
+{0xfce9,{{0x634,0x645,0x0}}},
+{0xfcea,{{0x634,0x647,0x0}}},
+{0xfceb,{{0x643,0x644,0x0}}},
+{0xfcec,{{0x643,0x645,0x0}}},
+{0xfced,{{0x644,0x645,0x0}}},
+{0xfcee,{{0x646,0x645,0x0}}},
+{0xfcef,{{0x646,0x647,0x0}}},
+{0xfcf0,{{0x64a,0x645,0x0}}},
+{0xfcf1,{{0x64a,0x647,0x0}}},
+{0xfcf2,{{0x640,0x64e,0x651}}},
+{0xfcf3,{{0x640,0x64f,0x651}}},
+{0xfcf4,{{0x640,0x650,0x651}}},
+{0xfcf5,{{0x637,0x649,0x0}}},
+{0xfcf6,{{0x637,0x64a,0x0}}},
+{0xfcf7,{{0x639,0x649,0x0}}},
+{0xfcf8,{{0x639,0x64a,0x0}}},
+{0xfcf9,{{0x63a,0x649,0x0}}},
+{0xfcfa,{{0x63a,0x64a,0x0}}},
+{0xfcfb,{{0x633,0x649,0x0}}},
+{0xfcfc,{{0x633,0x64a,0x0}}},
+{0xfcfd,{{0x634,0x649,0x0}}},
+{0xfcfe,{{0x634,0x64a,0x0}}},
+{0xfcff,{{0x62d,0x649,0x0}}},
+{0xfd00,{{0x62d,0x64a,0x0}}},
+{0xfd01,{{0x62c,0x649,0x0}}},
+{0xfd02,{{0x62c,0x64a,0x0}}},
+{0xfd03,{{0x62e,0x649,0x0}}},
+{0xfd04,{{0x62e,0x64a,0x0}}},
+{0xfd05,{{0x635,0x649,0x0}}},
+{0xfd06,{{0x635,0x64a,0x0}}},
+{0xfd07,{{0x636,0x649,0x0}}},
+{0xfd08,{{0x636,0x64a,0x0}}},
+{0xfd09,{{0x634,0x62c,0x0}}},
+{0xfd0a,{{0x634,0x62d,0x0}}},
+{0xfd0b,{{0x634,0x62e,0x0}}},
+{0xfd0c,{{0x634,0x645,0x0}}},
+{0xfd0d,{{0x634,0x631,0x0}}},
+{0xfd0e,{{0x633,0x631,0x0}}},
+{0xfd0f,{{0x635,0x631,0x0}}},
+{0xfd10,{{0x636,0x631,0x0}}},
+{0xfd11,{{0x637,0x649,0x0}}},
+{0xfd12,{{0x637,0x64a,0x0}}},
+{0xfd13,{{0x639,0x649,0x0}}},
+{0xfd14,{{0x639,0x64a,0x0}}},
+{0xfd15,{{0x63a,0x649,0x0}}},
+{0xfd16,{{0x63a,0x64a,0x0}}},
+{0xfd17,{{0x633,0x649,0x0}}},
+{0xfd18,{{0x633,0x64a,0x0}}},
+{0xfd19,{{0x634,0x649,0x0}}},
+{0xfd1a,{{0x634,0x64a,0x0}}},
+{0xfd1b,{{0x62d,0x649,0x0}}},
+{0xfd1c,{{0x62d,0x64a,0x0}}},
+{0xfd1d,{{0x62c,0x649,0x0}}},
+{0xfd1e,{{0x62c,0x64a,0x0}}},
+{0xfd1f,{{0x62e,0x649,0x0}}},
+{0xfd20,{{0x62e,0x64a,0x0}}},
+{0xfd21,{{0x635,0x649,0x0}}},
+{0xfd22,{{0x635,0x64a,0x0}}},
+{0xfd23,{{0x636,0x649,0x0}}},
+{0xfd24,{{0x636,0x64a,0x0}}},
+{0xfd25,{{0x634,0x62c,0x0}}},
+{0xfd26,{{0x634,0x62d,0x0}}},
+{0xfd27,{{0x634,0x62e,0x0}}},
+{0xfd28,{{0x634,0x645,0x0}}},
+{0xfd29,{{0x634,0x631,0x0}}},
+{0xfd2a,{{0x633,0x631,0x0}}},
+{0xfd2b,{{0x635,0x631,0x0}}},
+{0xfd2c,{{0x636,0x631,0x0}}},
+{0xfd2d,{{0x634,0x62c,0x0}}},
+{0xfd2e,{{0x634,0x62d,0x0}}},
+{0xfd2f,{{0x634,0x62e,0x0}}},
+{0xfd30,{{0x634,0x645,0x0}}},
+{0xfd31,{{0x633,0x647,0x0}}},
+{0xfd32,{{0x634,0x647,0x0}}},
+{0xfd33,{{0x637,0x645,0x0}}},
+{0xfd34,{{0x633,0x62c,0x0}}},
+{0xfd35,{{0x633,0x62d,0x0}}},
+{0xfd36,{{0x633,0x62e,0x0}}},
+{0xfd37,{{0x634,0x62c,0x0}}},
+{0xfd38,{{0x634,0x62d,0x0}}},
+{0xfd39,{{0x634,0x62e,0x0}}},
+{0xfd3a,{{0x637,0x645,0x0}}},
+{0xfd3b,{{0x638,0x645,0x0}}},
+{0xfd3c,{{0x627,0x64b,0x0}}},
+{0xfd3d,{{0x627,0x64b,0x0}}},
+{0xfd50,{{0x62a,0x62c,0x645}}},
+{0xfd51,{{0x62a,0x62d,0x62c}}},
+{0xfd52,{{0x62a,0x62d,0x62c}}},
+{0xfd53,{{0x62a,0x62d,0x645}}},
+{0xfd54,{{0x62a,0x62e,0x645}}},
+{0xfd55,{{0x62a,0x645,0x62c}}},
+{0xfd56,{{0x62a,0x645,0x62d}}},
+{0xfd57,{{0x62a,0x645,0x62e}}},
+{0xfd58,{{0x62c,0x645,0x62d}}},
+{0xfd59,{{0x62c,0x645,0x62d}}},
+{0xfd5a,{{0x62d,0x645,0x64a}}},
+{0xfd5b,{{0x62d,0x645,0x649}}},
+{0xfd5c,{{0x633,0x62d,0x62c}}},
+{0xfd5d,{{0x633,0x62c,0x62d}}},
+{0xfd5e,{{0x633,0x62c,0x649}}},
+{0xfd5f,{{0x633,0x645,0x62d}}},
+{0xfd60,{{0x633,0x645,0x62d}}},
+{0xfd61,{{0x633,0x645,0x62c}}},
+{0xfd62,{{0x633,0x645,0x645}}},
+{0xfd63,{{0x633,0x645,0x645}}},
+{0xfd64,{{0x635,0x62d,0x62d}}},
+{0xfd65,{{0x635,0x62d,0x62d}}},
+{0xfd66,{{0x635,0x645,0x645}}},
+{0xfd67,{{0x634,0x62d,0x645}}},
+{0xfd68,{{0x634,0x62d,0x645}}},
+{0xfd69,{{0x634,0x62c,0x64a}}},
+{0xfd6a,{{0x634,0x645,0x62e}}},
+{0xfd6b,{{0x634,0x645,0x62e}}},
+{0xfd6c,{{0x634,0x645,0x645}}},
+{0xfd6d,{{0x634,0x645,0x645}}},
+{0xfd6e,{{0x636,0x62d,0x649}}},
+{0xfd6f,{{0x636,0x62e,0x645}}},
+{0xfd70,{{0x636,0x62e,0x645}}},
+{0xfd71,{{0x637,0x645,0x62d}}},
+{0xfd72,{{0x637,0x645,0x62d}}},
+{0xfd73,{{0x637,0x645,0x645}}},
+{0xfd74,{{0x637,0x645,0x64a}}},
+{0xfd75,{{0x639,0x62c,0x645}}},
+{0xfd76,{{0x639,0x645,0x645}}},
+{0xfd77,{{0x639,0x645,0x645}}},
+{0xfd78,{{0x639,0x645,0x649}}},
+{0xfd79,{{0x63a,0x645,0x645}}},
+{0xfd7a,{{0x63a,0x645,0x64a}}},
+{0xfd7b,{{0x63a,0x645,0x649}}},
+{0xfd7c,{{0x641,0x62e,0x645}}},
+{0xfd7d,{{0x641,0x62e,0x645}}},
+{0xfd7e,{{0x642,0x645,0x62d}}},
+{0xfd7f,{{0x642,0x645,0x645}}},
+{0xfd80,{{0x644,0x62d,0x645}}},
+{0xfd81,{{0x644,0x62d,0x64a}}},
+{0xfd82,{{0x644,0x62d,0x649}}},
+{0xfd83,{{0x644,0x62c,0x62c}}},
+{0xfd84,{{0x644,0x62c,0x62c}}},
+{0xfd85,{{0x644,0x62e,0x645}}},
+{0xfd86,{{0x644,0x62e,0x645}}},
+{0xfd87,{{0x644,0x645,0x62d}}},
+{0xfd88,{{0x644,0x645,0x62d}}},
+{0xfd89,{{0x645,0x62d,0x62c}}},
+{0xfd8a,{{0x645,0x62d,0x645}}},
+{0xfd8b,{{0x645,0x62d,0x64a}}},
+{0xfd8c,{{0x645,0x62c,0x62d}}},
+{0xfd8d,{{0x645,0x62c,0x645}}},
+{0xfd8e,{{0x645,0x62e,0x62c}}},
+{0xfd8f,{{0x645,0x62e,0x645}}},
+{0xfd92,{{0x645,0x62c,0x62e}}},
+{0xfd93,{{0x647,0x645,0x62c}}},
+{0xfd94,{{0x647,0x645,0x645}}},
+{0xfd95,{{0x646,0x62d,0x645}}},
+{0xfd96,{{0x646,0x62d,0x649}}},
+{0xfd97,{{0x646,0x62c,0x645}}},
+{0xfd98,{{0x646,0x62c,0x645}}},
+{0xfd99,{{0x646,0x62c,0x649}}},
+{0xfd9a,{{0x646,0x645,0x64a}}},
+{0xfd9b,{{0x646,0x645,0x649}}},
+{0xfd9c,{{0x64a,0x645,0x645}}},
+{0xfd9d,{{0x64a,0x645,0x645}}},
+{0xfd9e,{{0x628,0x62e,0x64a}}},
+{0xfd9f,{{0x62a,0x62c,0x64a}}},
+{0xfda0,{{0x62a,0x62c,0x649}}},
+{0xfda1,{{0x62a,0x62e,0x64a}}},
+{0xfda2,{{0x62a,0x62e,0x649}}},
+{0xfda3,{{0x62a,0x645,0x64a}}},
+{0xfda4,{{0x62a,0x645,0x649}}},
+{0xfda5,{{0x62c,0x645,0x64a}}},
+{0xfda6,{{0x62c,0x62d,0x649}}},
+{0xfda7,{{0x62c,0x645,0x649}}},
+{0xfda8,{{0x633,0x62e,0x649}}},
+{0xfda9,{{0x635,0x62d,0x64a}}},
+{0xfdaa,{{0x634,0x62d,0x64a}}},
+{0xfdab,{{0x636,0x62d,0x64a}}},
+{0xfdac,{{0x644,0x62c,0x64a}}},
+{0xfdad,{{0x644,0x645,0x64a}}},
+{0xfdae,{{0x64a,0x62d,0x64a}}},
+{0xfdaf,{{0x64a,0x62c,0x64a}}},
+{0xfdb0,{{0x64a,0x645,0x64a}}},
+{0xfdb1,{{0x645,0x645,0x64a}}},
+{0xfdb2,{{0x642,0x645,0x64a}}},
+{0xfdb3,{{0x646,0x62d,0x64a}}},
+{0xfdb4,{{0x642,0x645,0x62d}}},
+{0xfdb5,{{0x644,0x62d,0x645}}},
+{0xfdb6,{{0x639,0x645,0x64a}}},
+{0xfdb7,{{0x643,0x645,0x64a}}},
+{0xfdb8,{{0x646,0x62c,0x62d}}},
+{0xfdb9,{{0x645,0x62e,0x64a}}},
+{0xfdba,{{0x644,0x62c,0x645}}},
+{0xfdbb,{{0x643,0x645,0x645}}},
+{0xfdbc,{{0x644,0x62c,0x645}}},
+{0xfdbd,{{0x646,0x62c,0x62d}}},
+{0xfdbe,{{0x62c,0x62d,0x64a}}},
+{0xfdbf,{{0x62d,0x62c,0x64a}}},
+{0xfdc0,{{0x645,0x62c,0x64a}}},
+{0xfdc1,{{0x641,0x645,0x64a}}},
+{0xfdc2,{{0x628,0x62d,0x64a}}},
+{0xfdc3,{{0x643,0x645,0x645}}},
+{0xfdc4,{{0x639,0x62c,0x645}}},
+{0xfdc5,{{0x635,0x645,0x645}}},
+{0xfdc6,{{0x633,0x62e,0x64a}}},
+{0xfdc7,{{0x646,0x62c,0x64a}}},
+{0xfdf0,{{0x635,0x644,0x6d2}}},
+{0xfdf1,{{0x642,0x644,0x6d2}}},
+{0xfdf9,{{0x635,0x644,0x649}}},
+{0xfe00,{{0x0,0x0,0x0}}},
+{0xfe01,{{0x0,0x0,0x0}}},
+{0xfe02,{{0x0,0x0,0x0}}},
+{0xfe03,{{0x0,0x0,0x0}}},
+{0xfe04,{{0x0,0x0,0x0}}},
+{0xfe05,{{0x0,0x0,0x0}}},
+{0xfe06,{{0x0,0x0,0x0}}},
+{0xfe07,{{0x0,0x0,0x0}}},
+{0xfe08,{{0x0,0x0,0x0}}},
+{0xfe09,{{0x0,0x0,0x0}}},
+{0xfe0a,{{0x0,0x0,0x0}}},
+{0xfe0b,{{0x0,0x0,0x0}}},
+{0xfe0c,{{0x0,0x0,0x0}}},
+{0xfe0d,{{0x0,0x0,0x0}}},
+{0xfe0e,{{0x0,0x0,0x0}}},
+{0xfe0f,{{0x0,0x0,0x0}}},
+{0xfe10,{{0x2c,0x0,0x0}}},
+{0xfe11,{{0x3001,0x0,0x0}}},
+{0xfe12,{{0x3002,0x0,0x0}}},
+{0xfe13,{{0x3a,0x0,0x0}}},
+{0xfe14,{{0x3b,0x0,0x0}}},
+{0xfe15,{{0x21,0x0,0x0}}},
+{0xfe16,{{0x3f,0x0,0x0}}},
+{0xfe17,{{0x3016,0x0,0x0}}},
+{0xfe18,{{0x3017,0x0,0x0}}},
+{0xfe19,{{0x2e,0x2e,0x2e}}},
+{0xfe30,{{0x2e,0x2e,0x0}}},
+{0xfe31,{{0x2014,0x0,0x0}}},
+{0xfe32,{{0x2013,0x0,0x0}}},
+{0xfe33,{{0x5f,0x0,0x0}}},
+{0xfe34,{{0x5f,0x0,0x0}}},
+{0xfe35,{{0x28,0x0,0x0}}},
+{0xfe36,{{0x29,0x0,0x0}}},
+{0xfe37,{{0x7b,0x0,0x0}}},
+{0xfe38,{{0x7d,0x0,0x0}}},
+{0xfe39,{{0x3014,0x0,0x0}}},
+{0xfe3a,{{0x3015,0x0,0x0}}},
+{0xfe3b,{{0x3010,0x0,0x0}}},
+{0xfe3c,{{0x3011,0x0,0x0}}},
+{0xfe3d,{{0x300a,0x0,0x0}}},
+{0xfe3e,{{0x300b,0x0,0x0}}},
+{0xfe3f,{{0x3008,0x0,0x0}}},
+{0xfe40,{{0x3009,0x0,0x0}}},
+{0xfe41,{{0x300c,0x0,0x0}}},
+{0xfe42,{{0x300d,0x0,0x0}}},
+{0xfe43,{{0x300e,0x0,0x0}}},
+{0xfe44,{{0x300f,0x0,0x0}}},
+{0xfe47,{{0x5b,0x0,0x0}}},
+{0xfe48,{{0x5d,0x0,0x0}}},
+{0xfe49,{{0x20,0x305,0x0}}},
+{0xfe4a,{{0x20,0x305,0x0}}},
+{0xfe4b,{{0x20,0x305,0x0}}},
+{0xfe4c,{{0x20,0x305,0x0}}},
+{0xfe4d,{{0x5f,0x0,0x0}}},
+{0xfe4e,{{0x5f,0x0,0x0}}},
+{0xfe4f,{{0x5f,0x0,0x0}}},
+{0xfe50,{{0x2c,0x0,0x0}}},
+{0xfe51,{{0x3001,0x0,0x0}}},
+{0xfe52,{{0x2e,0x0,0x0}}},
+{0xfe54,{{0x3b,0x0,0x0}}},
+{0xfe55,{{0x3a,0x0,0x0}}},
+{0xfe56,{{0x3f,0x0,0x0}}},
+{0xfe57,{{0x21,0x0,0x0}}},
+{0xfe58,{{0x2014,0x0,0x0}}},
+{0xfe59,{{0x28,0x0,0x0}}},
+{0xfe5a,{{0x29,0x0,0x0}}},
+{0xfe5b,{{0x7b,0x0,0x0}}},
+{0xfe5c,{{0x7d,0x0,0x0}}},
+{0xfe5d,{{0x3014,0x0,0x0}}},
+{0xfe5e,{{0x3015,0x0,0x0}}},
+{0xfe5f,{{0x23,0x0,0x0}}},
+{0xfe60,{{0x26,0x0,0x0}}},
+{0xfe61,{{0x2a,0x0,0x0}}},
+{0xfe62,{{0x2b,0x0,0x0}}},
+{0xfe63,{{0x2d,0x0,0x0}}},
+{0xfe64,{{0x3c,0x0,0x0}}},
+{0xfe65,{{0x3e,0x0,0x0}}},
+{0xfe66,{{0x3d,0x0,0x0}}},
+{0xfe68,{{0x5c,0x0,0x0}}},
+{0xfe69,{{0x24,0x0,0x0}}},
+{0xfe6a,{{0x25,0x0,0x0}}},
+{0xfe6b,{{0x40,0x0,0x0}}},
+{0xfe70,{{0x20,0x64b,0x0}}},
+{0xfe71,{{0x640,0x64b,0x0}}},
+{0xfe72,{{0x20,0x64c,0x0}}},
+{0xfe74,{{0x20,0x64d,0x0}}},
+{0xfe76,{{0x20,0x64e,0x0}}},
+{0xfe77,{{0x640,0x64e,0x0}}},
+{0xfe78,{{0x20,0x64f,0x0}}},
+{0xfe79,{{0x640,0x64f,0x0}}},
+{0xfe7a,{{0x20,0x650,0x0}}},
+{0xfe7b,{{0x640,0x650,0x0}}},
+{0xfe7c,{{0x20,0x651,0x0}}},
+{0xfe7d,{{0x640,0x651,0x0}}},
+{0xfe7e,{{0x20,0x652,0x0}}},
+{0xfe7f,{{0x640,0x652,0x0}}},
+{0xfe80,{{0x621,0x0,0x0}}},
+{0xfe81,{{0x622,0x0,0x0}}},
+{0xfe82,{{0x622,0x0,0x0}}},
+{0xfe83,{{0x623,0x0,0x0}}},
+{0xfe84,{{0x623,0x0,0x0}}},
+{0xfe85,{{0x624,0x0,0x0}}},
+{0xfe86,{{0x624,0x0,0x0}}},
+{0xfe87,{{0x625,0x0,0x0}}},
+{0xfe88,{{0x625,0x0,0x0}}},
+{0xfe89,{{0x626,0x0,0x0}}},
+{0xfe8a,{{0x626,0x0,0x0}}},
+{0xfe8b,{{0x626,0x0,0x0}}},
+{0xfe8c,{{0x626,0x0,0x0}}},
+{0xfe8d,{{0x627,0x0,0x0}}},
+{0xfe8e,{{0x627,0x0,0x0}}},
+{0xfe8f,{{0x628,0x0,0x0}}},
+{0xfe90,{{0x628,0x0,0x0}}},
+{0xfe91,{{0x628,0x0,0x0}}},
+{0xfe92,{{0x628,0x0,0x0}}},
+{0xfe93,{{0x629,0x0,0x0}}},
+{0xfe94,{{0x629,0x0,0x0}}},
+{0xfe95,{{0x62a,0x0,0x0}}},
+{0xfe96,{{0x62a,0x0,0x0}}},
+{0xfe97,{{0x62a,0x0,0x0}}},
+{0xfe98,{{0x62a,0x0,0x0}}},
+{0xfe99,{{0x62b,0x0,0x0}}},
+{0xfe9a,{{0x62b,0x0,0x0}}},
+{0xfe9b,{{0x62b,0x0,0x0}}},
+{0xfe9c,{{0x62b,0x0,0x0}}},
+{0xfe9d,{{0x62c,0x0,0x0}}},
+{0xfe9e,{{0x62c,0x0,0x0}}},
+{0xfe9f,{{0x62c,0x0,0x0}}},
+{0xfea0,{{0x62c,0x0,0x0}}},
+{0xfea1,{{0x62d,0x0,0x0}}},
+{0xfea2,{{0x62d,0x0,0x0}}},
+{0xfea3,{{0x62d,0x0,0x0}}},
+{0xfea4,{{0x62d,0x0,0x0}}},
+{0xfea5,{{0x62e,0x0,0x0}}},
+{0xfea6,{{0x62e,0x0,0x0}}},
+{0xfea7,{{0x62e,0x0,0x0}}},
+{0xfea8,{{0x62e,0x0,0x0}}},
+{0xfea9,{{0x62f,0x0,0x0}}},
+{0xfeaa,{{0x62f,0x0,0x0}}},
+{0xfeab,{{0x630,0x0,0x0}}},
+{0xfeac,{{0x630,0x0,0x0}}},
+{0xfead,{{0x631,0x0,0x0}}},
+{0xfeae,{{0x631,0x0,0x0}}},
+{0xfeaf,{{0x632,0x0,0x0}}},
+{0xfeb0,{{0x632,0x0,0x0}}},
+{0xfeb1,{{0x633,0x0,0x0}}},
+{0xfeb2,{{0x633,0x0,0x0}}},
+{0xfeb3,{{0x633,0x0,0x0}}},
+{0xfeb4,{{0x633,0x0,0x0}}},
+{0xfeb5,{{0x634,0x0,0x0}}},
+{0xfeb6,{{0x634,0x0,0x0}}},
+{0xfeb7,{{0x634,0x0,0x0}}},
+{0xfeb8,{{0x634,0x0,0x0}}},
+{0xfeb9,{{0x635,0x0,0x0}}},
+{0xfeba,{{0x635,0x0,0x0}}},
+{0xfebb,{{0x635,0x0,0x0}}},
+{0xfebc,{{0x635,0x0,0x0}}},
+{0xfebd,{{0x636,0x0,0x0}}},
+{0xfebe,{{0x636,0x0,0x0}}},
+{0xfebf,{{0x636,0x0,0x0}}},
+{0xfec0,{{0x636,0x0,0x0}}},
+{0xfec1,{{0x637,0x0,0x0}}},
+{0xfec2,{{0x637,0x0,0x0}}},
+{0xfec3,{{0x637,0x0,0x0}}},
+{0xfec4,{{0x637,0x0,0x0}}},
+{0xfec5,{{0x638,0x0,0x0}}},
+{0xfec6,{{0x638,0x0,0x0}}},
+{0xfec7,{{0x638,0x0,0x0}}},
+{0xfec8,{{0x638,0x0,0x0}}},
+{0xfec9,{{0x639,0x0,0x0}}},
+{0xfeca,{{0x639,0x0,0x0}}},
+{0xfecb,{{0x639,0x0,0x0}}},
+{0xfecc,{{0x639,0x0,0x0}}},
+{0xfecd,{{0x63a,0x0,0x0}}},
+{0xfece,{{0x63a,0x0,0x0}}},
+{0xfecf,{{0x63a,0x0,0x0}}},
+{0xfed0,{{0x63a,0x0,0x0}}},
+{0xfed1,{{0x641,0x0,0x0}}},
+{0xfed2,{{0x641,0x0,0x0}}},
+{0xfed3,{{0x641,0x0,0x0}}},
+{0xfed4,{{0x641,0x0,0x0}}},
+{0xfed5,{{0x642,0x0,0x0}}},
+{0xfed6,{{0x642,0x0,0x0}}},
+{0xfed7,{{0x642,0x0,0x0}}},
+{0xfed8,{{0x642,0x0,0x0}}},
+{0xfed9,{{0x643,0x0,0x0}}},
+{0xfeda,{{0x643,0x0,0x0}}},
+{0xfedb,{{0x643,0x0,0x0}}},
+{0xfedc,{{0x643,0x0,0x0}}},
+{0xfedd,{{0x644,0x0,0x0}}},
+{0xfede,{{0x644,0x0,0x0}}},
+{0xfedf,{{0x644,0x0,0x0}}},
+{0xfee0,{{0x644,0x0,0x0}}},
+{0xfee1,{{0x645,0x0,0x0}}},
+{0xfee2,{{0x645,0x0,0x0}}},
+{0xfee3,{{0x645,0x0,0x0}}},
+{0xfee4,{{0x645,0x0,0x0}}},
+{0xfee5,{{0x646,0x0,0x0}}},
+{0xfee6,{{0x646,0x0,0x0}}},
+{0xfee7,{{0x646,0x0,0x0}}},
+{0xfee8,{{0x646,0x0,0x0}}},
+{0xfee9,{{0x647,0x0,0x0}}},
+{0xfeea,{{0x647,0x0,0x0}}},
+{0xfeeb,{{0x647,0x0,0x0}}},
+{0xfeec,{{0x647,0x0,0x0}}},
+{0xfeed,{{0x648,0x0,0x0}}},
+{0xfeee,{{0x648,0x0,0x0}}},
+{0xfeef,{{0x649,0x0,0x0}}},
+{0xfef0,{{0x649,0x0,0x0}}},
+{0xfef1,{{0x64a,0x0,0x0}}},
+{0xfef2,{{0x64a,0x0,0x0}}},
+{0xfef3,{{0x64a,0x0,0x0}}},
+{0xfef4,{{0x64a,0x0,0x0}}},
+{0xfef5,{{0x644,0x622,0x0}}},
+{0xfef6,{{0x644,0x622,0x0}}},
+{0xfef7,{{0x644,0x623,0x0}}},
+{0xfef8,{{0x644,0x623,0x0}}},
+{0xfef9,{{0x644,0x625,0x0}}},
+{0xfefa,{{0x644,0x625,0x0}}},
+{0xfefb,{{0x644,0x627,0x0}}},
+{0xfefc,{{0x644,0x627,0x0}}},
+{0xfeff,{{0x0,0x0,0x0}}},
+{0xff01,{{0x21,0x0,0x0}}},
+{0xff02,{{0x22,0x0,0x0}}},
+{0xff03,{{0x23,0x0,0x0}}},
+{0xff04,{{0x24,0x0,0x0}}},
+{0xff05,{{0x25,0x0,0x0}}},
+{0xff06,{{0x26,0x0,0x0}}},
+{0xff07,{{0x27,0x0,0x0}}},
+{0xff08,{{0x28,0x0,0x0}}},
+{0xff09,{{0x29,0x0,0x0}}},
+{0xff0a,{{0x2a,0x0,0x0}}},
+{0xff0b,{{0x2b,0x0,0x0}}},
+{0xff0c,{{0x2c,0x0,0x0}}},
+{0xff0d,{{0x2d,0x0,0x0}}},
+{0xff0e,{{0x2e,0x0,0x0}}},
+{0xff0f,{{0x2f,0x0,0x0}}},
+{0xff10,{{0x30,0x0,0x0}}},
+{0xff11,{{0x31,0x0,0x0}}},
+{0xff12,{{0x32,0x0,0x0}}},
+{0xff13,{{0x33,0x0,0x0}}},
+{0xff14,{{0x34,0x0,0x0}}},
+{0xff15,{{0x35,0x0,0x0}}},
+{0xff16,{{0x36,0x0,0x0}}},
+{0xff17,{{0x37,0x0,0x0}}},
+{0xff18,{{0x38,0x0,0x0}}},
+{0xff19,{{0x39,0x0,0x0}}},
+{0xff1a,{{0x3a,0x0,0x0}}},
+{0xff1b,{{0x3b,0x0,0x0}}},
+{0xff1c,{{0x3c,0x0,0x0}}},
+{0xff1d,{{0x3d,0x0,0x0}}},
+{0xff1e,{{0x3e,0x0,0x0}}},
+{0xff1f,{{0x3f,0x0,0x0}}},
+{0xff20,{{0x40,0x0,0x0}}},
+{0xff21,{{0x61,0x0,0x0}}},
+{0xff22,{{0x62,0x0,0x0}}},
+{0xff23,{{0x63,0x0,0x0}}},
+{0xff24,{{0x64,0x0,0x0}}},
+{0xff25,{{0x65,0x0,0x0}}},
+{0xff26,{{0x66,0x0,0x0}}},
+{0xff27,{{0x67,0x0,0x0}}},
+{0xff28,{{0x68,0x0,0x0}}},
+{0xff29,{{0x69,0x0,0x0}}},
+{0xff2a,{{0x6a,0x0,0x0}}},
+{0xff2b,{{0x6b,0x0,0x0}}},
+{0xff2c,{{0x6c,0x0,0x0}}},
+{0xff2d,{{0x6d,0x0,0x0}}},
+{0xff2e,{{0x6e,0x0,0x0}}},
+{0xff2f,{{0x6f,0x0,0x0}}},
+{0xff30,{{0x70,0x0,0x0}}},
+{0xff31,{{0x71,0x0,0x0}}},
+{0xff32,{{0x72,0x0,0x0}}},
+{0xff33,{{0x73,0x0,0x0}}},
+{0xff34,{{0x74,0x0,0x0}}},
+{0xff35,{{0x75,0x0,0x0}}},
+{0xff36,{{0x76,0x0,0x0}}},
+{0xff37,{{0x77,0x0,0x0}}},
+{0xff38,{{0x78,0x0,0x0}}},
+{0xff39,{{0x79,0x0,0x0}}},
+{0xff3a,{{0x7a,0x0,0x0}}},
+{0xff3b,{{0x5b,0x0,0x0}}},
+{0xff3c,{{0x5c,0x0,0x0}}},
+{0xff3d,{{0x5d,0x0,0x0}}},
+{0xff3e,{{0x5e,0x0,0x0}}},
+{0xff3f,{{0x5f,0x0,0x0}}},
+{0xff40,{{0x60,0x0,0x0}}},
+{0xff41,{{0x61,0x0,0x0}}},
+{0xff42,{{0x62,0x0,0x0}}},
+{0xff43,{{0x63,0x0,0x0}}},
+{0xff44,{{0x64,0x0,0x0}}},
+{0xff45,{{0x65,0x0,0x0}}},
+{0xff46,{{0x66,0x0,0x0}}},
+{0xff47,{{0x67,0x0,0x0}}},
+{0xff48,{{0x68,0x0,0x0}}},
+{0xff49,{{0x69,0x0,0x0}}},
+{0xff4a,{{0x6a,0x0,0x0}}},
+{0xff4b,{{0x6b,0x0,0x0}}},
+{0xff4c,{{0x6c,0x0,0x0}}},
+{0xff4d,{{0x6d,0x0,0x0}}},
+{0xff4e,{{0x6e,0x0,0x0}}},
+{0xff4f,{{0x6f,0x0,0x0}}},
+{0xff50,{{0x70,0x0,0x0}}},
+{0xff51,{{0x71,0x0,0x0}}},
+{0xff52,{{0x72,0x0,0x0}}},
+{0xff53,{{0x73,0x0,0x0}}},
+{0xff54,{{0x74,0x0,0x0}}},
+{0xff55,{{0x75,0x0,0x0}}},
+{0xff56,{{0x76,0x0,0x0}}},
+{0xff57,{{0x77,0x0,0x0}}},
+{0xff58,{{0x78,0x0,0x0}}},
+{0xff59,{{0x79,0x0,0x0}}},
+{0xff5a,{{0x7a,0x0,0x0}}},
+{0xff5b,{{0x7b,0x0,0x0}}},
+{0xff5c,{{0x7c,0x0,0x0}}},
+{0xff5d,{{0x7d,0x0,0x0}}},
+{0xff5e,{{0x7e,0x0,0x0}}},
+{0xff5f,{{0x2985,0x0,0x0}}},
+{0xff60,{{0x2986,0x0,0x0}}},
+{0xff61,{{0x3002,0x0,0x0}}},
+{0xff62,{{0x300c,0x0,0x0}}},
+{0xff63,{{0x300d,0x0,0x0}}},
+{0xff64,{{0x3001,0x0,0x0}}},
+{0xff65,{{0x30fb,0x0,0x0}}},
+{0xff66,{{0x30f2,0x0,0x0}}},
+{0xff67,{{0x30a1,0x0,0x0}}},
+{0xff68,{{0x30a3,0x0,0x0}}},
+{0xff69,{{0x30a5,0x0,0x0}}},
+{0xff6a,{{0x30a7,0x0,0x0}}},
+{0xff6b,{{0x30a9,0x0,0x0}}},
+{0xff6c,{{0x30e3,0x0,0x0}}},
+{0xff6d,{{0x30e5,0x0,0x0}}},
+{0xff6e,{{0x30e7,0x0,0x0}}},
+{0xff6f,{{0x30c3,0x0,0x0}}},
+{0xff70,{{0x30fc,0x0,0x0}}},
+{0xff71,{{0x30a2,0x0,0x0}}},
+{0xff72,{{0x30a4,0x0,0x0}}},
+{0xff73,{{0x30a6,0x0,0x0}}},
+{0xff74,{{0x30a8,0x0,0x0}}},
+{0xff75,{{0x30aa,0x0,0x0}}},
+{0xff76,{{0x30ab,0x0,0x0}}},
+{0xff77,{{0x30ad,0x0,0x0}}},
+{0xff78,{{0x30af,0x0,0x0}}},
+{0xff79,{{0x30b1,0x0,0x0}}},
+{0xff7a,{{0x30b3,0x0,0x0}}},
+{0xff7b,{{0x30b5,0x0,0x0}}},
+{0xff7c,{{0x30b7,0x0,0x0}}},
+{0xff7d,{{0x30b9,0x0,0x0}}},
+{0xff7e,{{0x30bb,0x0,0x0}}},
+{0xff7f,{{0x30bd,0x0,0x0}}},
+{0xff80,{{0x30bf,0x0,0x0}}},
+{0xff81,{{0x30c1,0x0,0x0}}},
+{0xff82,{{0x30c4,0x0,0x0}}},
+{0xff83,{{0x30c6,0x0,0x0}}},
+{0xff84,{{0x30c8,0x0,0x0}}},
+{0xff85,{{0x30ca,0x0,0x0}}},
+{0xff86,{{0x30cb,0x0,0x0}}},
+{0xff87,{{0x30cc,0x0,0x0}}},
+{0xff88,{{0x30cd,0x0,0x0}}},
+{0xff89,{{0x30ce,0x0,0x0}}},
+{0xff8a,{{0x30cf,0x0,0x0}}},
+{0xff8b,{{0x30d2,0x0,0x0}}},
+{0xff8c,{{0x30d5,0x0,0x0}}},
+{0xff8d,{{0x30d8,0x0,0x0}}},
+{0xff8e,{{0x30db,0x0,0x0}}},
+{0xff8f,{{0x30de,0x0,0x0}}},
+{0xff90,{{0x30df,0x0,0x0}}},
+{0xff91,{{0x30e0,0x0,0x0}}},
+{0xff92,{{0x30e1,0x0,0x0}}},
+{0xff93,{{0x30e2,0x0,0x0}}},
+{0xff94,{{0x30e4,0x0,0x0}}},
+{0xff95,{{0x30e6,0x0,0x0}}},
+{0xff96,{{0x30e8,0x0,0x0}}},
+{0xff97,{{0x30e9,0x0,0x0}}},
+{0xff98,{{0x30ea,0x0,0x0}}},
+{0xff99,{{0x30eb,0x0,0x0}}},
+{0xff9a,{{0x30ec,0x0,0x0}}},
+{0xff9b,{{0x30ed,0x0,0x0}}},
+{0xff9c,{{0x30ef,0x0,0x0}}},
+{0xff9d,{{0x30f3,0x0,0x0}}},
+{0xff9e,{{0x3099,0x0,0x0}}},
+{0xff9f,{{0x309a,0x0,0x0}}},
+{0xffa0,{{0x0,0x0,0x0}}},
+{0xffa1,{{0x1100,0x0,0x0}}},
+{0xffa2,{{0x1101,0x0,0x0}}},
+{0xffa3,{{0x11aa,0x0,0x0}}},
+{0xffa4,{{0x1102,0x0,0x0}}},
+{0xffa5,{{0x11ac,0x0,0x0}}},
+{0xffa6,{{0x11ad,0x0,0x0}}},
+{0xffa7,{{0x1103,0x0,0x0}}},
+{0xffa8,{{0x1104,0x0,0x0}}},
+{0xffa9,{{0x1105,0x0,0x0}}},
+{0xffaa,{{0x11b0,0x0,0x0}}},
+{0xffab,{{0x11b1,0x0,0x0}}},
+{0xffac,{{0x11b2,0x0,0x0}}},
+{0xffad,{{0x11b3,0x0,0x0}}},
+{0xffae,{{0x11b4,0x0,0x0}}},
+{0xffaf,{{0x11b5,0x0,0x0}}},
+{0xffb0,{{0x111a,0x0,0x0}}},
+{0xffb1,{{0x1106,0x0,0x0}}},
+{0xffb2,{{0x1107,0x0,0x0}}},
+{0xffb3,{{0x1108,0x0,0x0}}},
+{0xffb4,{{0x1121,0x0,0x0}}},
+{0xffb5,{{0x1109,0x0,0x0}}},
+{0xffb6,{{0x110a,0x0,0x0}}},
+{0xffb7,{{0x110b,0x0,0x0}}},
+{0xffb8,{{0x110c,0x0,0x0}}},
+{0xffb9,{{0x110d,0x0,0x0}}},
+{0xffba,{{0x110e,0x0,0x0}}},
+{0xffbb,{{0x110f,0x0,0x0}}},
+{0xffbc,{{0x1110,0x0,0x0}}},
+{0xffbd,{{0x1111,0x0,0x0}}},
+{0xffbe,{{0x1112,0x0,0x0}}},
+{0xffc2,{{0x1161,0x0,0x0}}},
+{0xffc3,{{0x1162,0x0,0x0}}},
+{0xffc4,{{0x1163,0x0,0x0}}},
+{0xffc5,{{0x1164,0x0,0x0}}},
+{0xffc6,{{0x1165,0x0,0x0}}},
+{0xffc7,{{0x1166,0x0,0x0}}},
+{0xffca,{{0x1167,0x0,0x0}}},
+{0xffcb,{{0x1168,0x0,0x0}}},
+{0xffcc,{{0x1169,0x0,0x0}}},
+{0xffcd,{{0x116a,0x0,0x0}}},
+{0xffce,{{0x116b,0x0,0x0}}},
+{0xffcf,{{0x116c,0x0,0x0}}},
+{0xffd2,{{0x116d,0x0,0x0}}},
+{0xffd3,{{0x116e,0x0,0x0}}},
+{0xffd4,{{0x116f,0x0,0x0}}},
+{0xffd5,{{0x1170,0x0,0x0}}},
+{0xffd6,{{0x1171,0x0,0x0}}},
+{0xffd7,{{0x1172,0x0,0x0}}},
+{0xffda,{{0x1173,0x0,0x0}}},
+{0xffdb,{{0x1174,0x0,0x0}}},
+{0xffdc,{{0x1175,0x0,0x0}}},
+{0xffe0,{{0xa2,0x0,0x0}}},
+{0xffe1,{{0xa3,0x0,0x0}}},
+{0xffe2,{{0xac,0x0,0x0}}},
+{0xffe3,{{0x20,0x304,0x0}}},
+{0xffe4,{{0xa6,0x0,0x0}}},
+{0xffe5,{{0xa5,0x0,0x0}}},
+{0xffe6,{{0x20a9,0x0,0x0}}},
+{0xffe8,{{0x2502,0x0,0x0}}},
+{0xffe9,{{0x2190,0x0,0x0}}},
+{0xffea,{{0x2191,0x0,0x0}}},
+{0xffeb,{{0x2192,0x0,0x0}}},
+{0xffec,{{0x2193,0x0,0x0}}},
+{0xffed,{{0x25a0,0x0,0x0}}},
+{0xffee,{{0x25cb,0x0,0x0}}},
+{0xfff0,{{0x0,0x0,0x0}}},
+{0xfff1,{{0x0,0x0,0x0}}},
+{0xfff2,{{0x0,0x0,0x0}}},
+{0xfff3,{{0x0,0x0,0x0}}},
+{0xfff4,{{0x0,0x0,0x0}}},
+{0xfff5,{{0x0,0x0,0x0}}},
+{0xfff6,{{0x0,0x0,0x0}}},
+{0xfff7,{{0x0,0x0,0x0}}},
+{0xfff8,{{0x0,0x0,0x0}}},
+{0x10400,{{0x10428,0x0,0x0}}},
+{0x10401,{{0x10429,0x0,0x0}}},
+{0x10402,{{0x1042a,0x0,0x0}}},
+{0x10403,{{0x1042b,0x0,0x0}}},
+{0x10404,{{0x1042c,0x0,0x0}}},
+{0x10405,{{0x1042d,0x0,0x0}}},
+{0x10406,{{0x1042e,0x0,0x0}}},
+{0x10407,{{0x1042f,0x0,0x0}}},
+{0x10408,{{0x10430,0x0,0x0}}},
+{0x10409,{{0x10431,0x0,0x0}}},
+{0x1040a,{{0x10432,0x0,0x0}}},
+{0x1040b,{{0x10433,0x0,0x0}}},
+{0x1040c,{{0x10434,0x0,0x0}}},
+{0x1040d,{{0x10435,0x0,0x0}}},
+{0x1040e,{{0x10436,0x0,0x0}}},
+{0x1040f,{{0x10437,0x0,0x0}}},
+{0x10410,{{0x10438,0x0,0x0}}},
+{0x10411,{{0x10439,0x0,0x0}}},
+{0x10412,{{0x1043a,0x0,0x0}}},
+{0x10413,{{0x1043b,0x0,0x0}}},
+{0x10414,{{0x1043c,0x0,0x0}}},
+{0x10415,{{0x1043d,0x0,0x0}}},
+{0x10416,{{0x1043e,0x0,0x0}}},
+{0x10417,{{0x1043f,0x0,0x0}}},
+{0x10418,{{0x10440,0x0,0x0}}},
+{0x10419,{{0x10441,0x0,0x0}}},
+{0x1041a,{{0x10442,0x0,0x0}}},
+{0x1041b,{{0x10443,0x0,0x0}}},
+{0x1041c,{{0x10444,0x0,0x0}}},
+{0x1041d,{{0x10445,0x0,0x0}}},
+{0x1041e,{{0x10446,0x0,0x0}}},
+{0x1041f,{{0x10447,0x0,0x0}}},
+{0x10420,{{0x10448,0x0,0x0}}},
+{0x10421,{{0x10449,0x0,0x0}}},
+{0x10422,{{0x1044a,0x0,0x0}}},
+{0x10423,{{0x1044b,0x0,0x0}}},
+{0x10424,{{0x1044c,0x0,0x0}}},
+{0x10425,{{0x1044d,0x0,0x0}}},
+{0x10426,{{0x1044e,0x0,0x0}}},
+{0x10427,{{0x1044f,0x0,0x0}}},
+{0x104b0,{{0x104d8,0x0,0x0}}},
+{0x104b1,{{0x104d9,0x0,0x0}}},
+{0x104b2,{{0x104da,0x0,0x0}}},
+{0x104b3,{{0x104db,0x0,0x0}}},
+{0x104b4,{{0x104dc,0x0,0x0}}},
+{0x104b5,{{0x104dd,0x0,0x0}}},
+{0x104b6,{{0x104de,0x0,0x0}}},
+{0x104b7,{{0x104df,0x0,0x0}}},
+{0x104b8,{{0x104e0,0x0,0x0}}},
+{0x104b9,{{0x104e1,0x0,0x0}}},
+{0x104ba,{{0x104e2,0x0,0x0}}},
+{0x104bb,{{0x104e3,0x0,0x0}}},
+{0x104bc,{{0x104e4,0x0,0x0}}},
+{0x104bd,{{0x104e5,0x0,0x0}}},
+{0x104be,{{0x104e6,0x0,0x0}}},
+{0x104bf,{{0x104e7,0x0,0x0}}},
+{0x104c0,{{0x104e8,0x0,0x0}}},
+{0x104c1,{{0x104e9,0x0,0x0}}},
+{0x104c2,{{0x104ea,0x0,0x0}}},
+{0x104c3,{{0x104eb,0x0,0x0}}},
+{0x104c4,{{0x104ec,0x0,0x0}}},
+{0x104c5,{{0x104ed,0x0,0x0}}},
+{0x104c6,{{0x104ee,0x0,0x0}}},
+{0x104c7,{{0x104ef,0x0,0x0}}},
+{0x104c8,{{0x104f0,0x0,0x0}}},
+{0x104c9,{{0x104f1,0x0,0x0}}},
+{0x104ca,{{0x104f2,0x0,0x0}}},
+{0x104cb,{{0x104f3,0x0,0x0}}},
+{0x104cc,{{0x104f4,0x0,0x0}}},
+{0x104cd,{{0x104f5,0x0,0x0}}},
+{0x104ce,{{0x104f6,0x0,0x0}}},
+{0x104cf,{{0x104f7,0x0,0x0}}},
+{0x104d0,{{0x104f8,0x0,0x0}}},
+{0x104d1,{{0x104f9,0x0,0x0}}},
+{0x104d2,{{0x104fa,0x0,0x0}}},
+{0x104d3,{{0x104fb,0x0,0x0}}},
+{0x10570,{{0x10597,0x0,0x0}}},
+{0x10571,{{0x10598,0x0,0x0}}},
+{0x10572,{{0x10599,0x0,0x0}}},
+{0x10573,{{0x1059a,0x0,0x0}}},
+{0x10574,{{0x1059b,0x0,0x0}}},
+{0x10575,{{0x1059c,0x0,0x0}}},
+{0x10576,{{0x1059d,0x0,0x0}}},
+{0x10577,{{0x1059e,0x0,0x0}}},
+{0x10578,{{0x1059f,0x0,0x0}}},
+{0x10579,{{0x105a0,0x0,0x0}}},
+{0x1057a,{{0x105a1,0x0,0x0}}},
+{0x1057c,{{0x105a3,0x0,0x0}}},
+{0x1057d,{{0x105a4,0x0,0x0}}},
+{0x1057e,{{0x105a5,0x0,0x0}}},
+{0x1057f,{{0x105a6,0x0,0x0}}},
+{0x10580,{{0x105a7,0x0,0x0}}},
+{0x10581,{{0x105a8,0x0,0x0}}},
+{0x10582,{{0x105a9,0x0,0x0}}},
+{0x10583,{{0x105aa,0x0,0x0}}},
+{0x10584,{{0x105ab,0x0,0x0}}},
+{0x10585,{{0x105ac,0x0,0x0}}},
+{0x10586,{{0x105ad,0x0,0x0}}},
+{0x10587,{{0x105ae,0x0,0x0}}},
+{0x10588,{{0x105af,0x0,0x0}}},
+{0x10589,{{0x105b0,0x0,0x0}}},
+{0x1058a,{{0x105b1,0x0,0x0}}},
+{0x1058c,{{0x105b3,0x0,0x0}}},
+{0x1058d,{{0x105b4,0x0,0x0}}},
+{0x1058e,{{0x105b5,0x0,0x0}}},
+{0x1058f,{{0x105b6,0x0,0x0}}},
+{0x10590,{{0x105b7,0x0,0x0}}},
+{0x10591,{{0x105b8,0x0,0x0}}},
+{0x10592,{{0x105b9,0x0,0x0}}},
+{0x10594,{{0x105bb,0x0,0x0}}},
+{0x10595,{{0x105bc,0x0,0x0}}},
+{0x10781,{{0x2d0,0x0,0x0}}},
+{0x10782,{{0x2d1,0x0,0x0}}},
+{0x10783,{{0xe6,0x0,0x0}}},
+{0x10784,{{0x299,0x0,0x0}}},
+{0x10785,{{0x253,0x0,0x0}}},
+{0x10787,{{0x2a3,0x0,0x0}}},
+{0x10788,{{0xab66,0x0,0x0}}},
+{0x10789,{{0x2a5,0x0,0x0}}},
+{0x1078a,{{0x2a4,0x0,0x0}}},
+{0x1078b,{{0x256,0x0,0x0}}},
+{0x1078c,{{0x257,0x0,0x0}}},
+{0x1078d,{{0x1d91,0x0,0x0}}},
+{0x1078e,{{0x258,0x0,0x0}}},
+{0x1078f,{{0x25e,0x0,0x0}}},
+{0x10790,{{0x2a9,0x0,0x0}}},
+{0x10791,{{0x264,0x0,0x0}}},
+{0x10792,{{0x262,0x0,0x0}}},
+{0x10793,{{0x260,0x0,0x0}}},
+{0x10794,{{0x29b,0x0,0x0}}},
+{0x10795,{{0x127,0x0,0x0}}},
+{0x10796,{{0x29c,0x0,0x0}}},
+{0x10797,{{0x267,0x0,0x0}}},
+{0x10798,{{0x284,0x0,0x0}}},
+{0x10799,{{0x2aa,0x0,0x0}}},
+{0x1079a,{{0x2ab,0x0,0x0}}},
+{0x1079b,{{0x26c,0x0,0x0}}},
+{0x1079c,{{0x1df04,0x0,0x0}}},
+{0x1079d,{{0xa78e,0x0,0x0}}},
+{0x1079e,{{0x26e,0x0,0x0}}},
+{0x1079f,{{0x1df05,0x0,0x0}}},
+{0x107a0,{{0x28e,0x0,0x0}}},
+{0x107a1,{{0x1df06,0x0,0x0}}},
+{0x107a2,{{0xf8,0x0,0x0}}},
+{0x107a3,{{0x276,0x0,0x0}}},
+{0x107a4,{{0x277,0x0,0x0}}},
+{0x107a5,{{0x71,0x0,0x0}}},
+{0x107a6,{{0x27a,0x0,0x0}}},
+{0x107a7,{{0x1df08,0x0,0x0}}},
+{0x107a8,{{0x27d,0x0,0x0}}},
+{0x107a9,{{0x27e,0x0,0x0}}},
+{0x107aa,{{0x280,0x0,0x0}}},
+{0x107ab,{{0x2a8,0x0,0x0}}},
+{0x107ac,{{0x2a6,0x0,0x0}}},
+{0x107ad,{{0xab67,0x0,0x0}}},
+{0x107ae,{{0x2a7,0x0,0x0}}},
+{0x107af,{{0x288,0x0,0x0}}},
+{0x107b0,{{0x2c71,0x0,0x0}}},
+{0x107b2,{{0x28f,0x0,0x0}}},
+{0x107b3,{{0x2a1,0x0,0x0}}},
+{0x107b4,{{0x2a2,0x0,0x0}}},
+{0x107b5,{{0x298,0x0,0x0}}},
+{0x107b6,{{0x1c0,0x0,0x0}}},
+{0x107b7,{{0x1c1,0x0,0x0}}},
+{0x107b8,{{0x1c2,0x0,0x0}}},
+{0x107b9,{{0x1df0a,0x0,0x0}}},
+{0x107ba,{{0x1df1e,0x0,0x0}}},
+{0x10c80,{{0x10cc0,0x0,0x0}}},
+{0x10c81,{{0x10cc1,0x0,0x0}}},
+{0x10c82,{{0x10cc2,0x0,0x0}}},
+{0x10c83,{{0x10cc3,0x0,0x0}}},
+{0x10c84,{{0x10cc4,0x0,0x0}}},
+{0x10c85,{{0x10cc5,0x0,0x0}}},
+{0x10c86,{{0x10cc6,0x0,0x0}}},
+{0x10c87,{{0x10cc7,0x0,0x0}}},
+{0x10c88,{{0x10cc8,0x0,0x0}}},
+{0x10c89,{{0x10cc9,0x0,0x0}}},
+{0x10c8a,{{0x10cca,0x0,0x0}}},
+{0x10c8b,{{0x10ccb,0x0,0x0}}},
+{0x10c8c,{{0x10ccc,0x0,0x0}}},
+{0x10c8d,{{0x10ccd,0x0,0x0}}},
+{0x10c8e,{{0x10cce,0x0,0x0}}},
+{0x10c8f,{{0x10ccf,0x0,0x0}}},
+{0x10c90,{{0x10cd0,0x0,0x0}}},
+{0x10c91,{{0x10cd1,0x0,0x0}}},
+{0x10c92,{{0x10cd2,0x0,0x0}}},
+{0x10c93,{{0x10cd3,0x0,0x0}}},
+{0x10c94,{{0x10cd4,0x0,0x0}}},
+{0x10c95,{{0x10cd5,0x0,0x0}}},
+{0x10c96,{{0x10cd6,0x0,0x0}}},
+{0x10c97,{{0x10cd7,0x0,0x0}}},
+{0x10c98,{{0x10cd8,0x0,0x0}}},
+{0x10c99,{{0x10cd9,0x0,0x0}}},
+{0x10c9a,{{0x10cda,0x0,0x0}}},
+{0x10c9b,{{0x10cdb,0x0,0x0}}},
+{0x10c9c,{{0x10cdc,0x0,0x0}}},
+{0x10c9d,{{0x10cdd,0x0,0x0}}},
+{0x10c9e,{{0x10cde,0x0,0x0}}},
+{0x10c9f,{{0x10cdf,0x0,0x0}}},
+{0x10ca0,{{0x10ce0,0x0,0x0}}},
+{0x10ca1,{{0x10ce1,0x0,0x0}}},
+{0x10ca2,{{0x10ce2,0x0,0x0}}},
+{0x10ca3,{{0x10ce3,0x0,0x0}}},
+{0x10ca4,{{0x10ce4,0x0,0x0}}},
+{0x10ca5,{{0x10ce5,0x0,0x0}}},
+{0x10ca6,{{0x10ce6,0x0,0x0}}},
+{0x10ca7,{{0x10ce7,0x0,0x0}}},
+{0x10ca8,{{0x10ce8,0x0,0x0}}},
+{0x10ca9,{{0x10ce9,0x0,0x0}}},
+{0x10caa,{{0x10cea,0x0,0x0}}},
+{0x10cab,{{0x10ceb,0x0,0x0}}},
+{0x10cac,{{0x10cec,0x0,0x0}}},
+{0x10cad,{{0x10ced,0x0,0x0}}},
+{0x10cae,{{0x10cee,0x0,0x0}}},
+{0x10caf,{{0x10cef,0x0,0x0}}},
+{0x10cb0,{{0x10cf0,0x0,0x0}}},
+{0x10cb1,{{0x10cf1,0x0,0x0}}},
+{0x10cb2,{{0x10cf2,0x0,0x0}}},
+{0x10d50,{{0x10d70,0x0,0x0}}},
+{0x10d51,{{0x10d71,0x0,0x0}}},
+{0x10d52,{{0x10d72,0x0,0x0}}},
+{0x10d53,{{0x10d73,0x0,0x0}}},
+{0x10d54,{{0x10d74,0x0,0x0}}},
+{0x10d55,{{0x10d75,0x0,0x0}}},
+{0x10d56,{{0x10d76,0x0,0x0}}},
+{0x10d57,{{0x10d77,0x0,0x0}}},
+{0x10d58,{{0x10d78,0x0,0x0}}},
+{0x10d59,{{0x10d79,0x0,0x0}}},
+{0x10d5a,{{0x10d7a,0x0,0x0}}},
+{0x10d5b,{{0x10d7b,0x0,0x0}}},
+{0x10d5c,{{0x10d7c,0x0,0x0}}},
+{0x10d5d,{{0x10d7d,0x0,0x0}}},
+{0x10d5e,{{0x10d7e,0x0,0x0}}},
+{0x10d5f,{{0x10d7f,0x0,0x0}}},
+{0x10d60,{{0x10d80,0x0,0x0}}},
+{0x10d61,{{0x10d81,0x0,0x0}}},
+{0x10d62,{{0x10d82,0x0,0x0}}},
+{0x10d63,{{0x10d83,0x0,0x0}}},
+{0x10d64,{{0x10d84,0x0,0x0}}},
+{0x10d65,{{0x10d85,0x0,0x0}}},
+{0x118a0,{{0x118c0,0x0,0x0}}},
+{0x118a1,{{0x118c1,0x0,0x0}}},
+{0x118a2,{{0x118c2,0x0,0x0}}},
+{0x118a3,{{0x118c3,0x0,0x0}}},
+{0x118a4,{{0x118c4,0x0,0x0}}},
+{0x118a5,{{0x118c5,0x0,0x0}}},
+{0x118a6,{{0x118c6,0x0,0x0}}},
+{0x118a7,{{0x118c7,0x0,0x0}}},
+{0x118a8,{{0x118c8,0x0,0x0}}},
+{0x118a9,{{0x118c9,0x0,0x0}}},
+{0x118aa,{{0x118ca,0x0,0x0}}},
+{0x118ab,{{0x118cb,0x0,0x0}}},
+{0x118ac,{{0x118cc,0x0,0x0}}},
+{0x118ad,{{0x118cd,0x0,0x0}}},
+{0x118ae,{{0x118ce,0x0,0x0}}},
+{0x118af,{{0x118cf,0x0,0x0}}},
+{0x118b0,{{0x118d0,0x0,0x0}}},
+{0x118b1,{{0x118d1,0x0,0x0}}},
+{0x118b2,{{0x118d2,0x0,0x0}}},
+{0x118b3,{{0x118d3,0x0,0x0}}},
+{0x118b4,{{0x118d4,0x0,0x0}}},
+{0x118b5,{{0x118d5,0x0,0x0}}},
+{0x118b6,{{0x118d6,0x0,0x0}}},
+{0x118b7,{{0x118d7,0x0,0x0}}},
+{0x118b8,{{0x118d8,0x0,0x0}}},
+{0x118b9,{{0x118d9,0x0,0x0}}},
+{0x118ba,{{0x118da,0x0,0x0}}},
+{0x118bb,{{0x118db,0x0,0x0}}},
+{0x118bc,{{0x118dc,0x0,0x0}}},
+{0x118bd,{{0x118dd,0x0,0x0}}},
+{0x118be,{{0x118de,0x0,0x0}}},
+{0x118bf,{{0x118df,0x0,0x0}}},
+{0x16e40,{{0x16e60,0x0,0x0}}},
+{0x16e41,{{0x16e61,0x0,0x0}}},
+{0x16e42,{{0x16e62,0x0,0x0}}},
+{0x16e43,{{0x16e63,0x0,0x0}}},
+{0x16e44,{{0x16e64,0x0,0x0}}},
+{0x16e45,{{0x16e65,0x0,0x0}}},
+{0x16e46,{{0x16e66,0x0,0x0}}},
+{0x16e47,{{0x16e67,0x0,0x0}}},
+{0x16e48,{{0x16e68,0x0,0x0}}},
+{0x16e49,{{0x16e69,0x0,0x0}}},
+{0x16e4a,{{0x16e6a,0x0,0x0}}},
+{0x16e4b,{{0x16e6b,0x0,0x0}}},
+{0x16e4c,{{0x16e6c,0x0,0x0}}},
+{0x16e4d,{{0x16e6d,0x0,0x0}}},
+{0x16e4e,{{0x16e6e,0x0,0x0}}},
+{0x16e4f,{{0x16e6f,0x0,0x0}}},
+{0x16e50,{{0x16e70,0x0,0x0}}},
+{0x16e51,{{0x16e71,0x0,0x0}}},
+{0x16e52,{{0x16e72,0x0,0x0}}},
+{0x16e53,{{0x16e73,0x0,0x0}}},
+{0x16e54,{{0x16e74,0x0,0x0}}},
+{0x16e55,{{0x16e75,0x0,0x0}}},
+{0x16e56,{{0x16e76,0x0,0x0}}},
+{0x16e57,{{0x16e77,0x0,0x0}}},
+{0x16e58,{{0x16e78,0x0,0x0}}},
+{0x16e59,{{0x16e79,0x0,0x0}}},
+{0x16e5a,{{0x16e7a,0x0,0x0}}},
+{0x16e5b,{{0x16e7b,0x0,0x0}}},
+{0x16e5c,{{0x16e7c,0x0,0x0}}},
+{0x16e5d,{{0x16e7d,0x0,0x0}}},
+{0x16e5e,{{0x16e7e,0x0,0x0}}},
+{0x16e5f,{{0x16e7f,0x0,0x0}}},
+{0x1bca0,{{0x0,0x0,0x0}}},
+{0x1bca1,{{0x0,0x0,0x0}}},
+{0x1bca2,{{0x0,0x0,0x0}}},
+{0x1bca3,{{0x0,0x0,0x0}}},
+{0x1ccd6,{{0x61,0x0,0x0}}},
+{0x1ccd7,{{0x62,0x0,0x0}}},
+{0x1ccd8,{{0x63,0x0,0x0}}},
+{0x1ccd9,{{0x64,0x0,0x0}}},
+{0x1ccda,{{0x65,0x0,0x0}}},
+{0x1ccdb,{{0x66,0x0,0x0}}},
+{0x1ccdc,{{0x67,0x0,0x0}}},
+{0x1ccdd,{{0x68,0x0,0x0}}},
+{0x1ccde,{{0x69,0x0,0x0}}},
+{0x1ccdf,{{0x6a,0x0,0x0}}},
+{0x1cce0,{{0x6b,0x0,0x0}}},
+{0x1cce1,{{0x6c,0x0,0x0}}},
+{0x1cce2,{{0x6d,0x0,0x0}}},
+{0x1cce3,{{0x6e,0x0,0x0}}},
+{0x1cce4,{{0x6f,0x0,0x0}}},
+{0x1cce5,{{0x70,0x0,0x0}}},
+{0x1cce6,{{0x71,0x0,0x0}}},
+{0x1cce7,{{0x72,0x0,0x0}}},
+{0x1cce8,{{0x73,0x0,0x0}}},
+{0x1cce9,{{0x74,0x0,0x0}}},
+{0x1ccea,{{0x75,0x0,0x0}}},
+{0x1cceb,{{0x76,0x0,0x0}}},
+{0x1ccec,{{0x77,0x0,0x0}}},
+{0x1cced,{{0x78,0x0,0x0}}},
+{0x1ccee,{{0x79,0x0,0x0}}},
+{0x1ccef,{{0x7a,0x0,0x0}}},
+{0x1ccf0,{{0x30,0x0,0x0}}},
+{0x1ccf1,{{0x31,0x0,0x0}}},
+{0x1ccf2,{{0x32,0x0,0x0}}},
+{0x1ccf3,{{0x33,0x0,0x0}}},
+{0x1ccf4,{{0x34,0x0,0x0}}},
+{0x1ccf5,{{0x35,0x0,0x0}}},
+{0x1ccf6,{{0x36,0x0,0x0}}},
+{0x1ccf7,{{0x37,0x0,0x0}}},
+{0x1ccf8,{{0x38,0x0,0x0}}},
+{0x1ccf9,{{0x39,0x0,0x0}}},
+{0x1d15e,{{0x1d157,0x1d165,0x0}}},
+{0x1d15f,{{0x1d158,0x1d165,0x0}}},
+{0x1d160,{{0x1d158,0x1d165,0x1d16e}}},
+{0x1d161,{{0x1d158,0x1d165,0x1d16f}}},
+{0x1d162,{{0x1d158,0x1d165,0x1d170}}},
+{0x1d163,{{0x1d158,0x1d165,0x1d171}}},
+{0x1d164,{{0x1d158,0x1d165,0x1d172}}},
+{0x1d173,{{0x0,0x0,0x0}}},
+{0x1d174,{{0x0,0x0,0x0}}},
+{0x1d175,{{0x0,0x0,0x0}}},
+{0x1d176,{{0x0,0x0,0x0}}},
+{0x1d177,{{0x0,0x0,0x0}}},
+{0x1d178,{{0x0,0x0,0x0}}},
+{0x1d179,{{0x0,0x0,0x0}}},
+{0x1d17a,{{0x0,0x0,0x0}}},
+{0x1d1bb,{{0x1d1b9,0x1d165,0x0}}},
+{0x1d1bc,{{0x1d1ba,0x1d165,0x0}}},
+{0x1d1bd,{{0x1d1b9,0x1d165,0x1d16e}}},
+{0x1d1be,{{0x1d1ba,0x1d165,0x1d16e}}},
+{0x1d1bf,{{0x1d1b9,0x1d165,0x1d16f}}},
+{0x1d1c0,{{0x1d1ba,0x1d165,0x1d16f}}},
+{0x1d400,{{0x61,0x0,0x0}}},
+{0x1d401,{{0x62,0x0,0x0}}},
+{0x1d402,{{0x63,0x0,0x0}}},
+{0x1d403,{{0x64,0x0,0x0}}},
+{0x1d404,{{0x65,0x0,0x0}}},
+{0x1d405,{{0x66,0x0,0x0}}},
+{0x1d406,{{0x67,0x0,0x0}}},
+{0x1d407,{{0x68,0x0,0x0}}},
+{0x1d408,{{0x69,0x0,0x0}}},
+{0x1d409,{{0x6a,0x0,0x0}}},
+{0x1d40a,{{0x6b,0x0,0x0}}},
+{0x1d40b,{{0x6c,0x0,0x0}}},
+{0x1d40c,{{0x6d,0x0,0x0}}},
+{0x1d40d,{{0x6e,0x0,0x0}}},
+{0x1d40e,{{0x6f,0x0,0x0}}},
+{0x1d40f,{{0x70,0x0,0x0}}},
+{0x1d410,{{0x71,0x0,0x0}}},
+{0x1d411,{{0x72,0x0,0x0}}},
+{0x1d412,{{0x73,0x0,0x0}}},
+{0x1d413,{{0x74,0x0,0x0}}},
+{0x1d414,{{0x75,0x0,0x0}}},
+{0x1d415,{{0x76,0x0,0x0}}},
+{0x1d416,{{0x77,0x0,0x0}}},
+{0x1d417,{{0x78,0x0,0x0}}},
+{0x1d418,{{0x79,0x0,0x0}}},
+{0x1d419,{{0x7a,0x0,0x0}}},
+{0x1d41a,{{0x61,0x0,0x0}}},
+{0x1d41b,{{0x62,0x0,0x0}}},
+{0x1d41c,{{0x63,0x0,0x0}}},
+{0x1d41d,{{0x64,0x0,0x0}}},
+{0x1d41e,{{0x65,0x0,0x0}}},
+{0x1d41f,{{0x66,0x0,0x0}}},
+{0x1d420,{{0x67,0x0,0x0}}},
+{0x1d421,{{0x68,0x0,0x0}}},
+{0x1d422,{{0x69,0x0,0x0}}},
+{0x1d423,{{0x6a,0x0,0x0}}},
+{0x1d424,{{0x6b,0x0,0x0}}},
+{0x1d425,{{0x6c,0x0,0x0}}},
+{0x1d426,{{0x6d,0x0,0x0}}},
+{0x1d427,{{0x6e,0x0,0x0}}},
+{0x1d428,{{0x6f,0x0,0x0}}},
+{0x1d429,{{0x70,0x0,0x0}}},
+{0x1d42a,{{0x71,0x0,0x0}}},
+{0x1d42b,{{0x72,0x0,0x0}}},
+{0x1d42c,{{0x73,0x0,0x0}}},
+{0x1d42d,{{0x74,0x0,0x0}}},
+{0x1d42e,{{0x75,0x0,0x0}}},
+{0x1d42f,{{0x76,0x0,0x0}}},
+{0x1d430,{{0x77,0x0,0x0}}},
+{0x1d431,{{0x78,0x0,0x0}}},
+{0x1d432,{{0x79,0x0,0x0}}},
+{0x1d433,{{0x7a,0x0,0x0}}},
+{0x1d434,{{0x61,0x0,0x0}}},
+{0x1d435,{{0x62,0x0,0x0}}},
+{0x1d436,{{0x63,0x0,0x0}}},
+{0x1d437,{{0x64,0x0,0x0}}},
+{0x1d438,{{0x65,0x0,0x0}}},
+{0x1d439,{{0x66,0x0,0x0}}},
+{0x1d43a,{{0x67,0x0,0x0}}},
+{0x1d43b,{{0x68,0x0,0x0}}},
+{0x1d43c,{{0x69,0x0,0x0}}},
+{0x1d43d,{{0x6a,0x0,0x0}}},
+{0x1d43e,{{0x6b,0x0,0x0}}},
+{0x1d43f,{{0x6c,0x0,0x0}}},
+{0x1d440,{{0x6d,0x0,0x0}}},
+{0x1d441,{{0x6e,0x0,0x0}}},
+{0x1d442,{{0x6f,0x0,0x0}}},
+{0x1d443,{{0x70,0x0,0x0}}},
+{0x1d444,{{0x71,0x0,0x0}}},
+{0x1d445,{{0x72,0x0,0x0}}},
+{0x1d446,{{0x73,0x0,0x0}}},
+{0x1d447,{{0x74,0x0,0x0}}},
+{0x1d448,{{0x75,0x0,0x0}}},
+{0x1d449,{{0x76,0x0,0x0}}},
+{0x1d44a,{{0x77,0x0,0x0}}},
+{0x1d44b,{{0x78,0x0,0x0}}},
+{0x1d44c,{{0x79,0x0,0x0}}},
+{0x1d44d,{{0x7a,0x0,0x0}}},
+{0x1d44e,{{0x61,0x0,0x0}}},
+{0x1d44f,{{0x62,0x0,0x0}}},
+{0x1d450,{{0x63,0x0,0x0}}},
+{0x1d451,{{0x64,0x0,0x0}}},
+{0x1d452,{{0x65,0x0,0x0}}},
+{0x1d453,{{0x66,0x0,0x0}}},
+{0x1d454,{{0x67,0x0,0x0}}},
+{0x1d456,{{0x69,0x0,0x0}}},
+{0x1d457,{{0x6a,0x0,0x0}}},
+{0x1d458,{{0x6b,0x0,0x0}}},
+{0x1d459,{{0x6c,0x0,0x0}}},
+{0x1d45a,{{0x6d,0x0,0x0}}},
+{0x1d45b,{{0x6e,0x0,0x0}}},
+{0x1d45c,{{0x6f,0x0,0x0}}},
+{0x1d45d,{{0x70,0x0,0x0}}},
+{0x1d45e,{{0x71,0x0,0x0}}},
+{0x1d45f,{{0x72,0x0,0x0}}},
+{0x1d460,{{0x73,0x0,0x0}}},
+{0x1d461,{{0x74,0x0,0x0}}},
+{0x1d462,{{0x75,0x0,0x0}}},
+{0x1d463,{{0x76,0x0,0x0}}},
+{0x1d464,{{0x77,0x0,0x0}}},
+{0x1d465,{{0x78,0x0,0x0}}},
+{0x1d466,{{0x79,0x0,0x0}}},
+{0x1d467,{{0x7a,0x0,0x0}}},
+{0x1d468,{{0x61,0x0,0x0}}},
+{0x1d469,{{0x62,0x0,0x0}}},
+{0x1d46a,{{0x63,0x0,0x0}}},
+{0x1d46b,{{0x64,0x0,0x0}}},
+{0x1d46c,{{0x65,0x0,0x0}}},
+{0x1d46d,{{0x66,0x0,0x0}}},
+{0x1d46e,{{0x67,0x0,0x0}}},
+{0x1d46f,{{0x68,0x0,0x0}}},
+{0x1d470,{{0x69,0x0,0x0}}},
+{0x1d471,{{0x6a,0x0,0x0}}},
+{0x1d472,{{0x6b,0x0,0x0}}},
+{0x1d473,{{0x6c,0x0,0x0}}},
+{0x1d474,{{0x6d,0x0,0x0}}},
+{0x1d475,{{0x6e,0x0,0x0}}},
+{0x1d476,{{0x6f,0x0,0x0}}},
+{0x1d477,{{0x70,0x0,0x0}}},
+{0x1d478,{{0x71,0x0,0x0}}},
+{0x1d479,{{0x72,0x0,0x0}}},
+{0x1d47a,{{0x73,0x0,0x0}}},
+{0x1d47b,{{0x74,0x0,0x0}}},
+{0x1d47c,{{0x75,0x0,0x0}}},
+{0x1d47d,{{0x76,0x0,0x0}}},
+{0x1d47e,{{0x77,0x0,0x0}}},
+{0x1d47f,{{0x78,0x0,0x0}}},
+{0x1d480,{{0x79,0x0,0x0}}},
+{0x1d481,{{0x7a,0x0,0x0}}},
+{0x1d482,{{0x61,0x0,0x0}}},
+{0x1d483,{{0x62,0x0,0x0}}},
+{0x1d484,{{0x63,0x0,0x0}}},
+{0x1d485,{{0x64,0x0,0x0}}},
+{0x1d486,{{0x65,0x0,0x0}}},
+{0x1d487,{{0x66,0x0,0x0}}},
+{0x1d488,{{0x67,0x0,0x0}}},
+{0x1d489,{{0x68,0x0,0x0}}},
+{0x1d48a,{{0x69,0x0,0x0}}},
+{0x1d48b,{{0x6a,0x0,0x0}}},
+{0x1d48c,{{0x6b,0x0,0x0}}},
+{0x1d48d,{{0x6c,0x0,0x0}}},
+{0x1d48e,{{0x6d,0x0,0x0}}},
+{0x1d48f,{{0x6e,0x0,0x0}}},
+{0x1d490,{{0x6f,0x0,0x0}}},
+{0x1d491,{{0x70,0x0,0x0}}},
+{0x1d492,{{0x71,0x0,0x0}}},
+{0x1d493,{{0x72,0x0,0x0}}},
+{0x1d494,{{0x73,0x0,0x0}}},
+{0x1d495,{{0x74,0x0,0x0}}},
+{0x1d496,{{0x75,0x0,0x0}}},
+{0x1d497,{{0x76,0x0,0x0}}},
+{0x1d498,{{0x77,0x0,0x0}}},
+{0x1d499,{{0x78,0x0,0x0}}},
+{0x1d49a,{{0x79,0x0,0x0}}},
+{0x1d49b,{{0x7a,0x0,0x0}}},
+{0x1d49c,{{0x61,0x0,0x0}}},
+{0x1d49e,{{0x63,0x0,0x0}}},
+{0x1d49f,{{0x64,0x0,0x0}}},
+{0x1d4a2,{{0x67,0x0,0x0}}},
+{0x1d4a5,{{0x6a,0x0,0x0}}},
+{0x1d4a6,{{0x6b,0x0,0x0}}},
+{0x1d4a9,{{0x6e,0x0,0x0}}},
+{0x1d4aa,{{0x6f,0x0,0x0}}},
+{0x1d4ab,{{0x70,0x0,0x0}}},
+{0x1d4ac,{{0x71,0x0,0x0}}},
+{0x1d4ae,{{0x73,0x0,0x0}}},
+{0x1d4af,{{0x74,0x0,0x0}}},
+{0x1d4b0,{{0x75,0x0,0x0}}},
+{0x1d4b1,{{0x76,0x0,0x0}}},
+{0x1d4b2,{{0x77,0x0,0x0}}},
+{0x1d4b3,{{0x78,0x0,0x0}}},
+{0x1d4b4,{{0x79,0x0,0x0}}},
+{0x1d4b5,{{0x7a,0x0,0x0}}},
+{0x1d4b6,{{0x61,0x0,0x0}}},
+{0x1d4b7,{{0x62,0x0,0x0}}},
+{0x1d4b8,{{0x63,0x0,0x0}}},
+{0x1d4b9,{{0x64,0x0,0x0}}},
+{0x1d4bb,{{0x66,0x0,0x0}}},
+{0x1d4bd,{{0x68,0x0,0x0}}},
+{0x1d4be,{{0x69,0x0,0x0}}},
+{0x1d4bf,{{0x6a,0x0,0x0}}},
+{0x1d4c0,{{0x6b,0x0,0x0}}},
+{0x1d4c1,{{0x6c,0x0,0x0}}},
+{0x1d4c2,{{0x6d,0x0,0x0}}},
+{0x1d4c3,{{0x6e,0x0,0x0}}},
+{0x1d4c5,{{0x70,0x0,0x0}}},
+{0x1d4c6,{{0x71,0x0,0x0}}},
+{0x1d4c7,{{0x72,0x0,0x0}}},
+{0x1d4c8,{{0x73,0x0,0x0}}},
+{0x1d4c9,{{0x74,0x0,0x0}}},
+{0x1d4ca,{{0x75,0x0,0x0}}},
+{0x1d4cb,{{0x76,0x0,0x0}}},
+{0x1d4cc,{{0x77,0x0,0x0}}},
+{0x1d4cd,{{0x78,0x0,0x0}}},
+{0x1d4ce,{{0x79,0x0,0x0}}},
+{0x1d4cf,{{0x7a,0x0,0x0}}},
+{0x1d4d0,{{0x61,0x0,0x0}}},
+{0x1d4d1,{{0x62,0x0,0x0}}},
+{0x1d4d2,{{0x63,0x0,0x0}}},
+{0x1d4d3,{{0x64,0x0,0x0}}},
+{0x1d4d4,{{0x65,0x0,0x0}}},
+{0x1d4d5,{{0x66,0x0,0x0}}},
+{0x1d4d6,{{0x67,0x0,0x0}}},
+{0x1d4d7,{{0x68,0x0,0x0}}},
+{0x1d4d8,{{0x69,0x0,0x0}}},
+{0x1d4d9,{{0x6a,0x0,0x0}}},
+{0x1d4da,{{0x6b,0x0,0x0}}},
+{0x1d4db,{{0x6c,0x0,0x0}}},
+{0x1d4dc,{{0x6d,0x0,0x0}}},
+{0x1d4dd,{{0x6e,0x0,0x0}}},
+{0x1d4de,{{0x6f,0x0,0x0}}},
+{0x1d4df,{{0x70,0x0,0x0}}},
+{0x1d4e0,{{0x71,0x0,0x0}}},
+{0x1d4e1,{{0x72,0x0,0x0}}},
+{0x1d4e2,{{0x73,0x0,0x0}}},
+{0x1d4e3,{{0x74,0x0,0x0}}},
+{0x1d4e4,{{0x75,0x0,0x0}}},
+{0x1d4e5,{{0x76,0x0,0x0}}},
+{0x1d4e6,{{0x77,0x0,0x0}}},
+{0x1d4e7,{{0x78,0x0,0x0}}},
+{0x1d4e8,{{0x79,0x0,0x0}}},
+{0x1d4e9,{{0x7a,0x0,0x0}}},
+{0x1d4ea,{{0x61,0x0,0x0}}},
+{0x1d4eb,{{0x62,0x0,0x0}}},
+{0x1d4ec,{{0x63,0x0,0x0}}},
+{0x1d4ed,{{0x64,0x0,0x0}}},
+{0x1d4ee,{{0x65,0x0,0x0}}},
+{0x1d4ef,{{0x66,0x0,0x0}}},
+{0x1d4f0,{{0x67,0x0,0x0}}},
+{0x1d4f1,{{0x68,0x0,0x0}}},
+{0x1d4f2,{{0x69,0x0,0x0}}},
+{0x1d4f3,{{0x6a,0x0,0x0}}},
+{0x1d4f4,{{0x6b,0x0,0x0}}},
+{0x1d4f5,{{0x6c,0x0,0x0}}},
+{0x1d4f6,{{0x6d,0x0,0x0}}},
+{0x1d4f7,{{0x6e,0x0,0x0}}},
+{0x1d4f8,{{0x6f,0x0,0x0}}},
+{0x1d4f9,{{0x70,0x0,0x0}}},
+{0x1d4fa,{{0x71,0x0,0x0}}},
+{0x1d4fb,{{0x72,0x0,0x0}}},
+{0x1d4fc,{{0x73,0x0,0x0}}},
+{0x1d4fd,{{0x74,0x0,0x0}}},
+{0x1d4fe,{{0x75,0x0,0x0}}},
+{0x1d4ff,{{0x76,0x0,0x0}}},
+{0x1d500,{{0x77,0x0,0x0}}},
+{0x1d501,{{0x78,0x0,0x0}}},
+{0x1d502,{{0x79,0x0,0x0}}},
+{0x1d503,{{0x7a,0x0,0x0}}},
+{0x1d504,{{0x61,0x0,0x0}}},
+{0x1d505,{{0x62,0x0,0x0}}},
+{0x1d507,{{0x64,0x0,0x0}}},
+{0x1d508,{{0x65,0x0,0x0}}},
+{0x1d509,{{0x66,0x0,0x0}}},
+{0x1d50a,{{0x67,0x0,0x0}}},
+{0x1d50d,{{0x6a,0x0,0x0}}},
+{0x1d50e,{{0x6b,0x0,0x0}}},
+{0x1d50f,{{0x6c,0x0,0x0}}},
+{0x1d510,{{0x6d,0x0,0x0}}},
+{0x1d511,{{0x6e,0x0,0x0}}},
+{0x1d512,{{0x6f,0x0,0x0}}},
+{0x1d513,{{0x70,0x0,0x0}}},
+{0x1d514,{{0x71,0x0,0x0}}},
+{0x1d516,{{0x73,0x0,0x0}}},
+{0x1d517,{{0x74,0x0,0x0}}},
+{0x1d518,{{0x75,0x0,0x0}}},
+{0x1d519,{{0x76,0x0,0x0}}},
+{0x1d51a,{{0x77,0x0,0x0}}},
+{0x1d51b,{{0x78,0x0,0x0}}},
+{0x1d51c,{{0x79,0x0,0x0}}},
+{0x1d51e,{{0x61,0x0,0x0}}},
+{0x1d51f,{{0x62,0x0,0x0}}},
+{0x1d520,{{0x63,0x0,0x0}}},
+{0x1d521,{{0x64,0x0,0x0}}},
+{0x1d522,{{0x65,0x0,0x0}}},
+{0x1d523,{{0x66,0x0,0x0}}},
+{0x1d524,{{0x67,0x0,0x0}}},
+{0x1d525,{{0x68,0x0,0x0}}},
+{0x1d526,{{0x69,0x0,0x0}}},
+{0x1d527,{{0x6a,0x0,0x0}}},
+{0x1d528,{{0x6b,0x0,0x0}}},
+{0x1d529,{{0x6c,0x0,0x0}}},
+{0x1d52a,{{0x6d,0x0,0x0}}},
+{0x1d52b,{{0x6e,0x0,0x0}}},
+{0x1d52c,{{0x6f,0x0,0x0}}},
+{0x1d52d,{{0x70,0x0,0x0}}},
+{0x1d52e,{{0x71,0x0,0x0}}},
+{0x1d52f,{{0x72,0x0,0x0}}},
+{0x1d530,{{0x73,0x0,0x0}}},
+{0x1d531,{{0x74,0x0,0x0}}},
+{0x1d532,{{0x75,0x0,0x0}}},
+{0x1d533,{{0x76,0x0,0x0}}},
+{0x1d534,{{0x77,0x0,0x0}}},
+{0x1d535,{{0x78,0x0,0x0}}},
+{0x1d536,{{0x79,0x0,0x0}}},
+{0x1d537,{{0x7a,0x0,0x0}}},
+{0x1d538,{{0x61,0x0,0x0}}},
+{0x1d539,{{0x62,0x0,0x0}}},
+{0x1d53b,{{0x64,0x0,0x0}}},
+{0x1d53c,{{0x65,0x0,0x0}}},
+{0x1d53d,{{0x66,0x0,0x0}}},
+{0x1d53e,{{0x67,0x0,0x0}}},
+{0x1d540,{{0x69,0x0,0x0}}},
+{0x1d541,{{0x6a,0x0,0x0}}},
+{0x1d542,{{0x6b,0x0,0x0}}},
+{0x1d543,{{0x6c,0x0,0x0}}},
+{0x1d544,{{0x6d,0x0,0x0}}},
+{0x1d546,{{0x6f,0x0,0x0}}},
+{0x1d54a,{{0x73,0x0,0x0}}},
+{0x1d54b,{{0x74,0x0,0x0}}},
+{0x1d54c,{{0x75,0x0,0x0}}},
+{0x1d54d,{{0x76,0x0,0x0}}},
+{0x1d54e,{{0x77,0x0,0x0}}},
+{0x1d54f,{{0x78,0x0,0x0}}},
+{0x1d550,{{0x79,0x0,0x0}}},
+{0x1d552,{{0x61,0x0,0x0}}},
+{0x1d553,{{0x62,0x0,0x0}}},
+{0x1d554,{{0x63,0x0,0x0}}},
+{0x1d555,{{0x64,0x0,0x0}}},
+{0x1d556,{{0x65,0x0,0x0}}},
+{0x1d557,{{0x66,0x0,0x0}}},
+{0x1d558,{{0x67,0x0,0x0}}},
+{0x1d559,{{0x68,0x0,0x0}}},
+{0x1d55a,{{0x69,0x0,0x0}}},
+{0x1d55b,{{0x6a,0x0,0x0}}},
+{0x1d55c,{{0x6b,0x0,0x0}}},
+{0x1d55d,{{0x6c,0x0,0x0}}},
+{0x1d55e,{{0x6d,0x0,0x0}}},
+{0x1d55f,{{0x6e,0x0,0x0}}},
+{0x1d560,{{0x6f,0x0,0x0}}},
+{0x1d561,{{0x70,0x0,0x0}}},
+{0x1d562,{{0x71,0x0,0x0}}},
+{0x1d563,{{0x72,0x0,0x0}}},
+{0x1d564,{{0x73,0x0,0x0}}},
+{0x1d565,{{0x74,0x0,0x0}}},
+{0x1d566,{{0x75,0x0,0x0}}},
+{0x1d567,{{0x76,0x0,0x0}}},
+{0x1d568,{{0x77,0x0,0x0}}},
+{0x1d569,{{0x78,0x0,0x0}}},
+{0x1d56a,{{0x79,0x0,0x0}}},
+{0x1d56b,{{0x7a,0x0,0x0}}},
+{0x1d56c,{{0x61,0x0,0x0}}},
+{0x1d56d,{{0x62,0x0,0x0}}},
+{0x1d56e,{{0x63,0x0,0x0}}},
+{0x1d56f,{{0x64,0x0,0x0}}},
+{0x1d570,{{0x65,0x0,0x0}}},
+{0x1d571,{{0x66,0x0,0x0}}},
+{0x1d572,{{0x67,0x0,0x0}}},
+{0x1d573,{{0x68,0x0,0x0}}},
+{0x1d574,{{0x69,0x0,0x0}}},
+{0x1d575,{{0x6a,0x0,0x0}}},
+{0x1d576,{{0x6b,0x0,0x0}}},
+{0x1d577,{{0x6c,0x0,0x0}}},
+{0x1d578,{{0x6d,0x0,0x0}}},
+{0x1d579,{{0x6e,0x0,0x0}}},
+{0x1d57a,{{0x6f,0x0,0x0}}},
+{0x1d57b,{{0x70,0x0,0x0}}},
+{0x1d57c,{{0x71,0x0,0x0}}},
+{0x1d57d,{{0x72,0x0,0x0}}},
+{0x1d57e,{{0x73,0x0,0x0}}},
+{0x1d57f,{{0x74,0x0,0x0}}},
+{0x1d580,{{0x75,0x0,0x0}}},
+{0x1d581,{{0x76,0x0,0x0}}},
+{0x1d582,{{0x77,0x0,0x0}}},
+{0x1d583,{{0x78,0x0,0x0}}},
+{0x1d584,{{0x79,0x0,0x0}}},
+{0x1d585,{{0x7a,0x0,0x0}}},
+{0x1d586,{{0x61,0x0,0x0}}},
+{0x1d587,{{0x62,0x0,0x0}}},
+{0x1d588,{{0x63,0x0,0x0}}},
+{0x1d589,{{0x64,0x0,0x0}}},
+{0x1d58a,{{0x65,0x0,0x0}}},
+{0x1d58b,{{0x66,0x0,0x0}}},
+{0x1d58c,{{0x67,0x0,0x0}}},
+{0x1d58d,{{0x68,0x0,0x0}}},
+{0x1d58e,{{0x69,0x0,0x0}}},
+{0x1d58f,{{0x6a,0x0,0x0}}},
+{0x1d590,{{0x6b,0x0,0x0}}},
+{0x1d591,{{0x6c,0x0,0x0}}},
+{0x1d592,{{0x6d,0x0,0x0}}},
+{0x1d593,{{0x6e,0x0,0x0}}},
+{0x1d594,{{0x6f,0x0,0x0}}},
+{0x1d595,{{0x70,0x0,0x0}}},
+{0x1d596,{{0x71,0x0,0x0}}},
+{0x1d597,{{0x72,0x0,0x0}}},
+{0x1d598,{{0x73,0x0,0x0}}},
+{0x1d599,{{0x74,0x0,0x0}}},
+{0x1d59a,{{0x75,0x0,0x0}}},
+{0x1d59b,{{0x76,0x0,0x0}}},
+{0x1d59c,{{0x77,0x0,0x0}}},
+{0x1d59d,{{0x78,0x0,0x0}}},
+{0x1d59e,{{0x79,0x0,0x0}}},
+{0x1d59f,{{0x7a,0x0,0x0}}},
+{0x1d5a0,{{0x61,0x0,0x0}}},
+{0x1d5a1,{{0x62,0x0,0x0}}},
+{0x1d5a2,{{0x63,0x0,0x0}}},
+{0x1d5a3,{{0x64,0x0,0x0}}},
+{0x1d5a4,{{0x65,0x0,0x0}}},
+{0x1d5a5,{{0x66,0x0,0x0}}},
+{0x1d5a6,{{0x67,0x0,0x0}}},
+{0x1d5a7,{{0x68,0x0,0x0}}},
+{0x1d5a8,{{0x69,0x0,0x0}}},
+{0x1d5a9,{{0x6a,0x0,0x0}}},
+{0x1d5aa,{{0x6b,0x0,0x0}}},
+{0x1d5ab,{{0x6c,0x0,0x0}}},
+{0x1d5ac,{{0x6d,0x0,0x0}}},
+{0x1d5ad,{{0x6e,0x0,0x0}}},
+{0x1d5ae,{{0x6f,0x0,0x0}}},
+{0x1d5af,{{0x70,0x0,0x0}}},
+{0x1d5b0,{{0x71,0x0,0x0}}},
+{0x1d5b1,{{0x72,0x0,0x0}}},
+{0x1d5b2,{{0x73,0x0,0x0}}},
+{0x1d5b3,{{0x74,0x0,0x0}}},
+{0x1d5b4,{{0x75,0x0,0x0}}},
+{0x1d5b5,{{0x76,0x0,0x0}}},
+{0x1d5b6,{{0x77,0x0,0x0}}},
+{0x1d5b7,{{0x78,0x0,0x0}}},
+{0x1d5b8,{{0x79,0x0,0x0}}},
+{0x1d5b9,{{0x7a,0x0,0x0}}},
+{0x1d5ba,{{0x61,0x0,0x0}}},
+{0x1d5bb,{{0x62,0x0,0x0}}},
+{0x1d5bc,{{0x63,0x0,0x0}}},
+{0x1d5bd,{{0x64,0x0,0x0}}},
+{0x1d5be,{{0x65,0x0,0x0}}},
+{0x1d5bf,{{0x66,0x0,0x0}}},
+{0x1d5c0,{{0x67,0x0,0x0}}},
+{0x1d5c1,{{0x68,0x0,0x0}}},
+{0x1d5c2,{{0x69,0x0,0x0}}},
+{0x1d5c3,{{0x6a,0x0,0x0}}},
+{0x1d5c4,{{0x6b,0x0,0x0}}},
+{0x1d5c5,{{0x6c,0x0,0x0}}},
+{0x1d5c6,{{0x6d,0x0,0x0}}},
+{0x1d5c7,{{0x6e,0x0,0x0}}},
+{0x1d5c8,{{0x6f,0x0,0x0}}},
+{0x1d5c9,{{0x70,0x0,0x0}}},
+{0x1d5ca,{{0x71,0x0,0x0}}},
+{0x1d5cb,{{0x72,0x0,0x0}}},
+{0x1d5cc,{{0x73,0x0,0x0}}},
+{0x1d5cd,{{0x74,0x0,0x0}}},
+{0x1d5ce,{{0x75,0x0,0x0}}},
+{0x1d5cf,{{0x76,0x0,0x0}}},
+{0x1d5d0,{{0x77,0x0,0x0}}},
+{0x1d5d1,{{0x78,0x0,0x0}}},
+{0x1d5d2,{{0x79,0x0,0x0}}},
+{0x1d5d3,{{0x7a,0x0,0x0}}},
+{0x1d5d4,{{0x61,0x0,0x0}}},
+{0x1d5d5,{{0x62,0x0,0x0}}},
+{0x1d5d6,{{0x63,0x0,0x0}}},
+{0x1d5d7,{{0x64,0x0,0x0}}},
+{0x1d5d8,{{0x65,0x0,0x0}}},
+{0x1d5d9,{{0x66,0x0,0x0}}},
+{0x1d5da,{{0x67,0x0,0x0}}},
+{0x1d5db,{{0x68,0x0,0x0}}},
+{0x1d5dc,{{0x69,0x0,0x0}}},
+{0x1d5dd,{{0x6a,0x0,0x0}}},
+{0x1d5de,{{0x6b,0x0,0x0}}},
+{0x1d5df,{{0x6c,0x0,0x0}}},
+{0x1d5e0,{{0x6d,0x0,0x0}}},
+{0x1d5e1,{{0x6e,0x0,0x0}}},
+{0x1d5e2,{{0x6f,0x0,0x0}}},
+{0x1d5e3,{{0x70,0x0,0x0}}},
+{0x1d5e4,{{0x71,0x0,0x0}}},
+{0x1d5e5,{{0x72,0x0,0x0}}},
+{0x1d5e6,{{0x73,0x0,0x0}}},
+{0x1d5e7,{{0x74,0x0,0x0}}},
+{0x1d5e8,{{0x75,0x0,0x0}}},
+{0x1d5e9,{{0x76,0x0,0x0}}},
+{0x1d5ea,{{0x77,0x0,0x0}}},
+{0x1d5eb,{{0x78,0x0,0x0}}},
+{0x1d5ec,{{0x79,0x0,0x0}}},
+{0x1d5ed,{{0x7a,0x0,0x0}}},
+{0x1d5ee,{{0x61,0x0,0x0}}},
+{0x1d5ef,{{0x62,0x0,0x0}}},
+{0x1d5f0,{{0x63,0x0,0x0}}},
+{0x1d5f1,{{0x64,0x0,0x0}}},
+{0x1d5f2,{{0x65,0x0,0x0}}},
+{0x1d5f3,{{0x66,0x0,0x0}}},
+{0x1d5f4,{{0x67,0x0,0x0}}},
+{0x1d5f5,{{0x68,0x0,0x0}}},
+{0x1d5f6,{{0x69,0x0,0x0}}},
+{0x1d5f7,{{0x6a,0x0,0x0}}},
+{0x1d5f8,{{0x6b,0x0,0x0}}},
+{0x1d5f9,{{0x6c,0x0,0x0}}},
+{0x1d5fa,{{0x6d,0x0,0x0}}},
+{0x1d5fb,{{0x6e,0x0,0x0}}},
+{0x1d5fc,{{0x6f,0x0,0x0}}},
+{0x1d5fd,{{0x70,0x0,0x0}}},
+{0x1d5fe,{{0x71,0x0,0x0}}},
+{0x1d5ff,{{0x72,0x0,0x0}}},
+{0x1d600,{{0x73,0x0,0x0}}},
+{0x1d601,{{0x74,0x0,0x0}}},
+{0x1d602,{{0x75,0x0,0x0}}},
+{0x1d603,{{0x76,0x0,0x0}}},
+{0x1d604,{{0x77,0x0,0x0}}},
+{0x1d605,{{0x78,0x0,0x0}}},
+{0x1d606,{{0x79,0x0,0x0}}},
+{0x1d607,{{0x7a,0x0,0x0}}},
+{0x1d608,{{0x61,0x0,0x0}}},
+{0x1d609,{{0x62,0x0,0x0}}},
+{0x1d60a,{{0x63,0x0,0x0}}},
+{0x1d60b,{{0x64,0x0,0x0}}},
+{0x1d60c,{{0x65,0x0,0x0}}},
+{0x1d60d,{{0x66,0x0,0x0}}},
+{0x1d60e,{{0x67,0x0,0x0}}},
+{0x1d60f,{{0x68,0x0,0x0}}},
+{0x1d610,{{0x69,0x0,0x0}}},
+{0x1d611,{{0x6a,0x0,0x0}}},
+{0x1d612,{{0x6b,0x0,0x0}}},
+{0x1d613,{{0x6c,0x0,0x0}}},
+{0x1d614,{{0x6d,0x0,0x0}}},
+{0x1d615,{{0x6e,0x0,0x0}}},
+{0x1d616,{{0x6f,0x0,0x0}}},
+{0x1d617,{{0x70,0x0,0x0}}},
+{0x1d618,{{0x71,0x0,0x0}}},
+{0x1d619,{{0x72,0x0,0x0}}},
+{0x1d61a,{{0x73,0x0,0x0}}},
+{0x1d61b,{{0x74,0x0,0x0}}},
+{0x1d61c,{{0x75,0x0,0x0}}},
+{0x1d61d,{{0x76,0x0,0x0}}},
+{0x1d61e,{{0x77,0x0,0x0}}},
+{0x1d61f,{{0x78,0x0,0x0}}},
+{0x1d620,{{0x79,0x0,0x0}}},
+{0x1d621,{{0x7a,0x0,0x0}}},
+{0x1d622,{{0x61,0x0,0x0}}},
+{0x1d623,{{0x62,0x0,0x0}}},
+{0x1d624,{{0x63,0x0,0x0}}},
+{0x1d625,{{0x64,0x0,0x0}}},
+{0x1d626,{{0x65,0x0,0x0}}},
+{0x1d627,{{0x66,0x0,0x0}}},
+{0x1d628,{{0x67,0x0,0x0}}},
+{0x1d629,{{0x68,0x0,0x0}}},
+{0x1d62a,{{0x69,0x0,0x0}}},
+{0x1d62b,{{0x6a,0x0,0x0}}},
+{0x1d62c,{{0x6b,0x0,0x0}}},
+{0x1d62d,{{0x6c,0x0,0x0}}},
+{0x1d62e,{{0x6d,0x0,0x0}}},
+{0x1d62f,{{0x6e,0x0,0x0}}},
+{0x1d630,{{0x6f,0x0,0x0}}},
+{0x1d631,{{0x70,0x0,0x0}}},
+{0x1d632,{{0x71,0x0,0x0}}},
+{0x1d633,{{0x72,0x0,0x0}}},
+{0x1d634,{{0x73,0x0,0x0}}},
+{0x1d635,{{0x74,0x0,0x0}}},
+{0x1d636,{{0x75,0x0,0x0}}},
+{0x1d637,{{0x76,0x0,0x0}}},
+{0x1d638,{{0x77,0x0,0x0}}},
+{0x1d639,{{0x78,0x0,0x0}}},
+{0x1d63a,{{0x79,0x0,0x0}}},
+{0x1d63b,{{0x7a,0x0,0x0}}},
+{0x1d63c,{{0x61,0x0,0x0}}},
+{0x1d63d,{{0x62,0x0,0x0}}},
+{0x1d63e,{{0x63,0x0,0x0}}},
+{0x1d63f,{{0x64,0x0,0x0}}},
+{0x1d640,{{0x65,0x0,0x0}}},
+{0x1d641,{{0x66,0x0,0x0}}},
+{0x1d642,{{0x67,0x0,0x0}}},
+{0x1d643,{{0x68,0x0,0x0}}},
+{0x1d644,{{0x69,0x0,0x0}}},
+{0x1d645,{{0x6a,0x0,0x0}}},
+{0x1d646,{{0x6b,0x0,0x0}}},
+{0x1d647,{{0x6c,0x0,0x0}}},
+{0x1d648,{{0x6d,0x0,0x0}}},
+{0x1d649,{{0x6e,0x0,0x0}}},
+{0x1d64a,{{0x6f,0x0,0x0}}},
+{0x1d64b,{{0x70,0x0,0x0}}},
+{0x1d64c,{{0x71,0x0,0x0}}},
+{0x1d64d,{{0x72,0x0,0x0}}},
+{0x1d64e,{{0x73,0x0,0x0}}},
+{0x1d64f,{{0x74,0x0,0x0}}},
+{0x1d650,{{0x75,0x0,0x0}}},
+{0x1d651,{{0x76,0x0,0x0}}},
+{0x1d652,{{0x77,0x0,0x0}}},
+{0x1d653,{{0x78,0x0,0x0}}},
+{0x1d654,{{0x79,0x0,0x0}}},
+{0x1d655,{{0x7a,0x0,0x0}}},
+{0x1d656,{{0x61,0x0,0x0}}},
+{0x1d657,{{0x62,0x0,0x0}}},
+{0x1d658,{{0x63,0x0,0x0}}},
+{0x1d659,{{0x64,0x0,0x0}}},
+{0x1d65a,{{0x65,0x0,0x0}}},
+{0x1d65b,{{0x66,0x0,0x0}}},
+{0x1d65c,{{0x67,0x0,0x0}}},
+{0x1d65d,{{0x68,0x0,0x0}}},
+{0x1d65e,{{0x69,0x0,0x0}}},
+{0x1d65f,{{0x6a,0x0,0x0}}},
+{0x1d660,{{0x6b,0x0,0x0}}},
+{0x1d661,{{0x6c,0x0,0x0}}},
+{0x1d662,{{0x6d,0x0,0x0}}},
+{0x1d663,{{0x6e,0x0,0x0}}},
+{0x1d664,{{0x6f,0x0,0x0}}},
+{0x1d665,{{0x70,0x0,0x0}}},
+{0x1d666,{{0x71,0x0,0x0}}},
+{0x1d667,{{0x72,0x0,0x0}}},
+{0x1d668,{{0x73,0x0,0x0}}},
+{0x1d669,{{0x74,0x0,0x0}}},
+{0x1d66a,{{0x75,0x0,0x0}}},
+{0x1d66b,{{0x76,0x0,0x0}}},
+{0x1d66c,{{0x77,0x0,0x0}}},
+{0x1d66d,{{0x78,0x0,0x0}}},
+{0x1d66e,{{0x79,0x0,0x0}}},
+{0x1d66f,{{0x7a,0x0,0x0}}},
+{0x1d670,{{0x61,0x0,0x0}}},
+{0x1d671,{{0x62,0x0,0x0}}},
+{0x1d672,{{0x63,0x0,0x0}}},
+{0x1d673,{{0x64,0x0,0x0}}},
+{0x1d674,{{0x65,0x0,0x0}}},
+{0x1d675,{{0x66,0x0,0x0}}},
+{0x1d676,{{0x67,0x0,0x0}}},
+{0x1d677,{{0x68,0x0,0x0}}},
+{0x1d678,{{0x69,0x0,0x0}}},
+{0x1d679,{{0x6a,0x0,0x0}}},
+{0x1d67a,{{0x6b,0x0,0x0}}},
+{0x1d67b,{{0x6c,0x0,0x0}}},
+{0x1d67c,{{0x6d,0x0,0x0}}},
+{0x1d67d,{{0x6e,0x0,0x0}}},
+{0x1d67e,{{0x6f,0x0,0x0}}},
+{0x1d67f,{{0x70,0x0,0x0}}},
+{0x1d680,{{0x71,0x0,0x0}}},
+{0x1d681,{{0x72,0x0,0x0}}},
+{0x1d682,{{0x73,0x0,0x0}}},
+{0x1d683,{{0x74,0x0,0x0}}},
+{0x1d684,{{0x75,0x0,0x0}}},
+{0x1d685,{{0x76,0x0,0x0}}},
+{0x1d686,{{0x77,0x0,0x0}}},
+{0x1d687,{{0x78,0x0,0x0}}},
+{0x1d688,{{0x79,0x0,0x0}}},
+{0x1d689,{{0x7a,0x0,0x0}}},
+{0x1d68a,{{0x61,0x0,0x0}}},
+{0x1d68b,{{0x62,0x0,0x0}}},
+{0x1d68c,{{0x63,0x0,0x0}}},
+{0x1d68d,{{0x64,0x0,0x0}}},
+{0x1d68e,{{0x65,0x0,0x0}}},
+{0x1d68f,{{0x66,0x0,0x0}}},
+{0x1d690,{{0x67,0x0,0x0}}},
+{0x1d691,{{0x68,0x0,0x0}}},
+{0x1d692,{{0x69,0x0,0x0}}},
+{0x1d693,{{0x6a,0x0,0x0}}},
+{0x1d694,{{0x6b,0x0,0x0}}},
+{0x1d695,{{0x6c,0x0,0x0}}},
+{0x1d696,{{0x6d,0x0,0x0}}},
+{0x1d697,{{0x6e,0x0,0x0}}},
+{0x1d698,{{0x6f,0x0,0x0}}},
+{0x1d699,{{0x70,0x0,0x0}}},
+{0x1d69a,{{0x71,0x0,0x0}}},
+{0x1d69b,{{0x72,0x0,0x0}}},
+{0x1d69c,{{0x73,0x0,0x0}}},
+{0x1d69d,{{0x74,0x0,0x0}}},
+{0x1d69e,{{0x75,0x0,0x0}}},
+{0x1d69f,{{0x76,0x0,0x0}}},
+{0x1d6a0,{{0x77,0x0,0x0}}},
+{0x1d6a1,{{0x78,0x0,0x0}}},
+{0x1d6a2,{{0x79,0x0,0x0}}},
+{0x1d6a3,{{0x7a,0x0,0x0}}},
+{0x1d6a4,{{0x131,0x0,0x0}}},
+{0x1d6a5,{{0x237,0x0,0x0}}},
+{0x1d6a8,{{0x3b1,0x0,0x0}}},
+{0x1d6a9,{{0x3b2,0x0,0x0}}},
+{0x1d6aa,{{0x3b3,0x0,0x0}}},
+{0x1d6ab,{{0x3b4,0x0,0x0}}},
+{0x1d6ac,{{0x3b5,0x0,0x0}}},
+{0x1d6ad,{{0x3b6,0x0,0x0}}},
+{0x1d6ae,{{0x3b7,0x0,0x0}}},
+{0x1d6af,{{0x3b8,0x0,0x0}}},
+{0x1d6b0,{{0x3b9,0x0,0x0}}},
+{0x1d6b1,{{0x3ba,0x0,0x0}}},
+{0x1d6b2,{{0x3bb,0x0,0x0}}},
+{0x1d6b3,{{0x3bc,0x0,0x0}}},
+{0x1d6b4,{{0x3bd,0x0,0x0}}},
+{0x1d6b5,{{0x3be,0x0,0x0}}},
+{0x1d6b6,{{0x3bf,0x0,0x0}}},
+{0x1d6b7,{{0x3c0,0x0,0x0}}},
+{0x1d6b8,{{0x3c1,0x0,0x0}}},
+{0x1d6b9,{{0x3b8,0x0,0x0}}},
+{0x1d6ba,{{0x3c3,0x0,0x0}}},
+{0x1d6bb,{{0x3c4,0x0,0x0}}},
+{0x1d6bc,{{0x3c5,0x0,0x0}}},
+{0x1d6bd,{{0x3c6,0x0,0x0}}},
+{0x1d6be,{{0x3c7,0x0,0x0}}},
+{0x1d6bf,{{0x3c8,0x0,0x0}}},
+{0x1d6c0,{{0x3c9,0x0,0x0}}},
+{0x1d6c1,{{0x2207,0x0,0x0}}},
+{0x1d6c2,{{0x3b1,0x0,0x0}}},
+{0x1d6c3,{{0x3b2,0x0,0x0}}},
+{0x1d6c4,{{0x3b3,0x0,0x0}}},
+{0x1d6c5,{{0x3b4,0x0,0x0}}},
+{0x1d6c6,{{0x3b5,0x0,0x0}}},
+{0x1d6c7,{{0x3b6,0x0,0x0}}},
+{0x1d6c8,{{0x3b7,0x0,0x0}}},
+{0x1d6c9,{{0x3b8,0x0,0x0}}},
+{0x1d6ca,{{0x3b9,0x0,0x0}}},
+{0x1d6cb,{{0x3ba,0x0,0x0}}},
+{0x1d6cc,{{0x3bb,0x0,0x0}}},
+{0x1d6cd,{{0x3bc,0x0,0x0}}},
+{0x1d6ce,{{0x3bd,0x0,0x0}}},
+{0x1d6cf,{{0x3be,0x0,0x0}}},
+{0x1d6d0,{{0x3bf,0x0,0x0}}},
+{0x1d6d1,{{0x3c0,0x0,0x0}}},
+{0x1d6d2,{{0x3c1,0x0,0x0}}},
+{0x1d6d3,{{0x3c3,0x0,0x0}}},
+{0x1d6d4,{{0x3c3,0x0,0x0}}},
+{0x1d6d5,{{0x3c4,0x0,0x0}}},
+{0x1d6d6,{{0x3c5,0x0,0x0}}},
+{0x1d6d7,{{0x3c6,0x0,0x0}}},
+{0x1d6d8,{{0x3c7,0x0,0x0}}},
+{0x1d6d9,{{0x3c8,0x0,0x0}}},
+{0x1d6da,{{0x3c9,0x0,0x0}}},
+{0x1d6db,{{0x2202,0x0,0x0}}},
+{0x1d6dc,{{0x3b5,0x0,0x0}}},
+{0x1d6dd,{{0x3b8,0x0,0x0}}},
+{0x1d6de,{{0x3ba,0x0,0x0}}},
+{0x1d6df,{{0x3c6,0x0,0x0}}},
+{0x1d6e0,{{0x3c1,0x0,0x0}}},
+{0x1d6e1,{{0x3c0,0x0,0x0}}},
+{0x1d6e2,{{0x3b1,0x0,0x0}}},
+{0x1d6e3,{{0x3b2,0x0,0x0}}},
+{0x1d6e4,{{0x3b3,0x0,0x0}}},
+{0x1d6e5,{{0x3b4,0x0,0x0}}},
+{0x1d6e6,{{0x3b5,0x0,0x0}}},
+{0x1d6e7,{{0x3b6,0x0,0x0}}},
+{0x1d6e8,{{0x3b7,0x0,0x0}}},
+{0x1d6e9,{{0x3b8,0x0,0x0}}},
+{0x1d6ea,{{0x3b9,0x0,0x0}}},
+{0x1d6eb,{{0x3ba,0x0,0x0}}},
+{0x1d6ec,{{0x3bb,0x0,0x0}}},
+{0x1d6ed,{{0x3bc,0x0,0x0}}},
+{0x1d6ee,{{0x3bd,0x0,0x0}}},
+{0x1d6ef,{{0x3be,0x0,0x0}}},
+{0x1d6f0,{{0x3bf,0x0,0x0}}},
+{0x1d6f1,{{0x3c0,0x0,0x0}}},
+{0x1d6f2,{{0x3c1,0x0,0x0}}},
+{0x1d6f3,{{0x3b8,0x0,0x0}}},
+{0x1d6f4,{{0x3c3,0x0,0x0}}},
+{0x1d6f5,{{0x3c4,0x0,0x0}}},
+{0x1d6f6,{{0x3c5,0x0,0x0}}},
+{0x1d6f7,{{0x3c6,0x0,0x0}}},
+{0x1d6f8,{{0x3c7,0x0,0x0}}},
+{0x1d6f9,{{0x3c8,0x0,0x0}}},
+{0x1d6fa,{{0x3c9,0x0,0x0}}},
+{0x1d6fb,{{0x2207,0x0,0x0}}},
+{0x1d6fc,{{0x3b1,0x0,0x0}}},
+{0x1d6fd,{{0x3b2,0x0,0x0}}},
+{0x1d6fe,{{0x3b3,0x0,0x0}}},
+{0x1d6ff,{{0x3b4,0x0,0x0}}},
+{0x1d700,{{0x3b5,0x0,0x0}}},
+{0x1d701,{{0x3b6,0x0,0x0}}},
+{0x1d702,{{0x3b7,0x0,0x0}}},
+{0x1d703,{{0x3b8,0x0,0x0}}},
+{0x1d704,{{0x3b9,0x0,0x0}}},
+{0x1d705,{{0x3ba,0x0,0x0}}},
+{0x1d706,{{0x3bb,0x0,0x0}}},
+{0x1d707,{{0x3bc,0x0,0x0}}},
+{0x1d708,{{0x3bd,0x0,0x0}}},
+{0x1d709,{{0x3be,0x0,0x0}}},
+{0x1d70a,{{0x3bf,0x0,0x0}}},
+{0x1d70b,{{0x3c0,0x0,0x0}}},
+{0x1d70c,{{0x3c1,0x0,0x0}}},
+{0x1d70d,{{0x3c3,0x0,0x0}}},
+{0x1d70e,{{0x3c3,0x0,0x0}}},
+{0x1d70f,{{0x3c4,0x0,0x0}}},
+{0x1d710,{{0x3c5,0x0,0x0}}},
+{0x1d711,{{0x3c6,0x0,0x0}}},
+{0x1d712,{{0x3c7,0x0,0x0}}},
+{0x1d713,{{0x3c8,0x0,0x0}}},
+{0x1d714,{{0x3c9,0x0,0x0}}},
+{0x1d715,{{0x2202,0x0,0x0}}},
+{0x1d716,{{0x3b5,0x0,0x0}}},
+{0x1d717,{{0x3b8,0x0,0x0}}},
+{0x1d718,{{0x3ba,0x0,0x0}}},
+{0x1d719,{{0x3c6,0x0,0x0}}},
+{0x1d71a,{{0x3c1,0x0,0x0}}},
+{0x1d71b,{{0x3c0,0x0,0x0}}},
+{0x1d71c,{{0x3b1,0x0,0x0}}},
+{0x1d71d,{{0x3b2,0x0,0x0}}},
+{0x1d71e,{{0x3b3,0x0,0x0}}},
+{0x1d71f,{{0x3b4,0x0,0x0}}},
+{0x1d720,{{0x3b5,0x0,0x0}}},
+{0x1d721,{{0x3b6,0x0,0x0}}},
+{0x1d722,{{0x3b7,0x0,0x0}}},
+{0x1d723,{{0x3b8,0x0,0x0}}},
+{0x1d724,{{0x3b9,0x0,0x0}}},
+{0x1d725,{{0x3ba,0x0,0x0}}},
+{0x1d726,{{0x3bb,0x0,0x0}}},
+{0x1d727,{{0x3bc,0x0,0x0}}},
+{0x1d728,{{0x3bd,0x0,0x0}}},
+{0x1d729,{{0x3be,0x0,0x0}}},
+{0x1d72a,{{0x3bf,0x0,0x0}}},
+{0x1d72b,{{0x3c0,0x0,0x0}}},
+{0x1d72c,{{0x3c1,0x0,0x0}}},
+{0x1d72d,{{0x3b8,0x0,0x0}}},
+{0x1d72e,{{0x3c3,0x0,0x0}}},
+{0x1d72f,{{0x3c4,0x0,0x0}}},
+{0x1d730,{{0x3c5,0x0,0x0}}},
+{0x1d731,{{0x3c6,0x0,0x0}}},
+{0x1d732,{{0x3c7,0x0,0x0}}},
+{0x1d733,{{0x3c8,0x0,0x0}}},
+{0x1d734,{{0x3c9,0x0,0x0}}},
+{0x1d735,{{0x2207,0x0,0x0}}},
+{0x1d736,{{0x3b1,0x0,0x0}}},
+{0x1d737,{{0x3b2,0x0,0x0}}},
+{0x1d738,{{0x3b3,0x0,0x0}}},
+{0x1d739,{{0x3b4,0x0,0x0}}},
+{0x1d73a,{{0x3b5,0x0,0x0}}},
+{0x1d73b,{{0x3b6,0x0,0x0}}},
+{0x1d73c,{{0x3b7,0x0,0x0}}},
+{0x1d73d,{{0x3b8,0x0,0x0}}},
+{0x1d73e,{{0x3b9,0x0,0x0}}},
+{0x1d73f,{{0x3ba,0x0,0x0}}},
+{0x1d740,{{0x3bb,0x0,0x0}}},
+{0x1d741,{{0x3bc,0x0,0x0}}},
+{0x1d742,{{0x3bd,0x0,0x0}}},
+{0x1d743,{{0x3be,0x0,0x0}}},
+{0x1d744,{{0x3bf,0x0,0x0}}},
+{0x1d745,{{0x3c0,0x0,0x0}}},
+{0x1d746,{{0x3c1,0x0,0x0}}},
+{0x1d747,{{0x3c3,0x0,0x0}}},
+{0x1d748,{{0x3c3,0x0,0x0}}},
+{0x1d749,{{0x3c4,0x0,0x0}}},
+{0x1d74a,{{0x3c5,0x0,0x0}}},
+{0x1d74b,{{0x3c6,0x0,0x0}}},
+{0x1d74c,{{0x3c7,0x0,0x0}}},
+{0x1d74d,{{0x3c8,0x0,0x0}}},
+{0x1d74e,{{0x3c9,0x0,0x0}}},
+{0x1d74f,{{0x2202,0x0,0x0}}},
+{0x1d750,{{0x3b5,0x0,0x0}}},
+{0x1d751,{{0x3b8,0x0,0x0}}},
+{0x1d752,{{0x3ba,0x0,0x0}}},
+{0x1d753,{{0x3c6,0x0,0x0}}},
+{0x1d754,{{0x3c1,0x0,0x0}}},
+{0x1d755,{{0x3c0,0x0,0x0}}},
+{0x1d756,{{0x3b1,0x0,0x0}}},
+{0x1d757,{{0x3b2,0x0,0x0}}},
+{0x1d758,{{0x3b3,0x0,0x0}}},
+{0x1d759,{{0x3b4,0x0,0x0}}},
+{0x1d75a,{{0x3b5,0x0,0x0}}},
+{0x1d75b,{{0x3b6,0x0,0x0}}},
+{0x1d75c,{{0x3b7,0x0,0x0}}},
+{0x1d75d,{{0x3b8,0x0,0x0}}},
+{0x1d75e,{{0x3b9,0x0,0x0}}},
+{0x1d75f,{{0x3ba,0x0,0x0}}},
+{0x1d760,{{0x3bb,0x0,0x0}}},
+{0x1d761,{{0x3bc,0x0,0x0}}},
+{0x1d762,{{0x3bd,0x0,0x0}}},
+{0x1d763,{{0x3be,0x0,0x0}}},
+{0x1d764,{{0x3bf,0x0,0x0}}},
+{0x1d765,{{0x3c0,0x0,0x0}}},
+{0x1d766,{{0x3c1,0x0,0x0}}},
+{0x1d767,{{0x3b8,0x0,0x0}}},
+{0x1d768,{{0x3c3,0x0,0x0}}},
+{0x1d769,{{0x3c4,0x0,0x0}}},
+{0x1d76a,{{0x3c5,0x0,0x0}}},
+{0x1d76b,{{0x3c6,0x0,0x0}}},
+{0x1d76c,{{0x3c7,0x0,0x0}}},
+{0x1d76d,{{0x3c8,0x0,0x0}}},
+{0x1d76e,{{0x3c9,0x0,0x0}}},
+{0x1d76f,{{0x2207,0x0,0x0}}},
+{0x1d770,{{0x3b1,0x0,0x0}}},
+{0x1d771,{{0x3b2,0x0,0x0}}},
+{0x1d772,{{0x3b3,0x0,0x0}}},
+{0x1d773,{{0x3b4,0x0,0x0}}},
+{0x1d774,{{0x3b5,0x0,0x0}}},
+{0x1d775,{{0x3b6,0x0,0x0}}},
+{0x1d776,{{0x3b7,0x0,0x0}}},
+{0x1d777,{{0x3b8,0x0,0x0}}},
+{0x1d778,{{0x3b9,0x0,0x0}}},
+{0x1d779,{{0x3ba,0x0,0x0}}},
+{0x1d77a,{{0x3bb,0x0,0x0}}},
+{0x1d77b,{{0x3bc,0x0,0x0}}},
+{0x1d77c,{{0x3bd,0x0,0x0}}},
+{0x1d77d,{{0x3be,0x0,0x0}}},
+{0x1d77e,{{0x3bf,0x0,0x0}}},
+{0x1d77f,{{0x3c0,0x0,0x0}}},
+{0x1d780,{{0x3c1,0x0,0x0}}},
+{0x1d781,{{0x3c3,0x0,0x0}}},
+{0x1d782,{{0x3c3,0x0,0x0}}},
+{0x1d783,{{0x3c4,0x0,0x0}}},
+{0x1d784,{{0x3c5,0x0,0x0}}},
+{0x1d785,{{0x3c6,0x0,0x0}}},
+{0x1d786,{{0x3c7,0x0,0x0}}},
+{0x1d787,{{0x3c8,0x0,0x0}}},
+{0x1d788,{{0x3c9,0x0,0x0}}},
+{0x1d789,{{0x2202,0x0,0x0}}},
+{0x1d78a,{{0x3b5,0x0,0x0}}},
+{0x1d78b,{{0x3b8,0x0,0x0}}},
+{0x1d78c,{{0x3ba,0x0,0x0}}},
+{0x1d78d,{{0x3c6,0x0,0x0}}},
+{0x1d78e,{{0x3c1,0x0,0x0}}},
+{0x1d78f,{{0x3c0,0x0,0x0}}},
+{0x1d790,{{0x3b1,0x0,0x0}}},
+{0x1d791,{{0x3b2,0x0,0x0}}},
+{0x1d792,{{0x3b3,0x0,0x0}}},
+{0x1d793,{{0x3b4,0x0,0x0}}},
+{0x1d794,{{0x3b5,0x0,0x0}}},
+{0x1d795,{{0x3b6,0x0,0x0}}},
+{0x1d796,{{0x3b7,0x0,0x0}}},
+{0x1d797,{{0x3b8,0x0,0x0}}},
+{0x1d798,{{0x3b9,0x0,0x0}}},
+{0x1d799,{{0x3ba,0x0,0x0}}},
+{0x1d79a,{{0x3bb,0x0,0x0}}},
+{0x1d79b,{{0x3bc,0x0,0x0}}},
+{0x1d79c,{{0x3bd,0x0,0x0}}},
+{0x1d79d,{{0x3be,0x0,0x0}}},
+{0x1d79e,{{0x3bf,0x0,0x0}}},
+{0x1d79f,{{0x3c0,0x0,0x0}}},
+{0x1d7a0,{{0x3c1,0x0,0x0}}},
+{0x1d7a1,{{0x3b8,0x0,0x0}}},
+{0x1d7a2,{{0x3c3,0x0,0x0}}},
+{0x1d7a3,{{0x3c4,0x0,0x0}}},
+{0x1d7a4,{{0x3c5,0x0,0x0}}},
+{0x1d7a5,{{0x3c6,0x0,0x0}}},
+{0x1d7a6,{{0x3c7,0x0,0x0}}},
+{0x1d7a7,{{0x3c8,0x0,0x0}}},
+{0x1d7a8,{{0x3c9,0x0,0x0}}},
+{0x1d7a9,{{0x2207,0x0,0x0}}},
+{0x1d7aa,{{0x3b1,0x0,0x0}}},
+{0x1d7ab,{{0x3b2,0x0,0x0}}},
+{0x1d7ac,{{0x3b3,0x0,0x0}}},
+{0x1d7ad,{{0x3b4,0x0,0x0}}},
+{0x1d7ae,{{0x3b5,0x0,0x0}}},
+{0x1d7af,{{0x3b6,0x0,0x0}}},
+{0x1d7b0,{{0x3b7,0x0,0x0}}},
+{0x1d7b1,{{0x3b8,0x0,0x0}}},
+{0x1d7b2,{{0x3b9,0x0,0x0}}},
+{0x1d7b3,{{0x3ba,0x0,0x0}}},
+{0x1d7b4,{{0x3bb,0x0,0x0}}},
+{0x1d7b5,{{0x3bc,0x0,0x0}}},
+{0x1d7b6,{{0x3bd,0x0,0x0}}},
+{0x1d7b7,{{0x3be,0x0,0x0}}},
+{0x1d7b8,{{0x3bf,0x0,0x0}}},
+{0x1d7b9,{{0x3c0,0x0,0x0}}},
+{0x1d7ba,{{0x3c1,0x0,0x0}}},
+{0x1d7bb,{{0x3c3,0x0,0x0}}},
+{0x1d7bc,{{0x3c3,0x0,0x0}}},
+{0x1d7bd,{{0x3c4,0x0,0x0}}},
+{0x1d7be,{{0x3c5,0x0,0x0}}},
+{0x1d7bf,{{0x3c6,0x0,0x0}}},
+{0x1d7c0,{{0x3c7,0x0,0x0}}},
+{0x1d7c1,{{0x3c8,0x0,0x0}}},
+{0x1d7c2,{{0x3c9,0x0,0x0}}},
+{0x1d7c3,{{0x2202,0x0,0x0}}},
+{0x1d7c4,{{0x3b5,0x0,0x0}}},
+{0x1d7c5,{{0x3b8,0x0,0x0}}},
+{0x1d7c6,{{0x3ba,0x0,0x0}}},
+{0x1d7c7,{{0x3c6,0x0,0x0}}},
+{0x1d7c8,{{0x3c1,0x0,0x0}}},
+{0x1d7c9,{{0x3c0,0x0,0x0}}},
+{0x1d7ca,{{0x3dd,0x0,0x0}}},
+{0x1d7cb,{{0x3dd,0x0,0x0}}},
+{0x1d7ce,{{0x30,0x0,0x0}}},
+{0x1d7cf,{{0x31,0x0,0x0}}},
+{0x1d7d0,{{0x32,0x0,0x0}}},
+{0x1d7d1,{{0x33,0x0,0x0}}},
+{0x1d7d2,{{0x34,0x0,0x0}}},
+{0x1d7d3,{{0x35,0x0,0x0}}},
+{0x1d7d4,{{0x36,0x0,0x0}}},
+{0x1d7d5,{{0x37,0x0,0x0}}},
+{0x1d7d6,{{0x38,0x0,0x0}}},
+{0x1d7d7,{{0x39,0x0,0x0}}},
+{0x1d7d8,{{0x30,0x0,0x0}}},
+{0x1d7d9,{{0x31,0x0,0x0}}},
+{0x1d7da,{{0x32,0x0,0x0}}},
+{0x1d7db,{{0x33,0x0,0x0}}},
+{0x1d7dc,{{0x34,0x0,0x0}}},
+{0x1d7dd,{{0x35,0x0,0x0}}},
+{0x1d7de,{{0x36,0x0,0x0}}},
+{0x1d7df,{{0x37,0x0,0x0}}},
+{0x1d7e0,{{0x38,0x0,0x0}}},
+{0x1d7e1,{{0x39,0x0,0x0}}},
+{0x1d7e2,{{0x30,0x0,0x0}}},
+{0x1d7e3,{{0x31,0x0,0x0}}},
+{0x1d7e4,{{0x32,0x0,0x0}}},
+{0x1d7e5,{{0x33,0x0,0x0}}},
+{0x1d7e6,{{0x34,0x0,0x0}}},
+{0x1d7e7,{{0x35,0x0,0x0}}},
+{0x1d7e8,{{0x36,0x0,0x0}}},
+{0x1d7e9,{{0x37,0x0,0x0}}},
+{0x1d7ea,{{0x38,0x0,0x0}}},
+{0x1d7eb,{{0x39,0x0,0x0}}},
+{0x1d7ec,{{0x30,0x0,0x0}}},
+{0x1d7ed,{{0x31,0x0,0x0}}},
+{0x1d7ee,{{0x32,0x0,0x0}}},
+{0x1d7ef,{{0x33,0x0,0x0}}},
+{0x1d7f0,{{0x34,0x0,0x0}}},
+{0x1d7f1,{{0x35,0x0,0x0}}},
+{0x1d7f2,{{0x36,0x0,0x0}}},
+{0x1d7f3,{{0x37,0x0,0x0}}},
+{0x1d7f4,{{0x38,0x0,0x0}}},
+{0x1d7f5,{{0x39,0x0,0x0}}},
+{0x1d7f6,{{0x30,0x0,0x0}}},
+{0x1d7f7,{{0x31,0x0,0x0}}},
+{0x1d7f8,{{0x32,0x0,0x0}}},
+{0x1d7f9,{{0x33,0x0,0x0}}},
+{0x1d7fa,{{0x34,0x0,0x0}}},
+{0x1d7fb,{{0x35,0x0,0x0}}},
+{0x1d7fc,{{0x36,0x0,0x0}}},
+{0x1d7fd,{{0x37,0x0,0x0}}},
+{0x1d7fe,{{0x38,0x0,0x0}}},
+{0x1d7ff,{{0x39,0x0,0x0}}},
+{0x1e030,{{0x430,0x0,0x0}}},
+{0x1e031,{{0x431,0x0,0x0}}},
+{0x1e032,{{0x432,0x0,0x0}}},
+{0x1e033,{{0x433,0x0,0x0}}},
+{0x1e034,{{0x434,0x0,0x0}}},
+{0x1e035,{{0x435,0x0,0x0}}},
+{0x1e036,{{0x436,0x0,0x0}}},
+{0x1e037,{{0x437,0x0,0x0}}},
+{0x1e038,{{0x438,0x0,0x0}}},
+{0x1e039,{{0x43a,0x0,0x0}}},
+{0x1e03a,{{0x43b,0x0,0x0}}},
+{0x1e03b,{{0x43c,0x0,0x0}}},
+{0x1e03c,{{0x43e,0x0,0x0}}},
+{0x1e03d,{{0x43f,0x0,0x0}}},
+{0x1e03e,{{0x440,0x0,0x0}}},
+{0x1e03f,{{0x441,0x0,0x0}}},
+{0x1e040,{{0x442,0x0,0x0}}},
+{0x1e041,{{0x443,0x0,0x0}}},
+{0x1e042,{{0x444,0x0,0x0}}},
+{0x1e043,{{0x445,0x0,0x0}}},
+{0x1e044,{{0x446,0x0,0x0}}},
+{0x1e045,{{0x447,0x0,0x0}}},
+{0x1e046,{{0x448,0x0,0x0}}},
+{0x1e047,{{0x44b,0x0,0x0}}},
+{0x1e048,{{0x44d,0x0,0x0}}},
+{0x1e049,{{0x44e,0x0,0x0}}},
+{0x1e04a,{{0xa689,0x0,0x0}}},
+{0x1e04b,{{0x4d9,0x0,0x0}}},
+{0x1e04c,{{0x456,0x0,0x0}}},
+{0x1e04d,{{0x458,0x0,0x0}}},
+{0x1e04e,{{0x4e9,0x0,0x0}}},
+{0x1e04f,{{0x4af,0x0,0x0}}},
+{0x1e050,{{0x4cf,0x0,0x0}}},
+{0x1e051,{{0x430,0x0,0x0}}},
+{0x1e052,{{0x431,0x0,0x0}}},
+{0x1e053,{{0x432,0x0,0x0}}},
+{0x1e054,{{0x433,0x0,0x0}}},
+{0x1e055,{{0x434,0x0,0x0}}},
+{0x1e056,{{0x435,0x0,0x0}}},
+{0x1e057,{{0x436,0x0,0x0}}},
+{0x1e058,{{0x437,0x0,0x0}}},
+{0x1e059,{{0x438,0x0,0x0}}},
+{0x1e05a,{{0x43a,0x0,0x0}}},
+{0x1e05b,{{0x43b,0x0,0x0}}},
+{0x1e05c,{{0x43e,0x0,0x0}}},
+{0x1e05d,{{0x43f,0x0,0x0}}},
+{0x1e05e,{{0x441,0x0,0x0}}},
+{0x1e05f,{{0x443,0x0,0x0}}},
+{0x1e060,{{0x444,0x0,0x0}}},
+{0x1e061,{{0x445,0x0,0x0}}},
+{0x1e062,{{0x446,0x0,0x0}}},
+{0x1e063,{{0x447,0x0,0x0}}},
+{0x1e064,{{0x448,0x0,0x0}}},
+{0x1e065,{{0x44a,0x0,0x0}}},
+{0x1e066,{{0x44b,0x0,0x0}}},
+{0x1e067,{{0x491,0x0,0x0}}},
+{0x1e068,{{0x456,0x0,0x0}}},
+{0x1e069,{{0x455,0x0,0x0}}},
+{0x1e06a,{{0x45f,0x0,0x0}}},
+{0x1e06b,{{0x4ab,0x0,0x0}}},
+{0x1e06c,{{0xa651,0x0,0x0}}},
+{0x1e06d,{{0x4b1,0x0,0x0}}},
+{0x1e900,{{0x1e922,0x0,0x0}}},
+{0x1e901,{{0x1e923,0x0,0x0}}},
+{0x1e902,{{0x1e924,0x0,0x0}}},
+{0x1e903,{{0x1e925,0x0,0x0}}},
+{0x1e904,{{0x1e926,0x0,0x0}}},
+{0x1e905,{{0x1e927,0x0,0x0}}},
+{0x1e906,{{0x1e928,0x0,0x0}}},
+{0x1e907,{{0x1e929,0x0,0x0}}},
+{0x1e908,{{0x1e92a,0x0,0x0}}},
+{0x1e909,{{0x1e92b,0x0,0x0}}},
+{0x1e90a,{{0x1e92c,0x0,0x0}}},
+{0x1e90b,{{0x1e92d,0x0,0x0}}},
+{0x1e90c,{{0x1e92e,0x0,0x0}}},
+{0x1e90d,{{0x1e92f,0x0,0x0}}},
+{0x1e90e,{{0x1e930,0x0,0x0}}},
+{0x1e90f,{{0x1e931,0x0,0x0}}},
+{0x1e910,{{0x1e932,0x0,0x0}}},
+{0x1e911,{{0x1e933,0x0,0x0}}},
+{0x1e912,{{0x1e934,0x0,0x0}}},
+{0x1e913,{{0x1e935,0x0,0x0}}},
+{0x1e914,{{0x1e936,0x0,0x0}}},
+{0x1e915,{{0x1e937,0x0,0x0}}},
+{0x1e916,{{0x1e938,0x0,0x0}}},
+{0x1e917,{{0x1e939,0x0,0x0}}},
+{0x1e918,{{0x1e93a,0x0,0x0}}},
+{0x1e919,{{0x1e93b,0x0,0x0}}},
+{0x1e91a,{{0x1e93c,0x0,0x0}}},
+{0x1e91b,{{0x1e93d,0x0,0x0}}},
+{0x1e91c,{{0x1e93e,0x0,0x0}}},
+{0x1e91d,{{0x1e93f,0x0,0x0}}},
+{0x1e91e,{{0x1e940,0x0,0x0}}},
+{0x1e91f,{{0x1e941,0x0,0x0}}},
+{0x1e920,{{0x1e942,0x0,0x0}}},
+{0x1e921,{{0x1e943,0x0,0x0}}},
+{0x1ee00,{{0x627,0x0,0x0}}},
+{0x1ee01,{{0x628,0x0,0x0}}},
+{0x1ee02,{{0x62c,0x0,0x0}}},
+{0x1ee03,{{0x62f,0x0,0x0}}},
+{0x1ee05,{{0x648,0x0,0x0}}},
+{0x1ee06,{{0x632,0x0,0x0}}},
+{0x1ee07,{{0x62d,0x0,0x0}}},
+{0x1ee08,{{0x637,0x0,0x0}}},
+{0x1ee09,{{0x64a,0x0,0x0}}},
+{0x1ee0a,{{0x643,0x0,0x0}}},
+{0x1ee0b,{{0x644,0x0,0x0}}},
+{0x1ee0c,{{0x645,0x0,0x0}}},
+{0x1ee0d,{{0x646,0x0,0x0}}},
+{0x1ee0e,{{0x633,0x0,0x0}}},
+{0x1ee0f,{{0x639,0x0,0x0}}},
+{0x1ee10,{{0x641,0x0,0x0}}},
+{0x1ee11,{{0x635,0x0,0x0}}},
+{0x1ee12,{{0x642,0x0,0x0}}},
+{0x1ee13,{{0x631,0x0,0x0}}},
+{0x1ee14,{{0x634,0x0,0x0}}},
+{0x1ee15,{{0x62a,0x0,0x0}}},
+{0x1ee16,{{0x62b,0x0,0x0}}},
+{0x1ee17,{{0x62e,0x0,0x0}}},
+{0x1ee18,{{0x630,0x0,0x0}}},
+{0x1ee19,{{0x636,0x0,0x0}}},
+{0x1ee1a,{{0x638,0x0,0x0}}},
+{0x1ee1b,{{0x63a,0x0,0x0}}},
+{0x1ee1c,{{0x66e,0x0,0x0}}},
+{0x1ee1d,{{0x6ba,0x0,0x0}}},
+{0x1ee1e,{{0x6a1,0x0,0x0}}},
+{0x1ee1f,{{0x66f,0x0,0x0}}},
+{0x1ee21,{{0x628,0x0,0x0}}},
+{0x1ee22,{{0x62c,0x0,0x0}}},
+{0x1ee24,{{0x647,0x0,0x0}}},
+{0x1ee27,{{0x62d,0x0,0x0}}},
+{0x1ee29,{{0x64a,0x0,0x0}}},
+{0x1ee2a,{{0x643,0x0,0x0}}},
+{0x1ee2b,{{0x644,0x0,0x0}}},
+{0x1ee2c,{{0x645,0x0,0x0}}},
+{0x1ee2d,{{0x646,0x0,0x0}}},
+{0x1ee2e,{{0x633,0x0,0x0}}},
+{0x1ee2f,{{0x639,0x0,0x0}}},
+{0x1ee30,{{0x641,0x0,0x0}}},
+{0x1ee31,{{0x635,0x0,0x0}}},
+{0x1ee32,{{0x642,0x0,0x0}}},
+{0x1ee34,{{0x634,0x0,0x0}}},
+{0x1ee35,{{0x62a,0x0,0x0}}},
+{0x1ee36,{{0x62b,0x0,0x0}}},
+{0x1ee37,{{0x62e,0x0,0x0}}},
+{0x1ee39,{{0x636,0x0,0x0}}},
+{0x1ee3b,{{0x63a,0x0,0x0}}},
+{0x1ee42,{{0x62c,0x0,0x0}}},
+{0x1ee47,{{0x62d,0x0,0x0}}},
+{0x1ee49,{{0x64a,0x0,0x0}}},
+{0x1ee4b,{{0x644,0x0,0x0}}},
+{0x1ee4d,{{0x646,0x0,0x0}}},
+{0x1ee4e,{{0x633,0x0,0x0}}},
+{0x1ee4f,{{0x639,0x0,0x0}}},
+{0x1ee51,{{0x635,0x0,0x0}}},
+{0x1ee52,{{0x642,0x0,0x0}}},
+{0x1ee54,{{0x634,0x0,0x0}}},
+{0x1ee57,{{0x62e,0x0,0x0}}},
+{0x1ee59,{{0x636,0x0,0x0}}},
+{0x1ee5b,{{0x63a,0x0,0x0}}},
+{0x1ee5d,{{0x6ba,0x0,0x0}}},
+{0x1ee5f,{{0x66f,0x0,0x0}}},
+{0x1ee61,{{0x628,0x0,0x0}}},
+{0x1ee62,{{0x62c,0x0,0x0}}},
+{0x1ee64,{{0x647,0x0,0x0}}},
+{0x1ee67,{{0x62d,0x0,0x0}}},
+{0x1ee68,{{0x637,0x0,0x0}}},
+{0x1ee69,{{0x64a,0x0,0x0}}},
+{0x1ee6a,{{0x643,0x0,0x0}}},
+{0x1ee6c,{{0x645,0x0,0x0}}},
+{0x1ee6d,{{0x646,0x0,0x0}}},
+{0x1ee6e,{{0x633,0x0,0x0}}},
+{0x1ee6f,{{0x639,0x0,0x0}}},
+{0x1ee70,{{0x641,0x0,0x0}}},
+{0x1ee71,{{0x635,0x0,0x0}}},
+{0x1ee72,{{0x642,0x0,0x0}}},
+{0x1ee74,{{0x634,0x0,0x0}}},
+{0x1ee75,{{0x62a,0x0,0x0}}},
+{0x1ee76,{{0x62b,0x0,0x0}}},
+{0x1ee77,{{0x62e,0x0,0x0}}},
+{0x1ee79,{{0x636,0x0,0x0}}},
+{0x1ee7a,{{0x638,0x0,0x0}}},
+{0x1ee7b,{{0x63a,0x0,0x0}}},
+{0x1ee7c,{{0x66e,0x0,0x0}}},
+{0x1ee7e,{{0x6a1,0x0,0x0}}},
+{0x1ee80,{{0x627,0x0,0x0}}},
+{0x1ee81,{{0x628,0x0,0x0}}},
+{0x1ee82,{{0x62c,0x0,0x0}}},
+{0x1ee83,{{0x62f,0x0,0x0}}},
+{0x1ee84,{{0x647,0x0,0x0}}},
+{0x1ee85,{{0x648,0x0,0x0}}},
+{0x1ee86,{{0x632,0x0,0x0}}},
+{0x1ee87,{{0x62d,0x0,0x0}}},
+{0x1ee88,{{0x637,0x0,0x0}}},
+{0x1ee89,{{0x64a,0x0,0x0}}},
+{0x1ee8b,{{0x644,0x0,0x0}}},
+{0x1ee8c,{{0x645,0x0,0x0}}},
+{0x1ee8d,{{0x646,0x0,0x0}}},
+{0x1ee8e,{{0x633,0x0,0x0}}},
+{0x1ee8f,{{0x639,0x0,0x0}}},
+{0x1ee90,{{0x641,0x0,0x0}}},
+{0x1ee91,{{0x635,0x0,0x0}}},
+{0x1ee92,{{0x642,0x0,0x0}}},
+{0x1ee93,{{0x631,0x0,0x0}}},
+{0x1ee94,{{0x634,0x0,0x0}}},
+{0x1ee95,{{0x62a,0x0,0x0}}},
+{0x1ee96,{{0x62b,0x0,0x0}}},
+{0x1ee97,{{0x62e,0x0,0x0}}},
+{0x1ee98,{{0x630,0x0,0x0}}},
+{0x1ee99,{{0x636,0x0,0x0}}},
+{0x1ee9a,{{0x638,0x0,0x0}}},
+{0x1ee9b,{{0x63a,0x0,0x0}}},
+{0x1eea1,{{0x628,0x0,0x0}}},
+{0x1eea2,{{0x62c,0x0,0x0}}},
+{0x1eea3,{{0x62f,0x0,0x0}}},
+{0x1eea5,{{0x648,0x0,0x0}}},
+{0x1eea6,{{0x632,0x0,0x0}}},
+{0x1eea7,{{0x62d,0x0,0x0}}},
+{0x1eea8,{{0x637,0x0,0x0}}},
+{0x1eea9,{{0x64a,0x0,0x0}}},
+{0x1eeab,{{0x644,0x0,0x0}}},
+{0x1eeac,{{0x645,0x0,0x0}}},
+{0x1eead,{{0x646,0x0,0x0}}},
+{0x1eeae,{{0x633,0x0,0x0}}},
+{0x1eeaf,{{0x639,0x0,0x0}}},
+{0x1eeb0,{{0x641,0x0,0x0}}},
+{0x1eeb1,{{0x635,0x0,0x0}}},
+{0x1eeb2,{{0x642,0x0,0x0}}},
+{0x1eeb3,{{0x631,0x0,0x0}}},
+{0x1eeb4,{{0x634,0x0,0x0}}},
+{0x1eeb5,{{0x62a,0x0,0x0}}},
+{0x1eeb6,{{0x62b,0x0,0x0}}},
+{0x1eeb7,{{0x62e,0x0,0x0}}},
+{0x1eeb8,{{0x630,0x0,0x0}}},
+{0x1eeb9,{{0x636,0x0,0x0}}},
+{0x1eeba,{{0x638,0x0,0x0}}},
+{0x1eebb,{{0x63a,0x0,0x0}}},
+{0x1f100,{{0x30,0x2e,0x0}}},
+{0x1f101,{{0x30,0x2c,0x0}}},
+{0x1f102,{{0x31,0x2c,0x0}}},
+{0x1f103,{{0x32,0x2c,0x0}}},
+{0x1f104,{{0x33,0x2c,0x0}}},
+{0x1f105,{{0x34,0x2c,0x0}}},
+{0x1f106,{{0x35,0x2c,0x0}}},
+{0x1f107,{{0x36,0x2c,0x0}}},
+{0x1f108,{{0x37,0x2c,0x0}}},
+{0x1f109,{{0x38,0x2c,0x0}}},
+{0x1f10a,{{0x39,0x2c,0x0}}},
+{0x1f110,{{0x28,0x61,0x29}}},
+{0x1f111,{{0x28,0x62,0x29}}},
+{0x1f112,{{0x28,0x63,0x29}}},
+{0x1f113,{{0x28,0x64,0x29}}},
+{0x1f114,{{0x28,0x65,0x29}}},
+{0x1f115,{{0x28,0x66,0x29}}},
+{0x1f116,{{0x28,0x67,0x29}}},
+{0x1f117,{{0x28,0x68,0x29}}},
+{0x1f118,{{0x28,0x69,0x29}}},
+{0x1f119,{{0x28,0x6a,0x29}}},
+{0x1f11a,{{0x28,0x6b,0x29}}},
+{0x1f11b,{{0x28,0x6c,0x29}}},
+{0x1f11c,{{0x28,0x6d,0x29}}},
+{0x1f11d,{{0x28,0x6e,0x29}}},
+{0x1f11e,{{0x28,0x6f,0x29}}},
+{0x1f11f,{{0x28,0x70,0x29}}},
+{0x1f120,{{0x28,0x71,0x29}}},
+{0x1f121,{{0x28,0x72,0x29}}},
+{0x1f122,{{0x28,0x73,0x29}}},
+{0x1f123,{{0x28,0x74,0x29}}},
+{0x1f124,{{0x28,0x75,0x29}}},
+{0x1f125,{{0x28,0x76,0x29}}},
+{0x1f126,{{0x28,0x77,0x29}}},
+{0x1f127,{{0x28,0x78,0x29}}},
+{0x1f128,{{0x28,0x79,0x29}}},
+{0x1f129,{{0x28,0x7a,0x29}}},
+{0x1f12a,{{0x3014,0x73,0x3015}}},
+{0x1f12b,{{0x63,0x0,0x0}}},
+{0x1f12c,{{0x72,0x0,0x0}}},
+{0x1f12d,{{0x63,0x64,0x0}}},
+{0x1f12e,{{0x77,0x7a,0x0}}},
+{0x1f130,{{0x61,0x0,0x0}}},
+{0x1f131,{{0x62,0x0,0x0}}},
+{0x1f132,{{0x63,0x0,0x0}}},
+{0x1f133,{{0x64,0x0,0x0}}},
+{0x1f134,{{0x65,0x0,0x0}}},
+{0x1f135,{{0x66,0x0,0x0}}},
+{0x1f136,{{0x67,0x0,0x0}}},
+{0x1f137,{{0x68,0x0,0x0}}},
+{0x1f138,{{0x69,0x0,0x0}}},
+{0x1f139,{{0x6a,0x0,0x0}}},
+{0x1f13a,{{0x6b,0x0,0x0}}},
+{0x1f13b,{{0x6c,0x0,0x0}}},
+{0x1f13c,{{0x6d,0x0,0x0}}},
+{0x1f13d,{{0x6e,0x0,0x0}}},
+{0x1f13e,{{0x6f,0x0,0x0}}},
+{0x1f13f,{{0x70,0x0,0x0}}},
+{0x1f140,{{0x71,0x0,0x0}}},
+{0x1f141,{{0x72,0x0,0x0}}},
+{0x1f142,{{0x73,0x0,0x0}}},
+{0x1f143,{{0x74,0x0,0x0}}},
+{0x1f144,{{0x75,0x0,0x0}}},
+{0x1f145,{{0x76,0x0,0x0}}},
+{0x1f146,{{0x77,0x0,0x0}}},
+{0x1f147,{{0x78,0x0,0x0}}},
+{0x1f148,{{0x79,0x0,0x0}}},
+{0x1f149,{{0x7a,0x0,0x0}}},
+{0x1f14a,{{0x68,0x76,0x0}}},
+{0x1f14b,{{0x6d,0x76,0x0}}},
+{0x1f14c,{{0x73,0x64,0x0}}},
+{0x1f14d,{{0x73,0x73,0x0}}},
+{0x1f14e,{{0x70,0x70,0x76}}},
+{0x1f14f,{{0x77,0x63,0x0}}},
+{0x1f16a,{{0x6d,0x63,0x0}}},
+{0x1f16b,{{0x6d,0x64,0x0}}},
+{0x1f16c,{{0x6d,0x72,0x0}}},
+{0x1f190,{{0x64,0x6a,0x0}}},
+{0x1f200,{{0x307b,0x304b,0x0}}},
+{0x1f201,{{0x30b3,0x30b3,0x0}}},
+{0x1f202,{{0x30b5,0x0,0x0}}},
+{0x1f210,{{0x624b,0x0,0x0}}},
+{0x1f211,{{0x5b57,0x0,0x0}}},
+{0x1f212,{{0x53cc,0x0,0x0}}},
+{0x1f213,{{0x30c7,0x0,0x0}}},
+{0x1f214,{{0x4e8c,0x0,0x0}}},
+{0x1f215,{{0x591a,0x0,0x0}}},
+{0x1f216,{{0x89e3,0x0,0x0}}},
+{0x1f217,{{0x5929,0x0,0x0}}},
+{0x1f218,{{0x4ea4,0x0,0x0}}},
+{0x1f219,{{0x6620,0x0,0x0}}},
+{0x1f21a,{{0x7121,0x0,0x0}}},
+{0x1f21b,{{0x6599,0x0,0x0}}},
+{0x1f21c,{{0x524d,0x0,0x0}}},
+{0x1f21d,{{0x5f8c,0x0,0x0}}},
+{0x1f21e,{{0x518d,0x0,0x0}}},
+{0x1f21f,{{0x65b0,0x0,0x0}}},
+{0x1f220,{{0x521d,0x0,0x0}}},
+{0x1f221,{{0x7d42,0x0,0x0}}},
+{0x1f222,{{0x751f,0x0,0x0}}},
+{0x1f223,{{0x8ca9,0x0,0x0}}},
+{0x1f224,{{0x58f0,0x0,0x0}}},
+{0x1f225,{{0x5439,0x0,0x0}}},
+{0x1f226,{{0x6f14,0x0,0x0}}},
+{0x1f227,{{0x6295,0x0,0x0}}},
+{0x1f228,{{0x6355,0x0,0x0}}},
+{0x1f229,{{0x4e00,0x0,0x0}}},
+{0x1f22a,{{0x4e09,0x0,0x0}}},
+{0x1f22b,{{0x904a,0x0,0x0}}},
+{0x1f22c,{{0x5de6,0x0,0x0}}},
+{0x1f22d,{{0x4e2d,0x0,0x0}}},
+{0x1f22e,{{0x53f3,0x0,0x0}}},
+{0x1f22f,{{0x6307,0x0,0x0}}},
+{0x1f230,{{0x8d70,0x0,0x0}}},
+{0x1f231,{{0x6253,0x0,0x0}}},
+{0x1f232,{{0x7981,0x0,0x0}}},
+{0x1f233,{{0x7a7a,0x0,0x0}}},
+{0x1f234,{{0x5408,0x0,0x0}}},
+{0x1f235,{{0x6e80,0x0,0x0}}},
+{0x1f236,{{0x6709,0x0,0x0}}},
+{0x1f237,{{0x6708,0x0,0x0}}},
+{0x1f238,{{0x7533,0x0,0x0}}},
+{0x1f239,{{0x5272,0x0,0x0}}},
+{0x1f23a,{{0x55b6,0x0,0x0}}},
+{0x1f23b,{{0x914d,0x0,0x0}}},
+{0x1f240,{{0x3014,0x672c,0x3015}}},
+{0x1f241,{{0x3014,0x4e09,0x3015}}},
+{0x1f242,{{0x3014,0x4e8c,0x3015}}},
+{0x1f243,{{0x3014,0x5b89,0x3015}}},
+{0x1f244,{{0x3014,0x70b9,0x3015}}},
+{0x1f245,{{0x3014,0x6253,0x3015}}},
+{0x1f246,{{0x3014,0x76d7,0x3015}}},
+{0x1f247,{{0x3014,0x52dd,0x3015}}},
+{0x1f248,{{0x3014,0x6557,0x3015}}},
+{0x1f250,{{0x5f97,0x0,0x0}}},
+{0x1f251,{{0x53ef,0x0,0x0}}},
+{0x1fbf0,{{0x30,0x0,0x0}}},
+{0x1fbf1,{{0x31,0x0,0x0}}},
+{0x1fbf2,{{0x32,0x0,0x0}}},
+{0x1fbf3,{{0x33,0x0,0x0}}},
+{0x1fbf4,{{0x34,0x0,0x0}}},
+{0x1fbf5,{{0x35,0x0,0x0}}},
+{0x1fbf6,{{0x36,0x0,0x0}}},
+{0x1fbf7,{{0x37,0x0,0x0}}},
+{0x1fbf8,{{0x38,0x0,0x0}}},
+{0x1fbf9,{{0x39,0x0,0x0}}},
+{0x2f800,{{0x4e3d,0x0,0x0}}},
+{0x2f801,{{0x4e38,0x0,0x0}}},
+{0x2f802,{{0x4e41,0x0,0x0}}},
+{0x2f803,{{0x20122,0x0,0x0}}},
+{0x2f804,{{0x4f60,0x0,0x0}}},
+{0x2f805,{{0x4fae,0x0,0x0}}},
+{0x2f806,{{0x4fbb,0x0,0x0}}},
+{0x2f807,{{0x5002,0x0,0x0}}},
+{0x2f808,{{0x507a,0x0,0x0}}},
+{0x2f809,{{0x5099,0x0,0x0}}},
+{0x2f80a,{{0x50e7,0x0,0x0}}},
+{0x2f80b,{{0x50cf,0x0,0x0}}},
+{0x2f80c,{{0x349e,0x0,0x0}}},
+{0x2f80d,{{0x2063a,0x0,0x0}}},
+{0x2f80e,{{0x514d,0x0,0x0}}},
+{0x2f80f,{{0x5154,0x0,0x0}}},
+{0x2f810,{{0x5164,0x0,0x0}}},
+{0x2f811,{{0x5177,0x0,0x0}}},
+{0x2f812,{{0x2051c,0x0,0x0}}},
+{0x2f813,{{0x34b9,0x0,0x0}}},
+{0x2f814,{{0x5167,0x0,0x0}}},
+{0x2f815,{{0x518d,0x0,0x0}}},
+{0x2f816,{{0x2054b,0x0,0x0}}},
+{0x2f817,{{0x5197,0x0,0x0}}},
+{0x2f818,{{0x51a4,0x0,0x0}}},
+{0x2f819,{{0x4ecc,0x0,0x0}}},
+{0x2f81a,{{0x51ac,0x0,0x0}}},
+{0x2f81b,{{0x51b5,0x0,0x0}}},
+{0x2f81c,{{0x291df,0x0,0x0}}},
+{0x2f81d,{{0x51f5,0x0,0x0}}},
+{0x2f81e,{{0x5203,0x0,0x0}}},
+{0x2f81f,{{0x34df,0x0,0x0}}},
+{0x2f820,{{0x523b,0x0,0x0}}},
+{0x2f821,{{0x5246,0x0,0x0}}},
+{0x2f822,{{0x5272,0x0,0x0}}},
+{0x2f823,{{0x5277,0x0,0x0}}},
+{0x2f824,{{0x3515,0x0,0x0}}},
+{0x2f825,{{0x52c7,0x0,0x0}}},
+{0x2f826,{{0x52c9,0x0,0x0}}},
+{0x2f827,{{0x52e4,0x0,0x0}}},
+{0x2f828,{{0x52fa,0x0,0x0}}},
+{0x2f829,{{0x5305,0x0,0x0}}},
+{0x2f82a,{{0x5306,0x0,0x0}}},
+{0x2f82b,{{0x5317,0x0,0x0}}},
+{0x2f82c,{{0x5349,0x0,0x0}}},
+{0x2f82d,{{0x5351,0x0,0x0}}},
+{0x2f82e,{{0x535a,0x0,0x0}}},
+{0x2f82f,{{0x5373,0x0,0x0}}},
+{0x2f830,{{0x537d,0x0,0x0}}},
+{0x2f831,{{0x537f,0x0,0x0}}},
+{0x2f832,{{0x537f,0x0,0x0}}},
+{0x2f833,{{0x537f,0x0,0x0}}},
+{0x2f834,{{0x20a2c,0x0,0x0}}},
+{0x2f835,{{0x7070,0x0,0x0}}},
+{0x2f836,{{0x53ca,0x0,0x0}}},
+{0x2f837,{{0x53df,0x0,0x0}}},
+{0x2f838,{{0x20b63,0x0,0x0}}},
+{0x2f839,{{0x53eb,0x0,0x0}}},
+{0x2f83a,{{0x53f1,0x0,0x0}}},
+{0x2f83b,{{0x5406,0x0,0x0}}},
+{0x2f83c,{{0x549e,0x0,0x0}}},
+{0x2f83d,{{0x5438,0x0,0x0}}},
+{0x2f83e,{{0x5448,0x0,0x0}}},
+{0x2f83f,{{0x5468,0x0,0x0}}},
+{0x2f840,{{0x54a2,0x0,0x0}}},
+{0x2f841,{{0x54f6,0x0,0x0}}},
+{0x2f842,{{0x5510,0x0,0x0}}},
+{0x2f843,{{0x5553,0x0,0x0}}},
+{0x2f844,{{0x5563,0x0,0x0}}},
+{0x2f845,{{0x5584,0x0,0x0}}},
+{0x2f846,{{0x5584,0x0,0x0}}},
+{0x2f847,{{0x5599,0x0,0x0}}},
+{0x2f848,{{0x55ab,0x0,0x0}}},
+{0x2f849,{{0x55b3,0x0,0x0}}},
+{0x2f84a,{{0x55c2,0x0,0x0}}},
+{0x2f84b,{{0x5716,0x0,0x0}}},
+{0x2f84c,{{0x5606,0x0,0x0}}},
+{0x2f84d,{{0x5717,0x0,0x0}}},
+{0x2f84e,{{0x5651,0x0,0x0}}},
+{0x2f84f,{{0x5674,0x0,0x0}}},
+{0x2f850,{{0x5207,0x0,0x0}}},
+{0x2f851,{{0x58ee,0x0,0x0}}},
+{0x2f852,{{0x57ce,0x0,0x0}}},
+{0x2f853,{{0x57f4,0x0,0x0}}},
+{0x2f854,{{0x580d,0x0,0x0}}},
+{0x2f855,{{0x578b,0x0,0x0}}},
+{0x2f856,{{0x5832,0x0,0x0}}},
+{0x2f857,{{0x5831,0x0,0x0}}},
+{0x2f858,{{0x58ac,0x0,0x0}}},
+{0x2f859,{{0x214e4,0x0,0x0}}},
+{0x2f85a,{{0x58f2,0x0,0x0}}},
+{0x2f85b,{{0x58f7,0x0,0x0}}},
+{0x2f85c,{{0x5906,0x0,0x0}}},
+{0x2f85d,{{0x591a,0x0,0x0}}},
+{0x2f85e,{{0x5922,0x0,0x0}}},
+{0x2f85f,{{0x5962,0x0,0x0}}},
+{0x2f860,{{0x216a8,0x0,0x0}}},
+{0x2f861,{{0x216ea,0x0,0x0}}},
+{0x2f862,{{0x59ec,0x0,0x0}}},
+{0x2f863,{{0x5a1b,0x0,0x0}}},
+{0x2f864,{{0x5a27,0x0,0x0}}},
+{0x2f865,{{0x59d8,0x0,0x0}}},
+{0x2f866,{{0x5a66,0x0,0x0}}},
+{0x2f867,{{0x36ee,0x0,0x0}}},
+{0x2f868,{{0x36fc,0x0,0x0}}},
+{0x2f869,{{0x5b08,0x0,0x0}}},
+{0x2f86a,{{0x5b3e,0x0,0x0}}},
+{0x2f86b,{{0x5b3e,0x0,0x0}}},
+{0x2f86c,{{0x219c8,0x0,0x0}}},
+{0x2f86d,{{0x5bc3,0x0,0x0}}},
+{0x2f86e,{{0x5bd8,0x0,0x0}}},
+{0x2f86f,{{0x5be7,0x0,0x0}}},
+{0x2f870,{{0x5bf3,0x0,0x0}}},
+{0x2f871,{{0x21b18,0x0,0x0}}},
+{0x2f872,{{0x5bff,0x0,0x0}}},
+{0x2f873,{{0x5c06,0x0,0x0}}},
+{0x2f874,{{0x5f53,0x0,0x0}}},
+{0x2f875,{{0x5c22,0x0,0x0}}},
+{0x2f876,{{0x3781,0x0,0x0}}},
+{0x2f877,{{0x5c60,0x0,0x0}}},
+{0x2f878,{{0x5c6e,0x0,0x0}}},
+{0x2f879,{{0x5cc0,0x0,0x0}}},
+{0x2f87a,{{0x5c8d,0x0,0x0}}},
+{0x2f87b,{{0x21de4,0x0,0x0}}},
+{0x2f87c,{{0x5d43,0x0,0x0}}},
+{0x2f87d,{{0x21de6,0x0,0x0}}},
+{0x2f87e,{{0x5d6e,0x0,0x0}}},
+{0x2f87f,{{0x5d6b,0x0,0x0}}},
+{0x2f880,{{0x5d7c,0x0,0x0}}},
+{0x2f881,{{0x5de1,0x0,0x0}}},
+{0x2f882,{{0x5de2,0x0,0x0}}},
+{0x2f883,{{0x382f,0x0,0x0}}},
+{0x2f884,{{0x5dfd,0x0,0x0}}},
+{0x2f885,{{0x5e28,0x0,0x0}}},
+{0x2f886,{{0x5e3d,0x0,0x0}}},
+{0x2f887,{{0x5e69,0x0,0x0}}},
+{0x2f888,{{0x3862,0x0,0x0}}},
+{0x2f889,{{0x22183,0x0,0x0}}},
+{0x2f88a,{{0x387c,0x0,0x0}}},
+{0x2f88b,{{0x5eb0,0x0,0x0}}},
+{0x2f88c,{{0x5eb3,0x0,0x0}}},
+{0x2f88d,{{0x5eb6,0x0,0x0}}},
+{0x2f88e,{{0x5eca,0x0,0x0}}},
+{0x2f88f,{{0x2a392,0x0,0x0}}},
+{0x2f890,{{0x5efe,0x0,0x0}}},
+{0x2f891,{{0x22331,0x0,0x0}}},
+{0x2f892,{{0x22331,0x0,0x0}}},
+{0x2f893,{{0x8201,0x0,0x0}}},
+{0x2f894,{{0x5f22,0x0,0x0}}},
+{0x2f895,{{0x5f22,0x0,0x0}}},
+{0x2f896,{{0x38c7,0x0,0x0}}},
+{0x2f897,{{0x232b8,0x0,0x0}}},
+{0x2f898,{{0x261da,0x0,0x0}}},
+{0x2f899,{{0x5f62,0x0,0x0}}},
+{0x2f89a,{{0x5f6b,0x0,0x0}}},
+{0x2f89b,{{0x38e3,0x0,0x0}}},
+{0x2f89c,{{0x5f9a,0x0,0x0}}},
+{0x2f89d,{{0x5fcd,0x0,0x0}}},
+{0x2f89e,{{0x5fd7,0x0,0x0}}},
+{0x2f89f,{{0x5ff9,0x0,0x0}}},
+{0x2f8a0,{{0x6081,0x0,0x0}}},
+{0x2f8a1,{{0x393a,0x0,0x0}}},
+{0x2f8a2,{{0x391c,0x0,0x0}}},
+{0x2f8a3,{{0x6094,0x0,0x0}}},
+{0x2f8a4,{{0x226d4,0x0,0x0}}},
+{0x2f8a5,{{0x60c7,0x0,0x0}}},
+{0x2f8a6,{{0x6148,0x0,0x0}}},
+{0x2f8a7,{{0x614c,0x0,0x0}}},
+{0x2f8a8,{{0x614e,0x0,0x0}}},
+{0x2f8a9,{{0x614c,0x0,0x0}}},
+{0x2f8aa,{{0x617a,0x0,0x0}}},
+{0x2f8ab,{{0x618e,0x0,0x0}}},
+{0x2f8ac,{{0x61b2,0x0,0x0}}},
+{0x2f8ad,{{0x61a4,0x0,0x0}}},
+{0x2f8ae,{{0x61af,0x0,0x0}}},
+{0x2f8af,{{0x61de,0x0,0x0}}},
+{0x2f8b0,{{0x61f2,0x0,0x0}}},
+{0x2f8b1,{{0x61f6,0x0,0x0}}},
+{0x2f8b2,{{0x6210,0x0,0x0}}},
+{0x2f8b3,{{0x621b,0x0,0x0}}},
+{0x2f8b4,{{0x625d,0x0,0x0}}},
+{0x2f8b5,{{0x62b1,0x0,0x0}}},
+{0x2f8b6,{{0x62d4,0x0,0x0}}},
+{0x2f8b7,{{0x6350,0x0,0x0}}},
+{0x2f8b8,{{0x22b0c,0x0,0x0}}},
+{0x2f8b9,{{0x633d,0x0,0x0}}},
+{0x2f8ba,{{0x62fc,0x0,0x0}}},
+{0x2f8bb,{{0x6368,0x0,0x0}}},
+{0x2f8bc,{{0x6383,0x0,0x0}}},
+{0x2f8bd,{{0x63e4,0x0,0x0}}},
+{0x2f8be,{{0x22bf1,0x0,0x0}}},
+{0x2f8bf,{{0x6422,0x0,0x0}}},
+{0x2f8c0,{{0x63c5,0x0,0x0}}},
+{0x2f8c1,{{0x63a9,0x0,0x0}}},
+{0x2f8c2,{{0x3a2e,0x0,0x0}}},
+{0x2f8c3,{{0x6469,0x0,0x0}}},
+{0x2f8c4,{{0x647e,0x0,0x0}}},
+{0x2f8c5,{{0x649d,0x0,0x0}}},
+{0x2f8c6,{{0x6477,0x0,0x0}}},
+{0x2f8c7,{{0x3a6c,0x0,0x0}}},
+{0x2f8c8,{{0x654f,0x0,0x0}}},
+{0x2f8c9,{{0x656c,0x0,0x0}}},
+{0x2f8ca,{{0x2300a,0x0,0x0}}},
+{0x2f8cb,{{0x65e3,0x0,0x0}}},
+{0x2f8cc,{{0x66f8,0x0,0x0}}},
+{0x2f8cd,{{0x6649,0x0,0x0}}},
+{0x2f8ce,{{0x3b19,0x0,0x0}}},
+{0x2f8cf,{{0x6691,0x0,0x0}}},
+{0x2f8d0,{{0x3b08,0x0,0x0}}},
+{0x2f8d1,{{0x3ae4,0x0,0x0}}},
+{0x2f8d2,{{0x5192,0x0,0x0}}},
+{0x2f8d3,{{0x5195,0x0,0x0}}},
+{0x2f8d4,{{0x6700,0x0,0x0}}},
+{0x2f8d5,{{0x669c,0x0,0x0}}},
+{0x2f8d6,{{0x80ad,0x0,0x0}}},
+{0x2f8d7,{{0x43d9,0x0,0x0}}},
+{0x2f8d8,{{0x6717,0x0,0x0}}},
+{0x2f8d9,{{0x671b,0x0,0x0}}},
+{0x2f8da,{{0x6721,0x0,0x0}}},
+{0x2f8db,{{0x675e,0x0,0x0}}},
+{0x2f8dc,{{0x6753,0x0,0x0}}},
+{0x2f8dd,{{0x233c3,0x0,0x0}}},
+{0x2f8de,{{0x3b49,0x0,0x0}}},
+{0x2f8df,{{0x67fa,0x0,0x0}}},
+{0x2f8e0,{{0x6785,0x0,0x0}}},
+{0x2f8e1,{{0x6852,0x0,0x0}}},
+{0x2f8e2,{{0x6885,0x0,0x0}}},
+{0x2f8e3,{{0x2346d,0x0,0x0}}},
+{0x2f8e4,{{0x688e,0x0,0x0}}},
+{0x2f8e5,{{0x681f,0x0,0x0}}},
+{0x2f8e6,{{0x6914,0x0,0x0}}},
+{0x2f8e7,{{0x3b9d,0x0,0x0}}},
+{0x2f8e8,{{0x6942,0x0,0x0}}},
+{0x2f8e9,{{0x69a3,0x0,0x0}}},
+{0x2f8ea,{{0x69ea,0x0,0x0}}},
+{0x2f8eb,{{0x6aa8,0x0,0x0}}},
+{0x2f8ec,{{0x236a3,0x0,0x0}}},
+{0x2f8ed,{{0x6adb,0x0,0x0}}},
+{0x2f8ee,{{0x3c18,0x0,0x0}}},
+{0x2f8ef,{{0x6b21,0x0,0x0}}},
+{0x2f8f0,{{0x238a7,0x0,0x0}}},
+{0x2f8f1,{{0x6b54,0x0,0x0}}},
+{0x2f8f2,{{0x3c4e,0x0,0x0}}},
+{0x2f8f3,{{0x6b72,0x0,0x0}}},
+{0x2f8f4,{{0x6b9f,0x0,0x0}}},
+{0x2f8f5,{{0x6bba,0x0,0x0}}},
+{0x2f8f6,{{0x6bbb,0x0,0x0}}},
+{0x2f8f7,{{0x23a8d,0x0,0x0}}},
+{0x2f8f8,{{0x21d0b,0x0,0x0}}},
+{0x2f8f9,{{0x23afa,0x0,0x0}}},
+{0x2f8fa,{{0x6c4e,0x0,0x0}}},
+{0x2f8fb,{{0x23cbc,0x0,0x0}}},
+{0x2f8fc,{{0x6cbf,0x0,0x0}}},
+{0x2f8fd,{{0x6ccd,0x0,0x0}}},
+{0x2f8fe,{{0x6c67,0x0,0x0}}},
+{0x2f8ff,{{0x6d16,0x0,0x0}}},
+{0x2f900,{{0x6d3e,0x0,0x0}}},
+{0x2f901,{{0x6d77,0x0,0x0}}},
+{0x2f902,{{0x6d41,0x0,0x0}}},
+{0x2f903,{{0x6d69,0x0,0x0}}},
+{0x2f904,{{0x6d78,0x0,0x0}}},
+{0x2f905,{{0x6d85,0x0,0x0}}},
+{0x2f906,{{0x23d1e,0x0,0x0}}},
+{0x2f907,{{0x6d34,0x0,0x0}}},
+{0x2f908,{{0x6e2f,0x0,0x0}}},
+{0x2f909,{{0x6e6e,0x0,0x0}}},
+{0x2f90a,{{0x3d33,0x0,0x0}}},
+{0x2f90b,{{0x6ecb,0x0,0x0}}},
+{0x2f90c,{{0x6ec7,0x0,0x0}}},
+{0x2f90d,{{0x23ed1,0x0,0x0}}},
+{0x2f90e,{{0x6df9,0x0,0x0}}},
+{0x2f90f,{{0x6f6e,0x0,0x0}}},
+{0x2f910,{{0x23f5e,0x0,0x0}}},
+{0x2f911,{{0x23f8e,0x0,0x0}}},
+{0x2f912,{{0x6fc6,0x0,0x0}}},
+{0x2f913,{{0x7039,0x0,0x0}}},
+{0x2f914,{{0x701e,0x0,0x0}}},
+{0x2f915,{{0x701b,0x0,0x0}}},
+{0x2f916,{{0x3d96,0x0,0x0}}},
+{0x2f917,{{0x704a,0x0,0x0}}},
+{0x2f918,{{0x707d,0x0,0x0}}},
+{0x2f919,{{0x7077,0x0,0x0}}},
+{0x2f91a,{{0x70ad,0x0,0x0}}},
+{0x2f91b,{{0x20525,0x0,0x0}}},
+{0x2f91c,{{0x7145,0x0,0x0}}},
+{0x2f91d,{{0x24263,0x0,0x0}}},
+{0x2f91e,{{0x719c,0x0,0x0}}},
+{0x2f91f,{{0x243ab,0x0,0x0}}},
+{0x2f920,{{0x7228,0x0,0x0}}},
+{0x2f921,{{0x7235,0x0,0x0}}},
+{0x2f922,{{0x7250,0x0,0x0}}},
+{0x2f923,{{0x24608,0x0,0x0}}},
+{0x2f924,{{0x7280,0x0,0x0}}},
+{0x2f925,{{0x7295,0x0,0x0}}},
+{0x2f926,{{0x24735,0x0,0x0}}},
+{0x2f927,{{0x24814,0x0,0x0}}},
+{0x2f928,{{0x737a,0x0,0x0}}},
+{0x2f929,{{0x738b,0x0,0x0}}},
+{0x2f92a,{{0x3eac,0x0,0x0}}},
+{0x2f92b,{{0x73a5,0x0,0x0}}},
+{0x2f92c,{{0x3eb8,0x0,0x0}}},
+{0x2f92d,{{0x3eb8,0x0,0x0}}},
+{0x2f92e,{{0x7447,0x0,0x0}}},
+{0x2f92f,{{0x745c,0x0,0x0}}},
+{0x2f930,{{0x7471,0x0,0x0}}},
+{0x2f931,{{0x7485,0x0,0x0}}},
+{0x2f932,{{0x74ca,0x0,0x0}}},
+{0x2f933,{{0x3f1b,0x0,0x0}}},
+{0x2f934,{{0x7524,0x0,0x0}}},
+{0x2f935,{{0x24c36,0x0,0x0}}},
+{0x2f936,{{0x753e,0x0,0x0}}},
+{0x2f937,{{0x24c92,0x0,0x0}}},
+{0x2f938,{{0x7570,0x0,0x0}}},
+{0x2f939,{{0x2219f,0x0,0x0}}},
+{0x2f93a,{{0x7610,0x0,0x0}}},
+{0x2f93b,{{0x24fa1,0x0,0x0}}},
+{0x2f93c,{{0x24fb8,0x0,0x0}}},
+{0x2f93d,{{0x25044,0x0,0x0}}},
+{0x2f93e,{{0x3ffc,0x0,0x0}}},
+{0x2f93f,{{0x4008,0x0,0x0}}},
+{0x2f940,{{0x76f4,0x0,0x0}}},
+{0x2f941,{{0x250f3,0x0,0x0}}},
+{0x2f942,{{0x250f2,0x0,0x0}}},
+{0x2f943,{{0x25119,0x0,0x0}}},
+{0x2f944,{{0x25133,0x0,0x0}}},
+{0x2f945,{{0x771e,0x0,0x0}}},
+{0x2f946,{{0x771f,0x0,0x0}}},
+{0x2f947,{{0x771f,0x0,0x0}}},
+{0x2f948,{{0x774a,0x0,0x0}}},
+{0x2f949,{{0x4039,0x0,0x0}}},
+{0x2f94a,{{0x778b,0x0,0x0}}},
+{0x2f94b,{{0x4046,0x0,0x0}}},
+{0x2f94c,{{0x4096,0x0,0x0}}},
+{0x2f94d,{{0x2541d,0x0,0x0}}},
+{0x2f94e,{{0x784e,0x0,0x0}}},
+{0x2f94f,{{0x788c,0x0,0x0}}},
+{0x2f950,{{0x78cc,0x0,0x0}}},
+{0x2f951,{{0x40e3,0x0,0x0}}},
+{0x2f952,{{0x25626,0x0,0x0}}},
+{0x2f953,{{0x7956,0x0,0x0}}},
+{0x2f954,{{0x2569a,0x0,0x0}}},
+{0x2f955,{{0x256c5,0x0,0x0}}},
+{0x2f956,{{0x798f,0x0,0x0}}},
+{0x2f957,{{0x79eb,0x0,0x0}}},
+{0x2f958,{{0x412f,0x0,0x0}}},
+{0x2f959,{{0x7a40,0x0,0x0}}},
+{0x2f95a,{{0x7a4a,0x0,0x0}}},
+{0x2f95b,{{0x7a4f,0x0,0x0}}},
+{0x2f95c,{{0x2597c,0x0,0x0}}},
+{0x2f95d,{{0x25aa7,0x0,0x0}}},
+{0x2f95e,{{0x25aa7,0x0,0x0}}},
+{0x2f95f,{{0x7aee,0x0,0x0}}},
+{0x2f960,{{0x4202,0x0,0x0}}},
+{0x2f961,{{0x25bab,0x0,0x0}}},
+{0x2f962,{{0x7bc6,0x0,0x0}}},
+{0x2f963,{{0x7bc9,0x0,0x0}}},
+{0x2f964,{{0x4227,0x0,0x0}}},
+{0x2f965,{{0x25c80,0x0,0x0}}},
+{0x2f966,{{0x7cd2,0x0,0x0}}},
+{0x2f967,{{0x42a0,0x0,0x0}}},
+{0x2f968,{{0x7ce8,0x0,0x0}}},
+{0x2f969,{{0x7ce3,0x0,0x0}}},
+{0x2f96a,{{0x7d00,0x0,0x0}}},
+{0x2f96b,{{0x25f86,0x0,0x0}}},
+{0x2f96c,{{0x7d63,0x0,0x0}}},
+{0x2f96d,{{0x4301,0x0,0x0}}},
+{0x2f96e,{{0x7dc7,0x0,0x0}}},
+{0x2f96f,{{0x7e02,0x0,0x0}}},
+{0x2f970,{{0x7e45,0x0,0x0}}},
+{0x2f971,{{0x4334,0x0,0x0}}},
+{0x2f972,{{0x26228,0x0,0x0}}},
+{0x2f973,{{0x26247,0x0,0x0}}},
+{0x2f974,{{0x4359,0x0,0x0}}},
+{0x2f975,{{0x262d9,0x0,0x0}}},
+{0x2f976,{{0x7f7a,0x0,0x0}}},
+{0x2f977,{{0x2633e,0x0,0x0}}},
+{0x2f978,{{0x7f95,0x0,0x0}}},
+{0x2f979,{{0x7ffa,0x0,0x0}}},
+{0x2f97a,{{0x8005,0x0,0x0}}},
+{0x2f97b,{{0x264da,0x0,0x0}}},
+{0x2f97c,{{0x26523,0x0,0x0}}},
+{0x2f97d,{{0x8060,0x0,0x0}}},
+{0x2f97e,{{0x265a8,0x0,0x0}}},
+{0x2f97f,{{0x8070,0x0,0x0}}},
+{0x2f980,{{0x2335f,0x0,0x0}}},
+{0x2f981,{{0x43d5,0x0,0x0}}},
+{0x2f982,{{0x80b2,0x0,0x0}}},
+{0x2f983,{{0x8103,0x0,0x0}}},
+{0x2f984,{{0x440b,0x0,0x0}}},
+{0x2f985,{{0x813e,0x0,0x0}}},
+{0x2f986,{{0x5ab5,0x0,0x0}}},
+{0x2f987,{{0x267a7,0x0,0x0}}},
+{0x2f988,{{0x267b5,0x0,0x0}}},
+{0x2f989,{{0x23393,0x0,0x0}}},
+{0x2f98a,{{0x2339c,0x0,0x0}}},
+{0x2f98b,{{0x8201,0x0,0x0}}},
+{0x2f98c,{{0x8204,0x0,0x0}}},
+{0x2f98d,{{0x8f9e,0x0,0x0}}},
+{0x2f98e,{{0x446b,0x0,0x0}}},
+{0x2f98f,{{0x8291,0x0,0x0}}},
+{0x2f990,{{0x828b,0x0,0x0}}},
+{0x2f991,{{0x829d,0x0,0x0}}},
+{0x2f992,{{0x52b3,0x0,0x0}}},
+{0x2f993,{{0x82b1,0x0,0x0}}},
+{0x2f994,{{0x82b3,0x0,0x0}}},
+{0x2f995,{{0x82bd,0x0,0x0}}},
+{0x2f996,{{0x82e6,0x0,0x0}}},
+{0x2f997,{{0x26b3c,0x0,0x0}}},
+{0x2f998,{{0x82e5,0x0,0x0}}},
+{0x2f999,{{0x831d,0x0,0x0}}},
+{0x2f99a,{{0x8363,0x0,0x0}}},
+{0x2f99b,{{0x83ad,0x0,0x0}}},
+{0x2f99c,{{0x8323,0x0,0x0}}},
+{0x2f99d,{{0x83bd,0x0,0x0}}},
+{0x2f99e,{{0x83e7,0x0,0x0}}},
+{0x2f99f,{{0x8457,0x0,0x0}}},
+{0x2f9a0,{{0x8353,0x0,0x0}}},
+{0x2f9a1,{{0x83ca,0x0,0x0}}},
+{0x2f9a2,{{0x83cc,0x0,0x0}}},
+{0x2f9a3,{{0x83dc,0x0,0x0}}},
+{0x2f9a4,{{0x26c36,0x0,0x0}}},
+{0x2f9a5,{{0x26d6b,0x0,0x0}}},
+{0x2f9a6,{{0x26cd5,0x0,0x0}}},
+{0x2f9a7,{{0x452b,0x0,0x0}}},
+{0x2f9a8,{{0x84f1,0x0,0x0}}},
+{0x2f9a9,{{0x84f3,0x0,0x0}}},
+{0x2f9aa,{{0x8516,0x0,0x0}}},
+{0x2f9ab,{{0x273ca,0x0,0x0}}},
+{0x2f9ac,{{0x8564,0x0,0x0}}},
+{0x2f9ad,{{0x26f2c,0x0,0x0}}},
+{0x2f9ae,{{0x455d,0x0,0x0}}},
+{0x2f9af,{{0x4561,0x0,0x0}}},
+{0x2f9b0,{{0x26fb1,0x0,0x0}}},
+{0x2f9b1,{{0x270d2,0x0,0x0}}},
+{0x2f9b2,{{0x456b,0x0,0x0}}},
+{0x2f9b3,{{0x8650,0x0,0x0}}},
+{0x2f9b4,{{0x865c,0x0,0x0}}},
+{0x2f9b5,{{0x8667,0x0,0x0}}},
+{0x2f9b6,{{0x8669,0x0,0x0}}},
+{0x2f9b7,{{0x86a9,0x0,0x0}}},
+{0x2f9b8,{{0x8688,0x0,0x0}}},
+{0x2f9b9,{{0x870e,0x0,0x0}}},
+{0x2f9ba,{{0x86e2,0x0,0x0}}},
+{0x2f9bb,{{0x8779,0x0,0x0}}},
+{0x2f9bc,{{0x8728,0x0,0x0}}},
+{0x2f9bd,{{0x876b,0x0,0x0}}},
+{0x2f9be,{{0x8786,0x0,0x0}}},
+{0x2f9bf,{{0x45d7,0x0,0x0}}},
+{0x2f9c0,{{0x87e1,0x0,0x0}}},
+{0x2f9c1,{{0x8801,0x0,0x0}}},
+{0x2f9c2,{{0x45f9,0x0,0x0}}},
+{0x2f9c3,{{0x8860,0x0,0x0}}},
+{0x2f9c4,{{0x8863,0x0,0x0}}},
+{0x2f9c5,{{0x27667,0x0,0x0}}},
+{0x2f9c6,{{0x88d7,0x0,0x0}}},
+{0x2f9c7,{{0x88de,0x0,0x0}}},
+{0x2f9c8,{{0x4635,0x0,0x0}}},
+{0x2f9c9,{{0x88fa,0x0,0x0}}},
+{0x2f9ca,{{0x34bb,0x0,0x0}}},
+{0x2f9cb,{{0x278ae,0x0,0x0}}},
+{0x2f9cc,{{0x27966,0x0,0x0}}},
+{0x2f9cd,{{0x46be,0x0,0x0}}},
+{0x2f9ce,{{0x46c7,0x0,0x0}}},
+{0x2f9cf,{{0x8aa0,0x0,0x0}}},
+{0x2f9d0,{{0x8aed,0x0,0x0}}},
+{0x2f9d1,{{0x8b8a,0x0,0x0}}},
+{0x2f9d2,{{0x8c55,0x0,0x0}}},
+{0x2f9d3,{{0x27ca8,0x0,0x0}}},
+{0x2f9d4,{{0x8cab,0x0,0x0}}},
+{0x2f9d5,{{0x8cc1,0x0,0x0}}},
+{0x2f9d6,{{0x8d1b,0x0,0x0}}},
+{0x2f9d7,{{0x8d77,0x0,0x0}}},
+{0x2f9d8,{{0x27f2f,0x0,0x0}}},
+{0x2f9d9,{{0x20804,0x0,0x0}}},
+{0x2f9da,{{0x8dcb,0x0,0x0}}},
+{0x2f9db,{{0x8dbc,0x0,0x0}}},
+{0x2f9dc,{{0x8df0,0x0,0x0}}},
+{0x2f9dd,{{0x208de,0x0,0x0}}},
+{0x2f9de,{{0x8ed4,0x0,0x0}}},
+{0x2f9df,{{0x8f38,0x0,0x0}}},
+{0x2f9e0,{{0x285d2,0x0,0x0}}},
+{0x2f9e1,{{0x285ed,0x0,0x0}}},
+{0x2f9e2,{{0x9094,0x0,0x0}}},
+{0x2f9e3,{{0x90f1,0x0,0x0}}},
+{0x2f9e4,{{0x9111,0x0,0x0}}},
+{0x2f9e5,{{0x2872e,0x0,0x0}}},
+{0x2f9e6,{{0x911b,0x0,0x0}}},
+{0x2f9e7,{{0x9238,0x0,0x0}}},
+{0x2f9e8,{{0x92d7,0x0,0x0}}},
+{0x2f9e9,{{0x92d8,0x0,0x0}}},
+{0x2f9ea,{{0x927c,0x0,0x0}}},
+{0x2f9eb,{{0x93f9,0x0,0x0}}},
+{0x2f9ec,{{0x9415,0x0,0x0}}},
+{0x2f9ed,{{0x28bfa,0x0,0x0}}},
+{0x2f9ee,{{0x958b,0x0,0x0}}},
+{0x2f9ef,{{0x4995,0x0,0x0}}},
+{0x2f9f0,{{0x95b7,0x0,0x0}}},
+{0x2f9f1,{{0x28d77,0x0,0x0}}},
+{0x2f9f2,{{0x49e6,0x0,0x0}}},
+{0x2f9f3,{{0x96c3,0x0,0x0}}},
+{0x2f9f4,{{0x5db2,0x0,0x0}}},
+{0x2f9f5,{{0x9723,0x0,0x0}}},
+{0x2f9f6,{{0x29145,0x0,0x0}}},
+{0x2f9f7,{{0x2921a,0x0,0x0}}},
+{0x2f9f8,{{0x4a6e,0x0,0x0}}},
+{0x2f9f9,{{0x4a76,0x0,0x0}}},
+{0x2f9fa,{{0x97e0,0x0,0x0}}},
+{0x2f9fb,{{0x2940a,0x0,0x0}}},
+{0x2f9fc,{{0x4ab2,0x0,0x0}}},
+{0x2f9fd,{{0x29496,0x0,0x0}}},
+{0x2f9fe,{{0x980b,0x0,0x0}}},
+{0x2f9ff,{{0x980b,0x0,0x0}}},
+{0x2fa00,{{0x9829,0x0,0x0}}},
+{0x2fa01,{{0x295b6,0x0,0x0}}},
+{0x2fa02,{{0x98e2,0x0,0x0}}},
+{0x2fa03,{{0x4b33,0x0,0x0}}},
+{0x2fa04,{{0x9929,0x0,0x0}}},
+{0x2fa05,{{0x99a7,0x0,0x0}}},
+{0x2fa06,{{0x99c2,0x0,0x0}}},
+{0x2fa07,{{0x99fe,0x0,0x0}}},
+{0x2fa08,{{0x4bce,0x0,0x0}}},
+{0x2fa09,{{0x29b30,0x0,0x0}}},
+{0x2fa0a,{{0x9b12,0x0,0x0}}},
+{0x2fa0b,{{0x9c40,0x0,0x0}}},
+{0x2fa0c,{{0x9cfd,0x0,0x0}}},
+{0x2fa0d,{{0x4cce,0x0,0x0}}},
+{0x2fa0e,{{0x4ced,0x0,0x0}}},
+{0x2fa0f,{{0x9d67,0x0,0x0}}},
+{0x2fa10,{{0x2a0ce,0x0,0x0}}},
+{0x2fa11,{{0x4cf8,0x0,0x0}}},
+{0x2fa12,{{0x2a105,0x0,0x0}}},
+{0x2fa13,{{0x2a20e,0x0,0x0}}},
+{0x2fa14,{{0x2a291,0x0,0x0}}},
+{0x2fa15,{{0x9ebb,0x0,0x0}}},
+{0x2fa16,{{0x4d56,0x0,0x0}}},
+{0x2fa17,{{0x9ef9,0x0,0x0}}},
+{0x2fa18,{{0x9efe,0x0,0x0}}},
+{0x2fa19,{{0x9f05,0x0,0x0}}},
+{0x2fa1a,{{0x9f0f,0x0,0x0}}},
+{0x2fa1b,{{0x9f16,0x0,0x0}}},
+{0x2fa1c,{{0x9f3b,0x0,0x0}}},
+{0x2fa1d,{{0x2a600,0x0,0x0}}},
+{0xe0000,{{0x0,0x0,0x0}}},
+{0xe0001,{{0x0,0x0,0x0}}},
+{0xe0002,{{0x0,0x0,0x0}}},
+{0xe0003,{{0x0,0x0,0x0}}},
+{0xe0004,{{0x0,0x0,0x0}}},
+{0xe0005,{{0x0,0x0,0x0}}},
+{0xe0006,{{0x0,0x0,0x0}}},
+{0xe0007,{{0x0,0x0,0x0}}},
+{0xe0008,{{0x0,0x0,0x0}}},
+{0xe0009,{{0x0,0x0,0x0}}},
+{0xe000a,{{0x0,0x0,0x0}}},
+{0xe000b,{{0x0,0x0,0x0}}},
+{0xe000c,{{0x0,0x0,0x0}}},
+{0xe000d,{{0x0,0x0,0x0}}},
+{0xe000e,{{0x0,0x0,0x0}}},
+{0xe000f,{{0x0,0x0,0x0}}},
+{0xe0010,{{0x0,0x0,0x0}}},
+{0xe0011,{{0x0,0x0,0x0}}},
+{0xe0012,{{0x0,0x0,0x0}}},
+{0xe0013,{{0x0,0x0,0x0}}},
+{0xe0014,{{0x0,0x0,0x0}}},
+{0xe0015,{{0x0,0x0,0x0}}},
+{0xe0016,{{0x0,0x0,0x0}}},
+{0xe0017,{{0x0,0x0,0x0}}},
+{0xe0018,{{0x0,0x0,0x0}}},
+{0xe0019,{{0x0,0x0,0x0}}},
+{0xe001a,{{0x0,0x0,0x0}}},
+{0xe001b,{{0x0,0x0,0x0}}},
+{0xe001c,{{0x0,0x0,0x0}}},
+{0xe001d,{{0x0,0x0,0x0}}},
+{0xe001e,{{0x0,0x0,0x0}}},
+{0xe001f,{{0x0,0x0,0x0}}},
+{0xe0020,{{0x0,0x0,0x0}}},
+{0xe0021,{{0x0,0x0,0x0}}},
+{0xe0022,{{0x0,0x0,0x0}}},
+{0xe0023,{{0x0,0x0,0x0}}},
+{0xe0024,{{0x0,0x0,0x0}}},
+{0xe0025,{{0x0,0x0,0x0}}},
+{0xe0026,{{0x0,0x0,0x0}}},
+{0xe0027,{{0x0,0x0,0x0}}},
+{0xe0028,{{0x0,0x0,0x0}}},
+{0xe0029,{{0x0,0x0,0x0}}},
+{0xe002a,{{0x0,0x0,0x0}}},
+{0xe002b,{{0x0,0x0,0x0}}},
+{0xe002c,{{0x0,0x0,0x0}}},
+{0xe002d,{{0x0,0x0,0x0}}},
+{0xe002e,{{0x0,0x0,0x0}}},
+{0xe002f,{{0x0,0x0,0x0}}},
+{0xe0030,{{0x0,0x0,0x0}}},
+{0xe0031,{{0x0,0x0,0x0}}},
+{0xe0032,{{0x0,0x0,0x0}}},
+{0xe0033,{{0x0,0x0,0x0}}},
+{0xe0034,{{0x0,0x0,0x0}}},
+{0xe0035,{{0x0,0x0,0x0}}},
+{0xe0036,{{0x0,0x0,0x0}}},
+{0xe0037,{{0x0,0x0,0x0}}},
+{0xe0038,{{0x0,0x0,0x0}}},
+{0xe0039,{{0x0,0x0,0x0}}},
+{0xe003a,{{0x0,0x0,0x0}}},
+{0xe003b,{{0x0,0x0,0x0}}},
+{0xe003c,{{0x0,0x0,0x0}}},
+{0xe003d,{{0x0,0x0,0x0}}},
+{0xe003e,{{0x0,0x0,0x0}}},
+{0xe003f,{{0x0,0x0,0x0}}},
+{0xe0040,{{0x0,0x0,0x0}}},
+{0xe0041,{{0x0,0x0,0x0}}},
+{0xe0042,{{0x0,0x0,0x0}}},
+{0xe0043,{{0x0,0x0,0x0}}},
+{0xe0044,{{0x0,0x0,0x0}}},
+{0xe0045,{{0x0,0x0,0x0}}},
+{0xe0046,{{0x0,0x0,0x0}}},
+{0xe0047,{{0x0,0x0,0x0}}},
+{0xe0048,{{0x0,0x0,0x0}}},
+{0xe0049,{{0x0,0x0,0x0}}},
+{0xe004a,{{0x0,0x0,0x0}}},
+{0xe004b,{{0x0,0x0,0x0}}},
+{0xe004c,{{0x0,0x0,0x0}}},
+{0xe004d,{{0x0,0x0,0x0}}},
+{0xe004e,{{0x0,0x0,0x0}}},
+{0xe004f,{{0x0,0x0,0x0}}},
+{0xe0050,{{0x0,0x0,0x0}}},
+{0xe0051,{{0x0,0x0,0x0}}},
+{0xe0052,{{0x0,0x0,0x0}}},
+{0xe0053,{{0x0,0x0,0x0}}},
+{0xe0054,{{0x0,0x0,0x0}}},
+{0xe0055,{{0x0,0x0,0x0}}},
+{0xe0056,{{0x0,0x0,0x0}}},
+{0xe0057,{{0x0,0x0,0x0}}},
+{0xe0058,{{0x0,0x0,0x0}}},
+{0xe0059,{{0x0,0x0,0x0}}},
+{0xe005a,{{0x0,0x0,0x0}}},
+{0xe005b,{{0x0,0x0,0x0}}},
+{0xe005c,{{0x0,0x0,0x0}}},
+{0xe005d,{{0x0,0x0,0x0}}},
+{0xe005e,{{0x0,0x0,0x0}}},
+{0xe005f,{{0x0,0x0,0x0}}},
+{0xe0060,{{0x0,0x0,0x0}}},
+{0xe0061,{{0x0,0x0,0x0}}},
+{0xe0062,{{0x0,0x0,0x0}}},
+{0xe0063,{{0x0,0x0,0x0}}},
+{0xe0064,{{0x0,0x0,0x0}}},
+{0xe0065,{{0x0,0x0,0x0}}},
+{0xe0066,{{0x0,0x0,0x0}}},
+{0xe0067,{{0x0,0x0,0x0}}},
+{0xe0068,{{0x0,0x0,0x0}}},
+{0xe0069,{{0x0,0x0,0x0}}},
+{0xe006a,{{0x0,0x0,0x0}}},
+{0xe006b,{{0x0,0x0,0x0}}},
+{0xe006c,{{0x0,0x0,0x0}}},
+{0xe006d,{{0x0,0x0,0x0}}},
+{0xe006e,{{0x0,0x0,0x0}}},
+{0xe006f,{{0x0,0x0,0x0}}},
+{0xe0070,{{0x0,0x0,0x0}}},
+{0xe0071,{{0x0,0x0,0x0}}},
+{0xe0072,{{0x0,0x0,0x0}}},
+{0xe0073,{{0x0,0x0,0x0}}},
+{0xe0074,{{0x0,0x0,0x0}}},
+{0xe0075,{{0x0,0x0,0x0}}},
+{0xe0076,{{0x0,0x0,0x0}}},
+{0xe0077,{{0x0,0x0,0x0}}},
+{0xe0078,{{0x0,0x0,0x0}}},
+{0xe0079,{{0x0,0x0,0x0}}},
+{0xe007a,{{0x0,0x0,0x0}}},
+{0xe007b,{{0x0,0x0,0x0}}},
+{0xe007c,{{0x0,0x0,0x0}}},
+{0xe007d,{{0x0,0x0,0x0}}},
+{0xe007e,{{0x0,0x0,0x0}}},
+{0xe007f,{{0x0,0x0,0x0}}},
+{0xe0080,{{0x0,0x0,0x0}}},
+{0xe0081,{{0x0,0x0,0x0}}},
+{0xe0082,{{0x0,0x0,0x0}}},
+{0xe0083,{{0x0,0x0,0x0}}},
+{0xe0084,{{0x0,0x0,0x0}}},
+{0xe0085,{{0x0,0x0,0x0}}},
+{0xe0086,{{0x0,0x0,0x0}}},
+{0xe0087,{{0x0,0x0,0x0}}},
+{0xe0088,{{0x0,0x0,0x0}}},
+{0xe0089,{{0x0,0x0,0x0}}},
+{0xe008a,{{0x0,0x0,0x0}}},
+{0xe008b,{{0x0,0x0,0x0}}},
+{0xe008c,{{0x0,0x0,0x0}}},
+{0xe008d,{{0x0,0x0,0x0}}},
+{0xe008e,{{0x0,0x0,0x0}}},
+{0xe008f,{{0x0,0x0,0x0}}},
+{0xe0090,{{0x0,0x0,0x0}}},
+{0xe0091,{{0x0,0x0,0x0}}},
+{0xe0092,{{0x0,0x0,0x0}}},
+{0xe0093,{{0x0,0x0,0x0}}},
+{0xe0094,{{0x0,0x0,0x0}}},
+{0xe0095,{{0x0,0x0,0x0}}},
+{0xe0096,{{0x0,0x0,0x0}}},
+{0xe0097,{{0x0,0x0,0x0}}},
+{0xe0098,{{0x0,0x0,0x0}}},
+{0xe0099,{{0x0,0x0,0x0}}},
+{0xe009a,{{0x0,0x0,0x0}}},
+{0xe009b,{{0x0,0x0,0x0}}},
+{0xe009c,{{0x0,0x0,0x0}}},
+{0xe009d,{{0x0,0x0,0x0}}},
+{0xe009e,{{0x0,0x0,0x0}}},
+{0xe009f,{{0x0,0x0,0x0}}},
+{0xe00a0,{{0x0,0x0,0x0}}},
+{0xe00a1,{{0x0,0x0,0x0}}},
+{0xe00a2,{{0x0,0x0,0x0}}},
+{0xe00a3,{{0x0,0x0,0x0}}},
+{0xe00a4,{{0x0,0x0,0x0}}},
+{0xe00a5,{{0x0,0x0,0x0}}},
+{0xe00a6,{{0x0,0x0,0x0}}},
+{0xe00a7,{{0x0,0x0,0x0}}},
+{0xe00a8,{{0x0,0x0,0x0}}},
+{0xe00a9,{{0x0,0x0,0x0}}},
+{0xe00aa,{{0x0,0x0,0x0}}},
+{0xe00ab,{{0x0,0x0,0x0}}},
+{0xe00ac,{{0x0,0x0,0x0}}},
+{0xe00ad,{{0x0,0x0,0x0}}},
+{0xe00ae,{{0x0,0x0,0x0}}},
+{0xe00af,{{0x0,0x0,0x0}}},
+{0xe00b0,{{0x0,0x0,0x0}}},
+{0xe00b1,{{0x0,0x0,0x0}}},
+{0xe00b2,{{0x0,0x0,0x0}}},
+{0xe00b3,{{0x0,0x0,0x0}}},
+{0xe00b4,{{0x0,0x0,0x0}}},
+{0xe00b5,{{0x0,0x0,0x0}}},
+{0xe00b6,{{0x0,0x0,0x0}}},
+{0xe00b7,{{0x0,0x0,0x0}}},
+{0xe00b8,{{0x0,0x0,0x0}}},
+{0xe00b9,{{0x0,0x0,0x0}}},
+{0xe00ba,{{0x0,0x0,0x0}}},
+{0xe00bb,{{0x0,0x0,0x0}}},
+{0xe00bc,{{0x0,0x0,0x0}}},
+{0xe00bd,{{0x0,0x0,0x0}}},
+{0xe00be,{{0x0,0x0,0x0}}},
+{0xe00bf,{{0x0,0x0,0x0}}},
+{0xe00c0,{{0x0,0x0,0x0}}},
+{0xe00c1,{{0x0,0x0,0x0}}},
+{0xe00c2,{{0x0,0x0,0x0}}},
+{0xe00c3,{{0x0,0x0,0x0}}},
+{0xe00c4,{{0x0,0x0,0x0}}},
+{0xe00c5,{{0x0,0x0,0x0}}},
+{0xe00c6,{{0x0,0x0,0x0}}},
+{0xe00c7,{{0x0,0x0,0x0}}},
+{0xe00c8,{{0x0,0x0,0x0}}},
+{0xe00c9,{{0x0,0x0,0x0}}},
+{0xe00ca,{{0x0,0x0,0x0}}},
+{0xe00cb,{{0x0,0x0,0x0}}},
+{0xe00cc,{{0x0,0x0,0x0}}},
+{0xe00cd,{{0x0,0x0,0x0}}},
+{0xe00ce,{{0x0,0x0,0x0}}},
+{0xe00cf,{{0x0,0x0,0x0}}},
+{0xe00d0,{{0x0,0x0,0x0}}},
+{0xe00d1,{{0x0,0x0,0x0}}},
+{0xe00d2,{{0x0,0x0,0x0}}},
+{0xe00d3,{{0x0,0x0,0x0}}},
+{0xe00d4,{{0x0,0x0,0x0}}},
+{0xe00d5,{{0x0,0x0,0x0}}},
+{0xe00d6,{{0x0,0x0,0x0}}},
+{0xe00d7,{{0x0,0x0,0x0}}},
+{0xe00d8,{{0x0,0x0,0x0}}},
+{0xe00d9,{{0x0,0x0,0x0}}},
+{0xe00da,{{0x0,0x0,0x0}}},
+{0xe00db,{{0x0,0x0,0x0}}},
+{0xe00dc,{{0x0,0x0,0x0}}},
+{0xe00dd,{{0x0,0x0,0x0}}},
+{0xe00de,{{0x0,0x0,0x0}}},
+{0xe00df,{{0x0,0x0,0x0}}},
+{0xe00e0,{{0x0,0x0,0x0}}},
+{0xe00e1,{{0x0,0x0,0x0}}},
+{0xe00e2,{{0x0,0x0,0x0}}},
+{0xe00e3,{{0x0,0x0,0x0}}},
+{0xe00e4,{{0x0,0x0,0x0}}},
+{0xe00e5,{{0x0,0x0,0x0}}},
+{0xe00e6,{{0x0,0x0,0x0}}},
+{0xe00e7,{{0x0,0x0,0x0}}},
+{0xe00e8,{{0x0,0x0,0x0}}},
+{0xe00e9,{{0x0,0x0,0x0}}},
+{0xe00ea,{{0x0,0x0,0x0}}},
+{0xe00eb,{{0x0,0x0,0x0}}},
+{0xe00ec,{{0x0,0x0,0x0}}},
+{0xe00ed,{{0x0,0x0,0x0}}},
+{0xe00ee,{{0x0,0x0,0x0}}},
+{0xe00ef,{{0x0,0x0,0x0}}},
+{0xe00f0,{{0x0,0x0,0x0}}},
+{0xe00f1,{{0x0,0x0,0x0}}},
+{0xe00f2,{{0x0,0x0,0x0}}},
+{0xe00f3,{{0x0,0x0,0x0}}},
+{0xe00f4,{{0x0,0x0,0x0}}},
+{0xe00f5,{{0x0,0x0,0x0}}},
+{0xe00f6,{{0x0,0x0,0x0}}},
+{0xe00f7,{{0x0,0x0,0x0}}},
+{0xe00f8,{{0x0,0x0,0x0}}},
+{0xe00f9,{{0x0,0x0,0x0}}},
+{0xe00fa,{{0x0,0x0,0x0}}},
+{0xe00fb,{{0x0,0x0,0x0}}},
+{0xe00fc,{{0x0,0x0,0x0}}},
+{0xe00fd,{{0x0,0x0,0x0}}},
+{0xe00fe,{{0x0,0x0,0x0}}},
+{0xe00ff,{{0x0,0x0,0x0}}},
+{0xe0100,{{0x0,0x0,0x0}}},
+{0xe0101,{{0x0,0x0,0x0}}},
+{0xe0102,{{0x0,0x0,0x0}}},
+{0xe0103,{{0x0,0x0,0x0}}},
+{0xe0104,{{0x0,0x0,0x0}}},
+{0xe0105,{{0x0,0x0,0x0}}},
+{0xe0106,{{0x0,0x0,0x0}}},
+{0xe0107,{{0x0,0x0,0x0}}},
+{0xe0108,{{0x0,0x0,0x0}}},
+{0xe0109,{{0x0,0x0,0x0}}},
+{0xe010a,{{0x0,0x0,0x0}}},
+{0xe010b,{{0x0,0x0,0x0}}},
+{0xe010c,{{0x0,0x0,0x0}}},
+{0xe010d,{{0x0,0x0,0x0}}},
+{0xe010e,{{0x0,0x0,0x0}}},
+{0xe010f,{{0x0,0x0,0x0}}},
+{0xe0110,{{0x0,0x0,0x0}}},
+{0xe0111,{{0x0,0x0,0x0}}},
+{0xe0112,{{0x0,0x0,0x0}}},
+{0xe0113,{{0x0,0x0,0x0}}},
+{0xe0114,{{0x0,0x0,0x0}}},
+{0xe0115,{{0x0,0x0,0x0}}},
+{0xe0116,{{0x0,0x0,0x0}}},
+{0xe0117,{{0x0,0x0,0x0}}},
+{0xe0118,{{0x0,0x0,0x0}}},
+{0xe0119,{{0x0,0x0,0x0}}},
+{0xe011a,{{0x0,0x0,0x0}}},
+{0xe011b,{{0x0,0x0,0x0}}},
+{0xe011c,{{0x0,0x0,0x0}}},
+{0xe011d,{{0x0,0x0,0x0}}},
+{0xe011e,{{0x0,0x0,0x0}}},
+{0xe011f,{{0x0,0x0,0x0}}},
+{0xe0120,{{0x0,0x0,0x0}}},
+{0xe0121,{{0x0,0x0,0x0}}},
+{0xe0122,{{0x0,0x0,0x0}}},
+{0xe0123,{{0x0,0x0,0x0}}},
+{0xe0124,{{0x0,0x0,0x0}}},
+{0xe0125,{{0x0,0x0,0x0}}},
+{0xe0126,{{0x0,0x0,0x0}}},
+{0xe0127,{{0x0,0x0,0x0}}},
+{0xe0128,{{0x0,0x0,0x0}}},
+{0xe0129,{{0x0,0x0,0x0}}},
+{0xe012a,{{0x0,0x0,0x0}}},
+{0xe012b,{{0x0,0x0,0x0}}},
+{0xe012c,{{0x0,0x0,0x0}}},
+{0xe012d,{{0x0,0x0,0x0}}},
+{0xe012e,{{0x0,0x0,0x0}}},
+{0xe012f,{{0x0,0x0,0x0}}},
+{0xe0130,{{0x0,0x0,0x0}}},
+{0xe0131,{{0x0,0x0,0x0}}},
+{0xe0132,{{0x0,0x0,0x0}}},
+{0xe0133,{{0x0,0x0,0x0}}},
+{0xe0134,{{0x0,0x0,0x0}}},
+{0xe0135,{{0x0,0x0,0x0}}},
+{0xe0136,{{0x0,0x0,0x0}}},
+{0xe0137,{{0x0,0x0,0x0}}},
+{0xe0138,{{0x0,0x0,0x0}}},
+{0xe0139,{{0x0,0x0,0x0}}},
+{0xe013a,{{0x0,0x0,0x0}}},
+{0xe013b,{{0x0,0x0,0x0}}},
+{0xe013c,{{0x0,0x0,0x0}}},
+{0xe013d,{{0x0,0x0,0x0}}},
+{0xe013e,{{0x0,0x0,0x0}}},
+{0xe013f,{{0x0,0x0,0x0}}},
+{0xe0140,{{0x0,0x0,0x0}}},
+{0xe0141,{{0x0,0x0,0x0}}},
+{0xe0142,{{0x0,0x0,0x0}}},
+{0xe0143,{{0x0,0x0,0x0}}},
+{0xe0144,{{0x0,0x0,0x0}}},
+{0xe0145,{{0x0,0x0,0x0}}},
+{0xe0146,{{0x0,0x0,0x0}}},
+{0xe0147,{{0x0,0x0,0x0}}},
+{0xe0148,{{0x0,0x0,0x0}}},
+{0xe0149,{{0x0,0x0,0x0}}},
+{0xe014a,{{0x0,0x0,0x0}}},
+{0xe014b,{{0x0,0x0,0x0}}},
+{0xe014c,{{0x0,0x0,0x0}}},
+{0xe014d,{{0x0,0x0,0x0}}},
+{0xe014e,{{0x0,0x0,0x0}}},
+{0xe014f,{{0x0,0x0,0x0}}},
+{0xe0150,{{0x0,0x0,0x0}}},
+{0xe0151,{{0x0,0x0,0x0}}},
+{0xe0152,{{0x0,0x0,0x0}}},
+{0xe0153,{{0x0,0x0,0x0}}},
+{0xe0154,{{0x0,0x0,0x0}}},
+{0xe0155,{{0x0,0x0,0x0}}},
+{0xe0156,{{0x0,0x0,0x0}}},
+{0xe0157,{{0x0,0x0,0x0}}},
+{0xe0158,{{0x0,0x0,0x0}}},
+{0xe0159,{{0x0,0x0,0x0}}},
+{0xe015a,{{0x0,0x0,0x0}}},
+{0xe015b,{{0x0,0x0,0x0}}},
+{0xe015c,{{0x0,0x0,0x0}}},
+{0xe015d,{{0x0,0x0,0x0}}},
+{0xe015e,{{0x0,0x0,0x0}}},
+{0xe015f,{{0x0,0x0,0x0}}},
+{0xe0160,{{0x0,0x0,0x0}}},
+{0xe0161,{{0x0,0x0,0x0}}},
+{0xe0162,{{0x0,0x0,0x0}}},
+{0xe0163,{{0x0,0x0,0x0}}},
+{0xe0164,{{0x0,0x0,0x0}}},
+{0xe0165,{{0x0,0x0,0x0}}},
+{0xe0166,{{0x0,0x0,0x0}}},
+{0xe0167,{{0x0,0x0,0x0}}},
+{0xe0168,{{0x0,0x0,0x0}}},
+{0xe0169,{{0x0,0x0,0x0}}},
+{0xe016a,{{0x0,0x0,0x0}}},
+{0xe016b,{{0x0,0x0,0x0}}},
+{0xe016c,{{0x0,0x0,0x0}}},
+{0xe016d,{{0x0,0x0,0x0}}},
+{0xe016e,{{0x0,0x0,0x0}}},
+{0xe016f,{{0x0,0x0,0x0}}},
+{0xe0170,{{0x0,0x0,0x0}}},
+{0xe0171,{{0x0,0x0,0x0}}},
+{0xe0172,{{0x0,0x0,0x0}}},
+{0xe0173,{{0x0,0x0,0x0}}},
+{0xe0174,{{0x0,0x0,0x0}}},
+{0xe0175,{{0x0,0x0,0x0}}},
+{0xe0176,{{0x0,0x0,0x0}}},
+{0xe0177,{{0x0,0x0,0x0}}},
+{0xe0178,{{0x0,0x0,0x0}}},
+{0xe0179,{{0x0,0x0,0x0}}},
+{0xe017a,{{0x0,0x0,0x0}}},
+{0xe017b,{{0x0,0x0,0x0}}},
+{0xe017c,{{0x0,0x0,0x0}}},
+{0xe017d,{{0x0,0x0,0x0}}},
+{0xe017e,{{0x0,0x0,0x0}}},
+{0xe017f,{{0x0,0x0,0x0}}},
+{0xe0180,{{0x0,0x0,0x0}}},
+{0xe0181,{{0x0,0x0,0x0}}},
+{0xe0182,{{0x0,0x0,0x0}}},
+{0xe0183,{{0x0,0x0,0x0}}},
+{0xe0184,{{0x0,0x0,0x0}}},
+{0xe0185,{{0x0,0x0,0x0}}},
+{0xe0186,{{0x0,0x0,0x0}}},
+{0xe0187,{{0x0,0x0,0x0}}},
+{0xe0188,{{0x0,0x0,0x0}}},
+{0xe0189,{{0x0,0x0,0x0}}},
+{0xe018a,{{0x0,0x0,0x0}}},
+{0xe018b,{{0x0,0x0,0x0}}},
+{0xe018c,{{0x0,0x0,0x0}}},
+{0xe018d,{{0x0,0x0,0x0}}},
+{0xe018e,{{0x0,0x0,0x0}}},
+{0xe018f,{{0x0,0x0,0x0}}},
+{0xe0190,{{0x0,0x0,0x0}}},
+{0xe0191,{{0x0,0x0,0x0}}},
+{0xe0192,{{0x0,0x0,0x0}}},
+{0xe0193,{{0x0,0x0,0x0}}},
+{0xe0194,{{0x0,0x0,0x0}}},
+{0xe0195,{{0x0,0x0,0x0}}},
+{0xe0196,{{0x0,0x0,0x0}}},
+{0xe0197,{{0x0,0x0,0x0}}},
+{0xe0198,{{0x0,0x0,0x0}}},
+{0xe0199,{{0x0,0x0,0x0}}},
+{0xe019a,{{0x0,0x0,0x0}}},
+{0xe019b,{{0x0,0x0,0x0}}},
+{0xe019c,{{0x0,0x0,0x0}}},
+{0xe019d,{{0x0,0x0,0x0}}},
+{0xe019e,{{0x0,0x0,0x0}}},
+{0xe019f,{{0x0,0x0,0x0}}},
+{0xe01a0,{{0x0,0x0,0x0}}},
+{0xe01a1,{{0x0,0x0,0x0}}},
+{0xe01a2,{{0x0,0x0,0x0}}},
+{0xe01a3,{{0x0,0x0,0x0}}},
+{0xe01a4,{{0x0,0x0,0x0}}},
+{0xe01a5,{{0x0,0x0,0x0}}},
+{0xe01a6,{{0x0,0x0,0x0}}},
+{0xe01a7,{{0x0,0x0,0x0}}},
+{0xe01a8,{{0x0,0x0,0x0}}},
+{0xe01a9,{{0x0,0x0,0x0}}},
+{0xe01aa,{{0x0,0x0,0x0}}},
+{0xe01ab,{{0x0,0x0,0x0}}},
+{0xe01ac,{{0x0,0x0,0x0}}},
+{0xe01ad,{{0x0,0x0,0x0}}},
+{0xe01ae,{{0x0,0x0,0x0}}},
+{0xe01af,{{0x0,0x0,0x0}}},
+{0xe01b0,{{0x0,0x0,0x0}}},
+{0xe01b1,{{0x0,0x0,0x0}}},
+{0xe01b2,{{0x0,0x0,0x0}}},
+{0xe01b3,{{0x0,0x0,0x0}}},
+{0xe01b4,{{0x0,0x0,0x0}}},
+{0xe01b5,{{0x0,0x0,0x0}}},
+{0xe01b6,{{0x0,0x0,0x0}}},
+{0xe01b7,{{0x0,0x0,0x0}}},
+{0xe01b8,{{0x0,0x0,0x0}}},
+{0xe01b9,{{0x0,0x0,0x0}}},
+{0xe01ba,{{0x0,0x0,0x0}}},
+{0xe01bb,{{0x0,0x0,0x0}}},
+{0xe01bc,{{0x0,0x0,0x0}}},
+{0xe01bd,{{0x0,0x0,0x0}}},
+{0xe01be,{{0x0,0x0,0x0}}},
+{0xe01bf,{{0x0,0x0,0x0}}},
+{0xe01c0,{{0x0,0x0,0x0}}},
+{0xe01c1,{{0x0,0x0,0x0}}},
+{0xe01c2,{{0x0,0x0,0x0}}},
+{0xe01c3,{{0x0,0x0,0x0}}},
+{0xe01c4,{{0x0,0x0,0x0}}},
+{0xe01c5,{{0x0,0x0,0x0}}},
+{0xe01c6,{{0x0,0x0,0x0}}},
+{0xe01c7,{{0x0,0x0,0x0}}},
+{0xe01c8,{{0x0,0x0,0x0}}},
+{0xe01c9,{{0x0,0x0,0x0}}},
+{0xe01ca,{{0x0,0x0,0x0}}},
+{0xe01cb,{{0x0,0x0,0x0}}},
+{0xe01cc,{{0x0,0x0,0x0}}},
+{0xe01cd,{{0x0,0x0,0x0}}},
+{0xe01ce,{{0x0,0x0,0x0}}},
+{0xe01cf,{{0x0,0x0,0x0}}},
+{0xe01d0,{{0x0,0x0,0x0}}},
+{0xe01d1,{{0x0,0x0,0x0}}},
+{0xe01d2,{{0x0,0x0,0x0}}},
+{0xe01d3,{{0x0,0x0,0x0}}},
+{0xe01d4,{{0x0,0x0,0x0}}},
+{0xe01d5,{{0x0,0x0,0x0}}},
+{0xe01d6,{{0x0,0x0,0x0}}},
+{0xe01d7,{{0x0,0x0,0x0}}},
+{0xe01d8,{{0x0,0x0,0x0}}},
+{0xe01d9,{{0x0,0x0,0x0}}},
+{0xe01da,{{0x0,0x0,0x0}}},
+{0xe01db,{{0x0,0x0,0x0}}},
+{0xe01dc,{{0x0,0x0,0x0}}},
+{0xe01dd,{{0x0,0x0,0x0}}},
+{0xe01de,{{0x0,0x0,0x0}}},
+{0xe01df,{{0x0,0x0,0x0}}},
+{0xe01e0,{{0x0,0x0,0x0}}},
+{0xe01e1,{{0x0,0x0,0x0}}},
+{0xe01e2,{{0x0,0x0,0x0}}},
+{0xe01e3,{{0x0,0x0,0x0}}},
+{0xe01e4,{{0x0,0x0,0x0}}},
+{0xe01e5,{{0x0,0x0,0x0}}},
+{0xe01e6,{{0x0,0x0,0x0}}},
+{0xe01e7,{{0x0,0x0,0x0}}},
+{0xe01e8,{{0x0,0x0,0x0}}},
+{0xe01e9,{{0x0,0x0,0x0}}},
+{0xe01ea,{{0x0,0x0,0x0}}},
+{0xe01eb,{{0x0,0x0,0x0}}},
+{0xe01ec,{{0x0,0x0,0x0}}},
+{0xe01ed,{{0x0,0x0,0x0}}},
+{0xe01ee,{{0x0,0x0,0x0}}},
+{0xe01ef,{{0x0,0x0,0x0}}},
+{0xe01f0,{{0x0,0x0,0x0}}},
+{0xe01f1,{{0x0,0x0,0x0}}},
+{0xe01f2,{{0x0,0x0,0x0}}},
+{0xe01f3,{{0x0,0x0,0x0}}},
+{0xe01f4,{{0x0,0x0,0x0}}},
+{0xe01f5,{{0x0,0x0,0x0}}},
+{0xe01f6,{{0x0,0x0,0x0}}},
+{0xe01f7,{{0x0,0x0,0x0}}},
+{0xe01f8,{{0x0,0x0,0x0}}},
+{0xe01f9,{{0x0,0x0,0x0}}},
+{0xe01fa,{{0x0,0x0,0x0}}},
+{0xe01fb,{{0x0,0x0,0x0}}},
+{0xe01fc,{{0x0,0x0,0x0}}},
+{0xe01fd,{{0x0,0x0,0x0}}},
+{0xe01fe,{{0x0,0x0,0x0}}},
+{0xe01ff,{{0x0,0x0,0x0}}},
+{0xe0200,{{0x0,0x0,0x0}}},
+{0xe0201,{{0x0,0x0,0x0}}},
+{0xe0202,{{0x0,0x0,0x0}}},
+{0xe0203,{{0x0,0x0,0x0}}},
+{0xe0204,{{0x0,0x0,0x0}}},
+{0xe0205,{{0x0,0x0,0x0}}},
+{0xe0206,{{0x0,0x0,0x0}}},
+{0xe0207,{{0x0,0x0,0x0}}},
+{0xe0208,{{0x0,0x0,0x0}}},
+{0xe0209,{{0x0,0x0,0x0}}},
+{0xe020a,{{0x0,0x0,0x0}}},
+{0xe020b,{{0x0,0x0,0x0}}},
+{0xe020c,{{0x0,0x0,0x0}}},
+{0xe020d,{{0x0,0x0,0x0}}},
+{0xe020e,{{0x0,0x0,0x0}}},
+{0xe020f,{{0x0,0x0,0x0}}},
+{0xe0210,{{0x0,0x0,0x0}}},
+{0xe0211,{{0x0,0x0,0x0}}},
+{0xe0212,{{0x0,0x0,0x0}}},
+{0xe0213,{{0x0,0x0,0x0}}},
+{0xe0214,{{0x0,0x0,0x0}}},
+{0xe0215,{{0x0,0x0,0x0}}},
+{0xe0216,{{0x0,0x0,0x0}}},
+{0xe0217,{{0x0,0x0,0x0}}},
+{0xe0218,{{0x0,0x0,0x0}}},
+{0xe0219,{{0x0,0x0,0x0}}},
+{0xe021a,{{0x0,0x0,0x0}}},
+{0xe021b,{{0x0,0x0,0x0}}},
+{0xe021c,{{0x0,0x0,0x0}}},
+{0xe021d,{{0x0,0x0,0x0}}},
+{0xe021e,{{0x0,0x0,0x0}}},
+{0xe021f,{{0x0,0x0,0x0}}},
+{0xe0220,{{0x0,0x0,0x0}}},
+{0xe0221,{{0x0,0x0,0x0}}},
+{0xe0222,{{0x0,0x0,0x0}}},
+{0xe0223,{{0x0,0x0,0x0}}},
+{0xe0224,{{0x0,0x0,0x0}}},
+{0xe0225,{{0x0,0x0,0x0}}},
+{0xe0226,{{0x0,0x0,0x0}}},
+{0xe0227,{{0x0,0x0,0x0}}},
+{0xe0228,{{0x0,0x0,0x0}}},
+{0xe0229,{{0x0,0x0,0x0}}},
+{0xe022a,{{0x0,0x0,0x0}}},
+{0xe022b,{{0x0,0x0,0x0}}},
+{0xe022c,{{0x0,0x0,0x0}}},
+{0xe022d,{{0x0,0x0,0x0}}},
+{0xe022e,{{0x0,0x0,0x0}}},
+{0xe022f,{{0x0,0x0,0x0}}},
+{0xe0230,{{0x0,0x0,0x0}}},
+{0xe0231,{{0x0,0x0,0x0}}},
+{0xe0232,{{0x0,0x0,0x0}}},
+{0xe0233,{{0x0,0x0,0x0}}},
+{0xe0234,{{0x0,0x0,0x0}}},
+{0xe0235,{{0x0,0x0,0x0}}},
+{0xe0236,{{0x0,0x0,0x0}}},
+{0xe0237,{{0x0,0x0,0x0}}},
+{0xe0238,{{0x0,0x0,0x0}}},
+{0xe0239,{{0x0,0x0,0x0}}},
+{0xe023a,{{0x0,0x0,0x0}}},
+{0xe023b,{{0x0,0x0,0x0}}},
+{0xe023c,{{0x0,0x0,0x0}}},
+{0xe023d,{{0x0,0x0,0x0}}},
+{0xe023e,{{0x0,0x0,0x0}}},
+{0xe023f,{{0x0,0x0,0x0}}},
+{0xe0240,{{0x0,0x0,0x0}}},
+{0xe0241,{{0x0,0x0,0x0}}},
+{0xe0242,{{0x0,0x0,0x0}}},
+{0xe0243,{{0x0,0x0,0x0}}},
+{0xe0244,{{0x0,0x0,0x0}}},
+{0xe0245,{{0x0,0x0,0x0}}},
+{0xe0246,{{0x0,0x0,0x0}}},
+{0xe0247,{{0x0,0x0,0x0}}},
+{0xe0248,{{0x0,0x0,0x0}}},
+{0xe0249,{{0x0,0x0,0x0}}},
+{0xe024a,{{0x0,0x0,0x0}}},
+{0xe024b,{{0x0,0x0,0x0}}},
+{0xe024c,{{0x0,0x0,0x0}}},
+{0xe024d,{{0x0,0x0,0x0}}},
+{0xe024e,{{0x0,0x0,0x0}}},
+{0xe024f,{{0x0,0x0,0x0}}},
+{0xe0250,{{0x0,0x0,0x0}}},
+{0xe0251,{{0x0,0x0,0x0}}},
+{0xe0252,{{0x0,0x0,0x0}}},
+{0xe0253,{{0x0,0x0,0x0}}},
+{0xe0254,{{0x0,0x0,0x0}}},
+{0xe0255,{{0x0,0x0,0x0}}},
+{0xe0256,{{0x0,0x0,0x0}}},
+{0xe0257,{{0x0,0x0,0x0}}},
+{0xe0258,{{0x0,0x0,0x0}}},
+{0xe0259,{{0x0,0x0,0x0}}},
+{0xe025a,{{0x0,0x0,0x0}}},
+{0xe025b,{{0x0,0x0,0x0}}},
+{0xe025c,{{0x0,0x0,0x0}}},
+{0xe025d,{{0x0,0x0,0x0}}},
+{0xe025e,{{0x0,0x0,0x0}}},
+{0xe025f,{{0x0,0x0,0x0}}},
+{0xe0260,{{0x0,0x0,0x0}}},
+{0xe0261,{{0x0,0x0,0x0}}},
+{0xe0262,{{0x0,0x0,0x0}}},
+{0xe0263,{{0x0,0x0,0x0}}},
+{0xe0264,{{0x0,0x0,0x0}}},
+{0xe0265,{{0x0,0x0,0x0}}},
+{0xe0266,{{0x0,0x0,0x0}}},
+{0xe0267,{{0x0,0x0,0x0}}},
+{0xe0268,{{0x0,0x0,0x0}}},
+{0xe0269,{{0x0,0x0,0x0}}},
+{0xe026a,{{0x0,0x0,0x0}}},
+{0xe026b,{{0x0,0x0,0x0}}},
+{0xe026c,{{0x0,0x0,0x0}}},
+{0xe026d,{{0x0,0x0,0x0}}},
+{0xe026e,{{0x0,0x0,0x0}}},
+{0xe026f,{{0x0,0x0,0x0}}},
+{0xe0270,{{0x0,0x0,0x0}}},
+{0xe0271,{{0x0,0x0,0x0}}},
+{0xe0272,{{0x0,0x0,0x0}}},
+{0xe0273,{{0x0,0x0,0x0}}},
+{0xe0274,{{0x0,0x0,0x0}}},
+{0xe0275,{{0x0,0x0,0x0}}},
+{0xe0276,{{0x0,0x0,0x0}}},
+{0xe0277,{{0x0,0x0,0x0}}},
+{0xe0278,{{0x0,0x0,0x0}}},
+{0xe0279,{{0x0,0x0,0x0}}},
+{0xe027a,{{0x0,0x0,0x0}}},
+{0xe027b,{{0x0,0x0,0x0}}},
+{0xe027c,{{0x0,0x0,0x0}}},
+{0xe027d,{{0x0,0x0,0x0}}},
+{0xe027e,{{0x0,0x0,0x0}}},
+{0xe027f,{{0x0,0x0,0x0}}},
+{0xe0280,{{0x0,0x0,0x0}}},
+{0xe0281,{{0x0,0x0,0x0}}},
+{0xe0282,{{0x0,0x0,0x0}}},
+{0xe0283,{{0x0,0x0,0x0}}},
+{0xe0284,{{0x0,0x0,0x0}}},
+{0xe0285,{{0x0,0x0,0x0}}},
+{0xe0286,{{0x0,0x0,0x0}}},
+{0xe0287,{{0x0,0x0,0x0}}},
+{0xe0288,{{0x0,0x0,0x0}}},
+{0xe0289,{{0x0,0x0,0x0}}},
+{0xe028a,{{0x0,0x0,0x0}}},
+{0xe028b,{{0x0,0x0,0x0}}},
+{0xe028c,{{0x0,0x0,0x0}}},
+{0xe028d,{{0x0,0x0,0x0}}},
+{0xe028e,{{0x0,0x0,0x0}}},
+{0xe028f,{{0x0,0x0,0x0}}},
+{0xe0290,{{0x0,0x0,0x0}}},
+{0xe0291,{{0x0,0x0,0x0}}},
+{0xe0292,{{0x0,0x0,0x0}}},
+{0xe0293,{{0x0,0x0,0x0}}},
+{0xe0294,{{0x0,0x0,0x0}}},
+{0xe0295,{{0x0,0x0,0x0}}},
+{0xe0296,{{0x0,0x0,0x0}}},
+{0xe0297,{{0x0,0x0,0x0}}},
+{0xe0298,{{0x0,0x0,0x0}}},
+{0xe0299,{{0x0,0x0,0x0}}},
+{0xe029a,{{0x0,0x0,0x0}}},
+{0xe029b,{{0x0,0x0,0x0}}},
+{0xe029c,{{0x0,0x0,0x0}}},
+{0xe029d,{{0x0,0x0,0x0}}},
+{0xe029e,{{0x0,0x0,0x0}}},
+{0xe029f,{{0x0,0x0,0x0}}},
+{0xe02a0,{{0x0,0x0,0x0}}},
+{0xe02a1,{{0x0,0x0,0x0}}},
+{0xe02a2,{{0x0,0x0,0x0}}},
+{0xe02a3,{{0x0,0x0,0x0}}},
+{0xe02a4,{{0x0,0x0,0x0}}},
+{0xe02a5,{{0x0,0x0,0x0}}},
+{0xe02a6,{{0x0,0x0,0x0}}},
+{0xe02a7,{{0x0,0x0,0x0}}},
+{0xe02a8,{{0x0,0x0,0x0}}},
+{0xe02a9,{{0x0,0x0,0x0}}},
+{0xe02aa,{{0x0,0x0,0x0}}},
+{0xe02ab,{{0x0,0x0,0x0}}},
+{0xe02ac,{{0x0,0x0,0x0}}},
+{0xe02ad,{{0x0,0x0,0x0}}},
+{0xe02ae,{{0x0,0x0,0x0}}},
+{0xe02af,{{0x0,0x0,0x0}}},
+{0xe02b0,{{0x0,0x0,0x0}}},
+{0xe02b1,{{0x0,0x0,0x0}}},
+{0xe02b2,{{0x0,0x0,0x0}}},
+{0xe02b3,{{0x0,0x0,0x0}}},
+{0xe02b4,{{0x0,0x0,0x0}}},
+{0xe02b5,{{0x0,0x0,0x0}}},
+{0xe02b6,{{0x0,0x0,0x0}}},
+{0xe02b7,{{0x0,0x0,0x0}}},
+{0xe02b8,{{0x0,0x0,0x0}}},
+{0xe02b9,{{0x0,0x0,0x0}}},
+{0xe02ba,{{0x0,0x0,0x0}}},
+{0xe02bb,{{0x0,0x0,0x0}}},
+{0xe02bc,{{0x0,0x0,0x0}}},
+{0xe02bd,{{0x0,0x0,0x0}}},
+{0xe02be,{{0x0,0x0,0x0}}},
+{0xe02bf,{{0x0,0x0,0x0}}},
+{0xe02c0,{{0x0,0x0,0x0}}},
+{0xe02c1,{{0x0,0x0,0x0}}},
+{0xe02c2,{{0x0,0x0,0x0}}},
+{0xe02c3,{{0x0,0x0,0x0}}},
+{0xe02c4,{{0x0,0x0,0x0}}},
+{0xe02c5,{{0x0,0x0,0x0}}},
+{0xe02c6,{{0x0,0x0,0x0}}},
+{0xe02c7,{{0x0,0x0,0x0}}},
+{0xe02c8,{{0x0,0x0,0x0}}},
+{0xe02c9,{{0x0,0x0,0x0}}},
+{0xe02ca,{{0x0,0x0,0x0}}},
+{0xe02cb,{{0x0,0x0,0x0}}},
+{0xe02cc,{{0x0,0x0,0x0}}},
+{0xe02cd,{{0x0,0x0,0x0}}},
+{0xe02ce,{{0x0,0x0,0x0}}},
+{0xe02cf,{{0x0,0x0,0x0}}},
+{0xe02d0,{{0x0,0x0,0x0}}},
+{0xe02d1,{{0x0,0x0,0x0}}},
+{0xe02d2,{{0x0,0x0,0x0}}},
+{0xe02d3,{{0x0,0x0,0x0}}},
+{0xe02d4,{{0x0,0x0,0x0}}},
+{0xe02d5,{{0x0,0x0,0x0}}},
+{0xe02d6,{{0x0,0x0,0x0}}},
+{0xe02d7,{{0x0,0x0,0x0}}},
+{0xe02d8,{{0x0,0x0,0x0}}},
+{0xe02d9,{{0x0,0x0,0x0}}},
+{0xe02da,{{0x0,0x0,0x0}}},
+{0xe02db,{{0x0,0x0,0x0}}},
+{0xe02dc,{{0x0,0x0,0x0}}},
+{0xe02dd,{{0x0,0x0,0x0}}},
+{0xe02de,{{0x0,0x0,0x0}}},
+{0xe02df,{{0x0,0x0,0x0}}},
+{0xe02e0,{{0x0,0x0,0x0}}},
+{0xe02e1,{{0x0,0x0,0x0}}},
+{0xe02e2,{{0x0,0x0,0x0}}},
+{0xe02e3,{{0x0,0x0,0x0}}},
+{0xe02e4,{{0x0,0x0,0x0}}},
+{0xe02e5,{{0x0,0x0,0x0}}},
+{0xe02e6,{{0x0,0x0,0x0}}},
+{0xe02e7,{{0x0,0x0,0x0}}},
+{0xe02e8,{{0x0,0x0,0x0}}},
+{0xe02e9,{{0x0,0x0,0x0}}},
+{0xe02ea,{{0x0,0x0,0x0}}},
+{0xe02eb,{{0x0,0x0,0x0}}},
+{0xe02ec,{{0x0,0x0,0x0}}},
+{0xe02ed,{{0x0,0x0,0x0}}},
+{0xe02ee,{{0x0,0x0,0x0}}},
+{0xe02ef,{{0x0,0x0,0x0}}},
+{0xe02f0,{{0x0,0x0,0x0}}},
+{0xe02f1,{{0x0,0x0,0x0}}},
+{0xe02f2,{{0x0,0x0,0x0}}},
+{0xe02f3,{{0x0,0x0,0x0}}},
+{0xe02f4,{{0x0,0x0,0x0}}},
+{0xe02f5,{{0x0,0x0,0x0}}},
+{0xe02f6,{{0x0,0x0,0x0}}},
+{0xe02f7,{{0x0,0x0,0x0}}},
+{0xe02f8,{{0x0,0x0,0x0}}},
+{0xe02f9,{{0x0,0x0,0x0}}},
+{0xe02fa,{{0x0,0x0,0x0}}},
+{0xe02fb,{{0x0,0x0,0x0}}},
+{0xe02fc,{{0x0,0x0,0x0}}},
+{0xe02fd,{{0x0,0x0,0x0}}},
+{0xe02fe,{{0x0,0x0,0x0}}},
+{0xe02ff,{{0x0,0x0,0x0}}},
+{0xe0300,{{0x0,0x0,0x0}}},
+{0xe0301,{{0x0,0x0,0x0}}},
+{0xe0302,{{0x0,0x0,0x0}}},
+{0xe0303,{{0x0,0x0,0x0}}},
+{0xe0304,{{0x0,0x0,0x0}}},
+{0xe0305,{{0x0,0x0,0x0}}},
+{0xe0306,{{0x0,0x0,0x0}}},
+{0xe0307,{{0x0,0x0,0x0}}},
+{0xe0308,{{0x0,0x0,0x0}}},
+{0xe0309,{{0x0,0x0,0x0}}},
+{0xe030a,{{0x0,0x0,0x0}}},
+{0xe030b,{{0x0,0x0,0x0}}},
+{0xe030c,{{0x0,0x0,0x0}}},
+{0xe030d,{{0x0,0x0,0x0}}},
+{0xe030e,{{0x0,0x0,0x0}}},
+{0xe030f,{{0x0,0x0,0x0}}},
+{0xe0310,{{0x0,0x0,0x0}}},
+{0xe0311,{{0x0,0x0,0x0}}},
+{0xe0312,{{0x0,0x0,0x0}}},
+{0xe0313,{{0x0,0x0,0x0}}},
+{0xe0314,{{0x0,0x0,0x0}}},
+{0xe0315,{{0x0,0x0,0x0}}},
+{0xe0316,{{0x0,0x0,0x0}}},
+{0xe0317,{{0x0,0x0,0x0}}},
+{0xe0318,{{0x0,0x0,0x0}}},
+{0xe0319,{{0x0,0x0,0x0}}},
+{0xe031a,{{0x0,0x0,0x0}}},
+{0xe031b,{{0x0,0x0,0x0}}},
+{0xe031c,{{0x0,0x0,0x0}}},
+{0xe031d,{{0x0,0x0,0x0}}},
+{0xe031e,{{0x0,0x0,0x0}}},
+{0xe031f,{{0x0,0x0,0x0}}},
+{0xe0320,{{0x0,0x0,0x0}}},
+{0xe0321,{{0x0,0x0,0x0}}},
+{0xe0322,{{0x0,0x0,0x0}}},
+{0xe0323,{{0x0,0x0,0x0}}},
+{0xe0324,{{0x0,0x0,0x0}}},
+{0xe0325,{{0x0,0x0,0x0}}},
+{0xe0326,{{0x0,0x0,0x0}}},
+{0xe0327,{{0x0,0x0,0x0}}},
+{0xe0328,{{0x0,0x0,0x0}}},
+{0xe0329,{{0x0,0x0,0x0}}},
+{0xe032a,{{0x0,0x0,0x0}}},
+{0xe032b,{{0x0,0x0,0x0}}},
+{0xe032c,{{0x0,0x0,0x0}}},
+{0xe032d,{{0x0,0x0,0x0}}},
+{0xe032e,{{0x0,0x0,0x0}}},
+{0xe032f,{{0x0,0x0,0x0}}},
+{0xe0330,{{0x0,0x0,0x0}}},
+{0xe0331,{{0x0,0x0,0x0}}},
+{0xe0332,{{0x0,0x0,0x0}}},
+{0xe0333,{{0x0,0x0,0x0}}},
+{0xe0334,{{0x0,0x0,0x0}}},
+{0xe0335,{{0x0,0x0,0x0}}},
+{0xe0336,{{0x0,0x0,0x0}}},
+{0xe0337,{{0x0,0x0,0x0}}},
+{0xe0338,{{0x0,0x0,0x0}}},
+{0xe0339,{{0x0,0x0,0x0}}},
+{0xe033a,{{0x0,0x0,0x0}}},
+{0xe033b,{{0x0,0x0,0x0}}},
+{0xe033c,{{0x0,0x0,0x0}}},
+{0xe033d,{{0x0,0x0,0x0}}},
+{0xe033e,{{0x0,0x0,0x0}}},
+{0xe033f,{{0x0,0x0,0x0}}},
+{0xe0340,{{0x0,0x0,0x0}}},
+{0xe0341,{{0x0,0x0,0x0}}},
+{0xe0342,{{0x0,0x0,0x0}}},
+{0xe0343,{{0x0,0x0,0x0}}},
+{0xe0344,{{0x0,0x0,0x0}}},
+{0xe0345,{{0x0,0x0,0x0}}},
+{0xe0346,{{0x0,0x0,0x0}}},
+{0xe0347,{{0x0,0x0,0x0}}},
+{0xe0348,{{0x0,0x0,0x0}}},
+{0xe0349,{{0x0,0x0,0x0}}},
+{0xe034a,{{0x0,0x0,0x0}}},
+{0xe034b,{{0x0,0x0,0x0}}},
+{0xe034c,{{0x0,0x0,0x0}}},
+{0xe034d,{{0x0,0x0,0x0}}},
+{0xe034e,{{0x0,0x0,0x0}}},
+{0xe034f,{{0x0,0x0,0x0}}},
+{0xe0350,{{0x0,0x0,0x0}}},
+{0xe0351,{{0x0,0x0,0x0}}},
+{0xe0352,{{0x0,0x0,0x0}}},
+{0xe0353,{{0x0,0x0,0x0}}},
+{0xe0354,{{0x0,0x0,0x0}}},
+{0xe0355,{{0x0,0x0,0x0}}},
+{0xe0356,{{0x0,0x0,0x0}}},
+{0xe0357,{{0x0,0x0,0x0}}},
+{0xe0358,{{0x0,0x0,0x0}}},
+{0xe0359,{{0x0,0x0,0x0}}},
+{0xe035a,{{0x0,0x0,0x0}}},
+{0xe035b,{{0x0,0x0,0x0}}},
+{0xe035c,{{0x0,0x0,0x0}}},
+{0xe035d,{{0x0,0x0,0x0}}},
+{0xe035e,{{0x0,0x0,0x0}}},
+{0xe035f,{{0x0,0x0,0x0}}},
+{0xe0360,{{0x0,0x0,0x0}}},
+{0xe0361,{{0x0,0x0,0x0}}},
+{0xe0362,{{0x0,0x0,0x0}}},
+{0xe0363,{{0x0,0x0,0x0}}},
+{0xe0364,{{0x0,0x0,0x0}}},
+{0xe0365,{{0x0,0x0,0x0}}},
+{0xe0366,{{0x0,0x0,0x0}}},
+{0xe0367,{{0x0,0x0,0x0}}},
+{0xe0368,{{0x0,0x0,0x0}}},
+{0xe0369,{{0x0,0x0,0x0}}},
+{0xe036a,{{0x0,0x0,0x0}}},
+{0xe036b,{{0x0,0x0,0x0}}},
+{0xe036c,{{0x0,0x0,0x0}}},
+{0xe036d,{{0x0,0x0,0x0}}},
+{0xe036e,{{0x0,0x0,0x0}}},
+{0xe036f,{{0x0,0x0,0x0}}},
+{0xe0370,{{0x0,0x0,0x0}}},
+{0xe0371,{{0x0,0x0,0x0}}},
+{0xe0372,{{0x0,0x0,0x0}}},
+{0xe0373,{{0x0,0x0,0x0}}},
+{0xe0374,{{0x0,0x0,0x0}}},
+{0xe0375,{{0x0,0x0,0x0}}},
+{0xe0376,{{0x0,0x0,0x0}}},
+{0xe0377,{{0x0,0x0,0x0}}},
+{0xe0378,{{0x0,0x0,0x0}}},
+{0xe0379,{{0x0,0x0,0x0}}},
+{0xe037a,{{0x0,0x0,0x0}}},
+{0xe037b,{{0x0,0x0,0x0}}},
+{0xe037c,{{0x0,0x0,0x0}}},
+{0xe037d,{{0x0,0x0,0x0}}},
+{0xe037e,{{0x0,0x0,0x0}}},
+{0xe037f,{{0x0,0x0,0x0}}},
+{0xe0380,{{0x0,0x0,0x0}}},
+{0xe0381,{{0x0,0x0,0x0}}},
+{0xe0382,{{0x0,0x0,0x0}}},
+{0xe0383,{{0x0,0x0,0x0}}},
+{0xe0384,{{0x0,0x0,0x0}}},
+{0xe0385,{{0x0,0x0,0x0}}},
+{0xe0386,{{0x0,0x0,0x0}}},
+{0xe0387,{{0x0,0x0,0x0}}},
+{0xe0388,{{0x0,0x0,0x0}}},
+{0xe0389,{{0x0,0x0,0x0}}},
+{0xe038a,{{0x0,0x0,0x0}}},
+{0xe038b,{{0x0,0x0,0x0}}},
+{0xe038c,{{0x0,0x0,0x0}}},
+{0xe038d,{{0x0,0x0,0x0}}},
+{0xe038e,{{0x0,0x0,0x0}}},
+{0xe038f,{{0x0,0x0,0x0}}},
+{0xe0390,{{0x0,0x0,0x0}}},
+{0xe0391,{{0x0,0x0,0x0}}},
+{0xe0392,{{0x0,0x0,0x0}}},
+{0xe0393,{{0x0,0x0,0x0}}},
+{0xe0394,{{0x0,0x0,0x0}}},
+{0xe0395,{{0x0,0x0,0x0}}},
+{0xe0396,{{0x0,0x0,0x0}}},
+{0xe0397,{{0x0,0x0,0x0}}},
+{0xe0398,{{0x0,0x0,0x0}}},
+{0xe0399,{{0x0,0x0,0x0}}},
+{0xe039a,{{0x0,0x0,0x0}}},
+{0xe039b,{{0x0,0x0,0x0}}},
+{0xe039c,{{0x0,0x0,0x0}}},
+{0xe039d,{{0x0,0x0,0x0}}},
+{0xe039e,{{0x0,0x0,0x0}}},
+{0xe039f,{{0x0,0x0,0x0}}},
+{0xe03a0,{{0x0,0x0,0x0}}},
+{0xe03a1,{{0x0,0x0,0x0}}},
+{0xe03a2,{{0x0,0x0,0x0}}},
+{0xe03a3,{{0x0,0x0,0x0}}},
+{0xe03a4,{{0x0,0x0,0x0}}},
+{0xe03a5,{{0x0,0x0,0x0}}},
+{0xe03a6,{{0x0,0x0,0x0}}},
+{0xe03a7,{{0x0,0x0,0x0}}},
+{0xe03a8,{{0x0,0x0,0x0}}},
+{0xe03a9,{{0x0,0x0,0x0}}},
+{0xe03aa,{{0x0,0x0,0x0}}},
+{0xe03ab,{{0x0,0x0,0x0}}},
+{0xe03ac,{{0x0,0x0,0x0}}},
+{0xe03ad,{{0x0,0x0,0x0}}},
+{0xe03ae,{{0x0,0x0,0x0}}},
+{0xe03af,{{0x0,0x0,0x0}}},
+{0xe03b0,{{0x0,0x0,0x0}}},
+{0xe03b1,{{0x0,0x0,0x0}}},
+{0xe03b2,{{0x0,0x0,0x0}}},
+{0xe03b3,{{0x0,0x0,0x0}}},
+{0xe03b4,{{0x0,0x0,0x0}}},
+{0xe03b5,{{0x0,0x0,0x0}}},
+{0xe03b6,{{0x0,0x0,0x0}}},
+{0xe03b7,{{0x0,0x0,0x0}}},
+{0xe03b8,{{0x0,0x0,0x0}}},
+{0xe03b9,{{0x0,0x0,0x0}}},
+{0xe03ba,{{0x0,0x0,0x0}}},
+{0xe03bb,{{0x0,0x0,0x0}}},
+{0xe03bc,{{0x0,0x0,0x0}}},
+{0xe03bd,{{0x0,0x0,0x0}}},
+{0xe03be,{{0x0,0x0,0x0}}},
+{0xe03bf,{{0x0,0x0,0x0}}},
+{0xe03c0,{{0x0,0x0,0x0}}},
+{0xe03c1,{{0x0,0x0,0x0}}},
+{0xe03c2,{{0x0,0x0,0x0}}},
+{0xe03c3,{{0x0,0x0,0x0}}},
+{0xe03c4,{{0x0,0x0,0x0}}},
+{0xe03c5,{{0x0,0x0,0x0}}},
+{0xe03c6,{{0x0,0x0,0x0}}},
+{0xe03c7,{{0x0,0x0,0x0}}},
+{0xe03c8,{{0x0,0x0,0x0}}},
+{0xe03c9,{{0x0,0x0,0x0}}},
+{0xe03ca,{{0x0,0x0,0x0}}},
+{0xe03cb,{{0x0,0x0,0x0}}},
+{0xe03cc,{{0x0,0x0,0x0}}},
+{0xe03cd,{{0x0,0x0,0x0}}},
+{0xe03ce,{{0x0,0x0,0x0}}},
+{0xe03cf,{{0x0,0x0,0x0}}},
+{0xe03d0,{{0x0,0x0,0x0}}},
+{0xe03d1,{{0x0,0x0,0x0}}},
+{0xe03d2,{{0x0,0x0,0x0}}},
+{0xe03d3,{{0x0,0x0,0x0}}},
+{0xe03d4,{{0x0,0x0,0x0}}},
+{0xe03d5,{{0x0,0x0,0x0}}},
+{0xe03d6,{{0x0,0x0,0x0}}},
+{0xe03d7,{{0x0,0x0,0x0}}},
+{0xe03d8,{{0x0,0x0,0x0}}},
+{0xe03d9,{{0x0,0x0,0x0}}},
+{0xe03da,{{0x0,0x0,0x0}}},
+{0xe03db,{{0x0,0x0,0x0}}},
+{0xe03dc,{{0x0,0x0,0x0}}},
+{0xe03dd,{{0x0,0x0,0x0}}},
+{0xe03de,{{0x0,0x0,0x0}}},
+{0xe03df,{{0x0,0x0,0x0}}},
+{0xe03e0,{{0x0,0x0,0x0}}},
+{0xe03e1,{{0x0,0x0,0x0}}},
+{0xe03e2,{{0x0,0x0,0x0}}},
+{0xe03e3,{{0x0,0x0,0x0}}},
+{0xe03e4,{{0x0,0x0,0x0}}},
+{0xe03e5,{{0x0,0x0,0x0}}},
+{0xe03e6,{{0x0,0x0,0x0}}},
+{0xe03e7,{{0x0,0x0,0x0}}},
+{0xe03e8,{{0x0,0x0,0x0}}},
+{0xe03e9,{{0x0,0x0,0x0}}},
+{0xe03ea,{{0x0,0x0,0x0}}},
+{0xe03eb,{{0x0,0x0,0x0}}},
+{0xe03ec,{{0x0,0x0,0x0}}},
+{0xe03ed,{{0x0,0x0,0x0}}},
+{0xe03ee,{{0x0,0x0,0x0}}},
+{0xe03ef,{{0x0,0x0,0x0}}},
+{0xe03f0,{{0x0,0x0,0x0}}},
+{0xe03f1,{{0x0,0x0,0x0}}},
+{0xe03f2,{{0x0,0x0,0x0}}},
+{0xe03f3,{{0x0,0x0,0x0}}},
+{0xe03f4,{{0x0,0x0,0x0}}},
+{0xe03f5,{{0x0,0x0,0x0}}},
+{0xe03f6,{{0x0,0x0,0x0}}},
+{0xe03f7,{{0x0,0x0,0x0}}},
+{0xe03f8,{{0x0,0x0,0x0}}},
+{0xe03f9,{{0x0,0x0,0x0}}},
+{0xe03fa,{{0x0,0x0,0x0}}},
+{0xe03fb,{{0x0,0x0,0x0}}},
+{0xe03fc,{{0x0,0x0,0x0}}},
+{0xe03fd,{{0x0,0x0,0x0}}},
+{0xe03fe,{{0x0,0x0,0x0}}},
+{0xe03ff,{{0x0,0x0,0x0}}},
+{0xe0400,{{0x0,0x0,0x0}}},
+{0xe0401,{{0x0,0x0,0x0}}},
+{0xe0402,{{0x0,0x0,0x0}}},
+{0xe0403,{{0x0,0x0,0x0}}},
+{0xe0404,{{0x0,0x0,0x0}}},
+{0xe0405,{{0x0,0x0,0x0}}},
+{0xe0406,{{0x0,0x0,0x0}}},
+{0xe0407,{{0x0,0x0,0x0}}},
+{0xe0408,{{0x0,0x0,0x0}}},
+{0xe0409,{{0x0,0x0,0x0}}},
+{0xe040a,{{0x0,0x0,0x0}}},
+{0xe040b,{{0x0,0x0,0x0}}},
+{0xe040c,{{0x0,0x0,0x0}}},
+{0xe040d,{{0x0,0x0,0x0}}},
+{0xe040e,{{0x0,0x0,0x0}}},
+{0xe040f,{{0x0,0x0,0x0}}},
+{0xe0410,{{0x0,0x0,0x0}}},
+{0xe0411,{{0x0,0x0,0x0}}},
+{0xe0412,{{0x0,0x0,0x0}}},
+{0xe0413,{{0x0,0x0,0x0}}},
+{0xe0414,{{0x0,0x0,0x0}}},
+{0xe0415,{{0x0,0x0,0x0}}},
+{0xe0416,{{0x0,0x0,0x0}}},
+{0xe0417,{{0x0,0x0,0x0}}},
+{0xe0418,{{0x0,0x0,0x0}}},
+{0xe0419,{{0x0,0x0,0x0}}},
+{0xe041a,{{0x0,0x0,0x0}}},
+{0xe041b,{{0x0,0x0,0x0}}},
+{0xe041c,{{0x0,0x0,0x0}}},
+{0xe041d,{{0x0,0x0,0x0}}},
+{0xe041e,{{0x0,0x0,0x0}}},
+{0xe041f,{{0x0,0x0,0x0}}},
+{0xe0420,{{0x0,0x0,0x0}}},
+{0xe0421,{{0x0,0x0,0x0}}},
+{0xe0422,{{0x0,0x0,0x0}}},
+{0xe0423,{{0x0,0x0,0x0}}},
+{0xe0424,{{0x0,0x0,0x0}}},
+{0xe0425,{{0x0,0x0,0x0}}},
+{0xe0426,{{0x0,0x0,0x0}}},
+{0xe0427,{{0x0,0x0,0x0}}},
+{0xe0428,{{0x0,0x0,0x0}}},
+{0xe0429,{{0x0,0x0,0x0}}},
+{0xe042a,{{0x0,0x0,0x0}}},
+{0xe042b,{{0x0,0x0,0x0}}},
+{0xe042c,{{0x0,0x0,0x0}}},
+{0xe042d,{{0x0,0x0,0x0}}},
+{0xe042e,{{0x0,0x0,0x0}}},
+{0xe042f,{{0x0,0x0,0x0}}},
+{0xe0430,{{0x0,0x0,0x0}}},
+{0xe0431,{{0x0,0x0,0x0}}},
+{0xe0432,{{0x0,0x0,0x0}}},
+{0xe0433,{{0x0,0x0,0x0}}},
+{0xe0434,{{0x0,0x0,0x0}}},
+{0xe0435,{{0x0,0x0,0x0}}},
+{0xe0436,{{0x0,0x0,0x0}}},
+{0xe0437,{{0x0,0x0,0x0}}},
+{0xe0438,{{0x0,0x0,0x0}}},
+{0xe0439,{{0x0,0x0,0x0}}},
+{0xe043a,{{0x0,0x0,0x0}}},
+{0xe043b,{{0x0,0x0,0x0}}},
+{0xe043c,{{0x0,0x0,0x0}}},
+{0xe043d,{{0x0,0x0,0x0}}},
+{0xe043e,{{0x0,0x0,0x0}}},
+{0xe043f,{{0x0,0x0,0x0}}},
+{0xe0440,{{0x0,0x0,0x0}}},
+{0xe0441,{{0x0,0x0,0x0}}},
+{0xe0442,{{0x0,0x0,0x0}}},
+{0xe0443,{{0x0,0x0,0x0}}},
+{0xe0444,{{0x0,0x0,0x0}}},
+{0xe0445,{{0x0,0x0,0x0}}},
+{0xe0446,{{0x0,0x0,0x0}}},
+{0xe0447,{{0x0,0x0,0x0}}},
+{0xe0448,{{0x0,0x0,0x0}}},
+{0xe0449,{{0x0,0x0,0x0}}},
+{0xe044a,{{0x0,0x0,0x0}}},
+{0xe044b,{{0x0,0x0,0x0}}},
+{0xe044c,{{0x0,0x0,0x0}}},
+{0xe044d,{{0x0,0x0,0x0}}},
+{0xe044e,{{0x0,0x0,0x0}}},
+{0xe044f,{{0x0,0x0,0x0}}},
+{0xe0450,{{0x0,0x0,0x0}}},
+{0xe0451,{{0x0,0x0,0x0}}},
+{0xe0452,{{0x0,0x0,0x0}}},
+{0xe0453,{{0x0,0x0,0x0}}},
+{0xe0454,{{0x0,0x0,0x0}}},
+{0xe0455,{{0x0,0x0,0x0}}},
+{0xe0456,{{0x0,0x0,0x0}}},
+{0xe0457,{{0x0,0x0,0x0}}},
+{0xe0458,{{0x0,0x0,0x0}}},
+{0xe0459,{{0x0,0x0,0x0}}},
+{0xe045a,{{0x0,0x0,0x0}}},
+{0xe045b,{{0x0,0x0,0x0}}},
+{0xe045c,{{0x0,0x0,0x0}}},
+{0xe045d,{{0x0,0x0,0x0}}},
+{0xe045e,{{0x0,0x0,0x0}}},
+{0xe045f,{{0x0,0x0,0x0}}},
+{0xe0460,{{0x0,0x0,0x0}}},
+{0xe0461,{{0x0,0x0,0x0}}},
+{0xe0462,{{0x0,0x0,0x0}}},
+{0xe0463,{{0x0,0x0,0x0}}},
+{0xe0464,{{0x0,0x0,0x0}}},
+{0xe0465,{{0x0,0x0,0x0}}},
+{0xe0466,{{0x0,0x0,0x0}}},
+{0xe0467,{{0x0,0x0,0x0}}},
+{0xe0468,{{0x0,0x0,0x0}}},
+{0xe0469,{{0x0,0x0,0x0}}},
+{0xe046a,{{0x0,0x0,0x0}}},
+{0xe046b,{{0x0,0x0,0x0}}},
+{0xe046c,{{0x0,0x0,0x0}}},
+{0xe046d,{{0x0,0x0,0x0}}},
+{0xe046e,{{0x0,0x0,0x0}}},
+{0xe046f,{{0x0,0x0,0x0}}},
+{0xe0470,{{0x0,0x0,0x0}}},
+{0xe0471,{{0x0,0x0,0x0}}},
+{0xe0472,{{0x0,0x0,0x0}}},
+{0xe0473,{{0x0,0x0,0x0}}},
+{0xe0474,{{0x0,0x0,0x0}}},
+{0xe0475,{{0x0,0x0,0x0}}},
+{0xe0476,{{0x0,0x0,0x0}}},
+{0xe0477,{{0x0,0x0,0x0}}},
+{0xe0478,{{0x0,0x0,0x0}}},
+{0xe0479,{{0x0,0x0,0x0}}},
+{0xe047a,{{0x0,0x0,0x0}}},
+{0xe047b,{{0x0,0x0,0x0}}},
+{0xe047c,{{0x0,0x0,0x0}}},
+{0xe047d,{{0x0,0x0,0x0}}},
+{0xe047e,{{0x0,0x0,0x0}}},
+{0xe047f,{{0x0,0x0,0x0}}},
+{0xe0480,{{0x0,0x0,0x0}}},
+{0xe0481,{{0x0,0x0,0x0}}},
+{0xe0482,{{0x0,0x0,0x0}}},
+{0xe0483,{{0x0,0x0,0x0}}},
+{0xe0484,{{0x0,0x0,0x0}}},
+{0xe0485,{{0x0,0x0,0x0}}},
+{0xe0486,{{0x0,0x0,0x0}}},
+{0xe0487,{{0x0,0x0,0x0}}},
+{0xe0488,{{0x0,0x0,0x0}}},
+{0xe0489,{{0x0,0x0,0x0}}},
+{0xe048a,{{0x0,0x0,0x0}}},
+{0xe048b,{{0x0,0x0,0x0}}},
+{0xe048c,{{0x0,0x0,0x0}}},
+{0xe048d,{{0x0,0x0,0x0}}},
+{0xe048e,{{0x0,0x0,0x0}}},
+{0xe048f,{{0x0,0x0,0x0}}},
+{0xe0490,{{0x0,0x0,0x0}}},
+{0xe0491,{{0x0,0x0,0x0}}},
+{0xe0492,{{0x0,0x0,0x0}}},
+{0xe0493,{{0x0,0x0,0x0}}},
+{0xe0494,{{0x0,0x0,0x0}}},
+{0xe0495,{{0x0,0x0,0x0}}},
+{0xe0496,{{0x0,0x0,0x0}}},
+{0xe0497,{{0x0,0x0,0x0}}},
+{0xe0498,{{0x0,0x0,0x0}}},
+{0xe0499,{{0x0,0x0,0x0}}},
+{0xe049a,{{0x0,0x0,0x0}}},
+{0xe049b,{{0x0,0x0,0x0}}},
+{0xe049c,{{0x0,0x0,0x0}}},
+{0xe049d,{{0x0,0x0,0x0}}},
+{0xe049e,{{0x0,0x0,0x0}}},
+{0xe049f,{{0x0,0x0,0x0}}},
+{0xe04a0,{{0x0,0x0,0x0}}},
+{0xe04a1,{{0x0,0x0,0x0}}},
+{0xe04a2,{{0x0,0x0,0x0}}},
+{0xe04a3,{{0x0,0x0,0x0}}},
+{0xe04a4,{{0x0,0x0,0x0}}},
+{0xe04a5,{{0x0,0x0,0x0}}},
+{0xe04a6,{{0x0,0x0,0x0}}},
+{0xe04a7,{{0x0,0x0,0x0}}},
+{0xe04a8,{{0x0,0x0,0x0}}},
+{0xe04a9,{{0x0,0x0,0x0}}},
+{0xe04aa,{{0x0,0x0,0x0}}},
+{0xe04ab,{{0x0,0x0,0x0}}},
+{0xe04ac,{{0x0,0x0,0x0}}},
+{0xe04ad,{{0x0,0x0,0x0}}},
+{0xe04ae,{{0x0,0x0,0x0}}},
+{0xe04af,{{0x0,0x0,0x0}}},
+{0xe04b0,{{0x0,0x0,0x0}}},
+{0xe04b1,{{0x0,0x0,0x0}}},
+{0xe04b2,{{0x0,0x0,0x0}}},
+{0xe04b3,{{0x0,0x0,0x0}}},
+{0xe04b4,{{0x0,0x0,0x0}}},
+{0xe04b5,{{0x0,0x0,0x0}}},
+{0xe04b6,{{0x0,0x0,0x0}}},
+{0xe04b7,{{0x0,0x0,0x0}}},
+{0xe04b8,{{0x0,0x0,0x0}}},
+{0xe04b9,{{0x0,0x0,0x0}}},
+{0xe04ba,{{0x0,0x0,0x0}}},
+{0xe04bb,{{0x0,0x0,0x0}}},
+{0xe04bc,{{0x0,0x0,0x0}}},
+{0xe04bd,{{0x0,0x0,0x0}}},
+{0xe04be,{{0x0,0x0,0x0}}},
+{0xe04bf,{{0x0,0x0,0x0}}},
+{0xe04c0,{{0x0,0x0,0x0}}},
+{0xe04c1,{{0x0,0x0,0x0}}},
+{0xe04c2,{{0x0,0x0,0x0}}},
+{0xe04c3,{{0x0,0x0,0x0}}},
+{0xe04c4,{{0x0,0x0,0x0}}},
+{0xe04c5,{{0x0,0x0,0x0}}},
+{0xe04c6,{{0x0,0x0,0x0}}},
+{0xe04c7,{{0x0,0x0,0x0}}},
+{0xe04c8,{{0x0,0x0,0x0}}},
+{0xe04c9,{{0x0,0x0,0x0}}},
+{0xe04ca,{{0x0,0x0,0x0}}},
+{0xe04cb,{{0x0,0x0,0x0}}},
+{0xe04cc,{{0x0,0x0,0x0}}},
+{0xe04cd,{{0x0,0x0,0x0}}},
+{0xe04ce,{{0x0,0x0,0x0}}},
+{0xe04cf,{{0x0,0x0,0x0}}},
+{0xe04d0,{{0x0,0x0,0x0}}},
+{0xe04d1,{{0x0,0x0,0x0}}},
+{0xe04d2,{{0x0,0x0,0x0}}},
+{0xe04d3,{{0x0,0x0,0x0}}},
+{0xe04d4,{{0x0,0x0,0x0}}},
+{0xe04d5,{{0x0,0x0,0x0}}},
+{0xe04d6,{{0x0,0x0,0x0}}},
+{0xe04d7,{{0x0,0x0,0x0}}},
+{0xe04d8,{{0x0,0x0,0x0}}},
+{0xe04d9,{{0x0,0x0,0x0}}},
+{0xe04da,{{0x0,0x0,0x0}}},
+{0xe04db,{{0x0,0x0,0x0}}},
+{0xe04dc,{{0x0,0x0,0x0}}},
+{0xe04dd,{{0x0,0x0,0x0}}},
+{0xe04de,{{0x0,0x0,0x0}}},
+{0xe04df,{{0x0,0x0,0x0}}},
+{0xe04e0,{{0x0,0x0,0x0}}},
+{0xe04e1,{{0x0,0x0,0x0}}},
+{0xe04e2,{{0x0,0x0,0x0}}},
+{0xe04e3,{{0x0,0x0,0x0}}},
+{0xe04e4,{{0x0,0x0,0x0}}},
+{0xe04e5,{{0x0,0x0,0x0}}},
+{0xe04e6,{{0x0,0x0,0x0}}},
+{0xe04e7,{{0x0,0x0,0x0}}},
+{0xe04e8,{{0x0,0x0,0x0}}},
+{0xe04e9,{{0x0,0x0,0x0}}},
+{0xe04ea,{{0x0,0x0,0x0}}},
+{0xe04eb,{{0x0,0x0,0x0}}},
+{0xe04ec,{{0x0,0x0,0x0}}},
+{0xe04ed,{{0x0,0x0,0x0}}},
+{0xe04ee,{{0x0,0x0,0x0}}},
+{0xe04ef,{{0x0,0x0,0x0}}},
+{0xe04f0,{{0x0,0x0,0x0}}},
+{0xe04f1,{{0x0,0x0,0x0}}},
+{0xe04f2,{{0x0,0x0,0x0}}},
+{0xe04f3,{{0x0,0x0,0x0}}},
+{0xe04f4,{{0x0,0x0,0x0}}},
+{0xe04f5,{{0x0,0x0,0x0}}},
+{0xe04f6,{{0x0,0x0,0x0}}},
+{0xe04f7,{{0x0,0x0,0x0}}},
+{0xe04f8,{{0x0,0x0,0x0}}},
+{0xe04f9,{{0x0,0x0,0x0}}},
+{0xe04fa,{{0x0,0x0,0x0}}},
+{0xe04fb,{{0x0,0x0,0x0}}},
+{0xe04fc,{{0x0,0x0,0x0}}},
+{0xe04fd,{{0x0,0x0,0x0}}},
+{0xe04fe,{{0x0,0x0,0x0}}},
+{0xe04ff,{{0x0,0x0,0x0}}},
+{0xe0500,{{0x0,0x0,0x0}}},
+{0xe0501,{{0x0,0x0,0x0}}},
+{0xe0502,{{0x0,0x0,0x0}}},
+{0xe0503,{{0x0,0x0,0x0}}},
+{0xe0504,{{0x0,0x0,0x0}}},
+{0xe0505,{{0x0,0x0,0x0}}},
+{0xe0506,{{0x0,0x0,0x0}}},
+{0xe0507,{{0x0,0x0,0x0}}},
+{0xe0508,{{0x0,0x0,0x0}}},
+{0xe0509,{{0x0,0x0,0x0}}},
+{0xe050a,{{0x0,0x0,0x0}}},
+{0xe050b,{{0x0,0x0,0x0}}},
+{0xe050c,{{0x0,0x0,0x0}}},
+{0xe050d,{{0x0,0x0,0x0}}},
+{0xe050e,{{0x0,0x0,0x0}}},
+{0xe050f,{{0x0,0x0,0x0}}},
+{0xe0510,{{0x0,0x0,0x0}}},
+{0xe0511,{{0x0,0x0,0x0}}},
+{0xe0512,{{0x0,0x0,0x0}}},
+{0xe0513,{{0x0,0x0,0x0}}},
+{0xe0514,{{0x0,0x0,0x0}}},
+{0xe0515,{{0x0,0x0,0x0}}},
+{0xe0516,{{0x0,0x0,0x0}}},
+{0xe0517,{{0x0,0x0,0x0}}},
+{0xe0518,{{0x0,0x0,0x0}}},
+{0xe0519,{{0x0,0x0,0x0}}},
+{0xe051a,{{0x0,0x0,0x0}}},
+{0xe051b,{{0x0,0x0,0x0}}},
+{0xe051c,{{0x0,0x0,0x0}}},
+{0xe051d,{{0x0,0x0,0x0}}},
+{0xe051e,{{0x0,0x0,0x0}}},
+{0xe051f,{{0x0,0x0,0x0}}},
+{0xe0520,{{0x0,0x0,0x0}}},
+{0xe0521,{{0x0,0x0,0x0}}},
+{0xe0522,{{0x0,0x0,0x0}}},
+{0xe0523,{{0x0,0x0,0x0}}},
+{0xe0524,{{0x0,0x0,0x0}}},
+{0xe0525,{{0x0,0x0,0x0}}},
+{0xe0526,{{0x0,0x0,0x0}}},
+{0xe0527,{{0x0,0x0,0x0}}},
+{0xe0528,{{0x0,0x0,0x0}}},
+{0xe0529,{{0x0,0x0,0x0}}},
+{0xe052a,{{0x0,0x0,0x0}}},
+{0xe052b,{{0x0,0x0,0x0}}},
+{0xe052c,{{0x0,0x0,0x0}}},
+{0xe052d,{{0x0,0x0,0x0}}},
+{0xe052e,{{0x0,0x0,0x0}}},
+{0xe052f,{{0x0,0x0,0x0}}},
+{0xe0530,{{0x0,0x0,0x0}}},
+{0xe0531,{{0x0,0x0,0x0}}},
+{0xe0532,{{0x0,0x0,0x0}}},
+{0xe0533,{{0x0,0x0,0x0}}},
+{0xe0534,{{0x0,0x0,0x0}}},
+{0xe0535,{{0x0,0x0,0x0}}},
+{0xe0536,{{0x0,0x0,0x0}}},
+{0xe0537,{{0x0,0x0,0x0}}},
+{0xe0538,{{0x0,0x0,0x0}}},
+{0xe0539,{{0x0,0x0,0x0}}},
+{0xe053a,{{0x0,0x0,0x0}}},
+{0xe053b,{{0x0,0x0,0x0}}},
+{0xe053c,{{0x0,0x0,0x0}}},
+{0xe053d,{{0x0,0x0,0x0}}},
+{0xe053e,{{0x0,0x0,0x0}}},
+{0xe053f,{{0x0,0x0,0x0}}},
+{0xe0540,{{0x0,0x0,0x0}}},
+{0xe0541,{{0x0,0x0,0x0}}},
+{0xe0542,{{0x0,0x0,0x0}}},
+{0xe0543,{{0x0,0x0,0x0}}},
+{0xe0544,{{0x0,0x0,0x0}}},
+{0xe0545,{{0x0,0x0,0x0}}},
+{0xe0546,{{0x0,0x0,0x0}}},
+{0xe0547,{{0x0,0x0,0x0}}},
+{0xe0548,{{0x0,0x0,0x0}}},
+{0xe0549,{{0x0,0x0,0x0}}},
+{0xe054a,{{0x0,0x0,0x0}}},
+{0xe054b,{{0x0,0x0,0x0}}},
+{0xe054c,{{0x0,0x0,0x0}}},
+{0xe054d,{{0x0,0x0,0x0}}},
+{0xe054e,{{0x0,0x0,0x0}}},
+{0xe054f,{{0x0,0x0,0x0}}},
+{0xe0550,{{0x0,0x0,0x0}}},
+{0xe0551,{{0x0,0x0,0x0}}},
+{0xe0552,{{0x0,0x0,0x0}}},
+{0xe0553,{{0x0,0x0,0x0}}},
+{0xe0554,{{0x0,0x0,0x0}}},
+{0xe0555,{{0x0,0x0,0x0}}},
+{0xe0556,{{0x0,0x0,0x0}}},
+{0xe0557,{{0x0,0x0,0x0}}},
+{0xe0558,{{0x0,0x0,0x0}}},
+{0xe0559,{{0x0,0x0,0x0}}},
+{0xe055a,{{0x0,0x0,0x0}}},
+{0xe055b,{{0x0,0x0,0x0}}},
+{0xe055c,{{0x0,0x0,0x0}}},
+{0xe055d,{{0x0,0x0,0x0}}},
+{0xe055e,{{0x0,0x0,0x0}}},
+{0xe055f,{{0x0,0x0,0x0}}},
+{0xe0560,{{0x0,0x0,0x0}}},
+{0xe0561,{{0x0,0x0,0x0}}},
+{0xe0562,{{0x0,0x0,0x0}}},
+{0xe0563,{{0x0,0x0,0x0}}},
+{0xe0564,{{0x0,0x0,0x0}}},
+{0xe0565,{{0x0,0x0,0x0}}},
+{0xe0566,{{0x0,0x0,0x0}}},
+{0xe0567,{{0x0,0x0,0x0}}},
+{0xe0568,{{0x0,0x0,0x0}}},
+{0xe0569,{{0x0,0x0,0x0}}},
+{0xe056a,{{0x0,0x0,0x0}}},
+{0xe056b,{{0x0,0x0,0x0}}},
+{0xe056c,{{0x0,0x0,0x0}}},
+{0xe056d,{{0x0,0x0,0x0}}},
+{0xe056e,{{0x0,0x0,0x0}}},
+{0xe056f,{{0x0,0x0,0x0}}},
+{0xe0570,{{0x0,0x0,0x0}}},
+{0xe0571,{{0x0,0x0,0x0}}},
+{0xe0572,{{0x0,0x0,0x0}}},
+{0xe0573,{{0x0,0x0,0x0}}},
+{0xe0574,{{0x0,0x0,0x0}}},
+{0xe0575,{{0x0,0x0,0x0}}},
+{0xe0576,{{0x0,0x0,0x0}}},
+{0xe0577,{{0x0,0x0,0x0}}},
+{0xe0578,{{0x0,0x0,0x0}}},
+{0xe0579,{{0x0,0x0,0x0}}},
+{0xe057a,{{0x0,0x0,0x0}}},
+{0xe057b,{{0x0,0x0,0x0}}},
+{0xe057c,{{0x0,0x0,0x0}}},
+{0xe057d,{{0x0,0x0,0x0}}},
+{0xe057e,{{0x0,0x0,0x0}}},
+{0xe057f,{{0x0,0x0,0x0}}},
+{0xe0580,{{0x0,0x0,0x0}}},
+{0xe0581,{{0x0,0x0,0x0}}},
+{0xe0582,{{0x0,0x0,0x0}}},
+{0xe0583,{{0x0,0x0,0x0}}},
+{0xe0584,{{0x0,0x0,0x0}}},
+{0xe0585,{{0x0,0x0,0x0}}},
+{0xe0586,{{0x0,0x0,0x0}}},
+{0xe0587,{{0x0,0x0,0x0}}},
+{0xe0588,{{0x0,0x0,0x0}}},
+{0xe0589,{{0x0,0x0,0x0}}},
+{0xe058a,{{0x0,0x0,0x0}}},
+{0xe058b,{{0x0,0x0,0x0}}},
+{0xe058c,{{0x0,0x0,0x0}}},
+{0xe058d,{{0x0,0x0,0x0}}},
+{0xe058e,{{0x0,0x0,0x0}}},
+{0xe058f,{{0x0,0x0,0x0}}},
+{0xe0590,{{0x0,0x0,0x0}}},
+{0xe0591,{{0x0,0x0,0x0}}},
+{0xe0592,{{0x0,0x0,0x0}}},
+{0xe0593,{{0x0,0x0,0x0}}},
+{0xe0594,{{0x0,0x0,0x0}}},
+{0xe0595,{{0x0,0x0,0x0}}},
+{0xe0596,{{0x0,0x0,0x0}}},
+{0xe0597,{{0x0,0x0,0x0}}},
+{0xe0598,{{0x0,0x0,0x0}}},
+{0xe0599,{{0x0,0x0,0x0}}},
+{0xe059a,{{0x0,0x0,0x0}}},
+{0xe059b,{{0x0,0x0,0x0}}},
+{0xe059c,{{0x0,0x0,0x0}}},
+{0xe059d,{{0x0,0x0,0x0}}},
+{0xe059e,{{0x0,0x0,0x0}}},
+{0xe059f,{{0x0,0x0,0x0}}},
+{0xe05a0,{{0x0,0x0,0x0}}},
+{0xe05a1,{{0x0,0x0,0x0}}},
+{0xe05a2,{{0x0,0x0,0x0}}},
+{0xe05a3,{{0x0,0x0,0x0}}},
+{0xe05a4,{{0x0,0x0,0x0}}},
+{0xe05a5,{{0x0,0x0,0x0}}},
+{0xe05a6,{{0x0,0x0,0x0}}},
+{0xe05a7,{{0x0,0x0,0x0}}},
+{0xe05a8,{{0x0,0x0,0x0}}},
+{0xe05a9,{{0x0,0x0,0x0}}},
+{0xe05aa,{{0x0,0x0,0x0}}},
+{0xe05ab,{{0x0,0x0,0x0}}},
+{0xe05ac,{{0x0,0x0,0x0}}},
+{0xe05ad,{{0x0,0x0,0x0}}},
+{0xe05ae,{{0x0,0x0,0x0}}},
+{0xe05af,{{0x0,0x0,0x0}}},
+{0xe05b0,{{0x0,0x0,0x0}}},
+{0xe05b1,{{0x0,0x0,0x0}}},
+{0xe05b2,{{0x0,0x0,0x0}}},
+{0xe05b3,{{0x0,0x0,0x0}}},
+{0xe05b4,{{0x0,0x0,0x0}}},
+{0xe05b5,{{0x0,0x0,0x0}}},
+{0xe05b6,{{0x0,0x0,0x0}}},
+{0xe05b7,{{0x0,0x0,0x0}}},
+{0xe05b8,{{0x0,0x0,0x0}}},
+{0xe05b9,{{0x0,0x0,0x0}}},
+{0xe05ba,{{0x0,0x0,0x0}}},
+{0xe05bb,{{0x0,0x0,0x0}}},
+{0xe05bc,{{0x0,0x0,0x0}}},
+{0xe05bd,{{0x0,0x0,0x0}}},
+{0xe05be,{{0x0,0x0,0x0}}},
+{0xe05bf,{{0x0,0x0,0x0}}},
+{0xe05c0,{{0x0,0x0,0x0}}},
+{0xe05c1,{{0x0,0x0,0x0}}},
+{0xe05c2,{{0x0,0x0,0x0}}},
+{0xe05c3,{{0x0,0x0,0x0}}},
+{0xe05c4,{{0x0,0x0,0x0}}},
+{0xe05c5,{{0x0,0x0,0x0}}},
+{0xe05c6,{{0x0,0x0,0x0}}},
+{0xe05c7,{{0x0,0x0,0x0}}},
+{0xe05c8,{{0x0,0x0,0x0}}},
+{0xe05c9,{{0x0,0x0,0x0}}},
+{0xe05ca,{{0x0,0x0,0x0}}},
+{0xe05cb,{{0x0,0x0,0x0}}},
+{0xe05cc,{{0x0,0x0,0x0}}},
+{0xe05cd,{{0x0,0x0,0x0}}},
+{0xe05ce,{{0x0,0x0,0x0}}},
+{0xe05cf,{{0x0,0x0,0x0}}},
+{0xe05d0,{{0x0,0x0,0x0}}},
+{0xe05d1,{{0x0,0x0,0x0}}},
+{0xe05d2,{{0x0,0x0,0x0}}},
+{0xe05d3,{{0x0,0x0,0x0}}},
+{0xe05d4,{{0x0,0x0,0x0}}},
+{0xe05d5,{{0x0,0x0,0x0}}},
+{0xe05d6,{{0x0,0x0,0x0}}},
+{0xe05d7,{{0x0,0x0,0x0}}},
+{0xe05d8,{{0x0,0x0,0x0}}},
+{0xe05d9,{{0x0,0x0,0x0}}},
+{0xe05da,{{0x0,0x0,0x0}}},
+{0xe05db,{{0x0,0x0,0x0}}},
+{0xe05dc,{{0x0,0x0,0x0}}},
+{0xe05dd,{{0x0,0x0,0x0}}},
+{0xe05de,{{0x0,0x0,0x0}}},
+{0xe05df,{{0x0,0x0,0x0}}},
+{0xe05e0,{{0x0,0x0,0x0}}},
+{0xe05e1,{{0x0,0x0,0x0}}},
+{0xe05e2,{{0x0,0x0,0x0}}},
+{0xe05e3,{{0x0,0x0,0x0}}},
+{0xe05e4,{{0x0,0x0,0x0}}},
+{0xe05e5,{{0x0,0x0,0x0}}},
+{0xe05e6,{{0x0,0x0,0x0}}},
+{0xe05e7,{{0x0,0x0,0x0}}},
+{0xe05e8,{{0x0,0x0,0x0}}},
+{0xe05e9,{{0x0,0x0,0x0}}},
+{0xe05ea,{{0x0,0x0,0x0}}},
+{0xe05eb,{{0x0,0x0,0x0}}},
+{0xe05ec,{{0x0,0x0,0x0}}},
+{0xe05ed,{{0x0,0x0,0x0}}},
+{0xe05ee,{{0x0,0x0,0x0}}},
+{0xe05ef,{{0x0,0x0,0x0}}},
+{0xe05f0,{{0x0,0x0,0x0}}},
+{0xe05f1,{{0x0,0x0,0x0}}},
+{0xe05f2,{{0x0,0x0,0x0}}},
+{0xe05f3,{{0x0,0x0,0x0}}},
+{0xe05f4,{{0x0,0x0,0x0}}},
+{0xe05f5,{{0x0,0x0,0x0}}},
+{0xe05f6,{{0x0,0x0,0x0}}},
+{0xe05f7,{{0x0,0x0,0x0}}},
+{0xe05f8,{{0x0,0x0,0x0}}},
+{0xe05f9,{{0x0,0x0,0x0}}},
+{0xe05fa,{{0x0,0x0,0x0}}},
+{0xe05fb,{{0x0,0x0,0x0}}},
+{0xe05fc,{{0x0,0x0,0x0}}},
+{0xe05fd,{{0x0,0x0,0x0}}},
+{0xe05fe,{{0x0,0x0,0x0}}},
+{0xe05ff,{{0x0,0x0,0x0}}},
+{0xe0600,{{0x0,0x0,0x0}}},
+{0xe0601,{{0x0,0x0,0x0}}},
+{0xe0602,{{0x0,0x0,0x0}}},
+{0xe0603,{{0x0,0x0,0x0}}},
+{0xe0604,{{0x0,0x0,0x0}}},
+{0xe0605,{{0x0,0x0,0x0}}},
+{0xe0606,{{0x0,0x0,0x0}}},
+{0xe0607,{{0x0,0x0,0x0}}},
+{0xe0608,{{0x0,0x0,0x0}}},
+{0xe0609,{{0x0,0x0,0x0}}},
+{0xe060a,{{0x0,0x0,0x0}}},
+{0xe060b,{{0x0,0x0,0x0}}},
+{0xe060c,{{0x0,0x0,0x0}}},
+{0xe060d,{{0x0,0x0,0x0}}},
+{0xe060e,{{0x0,0x0,0x0}}},
+{0xe060f,{{0x0,0x0,0x0}}},
+{0xe0610,{{0x0,0x0,0x0}}},
+{0xe0611,{{0x0,0x0,0x0}}},
+{0xe0612,{{0x0,0x0,0x0}}},
+{0xe0613,{{0x0,0x0,0x0}}},
+{0xe0614,{{0x0,0x0,0x0}}},
+{0xe0615,{{0x0,0x0,0x0}}},
+{0xe0616,{{0x0,0x0,0x0}}},
+{0xe0617,{{0x0,0x0,0x0}}},
+{0xe0618,{{0x0,0x0,0x0}}},
+{0xe0619,{{0x0,0x0,0x0}}},
+{0xe061a,{{0x0,0x0,0x0}}},
+{0xe061b,{{0x0,0x0,0x0}}},
+{0xe061c,{{0x0,0x0,0x0}}},
+{0xe061d,{{0x0,0x0,0x0}}},
+{0xe061e,{{0x0,0x0,0x0}}},
+{0xe061f,{{0x0,0x0,0x0}}},
+{0xe0620,{{0x0,0x0,0x0}}},
+{0xe0621,{{0x0,0x0,0x0}}},
+{0xe0622,{{0x0,0x0,0x0}}},
+{0xe0623,{{0x0,0x0,0x0}}},
+{0xe0624,{{0x0,0x0,0x0}}},
+{0xe0625,{{0x0,0x0,0x0}}},
+{0xe0626,{{0x0,0x0,0x0}}},
+{0xe0627,{{0x0,0x0,0x0}}},
+{0xe0628,{{0x0,0x0,0x0}}},
+{0xe0629,{{0x0,0x0,0x0}}},
+{0xe062a,{{0x0,0x0,0x0}}},
+{0xe062b,{{0x0,0x0,0x0}}},
+{0xe062c,{{0x0,0x0,0x0}}},
+{0xe062d,{{0x0,0x0,0x0}}},
+{0xe062e,{{0x0,0x0,0x0}}},
+{0xe062f,{{0x0,0x0,0x0}}},
+{0xe0630,{{0x0,0x0,0x0}}},
+{0xe0631,{{0x0,0x0,0x0}}},
+{0xe0632,{{0x0,0x0,0x0}}},
+{0xe0633,{{0x0,0x0,0x0}}},
+{0xe0634,{{0x0,0x0,0x0}}},
+{0xe0635,{{0x0,0x0,0x0}}},
+{0xe0636,{{0x0,0x0,0x0}}},
+{0xe0637,{{0x0,0x0,0x0}}},
+{0xe0638,{{0x0,0x0,0x0}}},
+{0xe0639,{{0x0,0x0,0x0}}},
+{0xe063a,{{0x0,0x0,0x0}}},
+{0xe063b,{{0x0,0x0,0x0}}},
+{0xe063c,{{0x0,0x0,0x0}}},
+{0xe063d,{{0x0,0x0,0x0}}},
+{0xe063e,{{0x0,0x0,0x0}}},
+{0xe063f,{{0x0,0x0,0x0}}},
+{0xe0640,{{0x0,0x0,0x0}}},
+{0xe0641,{{0x0,0x0,0x0}}},
+{0xe0642,{{0x0,0x0,0x0}}},
+{0xe0643,{{0x0,0x0,0x0}}},
+{0xe0644,{{0x0,0x0,0x0}}},
+{0xe0645,{{0x0,0x0,0x0}}},
+{0xe0646,{{0x0,0x0,0x0}}},
+{0xe0647,{{0x0,0x0,0x0}}},
+{0xe0648,{{0x0,0x0,0x0}}},
+{0xe0649,{{0x0,0x0,0x0}}},
+{0xe064a,{{0x0,0x0,0x0}}},
+{0xe064b,{{0x0,0x0,0x0}}},
+{0xe064c,{{0x0,0x0,0x0}}},
+{0xe064d,{{0x0,0x0,0x0}}},
+{0xe064e,{{0x0,0x0,0x0}}},
+{0xe064f,{{0x0,0x0,0x0}}},
+{0xe0650,{{0x0,0x0,0x0}}},
+{0xe0651,{{0x0,0x0,0x0}}},
+{0xe0652,{{0x0,0x0,0x0}}},
+{0xe0653,{{0x0,0x0,0x0}}},
+{0xe0654,{{0x0,0x0,0x0}}},
+{0xe0655,{{0x0,0x0,0x0}}},
+{0xe0656,{{0x0,0x0,0x0}}},
+{0xe0657,{{0x0,0x0,0x0}}},
+{0xe0658,{{0x0,0x0,0x0}}},
+{0xe0659,{{0x0,0x0,0x0}}},
+{0xe065a,{{0x0,0x0,0x0}}},
+{0xe065b,{{0x0,0x0,0x0}}},
+{0xe065c,{{0x0,0x0,0x0}}},
+{0xe065d,{{0x0,0x0,0x0}}},
+{0xe065e,{{0x0,0x0,0x0}}},
+{0xe065f,{{0x0,0x0,0x0}}},
+{0xe0660,{{0x0,0x0,0x0}}},
+{0xe0661,{{0x0,0x0,0x0}}},
+{0xe0662,{{0x0,0x0,0x0}}},
+{0xe0663,{{0x0,0x0,0x0}}},
+{0xe0664,{{0x0,0x0,0x0}}},
+{0xe0665,{{0x0,0x0,0x0}}},
+{0xe0666,{{0x0,0x0,0x0}}},
+{0xe0667,{{0x0,0x0,0x0}}},
+{0xe0668,{{0x0,0x0,0x0}}},
+{0xe0669,{{0x0,0x0,0x0}}},
+{0xe066a,{{0x0,0x0,0x0}}},
+{0xe066b,{{0x0,0x0,0x0}}},
+{0xe066c,{{0x0,0x0,0x0}}},
+{0xe066d,{{0x0,0x0,0x0}}},
+{0xe066e,{{0x0,0x0,0x0}}},
+{0xe066f,{{0x0,0x0,0x0}}},
+{0xe0670,{{0x0,0x0,0x0}}},
+{0xe0671,{{0x0,0x0,0x0}}},
+{0xe0672,{{0x0,0x0,0x0}}},
+{0xe0673,{{0x0,0x0,0x0}}},
+{0xe0674,{{0x0,0x0,0x0}}},
+{0xe0675,{{0x0,0x0,0x0}}},
+{0xe0676,{{0x0,0x0,0x0}}},
+{0xe0677,{{0x0,0x0,0x0}}},
+{0xe0678,{{0x0,0x0,0x0}}},
+{0xe0679,{{0x0,0x0,0x0}}},
+{0xe067a,{{0x0,0x0,0x0}}},
+{0xe067b,{{0x0,0x0,0x0}}},
+{0xe067c,{{0x0,0x0,0x0}}},
+{0xe067d,{{0x0,0x0,0x0}}},
+{0xe067e,{{0x0,0x0,0x0}}},
+{0xe067f,{{0x0,0x0,0x0}}},
+{0xe0680,{{0x0,0x0,0x0}}},
+{0xe0681,{{0x0,0x0,0x0}}},
+{0xe0682,{{0x0,0x0,0x0}}},
+{0xe0683,{{0x0,0x0,0x0}}},
+{0xe0684,{{0x0,0x0,0x0}}},
+{0xe0685,{{0x0,0x0,0x0}}},
+{0xe0686,{{0x0,0x0,0x0}}},
+{0xe0687,{{0x0,0x0,0x0}}},
+{0xe0688,{{0x0,0x0,0x0}}},
+{0xe0689,{{0x0,0x0,0x0}}},
+{0xe068a,{{0x0,0x0,0x0}}},
+{0xe068b,{{0x0,0x0,0x0}}},
+{0xe068c,{{0x0,0x0,0x0}}},
+{0xe068d,{{0x0,0x0,0x0}}},
+{0xe068e,{{0x0,0x0,0x0}}},
+{0xe068f,{{0x0,0x0,0x0}}},
+{0xe0690,{{0x0,0x0,0x0}}},
+{0xe0691,{{0x0,0x0,0x0}}},
+{0xe0692,{{0x0,0x0,0x0}}},
+{0xe0693,{{0x0,0x0,0x0}}},
+{0xe0694,{{0x0,0x0,0x0}}},
+{0xe0695,{{0x0,0x0,0x0}}},
+{0xe0696,{{0x0,0x0,0x0}}},
+{0xe0697,{{0x0,0x0,0x0}}},
+{0xe0698,{{0x0,0x0,0x0}}},
+{0xe0699,{{0x0,0x0,0x0}}},
+{0xe069a,{{0x0,0x0,0x0}}},
+{0xe069b,{{0x0,0x0,0x0}}},
+{0xe069c,{{0x0,0x0,0x0}}},
+{0xe069d,{{0x0,0x0,0x0}}},
+{0xe069e,{{0x0,0x0,0x0}}},
+{0xe069f,{{0x0,0x0,0x0}}},
+{0xe06a0,{{0x0,0x0,0x0}}},
+{0xe06a1,{{0x0,0x0,0x0}}},
+{0xe06a2,{{0x0,0x0,0x0}}},
+{0xe06a3,{{0x0,0x0,0x0}}},
+{0xe06a4,{{0x0,0x0,0x0}}},
+{0xe06a5,{{0x0,0x0,0x0}}},
+{0xe06a6,{{0x0,0x0,0x0}}},
+{0xe06a7,{{0x0,0x0,0x0}}},
+{0xe06a8,{{0x0,0x0,0x0}}},
+{0xe06a9,{{0x0,0x0,0x0}}},
+{0xe06aa,{{0x0,0x0,0x0}}},
+{0xe06ab,{{0x0,0x0,0x0}}},
+{0xe06ac,{{0x0,0x0,0x0}}},
+{0xe06ad,{{0x0,0x0,0x0}}},
+{0xe06ae,{{0x0,0x0,0x0}}},
+{0xe06af,{{0x0,0x0,0x0}}},
+{0xe06b0,{{0x0,0x0,0x0}}},
+{0xe06b1,{{0x0,0x0,0x0}}},
+{0xe06b2,{{0x0,0x0,0x0}}},
+{0xe06b3,{{0x0,0x0,0x0}}},
+{0xe06b4,{{0x0,0x0,0x0}}},
+{0xe06b5,{{0x0,0x0,0x0}}},
+{0xe06b6,{{0x0,0x0,0x0}}},
+{0xe06b7,{{0x0,0x0,0x0}}},
+{0xe06b8,{{0x0,0x0,0x0}}},
+{0xe06b9,{{0x0,0x0,0x0}}},
+{0xe06ba,{{0x0,0x0,0x0}}},
+{0xe06bb,{{0x0,0x0,0x0}}},
+{0xe06bc,{{0x0,0x0,0x0}}},
+{0xe06bd,{{0x0,0x0,0x0}}},
+{0xe06be,{{0x0,0x0,0x0}}},
+{0xe06bf,{{0x0,0x0,0x0}}},
+{0xe06c0,{{0x0,0x0,0x0}}},
+{0xe06c1,{{0x0,0x0,0x0}}},
+{0xe06c2,{{0x0,0x0,0x0}}},
+{0xe06c3,{{0x0,0x0,0x0}}},
+{0xe06c4,{{0x0,0x0,0x0}}},
+{0xe06c5,{{0x0,0x0,0x0}}},
+{0xe06c6,{{0x0,0x0,0x0}}},
+{0xe06c7,{{0x0,0x0,0x0}}},
+{0xe06c8,{{0x0,0x0,0x0}}},
+{0xe06c9,{{0x0,0x0,0x0}}},
+{0xe06ca,{{0x0,0x0,0x0}}},
+{0xe06cb,{{0x0,0x0,0x0}}},
+{0xe06cc,{{0x0,0x0,0x0}}},
+{0xe06cd,{{0x0,0x0,0x0}}},
+{0xe06ce,{{0x0,0x0,0x0}}},
+{0xe06cf,{{0x0,0x0,0x0}}},
+{0xe06d0,{{0x0,0x0,0x0}}},
+{0xe06d1,{{0x0,0x0,0x0}}},
+{0xe06d2,{{0x0,0x0,0x0}}},
+{0xe06d3,{{0x0,0x0,0x0}}},
+{0xe06d4,{{0x0,0x0,0x0}}},
+{0xe06d5,{{0x0,0x0,0x0}}},
+{0xe06d6,{{0x0,0x0,0x0}}},
+{0xe06d7,{{0x0,0x0,0x0}}},
+{0xe06d8,{{0x0,0x0,0x0}}},
+{0xe06d9,{{0x0,0x0,0x0}}},
+{0xe06da,{{0x0,0x0,0x0}}},
+{0xe06db,{{0x0,0x0,0x0}}},
+{0xe06dc,{{0x0,0x0,0x0}}},
+{0xe06dd,{{0x0,0x0,0x0}}},
+{0xe06de,{{0x0,0x0,0x0}}},
+{0xe06df,{{0x0,0x0,0x0}}},
+{0xe06e0,{{0x0,0x0,0x0}}},
+{0xe06e1,{{0x0,0x0,0x0}}},
+{0xe06e2,{{0x0,0x0,0x0}}},
+{0xe06e3,{{0x0,0x0,0x0}}},
+{0xe06e4,{{0x0,0x0,0x0}}},
+{0xe06e5,{{0x0,0x0,0x0}}},
+{0xe06e6,{{0x0,0x0,0x0}}},
+{0xe06e7,{{0x0,0x0,0x0}}},
+{0xe06e8,{{0x0,0x0,0x0}}},
+{0xe06e9,{{0x0,0x0,0x0}}},
+{0xe06ea,{{0x0,0x0,0x0}}},
+{0xe06eb,{{0x0,0x0,0x0}}},
+{0xe06ec,{{0x0,0x0,0x0}}},
+{0xe06ed,{{0x0,0x0,0x0}}},
+{0xe06ee,{{0x0,0x0,0x0}}},
+{0xe06ef,{{0x0,0x0,0x0}}},
+{0xe06f0,{{0x0,0x0,0x0}}},
+{0xe06f1,{{0x0,0x0,0x0}}},
+{0xe06f2,{{0x0,0x0,0x0}}},
+{0xe06f3,{{0x0,0x0,0x0}}},
+{0xe06f4,{{0x0,0x0,0x0}}},
+{0xe06f5,{{0x0,0x0,0x0}}},
+{0xe06f6,{{0x0,0x0,0x0}}},
+{0xe06f7,{{0x0,0x0,0x0}}},
+{0xe06f8,{{0x0,0x0,0x0}}},
+{0xe06f9,{{0x0,0x0,0x0}}},
+{0xe06fa,{{0x0,0x0,0x0}}},
+{0xe06fb,{{0x0,0x0,0x0}}},
+{0xe06fc,{{0x0,0x0,0x0}}},
+{0xe06fd,{{0x0,0x0,0x0}}},
+{0xe06fe,{{0x0,0x0,0x0}}},
+{0xe06ff,{{0x0,0x0,0x0}}},
+{0xe0700,{{0x0,0x0,0x0}}},
+{0xe0701,{{0x0,0x0,0x0}}},
+{0xe0702,{{0x0,0x0,0x0}}},
+{0xe0703,{{0x0,0x0,0x0}}},
+{0xe0704,{{0x0,0x0,0x0}}},
+{0xe0705,{{0x0,0x0,0x0}}},
+{0xe0706,{{0x0,0x0,0x0}}},
+{0xe0707,{{0x0,0x0,0x0}}},
+{0xe0708,{{0x0,0x0,0x0}}},
+{0xe0709,{{0x0,0x0,0x0}}},
+{0xe070a,{{0x0,0x0,0x0}}},
+{0xe070b,{{0x0,0x0,0x0}}},
+{0xe070c,{{0x0,0x0,0x0}}},
+{0xe070d,{{0x0,0x0,0x0}}},
+{0xe070e,{{0x0,0x0,0x0}}},
+{0xe070f,{{0x0,0x0,0x0}}},
+{0xe0710,{{0x0,0x0,0x0}}},
+{0xe0711,{{0x0,0x0,0x0}}},
+{0xe0712,{{0x0,0x0,0x0}}},
+{0xe0713,{{0x0,0x0,0x0}}},
+{0xe0714,{{0x0,0x0,0x0}}},
+{0xe0715,{{0x0,0x0,0x0}}},
+{0xe0716,{{0x0,0x0,0x0}}},
+{0xe0717,{{0x0,0x0,0x0}}},
+{0xe0718,{{0x0,0x0,0x0}}},
+{0xe0719,{{0x0,0x0,0x0}}},
+{0xe071a,{{0x0,0x0,0x0}}},
+{0xe071b,{{0x0,0x0,0x0}}},
+{0xe071c,{{0x0,0x0,0x0}}},
+{0xe071d,{{0x0,0x0,0x0}}},
+{0xe071e,{{0x0,0x0,0x0}}},
+{0xe071f,{{0x0,0x0,0x0}}},
+{0xe0720,{{0x0,0x0,0x0}}},
+{0xe0721,{{0x0,0x0,0x0}}},
+{0xe0722,{{0x0,0x0,0x0}}},
+{0xe0723,{{0x0,0x0,0x0}}},
+{0xe0724,{{0x0,0x0,0x0}}},
+{0xe0725,{{0x0,0x0,0x0}}},
+{0xe0726,{{0x0,0x0,0x0}}},
+{0xe0727,{{0x0,0x0,0x0}}},
+{0xe0728,{{0x0,0x0,0x0}}},
+{0xe0729,{{0x0,0x0,0x0}}},
+{0xe072a,{{0x0,0x0,0x0}}},
+{0xe072b,{{0x0,0x0,0x0}}},
+{0xe072c,{{0x0,0x0,0x0}}},
+{0xe072d,{{0x0,0x0,0x0}}},
+{0xe072e,{{0x0,0x0,0x0}}},
+{0xe072f,{{0x0,0x0,0x0}}},
+{0xe0730,{{0x0,0x0,0x0}}},
+{0xe0731,{{0x0,0x0,0x0}}},
+{0xe0732,{{0x0,0x0,0x0}}},
+{0xe0733,{{0x0,0x0,0x0}}},
+{0xe0734,{{0x0,0x0,0x0}}},
+{0xe0735,{{0x0,0x0,0x0}}},
+{0xe0736,{{0x0,0x0,0x0}}},
+{0xe0737,{{0x0,0x0,0x0}}},
+{0xe0738,{{0x0,0x0,0x0}}},
+{0xe0739,{{0x0,0x0,0x0}}},
+{0xe073a,{{0x0,0x0,0x0}}},
+{0xe073b,{{0x0,0x0,0x0}}},
+{0xe073c,{{0x0,0x0,0x0}}},
+{0xe073d,{{0x0,0x0,0x0}}},
+{0xe073e,{{0x0,0x0,0x0}}},
+{0xe073f,{{0x0,0x0,0x0}}},
+{0xe0740,{{0x0,0x0,0x0}}},
+{0xe0741,{{0x0,0x0,0x0}}},
+{0xe0742,{{0x0,0x0,0x0}}},
+{0xe0743,{{0x0,0x0,0x0}}},
+{0xe0744,{{0x0,0x0,0x0}}},
+{0xe0745,{{0x0,0x0,0x0}}},
+{0xe0746,{{0x0,0x0,0x0}}},
+{0xe0747,{{0x0,0x0,0x0}}},
+{0xe0748,{{0x0,0x0,0x0}}},
+{0xe0749,{{0x0,0x0,0x0}}},
+{0xe074a,{{0x0,0x0,0x0}}},
+{0xe074b,{{0x0,0x0,0x0}}},
+{0xe074c,{{0x0,0x0,0x0}}},
+{0xe074d,{{0x0,0x0,0x0}}},
+{0xe074e,{{0x0,0x0,0x0}}},
+{0xe074f,{{0x0,0x0,0x0}}},
+{0xe0750,{{0x0,0x0,0x0}}},
+{0xe0751,{{0x0,0x0,0x0}}},
+{0xe0752,{{0x0,0x0,0x0}}},
+{0xe0753,{{0x0,0x0,0x0}}},
+{0xe0754,{{0x0,0x0,0x0}}},
+{0xe0755,{{0x0,0x0,0x0}}},
+{0xe0756,{{0x0,0x0,0x0}}},
+{0xe0757,{{0x0,0x0,0x0}}},
+{0xe0758,{{0x0,0x0,0x0}}},
+{0xe0759,{{0x0,0x0,0x0}}},
+{0xe075a,{{0x0,0x0,0x0}}},
+{0xe075b,{{0x0,0x0,0x0}}},
+{0xe075c,{{0x0,0x0,0x0}}},
+{0xe075d,{{0x0,0x0,0x0}}},
+{0xe075e,{{0x0,0x0,0x0}}},
+{0xe075f,{{0x0,0x0,0x0}}},
+{0xe0760,{{0x0,0x0,0x0}}},
+{0xe0761,{{0x0,0x0,0x0}}},
+{0xe0762,{{0x0,0x0,0x0}}},
+{0xe0763,{{0x0,0x0,0x0}}},
+{0xe0764,{{0x0,0x0,0x0}}},
+{0xe0765,{{0x0,0x0,0x0}}},
+{0xe0766,{{0x0,0x0,0x0}}},
+{0xe0767,{{0x0,0x0,0x0}}},
+{0xe0768,{{0x0,0x0,0x0}}},
+{0xe0769,{{0x0,0x0,0x0}}},
+{0xe076a,{{0x0,0x0,0x0}}},
+{0xe076b,{{0x0,0x0,0x0}}},
+{0xe076c,{{0x0,0x0,0x0}}},
+{0xe076d,{{0x0,0x0,0x0}}},
+{0xe076e,{{0x0,0x0,0x0}}},
+{0xe076f,{{0x0,0x0,0x0}}},
+{0xe0770,{{0x0,0x0,0x0}}},
+{0xe0771,{{0x0,0x0,0x0}}},
+{0xe0772,{{0x0,0x0,0x0}}},
+{0xe0773,{{0x0,0x0,0x0}}},
+{0xe0774,{{0x0,0x0,0x0}}},
+{0xe0775,{{0x0,0x0,0x0}}},
+{0xe0776,{{0x0,0x0,0x0}}},
+{0xe0777,{{0x0,0x0,0x0}}},
+{0xe0778,{{0x0,0x0,0x0}}},
+{0xe0779,{{0x0,0x0,0x0}}},
+{0xe077a,{{0x0,0x0,0x0}}},
+{0xe077b,{{0x0,0x0,0x0}}},
+{0xe077c,{{0x0,0x0,0x0}}},
+{0xe077d,{{0x0,0x0,0x0}}},
+{0xe077e,{{0x0,0x0,0x0}}},
+{0xe077f,{{0x0,0x0,0x0}}},
+{0xe0780,{{0x0,0x0,0x0}}},
+{0xe0781,{{0x0,0x0,0x0}}},
+{0xe0782,{{0x0,0x0,0x0}}},
+{0xe0783,{{0x0,0x0,0x0}}},
+{0xe0784,{{0x0,0x0,0x0}}},
+{0xe0785,{{0x0,0x0,0x0}}},
+{0xe0786,{{0x0,0x0,0x0}}},
+{0xe0787,{{0x0,0x0,0x0}}},
+{0xe0788,{{0x0,0x0,0x0}}},
+{0xe0789,{{0x0,0x0,0x0}}},
+{0xe078a,{{0x0,0x0,0x0}}},
+{0xe078b,{{0x0,0x0,0x0}}},
+{0xe078c,{{0x0,0x0,0x0}}},
+{0xe078d,{{0x0,0x0,0x0}}},
+{0xe078e,{{0x0,0x0,0x0}}},
+{0xe078f,{{0x0,0x0,0x0}}},
+{0xe0790,{{0x0,0x0,0x0}}},
+{0xe0791,{{0x0,0x0,0x0}}},
+{0xe0792,{{0x0,0x0,0x0}}},
+{0xe0793,{{0x0,0x0,0x0}}},
+{0xe0794,{{0x0,0x0,0x0}}},
+{0xe0795,{{0x0,0x0,0x0}}},
+{0xe0796,{{0x0,0x0,0x0}}},
+{0xe0797,{{0x0,0x0,0x0}}},
+{0xe0798,{{0x0,0x0,0x0}}},
+{0xe0799,{{0x0,0x0,0x0}}},
+{0xe079a,{{0x0,0x0,0x0}}},
+{0xe079b,{{0x0,0x0,0x0}}},
+{0xe079c,{{0x0,0x0,0x0}}},
+{0xe079d,{{0x0,0x0,0x0}}},
+{0xe079e,{{0x0,0x0,0x0}}},
+{0xe079f,{{0x0,0x0,0x0}}},
+{0xe07a0,{{0x0,0x0,0x0}}},
+{0xe07a1,{{0x0,0x0,0x0}}},
+{0xe07a2,{{0x0,0x0,0x0}}},
+{0xe07a3,{{0x0,0x0,0x0}}},
+{0xe07a4,{{0x0,0x0,0x0}}},
+{0xe07a5,{{0x0,0x0,0x0}}},
+{0xe07a6,{{0x0,0x0,0x0}}},
+{0xe07a7,{{0x0,0x0,0x0}}},
+{0xe07a8,{{0x0,0x0,0x0}}},
+{0xe07a9,{{0x0,0x0,0x0}}},
+{0xe07aa,{{0x0,0x0,0x0}}},
+{0xe07ab,{{0x0,0x0,0x0}}},
+{0xe07ac,{{0x0,0x0,0x0}}},
+{0xe07ad,{{0x0,0x0,0x0}}},
+{0xe07ae,{{0x0,0x0,0x0}}},
+{0xe07af,{{0x0,0x0,0x0}}},
+{0xe07b0,{{0x0,0x0,0x0}}},
+{0xe07b1,{{0x0,0x0,0x0}}},
+{0xe07b2,{{0x0,0x0,0x0}}},
+{0xe07b3,{{0x0,0x0,0x0}}},
+{0xe07b4,{{0x0,0x0,0x0}}},
+{0xe07b5,{{0x0,0x0,0x0}}},
+{0xe07b6,{{0x0,0x0,0x0}}},
+{0xe07b7,{{0x0,0x0,0x0}}},
+{0xe07b8,{{0x0,0x0,0x0}}},
+{0xe07b9,{{0x0,0x0,0x0}}},
+{0xe07ba,{{0x0,0x0,0x0}}},
+{0xe07bb,{{0x0,0x0,0x0}}},
+{0xe07bc,{{0x0,0x0,0x0}}},
+{0xe07bd,{{0x0,0x0,0x0}}},
+{0xe07be,{{0x0,0x0,0x0}}},
+{0xe07bf,{{0x0,0x0,0x0}}},
+{0xe07c0,{{0x0,0x0,0x0}}},
+{0xe07c1,{{0x0,0x0,0x0}}},
+{0xe07c2,{{0x0,0x0,0x0}}},
+{0xe07c3,{{0x0,0x0,0x0}}},
+{0xe07c4,{{0x0,0x0,0x0}}},
+{0xe07c5,{{0x0,0x0,0x0}}},
+{0xe07c6,{{0x0,0x0,0x0}}},
+{0xe07c7,{{0x0,0x0,0x0}}},
+{0xe07c8,{{0x0,0x0,0x0}}},
+{0xe07c9,{{0x0,0x0,0x0}}},
+{0xe07ca,{{0x0,0x0,0x0}}},
+{0xe07cb,{{0x0,0x0,0x0}}},
+{0xe07cc,{{0x0,0x0,0x0}}},
+{0xe07cd,{{0x0,0x0,0x0}}},
+{0xe07ce,{{0x0,0x0,0x0}}},
+{0xe07cf,{{0x0,0x0,0x0}}},
+{0xe07d0,{{0x0,0x0,0x0}}},
+{0xe07d1,{{0x0,0x0,0x0}}},
+{0xe07d2,{{0x0,0x0,0x0}}},
+{0xe07d3,{{0x0,0x0,0x0}}},
+{0xe07d4,{{0x0,0x0,0x0}}},
+{0xe07d5,{{0x0,0x0,0x0}}},
+{0xe07d6,{{0x0,0x0,0x0}}},
+{0xe07d7,{{0x0,0x0,0x0}}},
+{0xe07d8,{{0x0,0x0,0x0}}},
+{0xe07d9,{{0x0,0x0,0x0}}},
+{0xe07da,{{0x0,0x0,0x0}}},
+{0xe07db,{{0x0,0x0,0x0}}},
+{0xe07dc,{{0x0,0x0,0x0}}},
+{0xe07dd,{{0x0,0x0,0x0}}},
+{0xe07de,{{0x0,0x0,0x0}}},
+{0xe07df,{{0x0,0x0,0x0}}},
+{0xe07e0,{{0x0,0x0,0x0}}},
+{0xe07e1,{{0x0,0x0,0x0}}},
+{0xe07e2,{{0x0,0x0,0x0}}},
+{0xe07e3,{{0x0,0x0,0x0}}},
+{0xe07e4,{{0x0,0x0,0x0}}},
+{0xe07e5,{{0x0,0x0,0x0}}},
+{0xe07e6,{{0x0,0x0,0x0}}},
+{0xe07e7,{{0x0,0x0,0x0}}},
+{0xe07e8,{{0x0,0x0,0x0}}},
+{0xe07e9,{{0x0,0x0,0x0}}},
+{0xe07ea,{{0x0,0x0,0x0}}},
+{0xe07eb,{{0x0,0x0,0x0}}},
+{0xe07ec,{{0x0,0x0,0x0}}},
+{0xe07ed,{{0x0,0x0,0x0}}},
+{0xe07ee,{{0x0,0x0,0x0}}},
+{0xe07ef,{{0x0,0x0,0x0}}},
+{0xe07f0,{{0x0,0x0,0x0}}},
+{0xe07f1,{{0x0,0x0,0x0}}},
+{0xe07f2,{{0x0,0x0,0x0}}},
+{0xe07f3,{{0x0,0x0,0x0}}},
+{0xe07f4,{{0x0,0x0,0x0}}},
+{0xe07f5,{{0x0,0x0,0x0}}},
+{0xe07f6,{{0x0,0x0,0x0}}},
+{0xe07f7,{{0x0,0x0,0x0}}},
+{0xe07f8,{{0x0,0x0,0x0}}},
+{0xe07f9,{{0x0,0x0,0x0}}},
+{0xe07fa,{{0x0,0x0,0x0}}},
+{0xe07fb,{{0x0,0x0,0x0}}},
+{0xe07fc,{{0x0,0x0,0x0}}},
+{0xe07fd,{{0x0,0x0,0x0}}},
+{0xe07fe,{{0x0,0x0,0x0}}},
+{0xe07ff,{{0x0,0x0,0x0}}},
+{0xe0800,{{0x0,0x0,0x0}}},
+{0xe0801,{{0x0,0x0,0x0}}},
+{0xe0802,{{0x0,0x0,0x0}}},
+{0xe0803,{{0x0,0x0,0x0}}},
+{0xe0804,{{0x0,0x0,0x0}}},
+{0xe0805,{{0x0,0x0,0x0}}},
+{0xe0806,{{0x0,0x0,0x0}}},
+{0xe0807,{{0x0,0x0,0x0}}},
+{0xe0808,{{0x0,0x0,0x0}}},
+{0xe0809,{{0x0,0x0,0x0}}},
+{0xe080a,{{0x0,0x0,0x0}}},
+{0xe080b,{{0x0,0x0,0x0}}},
+{0xe080c,{{0x0,0x0,0x0}}},
+{0xe080d,{{0x0,0x0,0x0}}},
+{0xe080e,{{0x0,0x0,0x0}}},
+{0xe080f,{{0x0,0x0,0x0}}},
+{0xe0810,{{0x0,0x0,0x0}}},
+{0xe0811,{{0x0,0x0,0x0}}},
+{0xe0812,{{0x0,0x0,0x0}}},
+{0xe0813,{{0x0,0x0,0x0}}},
+{0xe0814,{{0x0,0x0,0x0}}},
+{0xe0815,{{0x0,0x0,0x0}}},
+{0xe0816,{{0x0,0x0,0x0}}},
+{0xe0817,{{0x0,0x0,0x0}}},
+{0xe0818,{{0x0,0x0,0x0}}},
+{0xe0819,{{0x0,0x0,0x0}}},
+{0xe081a,{{0x0,0x0,0x0}}},
+{0xe081b,{{0x0,0x0,0x0}}},
+{0xe081c,{{0x0,0x0,0x0}}},
+{0xe081d,{{0x0,0x0,0x0}}},
+{0xe081e,{{0x0,0x0,0x0}}},
+{0xe081f,{{0x0,0x0,0x0}}},
+{0xe0820,{{0x0,0x0,0x0}}},
+{0xe0821,{{0x0,0x0,0x0}}},
+{0xe0822,{{0x0,0x0,0x0}}},
+{0xe0823,{{0x0,0x0,0x0}}},
+{0xe0824,{{0x0,0x0,0x0}}},
+{0xe0825,{{0x0,0x0,0x0}}},
+{0xe0826,{{0x0,0x0,0x0}}},
+{0xe0827,{{0x0,0x0,0x0}}},
+{0xe0828,{{0x0,0x0,0x0}}},
+{0xe0829,{{0x0,0x0,0x0}}},
+{0xe082a,{{0x0,0x0,0x0}}},
+{0xe082b,{{0x0,0x0,0x0}}},
+{0xe082c,{{0x0,0x0,0x0}}},
+{0xe082d,{{0x0,0x0,0x0}}},
+{0xe082e,{{0x0,0x0,0x0}}},
+{0xe082f,{{0x0,0x0,0x0}}},
+{0xe0830,{{0x0,0x0,0x0}}},
+{0xe0831,{{0x0,0x0,0x0}}},
+{0xe0832,{{0x0,0x0,0x0}}},
+{0xe0833,{{0x0,0x0,0x0}}},
+{0xe0834,{{0x0,0x0,0x0}}},
+{0xe0835,{{0x0,0x0,0x0}}},
+{0xe0836,{{0x0,0x0,0x0}}},
+{0xe0837,{{0x0,0x0,0x0}}},
+{0xe0838,{{0x0,0x0,0x0}}},
+{0xe0839,{{0x0,0x0,0x0}}},
+{0xe083a,{{0x0,0x0,0x0}}},
+{0xe083b,{{0x0,0x0,0x0}}},
+{0xe083c,{{0x0,0x0,0x0}}},
+{0xe083d,{{0x0,0x0,0x0}}},
+{0xe083e,{{0x0,0x0,0x0}}},
+{0xe083f,{{0x0,0x0,0x0}}},
+{0xe0840,{{0x0,0x0,0x0}}},
+{0xe0841,{{0x0,0x0,0x0}}},
+{0xe0842,{{0x0,0x0,0x0}}},
+{0xe0843,{{0x0,0x0,0x0}}},
+{0xe0844,{{0x0,0x0,0x0}}},
+{0xe0845,{{0x0,0x0,0x0}}},
+{0xe0846,{{0x0,0x0,0x0}}},
+{0xe0847,{{0x0,0x0,0x0}}},
+{0xe0848,{{0x0,0x0,0x0}}},
+{0xe0849,{{0x0,0x0,0x0}}},
+{0xe084a,{{0x0,0x0,0x0}}},
+{0xe084b,{{0x0,0x0,0x0}}},
+{0xe084c,{{0x0,0x0,0x0}}},
+{0xe084d,{{0x0,0x0,0x0}}},
+{0xe084e,{{0x0,0x0,0x0}}},
+{0xe084f,{{0x0,0x0,0x0}}},
+{0xe0850,{{0x0,0x0,0x0}}},
+{0xe0851,{{0x0,0x0,0x0}}},
+{0xe0852,{{0x0,0x0,0x0}}},
+{0xe0853,{{0x0,0x0,0x0}}},
+{0xe0854,{{0x0,0x0,0x0}}},
+{0xe0855,{{0x0,0x0,0x0}}},
+{0xe0856,{{0x0,0x0,0x0}}},
+{0xe0857,{{0x0,0x0,0x0}}},
+{0xe0858,{{0x0,0x0,0x0}}},
+{0xe0859,{{0x0,0x0,0x0}}},
+{0xe085a,{{0x0,0x0,0x0}}},
+{0xe085b,{{0x0,0x0,0x0}}},
+{0xe085c,{{0x0,0x0,0x0}}},
+{0xe085d,{{0x0,0x0,0x0}}},
+{0xe085e,{{0x0,0x0,0x0}}},
+{0xe085f,{{0x0,0x0,0x0}}},
+{0xe0860,{{0x0,0x0,0x0}}},
+{0xe0861,{{0x0,0x0,0x0}}},
+{0xe0862,{{0x0,0x0,0x0}}},
+{0xe0863,{{0x0,0x0,0x0}}},
+{0xe0864,{{0x0,0x0,0x0}}},
+{0xe0865,{{0x0,0x0,0x0}}},
+{0xe0866,{{0x0,0x0,0x0}}},
+{0xe0867,{{0x0,0x0,0x0}}},
+{0xe0868,{{0x0,0x0,0x0}}},
+{0xe0869,{{0x0,0x0,0x0}}},
+{0xe086a,{{0x0,0x0,0x0}}},
+{0xe086b,{{0x0,0x0,0x0}}},
+{0xe086c,{{0x0,0x0,0x0}}},
+{0xe086d,{{0x0,0x0,0x0}}},
+{0xe086e,{{0x0,0x0,0x0}}},
+{0xe086f,{{0x0,0x0,0x0}}},
+{0xe0870,{{0x0,0x0,0x0}}},
+{0xe0871,{{0x0,0x0,0x0}}},
+{0xe0872,{{0x0,0x0,0x0}}},
+{0xe0873,{{0x0,0x0,0x0}}},
+{0xe0874,{{0x0,0x0,0x0}}},
+{0xe0875,{{0x0,0x0,0x0}}},
+{0xe0876,{{0x0,0x0,0x0}}},
+{0xe0877,{{0x0,0x0,0x0}}},
+{0xe0878,{{0x0,0x0,0x0}}},
+{0xe0879,{{0x0,0x0,0x0}}},
+{0xe087a,{{0x0,0x0,0x0}}},
+{0xe087b,{{0x0,0x0,0x0}}},
+{0xe087c,{{0x0,0x0,0x0}}},
+{0xe087d,{{0x0,0x0,0x0}}},
+{0xe087e,{{0x0,0x0,0x0}}},
+{0xe087f,{{0x0,0x0,0x0}}},
+{0xe0880,{{0x0,0x0,0x0}}},
+{0xe0881,{{0x0,0x0,0x0}}},
+{0xe0882,{{0x0,0x0,0x0}}},
+{0xe0883,{{0x0,0x0,0x0}}},
+{0xe0884,{{0x0,0x0,0x0}}},
+{0xe0885,{{0x0,0x0,0x0}}},
+{0xe0886,{{0x0,0x0,0x0}}},
+{0xe0887,{{0x0,0x0,0x0}}},
+{0xe0888,{{0x0,0x0,0x0}}},
+{0xe0889,{{0x0,0x0,0x0}}},
+{0xe088a,{{0x0,0x0,0x0}}},
+{0xe088b,{{0x0,0x0,0x0}}},
+{0xe088c,{{0x0,0x0,0x0}}},
+{0xe088d,{{0x0,0x0,0x0}}},
+{0xe088e,{{0x0,0x0,0x0}}},
+{0xe088f,{{0x0,0x0,0x0}}},
+{0xe0890,{{0x0,0x0,0x0}}},
+{0xe0891,{{0x0,0x0,0x0}}},
+{0xe0892,{{0x0,0x0,0x0}}},
+{0xe0893,{{0x0,0x0,0x0}}},
+{0xe0894,{{0x0,0x0,0x0}}},
+{0xe0895,{{0x0,0x0,0x0}}},
+{0xe0896,{{0x0,0x0,0x0}}},
+{0xe0897,{{0x0,0x0,0x0}}},
+{0xe0898,{{0x0,0x0,0x0}}},
+{0xe0899,{{0x0,0x0,0x0}}},
+{0xe089a,{{0x0,0x0,0x0}}},
+{0xe089b,{{0x0,0x0,0x0}}},
+{0xe089c,{{0x0,0x0,0x0}}},
+{0xe089d,{{0x0,0x0,0x0}}},
+{0xe089e,{{0x0,0x0,0x0}}},
+{0xe089f,{{0x0,0x0,0x0}}},
+{0xe08a0,{{0x0,0x0,0x0}}},
+{0xe08a1,{{0x0,0x0,0x0}}},
+{0xe08a2,{{0x0,0x0,0x0}}},
+{0xe08a3,{{0x0,0x0,0x0}}},
+{0xe08a4,{{0x0,0x0,0x0}}},
+{0xe08a5,{{0x0,0x0,0x0}}},
+{0xe08a6,{{0x0,0x0,0x0}}},
+{0xe08a7,{{0x0,0x0,0x0}}},
+{0xe08a8,{{0x0,0x0,0x0}}},
+{0xe08a9,{{0x0,0x0,0x0}}},
+{0xe08aa,{{0x0,0x0,0x0}}},
+{0xe08ab,{{0x0,0x0,0x0}}},
+{0xe08ac,{{0x0,0x0,0x0}}},
+{0xe08ad,{{0x0,0x0,0x0}}},
+{0xe08ae,{{0x0,0x0,0x0}}},
+{0xe08af,{{0x0,0x0,0x0}}},
+{0xe08b0,{{0x0,0x0,0x0}}},
+{0xe08b1,{{0x0,0x0,0x0}}},
+{0xe08b2,{{0x0,0x0,0x0}}},
+{0xe08b3,{{0x0,0x0,0x0}}},
+{0xe08b4,{{0x0,0x0,0x0}}},
+{0xe08b5,{{0x0,0x0,0x0}}},
+{0xe08b6,{{0x0,0x0,0x0}}},
+{0xe08b7,{{0x0,0x0,0x0}}},
+{0xe08b8,{{0x0,0x0,0x0}}},
+{0xe08b9,{{0x0,0x0,0x0}}},
+{0xe08ba,{{0x0,0x0,0x0}}},
+{0xe08bb,{{0x0,0x0,0x0}}},
+{0xe08bc,{{0x0,0x0,0x0}}},
+{0xe08bd,{{0x0,0x0,0x0}}},
+{0xe08be,{{0x0,0x0,0x0}}},
+{0xe08bf,{{0x0,0x0,0x0}}},
+{0xe08c0,{{0x0,0x0,0x0}}},
+{0xe08c1,{{0x0,0x0,0x0}}},
+{0xe08c2,{{0x0,0x0,0x0}}},
+{0xe08c3,{{0x0,0x0,0x0}}},
+{0xe08c4,{{0x0,0x0,0x0}}},
+{0xe08c5,{{0x0,0x0,0x0}}},
+{0xe08c6,{{0x0,0x0,0x0}}},
+{0xe08c7,{{0x0,0x0,0x0}}},
+{0xe08c8,{{0x0,0x0,0x0}}},
+{0xe08c9,{{0x0,0x0,0x0}}},
+{0xe08ca,{{0x0,0x0,0x0}}},
+{0xe08cb,{{0x0,0x0,0x0}}},
+{0xe08cc,{{0x0,0x0,0x0}}},
+{0xe08cd,{{0x0,0x0,0x0}}},
+{0xe08ce,{{0x0,0x0,0x0}}},
+{0xe08cf,{{0x0,0x0,0x0}}},
+{0xe08d0,{{0x0,0x0,0x0}}},
+{0xe08d1,{{0x0,0x0,0x0}}},
+{0xe08d2,{{0x0,0x0,0x0}}},
+{0xe08d3,{{0x0,0x0,0x0}}},
+{0xe08d4,{{0x0,0x0,0x0}}},
+{0xe08d5,{{0x0,0x0,0x0}}},
+{0xe08d6,{{0x0,0x0,0x0}}},
+{0xe08d7,{{0x0,0x0,0x0}}},
+{0xe08d8,{{0x0,0x0,0x0}}},
+{0xe08d9,{{0x0,0x0,0x0}}},
+{0xe08da,{{0x0,0x0,0x0}}},
+{0xe08db,{{0x0,0x0,0x0}}},
+{0xe08dc,{{0x0,0x0,0x0}}},
+{0xe08dd,{{0x0,0x0,0x0}}},
+{0xe08de,{{0x0,0x0,0x0}}},
+{0xe08df,{{0x0,0x0,0x0}}},
+{0xe08e0,{{0x0,0x0,0x0}}},
+{0xe08e1,{{0x0,0x0,0x0}}},
+{0xe08e2,{{0x0,0x0,0x0}}},
+{0xe08e3,{{0x0,0x0,0x0}}},
+{0xe08e4,{{0x0,0x0,0x0}}},
+{0xe08e5,{{0x0,0x0,0x0}}},
+{0xe08e6,{{0x0,0x0,0x0}}},
+{0xe08e7,{{0x0,0x0,0x0}}},
+{0xe08e8,{{0x0,0x0,0x0}}},
+{0xe08e9,{{0x0,0x0,0x0}}},
+{0xe08ea,{{0x0,0x0,0x0}}},
+{0xe08eb,{{0x0,0x0,0x0}}},
+{0xe08ec,{{0x0,0x0,0x0}}},
+{0xe08ed,{{0x0,0x0,0x0}}},
+{0xe08ee,{{0x0,0x0,0x0}}},
+{0xe08ef,{{0x0,0x0,0x0}}},
+{0xe08f0,{{0x0,0x0,0x0}}},
+{0xe08f1,{{0x0,0x0,0x0}}},
+{0xe08f2,{{0x0,0x0,0x0}}},
+{0xe08f3,{{0x0,0x0,0x0}}},
+{0xe08f4,{{0x0,0x0,0x0}}},
+{0xe08f5,{{0x0,0x0,0x0}}},
+{0xe08f6,{{0x0,0x0,0x0}}},
+{0xe08f7,{{0x0,0x0,0x0}}},
+{0xe08f8,{{0x0,0x0,0x0}}},
+{0xe08f9,{{0x0,0x0,0x0}}},
+{0xe08fa,{{0x0,0x0,0x0}}},
+{0xe08fb,{{0x0,0x0,0x0}}},
+{0xe08fc,{{0x0,0x0,0x0}}},
+{0xe08fd,{{0x0,0x0,0x0}}},
+{0xe08fe,{{0x0,0x0,0x0}}},
+{0xe08ff,{{0x0,0x0,0x0}}},
+{0xe0900,{{0x0,0x0,0x0}}},
+{0xe0901,{{0x0,0x0,0x0}}},
+{0xe0902,{{0x0,0x0,0x0}}},
+{0xe0903,{{0x0,0x0,0x0}}},
+{0xe0904,{{0x0,0x0,0x0}}},
+{0xe0905,{{0x0,0x0,0x0}}},
+{0xe0906,{{0x0,0x0,0x0}}},
+{0xe0907,{{0x0,0x0,0x0}}},
+{0xe0908,{{0x0,0x0,0x0}}},
+{0xe0909,{{0x0,0x0,0x0}}},
+{0xe090a,{{0x0,0x0,0x0}}},
+{0xe090b,{{0x0,0x0,0x0}}},
+{0xe090c,{{0x0,0x0,0x0}}},
+{0xe090d,{{0x0,0x0,0x0}}},
+{0xe090e,{{0x0,0x0,0x0}}},
+{0xe090f,{{0x0,0x0,0x0}}},
+{0xe0910,{{0x0,0x0,0x0}}},
+{0xe0911,{{0x0,0x0,0x0}}},
+{0xe0912,{{0x0,0x0,0x0}}},
+{0xe0913,{{0x0,0x0,0x0}}},
+{0xe0914,{{0x0,0x0,0x0}}},
+{0xe0915,{{0x0,0x0,0x0}}},
+{0xe0916,{{0x0,0x0,0x0}}},
+{0xe0917,{{0x0,0x0,0x0}}},
+{0xe0918,{{0x0,0x0,0x0}}},
+{0xe0919,{{0x0,0x0,0x0}}},
+{0xe091a,{{0x0,0x0,0x0}}},
+{0xe091b,{{0x0,0x0,0x0}}},
+{0xe091c,{{0x0,0x0,0x0}}},
+{0xe091d,{{0x0,0x0,0x0}}},
+{0xe091e,{{0x0,0x0,0x0}}},
+{0xe091f,{{0x0,0x0,0x0}}},
+{0xe0920,{{0x0,0x0,0x0}}},
+{0xe0921,{{0x0,0x0,0x0}}},
+{0xe0922,{{0x0,0x0,0x0}}},
+{0xe0923,{{0x0,0x0,0x0}}},
+{0xe0924,{{0x0,0x0,0x0}}},
+{0xe0925,{{0x0,0x0,0x0}}},
+{0xe0926,{{0x0,0x0,0x0}}},
+{0xe0927,{{0x0,0x0,0x0}}},
+{0xe0928,{{0x0,0x0,0x0}}},
+{0xe0929,{{0x0,0x0,0x0}}},
+{0xe092a,{{0x0,0x0,0x0}}},
+{0xe092b,{{0x0,0x0,0x0}}},
+{0xe092c,{{0x0,0x0,0x0}}},
+{0xe092d,{{0x0,0x0,0x0}}},
+{0xe092e,{{0x0,0x0,0x0}}},
+{0xe092f,{{0x0,0x0,0x0}}},
+{0xe0930,{{0x0,0x0,0x0}}},
+{0xe0931,{{0x0,0x0,0x0}}},
+{0xe0932,{{0x0,0x0,0x0}}},
+{0xe0933,{{0x0,0x0,0x0}}},
+{0xe0934,{{0x0,0x0,0x0}}},
+{0xe0935,{{0x0,0x0,0x0}}},
+{0xe0936,{{0x0,0x0,0x0}}},
+{0xe0937,{{0x0,0x0,0x0}}},
+{0xe0938,{{0x0,0x0,0x0}}},
+{0xe0939,{{0x0,0x0,0x0}}},
+{0xe093a,{{0x0,0x0,0x0}}},
+{0xe093b,{{0x0,0x0,0x0}}},
+{0xe093c,{{0x0,0x0,0x0}}},
+{0xe093d,{{0x0,0x0,0x0}}},
+{0xe093e,{{0x0,0x0,0x0}}},
+{0xe093f,{{0x0,0x0,0x0}}},
+{0xe0940,{{0x0,0x0,0x0}}},
+{0xe0941,{{0x0,0x0,0x0}}},
+{0xe0942,{{0x0,0x0,0x0}}},
+{0xe0943,{{0x0,0x0,0x0}}},
+{0xe0944,{{0x0,0x0,0x0}}},
+{0xe0945,{{0x0,0x0,0x0}}},
+{0xe0946,{{0x0,0x0,0x0}}},
+{0xe0947,{{0x0,0x0,0x0}}},
+{0xe0948,{{0x0,0x0,0x0}}},
+{0xe0949,{{0x0,0x0,0x0}}},
+{0xe094a,{{0x0,0x0,0x0}}},
+{0xe094b,{{0x0,0x0,0x0}}},
+{0xe094c,{{0x0,0x0,0x0}}},
+{0xe094d,{{0x0,0x0,0x0}}},
+{0xe094e,{{0x0,0x0,0x0}}},
+{0xe094f,{{0x0,0x0,0x0}}},
+{0xe0950,{{0x0,0x0,0x0}}},
+{0xe0951,{{0x0,0x0,0x0}}},
+{0xe0952,{{0x0,0x0,0x0}}},
+{0xe0953,{{0x0,0x0,0x0}}},
+{0xe0954,{{0x0,0x0,0x0}}},
+{0xe0955,{{0x0,0x0,0x0}}},
+{0xe0956,{{0x0,0x0,0x0}}},
+{0xe0957,{{0x0,0x0,0x0}}},
+{0xe0958,{{0x0,0x0,0x0}}},
+{0xe0959,{{0x0,0x0,0x0}}},
+{0xe095a,{{0x0,0x0,0x0}}},
+{0xe095b,{{0x0,0x0,0x0}}},
+{0xe095c,{{0x0,0x0,0x0}}},
+{0xe095d,{{0x0,0x0,0x0}}},
+{0xe095e,{{0x0,0x0,0x0}}},
+{0xe095f,{{0x0,0x0,0x0}}},
+{0xe0960,{{0x0,0x0,0x0}}},
+{0xe0961,{{0x0,0x0,0x0}}},
+{0xe0962,{{0x0,0x0,0x0}}},
+{0xe0963,{{0x0,0x0,0x0}}},
+{0xe0964,{{0x0,0x0,0x0}}},
+{0xe0965,{{0x0,0x0,0x0}}},
+{0xe0966,{{0x0,0x0,0x0}}},
+{0xe0967,{{0x0,0x0,0x0}}},
+{0xe0968,{{0x0,0x0,0x0}}},
+{0xe0969,{{0x0,0x0,0x0}}},
+{0xe096a,{{0x0,0x0,0x0}}},
+{0xe096b,{{0x0,0x0,0x0}}},
+{0xe096c,{{0x0,0x0,0x0}}},
+{0xe096d,{{0x0,0x0,0x0}}},
+{0xe096e,{{0x0,0x0,0x0}}},
+{0xe096f,{{0x0,0x0,0x0}}},
+{0xe0970,{{0x0,0x0,0x0}}},
+{0xe0971,{{0x0,0x0,0x0}}},
+{0xe0972,{{0x0,0x0,0x0}}},
+{0xe0973,{{0x0,0x0,0x0}}},
+{0xe0974,{{0x0,0x0,0x0}}},
+{0xe0975,{{0x0,0x0,0x0}}},
+{0xe0976,{{0x0,0x0,0x0}}},
+{0xe0977,{{0x0,0x0,0x0}}},
+{0xe0978,{{0x0,0x0,0x0}}},
+{0xe0979,{{0x0,0x0,0x0}}},
+{0xe097a,{{0x0,0x0,0x0}}},
+{0xe097b,{{0x0,0x0,0x0}}},
+{0xe097c,{{0x0,0x0,0x0}}},
+{0xe097d,{{0x0,0x0,0x0}}},
+{0xe097e,{{0x0,0x0,0x0}}},
+{0xe097f,{{0x0,0x0,0x0}}},
+{0xe0980,{{0x0,0x0,0x0}}},
+{0xe0981,{{0x0,0x0,0x0}}},
+{0xe0982,{{0x0,0x0,0x0}}},
+{0xe0983,{{0x0,0x0,0x0}}},
+{0xe0984,{{0x0,0x0,0x0}}},
+{0xe0985,{{0x0,0x0,0x0}}},
+{0xe0986,{{0x0,0x0,0x0}}},
+{0xe0987,{{0x0,0x0,0x0}}},
+{0xe0988,{{0x0,0x0,0x0}}},
+{0xe0989,{{0x0,0x0,0x0}}},
+{0xe098a,{{0x0,0x0,0x0}}},
+{0xe098b,{{0x0,0x0,0x0}}},
+{0xe098c,{{0x0,0x0,0x0}}},
+{0xe098d,{{0x0,0x0,0x0}}},
+{0xe098e,{{0x0,0x0,0x0}}},
+{0xe098f,{{0x0,0x0,0x0}}},
+{0xe0990,{{0x0,0x0,0x0}}},
+{0xe0991,{{0x0,0x0,0x0}}},
+{0xe0992,{{0x0,0x0,0x0}}},
+{0xe0993,{{0x0,0x0,0x0}}},
+{0xe0994,{{0x0,0x0,0x0}}},
+{0xe0995,{{0x0,0x0,0x0}}},
+{0xe0996,{{0x0,0x0,0x0}}},
+{0xe0997,{{0x0,0x0,0x0}}},
+{0xe0998,{{0x0,0x0,0x0}}},
+{0xe0999,{{0x0,0x0,0x0}}},
+{0xe099a,{{0x0,0x0,0x0}}},
+{0xe099b,{{0x0,0x0,0x0}}},
+{0xe099c,{{0x0,0x0,0x0}}},
+{0xe099d,{{0x0,0x0,0x0}}},
+{0xe099e,{{0x0,0x0,0x0}}},
+{0xe099f,{{0x0,0x0,0x0}}},
+{0xe09a0,{{0x0,0x0,0x0}}},
+{0xe09a1,{{0x0,0x0,0x0}}},
+{0xe09a2,{{0x0,0x0,0x0}}},
+{0xe09a3,{{0x0,0x0,0x0}}},
+{0xe09a4,{{0x0,0x0,0x0}}},
+{0xe09a5,{{0x0,0x0,0x0}}},
+{0xe09a6,{{0x0,0x0,0x0}}},
+{0xe09a7,{{0x0,0x0,0x0}}},
+{0xe09a8,{{0x0,0x0,0x0}}},
+{0xe09a9,{{0x0,0x0,0x0}}},
+{0xe09aa,{{0x0,0x0,0x0}}},
+{0xe09ab,{{0x0,0x0,0x0}}},
+{0xe09ac,{{0x0,0x0,0x0}}},
+{0xe09ad,{{0x0,0x0,0x0}}},
+{0xe09ae,{{0x0,0x0,0x0}}},
+{0xe09af,{{0x0,0x0,0x0}}},
+{0xe09b0,{{0x0,0x0,0x0}}},
+{0xe09b1,{{0x0,0x0,0x0}}},
+{0xe09b2,{{0x0,0x0,0x0}}},
+{0xe09b3,{{0x0,0x0,0x0}}},
+{0xe09b4,{{0x0,0x0,0x0}}},
+{0xe09b5,{{0x0,0x0,0x0}}},
+{0xe09b6,{{0x0,0x0,0x0}}},
+{0xe09b7,{{0x0,0x0,0x0}}},
+{0xe09b8,{{0x0,0x0,0x0}}},
+{0xe09b9,{{0x0,0x0,0x0}}},
+{0xe09ba,{{0x0,0x0,0x0}}},
+{0xe09bb,{{0x0,0x0,0x0}}},
+{0xe09bc,{{0x0,0x0,0x0}}},
+{0xe09bd,{{0x0,0x0,0x0}}},
+{0xe09be,{{0x0,0x0,0x0}}},
+{0xe09bf,{{0x0,0x0,0x0}}},
+{0xe09c0,{{0x0,0x0,0x0}}},
+{0xe09c1,{{0x0,0x0,0x0}}},
+{0xe09c2,{{0x0,0x0,0x0}}},
+{0xe09c3,{{0x0,0x0,0x0}}},
+{0xe09c4,{{0x0,0x0,0x0}}},
+{0xe09c5,{{0x0,0x0,0x0}}},
+{0xe09c6,{{0x0,0x0,0x0}}},
+{0xe09c7,{{0x0,0x0,0x0}}},
+{0xe09c8,{{0x0,0x0,0x0}}},
+{0xe09c9,{{0x0,0x0,0x0}}},
+{0xe09ca,{{0x0,0x0,0x0}}},
+{0xe09cb,{{0x0,0x0,0x0}}},
+{0xe09cc,{{0x0,0x0,0x0}}},
+{0xe09cd,{{0x0,0x0,0x0}}},
+{0xe09ce,{{0x0,0x0,0x0}}},
+{0xe09cf,{{0x0,0x0,0x0}}},
+{0xe09d0,{{0x0,0x0,0x0}}},
+{0xe09d1,{{0x0,0x0,0x0}}},
+{0xe09d2,{{0x0,0x0,0x0}}},
+{0xe09d3,{{0x0,0x0,0x0}}},
+{0xe09d4,{{0x0,0x0,0x0}}},
+{0xe09d5,{{0x0,0x0,0x0}}},
+{0xe09d6,{{0x0,0x0,0x0}}},
+{0xe09d7,{{0x0,0x0,0x0}}},
+{0xe09d8,{{0x0,0x0,0x0}}},
+{0xe09d9,{{0x0,0x0,0x0}}},
+{0xe09da,{{0x0,0x0,0x0}}},
+{0xe09db,{{0x0,0x0,0x0}}},
+{0xe09dc,{{0x0,0x0,0x0}}},
+{0xe09dd,{{0x0,0x0,0x0}}},
+{0xe09de,{{0x0,0x0,0x0}}},
+{0xe09df,{{0x0,0x0,0x0}}},
+{0xe09e0,{{0x0,0x0,0x0}}},
+{0xe09e1,{{0x0,0x0,0x0}}},
+{0xe09e2,{{0x0,0x0,0x0}}},
+{0xe09e3,{{0x0,0x0,0x0}}},
+{0xe09e4,{{0x0,0x0,0x0}}},
+{0xe09e5,{{0x0,0x0,0x0}}},
+{0xe09e6,{{0x0,0x0,0x0}}},
+{0xe09e7,{{0x0,0x0,0x0}}},
+{0xe09e8,{{0x0,0x0,0x0}}},
+{0xe09e9,{{0x0,0x0,0x0}}},
+{0xe09ea,{{0x0,0x0,0x0}}},
+{0xe09eb,{{0x0,0x0,0x0}}},
+{0xe09ec,{{0x0,0x0,0x0}}},
+{0xe09ed,{{0x0,0x0,0x0}}},
+{0xe09ee,{{0x0,0x0,0x0}}},
+{0xe09ef,{{0x0,0x0,0x0}}},
+{0xe09f0,{{0x0,0x0,0x0}}},
+{0xe09f1,{{0x0,0x0,0x0}}},
+{0xe09f2,{{0x0,0x0,0x0}}},
+{0xe09f3,{{0x0,0x0,0x0}}},
+{0xe09f4,{{0x0,0x0,0x0}}},
+{0xe09f5,{{0x0,0x0,0x0}}},
+{0xe09f6,{{0x0,0x0,0x0}}},
+{0xe09f7,{{0x0,0x0,0x0}}},
+{0xe09f8,{{0x0,0x0,0x0}}},
+{0xe09f9,{{0x0,0x0,0x0}}},
+{0xe09fa,{{0x0,0x0,0x0}}},
+{0xe09fb,{{0x0,0x0,0x0}}},
+{0xe09fc,{{0x0,0x0,0x0}}},
+{0xe09fd,{{0x0,0x0,0x0}}},
+{0xe09fe,{{0x0,0x0,0x0}}},
+{0xe09ff,{{0x0,0x0,0x0}}},
+{0xe0a00,{{0x0,0x0,0x0}}},
+{0xe0a01,{{0x0,0x0,0x0}}},
+{0xe0a02,{{0x0,0x0,0x0}}},
+{0xe0a03,{{0x0,0x0,0x0}}},
+{0xe0a04,{{0x0,0x0,0x0}}},
+{0xe0a05,{{0x0,0x0,0x0}}},
+{0xe0a06,{{0x0,0x0,0x0}}},
+{0xe0a07,{{0x0,0x0,0x0}}},
+{0xe0a08,{{0x0,0x0,0x0}}},
+{0xe0a09,{{0x0,0x0,0x0}}},
+{0xe0a0a,{{0x0,0x0,0x0}}},
+{0xe0a0b,{{0x0,0x0,0x0}}},
+{0xe0a0c,{{0x0,0x0,0x0}}},
+{0xe0a0d,{{0x0,0x0,0x0}}},
+{0xe0a0e,{{0x0,0x0,0x0}}},
+{0xe0a0f,{{0x0,0x0,0x0}}},
+{0xe0a10,{{0x0,0x0,0x0}}},
+{0xe0a11,{{0x0,0x0,0x0}}},
+{0xe0a12,{{0x0,0x0,0x0}}},
+{0xe0a13,{{0x0,0x0,0x0}}},
+{0xe0a14,{{0x0,0x0,0x0}}},
+{0xe0a15,{{0x0,0x0,0x0}}},
+{0xe0a16,{{0x0,0x0,0x0}}},
+{0xe0a17,{{0x0,0x0,0x0}}},
+{0xe0a18,{{0x0,0x0,0x0}}},
+{0xe0a19,{{0x0,0x0,0x0}}},
+{0xe0a1a,{{0x0,0x0,0x0}}},
+{0xe0a1b,{{0x0,0x0,0x0}}},
+{0xe0a1c,{{0x0,0x0,0x0}}},
+{0xe0a1d,{{0x0,0x0,0x0}}},
+{0xe0a1e,{{0x0,0x0,0x0}}},
+{0xe0a1f,{{0x0,0x0,0x0}}},
+{0xe0a20,{{0x0,0x0,0x0}}},
+{0xe0a21,{{0x0,0x0,0x0}}},
+{0xe0a22,{{0x0,0x0,0x0}}},
+{0xe0a23,{{0x0,0x0,0x0}}},
+{0xe0a24,{{0x0,0x0,0x0}}},
+{0xe0a25,{{0x0,0x0,0x0}}},
+{0xe0a26,{{0x0,0x0,0x0}}},
+{0xe0a27,{{0x0,0x0,0x0}}},
+{0xe0a28,{{0x0,0x0,0x0}}},
+{0xe0a29,{{0x0,0x0,0x0}}},
+{0xe0a2a,{{0x0,0x0,0x0}}},
+{0xe0a2b,{{0x0,0x0,0x0}}},
+{0xe0a2c,{{0x0,0x0,0x0}}},
+{0xe0a2d,{{0x0,0x0,0x0}}},
+{0xe0a2e,{{0x0,0x0,0x0}}},
+{0xe0a2f,{{0x0,0x0,0x0}}},
+{0xe0a30,{{0x0,0x0,0x0}}},
+{0xe0a31,{{0x0,0x0,0x0}}},
+{0xe0a32,{{0x0,0x0,0x0}}},
+{0xe0a33,{{0x0,0x0,0x0}}},
+{0xe0a34,{{0x0,0x0,0x0}}},
+{0xe0a35,{{0x0,0x0,0x0}}},
+{0xe0a36,{{0x0,0x0,0x0}}},
+{0xe0a37,{{0x0,0x0,0x0}}},
+{0xe0a38,{{0x0,0x0,0x0}}},
+{0xe0a39,{{0x0,0x0,0x0}}},
+{0xe0a3a,{{0x0,0x0,0x0}}},
+{0xe0a3b,{{0x0,0x0,0x0}}},
+{0xe0a3c,{{0x0,0x0,0x0}}},
+{0xe0a3d,{{0x0,0x0,0x0}}},
+{0xe0a3e,{{0x0,0x0,0x0}}},
+{0xe0a3f,{{0x0,0x0,0x0}}},
+{0xe0a40,{{0x0,0x0,0x0}}},
+{0xe0a41,{{0x0,0x0,0x0}}},
+{0xe0a42,{{0x0,0x0,0x0}}},
+{0xe0a43,{{0x0,0x0,0x0}}},
+{0xe0a44,{{0x0,0x0,0x0}}},
+{0xe0a45,{{0x0,0x0,0x0}}},
+{0xe0a46,{{0x0,0x0,0x0}}},
+{0xe0a47,{{0x0,0x0,0x0}}},
+{0xe0a48,{{0x0,0x0,0x0}}},
+{0xe0a49,{{0x0,0x0,0x0}}},
+{0xe0a4a,{{0x0,0x0,0x0}}},
+{0xe0a4b,{{0x0,0x0,0x0}}},
+{0xe0a4c,{{0x0,0x0,0x0}}},
+{0xe0a4d,{{0x0,0x0,0x0}}},
+{0xe0a4e,{{0x0,0x0,0x0}}},
+{0xe0a4f,{{0x0,0x0,0x0}}},
+{0xe0a50,{{0x0,0x0,0x0}}},
+{0xe0a51,{{0x0,0x0,0x0}}},
+{0xe0a52,{{0x0,0x0,0x0}}},
+{0xe0a53,{{0x0,0x0,0x0}}},
+{0xe0a54,{{0x0,0x0,0x0}}},
+{0xe0a55,{{0x0,0x0,0x0}}},
+{0xe0a56,{{0x0,0x0,0x0}}},
+{0xe0a57,{{0x0,0x0,0x0}}},
+{0xe0a58,{{0x0,0x0,0x0}}},
+{0xe0a59,{{0x0,0x0,0x0}}},
+{0xe0a5a,{{0x0,0x0,0x0}}},
+{0xe0a5b,{{0x0,0x0,0x0}}},
+{0xe0a5c,{{0x0,0x0,0x0}}},
+{0xe0a5d,{{0x0,0x0,0x0}}},
+{0xe0a5e,{{0x0,0x0,0x0}}},
+{0xe0a5f,{{0x0,0x0,0x0}}},
+{0xe0a60,{{0x0,0x0,0x0}}},
+{0xe0a61,{{0x0,0x0,0x0}}},
+{0xe0a62,{{0x0,0x0,0x0}}},
+{0xe0a63,{{0x0,0x0,0x0}}},
+{0xe0a64,{{0x0,0x0,0x0}}},
+{0xe0a65,{{0x0,0x0,0x0}}},
+{0xe0a66,{{0x0,0x0,0x0}}},
+{0xe0a67,{{0x0,0x0,0x0}}},
+{0xe0a68,{{0x0,0x0,0x0}}},
+{0xe0a69,{{0x0,0x0,0x0}}},
+{0xe0a6a,{{0x0,0x0,0x0}}},
+{0xe0a6b,{{0x0,0x0,0x0}}},
+{0xe0a6c,{{0x0,0x0,0x0}}},
+{0xe0a6d,{{0x0,0x0,0x0}}},
+{0xe0a6e,{{0x0,0x0,0x0}}},
+{0xe0a6f,{{0x0,0x0,0x0}}},
+{0xe0a70,{{0x0,0x0,0x0}}},
+{0xe0a71,{{0x0,0x0,0x0}}},
+{0xe0a72,{{0x0,0x0,0x0}}},
+{0xe0a73,{{0x0,0x0,0x0}}},
+{0xe0a74,{{0x0,0x0,0x0}}},
+{0xe0a75,{{0x0,0x0,0x0}}},
+{0xe0a76,{{0x0,0x0,0x0}}},
+{0xe0a77,{{0x0,0x0,0x0}}},
+{0xe0a78,{{0x0,0x0,0x0}}},
+{0xe0a79,{{0x0,0x0,0x0}}},
+{0xe0a7a,{{0x0,0x0,0x0}}},
+{0xe0a7b,{{0x0,0x0,0x0}}},
+{0xe0a7c,{{0x0,0x0,0x0}}},
+{0xe0a7d,{{0x0,0x0,0x0}}},
+{0xe0a7e,{{0x0,0x0,0x0}}},
+{0xe0a7f,{{0x0,0x0,0x0}}},
+{0xe0a80,{{0x0,0x0,0x0}}},
+{0xe0a81,{{0x0,0x0,0x0}}},
+{0xe0a82,{{0x0,0x0,0x0}}},
+{0xe0a83,{{0x0,0x0,0x0}}},
+{0xe0a84,{{0x0,0x0,0x0}}},
+{0xe0a85,{{0x0,0x0,0x0}}},
+{0xe0a86,{{0x0,0x0,0x0}}},
+{0xe0a87,{{0x0,0x0,0x0}}},
+{0xe0a88,{{0x0,0x0,0x0}}},
+{0xe0a89,{{0x0,0x0,0x0}}},
+{0xe0a8a,{{0x0,0x0,0x0}}},
+{0xe0a8b,{{0x0,0x0,0x0}}},
+{0xe0a8c,{{0x0,0x0,0x0}}},
+{0xe0a8d,{{0x0,0x0,0x0}}},
+{0xe0a8e,{{0x0,0x0,0x0}}},
+{0xe0a8f,{{0x0,0x0,0x0}}},
+{0xe0a90,{{0x0,0x0,0x0}}},
+{0xe0a91,{{0x0,0x0,0x0}}},
+{0xe0a92,{{0x0,0x0,0x0}}},
+{0xe0a93,{{0x0,0x0,0x0}}},
+{0xe0a94,{{0x0,0x0,0x0}}},
+{0xe0a95,{{0x0,0x0,0x0}}},
+{0xe0a96,{{0x0,0x0,0x0}}},
+{0xe0a97,{{0x0,0x0,0x0}}},
+{0xe0a98,{{0x0,0x0,0x0}}},
+{0xe0a99,{{0x0,0x0,0x0}}},
+{0xe0a9a,{{0x0,0x0,0x0}}},
+{0xe0a9b,{{0x0,0x0,0x0}}},
+{0xe0a9c,{{0x0,0x0,0x0}}},
+{0xe0a9d,{{0x0,0x0,0x0}}},
+{0xe0a9e,{{0x0,0x0,0x0}}},
+{0xe0a9f,{{0x0,0x0,0x0}}},
+{0xe0aa0,{{0x0,0x0,0x0}}},
+{0xe0aa1,{{0x0,0x0,0x0}}},
+{0xe0aa2,{{0x0,0x0,0x0}}},
+{0xe0aa3,{{0x0,0x0,0x0}}},
+{0xe0aa4,{{0x0,0x0,0x0}}},
+{0xe0aa5,{{0x0,0x0,0x0}}},
+{0xe0aa6,{{0x0,0x0,0x0}}},
+{0xe0aa7,{{0x0,0x0,0x0}}},
+{0xe0aa8,{{0x0,0x0,0x0}}},
+{0xe0aa9,{{0x0,0x0,0x0}}},
+{0xe0aaa,{{0x0,0x0,0x0}}},
+{0xe0aab,{{0x0,0x0,0x0}}},
+{0xe0aac,{{0x0,0x0,0x0}}},
+{0xe0aad,{{0x0,0x0,0x0}}},
+{0xe0aae,{{0x0,0x0,0x0}}},
+{0xe0aaf,{{0x0,0x0,0x0}}},
+{0xe0ab0,{{0x0,0x0,0x0}}},
+{0xe0ab1,{{0x0,0x0,0x0}}},
+{0xe0ab2,{{0x0,0x0,0x0}}},
+{0xe0ab3,{{0x0,0x0,0x0}}},
+{0xe0ab4,{{0x0,0x0,0x0}}},
+{0xe0ab5,{{0x0,0x0,0x0}}},
+{0xe0ab6,{{0x0,0x0,0x0}}},
+{0xe0ab7,{{0x0,0x0,0x0}}},
+{0xe0ab8,{{0x0,0x0,0x0}}},
+{0xe0ab9,{{0x0,0x0,0x0}}},
+{0xe0aba,{{0x0,0x0,0x0}}},
+{0xe0abb,{{0x0,0x0,0x0}}},
+{0xe0abc,{{0x0,0x0,0x0}}},
+{0xe0abd,{{0x0,0x0,0x0}}},
+{0xe0abe,{{0x0,0x0,0x0}}},
+{0xe0abf,{{0x0,0x0,0x0}}},
+{0xe0ac0,{{0x0,0x0,0x0}}},
+{0xe0ac1,{{0x0,0x0,0x0}}},
+{0xe0ac2,{{0x0,0x0,0x0}}},
+{0xe0ac3,{{0x0,0x0,0x0}}},
+{0xe0ac4,{{0x0,0x0,0x0}}},
+{0xe0ac5,{{0x0,0x0,0x0}}},
+{0xe0ac6,{{0x0,0x0,0x0}}},
+{0xe0ac7,{{0x0,0x0,0x0}}},
+{0xe0ac8,{{0x0,0x0,0x0}}},
+{0xe0ac9,{{0x0,0x0,0x0}}},
+{0xe0aca,{{0x0,0x0,0x0}}},
+{0xe0acb,{{0x0,0x0,0x0}}},
+{0xe0acc,{{0x0,0x0,0x0}}},
+{0xe0acd,{{0x0,0x0,0x0}}},
+{0xe0ace,{{0x0,0x0,0x0}}},
+{0xe0acf,{{0x0,0x0,0x0}}},
+{0xe0ad0,{{0x0,0x0,0x0}}},
+{0xe0ad1,{{0x0,0x0,0x0}}},
+{0xe0ad2,{{0x0,0x0,0x0}}},
+{0xe0ad3,{{0x0,0x0,0x0}}},
+{0xe0ad4,{{0x0,0x0,0x0}}},
+{0xe0ad5,{{0x0,0x0,0x0}}},
+{0xe0ad6,{{0x0,0x0,0x0}}},
+{0xe0ad7,{{0x0,0x0,0x0}}},
+{0xe0ad8,{{0x0,0x0,0x0}}},
+{0xe0ad9,{{0x0,0x0,0x0}}},
+{0xe0ada,{{0x0,0x0,0x0}}},
+{0xe0adb,{{0x0,0x0,0x0}}},
+{0xe0adc,{{0x0,0x0,0x0}}},
+{0xe0add,{{0x0,0x0,0x0}}},
+{0xe0ade,{{0x0,0x0,0x0}}},
+{0xe0adf,{{0x0,0x0,0x0}}},
+{0xe0ae0,{{0x0,0x0,0x0}}},
+{0xe0ae1,{{0x0,0x0,0x0}}},
+{0xe0ae2,{{0x0,0x0,0x0}}},
+{0xe0ae3,{{0x0,0x0,0x0}}},
+{0xe0ae4,{{0x0,0x0,0x0}}},
+{0xe0ae5,{{0x0,0x0,0x0}}},
+{0xe0ae6,{{0x0,0x0,0x0}}},
+{0xe0ae7,{{0x0,0x0,0x0}}},
+{0xe0ae8,{{0x0,0x0,0x0}}},
+{0xe0ae9,{{0x0,0x0,0x0}}},
+{0xe0aea,{{0x0,0x0,0x0}}},
+{0xe0aeb,{{0x0,0x0,0x0}}},
+{0xe0aec,{{0x0,0x0,0x0}}},
+{0xe0aed,{{0x0,0x0,0x0}}},
+{0xe0aee,{{0x0,0x0,0x0}}},
+{0xe0aef,{{0x0,0x0,0x0}}},
+{0xe0af0,{{0x0,0x0,0x0}}},
+{0xe0af1,{{0x0,0x0,0x0}}},
+{0xe0af2,{{0x0,0x0,0x0}}},
+{0xe0af3,{{0x0,0x0,0x0}}},
+{0xe0af4,{{0x0,0x0,0x0}}},
+{0xe0af5,{{0x0,0x0,0x0}}},
+{0xe0af6,{{0x0,0x0,0x0}}},
+{0xe0af7,{{0x0,0x0,0x0}}},
+{0xe0af8,{{0x0,0x0,0x0}}},
+{0xe0af9,{{0x0,0x0,0x0}}},
+{0xe0afa,{{0x0,0x0,0x0}}},
+{0xe0afb,{{0x0,0x0,0x0}}},
+{0xe0afc,{{0x0,0x0,0x0}}},
+{0xe0afd,{{0x0,0x0,0x0}}},
+{0xe0afe,{{0x0,0x0,0x0}}},
+{0xe0aff,{{0x0,0x0,0x0}}},
+{0xe0b00,{{0x0,0x0,0x0}}},
+{0xe0b01,{{0x0,0x0,0x0}}},
+{0xe0b02,{{0x0,0x0,0x0}}},
+{0xe0b03,{{0x0,0x0,0x0}}},
+{0xe0b04,{{0x0,0x0,0x0}}},
+{0xe0b05,{{0x0,0x0,0x0}}},
+{0xe0b06,{{0x0,0x0,0x0}}},
+{0xe0b07,{{0x0,0x0,0x0}}},
+{0xe0b08,{{0x0,0x0,0x0}}},
+{0xe0b09,{{0x0,0x0,0x0}}},
+{0xe0b0a,{{0x0,0x0,0x0}}},
+{0xe0b0b,{{0x0,0x0,0x0}}},
+{0xe0b0c,{{0x0,0x0,0x0}}},
+{0xe0b0d,{{0x0,0x0,0x0}}},
+{0xe0b0e,{{0x0,0x0,0x0}}},
+{0xe0b0f,{{0x0,0x0,0x0}}},
+{0xe0b10,{{0x0,0x0,0x0}}},
+{0xe0b11,{{0x0,0x0,0x0}}},
+{0xe0b12,{{0x0,0x0,0x0}}},
+{0xe0b13,{{0x0,0x0,0x0}}},
+{0xe0b14,{{0x0,0x0,0x0}}},
+{0xe0b15,{{0x0,0x0,0x0}}},
+{0xe0b16,{{0x0,0x0,0x0}}},
+{0xe0b17,{{0x0,0x0,0x0}}},
+{0xe0b18,{{0x0,0x0,0x0}}},
+{0xe0b19,{{0x0,0x0,0x0}}},
+{0xe0b1a,{{0x0,0x0,0x0}}},
+{0xe0b1b,{{0x0,0x0,0x0}}},
+{0xe0b1c,{{0x0,0x0,0x0}}},
+{0xe0b1d,{{0x0,0x0,0x0}}},
+{0xe0b1e,{{0x0,0x0,0x0}}},
+{0xe0b1f,{{0x0,0x0,0x0}}},
+{0xe0b20,{{0x0,0x0,0x0}}},
+{0xe0b21,{{0x0,0x0,0x0}}},
+{0xe0b22,{{0x0,0x0,0x0}}},
+{0xe0b23,{{0x0,0x0,0x0}}},
+{0xe0b24,{{0x0,0x0,0x0}}},
+{0xe0b25,{{0x0,0x0,0x0}}},
+{0xe0b26,{{0x0,0x0,0x0}}},
+{0xe0b27,{{0x0,0x0,0x0}}},
+{0xe0b28,{{0x0,0x0,0x0}}},
+{0xe0b29,{{0x0,0x0,0x0}}},
+{0xe0b2a,{{0x0,0x0,0x0}}},
+{0xe0b2b,{{0x0,0x0,0x0}}},
+{0xe0b2c,{{0x0,0x0,0x0}}},
+{0xe0b2d,{{0x0,0x0,0x0}}},
+{0xe0b2e,{{0x0,0x0,0x0}}},
+{0xe0b2f,{{0x0,0x0,0x0}}},
+{0xe0b30,{{0x0,0x0,0x0}}},
+{0xe0b31,{{0x0,0x0,0x0}}},
+{0xe0b32,{{0x0,0x0,0x0}}},
+{0xe0b33,{{0x0,0x0,0x0}}},
+{0xe0b34,{{0x0,0x0,0x0}}},
+{0xe0b35,{{0x0,0x0,0x0}}},
+{0xe0b36,{{0x0,0x0,0x0}}},
+{0xe0b37,{{0x0,0x0,0x0}}},
+{0xe0b38,{{0x0,0x0,0x0}}},
+{0xe0b39,{{0x0,0x0,0x0}}},
+{0xe0b3a,{{0x0,0x0,0x0}}},
+{0xe0b3b,{{0x0,0x0,0x0}}},
+{0xe0b3c,{{0x0,0x0,0x0}}},
+{0xe0b3d,{{0x0,0x0,0x0}}},
+{0xe0b3e,{{0x0,0x0,0x0}}},
+{0xe0b3f,{{0x0,0x0,0x0}}},
+{0xe0b40,{{0x0,0x0,0x0}}},
+{0xe0b41,{{0x0,0x0,0x0}}},
+{0xe0b42,{{0x0,0x0,0x0}}},
+{0xe0b43,{{0x0,0x0,0x0}}},
+{0xe0b44,{{0x0,0x0,0x0}}},
+{0xe0b45,{{0x0,0x0,0x0}}},
+{0xe0b46,{{0x0,0x0,0x0}}},
+{0xe0b47,{{0x0,0x0,0x0}}},
+{0xe0b48,{{0x0,0x0,0x0}}},
+{0xe0b49,{{0x0,0x0,0x0}}},
+{0xe0b4a,{{0x0,0x0,0x0}}},
+{0xe0b4b,{{0x0,0x0,0x0}}},
+{0xe0b4c,{{0x0,0x0,0x0}}},
+{0xe0b4d,{{0x0,0x0,0x0}}},
+{0xe0b4e,{{0x0,0x0,0x0}}},
+{0xe0b4f,{{0x0,0x0,0x0}}},
+{0xe0b50,{{0x0,0x0,0x0}}},
+{0xe0b51,{{0x0,0x0,0x0}}},
+{0xe0b52,{{0x0,0x0,0x0}}},
+{0xe0b53,{{0x0,0x0,0x0}}},
+{0xe0b54,{{0x0,0x0,0x0}}},
+{0xe0b55,{{0x0,0x0,0x0}}},
+{0xe0b56,{{0x0,0x0,0x0}}},
+{0xe0b57,{{0x0,0x0,0x0}}},
+{0xe0b58,{{0x0,0x0,0x0}}},
+{0xe0b59,{{0x0,0x0,0x0}}},
+{0xe0b5a,{{0x0,0x0,0x0}}},
+{0xe0b5b,{{0x0,0x0,0x0}}},
+{0xe0b5c,{{0x0,0x0,0x0}}},
+{0xe0b5d,{{0x0,0x0,0x0}}},
+{0xe0b5e,{{0x0,0x0,0x0}}},
+{0xe0b5f,{{0x0,0x0,0x0}}},
+{0xe0b60,{{0x0,0x0,0x0}}},
+{0xe0b61,{{0x0,0x0,0x0}}},
+{0xe0b62,{{0x0,0x0,0x0}}},
+{0xe0b63,{{0x0,0x0,0x0}}},
+{0xe0b64,{{0x0,0x0,0x0}}},
+{0xe0b65,{{0x0,0x0,0x0}}},
+{0xe0b66,{{0x0,0x0,0x0}}},
+{0xe0b67,{{0x0,0x0,0x0}}},
+{0xe0b68,{{0x0,0x0,0x0}}},
+{0xe0b69,{{0x0,0x0,0x0}}},
+{0xe0b6a,{{0x0,0x0,0x0}}},
+{0xe0b6b,{{0x0,0x0,0x0}}},
+{0xe0b6c,{{0x0,0x0,0x0}}},
+{0xe0b6d,{{0x0,0x0,0x0}}},
+{0xe0b6e,{{0x0,0x0,0x0}}},
+{0xe0b6f,{{0x0,0x0,0x0}}},
+{0xe0b70,{{0x0,0x0,0x0}}},
+{0xe0b71,{{0x0,0x0,0x0}}},
+{0xe0b72,{{0x0,0x0,0x0}}},
+{0xe0b73,{{0x0,0x0,0x0}}},
+{0xe0b74,{{0x0,0x0,0x0}}},
+{0xe0b75,{{0x0,0x0,0x0}}},
+{0xe0b76,{{0x0,0x0,0x0}}},
+{0xe0b77,{{0x0,0x0,0x0}}},
+{0xe0b78,{{0x0,0x0,0x0}}},
+{0xe0b79,{{0x0,0x0,0x0}}},
+{0xe0b7a,{{0x0,0x0,0x0}}},
+{0xe0b7b,{{0x0,0x0,0x0}}},
+{0xe0b7c,{{0x0,0x0,0x0}}},
+{0xe0b7d,{{0x0,0x0,0x0}}},
+{0xe0b7e,{{0x0,0x0,0x0}}},
+{0xe0b7f,{{0x0,0x0,0x0}}},
+{0xe0b80,{{0x0,0x0,0x0}}},
+{0xe0b81,{{0x0,0x0,0x0}}},
+{0xe0b82,{{0x0,0x0,0x0}}},
+{0xe0b83,{{0x0,0x0,0x0}}},
+{0xe0b84,{{0x0,0x0,0x0}}},
+{0xe0b85,{{0x0,0x0,0x0}}},
+{0xe0b86,{{0x0,0x0,0x0}}},
+{0xe0b87,{{0x0,0x0,0x0}}},
+{0xe0b88,{{0x0,0x0,0x0}}},
+{0xe0b89,{{0x0,0x0,0x0}}},
+{0xe0b8a,{{0x0,0x0,0x0}}},
+{0xe0b8b,{{0x0,0x0,0x0}}},
+{0xe0b8c,{{0x0,0x0,0x0}}},
+{0xe0b8d,{{0x0,0x0,0x0}}},
+{0xe0b8e,{{0x0,0x0,0x0}}},
+{0xe0b8f,{{0x0,0x0,0x0}}},
+{0xe0b90,{{0x0,0x0,0x0}}},
+{0xe0b91,{{0x0,0x0,0x0}}},
+{0xe0b92,{{0x0,0x0,0x0}}},
+{0xe0b93,{{0x0,0x0,0x0}}},
+{0xe0b94,{{0x0,0x0,0x0}}},
+{0xe0b95,{{0x0,0x0,0x0}}},
+{0xe0b96,{{0x0,0x0,0x0}}},
+{0xe0b97,{{0x0,0x0,0x0}}},
+{0xe0b98,{{0x0,0x0,0x0}}},
+{0xe0b99,{{0x0,0x0,0x0}}},
+{0xe0b9a,{{0x0,0x0,0x0}}},
+{0xe0b9b,{{0x0,0x0,0x0}}},
+{0xe0b9c,{{0x0,0x0,0x0}}},
+{0xe0b9d,{{0x0,0x0,0x0}}},
+{0xe0b9e,{{0x0,0x0,0x0}}},
+{0xe0b9f,{{0x0,0x0,0x0}}},
+{0xe0ba0,{{0x0,0x0,0x0}}},
+{0xe0ba1,{{0x0,0x0,0x0}}},
+{0xe0ba2,{{0x0,0x0,0x0}}},
+{0xe0ba3,{{0x0,0x0,0x0}}},
+{0xe0ba4,{{0x0,0x0,0x0}}},
+{0xe0ba5,{{0x0,0x0,0x0}}},
+{0xe0ba6,{{0x0,0x0,0x0}}},
+{0xe0ba7,{{0x0,0x0,0x0}}},
+{0xe0ba8,{{0x0,0x0,0x0}}},
+{0xe0ba9,{{0x0,0x0,0x0}}},
+{0xe0baa,{{0x0,0x0,0x0}}},
+{0xe0bab,{{0x0,0x0,0x0}}},
+{0xe0bac,{{0x0,0x0,0x0}}},
+{0xe0bad,{{0x0,0x0,0x0}}},
+{0xe0bae,{{0x0,0x0,0x0}}},
+{0xe0baf,{{0x0,0x0,0x0}}},
+{0xe0bb0,{{0x0,0x0,0x0}}},
+{0xe0bb1,{{0x0,0x0,0x0}}},
+{0xe0bb2,{{0x0,0x0,0x0}}},
+{0xe0bb3,{{0x0,0x0,0x0}}},
+{0xe0bb4,{{0x0,0x0,0x0}}},
+{0xe0bb5,{{0x0,0x0,0x0}}},
+{0xe0bb6,{{0x0,0x0,0x0}}},
+{0xe0bb7,{{0x0,0x0,0x0}}},
+{0xe0bb8,{{0x0,0x0,0x0}}},
+{0xe0bb9,{{0x0,0x0,0x0}}},
+{0xe0bba,{{0x0,0x0,0x0}}},
+{0xe0bbb,{{0x0,0x0,0x0}}},
+{0xe0bbc,{{0x0,0x0,0x0}}},
+{0xe0bbd,{{0x0,0x0,0x0}}},
+{0xe0bbe,{{0x0,0x0,0x0}}},
+{0xe0bbf,{{0x0,0x0,0x0}}},
+{0xe0bc0,{{0x0,0x0,0x0}}},
+{0xe0bc1,{{0x0,0x0,0x0}}},
+{0xe0bc2,{{0x0,0x0,0x0}}},
+{0xe0bc3,{{0x0,0x0,0x0}}},
+{0xe0bc4,{{0x0,0x0,0x0}}},
+{0xe0bc5,{{0x0,0x0,0x0}}},
+{0xe0bc6,{{0x0,0x0,0x0}}},
+{0xe0bc7,{{0x0,0x0,0x0}}},
+{0xe0bc8,{{0x0,0x0,0x0}}},
+{0xe0bc9,{{0x0,0x0,0x0}}},
+{0xe0bca,{{0x0,0x0,0x0}}},
+{0xe0bcb,{{0x0,0x0,0x0}}},
+{0xe0bcc,{{0x0,0x0,0x0}}},
+{0xe0bcd,{{0x0,0x0,0x0}}},
+{0xe0bce,{{0x0,0x0,0x0}}},
+{0xe0bcf,{{0x0,0x0,0x0}}},
+{0xe0bd0,{{0x0,0x0,0x0}}},
+{0xe0bd1,{{0x0,0x0,0x0}}},
+{0xe0bd2,{{0x0,0x0,0x0}}},
+{0xe0bd3,{{0x0,0x0,0x0}}},
+{0xe0bd4,{{0x0,0x0,0x0}}},
+{0xe0bd5,{{0x0,0x0,0x0}}},
+{0xe0bd6,{{0x0,0x0,0x0}}},
+{0xe0bd7,{{0x0,0x0,0x0}}},
+{0xe0bd8,{{0x0,0x0,0x0}}},
+{0xe0bd9,{{0x0,0x0,0x0}}},
+{0xe0bda,{{0x0,0x0,0x0}}},
+{0xe0bdb,{{0x0,0x0,0x0}}},
+{0xe0bdc,{{0x0,0x0,0x0}}},
+{0xe0bdd,{{0x0,0x0,0x0}}},
+{0xe0bde,{{0x0,0x0,0x0}}},
+{0xe0bdf,{{0x0,0x0,0x0}}},
+{0xe0be0,{{0x0,0x0,0x0}}},
+{0xe0be1,{{0x0,0x0,0x0}}},
+{0xe0be2,{{0x0,0x0,0x0}}},
+{0xe0be3,{{0x0,0x0,0x0}}},
+{0xe0be4,{{0x0,0x0,0x0}}},
+{0xe0be5,{{0x0,0x0,0x0}}},
+{0xe0be6,{{0x0,0x0,0x0}}},
+{0xe0be7,{{0x0,0x0,0x0}}},
+{0xe0be8,{{0x0,0x0,0x0}}},
+{0xe0be9,{{0x0,0x0,0x0}}},
+{0xe0bea,{{0x0,0x0,0x0}}},
+{0xe0beb,{{0x0,0x0,0x0}}},
+{0xe0bec,{{0x0,0x0,0x0}}},
+{0xe0bed,{{0x0,0x0,0x0}}},
+{0xe0bee,{{0x0,0x0,0x0}}},
+{0xe0bef,{{0x0,0x0,0x0}}},
+{0xe0bf0,{{0x0,0x0,0x0}}},
+{0xe0bf1,{{0x0,0x0,0x0}}},
+{0xe0bf2,{{0x0,0x0,0x0}}},
+{0xe0bf3,{{0x0,0x0,0x0}}},
+{0xe0bf4,{{0x0,0x0,0x0}}},
+{0xe0bf5,{{0x0,0x0,0x0}}},
+{0xe0bf6,{{0x0,0x0,0x0}}},
+{0xe0bf7,{{0x0,0x0,0x0}}},
+{0xe0bf8,{{0x0,0x0,0x0}}},
+{0xe0bf9,{{0x0,0x0,0x0}}},
+{0xe0bfa,{{0x0,0x0,0x0}}},
+{0xe0bfb,{{0x0,0x0,0x0}}},
+{0xe0bfc,{{0x0,0x0,0x0}}},
+{0xe0bfd,{{0x0,0x0,0x0}}},
+{0xe0bfe,{{0x0,0x0,0x0}}},
+{0xe0bff,{{0x0,0x0,0x0}}},
+{0xe0c00,{{0x0,0x0,0x0}}},
+{0xe0c01,{{0x0,0x0,0x0}}},
+{0xe0c02,{{0x0,0x0,0x0}}},
+{0xe0c03,{{0x0,0x0,0x0}}},
+{0xe0c04,{{0x0,0x0,0x0}}},
+{0xe0c05,{{0x0,0x0,0x0}}},
+{0xe0c06,{{0x0,0x0,0x0}}},
+{0xe0c07,{{0x0,0x0,0x0}}},
+{0xe0c08,{{0x0,0x0,0x0}}},
+{0xe0c09,{{0x0,0x0,0x0}}},
+{0xe0c0a,{{0x0,0x0,0x0}}},
+{0xe0c0b,{{0x0,0x0,0x0}}},
+{0xe0c0c,{{0x0,0x0,0x0}}},
+{0xe0c0d,{{0x0,0x0,0x0}}},
+{0xe0c0e,{{0x0,0x0,0x0}}},
+{0xe0c0f,{{0x0,0x0,0x0}}},
+{0xe0c10,{{0x0,0x0,0x0}}},
+{0xe0c11,{{0x0,0x0,0x0}}},
+{0xe0c12,{{0x0,0x0,0x0}}},
+{0xe0c13,{{0x0,0x0,0x0}}},
+{0xe0c14,{{0x0,0x0,0x0}}},
+{0xe0c15,{{0x0,0x0,0x0}}},
+{0xe0c16,{{0x0,0x0,0x0}}},
+{0xe0c17,{{0x0,0x0,0x0}}},
+{0xe0c18,{{0x0,0x0,0x0}}},
+{0xe0c19,{{0x0,0x0,0x0}}},
+{0xe0c1a,{{0x0,0x0,0x0}}},
+{0xe0c1b,{{0x0,0x0,0x0}}},
+{0xe0c1c,{{0x0,0x0,0x0}}},
+{0xe0c1d,{{0x0,0x0,0x0}}},
+{0xe0c1e,{{0x0,0x0,0x0}}},
+{0xe0c1f,{{0x0,0x0,0x0}}},
+{0xe0c20,{{0x0,0x0,0x0}}},
+{0xe0c21,{{0x0,0x0,0x0}}},
+{0xe0c22,{{0x0,0x0,0x0}}},
+{0xe0c23,{{0x0,0x0,0x0}}},
+{0xe0c24,{{0x0,0x0,0x0}}},
+{0xe0c25,{{0x0,0x0,0x0}}},
+{0xe0c26,{{0x0,0x0,0x0}}},
+{0xe0c27,{{0x0,0x0,0x0}}},
+{0xe0c28,{{0x0,0x0,0x0}}},
+{0xe0c29,{{0x0,0x0,0x0}}},
+{0xe0c2a,{{0x0,0x0,0x0}}},
+{0xe0c2b,{{0x0,0x0,0x0}}},
+{0xe0c2c,{{0x0,0x0,0x0}}},
+{0xe0c2d,{{0x0,0x0,0x0}}},
+{0xe0c2e,{{0x0,0x0,0x0}}},
+{0xe0c2f,{{0x0,0x0,0x0}}},
+{0xe0c30,{{0x0,0x0,0x0}}},
+{0xe0c31,{{0x0,0x0,0x0}}},
+{0xe0c32,{{0x0,0x0,0x0}}},
+{0xe0c33,{{0x0,0x0,0x0}}},
+{0xe0c34,{{0x0,0x0,0x0}}},
+{0xe0c35,{{0x0,0x0,0x0}}},
+{0xe0c36,{{0x0,0x0,0x0}}},
+{0xe0c37,{{0x0,0x0,0x0}}},
+{0xe0c38,{{0x0,0x0,0x0}}},
+{0xe0c39,{{0x0,0x0,0x0}}},
+{0xe0c3a,{{0x0,0x0,0x0}}},
+{0xe0c3b,{{0x0,0x0,0x0}}},
+{0xe0c3c,{{0x0,0x0,0x0}}},
+{0xe0c3d,{{0x0,0x0,0x0}}},
+{0xe0c3e,{{0x0,0x0,0x0}}},
+{0xe0c3f,{{0x0,0x0,0x0}}},
+{0xe0c40,{{0x0,0x0,0x0}}},
+{0xe0c41,{{0x0,0x0,0x0}}},
+{0xe0c42,{{0x0,0x0,0x0}}},
+{0xe0c43,{{0x0,0x0,0x0}}},
+{0xe0c44,{{0x0,0x0,0x0}}},
+{0xe0c45,{{0x0,0x0,0x0}}},
+{0xe0c46,{{0x0,0x0,0x0}}},
+{0xe0c47,{{0x0,0x0,0x0}}},
+{0xe0c48,{{0x0,0x0,0x0}}},
+{0xe0c49,{{0x0,0x0,0x0}}},
+{0xe0c4a,{{0x0,0x0,0x0}}},
+{0xe0c4b,{{0x0,0x0,0x0}}},
+{0xe0c4c,{{0x0,0x0,0x0}}},
+{0xe0c4d,{{0x0,0x0,0x0}}},
+{0xe0c4e,{{0x0,0x0,0x0}}},
+{0xe0c4f,{{0x0,0x0,0x0}}},
+{0xe0c50,{{0x0,0x0,0x0}}},
+{0xe0c51,{{0x0,0x0,0x0}}},
+{0xe0c52,{{0x0,0x0,0x0}}},
+{0xe0c53,{{0x0,0x0,0x0}}},
+{0xe0c54,{{0x0,0x0,0x0}}},
+{0xe0c55,{{0x0,0x0,0x0}}},
+{0xe0c56,{{0x0,0x0,0x0}}},
+{0xe0c57,{{0x0,0x0,0x0}}},
+{0xe0c58,{{0x0,0x0,0x0}}},
+{0xe0c59,{{0x0,0x0,0x0}}},
+{0xe0c5a,{{0x0,0x0,0x0}}},
+{0xe0c5b,{{0x0,0x0,0x0}}},
+{0xe0c5c,{{0x0,0x0,0x0}}},
+{0xe0c5d,{{0x0,0x0,0x0}}},
+{0xe0c5e,{{0x0,0x0,0x0}}},
+{0xe0c5f,{{0x0,0x0,0x0}}},
+{0xe0c60,{{0x0,0x0,0x0}}},
+{0xe0c61,{{0x0,0x0,0x0}}},
+{0xe0c62,{{0x0,0x0,0x0}}},
+{0xe0c63,{{0x0,0x0,0x0}}},
+{0xe0c64,{{0x0,0x0,0x0}}},
+{0xe0c65,{{0x0,0x0,0x0}}},
+{0xe0c66,{{0x0,0x0,0x0}}},
+{0xe0c67,{{0x0,0x0,0x0}}},
+{0xe0c68,{{0x0,0x0,0x0}}},
+{0xe0c69,{{0x0,0x0,0x0}}},
+{0xe0c6a,{{0x0,0x0,0x0}}},
+{0xe0c6b,{{0x0,0x0,0x0}}},
+{0xe0c6c,{{0x0,0x0,0x0}}},
+{0xe0c6d,{{0x0,0x0,0x0}}},
+{0xe0c6e,{{0x0,0x0,0x0}}},
+{0xe0c6f,{{0x0,0x0,0x0}}},
+{0xe0c70,{{0x0,0x0,0x0}}},
+{0xe0c71,{{0x0,0x0,0x0}}},
+{0xe0c72,{{0x0,0x0,0x0}}},
+{0xe0c73,{{0x0,0x0,0x0}}},
+{0xe0c74,{{0x0,0x0,0x0}}},
+{0xe0c75,{{0x0,0x0,0x0}}},
+{0xe0c76,{{0x0,0x0,0x0}}},
+{0xe0c77,{{0x0,0x0,0x0}}},
+{0xe0c78,{{0x0,0x0,0x0}}},
+{0xe0c79,{{0x0,0x0,0x0}}},
+{0xe0c7a,{{0x0,0x0,0x0}}},
+{0xe0c7b,{{0x0,0x0,0x0}}},
+{0xe0c7c,{{0x0,0x0,0x0}}},
+{0xe0c7d,{{0x0,0x0,0x0}}},
+{0xe0c7e,{{0x0,0x0,0x0}}},
+{0xe0c7f,{{0x0,0x0,0x0}}},
+{0xe0c80,{{0x0,0x0,0x0}}},
+{0xe0c81,{{0x0,0x0,0x0}}},
+{0xe0c82,{{0x0,0x0,0x0}}},
+{0xe0c83,{{0x0,0x0,0x0}}},
+{0xe0c84,{{0x0,0x0,0x0}}},
+{0xe0c85,{{0x0,0x0,0x0}}},
+{0xe0c86,{{0x0,0x0,0x0}}},
+{0xe0c87,{{0x0,0x0,0x0}}},
+{0xe0c88,{{0x0,0x0,0x0}}},
+{0xe0c89,{{0x0,0x0,0x0}}},
+{0xe0c8a,{{0x0,0x0,0x0}}},
+{0xe0c8b,{{0x0,0x0,0x0}}},
+{0xe0c8c,{{0x0,0x0,0x0}}},
+{0xe0c8d,{{0x0,0x0,0x0}}},
+{0xe0c8e,{{0x0,0x0,0x0}}},
+{0xe0c8f,{{0x0,0x0,0x0}}},
+{0xe0c90,{{0x0,0x0,0x0}}},
+{0xe0c91,{{0x0,0x0,0x0}}},
+{0xe0c92,{{0x0,0x0,0x0}}},
+{0xe0c93,{{0x0,0x0,0x0}}},
+{0xe0c94,{{0x0,0x0,0x0}}},
+{0xe0c95,{{0x0,0x0,0x0}}},
+{0xe0c96,{{0x0,0x0,0x0}}},
+{0xe0c97,{{0x0,0x0,0x0}}},
+{0xe0c98,{{0x0,0x0,0x0}}},
+{0xe0c99,{{0x0,0x0,0x0}}},
+{0xe0c9a,{{0x0,0x0,0x0}}},
+{0xe0c9b,{{0x0,0x0,0x0}}},
+{0xe0c9c,{{0x0,0x0,0x0}}},
+{0xe0c9d,{{0x0,0x0,0x0}}},
+{0xe0c9e,{{0x0,0x0,0x0}}},
+{0xe0c9f,{{0x0,0x0,0x0}}},
+{0xe0ca0,{{0x0,0x0,0x0}}},
+{0xe0ca1,{{0x0,0x0,0x0}}},
+{0xe0ca2,{{0x0,0x0,0x0}}},
+{0xe0ca3,{{0x0,0x0,0x0}}},
+{0xe0ca4,{{0x0,0x0,0x0}}},
+{0xe0ca5,{{0x0,0x0,0x0}}},
+{0xe0ca6,{{0x0,0x0,0x0}}},
+{0xe0ca7,{{0x0,0x0,0x0}}},
+{0xe0ca8,{{0x0,0x0,0x0}}},
+{0xe0ca9,{{0x0,0x0,0x0}}},
+{0xe0caa,{{0x0,0x0,0x0}}},
+{0xe0cab,{{0x0,0x0,0x0}}},
+{0xe0cac,{{0x0,0x0,0x0}}},
+{0xe0cad,{{0x0,0x0,0x0}}},
+{0xe0cae,{{0x0,0x0,0x0}}},
+{0xe0caf,{{0x0,0x0,0x0}}},
+{0xe0cb0,{{0x0,0x0,0x0}}},
+{0xe0cb1,{{0x0,0x0,0x0}}},
+{0xe0cb2,{{0x0,0x0,0x0}}},
+{0xe0cb3,{{0x0,0x0,0x0}}},
+{0xe0cb4,{{0x0,0x0,0x0}}},
+{0xe0cb5,{{0x0,0x0,0x0}}},
+{0xe0cb6,{{0x0,0x0,0x0}}},
+{0xe0cb7,{{0x0,0x0,0x0}}},
+{0xe0cb8,{{0x0,0x0,0x0}}},
+{0xe0cb9,{{0x0,0x0,0x0}}},
+{0xe0cba,{{0x0,0x0,0x0}}},
+{0xe0cbb,{{0x0,0x0,0x0}}},
+{0xe0cbc,{{0x0,0x0,0x0}}},
+{0xe0cbd,{{0x0,0x0,0x0}}},
+{0xe0cbe,{{0x0,0x0,0x0}}},
+{0xe0cbf,{{0x0,0x0,0x0}}},
+{0xe0cc0,{{0x0,0x0,0x0}}},
+{0xe0cc1,{{0x0,0x0,0x0}}},
+{0xe0cc2,{{0x0,0x0,0x0}}},
+{0xe0cc3,{{0x0,0x0,0x0}}},
+{0xe0cc4,{{0x0,0x0,0x0}}},
+{0xe0cc5,{{0x0,0x0,0x0}}},
+{0xe0cc6,{{0x0,0x0,0x0}}},
+{0xe0cc7,{{0x0,0x0,0x0}}},
+{0xe0cc8,{{0x0,0x0,0x0}}},
+{0xe0cc9,{{0x0,0x0,0x0}}},
+{0xe0cca,{{0x0,0x0,0x0}}},
+{0xe0ccb,{{0x0,0x0,0x0}}},
+{0xe0ccc,{{0x0,0x0,0x0}}},
+{0xe0ccd,{{0x0,0x0,0x0}}},
+{0xe0cce,{{0x0,0x0,0x0}}},
+{0xe0ccf,{{0x0,0x0,0x0}}},
+{0xe0cd0,{{0x0,0x0,0x0}}},
+{0xe0cd1,{{0x0,0x0,0x0}}},
+{0xe0cd2,{{0x0,0x0,0x0}}},
+{0xe0cd3,{{0x0,0x0,0x0}}},
+{0xe0cd4,{{0x0,0x0,0x0}}},
+{0xe0cd5,{{0x0,0x0,0x0}}},
+{0xe0cd6,{{0x0,0x0,0x0}}},
+{0xe0cd7,{{0x0,0x0,0x0}}},
+{0xe0cd8,{{0x0,0x0,0x0}}},
+{0xe0cd9,{{0x0,0x0,0x0}}},
+{0xe0cda,{{0x0,0x0,0x0}}},
+{0xe0cdb,{{0x0,0x0,0x0}}},
+{0xe0cdc,{{0x0,0x0,0x0}}},
+{0xe0cdd,{{0x0,0x0,0x0}}},
+{0xe0cde,{{0x0,0x0,0x0}}},
+{0xe0cdf,{{0x0,0x0,0x0}}},
+{0xe0ce0,{{0x0,0x0,0x0}}},
+{0xe0ce1,{{0x0,0x0,0x0}}},
+{0xe0ce2,{{0x0,0x0,0x0}}},
+{0xe0ce3,{{0x0,0x0,0x0}}},
+{0xe0ce4,{{0x0,0x0,0x0}}},
+{0xe0ce5,{{0x0,0x0,0x0}}},
+{0xe0ce6,{{0x0,0x0,0x0}}},
+{0xe0ce7,{{0x0,0x0,0x0}}},
+{0xe0ce8,{{0x0,0x0,0x0}}},
+{0xe0ce9,{{0x0,0x0,0x0}}},
+{0xe0cea,{{0x0,0x0,0x0}}},
+{0xe0ceb,{{0x0,0x0,0x0}}},
+{0xe0cec,{{0x0,0x0,0x0}}},
+{0xe0ced,{{0x0,0x0,0x0}}},
+{0xe0cee,{{0x0,0x0,0x0}}},
+{0xe0cef,{{0x0,0x0,0x0}}},
+{0xe0cf0,{{0x0,0x0,0x0}}},
+{0xe0cf1,{{0x0,0x0,0x0}}},
+{0xe0cf2,{{0x0,0x0,0x0}}},
+{0xe0cf3,{{0x0,0x0,0x0}}},
+{0xe0cf4,{{0x0,0x0,0x0}}},
+{0xe0cf5,{{0x0,0x0,0x0}}},
+{0xe0cf6,{{0x0,0x0,0x0}}},
+{0xe0cf7,{{0x0,0x0,0x0}}},
+{0xe0cf8,{{0x0,0x0,0x0}}},
+{0xe0cf9,{{0x0,0x0,0x0}}},
+{0xe0cfa,{{0x0,0x0,0x0}}},
+{0xe0cfb,{{0x0,0x0,0x0}}},
+{0xe0cfc,{{0x0,0x0,0x0}}},
+{0xe0cfd,{{0x0,0x0,0x0}}},
+{0xe0cfe,{{0x0,0x0,0x0}}},
+{0xe0cff,{{0x0,0x0,0x0}}},
+{0xe0d00,{{0x0,0x0,0x0}}},
+{0xe0d01,{{0x0,0x0,0x0}}},
+{0xe0d02,{{0x0,0x0,0x0}}},
+{0xe0d03,{{0x0,0x0,0x0}}},
+{0xe0d04,{{0x0,0x0,0x0}}},
+{0xe0d05,{{0x0,0x0,0x0}}},
+{0xe0d06,{{0x0,0x0,0x0}}},
+{0xe0d07,{{0x0,0x0,0x0}}},
+{0xe0d08,{{0x0,0x0,0x0}}},
+{0xe0d09,{{0x0,0x0,0x0}}},
+{0xe0d0a,{{0x0,0x0,0x0}}},
+{0xe0d0b,{{0x0,0x0,0x0}}},
+{0xe0d0c,{{0x0,0x0,0x0}}},
+{0xe0d0d,{{0x0,0x0,0x0}}},
+{0xe0d0e,{{0x0,0x0,0x0}}},
+{0xe0d0f,{{0x0,0x0,0x0}}},
+{0xe0d10,{{0x0,0x0,0x0}}},
+{0xe0d11,{{0x0,0x0,0x0}}},
+{0xe0d12,{{0x0,0x0,0x0}}},
+{0xe0d13,{{0x0,0x0,0x0}}},
+{0xe0d14,{{0x0,0x0,0x0}}},
+{0xe0d15,{{0x0,0x0,0x0}}},
+{0xe0d16,{{0x0,0x0,0x0}}},
+{0xe0d17,{{0x0,0x0,0x0}}},
+{0xe0d18,{{0x0,0x0,0x0}}},
+{0xe0d19,{{0x0,0x0,0x0}}},
+{0xe0d1a,{{0x0,0x0,0x0}}},
+{0xe0d1b,{{0x0,0x0,0x0}}},
+{0xe0d1c,{{0x0,0x0,0x0}}},
+{0xe0d1d,{{0x0,0x0,0x0}}},
+{0xe0d1e,{{0x0,0x0,0x0}}},
+{0xe0d1f,{{0x0,0x0,0x0}}},
+{0xe0d20,{{0x0,0x0,0x0}}},
+{0xe0d21,{{0x0,0x0,0x0}}},
+{0xe0d22,{{0x0,0x0,0x0}}},
+{0xe0d23,{{0x0,0x0,0x0}}},
+{0xe0d24,{{0x0,0x0,0x0}}},
+{0xe0d25,{{0x0,0x0,0x0}}},
+{0xe0d26,{{0x0,0x0,0x0}}},
+{0xe0d27,{{0x0,0x0,0x0}}},
+{0xe0d28,{{0x0,0x0,0x0}}},
+{0xe0d29,{{0x0,0x0,0x0}}},
+{0xe0d2a,{{0x0,0x0,0x0}}},
+{0xe0d2b,{{0x0,0x0,0x0}}},
+{0xe0d2c,{{0x0,0x0,0x0}}},
+{0xe0d2d,{{0x0,0x0,0x0}}},
+{0xe0d2e,{{0x0,0x0,0x0}}},
+{0xe0d2f,{{0x0,0x0,0x0}}},
+{0xe0d30,{{0x0,0x0,0x0}}},
+{0xe0d31,{{0x0,0x0,0x0}}},
+{0xe0d32,{{0x0,0x0,0x0}}},
+{0xe0d33,{{0x0,0x0,0x0}}},
+{0xe0d34,{{0x0,0x0,0x0}}},
+{0xe0d35,{{0x0,0x0,0x0}}},
+{0xe0d36,{{0x0,0x0,0x0}}},
+{0xe0d37,{{0x0,0x0,0x0}}},
+{0xe0d38,{{0x0,0x0,0x0}}},
+{0xe0d39,{{0x0,0x0,0x0}}},
+{0xe0d3a,{{0x0,0x0,0x0}}},
+{0xe0d3b,{{0x0,0x0,0x0}}},
+{0xe0d3c,{{0x0,0x0,0x0}}},
+{0xe0d3d,{{0x0,0x0,0x0}}},
+{0xe0d3e,{{0x0,0x0,0x0}}},
+{0xe0d3f,{{0x0,0x0,0x0}}},
+{0xe0d40,{{0x0,0x0,0x0}}},
+{0xe0d41,{{0x0,0x0,0x0}}},
+{0xe0d42,{{0x0,0x0,0x0}}},
+{0xe0d43,{{0x0,0x0,0x0}}},
+{0xe0d44,{{0x0,0x0,0x0}}},
+{0xe0d45,{{0x0,0x0,0x0}}},
+{0xe0d46,{{0x0,0x0,0x0}}},
+{0xe0d47,{{0x0,0x0,0x0}}},
+{0xe0d48,{{0x0,0x0,0x0}}},
+{0xe0d49,{{0x0,0x0,0x0}}},
+{0xe0d4a,{{0x0,0x0,0x0}}},
+{0xe0d4b,{{0x0,0x0,0x0}}},
+{0xe0d4c,{{0x0,0x0,0x0}}},
+{0xe0d4d,{{0x0,0x0,0x0}}},
+{0xe0d4e,{{0x0,0x0,0x0}}},
+{0xe0d4f,{{0x0,0x0,0x0}}},
+{0xe0d50,{{0x0,0x0,0x0}}},
+{0xe0d51,{{0x0,0x0,0x0}}},
+{0xe0d52,{{0x0,0x0,0x0}}},
+{0xe0d53,{{0x0,0x0,0x0}}},
+{0xe0d54,{{0x0,0x0,0x0}}},
+{0xe0d55,{{0x0,0x0,0x0}}},
+{0xe0d56,{{0x0,0x0,0x0}}},
+{0xe0d57,{{0x0,0x0,0x0}}},
+{0xe0d58,{{0x0,0x0,0x0}}},
+{0xe0d59,{{0x0,0x0,0x0}}},
+{0xe0d5a,{{0x0,0x0,0x0}}},
+{0xe0d5b,{{0x0,0x0,0x0}}},
+{0xe0d5c,{{0x0,0x0,0x0}}},
+{0xe0d5d,{{0x0,0x0,0x0}}},
+{0xe0d5e,{{0x0,0x0,0x0}}},
+{0xe0d5f,{{0x0,0x0,0x0}}},
+{0xe0d60,{{0x0,0x0,0x0}}},
+{0xe0d61,{{0x0,0x0,0x0}}},
+{0xe0d62,{{0x0,0x0,0x0}}},
+{0xe0d63,{{0x0,0x0,0x0}}},
+{0xe0d64,{{0x0,0x0,0x0}}},
+{0xe0d65,{{0x0,0x0,0x0}}},
+{0xe0d66,{{0x0,0x0,0x0}}},
+{0xe0d67,{{0x0,0x0,0x0}}},
+{0xe0d68,{{0x0,0x0,0x0}}},
+{0xe0d69,{{0x0,0x0,0x0}}},
+{0xe0d6a,{{0x0,0x0,0x0}}},
+{0xe0d6b,{{0x0,0x0,0x0}}},
+{0xe0d6c,{{0x0,0x0,0x0}}},
+{0xe0d6d,{{0x0,0x0,0x0}}},
+{0xe0d6e,{{0x0,0x0,0x0}}},
+{0xe0d6f,{{0x0,0x0,0x0}}},
+{0xe0d70,{{0x0,0x0,0x0}}},
+{0xe0d71,{{0x0,0x0,0x0}}},
+{0xe0d72,{{0x0,0x0,0x0}}},
+{0xe0d73,{{0x0,0x0,0x0}}},
+{0xe0d74,{{0x0,0x0,0x0}}},
+{0xe0d75,{{0x0,0x0,0x0}}},
+{0xe0d76,{{0x0,0x0,0x0}}},
+{0xe0d77,{{0x0,0x0,0x0}}},
+{0xe0d78,{{0x0,0x0,0x0}}},
+{0xe0d79,{{0x0,0x0,0x0}}},
+{0xe0d7a,{{0x0,0x0,0x0}}},
+{0xe0d7b,{{0x0,0x0,0x0}}},
+{0xe0d7c,{{0x0,0x0,0x0}}},
+{0xe0d7d,{{0x0,0x0,0x0}}},
+{0xe0d7e,{{0x0,0x0,0x0}}},
+{0xe0d7f,{{0x0,0x0,0x0}}},
+{0xe0d80,{{0x0,0x0,0x0}}},
+{0xe0d81,{{0x0,0x0,0x0}}},
+{0xe0d82,{{0x0,0x0,0x0}}},
+{0xe0d83,{{0x0,0x0,0x0}}},
+{0xe0d84,{{0x0,0x0,0x0}}},
+{0xe0d85,{{0x0,0x0,0x0}}},
+{0xe0d86,{{0x0,0x0,0x0}}},
+{0xe0d87,{{0x0,0x0,0x0}}},
+{0xe0d88,{{0x0,0x0,0x0}}},
+{0xe0d89,{{0x0,0x0,0x0}}},
+{0xe0d8a,{{0x0,0x0,0x0}}},
+{0xe0d8b,{{0x0,0x0,0x0}}},
+{0xe0d8c,{{0x0,0x0,0x0}}},
+{0xe0d8d,{{0x0,0x0,0x0}}},
+{0xe0d8e,{{0x0,0x0,0x0}}},
+{0xe0d8f,{{0x0,0x0,0x0}}},
+{0xe0d90,{{0x0,0x0,0x0}}},
+{0xe0d91,{{0x0,0x0,0x0}}},
+{0xe0d92,{{0x0,0x0,0x0}}},
+{0xe0d93,{{0x0,0x0,0x0}}},
+{0xe0d94,{{0x0,0x0,0x0}}},
+{0xe0d95,{{0x0,0x0,0x0}}},
+{0xe0d96,{{0x0,0x0,0x0}}},
+{0xe0d97,{{0x0,0x0,0x0}}},
+{0xe0d98,{{0x0,0x0,0x0}}},
+{0xe0d99,{{0x0,0x0,0x0}}},
+{0xe0d9a,{{0x0,0x0,0x0}}},
+{0xe0d9b,{{0x0,0x0,0x0}}},
+{0xe0d9c,{{0x0,0x0,0x0}}},
+{0xe0d9d,{{0x0,0x0,0x0}}},
+{0xe0d9e,{{0x0,0x0,0x0}}},
+{0xe0d9f,{{0x0,0x0,0x0}}},
+{0xe0da0,{{0x0,0x0,0x0}}},
+{0xe0da1,{{0x0,0x0,0x0}}},
+{0xe0da2,{{0x0,0x0,0x0}}},
+{0xe0da3,{{0x0,0x0,0x0}}},
+{0xe0da4,{{0x0,0x0,0x0}}},
+{0xe0da5,{{0x0,0x0,0x0}}},
+{0xe0da6,{{0x0,0x0,0x0}}},
+{0xe0da7,{{0x0,0x0,0x0}}},
+{0xe0da8,{{0x0,0x0,0x0}}},
+{0xe0da9,{{0x0,0x0,0x0}}},
+{0xe0daa,{{0x0,0x0,0x0}}},
+{0xe0dab,{{0x0,0x0,0x0}}},
+{0xe0dac,{{0x0,0x0,0x0}}},
+{0xe0dad,{{0x0,0x0,0x0}}},
+{0xe0dae,{{0x0,0x0,0x0}}},
+{0xe0daf,{{0x0,0x0,0x0}}},
+{0xe0db0,{{0x0,0x0,0x0}}},
+{0xe0db1,{{0x0,0x0,0x0}}},
+{0xe0db2,{{0x0,0x0,0x0}}},
+{0xe0db3,{{0x0,0x0,0x0}}},
+{0xe0db4,{{0x0,0x0,0x0}}},
+{0xe0db5,{{0x0,0x0,0x0}}},
+{0xe0db6,{{0x0,0x0,0x0}}},
+{0xe0db7,{{0x0,0x0,0x0}}},
+{0xe0db8,{{0x0,0x0,0x0}}},
+{0xe0db9,{{0x0,0x0,0x0}}},
+{0xe0dba,{{0x0,0x0,0x0}}},
+{0xe0dbb,{{0x0,0x0,0x0}}},
+{0xe0dbc,{{0x0,0x0,0x0}}},
+{0xe0dbd,{{0x0,0x0,0x0}}},
+{0xe0dbe,{{0x0,0x0,0x0}}},
+{0xe0dbf,{{0x0,0x0,0x0}}},
+{0xe0dc0,{{0x0,0x0,0x0}}},
+{0xe0dc1,{{0x0,0x0,0x0}}},
+{0xe0dc2,{{0x0,0x0,0x0}}},
+{0xe0dc3,{{0x0,0x0,0x0}}},
+{0xe0dc4,{{0x0,0x0,0x0}}},
+{0xe0dc5,{{0x0,0x0,0x0}}},
+{0xe0dc6,{{0x0,0x0,0x0}}},
+{0xe0dc7,{{0x0,0x0,0x0}}},
+{0xe0dc8,{{0x0,0x0,0x0}}},
+{0xe0dc9,{{0x0,0x0,0x0}}},
+{0xe0dca,{{0x0,0x0,0x0}}},
+{0xe0dcb,{{0x0,0x0,0x0}}},
+{0xe0dcc,{{0x0,0x0,0x0}}},
+{0xe0dcd,{{0x0,0x0,0x0}}},
+{0xe0dce,{{0x0,0x0,0x0}}},
+{0xe0dcf,{{0x0,0x0,0x0}}},
+{0xe0dd0,{{0x0,0x0,0x0}}},
+{0xe0dd1,{{0x0,0x0,0x0}}},
+{0xe0dd2,{{0x0,0x0,0x0}}},
+{0xe0dd3,{{0x0,0x0,0x0}}},
+{0xe0dd4,{{0x0,0x0,0x0}}},
+{0xe0dd5,{{0x0,0x0,0x0}}},
+{0xe0dd6,{{0x0,0x0,0x0}}},
+{0xe0dd7,{{0x0,0x0,0x0}}},
+{0xe0dd8,{{0x0,0x0,0x0}}},
+{0xe0dd9,{{0x0,0x0,0x0}}},
+{0xe0dda,{{0x0,0x0,0x0}}},
+{0xe0ddb,{{0x0,0x0,0x0}}},
+{0xe0ddc,{{0x0,0x0,0x0}}},
+{0xe0ddd,{{0x0,0x0,0x0}}},
+{0xe0dde,{{0x0,0x0,0x0}}},
+{0xe0ddf,{{0x0,0x0,0x0}}},
+{0xe0de0,{{0x0,0x0,0x0}}},
+{0xe0de1,{{0x0,0x0,0x0}}},
+{0xe0de2,{{0x0,0x0,0x0}}},
+{0xe0de3,{{0x0,0x0,0x0}}},
+{0xe0de4,{{0x0,0x0,0x0}}},
+{0xe0de5,{{0x0,0x0,0x0}}},
+{0xe0de6,{{0x0,0x0,0x0}}},
+{0xe0de7,{{0x0,0x0,0x0}}},
+{0xe0de8,{{0x0,0x0,0x0}}},
+{0xe0de9,{{0x0,0x0,0x0}}},
+{0xe0dea,{{0x0,0x0,0x0}}},
+{0xe0deb,{{0x0,0x0,0x0}}},
+{0xe0dec,{{0x0,0x0,0x0}}},
+{0xe0ded,{{0x0,0x0,0x0}}},
+{0xe0dee,{{0x0,0x0,0x0}}},
+{0xe0def,{{0x0,0x0,0x0}}},
+{0xe0df0,{{0x0,0x0,0x0}}},
+{0xe0df1,{{0x0,0x0,0x0}}},
+{0xe0df2,{{0x0,0x0,0x0}}},
+{0xe0df3,{{0x0,0x0,0x0}}},
+{0xe0df4,{{0x0,0x0,0x0}}},
+{0xe0df5,{{0x0,0x0,0x0}}},
+{0xe0df6,{{0x0,0x0,0x0}}},
+{0xe0df7,{{0x0,0x0,0x0}}},
+{0xe0df8,{{0x0,0x0,0x0}}},
+{0xe0df9,{{0x0,0x0,0x0}}},
+{0xe0dfa,{{0x0,0x0,0x0}}},
+{0xe0dfb,{{0x0,0x0,0x0}}},
+{0xe0dfc,{{0x0,0x0,0x0}}},
+{0xe0dfd,{{0x0,0x0,0x0}}},
+{0xe0dfe,{{0x0,0x0,0x0}}},
+{0xe0dff,{{0x0,0x0,0x0}}},
+{0xe0e00,{{0x0,0x0,0x0}}},
+{0xe0e01,{{0x0,0x0,0x0}}},
+{0xe0e02,{{0x0,0x0,0x0}}},
+{0xe0e03,{{0x0,0x0,0x0}}},
+{0xe0e04,{{0x0,0x0,0x0}}},
+{0xe0e05,{{0x0,0x0,0x0}}},
+{0xe0e06,{{0x0,0x0,0x0}}},
+{0xe0e07,{{0x0,0x0,0x0}}},
+{0xe0e08,{{0x0,0x0,0x0}}},
+{0xe0e09,{{0x0,0x0,0x0}}},
+{0xe0e0a,{{0x0,0x0,0x0}}},
+{0xe0e0b,{{0x0,0x0,0x0}}},
+{0xe0e0c,{{0x0,0x0,0x0}}},
+{0xe0e0d,{{0x0,0x0,0x0}}},
+{0xe0e0e,{{0x0,0x0,0x0}}},
+{0xe0e0f,{{0x0,0x0,0x0}}},
+{0xe0e10,{{0x0,0x0,0x0}}},
+{0xe0e11,{{0x0,0x0,0x0}}},
+{0xe0e12,{{0x0,0x0,0x0}}},
+{0xe0e13,{{0x0,0x0,0x0}}},
+{0xe0e14,{{0x0,0x0,0x0}}},
+{0xe0e15,{{0x0,0x0,0x0}}},
+{0xe0e16,{{0x0,0x0,0x0}}},
+{0xe0e17,{{0x0,0x0,0x0}}},
+{0xe0e18,{{0x0,0x0,0x0}}},
+{0xe0e19,{{0x0,0x0,0x0}}},
+{0xe0e1a,{{0x0,0x0,0x0}}},
+{0xe0e1b,{{0x0,0x0,0x0}}},
+{0xe0e1c,{{0x0,0x0,0x0}}},
+{0xe0e1d,{{0x0,0x0,0x0}}},
+{0xe0e1e,{{0x0,0x0,0x0}}},
+{0xe0e1f,{{0x0,0x0,0x0}}},
+{0xe0e20,{{0x0,0x0,0x0}}},
+{0xe0e21,{{0x0,0x0,0x0}}},
+{0xe0e22,{{0x0,0x0,0x0}}},
+{0xe0e23,{{0x0,0x0,0x0}}},
+{0xe0e24,{{0x0,0x0,0x0}}},
+{0xe0e25,{{0x0,0x0,0x0}}},
+{0xe0e26,{{0x0,0x0,0x0}}},
+{0xe0e27,{{0x0,0x0,0x0}}},
+{0xe0e28,{{0x0,0x0,0x0}}},
+{0xe0e29,{{0x0,0x0,0x0}}},
+{0xe0e2a,{{0x0,0x0,0x0}}},
+{0xe0e2b,{{0x0,0x0,0x0}}},
+{0xe0e2c,{{0x0,0x0,0x0}}},
+{0xe0e2d,{{0x0,0x0,0x0}}},
+{0xe0e2e,{{0x0,0x0,0x0}}},
+{0xe0e2f,{{0x0,0x0,0x0}}},
+{0xe0e30,{{0x0,0x0,0x0}}},
+{0xe0e31,{{0x0,0x0,0x0}}},
+{0xe0e32,{{0x0,0x0,0x0}}},
+{0xe0e33,{{0x0,0x0,0x0}}},
+{0xe0e34,{{0x0,0x0,0x0}}},
+{0xe0e35,{{0x0,0x0,0x0}}},
+{0xe0e36,{{0x0,0x0,0x0}}},
+{0xe0e37,{{0x0,0x0,0x0}}},
+{0xe0e38,{{0x0,0x0,0x0}}},
+{0xe0e39,{{0x0,0x0,0x0}}},
+{0xe0e3a,{{0x0,0x0,0x0}}},
+{0xe0e3b,{{0x0,0x0,0x0}}},
+{0xe0e3c,{{0x0,0x0,0x0}}},
+{0xe0e3d,{{0x0,0x0,0x0}}},
+{0xe0e3e,{{0x0,0x0,0x0}}},
+{0xe0e3f,{{0x0,0x0,0x0}}},
+{0xe0e40,{{0x0,0x0,0x0}}},
+{0xe0e41,{{0x0,0x0,0x0}}},
+{0xe0e42,{{0x0,0x0,0x0}}},
+{0xe0e43,{{0x0,0x0,0x0}}},
+{0xe0e44,{{0x0,0x0,0x0}}},
+{0xe0e45,{{0x0,0x0,0x0}}},
+{0xe0e46,{{0x0,0x0,0x0}}},
+{0xe0e47,{{0x0,0x0,0x0}}},
+{0xe0e48,{{0x0,0x0,0x0}}},
+{0xe0e49,{{0x0,0x0,0x0}}},
+{0xe0e4a,{{0x0,0x0,0x0}}},
+{0xe0e4b,{{0x0,0x0,0x0}}},
+{0xe0e4c,{{0x0,0x0,0x0}}},
+{0xe0e4d,{{0x0,0x0,0x0}}},
+{0xe0e4e,{{0x0,0x0,0x0}}},
+{0xe0e4f,{{0x0,0x0,0x0}}},
+{0xe0e50,{{0x0,0x0,0x0}}},
+{0xe0e51,{{0x0,0x0,0x0}}},
+{0xe0e52,{{0x0,0x0,0x0}}},
+{0xe0e53,{{0x0,0x0,0x0}}},
+{0xe0e54,{{0x0,0x0,0x0}}},
+{0xe0e55,{{0x0,0x0,0x0}}},
+{0xe0e56,{{0x0,0x0,0x0}}},
+{0xe0e57,{{0x0,0x0,0x0}}},
+{0xe0e58,{{0x0,0x0,0x0}}},
+{0xe0e59,{{0x0,0x0,0x0}}},
+{0xe0e5a,{{0x0,0x0,0x0}}},
+{0xe0e5b,{{0x0,0x0,0x0}}},
+{0xe0e5c,{{0x0,0x0,0x0}}},
+{0xe0e5d,{{0x0,0x0,0x0}}},
+{0xe0e5e,{{0x0,0x0,0x0}}},
+{0xe0e5f,{{0x0,0x0,0x0}}},
+{0xe0e60,{{0x0,0x0,0x0}}},
+{0xe0e61,{{0x0,0x0,0x0}}},
+{0xe0e62,{{0x0,0x0,0x0}}},
+{0xe0e63,{{0x0,0x0,0x0}}},
+{0xe0e64,{{0x0,0x0,0x0}}},
+{0xe0e65,{{0x0,0x0,0x0}}},
+{0xe0e66,{{0x0,0x0,0x0}}},
+{0xe0e67,{{0x0,0x0,0x0}}},
+{0xe0e68,{{0x0,0x0,0x0}}},
+{0xe0e69,{{0x0,0x0,0x0}}},
+{0xe0e6a,{{0x0,0x0,0x0}}},
+{0xe0e6b,{{0x0,0x0,0x0}}},
+{0xe0e6c,{{0x0,0x0,0x0}}},
+{0xe0e6d,{{0x0,0x0,0x0}}},
+{0xe0e6e,{{0x0,0x0,0x0}}},
+{0xe0e6f,{{0x0,0x0,0x0}}},
+{0xe0e70,{{0x0,0x0,0x0}}},
+{0xe0e71,{{0x0,0x0,0x0}}},
+{0xe0e72,{{0x0,0x0,0x0}}},
+{0xe0e73,{{0x0,0x0,0x0}}},
+{0xe0e74,{{0x0,0x0,0x0}}},
+{0xe0e75,{{0x0,0x0,0x0}}},
+{0xe0e76,{{0x0,0x0,0x0}}},
+{0xe0e77,{{0x0,0x0,0x0}}},
+{0xe0e78,{{0x0,0x0,0x0}}},
+{0xe0e79,{{0x0,0x0,0x0}}},
+{0xe0e7a,{{0x0,0x0,0x0}}},
+{0xe0e7b,{{0x0,0x0,0x0}}},
+{0xe0e7c,{{0x0,0x0,0x0}}},
+{0xe0e7d,{{0x0,0x0,0x0}}},
+{0xe0e7e,{{0x0,0x0,0x0}}},
+{0xe0e7f,{{0x0,0x0,0x0}}},
+{0xe0e80,{{0x0,0x0,0x0}}},
+{0xe0e81,{{0x0,0x0,0x0}}},
+{0xe0e82,{{0x0,0x0,0x0}}},
+{0xe0e83,{{0x0,0x0,0x0}}},
+{0xe0e84,{{0x0,0x0,0x0}}},
+{0xe0e85,{{0x0,0x0,0x0}}},
+{0xe0e86,{{0x0,0x0,0x0}}},
+{0xe0e87,{{0x0,0x0,0x0}}},
+{0xe0e88,{{0x0,0x0,0x0}}},
+{0xe0e89,{{0x0,0x0,0x0}}},
+{0xe0e8a,{{0x0,0x0,0x0}}},
+{0xe0e8b,{{0x0,0x0,0x0}}},
+{0xe0e8c,{{0x0,0x0,0x0}}},
+{0xe0e8d,{{0x0,0x0,0x0}}},
+{0xe0e8e,{{0x0,0x0,0x0}}},
+{0xe0e8f,{{0x0,0x0,0x0}}},
+{0xe0e90,{{0x0,0x0,0x0}}},
+{0xe0e91,{{0x0,0x0,0x0}}},
+{0xe0e92,{{0x0,0x0,0x0}}},
+{0xe0e93,{{0x0,0x0,0x0}}},
+{0xe0e94,{{0x0,0x0,0x0}}},
+{0xe0e95,{{0x0,0x0,0x0}}},
+{0xe0e96,{{0x0,0x0,0x0}}},
+{0xe0e97,{{0x0,0x0,0x0}}},
+{0xe0e98,{{0x0,0x0,0x0}}},
+{0xe0e99,{{0x0,0x0,0x0}}},
+{0xe0e9a,{{0x0,0x0,0x0}}},
+{0xe0e9b,{{0x0,0x0,0x0}}},
+{0xe0e9c,{{0x0,0x0,0x0}}},
+{0xe0e9d,{{0x0,0x0,0x0}}},
+{0xe0e9e,{{0x0,0x0,0x0}}},
+{0xe0e9f,{{0x0,0x0,0x0}}},
+{0xe0ea0,{{0x0,0x0,0x0}}},
+{0xe0ea1,{{0x0,0x0,0x0}}},
+{0xe0ea2,{{0x0,0x0,0x0}}},
+{0xe0ea3,{{0x0,0x0,0x0}}},
+{0xe0ea4,{{0x0,0x0,0x0}}},
+{0xe0ea5,{{0x0,0x0,0x0}}},
+{0xe0ea6,{{0x0,0x0,0x0}}},
+{0xe0ea7,{{0x0,0x0,0x0}}},
+{0xe0ea8,{{0x0,0x0,0x0}}},
+{0xe0ea9,{{0x0,0x0,0x0}}},
+{0xe0eaa,{{0x0,0x0,0x0}}},
+{0xe0eab,{{0x0,0x0,0x0}}},
+{0xe0eac,{{0x0,0x0,0x0}}},
+{0xe0ead,{{0x0,0x0,0x0}}},
+{0xe0eae,{{0x0,0x0,0x0}}},
+{0xe0eaf,{{0x0,0x0,0x0}}},
+{0xe0eb0,{{0x0,0x0,0x0}}},
+{0xe0eb1,{{0x0,0x0,0x0}}},
+{0xe0eb2,{{0x0,0x0,0x0}}},
+{0xe0eb3,{{0x0,0x0,0x0}}},
+{0xe0eb4,{{0x0,0x0,0x0}}},
+{0xe0eb5,{{0x0,0x0,0x0}}},
+{0xe0eb6,{{0x0,0x0,0x0}}},
+{0xe0eb7,{{0x0,0x0,0x0}}},
+{0xe0eb8,{{0x0,0x0,0x0}}},
+{0xe0eb9,{{0x0,0x0,0x0}}},
+{0xe0eba,{{0x0,0x0,0x0}}},
+{0xe0ebb,{{0x0,0x0,0x0}}},
+{0xe0ebc,{{0x0,0x0,0x0}}},
+{0xe0ebd,{{0x0,0x0,0x0}}},
+{0xe0ebe,{{0x0,0x0,0x0}}},
+{0xe0ebf,{{0x0,0x0,0x0}}},
+{0xe0ec0,{{0x0,0x0,0x0}}},
+{0xe0ec1,{{0x0,0x0,0x0}}},
+{0xe0ec2,{{0x0,0x0,0x0}}},
+{0xe0ec3,{{0x0,0x0,0x0}}},
+{0xe0ec4,{{0x0,0x0,0x0}}},
+{0xe0ec5,{{0x0,0x0,0x0}}},
+{0xe0ec6,{{0x0,0x0,0x0}}},
+{0xe0ec7,{{0x0,0x0,0x0}}},
+{0xe0ec8,{{0x0,0x0,0x0}}},
+{0xe0ec9,{{0x0,0x0,0x0}}},
+{0xe0eca,{{0x0,0x0,0x0}}},
+{0xe0ecb,{{0x0,0x0,0x0}}},
+{0xe0ecc,{{0x0,0x0,0x0}}},
+{0xe0ecd,{{0x0,0x0,0x0}}},
+{0xe0ece,{{0x0,0x0,0x0}}},
+{0xe0ecf,{{0x0,0x0,0x0}}},
+{0xe0ed0,{{0x0,0x0,0x0}}},
+{0xe0ed1,{{0x0,0x0,0x0}}},
+{0xe0ed2,{{0x0,0x0,0x0}}},
+{0xe0ed3,{{0x0,0x0,0x0}}},
+{0xe0ed4,{{0x0,0x0,0x0}}},
+{0xe0ed5,{{0x0,0x0,0x0}}},
+{0xe0ed6,{{0x0,0x0,0x0}}},
+{0xe0ed7,{{0x0,0x0,0x0}}},
+{0xe0ed8,{{0x0,0x0,0x0}}},
+{0xe0ed9,{{0x0,0x0,0x0}}},
+{0xe0eda,{{0x0,0x0,0x0}}},
+{0xe0edb,{{0x0,0x0,0x0}}},
+{0xe0edc,{{0x0,0x0,0x0}}},
+{0xe0edd,{{0x0,0x0,0x0}}},
+{0xe0ede,{{0x0,0x0,0x0}}},
+{0xe0edf,{{0x0,0x0,0x0}}},
+{0xe0ee0,{{0x0,0x0,0x0}}},
+{0xe0ee1,{{0x0,0x0,0x0}}},
+{0xe0ee2,{{0x0,0x0,0x0}}},
+{0xe0ee3,{{0x0,0x0,0x0}}},
+{0xe0ee4,{{0x0,0x0,0x0}}},
+{0xe0ee5,{{0x0,0x0,0x0}}},
+{0xe0ee6,{{0x0,0x0,0x0}}},
+{0xe0ee7,{{0x0,0x0,0x0}}},
+{0xe0ee8,{{0x0,0x0,0x0}}},
+{0xe0ee9,{{0x0,0x0,0x0}}},
+{0xe0eea,{{0x0,0x0,0x0}}},
+{0xe0eeb,{{0x0,0x0,0x0}}},
+{0xe0eec,{{0x0,0x0,0x0}}},
+{0xe0eed,{{0x0,0x0,0x0}}},
+{0xe0eee,{{0x0,0x0,0x0}}},
+{0xe0eef,{{0x0,0x0,0x0}}},
+{0xe0ef0,{{0x0,0x0,0x0}}},
+{0xe0ef1,{{0x0,0x0,0x0}}},
+{0xe0ef2,{{0x0,0x0,0x0}}},
+{0xe0ef3,{{0x0,0x0,0x0}}},
+{0xe0ef4,{{0x0,0x0,0x0}}},
+{0xe0ef5,{{0x0,0x0,0x0}}},
+{0xe0ef6,{{0x0,0x0,0x0}}},
+{0xe0ef7,{{0x0,0x0,0x0}}},
+{0xe0ef8,{{0x0,0x0,0x0}}},
+{0xe0ef9,{{0x0,0x0,0x0}}},
+{0xe0efa,{{0x0,0x0,0x0}}},
+{0xe0efb,{{0x0,0x0,0x0}}},
+{0xe0efc,{{0x0,0x0,0x0}}},
+{0xe0efd,{{0x0,0x0,0x0}}},
+{0xe0efe,{{0x0,0x0,0x0}}},
+{0xe0eff,{{0x0,0x0,0x0}}},
+{0xe0f00,{{0x0,0x0,0x0}}},
+{0xe0f01,{{0x0,0x0,0x0}}},
+{0xe0f02,{{0x0,0x0,0x0}}},
+{0xe0f03,{{0x0,0x0,0x0}}},
+{0xe0f04,{{0x0,0x0,0x0}}},
+{0xe0f05,{{0x0,0x0,0x0}}},
+{0xe0f06,{{0x0,0x0,0x0}}},
+{0xe0f07,{{0x0,0x0,0x0}}},
+{0xe0f08,{{0x0,0x0,0x0}}},
+{0xe0f09,{{0x0,0x0,0x0}}},
+{0xe0f0a,{{0x0,0x0,0x0}}},
+{0xe0f0b,{{0x0,0x0,0x0}}},
+{0xe0f0c,{{0x0,0x0,0x0}}},
+{0xe0f0d,{{0x0,0x0,0x0}}},
+{0xe0f0e,{{0x0,0x0,0x0}}},
+{0xe0f0f,{{0x0,0x0,0x0}}},
+{0xe0f10,{{0x0,0x0,0x0}}},
+{0xe0f11,{{0x0,0x0,0x0}}},
+{0xe0f12,{{0x0,0x0,0x0}}},
+{0xe0f13,{{0x0,0x0,0x0}}},
+{0xe0f14,{{0x0,0x0,0x0}}},
+{0xe0f15,{{0x0,0x0,0x0}}},
+{0xe0f16,{{0x0,0x0,0x0}}},
+{0xe0f17,{{0x0,0x0,0x0}}},
+{0xe0f18,{{0x0,0x0,0x0}}},
+{0xe0f19,{{0x0,0x0,0x0}}},
+{0xe0f1a,{{0x0,0x0,0x0}}},
+{0xe0f1b,{{0x0,0x0,0x0}}},
+{0xe0f1c,{{0x0,0x0,0x0}}},
+{0xe0f1d,{{0x0,0x0,0x0}}},
+{0xe0f1e,{{0x0,0x0,0x0}}},
+{0xe0f1f,{{0x0,0x0,0x0}}},
+{0xe0f20,{{0x0,0x0,0x0}}},
+{0xe0f21,{{0x0,0x0,0x0}}},
+{0xe0f22,{{0x0,0x0,0x0}}},
+{0xe0f23,{{0x0,0x0,0x0}}},
+{0xe0f24,{{0x0,0x0,0x0}}},
+{0xe0f25,{{0x0,0x0,0x0}}},
+{0xe0f26,{{0x0,0x0,0x0}}},
+{0xe0f27,{{0x0,0x0,0x0}}},
+{0xe0f28,{{0x0,0x0,0x0}}},
+{0xe0f29,{{0x0,0x0,0x0}}},
+{0xe0f2a,{{0x0,0x0,0x0}}},
+{0xe0f2b,{{0x0,0x0,0x0}}},
+{0xe0f2c,{{0x0,0x0,0x0}}},
+{0xe0f2d,{{0x0,0x0,0x0}}},
+{0xe0f2e,{{0x0,0x0,0x0}}},
+{0xe0f2f,{{0x0,0x0,0x0}}},
+{0xe0f30,{{0x0,0x0,0x0}}},
+{0xe0f31,{{0x0,0x0,0x0}}},
+{0xe0f32,{{0x0,0x0,0x0}}},
+{0xe0f33,{{0x0,0x0,0x0}}},
+{0xe0f34,{{0x0,0x0,0x0}}},
+{0xe0f35,{{0x0,0x0,0x0}}},
+{0xe0f36,{{0x0,0x0,0x0}}},
+{0xe0f37,{{0x0,0x0,0x0}}},
+{0xe0f38,{{0x0,0x0,0x0}}},
+{0xe0f39,{{0x0,0x0,0x0}}},
+{0xe0f3a,{{0x0,0x0,0x0}}},
+{0xe0f3b,{{0x0,0x0,0x0}}},
+{0xe0f3c,{{0x0,0x0,0x0}}},
+{0xe0f3d,{{0x0,0x0,0x0}}},
+{0xe0f3e,{{0x0,0x0,0x0}}},
+{0xe0f3f,{{0x0,0x0,0x0}}},
+{0xe0f40,{{0x0,0x0,0x0}}},
+{0xe0f41,{{0x0,0x0,0x0}}},
+{0xe0f42,{{0x0,0x0,0x0}}},
+{0xe0f43,{{0x0,0x0,0x0}}},
+{0xe0f44,{{0x0,0x0,0x0}}},
+{0xe0f45,{{0x0,0x0,0x0}}},
+{0xe0f46,{{0x0,0x0,0x0}}},
+{0xe0f47,{{0x0,0x0,0x0}}},
+{0xe0f48,{{0x0,0x0,0x0}}},
+{0xe0f49,{{0x0,0x0,0x0}}},
+{0xe0f4a,{{0x0,0x0,0x0}}},
+{0xe0f4b,{{0x0,0x0,0x0}}},
+{0xe0f4c,{{0x0,0x0,0x0}}},
+{0xe0f4d,{{0x0,0x0,0x0}}},
+{0xe0f4e,{{0x0,0x0,0x0}}},
+{0xe0f4f,{{0x0,0x0,0x0}}},
+{0xe0f50,{{0x0,0x0,0x0}}},
+{0xe0f51,{{0x0,0x0,0x0}}},
+{0xe0f52,{{0x0,0x0,0x0}}},
+{0xe0f53,{{0x0,0x0,0x0}}},
+{0xe0f54,{{0x0,0x0,0x0}}},
+{0xe0f55,{{0x0,0x0,0x0}}},
+{0xe0f56,{{0x0,0x0,0x0}}},
+{0xe0f57,{{0x0,0x0,0x0}}},
+{0xe0f58,{{0x0,0x0,0x0}}},
+{0xe0f59,{{0x0,0x0,0x0}}},
+{0xe0f5a,{{0x0,0x0,0x0}}},
+{0xe0f5b,{{0x0,0x0,0x0}}},
+{0xe0f5c,{{0x0,0x0,0x0}}},
+{0xe0f5d,{{0x0,0x0,0x0}}},
+{0xe0f5e,{{0x0,0x0,0x0}}},
+{0xe0f5f,{{0x0,0x0,0x0}}},
+{0xe0f60,{{0x0,0x0,0x0}}},
+{0xe0f61,{{0x0,0x0,0x0}}},
+{0xe0f62,{{0x0,0x0,0x0}}},
+{0xe0f63,{{0x0,0x0,0x0}}},
+{0xe0f64,{{0x0,0x0,0x0}}},
+{0xe0f65,{{0x0,0x0,0x0}}},
+{0xe0f66,{{0x0,0x0,0x0}}},
+{0xe0f67,{{0x0,0x0,0x0}}},
+{0xe0f68,{{0x0,0x0,0x0}}},
+{0xe0f69,{{0x0,0x0,0x0}}},
+{0xe0f6a,{{0x0,0x0,0x0}}},
+{0xe0f6b,{{0x0,0x0,0x0}}},
+{0xe0f6c,{{0x0,0x0,0x0}}},
+{0xe0f6d,{{0x0,0x0,0x0}}},
+{0xe0f6e,{{0x0,0x0,0x0}}},
+{0xe0f6f,{{0x0,0x0,0x0}}},
+{0xe0f70,{{0x0,0x0,0x0}}},
+{0xe0f71,{{0x0,0x0,0x0}}},
+{0xe0f72,{{0x0,0x0,0x0}}},
+{0xe0f73,{{0x0,0x0,0x0}}},
+{0xe0f74,{{0x0,0x0,0x0}}},
+{0xe0f75,{{0x0,0x0,0x0}}},
+{0xe0f76,{{0x0,0x0,0x0}}},
+{0xe0f77,{{0x0,0x0,0x0}}},
+{0xe0f78,{{0x0,0x0,0x0}}},
+{0xe0f79,{{0x0,0x0,0x0}}},
+{0xe0f7a,{{0x0,0x0,0x0}}},
+{0xe0f7b,{{0x0,0x0,0x0}}},
+{0xe0f7c,{{0x0,0x0,0x0}}},
+{0xe0f7d,{{0x0,0x0,0x0}}},
+{0xe0f7e,{{0x0,0x0,0x0}}},
+{0xe0f7f,{{0x0,0x0,0x0}}},
+{0xe0f80,{{0x0,0x0,0x0}}},
+{0xe0f81,{{0x0,0x0,0x0}}},
+{0xe0f82,{{0x0,0x0,0x0}}},
+{0xe0f83,{{0x0,0x0,0x0}}},
+{0xe0f84,{{0x0,0x0,0x0}}},
+{0xe0f85,{{0x0,0x0,0x0}}},
+{0xe0f86,{{0x0,0x0,0x0}}},
+{0xe0f87,{{0x0,0x0,0x0}}},
+{0xe0f88,{{0x0,0x0,0x0}}},
+{0xe0f89,{{0x0,0x0,0x0}}},
+{0xe0f8a,{{0x0,0x0,0x0}}},
+{0xe0f8b,{{0x0,0x0,0x0}}},
+{0xe0f8c,{{0x0,0x0,0x0}}},
+{0xe0f8d,{{0x0,0x0,0x0}}},
+{0xe0f8e,{{0x0,0x0,0x0}}},
+{0xe0f8f,{{0x0,0x0,0x0}}},
+{0xe0f90,{{0x0,0x0,0x0}}},
+{0xe0f91,{{0x0,0x0,0x0}}},
+{0xe0f92,{{0x0,0x0,0x0}}},
+{0xe0f93,{{0x0,0x0,0x0}}},
+{0xe0f94,{{0x0,0x0,0x0}}},
+{0xe0f95,{{0x0,0x0,0x0}}},
+{0xe0f96,{{0x0,0x0,0x0}}},
+{0xe0f97,{{0x0,0x0,0x0}}},
+{0xe0f98,{{0x0,0x0,0x0}}},
+{0xe0f99,{{0x0,0x0,0x0}}},
+{0xe0f9a,{{0x0,0x0,0x0}}},
+{0xe0f9b,{{0x0,0x0,0x0}}},
+{0xe0f9c,{{0x0,0x0,0x0}}},
+{0xe0f9d,{{0x0,0x0,0x0}}},
+{0xe0f9e,{{0x0,0x0,0x0}}},
+{0xe0f9f,{{0x0,0x0,0x0}}},
+{0xe0fa0,{{0x0,0x0,0x0}}},
+{0xe0fa1,{{0x0,0x0,0x0}}},
+{0xe0fa2,{{0x0,0x0,0x0}}},
+{0xe0fa3,{{0x0,0x0,0x0}}},
+{0xe0fa4,{{0x0,0x0,0x0}}},
+{0xe0fa5,{{0x0,0x0,0x0}}},
+{0xe0fa6,{{0x0,0x0,0x0}}},
+{0xe0fa7,{{0x0,0x0,0x0}}},
+{0xe0fa8,{{0x0,0x0,0x0}}},
+{0xe0fa9,{{0x0,0x0,0x0}}},
+{0xe0faa,{{0x0,0x0,0x0}}},
+{0xe0fab,{{0x0,0x0,0x0}}},
+{0xe0fac,{{0x0,0x0,0x0}}},
+{0xe0fad,{{0x0,0x0,0x0}}},
+{0xe0fae,{{0x0,0x0,0x0}}},
+{0xe0faf,{{0x0,0x0,0x0}}},
+{0xe0fb0,{{0x0,0x0,0x0}}},
+{0xe0fb1,{{0x0,0x0,0x0}}},
+{0xe0fb2,{{0x0,0x0,0x0}}},
+{0xe0fb3,{{0x0,0x0,0x0}}},
+{0xe0fb4,{{0x0,0x0,0x0}}},
+{0xe0fb5,{{0x0,0x0,0x0}}},
+{0xe0fb6,{{0x0,0x0,0x0}}},
+{0xe0fb7,{{0x0,0x0,0x0}}},
+{0xe0fb8,{{0x0,0x0,0x0}}},
+{0xe0fb9,{{0x0,0x0,0x0}}},
+{0xe0fba,{{0x0,0x0,0x0}}},
+{0xe0fbb,{{0x0,0x0,0x0}}},
+{0xe0fbc,{{0x0,0x0,0x0}}},
+{0xe0fbd,{{0x0,0x0,0x0}}},
+{0xe0fbe,{{0x0,0x0,0x0}}},
+{0xe0fbf,{{0x0,0x0,0x0}}},
+{0xe0fc0,{{0x0,0x0,0x0}}},
+{0xe0fc1,{{0x0,0x0,0x0}}},
+{0xe0fc2,{{0x0,0x0,0x0}}},
+{0xe0fc3,{{0x0,0x0,0x0}}},
+{0xe0fc4,{{0x0,0x0,0x0}}},
+{0xe0fc5,{{0x0,0x0,0x0}}},
+{0xe0fc6,{{0x0,0x0,0x0}}},
+{0xe0fc7,{{0x0,0x0,0x0}}},
+{0xe0fc8,{{0x0,0x0,0x0}}},
+{0xe0fc9,{{0x0,0x0,0x0}}},
+{0xe0fca,{{0x0,0x0,0x0}}},
+{0xe0fcb,{{0x0,0x0,0x0}}},
+{0xe0fcc,{{0x0,0x0,0x0}}},
+{0xe0fcd,{{0x0,0x0,0x0}}},
+{0xe0fce,{{0x0,0x0,0x0}}},
+{0xe0fcf,{{0x0,0x0,0x0}}},
+{0xe0fd0,{{0x0,0x0,0x0}}},
+{0xe0fd1,{{0x0,0x0,0x0}}},
+{0xe0fd2,{{0x0,0x0,0x0}}},
+{0xe0fd3,{{0x0,0x0,0x0}}},
+{0xe0fd4,{{0x0,0x0,0x0}}},
+{0xe0fd5,{{0x0,0x0,0x0}}},
+{0xe0fd6,{{0x0,0x0,0x0}}},
+{0xe0fd7,{{0x0,0x0,0x0}}},
+{0xe0fd8,{{0x0,0x0,0x0}}},
+{0xe0fd9,{{0x0,0x0,0x0}}},
+{0xe0fda,{{0x0,0x0,0x0}}},
+{0xe0fdb,{{0x0,0x0,0x0}}},
+{0xe0fdc,{{0x0,0x0,0x0}}},
+{0xe0fdd,{{0x0,0x0,0x0}}},
+{0xe0fde,{{0x0,0x0,0x0}}},
+{0xe0fdf,{{0x0,0x0,0x0}}},
+{0xe0fe0,{{0x0,0x0,0x0}}},
+{0xe0fe1,{{0x0,0x0,0x0}}},
+{0xe0fe2,{{0x0,0x0,0x0}}},
+{0xe0fe3,{{0x0,0x0,0x0}}},
+{0xe0fe4,{{0x0,0x0,0x0}}},
+{0xe0fe5,{{0x0,0x0,0x0}}},
+{0xe0fe6,{{0x0,0x0,0x0}}},
+{0xe0fe7,{{0x0,0x0,0x0}}},
+{0xe0fe8,{{0x0,0x0,0x0}}},
+{0xe0fe9,{{0x0,0x0,0x0}}},
+{0xe0fea,{{0x0,0x0,0x0}}},
+{0xe0feb,{{0x0,0x0,0x0}}},
+{0xe0fec,{{0x0,0x0,0x0}}},
+{0xe0fed,{{0x0,0x0,0x0}}},
+{0xe0fee,{{0x0,0x0,0x0}}},
+{0xe0fef,{{0x0,0x0,0x0}}},
+{0xe0ff0,{{0x0,0x0,0x0}}},
+{0xe0ff1,{{0x0,0x0,0x0}}},
+{0xe0ff2,{{0x0,0x0,0x0}}},
+{0xe0ff3,{{0x0,0x0,0x0}}},
+{0xe0ff4,{{0x0,0x0,0x0}}},
+{0xe0ff5,{{0x0,0x0,0x0}}},
+{0xe0ff6,{{0x0,0x0,0x0}}},
+{0xe0ff7,{{0x0,0x0,0x0}}},
+{0xe0ff8,{{0x0,0x0,0x0}}},
+{0xe0ff9,{{0x0,0x0,0x0}}},
+{0xe0ffa,{{0x0,0x0,0x0}}},
+{0xe0ffb,{{0x0,0x0,0x0}}},
+{0xe0ffc,{{0x0,0x0,0x0}}},
+{0xe0ffd,{{0x0,0x0,0x0}}},
+{0xe0ffe,{{0x0,0x0,0x0}}},
+{0xe0fff,{{0x0,0x0,0x0}}},
+}};
+
+const TableView<char32_t, std::array<char32_t, 3>> short_nfkc_casefold_table {&short_nfkc_casefold_array[0], &short_nfkc_casefold_array[0] + short_nfkc_casefold_array.size()};
+
+const std::array<KeyValue<char32_t, std::array<char32_t, 18>>, 72> long_nfkc_casefold_array = {{
+{0x2057,{{0x2032,0x2032,0x2032,0x2032,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x2152,{{0x31,0x2044,0x31,0x30,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x2167,{{0x76,0x69,0x69,0x69,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x2177,{{0x76,0x69,0x69,0x69,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x247d,{{0x28,0x31,0x30,0x29,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x247e,{{0x28,0x31,0x31,0x29,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x247f,{{0x28,0x31,0x32,0x29,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x2480,{{0x28,0x31,0x33,0x29,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x2481,{{0x28,0x31,0x34,0x29,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x2482,{{0x28,0x31,0x35,0x29,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x2483,{{0x28,0x31,0x36,0x29,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x2484,{{0x28,0x31,0x37,0x29,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x2485,{{0x28,0x31,0x38,0x29,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x2486,{{0x28,0x31,0x39,0x29,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x2487,{{0x28,0x32,0x30,0x29,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x2a0c,{{0x222b,0x222b,0x222b,0x222b,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x321d,{{0x28,0xc624,0xc804,0x29,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x321e,{{0x28,0xc624,0xd6c4,0x29,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x3300,{{0x30a2,0x30d1,0x30fc,0x30c8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x3301,{{0x30a2,0x30eb,0x30d5,0x30a1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x3302,{{0x30a2,0x30f3,0x30da,0x30a2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x3304,{{0x30a4,0x30cb,0x30f3,0x30b0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x3307,{{0x30a8,0x30b9,0x30af,0x30fc,0x30c9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x3308,{{0x30a8,0x30fc,0x30ab,0x30fc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x330c,{{0x30ab,0x30e9,0x30c3,0x30c8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x330d,{{0x30ab,0x30ed,0x30ea,0x30fc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x3312,{{0x30ad,0x30e5,0x30ea,0x30fc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x3313,{{0x30ae,0x30eb,0x30c0,0x30fc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x3315,{{0x30ad,0x30ed,0x30b0,0x30e9,0x30e0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x3316,{{0x30ad,0x30ed,0x30e1,0x30fc,0x30c8,0x30eb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x3317,{{0x30ad,0x30ed,0x30ef,0x30c3,0x30c8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x3319,{{0x30b0,0x30e9,0x30e0,0x30c8,0x30f3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x331a,{{0x30af,0x30eb,0x30bc,0x30a4,0x30ed,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x331b,{{0x30af,0x30ed,0x30fc,0x30cd,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x331f,{{0x30b5,0x30a4,0x30af,0x30eb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x3320,{{0x30b5,0x30f3,0x30c1,0x30fc,0x30e0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x3321,{{0x30b7,0x30ea,0x30f3,0x30b0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x332b,{{0x30d1,0x30fc,0x30bb,0x30f3,0x30c8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x332d,{{0x30d0,0x30fc,0x30ec,0x30eb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x332e,{{0x30d4,0x30a2,0x30b9,0x30c8,0x30eb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x3332,{{0x30d5,0x30a1,0x30e9,0x30c3,0x30c9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x3333,{{0x30d5,0x30a3,0x30fc,0x30c8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x3334,{{0x30d6,0x30c3,0x30b7,0x30a7,0x30eb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x3336,{{0x30d8,0x30af,0x30bf,0x30fc,0x30eb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x333d,{{0x30dd,0x30a4,0x30f3,0x30c8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x3343,{{0x30de,0x30a4,0x30af,0x30ed,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x3347,{{0x30de,0x30f3,0x30b7,0x30e7,0x30f3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x3348,{{0x30df,0x30af,0x30ed,0x30f3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x334a,{{0x30df,0x30ea,0x30d0,0x30fc,0x30eb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x334c,{{0x30e1,0x30ac,0x30c8,0x30f3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x334d,{{0x30e1,0x30fc,0x30c8,0x30eb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x3351,{{0x30ea,0x30c3,0x30c8,0x30eb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x3354,{{0x30eb,0x30fc,0x30d6,0x30eb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x3356,{{0x30ec,0x30f3,0x30c8,0x30b2,0x30f3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x337f,{{0x682a,0x5f0f,0x4f1a,0x793e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x3389,{{0x6b,0x63,0x61,0x6c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x33a8,{{0x6d,0x2215,0x73,0x32,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x33ae,{{0x72,0x61,0x64,0x2215,0x73,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x33af,{{0x72,0x61,0x64,0x2215,0x73,0x32,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x33c2,{{0x61,0x2e,0x6d,0x2e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x33c6,{{0x63,0x2215,0x6b,0x67,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0x33d8,{{0x70,0x2e,0x6d,0x2e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0xfdf2,{{0x627,0x644,0x644,0x647,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0xfdf3,{{0x627,0x643,0x628,0x631,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0xfdf4,{{0x645,0x62d,0x645,0x62f,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0xfdf5,{{0x635,0x644,0x639,0x645,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0xfdf6,{{0x631,0x633,0x648,0x644,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0xfdf7,{{0x639,0x644,0x64a,0x647,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0xfdf8,{{0x648,0x633,0x644,0x645,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0xfdfa,{{0x635,0x644,0x649,0x20,0x627,0x644,0x644,0x647,0x20,0x639,0x644,0x64a,0x647,0x20,0x648,0x633,0x644,0x645}}},
+{0xfdfb,{{0x62c,0x644,0x20,0x62c,0x644,0x627,0x644,0x647,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+{0xfdfc,{{0x631,0x6cc,0x627,0x644,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}}},
+}};
+
+const TableView<char32_t, std::array<char32_t, 18>> long_nfkc_casefold_table {&long_nfkc_casefold_array[0], &long_nfkc_casefold_array[0] + long_nfkc_casefold_array.size()};
+
 }
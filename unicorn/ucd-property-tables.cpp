@@ -13381,6 +13381,1928 @@ const std::array<KeyValue<char32_t, Grapheme_Cluster_Break>, 1717> grapheme_clus
 
 const TableView<char32_t, Grapheme_Cluster_Break> grapheme_cluster_break_table {&grapheme_cluster_break_array[0], &grapheme_cluster_break_array[0] + grapheme_cluster_break_array.size()};
 
+const std::array<KeyValue<char32_t, Grapheme_Class>, 1917> grapheme_class_array = {{
+{0x0,Grapheme_Class::Control},
+{0xa,Grapheme_Class::LF},
+{0xb,Grapheme_Class::Control},
+{0xd,Grapheme_Class::CR},
+{0xe,Grapheme_Class::Control},
+{0x20,static_cast<Grapheme_Class>(0)},
+{0x7f,Grapheme_Class::Control},
+{0xa0,static_cast<Grapheme_Class>(0)},
+{0xa9,Grapheme_Class::Extended_Pictographic},
+{0xaa,static_cast<Grapheme_Class>(0)},
+{0xad,Grapheme_Class::Control},
+{0xae,Grapheme_Class::Extended_Pictographic},
+{0xaf,static_cast<Grapheme_Class>(0)},
+{0x300,Grapheme_Class::InCB_Extend},
+{0x370,static_cast<Grapheme_Class>(0)},
+{0x483,Grapheme_Class::InCB_Extend},
+{0x48a,static_cast<Grapheme_Class>(0)},
+{0x591,Grapheme_Class::InCB_Extend},
+{0x5be,static_cast<Grapheme_Class>(0)},
+{0x5bf,Grapheme_Class::InCB_Extend},
+{0x5c0,static_cast<Grapheme_Class>(0)},
+{0x5c1,Grapheme_Class::InCB_Extend},
+{0x5c3,static_cast<Grapheme_Class>(0)},
+{0x5c4,Grapheme_Class::InCB_Extend},
+{0x5c6,static_cast<Grapheme_Class>(0)},
+{0x5c7,Grapheme_Class::InCB_Extend},
+{0x5c8,static_cast<Grapheme_Class>(0)},
+{0x600,Grapheme_Class::Prepend},
+{0x606,static_cast<Grapheme_Class>(0)},
+{0x610,Grapheme_Class::InCB_Extend},
+{0x61b,static_cast<Grapheme_Class>(0)},
+{0x61c,Grapheme_Class::Control},
+{0x61d,static_cast<Grapheme_Class>(0)},
+{0x64b,Grapheme_Class::InCB_Extend},
+{0x660,static_cast<Grapheme_Class>(0)},
+{0x670,Grapheme_Class::InCB_Extend},
+{0x671,static_cast<Grapheme_Class>(0)},
+{0x6d6,Grapheme_Class::InCB_Extend},
+{0x6dd,Grapheme_Class::Prepend},
+{0x6de,static_cast<Grapheme_Class>(0)},
+{0x6df,Grapheme_Class::InCB_Extend},
+{0x6e5,static_cast<Grapheme_Class>(0)},
+{0x6e7,Grapheme_Class::InCB_Extend},
+{0x6e9,static_cast<Grapheme_Class>(0)},
+{0x6ea,Grapheme_Class::InCB_Extend},
+{0x6ee,static_cast<Grapheme_Class>(0)},
+{0x70f,Grapheme_Class::Prepend},
+{0x710,static_cast<Grapheme_Class>(0)},
+{0x711,Grapheme_Class::InCB_Extend},
+{0x712,static_cast<Grapheme_Class>(0)},
+{0x730,Grapheme_Class::InCB_Extend},
+{0x74b,static_cast<Grapheme_Class>(0)},
+{0x7a6,Grapheme_Class::InCB_Extend},
+{0x7b1,static_cast<Grapheme_Class>(0)},
+{0x7eb,Grapheme_Class::InCB_Extend},
+{0x7f4,static_cast<Grapheme_Class>(0)},
+{0x7fd,Grapheme_Class::InCB_Extend},
+{0x7fe,static_cast<Grapheme_Class>(0)},
+{0x816,Grapheme_Class::InCB_Extend},
+{0x81a,static_cast<Grapheme_Class>(0)},
+{0x81b,Grapheme_Class::InCB_Extend},
+{0x824,static_cast<Grapheme_Class>(0)},
+{0x825,Grapheme_Class::InCB_Extend},
+{0x828,static_cast<Grapheme_Class>(0)},
+{0x829,Grapheme_Class::InCB_Extend},
+{0x82e,static_cast<Grapheme_Class>(0)},
+{0x859,Grapheme_Class::InCB_Extend},
+{0x85c,static_cast<Grapheme_Class>(0)},
+{0x890,Grapheme_Class::Prepend},
+{0x892,static_cast<Grapheme_Class>(0)},
+{0x897,Grapheme_Class::InCB_Extend},
+{0x8a0,static_cast<Grapheme_Class>(0)},
+{0x8ca,Grapheme_Class::InCB_Extend},
+{0x8e2,Grapheme_Class::Prepend},
+{0x8e3,Grapheme_Class::InCB_Extend},
+{0x903,Grapheme_Class::SpacingMark},
+{0x904,static_cast<Grapheme_Class>(0)},
+{0x915,Grapheme_Class::InCB_Consonant},
+{0x93a,Grapheme_Class::InCB_Extend},
+{0x93b,Grapheme_Class::SpacingMark},
+{0x93c,Grapheme_Class::InCB_Extend},
+{0x93d,static_cast<Grapheme_Class>(0)},
+{0x93e,Grapheme_Class::SpacingMark},
+{0x941,Grapheme_Class::InCB_Extend},
+{0x949,Grapheme_Class::SpacingMark},
+{0x94d,Grapheme_Class::InCB_Linker},
+{0x94e,Grapheme_Class::SpacingMark},
+{0x950,static_cast<Grapheme_Class>(0)},
+{0x951,Grapheme_Class::InCB_Extend},
+{0x958,Grapheme_Class::InCB_Consonant},
+{0x960,static_cast<Grapheme_Class>(0)},
+{0x962,Grapheme_Class::InCB_Extend},
+{0x964,static_cast<Grapheme_Class>(0)},
+{0x978,Grapheme_Class::InCB_Consonant},
+{0x980,static_cast<Grapheme_Class>(0)},
+{0x981,Grapheme_Class::InCB_Extend},
+{0x982,Grapheme_Class::SpacingMark},
+{0x984,static_cast<Grapheme_Class>(0)},
+{0x995,Grapheme_Class::InCB_Consonant},
+{0x9a9,static_cast<Grapheme_Class>(0)},
+{0x9aa,Grapheme_Class::InCB_Consonant},
+{0x9b1,static_cast<Grapheme_Class>(0)},
+{0x9b2,Grapheme_Class::InCB_Consonant},
+{0x9b3,static_cast<Grapheme_Class>(0)},
+{0x9b6,Grapheme_Class::InCB_Consonant},
+{0x9ba,static_cast<Grapheme_Class>(0)},
+{0x9bc,Grapheme_Class::InCB_Extend},
+{0x9bd,static_cast<Grapheme_Class>(0)},
+{0x9be,Grapheme_Class::InCB_Extend},
+{0x9bf,Grapheme_Class::SpacingMark},
+{0x9c1,Grapheme_Class::InCB_Extend},
+{0x9c5,static_cast<Grapheme_Class>(0)},
+{0x9c7,Grapheme_Class::SpacingMark},
+{0x9c9,static_cast<Grapheme_Class>(0)},
+{0x9cb,Grapheme_Class::SpacingMark},
+{0x9cd,Grapheme_Class::InCB_Linker},
+{0x9ce,static_cast<Grapheme_Class>(0)},
+{0x9d7,Grapheme_Class::InCB_Extend},
+{0x9d8,static_cast<Grapheme_Class>(0)},
+{0x9dc,Grapheme_Class::InCB_Consonant},
+{0x9de,static_cast<Grapheme_Class>(0)},
+{0x9df,Grapheme_Class::InCB_Consonant},
+{0x9e0,static_cast<Grapheme_Class>(0)},
+{0x9e2,Grapheme_Class::InCB_Extend},
+{0x9e4,static_cast<Grapheme_Class>(0)},
+{0x9f0,Grapheme_Class::InCB_Consonant},
+{0x9f2,static_cast<Grapheme_Class>(0)},
+{0x9fe,Grapheme_Class::InCB_Extend},
+{0x9ff,static_cast<Grapheme_Class>(0)},
+{0xa01,Grapheme_Class::InCB_Extend},
+{0xa03,Grapheme_Class::SpacingMark},
+{0xa04,static_cast<Grapheme_Class>(0)},
+{0xa3c,Grapheme_Class::InCB_Extend},
+{0xa3d,static_cast<Grapheme_Class>(0)},
+{0xa3e,Grapheme_Class::SpacingMark},
+{0xa41,Grapheme_Class::InCB_Extend},
+{0xa43,static_cast<Grapheme_Class>(0)},
+{0xa47,Grapheme_Class::InCB_Extend},
+{0xa49,static_cast<Grapheme_Class>(0)},
+{0xa4b,Grapheme_Class::InCB_Extend},
+{0xa4e,static_cast<Grapheme_Class>(0)},
+{0xa51,Grapheme_Class::InCB_Extend},
+{0xa52,static_cast<Grapheme_Class>(0)},
+{0xa70,Grapheme_Class::InCB_Extend},
+{0xa72,static_cast<Grapheme_Class>(0)},
+{0xa75,Grapheme_Class::InCB_Extend},
+{0xa76,static_cast<Grapheme_Class>(0)},
+{0xa81,Grapheme_Class::InCB_Extend},
+{0xa83,Grapheme_Class::SpacingMark},
+{0xa84,static_cast<Grapheme_Class>(0)},
+{0xa95,Grapheme_Class::InCB_Consonant},
+{0xaa9,static_cast<Grapheme_Class>(0)},
+{0xaaa,Grapheme_Class::InCB_Consonant},
+{0xab1,static_cast<Grapheme_Class>(0)},
+{0xab2,Grapheme_Class::InCB_Consonant},
+{0xab4,static_cast<Grapheme_Class>(0)},
+{0xab5,Grapheme_Class::InCB_Consonant},
+{0xaba,static_cast<Grapheme_Class>(0)},
+{0xabc,Grapheme_Class::InCB_Extend},
+{0xabd,static_cast<Grapheme_Class>(0)},
+{0xabe,Grapheme_Class::SpacingMark},
+{0xac1,Grapheme_Class::InCB_Extend},
+{0xac6,static_cast<Grapheme_Class>(0)},
+{0xac7,Grapheme_Class::InCB_Extend},
+{0xac9,Grapheme_Class::SpacingMark},
+{0xaca,static_cast<Grapheme_Class>(0)},
+{0xacb,Grapheme_Class::SpacingMark},
+{0xacd,Grapheme_Class::InCB_Linker},
+{0xace,static_cast<Grapheme_Class>(0)},
+{0xae2,Grapheme_Class::InCB_Extend},
+{0xae4,static_cast<Grapheme_Class>(0)},
+{0xaf9,Grapheme_Class::InCB_Consonant},
+{0xafa,Grapheme_Class::InCB_Extend},
+{0xb00,static_cast<Grapheme_Class>(0)},
+{0xb01,Grapheme_Class::InCB_Extend},
+{0xb02,Grapheme_Class::SpacingMark},
+{0xb04,static_cast<Grapheme_Class>(0)},
+{0xb15,Grapheme_Class::InCB_Consonant},
+{0xb29,static_cast<Grapheme_Class>(0)},
+{0xb2a,Grapheme_Class::InCB_Consonant},
+{0xb31,static_cast<Grapheme_Class>(0)},
+{0xb32,Grapheme_Class::InCB_Consonant},
+{0xb34,static_cast<Grapheme_Class>(0)},
+{0xb35,Grapheme_Class::InCB_Consonant},
+{0xb3a,static_cast<Grapheme_Class>(0)},
+{0xb3c,Grapheme_Class::InCB_Extend},
+{0xb3d,static_cast<Grapheme_Class>(0)},
+{0xb3e,Grapheme_Class::InCB_Extend},
+{0xb40,Grapheme_Class::SpacingMark},
+{0xb41,Grapheme_Class::InCB_Extend},
+{0xb45,static_cast<Grapheme_Class>(0)},
+{0xb47,Grapheme_Class::SpacingMark},
+{0xb49,static_cast<Grapheme_Class>(0)},
+{0xb4b,Grapheme_Class::SpacingMark},
+{0xb4d,Grapheme_Class::InCB_Linker},
+{0xb4e,static_cast<Grapheme_Class>(0)},
+{0xb55,Grapheme_Class::InCB_Extend},
+{0xb58,static_cast<Grapheme_Class>(0)},
+{0xb5c,Grapheme_Class::InCB_Consonant},
+{0xb5e,static_cast<Grapheme_Class>(0)},
+{0xb5f,Grapheme_Class::InCB_Consonant},
+{0xb60,static_cast<Grapheme_Class>(0)},
+{0xb62,Grapheme_Class::InCB_Extend},
+{0xb64,static_cast<Grapheme_Class>(0)},
+{0xb71,Grapheme_Class::InCB_Consonant},
+{0xb72,static_cast<Grapheme_Class>(0)},
+{0xb82,Grapheme_Class::InCB_Extend},
+{0xb83,static_cast<Grapheme_Class>(0)},
+{0xbbe,Grapheme_Class::InCB_Extend},
+{0xbbf,Grapheme_Class::SpacingMark},
+{0xbc0,Grapheme_Class::InCB_Extend},
+{0xbc1,Grapheme_Class::SpacingMark},
+{0xbc3,static_cast<Grapheme_Class>(0)},
+{0xbc6,Grapheme_Class::SpacingMark},
+{0xbc9,static_cast<Grapheme_Class>(0)},
+{0xbca,Grapheme_Class::SpacingMark},
+{0xbcd,Grapheme_Class::InCB_Extend},
+{0xbce,static_cast<Grapheme_Class>(0)},
+{0xbd7,Grapheme_Class::InCB_Extend},
+{0xbd8,static_cast<Grapheme_Class>(0)},
+{0xc00,Grapheme_Class::InCB_Extend},
+{0xc01,Grapheme_Class::SpacingMark},
+{0xc04,Grapheme_Class::InCB_Extend},
+{0xc05,static_cast<Grapheme_Class>(0)},
+{0xc15,Grapheme_Class::InCB_Consonant},
+{0xc29,static_cast<Grapheme_Class>(0)},
+{0xc2a,Grapheme_Class::InCB_Consonant},
+{0xc3a,static_cast<Grapheme_Class>(0)},
+{0xc3c,Grapheme_Class::InCB_Extend},
+{0xc3d,static_cast<Grapheme_Class>(0)},
+{0xc3e,Grapheme_Class::InCB_Extend},
+{0xc41,Grapheme_Class::SpacingMark},
+{0xc45,static_cast<Grapheme_Class>(0)},
+{0xc46,Grapheme_Class::InCB_Extend},
+{0xc49,static_cast<Grapheme_Class>(0)},
+{0xc4a,Grapheme_Class::InCB_Extend},
+{0xc4d,Grapheme_Class::InCB_Linker},
+{0xc4e,static_cast<Grapheme_Class>(0)},
+{0xc55,Grapheme_Class::InCB_Extend},
+{0xc57,static_cast<Grapheme_Class>(0)},
+{0xc58,Grapheme_Class::InCB_Consonant},
+{0xc5b,static_cast<Grapheme_Class>(0)},
+{0xc62,Grapheme_Class::InCB_Extend},
+{0xc64,static_cast<Grapheme_Class>(0)},
+{0xc81,Grapheme_Class::InCB_Extend},
+{0xc82,Grapheme_Class::SpacingMark},
+{0xc84,static_cast<Grapheme_Class>(0)},
+{0xcbc,Grapheme_Class::InCB_Extend},
+{0xcbd,static_cast<Grapheme_Class>(0)},
+{0xcbe,Grapheme_Class::SpacingMark},
+{0xcbf,Grapheme_Class::InCB_Extend},
+{0xcc1,Grapheme_Class::SpacingMark},
+{0xcc2,Grapheme_Class::InCB_Extend},
+{0xcc3,Grapheme_Class::SpacingMark},
+{0xcc5,static_cast<Grapheme_Class>(0)},
+{0xcc6,Grapheme_Class::InCB_Extend},
+{0xcc9,static_cast<Grapheme_Class>(0)},
+{0xcca,Grapheme_Class::InCB_Extend},
+{0xcce,static_cast<Grapheme_Class>(0)},
+{0xcd5,Grapheme_Class::InCB_Extend},
+{0xcd7,static_cast<Grapheme_Class>(0)},
+{0xce2,Grapheme_Class::InCB_Extend},
+{0xce4,static_cast<Grapheme_Class>(0)},
+{0xcf3,Grapheme_Class::SpacingMark},
+{0xcf4,static_cast<Grapheme_Class>(0)},
+{0xd00,Grapheme_Class::InCB_Extend},
+{0xd02,Grapheme_Class::SpacingMark},
+{0xd04,static_cast<Grapheme_Class>(0)},
+{0xd15,Grapheme_Class::InCB_Consonant},
+{0xd3b,Grapheme_Class::InCB_Extend},
+{0xd3d,static_cast<Grapheme_Class>(0)},
+{0xd3e,Grapheme_Class::InCB_Extend},
+{0xd3f,Grapheme_Class::SpacingMark},
+{0xd41,Grapheme_Class::InCB_Extend},
+{0xd45,static_cast<Grapheme_Class>(0)},
+{0xd46,Grapheme_Class::SpacingMark},
+{0xd49,static_cast<Grapheme_Class>(0)},
+{0xd4a,Grapheme_Class::SpacingMark},
+{0xd4d,Grapheme_Class::InCB_Linker},
+{0xd4e,Grapheme_Class::Prepend},
+{0xd4f,static_cast<Grapheme_Class>(0)},
+{0xd57,Grapheme_Class::InCB_Extend},
+{0xd58,static_cast<Grapheme_Class>(0)},
+{0xd62,Grapheme_Class::InCB_Extend},
+{0xd64,static_cast<Grapheme_Class>(0)},
+{0xd81,Grapheme_Class::InCB_Extend},
+{0xd82,Grapheme_Class::SpacingMark},
+{0xd84,static_cast<Grapheme_Class>(0)},
+{0xdca,Grapheme_Class::InCB_Extend},
+{0xdcb,static_cast<Grapheme_Class>(0)},
+{0xdcf,Grapheme_Class::InCB_Extend},
+{0xdd0,Grapheme_Class::SpacingMark},
+{0xdd2,Grapheme_Class::InCB_Extend},
+{0xdd5,static_cast<Grapheme_Class>(0)},
+{0xdd6,Grapheme_Class::InCB_Extend},
+{0xdd7,static_cast<Grapheme_Class>(0)},
+{0xdd8,Grapheme_Class::SpacingMark},
+{0xddf,Grapheme_Class::InCB_Extend},
+{0xde0,static_cast<Grapheme_Class>(0)},
+{0xdf2,Grapheme_Class::SpacingMark},
+{0xdf4,static_cast<Grapheme_Class>(0)},
+{0xe31,Grapheme_Class::InCB_Extend},
+{0xe32,static_cast<Grapheme_Class>(0)},
+{0xe33,Grapheme_Class::SpacingMark},
+{0xe34,Grapheme_Class::InCB_Extend},
+{0xe3b,static_cast<Grapheme_Class>(0)},
+{0xe47,Grapheme_Class::InCB_Extend},
+{0xe4f,static_cast<Grapheme_Class>(0)},
+{0xeb1,Grapheme_Class::InCB_Extend},
+{0xeb2,static_cast<Grapheme_Class>(0)},
+{0xeb3,Grapheme_Class::SpacingMark},
+{0xeb4,Grapheme_Class::InCB_Extend},
+{0xebd,static_cast<Grapheme_Class>(0)},
+{0xec8,Grapheme_Class::InCB_Extend},
+{0xecf,static_cast<Grapheme_Class>(0)},
+{0xf18,Grapheme_Class::InCB_Extend},
+{0xf1a,static_cast<Grapheme_Class>(0)},
+{0xf35,Grapheme_Class::InCB_Extend},
+{0xf36,static_cast<Grapheme_Class>(0)},
+{0xf37,Grapheme_Class::InCB_Extend},
+{0xf38,static_cast<Grapheme_Class>(0)},
+{0xf39,Grapheme_Class::InCB_Extend},
+{0xf3a,static_cast<Grapheme_Class>(0)},
+{0xf3e,Grapheme_Class::SpacingMark},
+{0xf40,static_cast<Grapheme_Class>(0)},
+{0xf71,Grapheme_Class::InCB_Extend},
+{0xf7f,Grapheme_Class::SpacingMark},
+{0xf80,Grapheme_Class::InCB_Extend},
+{0xf85,static_cast<Grapheme_Class>(0)},
+{0xf86,Grapheme_Class::InCB_Extend},
+{0xf88,static_cast<Grapheme_Class>(0)},
+{0xf8d,Grapheme_Class::InCB_Extend},
+{0xf98,static_cast<Grapheme_Class>(0)},
+{0xf99,Grapheme_Class::InCB_Extend},
+{0xfbd,static_cast<Grapheme_Class>(0)},
+{0xfc6,Grapheme_Class::InCB_Extend},
+{0xfc7,static_cast<Grapheme_Class>(0)},
+{0x102d,Grapheme_Class::InCB_Extend},
+{0x1031,Grapheme_Class::SpacingMark},
+{0x1032,Grapheme_Class::InCB_Extend},
+{0x1038,static_cast<Grapheme_Class>(0)},
+{0x1039,Grapheme_Class::InCB_Extend},
+{0x103b,Grapheme_Class::SpacingMark},
+{0x103d,Grapheme_Class::InCB_Extend},
+{0x103f,static_cast<Grapheme_Class>(0)},
+{0x1056,Grapheme_Class::SpacingMark},
+{0x1058,Grapheme_Class::InCB_Extend},
+{0x105a,static_cast<Grapheme_Class>(0)},
+{0x105e,Grapheme_Class::InCB_Extend},
+{0x1061,static_cast<Grapheme_Class>(0)},
+{0x1071,Grapheme_Class::InCB_Extend},
+{0x1075,static_cast<Grapheme_Class>(0)},
+{0x1082,Grapheme_Class::InCB_Extend},
+{0x1083,static_cast<Grapheme_Class>(0)},
+{0x1084,Grapheme_Class::SpacingMark},
+{0x1085,Grapheme_Class::InCB_Extend},
+{0x1087,static_cast<Grapheme_Class>(0)},
+{0x108d,Grapheme_Class::InCB_Extend},
+{0x108e,static_cast<Grapheme_Class>(0)},
+{0x109d,Grapheme_Class::InCB_Extend},
+{0x109e,static_cast<Grapheme_Class>(0)},
+{0x1100,Grapheme_Class::L},
+{0x1160,Grapheme_Class::V},
+{0x11a8,Grapheme_Class::T},
+{0x1200,static_cast<Grapheme_Class>(0)},
+{0x135d,Grapheme_Class::InCB_Extend},
+{0x1360,static_cast<Grapheme_Class>(0)},
+{0x1712,Grapheme_Class::InCB_Extend},
+{0x1716,static_cast<Grapheme_Class>(0)},
+{0x1732,Grapheme_Class::InCB_Extend},
+{0x1735,static_cast<Grapheme_Class>(0)},
+{0x1752,Grapheme_Class::InCB_Extend},
+{0x1754,static_cast<Grapheme_Class>(0)},
+{0x1772,Grapheme_Class::InCB_Extend},
+{0x1774,static_cast<Grapheme_Class>(0)},
+{0x17b4,Grapheme_Class::InCB_Extend},
+{0x17b6,Grapheme_Class::SpacingMark},
+{0x17b7,Grapheme_Class::InCB_Extend},
+{0x17be,Grapheme_Class::SpacingMark},
+{0x17c6,Grapheme_Class::InCB_Extend},
+{0x17c7,Grapheme_Class::SpacingMark},
+{0x17c9,Grapheme_Class::InCB_Extend},
+{0x17d4,static_cast<Grapheme_Class>(0)},
+{0x17dd,Grapheme_Class::InCB_Extend},
+{0x17de,static_cast<Grapheme_Class>(0)},
+{0x180b,Grapheme_Class::InCB_Extend},
+{0x180e,Grapheme_Class::Control},
+{0x180f,Grapheme_Class::InCB_Extend},
+{0x1810,static_cast<Grapheme_Class>(0)},
+{0x1885,Grapheme_Class::InCB_Extend},
+{0x1887,static_cast<Grapheme_Class>(0)},
+{0x18a9,Grapheme_Class::InCB_Extend},
+{0x18aa,static_cast<Grapheme_Class>(0)},
+{0x1920,Grapheme_Class::InCB_Extend},
+{0x1923,Grapheme_Class::SpacingMark},
+{0x1927,Grapheme_Class::InCB_Extend},
+{0x1929,Grapheme_Class::SpacingMark},
+{0x192c,static_cast<Grapheme_Class>(0)},
+{0x1930,Grapheme_Class::SpacingMark},
+{0x1932,Grapheme_Class::InCB_Extend},
+{0x1933,Grapheme_Class::SpacingMark},
+{0x1939,Grapheme_Class::InCB_Extend},
+{0x193c,static_cast<Grapheme_Class>(0)},
+{0x1a17,Grapheme_Class::InCB_Extend},
+{0x1a19,Grapheme_Class::SpacingMark},
+{0x1a1b,Grapheme_Class::InCB_Extend},
+{0x1a1c,static_cast<Grapheme_Class>(0)},
+{0x1a55,Grapheme_Class::SpacingMark},
+{0x1a56,Grapheme_Class::InCB_Extend},
+{0x1a57,Grapheme_Class::SpacingMark},
+{0x1a58,Grapheme_Class::InCB_Extend},
+{0x1a5f,static_cast<Grapheme_Class>(0)},
+{0x1a60,Grapheme_Class::InCB_Extend},
+{0x1a61,static_cast<Grapheme_Class>(0)},
+{0x1a62,Grapheme_Class::InCB_Extend},
+{0x1a63,static_cast<Grapheme_Class>(0)},
+{0x1a65,Grapheme_Class::InCB_Extend},
+{0x1a6d,Grapheme_Class::SpacingMark},
+{0x1a73,Grapheme_Class::InCB_Extend},
+{0x1a7d,static_cast<Grapheme_Class>(0)},
+{0x1a7f,Grapheme_Class::InCB_Extend},
+{0x1a80,static_cast<Grapheme_Class>(0)},
+{0x1ab0,Grapheme_Class::InCB_Extend},
+{0x1acf,static_cast<Grapheme_Class>(0)},
+{0x1b00,Grapheme_Class::InCB_Extend},
+{0x1b04,Grapheme_Class::SpacingMark},
+{0x1b05,static_cast<Grapheme_Class>(0)},
+{0x1b34,Grapheme_Class::InCB_Extend},
+{0x1b3e,Grapheme_Class::SpacingMark},
+{0x1b42,Grapheme_Class::InCB_Extend},
+{0x1b45,static_cast<Grapheme_Class>(0)},
+{0x1b6b,Grapheme_Class::InCB_Extend},
+{0x1b74,static_cast<Grapheme_Class>(0)},
+{0x1b80,Grapheme_Class::InCB_Extend},
+{0x1b82,Grapheme_Class::SpacingMark},
+{0x1b83,static_cast<Grapheme_Class>(0)},
+{0x1ba1,Grapheme_Class::SpacingMark},
+{0x1ba2,Grapheme_Class::InCB_Extend},
+{0x1ba6,Grapheme_Class::SpacingMark},
+{0x1ba8,Grapheme_Class::InCB_Extend},
+{0x1bae,static_cast<Grapheme_Class>(0)},
+{0x1be6,Grapheme_Class::InCB_Extend},
+{0x1be7,Grapheme_Class::SpacingMark},
+{0x1be8,Grapheme_Class::InCB_Extend},
+{0x1bea,Grapheme_Class::SpacingMark},
+{0x1bed,Grapheme_Class::InCB_Extend},
+{0x1bee,Grapheme_Class::SpacingMark},
+{0x1bef,Grapheme_Class::InCB_Extend},
+{0x1bf4,static_cast<Grapheme_Class>(0)},
+{0x1c24,Grapheme_Class::SpacingMark},
+{0x1c2c,Grapheme_Class::InCB_Extend},
+{0x1c34,Grapheme_Class::SpacingMark},
+{0x1c36,Grapheme_Class::InCB_Extend},
+{0x1c38,static_cast<Grapheme_Class>(0)},
+{0x1cd0,Grapheme_Class::InCB_Extend},
+{0x1cd3,static_cast<Grapheme_Class>(0)},
+{0x1cd4,Grapheme_Class::InCB_Extend},
+{0x1ce1,Grapheme_Class::SpacingMark},
+{0x1ce2,Grapheme_Class::InCB_Extend},
+{0x1ce9,static_cast<Grapheme_Class>(0)},
+{0x1ced,Grapheme_Class::InCB_Extend},
+{0x1cee,static_cast<Grapheme_Class>(0)},
+{0x1cf4,Grapheme_Class::InCB_Extend},
+{0x1cf5,static_cast<Grapheme_Class>(0)},
+{0x1cf7,Grapheme_Class::SpacingMark},
+{0x1cf8,Grapheme_Class::InCB_Extend},
+{0x1cfa,static_cast<Grapheme_Class>(0)},
+{0x1dc0,Grapheme_Class::InCB_Extend},
+{0x1e00,static_cast<Grapheme_Class>(0)},
+{0x200b,Grapheme_Class::Control},
+{0x200c,Grapheme_Class::Extend},
+{0x200d,Grapheme_Class::ZWJ},
+{0x200e,Grapheme_Class::Control},
+{0x2010,static_cast<Grapheme_Class>(0)},
+{0x2028,Grapheme_Class::Control},
+{0x202f,static_cast<Grapheme_Class>(0)},
+{0x203c,Grapheme_Class::Extended_Pictographic},
+{0x203d,static_cast<Grapheme_Class>(0)},
+{0x2049,Grapheme_Class::Extended_Pictographic},
+{0x204a,static_cast<Grapheme_Class>(0)},
+{0x2060,Grapheme_Class::Control},
+{0x2070,static_cast<Grapheme_Class>(0)},
+{0x20d0,Grapheme_Class::InCB_Extend},
+{0x20f1,static_cast<Grapheme_Class>(0)},
+{0x2122,Grapheme_Class::Extended_Pictographic},
+{0x2123,static_cast<Grapheme_Class>(0)},
+{0x2139,Grapheme_Class::Extended_Pictographic},
+{0x213a,static_cast<Grapheme_Class>(0)},
+{0x2194,Grapheme_Class::Extended_Pictographic},
+{0x219a,static_cast<Grapheme_Class>(0)},
+{0x21a9,Grapheme_Class::Extended_Pictographic},
+{0x21ab,static_cast<Grapheme_Class>(0)},
+{0x231a,Grapheme_Class::Extended_Pictographic},
+{0x231c,static_cast<Grapheme_Class>(0)},
+{0x2328,Grapheme_Class::Extended_Pictographic},
+{0x2329,static_cast<Grapheme_Class>(0)},
+{0x2388,Grapheme_Class::Extended_Pictographic},
+{0x2389,static_cast<Grapheme_Class>(0)},
+{0x23cf,Grapheme_Class::Extended_Pictographic},
+{0x23d0,static_cast<Grapheme_Class>(0)},
+{0x23e9,Grapheme_Class::Extended_Pictographic},
+{0x23f4,static_cast<Grapheme_Class>(0)},
+{0x23f8,Grapheme_Class::Extended_Pictographic},
+{0x23fb,static_cast<Grapheme_Class>(0)},
+{0x24c2,Grapheme_Class::Extended_Pictographic},
+{0x24c3,static_cast<Grapheme_Class>(0)},
+{0x25aa,Grapheme_Class::Extended_Pictographic},
+{0x25ac,static_cast<Grapheme_Class>(0)},
+{0x25b6,Grapheme_Class::Extended_Pictographic},
+{0x25b7,static_cast<Grapheme_Class>(0)},
+{0x25c0,Grapheme_Class::Extended_Pictographic},
+{0x25c1,static_cast<Grapheme_Class>(0)},
+{0x25fb,Grapheme_Class::Extended_Pictographic},
+{0x25ff,static_cast<Grapheme_Class>(0)},
+{0x2600,Grapheme_Class::Extended_Pictographic},
+{0x2606,static_cast<Grapheme_Class>(0)},
+{0x2607,Grapheme_Class::Extended_Pictographic},
+{0x2613,static_cast<Grapheme_Class>(0)},
+{0x2614,Grapheme_Class::Extended_Pictographic},
+{0x2686,static_cast<Grapheme_Class>(0)},
+{0x2690,Grapheme_Class::Extended_Pictographic},
+{0x2706,static_cast<Grapheme_Class>(0)},
+{0x2708,Grapheme_Class::Extended_Pictographic},
+{0x2713,static_cast<Grapheme_Class>(0)},
+{0x2714,Grapheme_Class::Extended_Pictographic},
+{0x2715,static_cast<Grapheme_Class>(0)},
+{0x2716,Grapheme_Class::Extended_Pictographic},
+{0x2717,static_cast<Grapheme_Class>(0)},
+{0x271d,Grapheme_Class::Extended_Pictographic},
+{0x271e,static_cast<Grapheme_Class>(0)},
+{0x2721,Grapheme_Class::Extended_Pictographic},
+{0x2722,static_cast<Grapheme_Class>(0)},
+{0x2728,Grapheme_Class::Extended_Pictographic},
+{0x2729,static_cast<Grapheme_Class>(0)},
+{0x2733,Grapheme_Class::Extended_Pictographic},
+{0x2735,static_cast<Grapheme_Class>(0)},
+{0x2744,Grapheme_Class::Extended_Pictographic},
+{0x2745,static_cast<Grapheme_Class>(0)},
+{0x2747,Grapheme_Class::Extended_Pictographic},
+{0x2748,static_cast<Grapheme_Class>(0)},
+{0x274c,Grapheme_Class::Extended_Pictographic},
+{0x274d,static_cast<Grapheme_Class>(0)},
+{0x274e,Grapheme_Class::Extended_Pictographic},
+{0x274f,static_cast<Grapheme_Class>(0)},
+{0x2753,Grapheme_Class::Extended_Pictographic},
+{0x2756,static_cast<Grapheme_Class>(0)},
+{0x2757,Grapheme_Class::Extended_Pictographic},
+{0x2758,static_cast<Grapheme_Class>(0)},
+{0x2763,Grapheme_Class::Extended_Pictographic},
+{0x2768,static_cast<Grapheme_Class>(0)},
+{0x2795,Grapheme_Class::Extended_Pictographic},
+{0x2798,static_cast<Grapheme_Class>(0)},
+{0x27a1,Grapheme_Class::Extended_Pictographic},
+{0x27a2,static_cast<Grapheme_Class>(0)},
+{0x27b0,Grapheme_Class::Extended_Pictographic},
+{0x27b1,static_cast<Grapheme_Class>(0)},
+{0x27bf,Grapheme_Class::Extended_Pictographic},
+{0x27c0,static_cast<Grapheme_Class>(0)},
+{0x2934,Grapheme_Class::Extended_Pictographic},
+{0x2936,static_cast<Grapheme_Class>(0)},
+{0x2b05,Grapheme_Class::Extended_Pictographic},
+{0x2b08,static_cast<Grapheme_Class>(0)},
+{0x2b1b,Grapheme_Class::Extended_Pictographic},
+{0x2b1d,static_cast<Grapheme_Class>(0)},
+{0x2b50,Grapheme_Class::Extended_Pictographic},
+{0x2b51,static_cast<Grapheme_Class>(0)},
+{0x2b55,Grapheme_Class::Extended_Pictographic},
+{0x2b56,static_cast<Grapheme_Class>(0)},
+{0x2cef,Grapheme_Class::InCB_Extend},
+{0x2cf2,static_cast<Grapheme_Class>(0)},
+{0x2d7f,Grapheme_Class::InCB_Extend},
+{0x2d80,static_cast<Grapheme_Class>(0)},
+{0x2de0,Grapheme_Class::InCB_Extend},
+{0x2e00,static_cast<Grapheme_Class>(0)},
+{0x302a,Grapheme_Class::InCB_Extend},
+{0x3030,Grapheme_Class::Extended_Pictographic},
+{0x3031,static_cast<Grapheme_Class>(0)},
+{0x303d,Grapheme_Class::Extended_Pictographic},
+{0x303e,static_cast<Grapheme_Class>(0)},
+{0x3099,Grapheme_Class::InCB_Extend},
+{0x309b,static_cast<Grapheme_Class>(0)},
+{0x3297,Grapheme_Class::Extended_Pictographic},
+{0x3298,static_cast<Grapheme_Class>(0)},
+{0x3299,Grapheme_Class::Extended_Pictographic},
+{0x329a,static_cast<Grapheme_Class>(0)},
+{0xa66f,Grapheme_Class::InCB_Extend},
+{0xa673,static_cast<Grapheme_Class>(0)},
+{0xa674,Grapheme_Class::InCB_Extend},
+{0xa67e,static_cast<Grapheme_Class>(0)},
+{0xa69e,Grapheme_Class::InCB_Extend},
+{0xa6a0,static_cast<Grapheme_Class>(0)},
+{0xa6f0,Grapheme_Class::InCB_Extend},
+{0xa6f2,static_cast<Grapheme_Class>(0)},
+{0xa802,Grapheme_Class::InCB_Extend},
+{0xa803,static_cast<Grapheme_Class>(0)},
+{0xa806,Grapheme_Class::InCB_Extend},
+{0xa807,static_cast<Grapheme_Class>(0)},
+{0xa80b,Grapheme_Class::InCB_Extend},
+{0xa80c,static_cast<Grapheme_Class>(0)},
+{0xa823,Grapheme_Class::SpacingMark},
+{0xa825,Grapheme_Class::InCB_Extend},
+{0xa827,Grapheme_Class::SpacingMark},
+{0xa828,static_cast<Grapheme_Class>(0)},
+{0xa82c,Grapheme_Class::InCB_Extend},
+{0xa82d,static_cast<Grapheme_Class>(0)},
+{0xa880,Grapheme_Class::SpacingMark},
+{0xa882,static_cast<Grapheme_Class>(0)},
+{0xa8b4,Grapheme_Class::SpacingMark},
+{0xa8c4,Grapheme_Class::InCB_Extend},
+{0xa8c6,static_cast<Grapheme_Class>(0)},
+{0xa8e0,Grapheme_Class::InCB_Extend},
+{0xa8f2,static_cast<Grapheme_Class>(0)},
+{0xa8ff,Grapheme_Class::InCB_Extend},
+{0xa900,static_cast<Grapheme_Class>(0)},
+{0xa926,Grapheme_Class::InCB_Extend},
+{0xa92e,static_cast<Grapheme_Class>(0)},
+{0xa947,Grapheme_Class::InCB_Extend},
+{0xa952,Grapheme_Class::SpacingMark},
+{0xa953,Grapheme_Class::InCB_Extend},
+{0xa954,static_cast<Grapheme_Class>(0)},
+{0xa960,Grapheme_Class::L},
+{0xa97d,static_cast<Grapheme_Class>(0)},
+{0xa980,Grapheme_Class::InCB_Extend},
+{0xa983,Grapheme_Class::SpacingMark},
+{0xa984,static_cast<Grapheme_Class>(0)},
+{0xa9b3,Grapheme_Class::InCB_Extend},
+{0xa9b4,Grapheme_Class::SpacingMark},
+{0xa9b6,Grapheme_Class::InCB_Extend},
+{0xa9ba,Grapheme_Class::SpacingMark},
+{0xa9bc,Grapheme_Class::InCB_Extend},
+{0xa9be,Grapheme_Class::SpacingMark},
+{0xa9c0,Grapheme_Class::InCB_Extend},
+{0xa9c1,static_cast<Grapheme_Class>(0)},
+{0xa9e5,Grapheme_Class::InCB_Extend},
+{0xa9e6,static_cast<Grapheme_Class>(0)},
+{0xaa29,Grapheme_Class::InCB_Extend},
+{0xaa2f,Grapheme_Class::SpacingMark},
+{0xaa31,Grapheme_Class::InCB_Extend},
+{0xaa33,Grapheme_Class::SpacingMark},
+{0xaa35,Grapheme_Class::InCB_Extend},
+{0xaa37,static_cast<Grapheme_Class>(0)},
+{0xaa43,Grapheme_Class::InCB_Extend},
+{0xaa44,static_cast<Grapheme_Class>(0)},
+{0xaa4c,Grapheme_Class::InCB_Extend},
+{0xaa4d,Grapheme_Class::SpacingMark},
+{0xaa4e,static_cast<Grapheme_Class>(0)},
+{0xaa7c,Grapheme_Class::InCB_Extend},
+{0xaa7d,static_cast<Grapheme_Class>(0)},
+{0xaab0,Grapheme_Class::InCB_Extend},
+{0xaab1,static_cast<Grapheme_Class>(0)},
+{0xaab2,Grapheme_Class::InCB_Extend},
+{0xaab5,static_cast<Grapheme_Class>(0)},
+{0xaab7,Grapheme_Class::InCB_Extend},
+{0xaab9,static_cast<Grapheme_Class>(0)},
+{0xaabe,Grapheme_Class::InCB_Extend},
+{0xaac0,static_cast<Grapheme_Class>(0)},
+{0xaac1,Grapheme_Class::InCB_Extend},
+{0xaac2,static_cast<Grapheme_Class>(0)},
+{0xaaeb,Grapheme_Class::SpacingMark},
+{0xaaec,Grapheme_Class::InCB_Extend},
+{0xaaee,Grapheme_Class::SpacingMark},
+{0xaaf0,static_cast<Grapheme_Class>(0)},
+{0xaaf5,Grapheme_Class::SpacingMark},
+{0xaaf6,Grapheme_Class::InCB_Extend},
+{0xaaf7,static_cast<Grapheme_Class>(0)},
+{0xabe3,Grapheme_Class::SpacingMark},
+{0xabe5,Grapheme_Class::InCB_Extend},
+{0xabe6,Grapheme_Class::SpacingMark},
+{0xabe8,Grapheme_Class::InCB_Extend},
+{0xabe9,Grapheme_Class::SpacingMark},
+{0xabeb,static_cast<Grapheme_Class>(0)},
+{0xabec,Grapheme_Class::SpacingMark},
+{0xabed,Grapheme_Class::InCB_Extend},
+{0xabee,static_cast<Grapheme_Class>(0)},
+{0xac00,Grapheme_Class::LV},
+{0xac01,Grapheme_Class::LVT},
+{0xac1c,Grapheme_Class::LV},
+{0xac1d,Grapheme_Class::LVT},
+{0xac38,Grapheme_Class::LV},
+{0xac39,Grapheme_Class::LVT},
+{0xac54,Grapheme_Class::LV},
+{0xac55,Grapheme_Class::LVT},
+{0xac70,Grapheme_Class::LV},
+{0xac71,Grapheme_Class::LVT},
+{0xac8c,Grapheme_Class::LV},
+{0xac8d,Grapheme_Class::LVT},
+{0xaca8,Grapheme_Class::LV},
+{0xaca9,Grapheme_Class::LVT},
+{0xacc4,Grapheme_Class::LV},
+{0xacc5,Grapheme_Class::LVT},
+{0xace0,Grapheme_Class::LV},
+{0xace1,Grapheme_Class::LVT},
+{0xacfc,Grapheme_Class::LV},
+{0xacfd,Grapheme_Class::LVT},
+{0xad18,Grapheme_Class::LV},
+{0xad19,Grapheme_Class::LVT},
+{0xad34,Grapheme_Class::LV},
+{0xad35,Grapheme_Class::LVT},
+{0xad50,Grapheme_Class::LV},
+{0xad51,Grapheme_Class::LVT},
+{0xad6c,Grapheme_Class::LV},
+{0xad6d,Grapheme_Class::LVT},
+{0xad88,Grapheme_Class::LV},
+{0xad89,Grapheme_Class::LVT},
+{0xada4,Grapheme_Class::LV},
+{0xada5,Grapheme_Class::LVT},
+{0xadc0,Grapheme_Class::LV},
+{0xadc1,Grapheme_Class::LVT},
+{0xaddc,Grapheme_Class::LV},
+{0xaddd,Grapheme_Class::LVT},
+{0xadf8,Grapheme_Class::LV},
+{0xadf9,Grapheme_Class::LVT},
+{0xae14,Grapheme_Class::LV},
+{0xae15,Grapheme_Class::LVT},
+{0xae30,Grapheme_Class::LV},
+{0xae31,Grapheme_Class::LVT},
+{0xae4c,Grapheme_Class::LV},
+{0xae4d,Grapheme_Class::LVT},
+{0xae68,Grapheme_Class::LV},
+{0xae69,Grapheme_Class::LVT},
+{0xae84,Grapheme_Class::LV},
+{0xae85,Grapheme_Class::LVT},
+{0xaea0,Grapheme_Class::LV},
+{0xaea1,Grapheme_Class::LVT},
+{0xaebc,Grapheme_Class::LV},
+{0xaebd,Grapheme_Class::LVT},
+{0xaed8,Grapheme_Class::LV},
+{0xaed9,Grapheme_Class::LVT},
+{0xaef4,Grapheme_Class::LV},
+{0xaef5,Grapheme_Class::LVT},
+{0xaf10,Grapheme_Class::LV},
+{0xaf11,Grapheme_Class::LVT},
+{0xaf2c,Grapheme_Class::LV},
+{0xaf2d,Grapheme_Class::LVT},
+{0xaf48,Grapheme_Class::LV},
+{0xaf49,Grapheme_Class::LVT},
+{0xaf64,Grapheme_Class::LV},
+{0xaf65,Grapheme_Class::LVT},
+{0xaf80,Grapheme_Class::LV},
+{0xaf81,Grapheme_Class::LVT},
+{0xaf9c,Grapheme_Class::LV},
+{0xaf9d,Grapheme_Class::LVT},
+{0xafb8,Grapheme_Class::LV},
+{0xafb9,Grapheme_Class::LVT},
+{0xafd4,Grapheme_Class::LV},
+{0xafd5,Grapheme_Class::LVT},
+{0xaff0,Grapheme_Class::LV},
+{0xaff1,Grapheme_Class::LVT},
+{0xb00c,Grapheme_Class::LV},
+{0xb00d,Grapheme_Class::LVT},
+{0xb028,Grapheme_Class::LV},
+{0xb029,Grapheme_Class::LVT},
+{0xb044,Grapheme_Class::LV},
+{0xb045,Grapheme_Class::LVT},
+{0xb060,Grapheme_Class::LV},
+{0xb061,Grapheme_Class::LVT},
+{0xb07c,Grapheme_Class::LV},
+{0xb07d,Grapheme_Class::LVT},
+{0xb098,Grapheme_Class::LV},
+{0xb099,Grapheme_Class::LVT},
+{0xb0b4,Grapheme_Class::LV},
+{0xb0b5,Grapheme_Class::LVT},
+{0xb0d0,Grapheme_Class::LV},
+{0xb0d1,Grapheme_Class::LVT},
+{0xb0ec,Grapheme_Class::LV},
+{0xb0ed,Grapheme_Class::LVT},
+{0xb108,Grapheme_Class::LV},
+{0xb109,Grapheme_Class::LVT},
+{0xb124,Grapheme_Class::LV},
+{0xb125,Grapheme_Class::LVT},
+{0xb140,Grapheme_Class::LV},
+{0xb141,Grapheme_Class::LVT},
+{0xb15c,Grapheme_Class::LV},
+{0xb15d,Grapheme_Class::LVT},
+{0xb178,Grapheme_Class::LV},
+{0xb179,Grapheme_Class::LVT},
+{0xb194,Grapheme_Class::LV},
+{0xb195,Grapheme_Class::LVT},
+{0xb1b0,Grapheme_Class::LV},
+{0xb1b1,Grapheme_Class::LVT},
+{0xb1cc,Grapheme_Class::LV},
+{0xb1cd,Grapheme_Class::LVT},
+{0xb1e8,Grapheme_Class::LV},
+{0xb1e9,Grapheme_Class::LVT},
+{0xb204,Grapheme_Class::LV},
+{0xb205,Grapheme_Class::LVT},
+{0xb220,Grapheme_Class::LV},
+{0xb221,Grapheme_Class::LVT},
+{0xb23c,Grapheme_Class::LV},
+{0xb23d,Grapheme_Class::LVT},
+{0xb258,Grapheme_Class::LV},
+{0xb259,Grapheme_Class::LVT},
+{0xb274,Grapheme_Class::LV},
+{0xb275,Grapheme_Class::LVT},
+{0xb290,Grapheme_Class::LV},
+{0xb291,Grapheme_Class::LVT},
+{0xb2ac,Grapheme_Class::LV},
+{0xb2ad,Grapheme_Class::LVT},
+{0xb2c8,Grapheme_Class::LV},
+{0xb2c9,Grapheme_Class::LVT},
+{0xb2e4,Grapheme_Class::LV},
+{0xb2e5,Grapheme_Class::LVT},
+{0xb300,Grapheme_Class::LV},
+{0xb301,Grapheme_Class::LVT},
+{0xb31c,Grapheme_Class::LV},
+{0xb31d,Grapheme_Class::LVT},
+{0xb338,Grapheme_Class::LV},
+{0xb339,Grapheme_Class::LVT},
+{0xb354,Grapheme_Class::LV},
+{0xb355,Grapheme_Class::LVT},
+{0xb370,Grapheme_Class::LV},
+{0xb371,Grapheme_Class::LVT},
+{0xb38c,Grapheme_Class::LV},
+{0xb38d,Grapheme_Class::LVT},
+{0xb3a8,Grapheme_Class::LV},
+{0xb3a9,Grapheme_Class::LVT},
+{0xb3c4,Grapheme_Class::LV},
+{0xb3c5,Grapheme_Class::LVT},
+{0xb3e0,Grapheme_Class::LV},
+{0xb3e1,Grapheme_Class::LVT},
+{0xb3fc,Grapheme_Class::LV},
+{0xb3fd,Grapheme_Class::LVT},
+{0xb418,Grapheme_Class::LV},
+{0xb419,Grapheme_Class::LVT},
+{0xb434,Grapheme_Class::LV},
+{0xb435,Grapheme_Class::LVT},
+{0xb450,Grapheme_Class::LV},
+{0xb451,Grapheme_Class::LVT},
+{0xb46c,Grapheme_Class::LV},
+{0xb46d,Grapheme_Class::LVT},
+{0xb488,Grapheme_Class::LV},
+{0xb489,Grapheme_Class::LVT},
+{0xb4a4,Grapheme_Class::LV},
+{0xb4a5,Grapheme_Class::LVT},
+{0xb4c0,Grapheme_Class::LV},
+{0xb4c1,Grapheme_Class::LVT},
+{0xb4dc,Grapheme_Class::LV},
+{0xb4dd,Grapheme_Class::LVT},
+{0xb4f8,Grapheme_Class::LV},
+{0xb4f9,Grapheme_Class::LVT},
+{0xb514,Grapheme_Class::LV},
+{0xb515,Grapheme_Class::LVT},
+{0xb530,Grapheme_Class::LV},
+{0xb531,Grapheme_Class::LVT},
+{0xb54c,Grapheme_Class::LV},
+{0xb54d,Grapheme_Class::LVT},
+{0xb568,Grapheme_Class::LV},
+{0xb569,Grapheme_Class::LVT},
+{0xb584,Grapheme_Class::LV},
+{0xb585,Grapheme_Class::LVT},
+{0xb5a0,Grapheme_Class::LV},
+{0xb5a1,Grapheme_Class::LVT},
+{0xb5bc,Grapheme_Class::LV},
+{0xb5bd,Grapheme_Class::LVT},
+{0xb5d8,Grapheme_Class::LV},
+{0xb5d9,Grapheme_Class::LVT},
+{0xb5f4,Grapheme_Class::LV},
+{0xb5f5,Grapheme_Class::LVT},
+{0xb610,Grapheme_Class::LV},
+{0xb611,Grapheme_Class::LVT},
+{0xb62c,Grapheme_Class::LV},
+{0xb62d,Grapheme_Class::LVT},
+{0xb648,Grapheme_Class::LV},
+{0xb649,Grapheme_Class::LVT},
+{0xb664,Grapheme_Class::LV},
+{0xb665,Grapheme_Class::LVT},
+{0xb680,Grapheme_Class::LV},
+{0xb681,Grapheme_Class::LVT},
+{0xb69c,Grapheme_Class::LV},
+{0xb69d,Grapheme_Class::LVT},
+{0xb6b8,Grapheme_Class::LV},
+{0xb6b9,Grapheme_Class::LVT},
+{0xb6d4,Grapheme_Class::LV},
+{0xb6d5,Grapheme_Class::LVT},
+{0xb6f0,Grapheme_Class::LV},
+{0xb6f1,Grapheme_Class::LVT},
+{0xb70c,Grapheme_Class::LV},
+{0xb70d,Grapheme_Class::LVT},
+{0xb728,Grapheme_Class::LV},
+{0xb729,Grapheme_Class::LVT},
+{0xb744,Grapheme_Class::LV},
+{0xb745,Grapheme_Class::LVT},
+{0xb760,Grapheme_Class::LV},
+{0xb761,Grapheme_Class::LVT},
+{0xb77c,Grapheme_Class::LV},
+{0xb77d,Grapheme_Class::LVT},
+{0xb798,Grapheme_Class::LV},
+{0xb799,Grapheme_Class::LVT},
+{0xb7b4,Grapheme_Class::LV},
+{0xb7b5,Grapheme_Class::LVT},
+{0xb7d0,Grapheme_Class::LV},
+{0xb7d1,Grapheme_Class::LVT},
+{0xb7ec,Grapheme_Class::LV},
+{0xb7ed,Grapheme_Class::LVT},
+{0xb808,Grapheme_Class::LV},
+{0xb809,Grapheme_Class::LVT},
+{0xb824,Grapheme_Class::LV},
+{0xb825,Grapheme_Class::LVT},
+{0xb840,Grapheme_Class::LV},
+{0xb841,Grapheme_Class::LVT},
+{0xb85c,Grapheme_Class::LV},
+{0xb85d,Grapheme_Class::LVT},
+{0xb878,Grapheme_Class::LV},
+{0xb879,Grapheme_Class::LVT},
+{0xb894,Grapheme_Class::LV},
+{0xb895,Grapheme_Class::LVT},
+{0xb8b0,Grapheme_Class::LV},
+{0xb8b1,Grapheme_Class::LVT},
+{0xb8cc,Grapheme_Class::LV},
+{0xb8cd,Grapheme_Class::LVT},
+{0xb8e8,Grapheme_Class::LV},
+{0xb8e9,Grapheme_Class::LVT},
+{0xb904,Grapheme_Class::LV},
+{0xb905,Grapheme_Class::LVT},
+{0xb920,Grapheme_Class::LV},
+{0xb921,Grapheme_Class::LVT},
+{0xb93c,Grapheme_Class::LV},
+{0xb93d,Grapheme_Class::LVT},
+{0xb958,Grapheme_Class::LV},
+{0xb959,Grapheme_Class::LVT},
+{0xb974,Grapheme_Class::LV},
+{0xb975,Grapheme_Class::LVT},
+{0xb990,Grapheme_Class::LV},
+{0xb991,Grapheme_Class::LVT},
+{0xb9ac,Grapheme_Class::LV},
+{0xb9ad,Grapheme_Class::LVT},
+{0xb9c8,Grapheme_Class::LV},
+{0xb9c9,Grapheme_Class::LVT},
+{0xb9e4,Grapheme_Class::LV},
+{0xb9e5,Grapheme_Class::LVT},
+{0xba00,Grapheme_Class::LV},
+{0xba01,Grapheme_Class::LVT},
+{0xba1c,Grapheme_Class::LV},
+{0xba1d,Grapheme_Class::LVT},
+{0xba38,Grapheme_Class::LV},
+{0xba39,Grapheme_Class::LVT},
+{0xba54,Grapheme_Class::LV},
+{0xba55,Grapheme_Class::LVT},
+{0xba70,Grapheme_Class::LV},
+{0xba71,Grapheme_Class::LVT},
+{0xba8c,Grapheme_Class::LV},
+{0xba8d,Grapheme_Class::LVT},
+{0xbaa8,Grapheme_Class::LV},
+{0xbaa9,Grapheme_Class::LVT},
+{0xbac4,Grapheme_Class::LV},
+{0xbac5,Grapheme_Class::LVT},
+{0xbae0,Grapheme_Class::LV},
+{0xbae1,Grapheme_Class::LVT},
+{0xbafc,Grapheme_Class::LV},
+{0xbafd,Grapheme_Class::LVT},
+{0xbb18,Grapheme_Class::LV},
+{0xbb19,Grapheme_Class::LVT},
+{0xbb34,Grapheme_Class::LV},
+{0xbb35,Grapheme_Class::LVT},
+{0xbb50,Grapheme_Class::LV},
+{0xbb51,Grapheme_Class::LVT},
+{0xbb6c,Grapheme_Class::LV},
+{0xbb6d,Grapheme_Class::LVT},
+{0xbb88,Grapheme_Class::LV},
+{0xbb89,Grapheme_Class::LVT},
+{0xbba4,Grapheme_Class::LV},
+{0xbba5,Grapheme_Class::LVT},
+{0xbbc0,Grapheme_Class::LV},
+{0xbbc1,Grapheme_Class::LVT},
+{0xbbdc,Grapheme_Class::LV},
+{0xbbdd,Grapheme_Class::LVT},
+{0xbbf8,Grapheme_Class::LV},
+{0xbbf9,Grapheme_Class::LVT},
+{0xbc14,Grapheme_Class::LV},
+{0xbc15,Grapheme_Class::LVT},
+{0xbc30,Grapheme_Class::LV},
+{0xbc31,Grapheme_Class::LVT},
+{0xbc4c,Grapheme_Class::LV},
+{0xbc4d,Grapheme_Class::LVT},
+{0xbc68,Grapheme_Class::LV},
+{0xbc69,Grapheme_Class::LVT},
+{0xbc84,Grapheme_Class::LV},
+{0xbc85,Grapheme_Class::LVT},
+{0xbca0,Grapheme_Class::LV},
+{0xbca1,Grapheme_Class::LVT},
+{0xbcbc,Grapheme_Class::LV},
+{0xbcbd,Grapheme_Class::LVT},
+{0xbcd8,Grapheme_Class::LV},
+{0xbcd9,Grapheme_Class::LVT},
+{0xbcf4,Grapheme_Class::LV},
+{0xbcf5,Grapheme_Class::LVT},
+{0xbd10,Grapheme_Class::LV},
+{0xbd11,Grapheme_Class::LVT},
+{0xbd2c,Grapheme_Class::LV},
+{0xbd2d,Grapheme_Class::LVT},
+{0xbd48,Grapheme_Class::LV},
+{0xbd49,Grapheme_Class::LVT},
+{0xbd64,Grapheme_Class::LV},
+{0xbd65,Grapheme_Class::LVT},
+{0xbd80,Grapheme_Class::LV},
+{0xbd81,Grapheme_Class::LVT},
+{0xbd9c,Grapheme_Class::LV},
+{0xbd9d,Grapheme_Class::LVT},
+{0xbdb8,Grapheme_Class::LV},
+{0xbdb9,Grapheme_Class::LVT},
+{0xbdd4,Grapheme_Class::LV},
+{0xbdd5,Grapheme_Class::LVT},
+{0xbdf0,Grapheme_Class::LV},
+{0xbdf1,Grapheme_Class::LVT},
+{0xbe0c,Grapheme_Class::LV},
+{0xbe0d,Grapheme_Class::LVT},
+{0xbe28,Grapheme_Class::LV},
+{0xbe29,Grapheme_Class::LVT},
+{0xbe44,Grapheme_Class::LV},
+{0xbe45,Grapheme_Class::LVT},
+{0xbe60,Grapheme_Class::LV},
+{0xbe61,Grapheme_Class::LVT},
+{0xbe7c,Grapheme_Class::LV},
+{0xbe7d,Grapheme_Class::LVT},
+{0xbe98,Grapheme_Class::LV},
+{0xbe99,Grapheme_Class::LVT},
+{0xbeb4,Grapheme_Class::LV},
+{0xbeb5,Grapheme_Class::LVT},
+{0xbed0,Grapheme_Class::LV},
+{0xbed1,Grapheme_Class::LVT},
+{0xbeec,Grapheme_Class::LV},
+{0xbeed,Grapheme_Class::LVT},
+{0xbf08,Grapheme_Class::LV},
+{0xbf09,Grapheme_Class::LVT},
+{0xbf24,Grapheme_Class::LV},
+{0xbf25,Grapheme_Class::LVT},
+{0xbf40,Grapheme_Class::LV},
+{0xbf41,Grapheme_Class::LVT},
+{0xbf5c,Grapheme_Class::LV},
+{0xbf5d,Grapheme_Class::LVT},
+{0xbf78,Grapheme_Class::LV},
+{0xbf79,Grapheme_Class::LVT},
+{0xbf94,Grapheme_Class::LV},
+{0xbf95,Grapheme_Class::LVT},
+{0xbfb0,Grapheme_Class::LV},
+{0xbfb1,Grapheme_Class::LVT},
+{0xbfcc,Grapheme_Class::LV},
+{0xbfcd,Grapheme_Class::LVT},
+{0xbfe8,Grapheme_Class::LV},
+{0xbfe9,Grapheme_Class::LVT},
+{0xc004,Grapheme_Class::LV},
+{0xc005,Grapheme_Class::LVT},
+{0xc020,Grapheme_Class::LV},
+{0xc021,Grapheme_Class::LVT},
+{0xc03c,Grapheme_Class::LV},
+{0xc03d,Grapheme_Class::LVT},
+{0xc058,Grapheme_Class::LV},
+{0xc059,Grapheme_Class::LVT},
+{0xc074,Grapheme_Class::LV},
+{0xc075,Grapheme_Class::LVT},
+{0xc090,Grapheme_Class::LV},
+{0xc091,Grapheme_Class::LVT},
+{0xc0ac,Grapheme_Class::LV},
+{0xc0ad,Grapheme_Class::LVT},
+{0xc0c8,Grapheme_Class::LV},
+{0xc0c9,Grapheme_Class::LVT},
+{0xc0e4,Grapheme_Class::LV},
+{0xc0e5,Grapheme_Class::LVT},
+{0xc100,Grapheme_Class::LV},
+{0xc101,Grapheme_Class::LVT},
+{0xc11c,Grapheme_Class::LV},
+{0xc11d,Grapheme_Class::LVT},
+{0xc138,Grapheme_Class::LV},
+{0xc139,Grapheme_Class::LVT},
+{0xc154,Grapheme_Class::LV},
+{0xc155,Grapheme_Class::LVT},
+{0xc170,Grapheme_Class::LV},
+{0xc171,Grapheme_Class::LVT},
+{0xc18c,Grapheme_Class::LV},
+{0xc18d,Grapheme_Class::LVT},
+{0xc1a8,Grapheme_Class::LV},
+{0xc1a9,Grapheme_Class::LVT},
+{0xc1c4,Grapheme_Class::LV},
+{0xc1c5,Grapheme_Class::LVT},
+{0xc1e0,Grapheme_Class::LV},
+{0xc1e1,Grapheme_Class::LVT},
+{0xc1fc,Grapheme_Class::LV},
+{0xc1fd,Grapheme_Class::LVT},
+{0xc218,Grapheme_Class::LV},
+{0xc219,Grapheme_Class::LVT},
+{0xc234,Grapheme_Class::LV},
+{0xc235,Grapheme_Class::LVT},
+{0xc250,Grapheme_Class::LV},
+{0xc251,Grapheme_Class::LVT},
+{0xc26c,Grapheme_Class::LV},
+{0xc26d,Grapheme_Class::LVT},
+{0xc288,Grapheme_Class::LV},
+{0xc289,Grapheme_Class::LVT},
+{0xc2a4,Grapheme_Class::LV},
+{0xc2a5,Grapheme_Class::LVT},
+{0xc2c0,Grapheme_Class::LV},
+{0xc2c1,Grapheme_Class::LVT},
+{0xc2dc,Grapheme_Class::LV},
+{0xc2dd,Grapheme_Class::LVT},
+{0xc2f8,Grapheme_Class::LV},
+{0xc2f9,Grapheme_Class::LVT},
+{0xc314,Grapheme_Class::LV},
+{0xc315,Grapheme_Class::LVT},
+{0xc330,Grapheme_Class::LV},
+{0xc331,Grapheme_Class::LVT},
+{0xc34c,Grapheme_Class::LV},
+{0xc34d,Grapheme_Class::LVT},
+{0xc368,Grapheme_Class::LV},
+{0xc369,Grapheme_Class::LVT},
+{0xc384,Grapheme_Class::LV},
+{0xc385,Grapheme_Class::LVT},
+{0xc3a0,Grapheme_Class::LV},
+{0xc3a1,Grapheme_Class::LVT},
+{0xc3bc,Grapheme_Class::LV},
+{0xc3bd,Grapheme_Class::LVT},
+{0xc3d8,Grapheme_Class::LV},
+{0xc3d9,Grapheme_Class::LVT},
+{0xc3f4,Grapheme_Class::LV},
+{0xc3f5,Grapheme_Class::LVT},
+{0xc410,Grapheme_Class::LV},
+{0xc411,Grapheme_Class::LVT},
+{0xc42c,Grapheme_Class::LV},
+{0xc42d,Grapheme_Class::LVT},
+{0xc448,Grapheme_Class::LV},
+{0xc449,Grapheme_Class::LVT},
+{0xc464,Grapheme_Class::LV},
+{0xc465,Grapheme_Class::LVT},
+{0xc480,Grapheme_Class::LV},
+{0xc481,Grapheme_Class::LVT},
+{0xc49c,Grapheme_Class::LV},
+{0xc49d,Grapheme_Class::LVT},
+{0xc4b8,Grapheme_Class::LV},
+{0xc4b9,Grapheme_Class::LVT},
+{0xc4d4,Grapheme_Class::LV},
+{0xc4d5,Grapheme_Class::LVT},
+{0xc4f0,Grapheme_Class::LV},
+{0xc4f1,Grapheme_Class::LVT},
+{0xc50c,Grapheme_Class::LV},
+{0xc50d,Grapheme_Class::LVT},
+{0xc528,Grapheme_Class::LV},
+{0xc529,Grapheme_Class::LVT},
+{0xc544,Grapheme_Class::LV},
+{0xc545,Grapheme_Class::LVT},
+{0xc560,Grapheme_Class::LV},
+{0xc561,Grapheme_Class::LVT},
+{0xc57c,Grapheme_Class::LV},
+{0xc57d,Grapheme_Class::LVT},
+{0xc598,Grapheme_Class::LV},
+{0xc599,Grapheme_Class::LVT},
+{0xc5b4,Grapheme_Class::LV},
+{0xc5b5,Grapheme_Class::LVT},
+{0xc5d0,Grapheme_Class::LV},
+{0xc5d1,Grapheme_Class::LVT},
+{0xc5ec,Grapheme_Class::LV},
+{0xc5ed,Grapheme_Class::LVT},
+{0xc608,Grapheme_Class::LV},
+{0xc609,Grapheme_Class::LVT},
+{0xc624,Grapheme_Class::LV},
+{0xc625,Grapheme_Class::LVT},
+{0xc640,Grapheme_Class::LV},
+{0xc641,Grapheme_Class::LVT},
+{0xc65c,Grapheme_Class::LV},
+{0xc65d,Grapheme_Class::LVT},
+{0xc678,Grapheme_Class::LV},
+{0xc679,Grapheme_Class::LVT},
+{0xc694,Grapheme_Class::LV},
+{0xc695,Grapheme_Class::LVT},
+{0xc6b0,Grapheme_Class::LV},
+{0xc6b1,Grapheme_Class::LVT},
+{0xc6cc,Grapheme_Class::LV},
+{0xc6cd,Grapheme_Class::LVT},
+{0xc6e8,Grapheme_Class::LV},
+{0xc6e9,Grapheme_Class::LVT},
+{0xc704,Grapheme_Class::LV},
+{0xc705,Grapheme_Class::LVT},
+{0xc720,Grapheme_Class::LV},
+{0xc721,Grapheme_Class::LVT},
+{0xc73c,Grapheme_Class::LV},
+{0xc73d,Grapheme_Class::LVT},
+{0xc758,Grapheme_Class::LV},
+{0xc759,Grapheme_Class::LVT},
+{0xc774,Grapheme_Class::LV},
+{0xc775,Grapheme_Class::LVT},
+{0xc790,Grapheme_Class::LV},
+{0xc791,Grapheme_Class::LVT},
+{0xc7ac,Grapheme_Class::LV},
+{0xc7ad,Grapheme_Class::LVT},
+{0xc7c8,Grapheme_Class::LV},
+{0xc7c9,Grapheme_Class::LVT},
+{0xc7e4,Grapheme_Class::LV},
+{0xc7e5,Grapheme_Class::LVT},
+{0xc800,Grapheme_Class::LV},
+{0xc801,Grapheme_Class::LVT},
+{0xc81c,Grapheme_Class::LV},
+{0xc81d,Grapheme_Class::LVT},
+{0xc838,Grapheme_Class::LV},
+{0xc839,Grapheme_Class::LVT},
+{0xc854,Grapheme_Class::LV},
+{0xc855,Grapheme_Class::LVT},
+{0xc870,Grapheme_Class::LV},
+{0xc871,Grapheme_Class::LVT},
+{0xc88c,Grapheme_Class::LV},
+{0xc88d,Grapheme_Class::LVT},
+{0xc8a8,Grapheme_Class::LV},
+{0xc8a9,Grapheme_Class::LVT},
+{0xc8c4,Grapheme_Class::LV},
+{0xc8c5,Grapheme_Class::LVT},
+{0xc8e0,Grapheme_Class::LV},
+{0xc8e1,Grapheme_Class::LVT},
+{0xc8fc,Grapheme_Class::LV},
+{0xc8fd,Grapheme_Class::LVT},
+{0xc918,Grapheme_Class::LV},
+{0xc919,Grapheme_Class::LVT},
+{0xc934,Grapheme_Class::LV},
+{0xc935,Grapheme_Class::LVT},
+{0xc950,Grapheme_Class::LV},
+{0xc951,Grapheme_Class::LVT},
+{0xc96c,Grapheme_Class::LV},
+{0xc96d,Grapheme_Class::LVT},
+{0xc988,Grapheme_Class::LV},
+{0xc989,Grapheme_Class::LVT},
+{0xc9a4,Grapheme_Class::LV},
+{0xc9a5,Grapheme_Class::LVT},
+{0xc9c0,Grapheme_Class::LV},
+{0xc9c1,Grapheme_Class::LVT},
+{0xc9dc,Grapheme_Class::LV},
+{0xc9dd,Grapheme_Class::LVT},
+{0xc9f8,Grapheme_Class::LV},
+{0xc9f9,Grapheme_Class::LVT},
+{0xca14,Grapheme_Class::LV},
+{0xca15,Grapheme_Class::LVT},
+{0xca30,Grapheme_Class::LV},
+{0xca31,Grapheme_Class::LVT},
+{0xca4c,Grapheme_Class::LV},
+{0xca4d,Grapheme_Class::LVT},
+{0xca68,Grapheme_Class::LV},
+{0xca69,Grapheme_Class::LVT},
+{0xca84,Grapheme_Class::LV},
+{0xca85,Grapheme_Class::LVT},
+{0xcaa0,Grapheme_Class::LV},
+{0xcaa1,Grapheme_Class::LVT},
+{0xcabc,Grapheme_Class::LV},
+{0xcabd,Grapheme_Class::LVT},
+{0xcad8,Grapheme_Class::LV},
+{0xcad9,Grapheme_Class::LVT},
+{0xcaf4,Grapheme_Class::LV},
+{0xcaf5,Grapheme_Class::LVT},
+{0xcb10,Grapheme_Class::LV},
+{0xcb11,Grapheme_Class::LVT},
+{0xcb2c,Grapheme_Class::LV},
+{0xcb2d,Grapheme_Class::LVT},
+{0xcb48,Grapheme_Class::LV},
+{0xcb49,Grapheme_Class::LVT},
+{0xcb64,Grapheme_Class::LV},
+{0xcb65,Grapheme_Class::LVT},
+{0xcb80,Grapheme_Class::LV},
+{0xcb81,Grapheme_Class::LVT},
+{0xcb9c,Grapheme_Class::LV},
+{0xcb9d,Grapheme_Class::LVT},
+{0xcbb8,Grapheme_Class::LV},
+{0xcbb9,Grapheme_Class::LVT},
+{0xcbd4,Grapheme_Class::LV},
+{0xcbd5,Grapheme_Class::LVT},
+{0xcbf0,Grapheme_Class::LV},
+{0xcbf1,Grapheme_Class::LVT},
+{0xcc0c,Grapheme_Class::LV},
+{0xcc0d,Grapheme_Class::LVT},
+{0xcc28,Grapheme_Class::LV},
+{0xcc29,Grapheme_Class::LVT},
+{0xcc44,Grapheme_Class::LV},
+{0xcc45,Grapheme_Class::LVT},
+{0xcc60,Grapheme_Class::LV},
+{0xcc61,Grapheme_Class::LVT},
+{0xcc7c,Grapheme_Class::LV},
+{0xcc7d,Grapheme_Class::LVT},
+{0xcc98,Grapheme_Class::LV},
+{0xcc99,Grapheme_Class::LVT},
+{0xccb4,Grapheme_Class::LV},
+{0xccb5,Grapheme_Class::LVT},
+{0xccd0,Grapheme_Class::LV},
+{0xccd1,Grapheme_Class::LVT},
+{0xccec,Grapheme_Class::LV},
+{0xcced,Grapheme_Class::LVT},
+{0xcd08,Grapheme_Class::LV},
+{0xcd09,Grapheme_Class::LVT},
+{0xcd24,Grapheme_Class::LV},
+{0xcd25,Grapheme_Class::LVT},
+{0xcd40,Grapheme_Class::LV},
+{0xcd41,Grapheme_Class::LVT},
+{0xcd5c,Grapheme_Class::LV},
+{0xcd5d,Grapheme_Class::LVT},
+{0xcd78,Grapheme_Class::LV},
+{0xcd79,Grapheme_Class::LVT},
+{0xcd94,Grapheme_Class::LV},
+{0xcd95,Grapheme_Class::LVT},
+{0xcdb0,Grapheme_Class::LV},
+{0xcdb1,Grapheme_Class::LVT},
+{0xcdcc,Grapheme_Class::LV},
+{0xcdcd,Grapheme_Class::LVT},
+{0xcde8,Grapheme_Class::LV},
+{0xcde9,Grapheme_Class::LVT},
+{0xce04,Grapheme_Class::LV},
+{0xce05,Grapheme_Class::LVT},
+{0xce20,Grapheme_Class::LV},
+{0xce21,Grapheme_Class::LVT},
+{0xce3c,Grapheme_Class::LV},
+{0xce3d,Grapheme_Class::LVT},
+{0xce58,Grapheme_Class::LV},
+{0xce59,Grapheme_Class::LVT},
+{0xce74,Grapheme_Class::LV},
+{0xce75,Grapheme_Class::LVT},
+{0xce90,Grapheme_Class::LV},
+{0xce91,Grapheme_Class::LVT},
+{0xceac,Grapheme_Class::LV},
+{0xcead,Grapheme_Class::LVT},
+{0xcec8,Grapheme_Class::LV},
+{0xcec9,Grapheme_Class::LVT},
+{0xcee4,Grapheme_Class::LV},
+{0xcee5,Grapheme_Class::LVT},
+{0xcf00,Grapheme_Class::LV},
+{0xcf01,Grapheme_Class::LVT},
+{0xcf1c,Grapheme_Class::LV},
+{0xcf1d,Grapheme_Class::LVT},
+{0xcf38,Grapheme_Class::LV},
+{0xcf39,Grapheme_Class::LVT},
+{0xcf54,Grapheme_Class::LV},
+{0xcf55,Grapheme_Class::LVT},
+{0xcf70,Grapheme_Class::LV},
+{0xcf71,Grapheme_Class::LVT},
+{0xcf8c,Grapheme_Class::LV},
+{0xcf8d,Grapheme_Class::LVT},
+{0xcfa8,Grapheme_Class::LV},
+{0xcfa9,Grapheme_Class::LVT},
+{0xcfc4,Grapheme_Class::LV},
+{0xcfc5,Grapheme_Class::LVT},
+{0xcfe0,Grapheme_Class::LV},
+{0xcfe1,Grapheme_Class::LVT},
+{0xcffc,Grapheme_Class::LV},
+{0xcffd,Grapheme_Class::LVT},
+{0xd018,Grapheme_Class::LV},
+{0xd019,Grapheme_Class::LVT},
+{0xd034,Grapheme_Class::LV},
+{0xd035,Grapheme_Class::LVT},
+{0xd050,Grapheme_Class::LV},
+{0xd051,Grapheme_Class::LVT},
+{0xd06c,Grapheme_Class::LV},
+{0xd06d,Grapheme_Class::LVT},
+{0xd088,Grapheme_Class::LV},
+{0xd089,Grapheme_Class::LVT},
+{0xd0a4,Grapheme_Class::LV},
+{0xd0a5,Grapheme_Class::LVT},
+{0xd0c0,Grapheme_Class::LV},
+{0xd0c1,Grapheme_Class::LVT},
+{0xd0dc,Grapheme_Class::LV},
+{0xd0dd,Grapheme_Class::LVT},
+{0xd0f8,Grapheme_Class::LV},
+{0xd0f9,Grapheme_Class::LVT},
+{0xd114,Grapheme_Class::LV},
+{0xd115,Grapheme_Class::LVT},
+{0xd130,Grapheme_Class::LV},
+{0xd131,Grapheme_Class::LVT},
+{0xd14c,Grapheme_Class::LV},
+{0xd14d,Grapheme_Class::LVT},
+{0xd168,Grapheme_Class::LV},
+{0xd169,Grapheme_Class::LVT},
+{0xd184,Grapheme_Class::LV},
+{0xd185,Grapheme_Class::LVT},
+{0xd1a0,Grapheme_Class::LV},
+{0xd1a1,Grapheme_Class::LVT},
+{0xd1bc,Grapheme_Class::LV},
+{0xd1bd,Grapheme_Class::LVT},
+{0xd1d8,Grapheme_Class::LV},
+{0xd1d9,Grapheme_Class::LVT},
+{0xd1f4,Grapheme_Class::LV},
+{0xd1f5,Grapheme_Class::LVT},
+{0xd210,Grapheme_Class::LV},
+{0xd211,Grapheme_Class::LVT},
+{0xd22c,Grapheme_Class::LV},
+{0xd22d,Grapheme_Class::LVT},
+{0xd248,Grapheme_Class::LV},
+{0xd249,Grapheme_Class::LVT},
+{0xd264,Grapheme_Class::LV},
+{0xd265,Grapheme_Class::LVT},
+{0xd280,Grapheme_Class::LV},
+{0xd281,Grapheme_Class::LVT},
+{0xd29c,Grapheme_Class::LV},
+{0xd29d,Grapheme_Class::LVT},
+{0xd2b8,Grapheme_Class::LV},
+{0xd2b9,Grapheme_Class::LVT},
+{0xd2d4,Grapheme_Class::LV},
+{0xd2d5,Grapheme_Class::LVT},
+{0xd2f0,Grapheme_Class::LV},
+{0xd2f1,Grapheme_Class::LVT},
+{0xd30c,Grapheme_Class::LV},
+{0xd30d,Grapheme_Class::LVT},
+{0xd328,Grapheme_Class::LV},
+{0xd329,Grapheme_Class::LVT},
+{0xd344,Grapheme_Class::LV},
+{0xd345,Grapheme_Class::LVT},
+{0xd360,Grapheme_Class::LV},
+{0xd361,Grapheme_Class::LVT},
+{0xd37c,Grapheme_Class::LV},
+{0xd37d,Grapheme_Class::LVT},
+{0xd398,Grapheme_Class::LV},
+{0xd399,Grapheme_Class::LVT},
+{0xd3b4,Grapheme_Class::LV},
+{0xd3b5,Grapheme_Class::LVT},
+{0xd3d0,Grapheme_Class::LV},
+{0xd3d1,Grapheme_Class::LVT},
+{0xd3ec,Grapheme_Class::LV},
+{0xd3ed,Grapheme_Class::LVT},
+{0xd408,Grapheme_Class::LV},
+{0xd409,Grapheme_Class::LVT},
+{0xd424,Grapheme_Class::LV},
+{0xd425,Grapheme_Class::LVT},
+{0xd440,Grapheme_Class::LV},
+{0xd441,Grapheme_Class::LVT},
+{0xd45c,Grapheme_Class::LV},
+{0xd45d,Grapheme_Class::LVT},
+{0xd478,Grapheme_Class::LV},
+{0xd479,Grapheme_Class::LVT},
+{0xd494,Grapheme_Class::LV},
+{0xd495,Grapheme_Class::LVT},
+{0xd4b0,Grapheme_Class::LV},
+{0xd4b1,Grapheme_Class::LVT},
+{0xd4cc,Grapheme_Class::LV},
+{0xd4cd,Grapheme_Class::LVT},
+{0xd4e8,Grapheme_Class::LV},
+{0xd4e9,Grapheme_Class::LVT},
+{0xd504,Grapheme_Class::LV},
+{0xd505,Grapheme_Class::LVT},
+{0xd520,Grapheme_Class::LV},
+{0xd521,Grapheme_Class::LVT},
+{0xd53c,Grapheme_Class::LV},
+{0xd53d,Grapheme_Class::LVT},
+{0xd558,Grapheme_Class::LV},
+{0xd559,Grapheme_Class::LVT},
+{0xd574,Grapheme_Class::LV},
+{0xd575,Grapheme_Class::LVT},
+{0xd590,Grapheme_Class::LV},
+{0xd591,Grapheme_Class::LVT},
+{0xd5ac,Grapheme_Class::LV},
+{0xd5ad,Grapheme_Class::LVT},
+{0xd5c8,Grapheme_Class::LV},
+{0xd5c9,Grapheme_Class::LVT},
+{0xd5e4,Grapheme_Class::LV},
+{0xd5e5,Grapheme_Class::LVT},
+{0xd600,Grapheme_Class::LV},
+{0xd601,Grapheme_Class::LVT},
+{0xd61c,Grapheme_Class::LV},
+{0xd61d,Grapheme_Class::LVT},
+{0xd638,Grapheme_Class::LV},
+{0xd639,Grapheme_Class::LVT},
+{0xd654,Grapheme_Class::LV},
+{0xd655,Grapheme_Class::LVT},
+{0xd670,Grapheme_Class::LV},
+{0xd671,Grapheme_Class::LVT},
+{0xd68c,Grapheme_Class::LV},
+{0xd68d,Grapheme_Class::LVT},
+{0xd6a8,Grapheme_Class::LV},
+{0xd6a9,Grapheme_Class::LVT},
+{0xd6c4,Grapheme_Class::LV},
+{0xd6c5,Grapheme_Class::LVT},
+{0xd6e0,Grapheme_Class::LV},
+{0xd6e1,Grapheme_Class::LVT},
+{0xd6fc,Grapheme_Class::LV},
+{0xd6fd,Grapheme_Class::LVT},
+{0xd718,Grapheme_Class::LV},
+{0xd719,Grapheme_Class::LVT},
+{0xd734,Grapheme_Class::LV},
+{0xd735,Grapheme_Class::LVT},
+{0xd750,Grapheme_Class::LV},
+{0xd751,Grapheme_Class::LVT},
+{0xd76c,Grapheme_Class::LV},
+{0xd76d,Grapheme_Class::LVT},
+{0xd788,Grapheme_Class::LV},
+{0xd789,Grapheme_Class::LVT},
+{0xd7a4,static_cast<Grapheme_Class>(0)},
+{0xd7b0,Grapheme_Class::V},
+{0xd7c7,static_cast<Grapheme_Class>(0)},
+{0xd7cb,Grapheme_Class::T},
+{0xd7fc,static_cast<Grapheme_Class>(0)},
+{0xfb1e,Grapheme_Class::InCB_Extend},
+{0xfb1f,static_cast<Grapheme_Class>(0)},
+{0xfe00,Grapheme_Class::InCB_Extend},
+{0xfe10,static_cast<Grapheme_Class>(0)},
+{0xfe20,Grapheme_Class::InCB_Extend},
+{0xfe30,static_cast<Grapheme_Class>(0)},
+{0xfeff,Grapheme_Class::Control},
+{0xff00,static_cast<Grapheme_Class>(0)},
+{0xff9e,Grapheme_Class::InCB_Extend},
+{0xffa0,static_cast<Grapheme_Class>(0)},
+{0xfff0,Grapheme_Class::Control},
+{0xfffc,static_cast<Grapheme_Class>(0)},
+{0x101fd,Grapheme_Class::InCB_Extend},
+{0x101fe,static_cast<Grapheme_Class>(0)},
+{0x102e0,Grapheme_Class::InCB_Extend},
+{0x102e1,static_cast<Grapheme_Class>(0)},
+{0x10376,Grapheme_Class::InCB_Extend},
+{0x1037b,static_cast<Grapheme_Class>(0)},
+{0x10a01,Grapheme_Class::InCB_Extend},
+{0x10a04,static_cast<Grapheme_Class>(0)},
+{0x10a05,Grapheme_Class::InCB_Extend},
+{0x10a07,static_cast<Grapheme_Class>(0)},
+{0x10a0c,Grapheme_Class::InCB_Extend},
+{0x10a10,static_cast<Grapheme_Class>(0)},
+{0x10a38,Grapheme_Class::InCB_Extend},
+{0x10a3b,static_cast<Grapheme_Class>(0)},
+{0x10a3f,Grapheme_Class::InCB_Extend},
+{0x10a40,static_cast<Grapheme_Class>(0)},
+{0x10ae5,Grapheme_Class::InCB_Extend},
+{0x10ae7,static_cast<Grapheme_Class>(0)},
+{0x10d24,Grapheme_Class::InCB_Extend},
+{0x10d28,static_cast<Grapheme_Class>(0)},
+{0x10d69,Grapheme_Class::InCB_Extend},
+{0x10d6e,static_cast<Grapheme_Class>(0)},
+{0x10eab,Grapheme_Class::InCB_Extend},
+{0x10ead,static_cast<Grapheme_Class>(0)},
+{0x10efc,Grapheme_Class::InCB_Extend},
+{0x10f00,static_cast<Grapheme_Class>(0)},
+{0x10f46,Grapheme_Class::InCB_Extend},
+{0x10f51,static_cast<Grapheme_Class>(0)},
+{0x10f82,Grapheme_Class::InCB_Extend},
+{0x10f86,static_cast<Grapheme_Class>(0)},
+{0x11000,Grapheme_Class::SpacingMark},
+{0x11001,Grapheme_Class::InCB_Extend},
+{0x11002,Grapheme_Class::SpacingMark},
+{0x11003,static_cast<Grapheme_Class>(0)},
+{0x11038,Grapheme_Class::InCB_Extend},
+{0x11047,static_cast<Grapheme_Class>(0)},
+{0x11070,Grapheme_Class::InCB_Extend},
+{0x11071,static_cast<Grapheme_Class>(0)},
+{0x11073,Grapheme_Class::InCB_Extend},
+{0x11075,static_cast<Grapheme_Class>(0)},
+{0x1107f,Grapheme_Class::InCB_Extend},
+{0x11082,Grapheme_Class::SpacingMark},
+{0x11083,static_cast<Grapheme_Class>(0)},
+{0x110b0,Grapheme_Class::SpacingMark},
+{0x110b3,Grapheme_Class::InCB_Extend},
+{0x110b7,Grapheme_Class::SpacingMark},
+{0x110b9,Grapheme_Class::InCB_Extend},
+{0x110bb,static_cast<Grapheme_Class>(0)},
+{0x110bd,Grapheme_Class::Prepend},
+{0x110be,static_cast<Grapheme_Class>(0)},
+{0x110c2,Grapheme_Class::InCB_Extend},
+{0x110c3,static_cast<Grapheme_Class>(0)},
+{0x110cd,Grapheme_Class::Prepend},
+{0x110ce,static_cast<Grapheme_Class>(0)},
+{0x11100,Grapheme_Class::InCB_Extend},
+{0x11103,static_cast<Grapheme_Class>(0)},
+{0x11127,Grapheme_Class::InCB_Extend},
+{0x1112c,Grapheme_Class::SpacingMark},
+{0x1112d,Grapheme_Class::InCB_Extend},
+{0x11135,static_cast<Grapheme_Class>(0)},
+{0x11145,Grapheme_Class::SpacingMark},
+{0x11147,static_cast<Grapheme_Class>(0)},
+{0x11173,Grapheme_Class::InCB_Extend},
+{0x11174,static_cast<Grapheme_Class>(0)},
+{0x11180,Grapheme_Class::InCB_Extend},
+{0x11182,Grapheme_Class::SpacingMark},
+{0x11183,static_cast<Grapheme_Class>(0)},
+{0x111b3,Grapheme_Class::SpacingMark},
+{0x111b6,Grapheme_Class::InCB_Extend},
+{0x111bf,Grapheme_Class::SpacingMark},
+{0x111c0,Grapheme_Class::InCB_Extend},
+{0x111c1,static_cast<Grapheme_Class>(0)},
+{0x111c2,Grapheme_Class::Prepend},
+{0x111c4,static_cast<Grapheme_Class>(0)},
+{0x111c9,Grapheme_Class::InCB_Extend},
+{0x111cd,static_cast<Grapheme_Class>(0)},
+{0x111ce,Grapheme_Class::SpacingMark},
+{0x111cf,Grapheme_Class::InCB_Extend},
+{0x111d0,static_cast<Grapheme_Class>(0)},
+{0x1122c,Grapheme_Class::SpacingMark},
+{0x1122f,Grapheme_Class::InCB_Extend},
+{0x11232,Grapheme_Class::SpacingMark},
+{0x11234,Grapheme_Class::InCB_Extend},
+{0x11238,static_cast<Grapheme_Class>(0)},
+{0x1123e,Grapheme_Class::InCB_Extend},
+{0x1123f,static_cast<Grapheme_Class>(0)},
+{0x11241,Grapheme_Class::InCB_Extend},
+{0x11242,static_cast<Grapheme_Class>(0)},
+{0x112df,Grapheme_Class::InCB_Extend},
+{0x112e0,Grapheme_Class::SpacingMark},
+{0x112e3,Grapheme_Class::InCB_Extend},
+{0x112eb,static_cast<Grapheme_Class>(0)},
+{0x11300,Grapheme_Class::InCB_Extend},
+{0x11302,Grapheme_Class::SpacingMark},
+{0x11304,static_cast<Grapheme_Class>(0)},
+{0x1133b,Grapheme_Class::InCB_Extend},
+{0x1133d,static_cast<Grapheme_Class>(0)},
+{0x1133e,Grapheme_Class::InCB_Extend},
+{0x1133f,Grapheme_Class::SpacingMark},
+{0x11340,Grapheme_Class::InCB_Extend},
+{0x11341,Grapheme_Class::SpacingMark},
+{0x11345,static_cast<Grapheme_Class>(0)},
+{0x11347,Grapheme_Class::SpacingMark},
+{0x11349,static_cast<Grapheme_Class>(0)},
+{0x1134b,Grapheme_Class::SpacingMark},
+{0x1134d,Grapheme_Class::InCB_Extend},
+{0x1134e,static_cast<Grapheme_Class>(0)},
+{0x11357,Grapheme_Class::InCB_Extend},
+{0x11358,static_cast<Grapheme_Class>(0)},
+{0x11362,Grapheme_Class::SpacingMark},
+{0x11364,static_cast<Grapheme_Class>(0)},
+{0x11366,Grapheme_Class::InCB_Extend},
+{0x1136d,static_cast<Grapheme_Class>(0)},
+{0x11370,Grapheme_Class::InCB_Extend},
+{0x11375,static_cast<Grapheme_Class>(0)},
+{0x113b8,Grapheme_Class::InCB_Extend},
+{0x113b9,Grapheme_Class::SpacingMark},
+{0x113bb,Grapheme_Class::InCB_Extend},
+{0x113c1,static_cast<Grapheme_Class>(0)},
+{0x113c2,Grapheme_Class::InCB_Extend},
+{0x113c3,static_cast<Grapheme_Class>(0)},
+{0x113c5,Grapheme_Class::InCB_Extend},
+{0x113c6,static_cast<Grapheme_Class>(0)},
+{0x113c7,Grapheme_Class::InCB_Extend},
+{0x113ca,Grapheme_Class::SpacingMark},
+{0x113cb,static_cast<Grapheme_Class>(0)},
+{0x113cc,Grapheme_Class::SpacingMark},
+{0x113ce,Grapheme_Class::InCB_Extend},
+{0x113d1,Grapheme_Class::Prepend},
+{0x113d2,Grapheme_Class::InCB_Extend},
+{0x113d3,static_cast<Grapheme_Class>(0)},
+{0x113e1,Grapheme_Class::InCB_Extend},
+{0x113e3,static_cast<Grapheme_Class>(0)},
+{0x11435,Grapheme_Class::SpacingMark},
+{0x11438,Grapheme_Class::InCB_Extend},
+{0x11440,Grapheme_Class::SpacingMark},
+{0x11442,Grapheme_Class::InCB_Extend},
+{0x11445,Grapheme_Class::SpacingMark},
+{0x11446,Grapheme_Class::InCB_Extend},
+{0x11447,static_cast<Grapheme_Class>(0)},
+{0x1145e,Grapheme_Class::InCB_Extend},
+{0x1145f,static_cast<Grapheme_Class>(0)},
+{0x114b0,Grapheme_Class::InCB_Extend},
+{0x114b1,Grapheme_Class::SpacingMark},
+{0x114b3,Grapheme_Class::InCB_Extend},
+{0x114b9,Grapheme_Class::SpacingMark},
+{0x114ba,Grapheme_Class::InCB_Extend},
+{0x114bb,Grapheme_Class::SpacingMark},
+{0x114bd,Grapheme_Class::InCB_Extend},
+{0x114be,Grapheme_Class::SpacingMark},
+{0x114bf,Grapheme_Class::InCB_Extend},
+{0x114c1,Grapheme_Class::SpacingMark},
+{0x114c2,Grapheme_Class::InCB_Extend},
+{0x114c4,static_cast<Grapheme_Class>(0)},
+{0x115af,Grapheme_Class::InCB_Extend},
+{0x115b0,Grapheme_Class::SpacingMark},
+{0x115b2,Grapheme_Class::InCB_Extend},
+{0x115b6,static_cast<Grapheme_Class>(0)},
+{0x115b8,Grapheme_Class::SpacingMark},
+{0x115bc,Grapheme_Class::InCB_Extend},
+{0x115be,Grapheme_Class::SpacingMark},
+{0x115bf,Grapheme_Class::InCB_Extend},
+{0x115c1,static_cast<Grapheme_Class>(0)},
+{0x115dc,Grapheme_Class::InCB_Extend},
+{0x115de,static_cast<Grapheme_Class>(0)},
+{0x11630,Grapheme_Class::SpacingMark},
+{0x11633,Grapheme_Class::InCB_Extend},
+{0x1163b,Grapheme_Class::SpacingMark},
+{0x1163d,Grapheme_Class::InCB_Extend},
+{0x1163e,Grapheme_Class::SpacingMark},
+{0x1163f,Grapheme_Class::InCB_Extend},
+{0x11641,static_cast<Grapheme_Class>(0)},
+{0x116ab,Grapheme_Class::InCB_Extend},
+{0x116ac,Grapheme_Class::SpacingMark},
+{0x116ad,Grapheme_Class::InCB_Extend},
+{0x116ae,Grapheme_Class::SpacingMark},
+{0x116b0,Grapheme_Class::InCB_Extend},
+{0x116b8,static_cast<Grapheme_Class>(0)},
+{0x1171d,Grapheme_Class::InCB_Extend},
+{0x1171e,Grapheme_Class::SpacingMark},
+{0x1171f,Grapheme_Class::InCB_Extend},
+{0x11720,static_cast<Grapheme_Class>(0)},
+{0x11722,Grapheme_Class::InCB_Extend},
+{0x11726,Grapheme_Class::SpacingMark},
+{0x11727,Grapheme_Class::InCB_Extend},
+{0x1172c,static_cast<Grapheme_Class>(0)},
+{0x1182c,Grapheme_Class::SpacingMark},
+{0x1182f,Grapheme_Class::InCB_Extend},
+{0x11838,Grapheme_Class::SpacingMark},
+{0x11839,Grapheme_Class::InCB_Extend},
+{0x1183b,static_cast<Grapheme_Class>(0)},
+{0x11930,Grapheme_Class::InCB_Extend},
+{0x11931,Grapheme_Class::SpacingMark},
+{0x11936,static_cast<Grapheme_Class>(0)},
+{0x11937,Grapheme_Class::SpacingMark},
+{0x11939,static_cast<Grapheme_Class>(0)},
+{0x1193b,Grapheme_Class::InCB_Extend},
+{0x1193f,Grapheme_Class::Prepend},
+{0x11940,Grapheme_Class::SpacingMark},
+{0x11941,Grapheme_Class::Prepend},
+{0x11942,Grapheme_Class::SpacingMark},
+{0x11943,Grapheme_Class::InCB_Extend},
+{0x11944,static_cast<Grapheme_Class>(0)},
+{0x119d1,Grapheme_Class::SpacingMark},
+{0x119d4,Grapheme_Class::InCB_Extend},
+{0x119d8,static_cast<Grapheme_Class>(0)},
+{0x119da,Grapheme_Class::InCB_Extend},
+{0x119dc,Grapheme_Class::SpacingMark},
+{0x119e0,Grapheme_Class::InCB_Extend},
+{0x119e1,static_cast<Grapheme_Class>(0)},
+{0x119e4,Grapheme_Class::SpacingMark},
+{0x119e5,static_cast<Grapheme_Class>(0)},
+{0x11a01,Grapheme_Class::InCB_Extend},
+{0x11a0b,static_cast<Grapheme_Class>(0)},
+{0x11a33,Grapheme_Class::InCB_Extend},
+{0x11a39,Grapheme_Class::SpacingMark},
+{0x11a3a,Grapheme_Class::Prepend},
+{0x11a3b,Grapheme_Class::InCB_Extend},
+{0x11a3f,static_cast<Grapheme_Class>(0)},
+{0x11a47,Grapheme_Class::InCB_Extend},
+{0x11a48,static_cast<Grapheme_Class>(0)},
+{0x11a51,Grapheme_Class::InCB_Extend},
+{0x11a57,Grapheme_Class::SpacingMark},
+{0x11a59,Grapheme_Class::InCB_Extend},
+{0x11a5c,static_cast<Grapheme_Class>(0)},
+{0x11a84,Grapheme_Class::Prepend},
+{0x11a8a,Grapheme_Class::InCB_Extend},
+{0x11a97,Grapheme_Class::SpacingMark},
+{0x11a98,Grapheme_Class::InCB_Extend},
+{0x11a9a,static_cast<Grapheme_Class>(0)},
+{0x11c2f,Grapheme_Class::SpacingMark},
+{0x11c30,Grapheme_Class::InCB_Extend},
+{0x11c37,static_cast<Grapheme_Class>(0)},
+{0x11c38,Grapheme_Class::InCB_Extend},
+{0x11c3e,Grapheme_Class::SpacingMark},
+{0x11c3f,Grapheme_Class::InCB_Extend},
+{0x11c40,static_cast<Grapheme_Class>(0)},
+{0x11c92,Grapheme_Class::InCB_Extend},
+{0x11ca8,static_cast<Grapheme_Class>(0)},
+{0x11ca9,Grapheme_Class::SpacingMark},
+{0x11caa,Grapheme_Class::InCB_Extend},
+{0x11cb1,Grapheme_Class::SpacingMark},
+{0x11cb2,Grapheme_Class::InCB_Extend},
+{0x11cb4,Grapheme_Class::SpacingMark},
+{0x11cb5,Grapheme_Class::InCB_Extend},
+{0x11cb7,static_cast<Grapheme_Class>(0)},
+{0x11d31,Grapheme_Class::InCB_Extend},
+{0x11d37,static_cast<Grapheme_Class>(0)},
+{0x11d3a,Grapheme_Class::InCB_Extend},
+{0x11d3b,static_cast<Grapheme_Class>(0)},
+{0x11d3c,Grapheme_Class::InCB_Extend},
+{0x11d3e,static_cast<Grapheme_Class>(0)},
+{0x11d3f,Grapheme_Class::InCB_Extend},
+{0x11d46,Grapheme_Class::Prepend},
+{0x11d47,Grapheme_Class::InCB_Extend},
+{0x11d48,static_cast<Grapheme_Class>(0)},
+{0x11d8a,Grapheme_Class::SpacingMark},
+{0x11d8f,static_cast<Grapheme_Class>(0)},
+{0x11d90,Grapheme_Class::InCB_Extend},
+{0x11d92,static_cast<Grapheme_Class>(0)},
+{0x11d93,Grapheme_Class::SpacingMark},
+{0x11d95,Grapheme_Class::InCB_Extend},
+{0x11d96,Grapheme_Class::SpacingMark},
+{0x11d97,Grapheme_Class::InCB_Extend},
+{0x11d98,static_cast<Grapheme_Class>(0)},
+{0x11ef3,Grapheme_Class::InCB_Extend},
+{0x11ef5,Grapheme_Class::SpacingMark},
+{0x11ef7,static_cast<Grapheme_Class>(0)},
+{0x11f00,Grapheme_Class::InCB_Extend},
+{0x11f02,Grapheme_Class::Prepend},
+{0x11f03,Grapheme_Class::SpacingMark},
+{0x11f04,static_cast<Grapheme_Class>(0)},
+{0x11f34,Grapheme_Class::SpacingMark},
+{0x11f36,Grapheme_Class::InCB_Extend},
+{0x11f3b,static_cast<Grapheme_Class>(0)},
+{0x11f3e,Grapheme_Class::SpacingMark},
+{0x11f40,Grapheme_Class::InCB_Extend},
+{0x11f43,static_cast<Grapheme_Class>(0)},
+{0x11f5a,Grapheme_Class::InCB_Extend},
+{0x11f5b,static_cast<Grapheme_Class>(0)},
+{0x13430,Grapheme_Class::Control},
+{0x13440,Grapheme_Class::InCB_Extend},
+{0x13441,static_cast<Grapheme_Class>(0)},
+{0x13447,Grapheme_Class::InCB_Extend},
+{0x13456,static_cast<Grapheme_Class>(0)},
+{0x1611e,Grapheme_Class::InCB_Extend},
+{0x1612a,Grapheme_Class::SpacingMark},
+{0x1612d,Grapheme_Class::InCB_Extend},
+{0x16130,static_cast<Grapheme_Class>(0)},
+{0x16af0,Grapheme_Class::InCB_Extend},
+{0x16af5,static_cast<Grapheme_Class>(0)},
+{0x16b30,Grapheme_Class::InCB_Extend},
+{0x16b37,static_cast<Grapheme_Class>(0)},
+{0x16d63,Grapheme_Class::V},
+{0x16d64,static_cast<Grapheme_Class>(0)},
+{0x16d67,Grapheme_Class::V},
+{0x16d6b,static_cast<Grapheme_Class>(0)},
+{0x16f4f,Grapheme_Class::InCB_Extend},
+{0x16f50,static_cast<Grapheme_Class>(0)},
+{0x16f51,Grapheme_Class::SpacingMark},
+{0x16f88,static_cast<Grapheme_Class>(0)},
+{0x16f8f,Grapheme_Class::InCB_Extend},
+{0x16f93,static_cast<Grapheme_Class>(0)},
+{0x16fe4,Grapheme_Class::InCB_Extend},
+{0x16fe5,static_cast<Grapheme_Class>(0)},
+{0x16ff0,Grapheme_Class::InCB_Extend},
+{0x16ff2,static_cast<Grapheme_Class>(0)},
+{0x1bc9d,Grapheme_Class::InCB_Extend},
+{0x1bc9f,static_cast<Grapheme_Class>(0)},
+{0x1bca0,Grapheme_Class::Control},
+{0x1bca4,static_cast<Grapheme_Class>(0)},
+{0x1cf00,Grapheme_Class::InCB_Extend},
+{0x1cf2e,static_cast<Grapheme_Class>(0)},
+{0x1cf30,Grapheme_Class::InCB_Extend},
+{0x1cf47,static_cast<Grapheme_Class>(0)},
+{0x1d165,Grapheme_Class::InCB_Extend},
+{0x1d16a,static_cast<Grapheme_Class>(0)},
+{0x1d16d,Grapheme_Class::InCB_Extend},
+{0x1d173,Grapheme_Class::Control},
+{0x1d17b,Grapheme_Class::InCB_Extend},
+{0x1d183,static_cast<Grapheme_Class>(0)},
+{0x1d185,Grapheme_Class::InCB_Extend},
+{0x1d18c,static_cast<Grapheme_Class>(0)},
+{0x1d1aa,Grapheme_Class::InCB_Extend},
+{0x1d1ae,static_cast<Grapheme_Class>(0)},
+{0x1d242,Grapheme_Class::InCB_Extend},
+{0x1d245,static_cast<Grapheme_Class>(0)},
+{0x1da00,Grapheme_Class::InCB_Extend},
+{0x1da37,static_cast<Grapheme_Class>(0)},
+{0x1da3b,Grapheme_Class::InCB_Extend},
+{0x1da6d,static_cast<Grapheme_Class>(0)},
+{0x1da75,Grapheme_Class::InCB_Extend},
+{0x1da76,static_cast<Grapheme_Class>(0)},
+{0x1da84,Grapheme_Class::InCB_Extend},
+{0x1da85,static_cast<Grapheme_Class>(0)},
+{0x1da9b,Grapheme_Class::InCB_Extend},
+{0x1daa0,static_cast<Grapheme_Class>(0)},
+{0x1daa1,Grapheme_Class::InCB_Extend},
+{0x1dab0,static_cast<Grapheme_Class>(0)},
+{0x1e000,Grapheme_Class::InCB_Extend},
+{0x1e007,static_cast<Grapheme_Class>(0)},
+{0x1e008,Grapheme_Class::InCB_Extend},
+{0x1e019,static_cast<Grapheme_Class>(0)},
+{0x1e01b,Grapheme_Class::InCB_Extend},
+{0x1e022,static_cast<Grapheme_Class>(0)},
+{0x1e023,Grapheme_Class::InCB_Extend},
+{0x1e025,static_cast<Grapheme_Class>(0)},
+{0x1e026,Grapheme_Class::InCB_Extend},
+{0x1e02b,static_cast<Grapheme_Class>(0)},
+{0x1e08f,Grapheme_Class::InCB_Extend},
+{0x1e090,static_cast<Grapheme_Class>(0)},
+{0x1e130,Grapheme_Class::InCB_Extend},
+{0x1e137,static_cast<Grapheme_Class>(0)},
+{0x1e2ae,Grapheme_Class::InCB_Extend},
+{0x1e2af,static_cast<Grapheme_Class>(0)},
+{0x1e2ec,Grapheme_Class::InCB_Extend},
+{0x1e2f0,static_cast<Grapheme_Class>(0)},
+{0x1e4ec,Grapheme_Class::InCB_Extend},
+{0x1e4f0,static_cast<Grapheme_Class>(0)},
+{0x1e5ee,Grapheme_Class::InCB_Extend},
+{0x1e5f0,static_cast<Grapheme_Class>(0)},
+{0x1e8d0,Grapheme_Class::InCB_Extend},
+{0x1e8d7,static_cast<Grapheme_Class>(0)},
+{0x1e944,Grapheme_Class::InCB_Extend},
+{0x1e94b,static_cast<Grapheme_Class>(0)},
+{0x1f000,Grapheme_Class::Extended_Pictographic},
+{0x1f100,static_cast<Grapheme_Class>(0)},
+{0x1f10d,Grapheme_Class::Extended_Pictographic},
+{0x1f110,static_cast<Grapheme_Class>(0)},
+{0x1f12f,Grapheme_Class::Extended_Pictographic},
+{0x1f130,static_cast<Grapheme_Class>(0)},
+{0x1f16c,Grapheme_Class::Extended_Pictographic},
+{0x1f172,static_cast<Grapheme_Class>(0)},
+{0x1f17e,Grapheme_Class::Extended_Pictographic},
+{0x1f180,static_cast<Grapheme_Class>(0)},
+{0x1f18e,Grapheme_Class::Extended_Pictographic},
+{0x1f18f,static_cast<Grapheme_Class>(0)},
+{0x1f191,Grapheme_Class::Extended_Pictographic},
+{0x1f19b,static_cast<Grapheme_Class>(0)},
+{0x1f1ad,Grapheme_Class::Extended_Pictographic},
+{0x1f1e6,Grapheme_Class::Regional_Indicator},
+{0x1f200,static_cast<Grapheme_Class>(0)},
+{0x1f201,Grapheme_Class::Extended_Pictographic},
+{0x1f210,static_cast<Grapheme_Class>(0)},
+{0x1f21a,Grapheme_Class::Extended_Pictographic},
+{0x1f21b,static_cast<Grapheme_Class>(0)},
+{0x1f22f,Grapheme_Class::Extended_Pictographic},
+{0x1f230,static_cast<Grapheme_Class>(0)},
+{0x1f232,Grapheme_Class::Extended_Pictographic},
+{0x1f23b,static_cast<Grapheme_Class>(0)},
+{0x1f23c,Grapheme_Class::Extended_Pictographic},
+{0x1f240,static_cast<Grapheme_Class>(0)},
+{0x1f249,Grapheme_Class::Extended_Pictographic},
+{0x1f3fb,Grapheme_Class::InCB_Extend},
+{0x1f400,Grapheme_Class::Extended_Pictographic},
+{0x1f53e,static_cast<Grapheme_Class>(0)},
+{0x1f546,Grapheme_Class::Extended_Pictographic},
+{0x1f650,static_cast<Grapheme_Class>(0)},
+{0x1f680,Grapheme_Class::Extended_Pictographic},
+{0x1f700,static_cast<Grapheme_Class>(0)},
+{0x1f774,Grapheme_Class::Extended_Pictographic},
+{0x1f780,static_cast<Grapheme_Class>(0)},
+{0x1f7d5,Grapheme_Class::Extended_Pictographic},
+{0x1f800,static_cast<Grapheme_Class>(0)},
+{0x1f80c,Grapheme_Class::Extended_Pictographic},
+{0x1f810,static_cast<Grapheme_Class>(0)},
+{0x1f848,Grapheme_Class::Extended_Pictographic},
+{0x1f850,static_cast<Grapheme_Class>(0)},
+{0x1f85a,Grapheme_Class::Extended_Pictographic},
+{0x1f860,static_cast<Grapheme_Class>(0)},
+{0x1f888,Grapheme_Class::Extended_Pictographic},
+{0x1f890,static_cast<Grapheme_Class>(0)},
+{0x1f8ae,Grapheme_Class::Extended_Pictographic},
+{0x1f900,static_cast<Grapheme_Class>(0)},
+{0x1f90c,Grapheme_Class::Extended_Pictographic},
+{0x1f93b,static_cast<Grapheme_Class>(0)},
+{0x1f93c,Grapheme_Class::Extended_Pictographic},
+{0x1f946,static_cast<Grapheme_Class>(0)},
+{0x1f947,Grapheme_Class::Extended_Pictographic},
+{0x1fb00,static_cast<Grapheme_Class>(0)},
+{0x1fc00,Grapheme_Class::Extended_Pictographic},
+{0x1fffe,static_cast<Grapheme_Class>(0)},
+{0xe0000,Grapheme_Class::Control},
+{0xe0020,Grapheme_Class::InCB_Extend},
+{0xe0080,Grapheme_Class::Control},
+{0xe0100,Grapheme_Class::InCB_Extend},
+{0xe01f0,Grapheme_Class::Control},
+{0xe1000,static_cast<Grapheme_Class>(0)},
+}};
+
+const TableView<char32_t, Grapheme_Class> grapheme_class_table {&grapheme_class_array[0], &grapheme_class_array[0] + grapheme_class_array.size()};
+
 const std::array<KeyValue<char32_t, Line_Break>, 3593> line_break_array = {{
 {0x0,Line_Break::CM},
 {0x9,Line_Break::BA},
@@ -27,6 +27,17 @@ namespace RS::Unicorn::UnicornDetail {
         constexpr bool operator<(const KeyValue& rhs) const noexcept { return key < rhs.key; }
     };
 
+    // Character classes for the grapheme break state machine: the
+    // Grapheme_Cluster_Break property, refined by Extended_Pictographic and
+    // Indic_Conjunct_Break
+
+    enum class Grapheme_Class: uint8_t {
+        Other, CR, LF, Control, Extend, ZWJ, Regional_Indicator, Prepend, SpacingMark,
+        L, V, T, LV, LVT, Extended_Pictographic, InCB_Consonant, InCB_Linker, InCB_Extend,
+    };
+
+    constexpr size_t grapheme_classes = size_t(Grapheme_Class::InCB_Extend) + 1;
+
     using CharacterFunction = char32_t (*)(char32_t);
     template <typename K, typename V> using TableView = Irange<const KeyValue<K, V>*>;
 
@@ -70,6 +81,27 @@ namespace RS::Unicorn::UnicornDetail {
         }
     }
 
+    // Open addressing hash table keyed on a pair of characters, generated by
+    // write_pair_hashmap() in make-tables (which must use the same hash
+    // function); the table size is a power of 2, and empty slots have a
+    // zero key
+
+    constexpr uint32_t pair_hash(uint64_t key) noexcept {
+        return uint32_t((key * 0x9e3779b97f4a7c15ull) >> 32);
+    }
+
+    inline char32_t pair_hash_lookup(Irange<const KeyValue<uint64_t, char32_t>*> table, char32_t c1, char32_t c2) noexcept {
+        uint64_t key = (uint64_t(c1) << 32) + c2;
+        size_t mask = table.size() - 1;
+        for (size_t i = pair_hash(key) & mask;; i = (i + 1) & mask) {
+            auto& slot = table.begin()[i];
+            if (slot.key == key)
+                return slot.value;
+            if (slot.key == 0)
+                return 0;
+        }
+    }
+
     template <typename K>
     bool sparse_set_lookup(Irange<const KeyValue<K, K>*> table, K key) noexcept {
         if (table.begin() == table.end())
@@ -137,6 +169,8 @@ namespace RS::Unicorn::UnicornDetail {
     extern const TableView<char32_t, std::array<char32_t, 3>> full_lowercase_table;
     extern const TableView<char32_t, std::array<char32_t, 3>> full_titlecase_table;
     extern const TableView<char32_t, std::array<char32_t, 3>> full_casefold_table;
+    extern const TableView<char32_t, std::array<char32_t, 3>> short_nfkc_casefold_table;
+    extern const TableView<char32_t, std::array<char32_t, 18>> long_nfkc_casefold_table;
 
     // Character name tables
 
@@ -145,13 +179,24 @@ namespace RS::Unicorn::UnicornDetail {
     extern const size_t main_names_expanded;
     extern const TableView<char32_t, char const*> corrected_names_table;
 
+    // Collation tables
+
+    extern const Irange<uint32_t const*> collation_element_table;
+    extern const TableView<char32_t, uint32_t> collation_single_table;
+    extern const TableView<std::array<char32_t, 3>, uint32_t> collation_contraction_table;
+    extern const TableView<char32_t, std::array<char32_t, 3>> collation_implicit_table;
+    extern const TableView<char32_t, char32_t> unified_ideograph_table;
+
     // Decomposition tables
 
     extern const TableView<char32_t, int> combining_class_table;
     extern const TableView<char32_t, std::array<char32_t, 2>> canonical_table;
     extern const TableView<char32_t, std::array<char32_t, 3>> short_compatibility_table;
     extern const TableView<char32_t, std::array<char32_t, 18>> long_compatibility_table;
-    extern const TableView<std::array<char32_t, 2>, char32_t> composition_table;
+    extern const TableView<char32_t, std::array<char32_t, 4>> full_canonical_table;
+    extern const TableView<char32_t, std::array<char32_t, 4>> short_full_compatibility_table;
+    extern const TableView<char32_t, std::array<char32_t, 18>> long_full_compatibility_table;
+    extern const TableView<uint64_t, char32_t> composition_table;  // Hash table, see pair_hash_lookup()
 
     // Indic property tables
 
@@ -171,6 +216,7 @@ namespace RS::Unicorn::UnicornDetail {
     // Text segmentation property tables
 
     extern const TableView<char32_t, Grapheme_Cluster_Break> grapheme_cluster_break_table;
+    extern const TableView<char32_t, Grapheme_Class> grapheme_class_table;
     extern const TableView<char32_t, Line_Break> line_break_table;
     extern const TableView<char32_t, Sentence_Break> sentence_break_table;
     extern const TableView<char32_t, Word_Break> word_break_table;
@@ -191,4 +237,8 @@ namespace RS::Unicorn::UnicornDetail {
     extern const Irange<char const* const*> word_break_test_table;
     extern const Irange<char const* const*> sentence_break_test_table;
 
+    // Bidi test tables
+
+    extern const Irange<const std::array<char const*, 5>*> bidi_character_test_table;
+
 }
@@ -16,6 +16,9 @@ extern void test_unicorn_utility_type_names();
 extern void test_unicorn_utility_conversion_from_string();
 extern void test_unicorn_utility_conversion_to_string();
 extern void test_unicorn_utility_version_number();
+extern void test_unicorn_bidi_levels();
+extern void test_unicorn_bidi_reordering();
+extern void test_unicorn_bidi_long_text();
 extern void test_unicorn_character_version_information();
 extern void test_unicorn_character_basic_functions();
 extern void test_unicorn_character_general_category();
@@ -30,6 +33,8 @@ extern void test_unicorn_character_enumeration_properties();
 extern void test_unicorn_character_numeric_properties();
 extern void test_unicorn_character_script_properties();
 extern void test_unicorn_character_test_all_the_things();
+extern void test_unicorn_collate_compare();
+extern void test_unicorn_collate_keys();
 extern void test_unicorn_environment_query_functions();
 extern void test_unicorn_environment_update_functions();
 extern void test_unicorn_environment_block();
@@ -54,6 +59,11 @@ extern void test_unicorn_mbcs_to_unicode();
 extern void test_unicorn_mbcs_from_unicode();
 extern void test_unicorn_mbcs_local_encoding_round_trip();
 extern void test_unicorn_normal_normalization();
+extern void test_unicorn_normal_streaming();
+extern void test_unicorn_normal_stream_safe();
+extern void test_unicorn_normal_nfkc_casefold();
+extern void test_unicorn_normal_cache();
+extern void test_unicorn_normal_parallel();
 extern void test_unicorn_options_basic();
 extern void test_unicorn_options_boolean();
 extern void test_unicorn_options_multiple();
@@ -96,6 +106,10 @@ extern void test_unicorn_segment_graphemes();
 extern void test_unicorn_segment_words();
 extern void test_unicorn_segment_lines();
 extern void test_unicorn_segment_sentences();
+extern void test_unicorn_segment_breaks();
+extern void test_unicorn_segment_parallel_breaks();
+extern void test_unicorn_segment_streaming();
+extern void test_unicorn_segment_line_break_opportunities();
 extern void test_unicorn_segment_paragraphs();
 extern void test_unicorn_string_algorithm_common();
 extern void test_unicorn_string_algorithm_expect();
@@ -103,11 +117,16 @@ extern void test_unicorn_string_algorithm_find_char();
 extern void test_unicorn_string_algorithm_find_first();
 extern void test_unicorn_string_algorithm_line_column();
 extern void test_unicorn_string_algorithm_search();
+extern void test_unicorn_string_algorithm_search_long();
+extern void test_unicorn_string_algorithm_search_icase();
 extern void test_unicorn_string_algorithm_skipws();
 extern void test_unicorn_string_case_conversions();
+extern void test_unicorn_string_case_fast_paths();
 extern void test_unicorn_string_compare_basic();
 extern void test_unicorn_string_compare_icase();
+extern void test_unicorn_string_compare_icase_consistency();
 extern void test_unicorn_string_compare_natural();
+extern void test_unicorn_string_compare_natural_sort_key();
 extern void test_unicorn_string_conversion_decimal_integers();
 extern void test_unicorn_string_conversion_hexadecimal_integers();
 extern void test_unicorn_string_conversion_floating_point();
@@ -122,6 +141,7 @@ extern void test_unicorn_string_manip_erase();
 extern void test_unicorn_string_manip_expand();
 extern void test_unicorn_string_manip_fix_left();
 extern void test_unicorn_string_manip_fix_right();
+extern void test_unicorn_string_manip_in_place();
 extern void test_unicorn_string_manip_insert();
 extern void test_unicorn_string_manip_join();
 extern void test_unicorn_string_manip_pad_left();
@@ -131,6 +151,7 @@ extern void test_unicorn_string_manip_remove();
 extern void test_unicorn_string_manip_repeat();
 extern void test_unicorn_string_manip_replace();
 extern void test_unicorn_string_manip_split();
+extern void test_unicorn_string_manip_split_view();
 extern void test_unicorn_string_manip_squeeze();
 extern void test_unicorn_string_manip_substring();
 extern void test_unicorn_string_manip_translate();
@@ -142,6 +163,8 @@ extern void test_unicorn_string_property_char_at();
 extern void test_unicorn_string_property_first_and_last();
 extern void test_unicorn_string_property_east_asian();
 extern void test_unicorn_string_property_starts_and_ends();
+extern void test_unicorn_string_search_multi_searcher();
+extern void test_unicorn_string_search_multi_replacer();
 extern void test_unicorn_string_size_measurement_flags();
 extern void test_unicorn_string_size_find_offset();
 extern void test_unicorn_utf_basic_conversions();
@@ -171,6 +194,9 @@ int main() {
         { "unicorn/utility/conversion-from-string", test_unicorn_utility_conversion_from_string },
         { "unicorn/utility/conversion-to-string", test_unicorn_utility_conversion_to_string },
         { "unicorn/utility/version-number", test_unicorn_utility_version_number },
+        { "unicorn/bidi/levels", test_unicorn_bidi_levels },
+        { "unicorn/bidi/reordering", test_unicorn_bidi_reordering },
+        { "unicorn/bidi/long-text", test_unicorn_bidi_long_text },
         { "unicorn/character/version-information", test_unicorn_character_version_information },
         { "unicorn/character/basic-functions", test_unicorn_character_basic_functions },
         { "unicorn/character/general-category", test_unicorn_character_general_category },
@@ -185,6 +211,8 @@ int main() {
         { "unicorn/character/numeric-properties", test_unicorn_character_numeric_properties },
         { "unicorn/character/script-properties", test_unicorn_character_script_properties },
         { "unicorn/character/test-all-the-things", test_unicorn_character_test_all_the_things },
+        { "unicorn/collate/compare", test_unicorn_collate_compare },
+        { "unicorn/collate/keys", test_unicorn_collate_keys },
         { "unicorn/environment/query-functions", test_unicorn_environment_query_functions },
         { "unicorn/environment/update-functions", test_unicorn_environment_update_functions },
         { "unicorn/environment/block", test_unicorn_environment_block },
@@ -209,6 +237,11 @@ int main() {
         { "unicorn/mbcs/from-unicode", test_unicorn_mbcs_from_unicode },
         { "unicorn/mbcs/local-encoding-round-trip", test_unicorn_mbcs_local_encoding_round_trip },
         { "unicorn/normal/normalization", test_unicorn_normal_normalization },
+        { "unicorn/normal/streaming", test_unicorn_normal_streaming },
+        { "unicorn/normal/stream-safe", test_unicorn_normal_stream_safe },
+        { "unicorn/normal/nfkc-casefold", test_unicorn_normal_nfkc_casefold },
+        { "unicorn/normal/cache", test_unicorn_normal_cache },
+        { "unicorn/normal/parallel", test_unicorn_normal_parallel },
         { "unicorn/options/basic", test_unicorn_options_basic },
         { "unicorn/options/boolean", test_unicorn_options_boolean },
         { "unicorn/options/multiple", test_unicorn_options_multiple },
@@ -251,6 +284,10 @@ int main() {
         { "unicorn/segment/words", test_unicorn_segment_words },
         { "unicorn/segment/lines", test_unicorn_segment_lines },
         { "unicorn/segment/sentences", test_unicorn_segment_sentences },
+        { "unicorn/segment/breaks", test_unicorn_segment_breaks },
+        { "unicorn/segment/parallel-breaks", test_unicorn_segment_parallel_breaks },
+        { "unicorn/segment/streaming", test_unicorn_segment_streaming },
+        { "unicorn/segment/line-break-opportunities", test_unicorn_segment_line_break_opportunities },
         { "unicorn/segment/paragraphs", test_unicorn_segment_paragraphs },
         { "unicorn/string-algorithm/common", test_unicorn_string_algorithm_common },
         { "unicorn/string-algorithm/expect", test_unicorn_string_algorithm_expect },
@@ -258,11 +295,16 @@ int main() {
         { "unicorn/string-algorithm/find-first", test_unicorn_string_algorithm_find_first },
         { "unicorn/string-algorithm/line-column", test_unicorn_string_algorithm_line_column },
         { "unicorn/string-algorithm/search", test_unicorn_string_algorithm_search },
+        { "unicorn/string-algorithm/search-long", test_unicorn_string_algorithm_search_long },
+        { "unicorn/string-algorithm/search-icase", test_unicorn_string_algorithm_search_icase },
         { "unicorn/string-algorithm/skipws", test_unicorn_string_algorithm_skipws },
         { "unicorn/string-case/conversions", test_unicorn_string_case_conversions },
+        { "unicorn/string-case/fast-paths", test_unicorn_string_case_fast_paths },
         { "unicorn/string-compare/basic", test_unicorn_string_compare_basic },
         { "unicorn/string-compare/icase", test_unicorn_string_compare_icase },
+        { "unicorn/string-compare/icase-consistency", test_unicorn_string_compare_icase_consistency },
         { "unicorn/string-compare/natural", test_unicorn_string_compare_natural },
+        { "unicorn/string-compare/natural-sort-key", test_unicorn_string_compare_natural_sort_key },
         { "unicorn/string-conversion/decimal-integers", test_unicorn_string_conversion_decimal_integers },
         { "unicorn/string-conversion/hexadecimal-integers", test_unicorn_string_conversion_hexadecimal_integers },
         { "unicorn/string-conversion/floating-point", test_unicorn_string_conversion_floating_point },
@@ -277,6 +319,7 @@ int main() {
         { "unicorn/string-manip/expand", test_unicorn_string_manip_expand },
         { "unicorn/string-manip/fix-left", test_unicorn_string_manip_fix_left },
         { "unicorn/string-manip/fix-right", test_unicorn_string_manip_fix_right },
+        { "unicorn/string-manip/in-place", test_unicorn_string_manip_in_place },
         { "unicorn/string-manip/insert", test_unicorn_string_manip_insert },
         { "unicorn/string-manip/join", test_unicorn_string_manip_join },
         { "unicorn/string-manip/pad-left", test_unicorn_string_manip_pad_left },
@@ -286,6 +329,7 @@ int main() {
         { "unicorn/string-manip/repeat", test_unicorn_string_manip_repeat },
         { "unicorn/string-manip/replace", test_unicorn_string_manip_replace },
         { "unicorn/string-manip/split", test_unicorn_string_manip_split },
+        { "unicorn/string-manip/split-view", test_unicorn_string_manip_split_view },
         { "unicorn/string-manip/squeeze", test_unicorn_string_manip_squeeze },
         { "unicorn/string-manip/substring", test_unicorn_string_manip_substring },
         { "unicorn/string-manip/translate", test_unicorn_string_manip_translate },
@@ -297,6 +341,8 @@ int main() {
         { "unicorn/string-property/first-and-last", test_unicorn_string_property_first_and_last },
         { "unicorn/string-property/east-asian", test_unicorn_string_property_east_asian },
         { "unicorn/string-property/starts-and-ends", test_unicorn_string_property_starts_and_ends },
+        { "unicorn/string-search/multi-searcher", test_unicorn_string_search_multi_searcher },
+        { "unicorn/string-search/multi-replacer", test_unicorn_string_search_multi_replacer },
         { "unicorn/string-size/measurement-flags", test_unicorn_string_size_measurement_flags },
         { "unicorn/string-size/find-offset", test_unicorn_string_size_find_offset },
         { "unicorn/utf/basic-conversions", test_unicorn_utf_basic_conversions },
@@ -234,6 +234,15 @@ void test_unicorn_utf_basic_utilities() {
     w = 0xe000;  TEST(is_single_unit(w));    TEST(! is_start_unit(w));  TEST(! is_nonstart_unit(w));  TEST(! is_invalid_unit(w));
     w = 0xffff;  TEST(is_single_unit(w));    TEST(! is_start_unit(w));  TEST(! is_nonstart_unit(w));  TEST(! is_invalid_unit(w));
 
+    Ustring s8 = "Hello world, this is plain ASCII \u00e9 then more";
+    std::u16string s16 = to_utf16(s8);
+    TEST_EQUAL(ascii_run_length(s8.data(), 0), 0);
+    TEST_EQUAL(ascii_run_length(s8.data(), 5), 5);
+    TEST_EQUAL(ascii_run_length(s8.data(), s8.size()), 33);
+    TEST_EQUAL(ascii_run_length(s8.data() + 33, s8.size() - 33), 0);
+    TEST_EQUAL(ascii_run_length(s8.data() + 35, s8.size() - 35), s8.size() - 35);
+    TEST_EQUAL(ascii_run_length(s16.data(), s16.size()), 33);
+
 }
 
 void test_unicorn_utf_decoding_iterators() {
@@ -7,6 +7,7 @@
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 
 namespace RS::Unicorn {
@@ -209,6 +210,48 @@ namespace RS::Unicorn {
         return is_single_unit(c) || is_start_unit(c);
     }
 
+    template <typename C>
+    size_t ascii_run_length(const C* ptr, size_t len) noexcept {
+        size_t i = 0;
+        if constexpr (sizeof(C) == 1) {
+            for (; i + 8 <= len; i += 8) {
+                uint64_t block;
+                std::memcpy(&block, ptr + i, 8);
+                if (block & 0x8080808080808080ull)
+                    break;
+            }
+        }
+        while (i < len && uint32_t(std::make_unsigned_t<C>(ptr[i])) <= 0x7f)
+            ++i;
+        return i;
+    }
+
+    namespace UnicornDetail {
+
+        // Support for code that accepts UTF-8 input in arbitrary chunks:
+        // the length of a sequence from its first byte, and the number of
+        // bytes at the end of the string (not before pos) that form the
+        // start of an incomplete sequence
+
+        inline size_t utf8_sequence_length(char c) noexcept {
+            auto b = uint8_t(c);
+            return b < 0xc2 ? 1 : b < 0xe0 ? 2 : b < 0xf0 ? 3 : b < 0xf5 ? 4 : 1;
+        }
+
+        inline size_t utf8_incomplete_tail(const std::string& src, size_t pos) noexcept {
+            size_t n = src.size();
+            for (size_t k = 1; k <= 3 && k <= n - pos; ++k) {
+                char c = src[n - k];
+                if (is_start_unit(c))
+                    return utf8_sequence_length(c) > k ? k : 0;
+                if (! is_nonstart_unit(c))
+                    return 0;
+            }
+            return 0;
+        }
+
+    }
+
     // UTF decoding iterator
 
     template <typename C>
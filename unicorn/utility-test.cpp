@@ -1175,6 +1175,31 @@ void test_unicorn_utility_string_functions() {
 
     TEST_EQUAL(ascii_lowercase("Hello World"s), "hello world");
     TEST_EQUAL(ascii_uppercase("Hello World"s), "HELLO WORLD");
+    TEST_EQUAL(ascii_lowercase("@AZ[`az{ Hello World \xc3\x89\xff ABCDEFGHIJKLMNOPQRSTUVWXYZ"s),
+        "@az[`az{ hello world \xc3\x89\xff abcdefghijklmnopqrstuvwxyz");
+    TEST_EQUAL(ascii_uppercase("@AZ[`az{ Hello World \xc3\xa9\xff abcdefghijklmnopqrstuvwxyz"s),
+        "@AZ[`AZ{ HELLO WORLD \xc3\xa9\xff ABCDEFGHIJKLMNOPQRSTUVWXYZ");
+    {
+        Ustring all;
+        for (int c = 0; c < 256; ++c)
+            all += char(c);
+        Ustring lower = ascii_lowercase(all), upper = ascii_uppercase(all);
+        bool ok = true;
+        for (int c = 0; c < 256; ++c)
+            ok = ok && lower[c] == ascii_tolower(char(c)) && upper[c] == ascii_toupper(char(c));
+        TEST(ok);
+    }
+    {
+        Ustring text = "The Quick Brown Fox Jumps Over The Lazy Dog \xc3\x89t\xc3\xa9 @[`{ ";
+        text += text;
+        bool ok = true;
+        for (size_t i = 0; i <= text.size(); ++i) {
+            Ustring sub = text.substr(text.size() - i), lower = ascii_lowercase(sub), upper = ascii_uppercase(sub);
+            for (size_t j = 0; j < i; ++j)
+                ok = ok && lower[j] == ascii_tolower(sub[j]) && upper[j] == ascii_toupper(sub[j]);
+        }
+        TEST(ok);
+    }
     TEST_EQUAL(ascii_titlecase("hello world"s), "Hello World");
     TEST_EQUAL(ascii_titlecase("HELLO WORLD"s), "Hello World");
 
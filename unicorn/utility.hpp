@@ -966,15 +966,70 @@ namespace RS {
     constexpr char ascii_toupper(char c) noexcept { return ascii_islower(c) ? char(c - 32) : c; }
     constexpr bool is_ascii(char c) noexcept { return uint8_t(c) <= 127; }
 
+    namespace RS_Detail {
+
+        // Flip the case of the 26 ASCII letters starting at First, in place.
+        // Words of eight ASCII bytes are handled in parallel: adding
+        // 0x80-First and 0x80-(First+26) to each byte sets the high bit if
+        // the byte is at least First or First+26 respectively (no byte can
+        // carry into the next), so their difference marks the letters. The
+        // main loop takes four words (32 bytes) at a time, checking them for
+        // non-ASCII bytes together; words containing any non-ASCII byte fall
+        // back to a byte loop, which leaves the non-ASCII bytes unchanged.
+
+        template <char First>
+        void ascii_case_block(char* ptr, size_t len) noexcept {
+            constexpr uint64_t ones = 0x0101010101010101ull;
+            constexpr uint64_t high = ones * 0x80;
+            constexpr uint64_t lo_bias = ones * uint8_t(0x80 - First);
+            constexpr uint64_t hi_bias = ones * uint8_t(0x80 - First - 26);
+            auto flip = [] (char& c) { if (uint8_t(c - First) < 26) c ^= 0x20; };
+            auto flip_ascii = [] (uint64_t block) { return block ^ ((((block + lo_bias) ^ (block + hi_bias)) & high) >> 2); };
+            auto flip_word = [&] (char* p, uint64_t block) {
+                if (block & high) {
+                    for (size_t j = 0; j < 8; ++j)
+                        flip(p[j]);
+                } else {
+                    block = flip_ascii(block);
+                    std::memcpy(p, &block, 8);
+                }
+            };
+            size_t i = 0;
+            for (; i + 32 <= len; i += 32) {
+                uint64_t block[4];
+                std::memcpy(block, ptr + i, 32);
+                if ((block[0] | block[1] | block[2] | block[3]) & high) {
+                    for (size_t k = 0; k < 4; ++k)
+                        flip_word(ptr + i + 8 * k, block[k]);
+                } else {
+                    for (auto& b: block)
+                        b = flip_ascii(b);
+                    std::memcpy(ptr + i, block, 32);
+                }
+            }
+            for (; i + 8 <= len; i += 8) {
+                uint64_t block;
+                std::memcpy(&block, ptr + i, 8);
+                flip_word(ptr + i, block);
+            }
+            for (; i < len; ++i)
+                flip(ptr[i]);
+        }
+
+        inline void ascii_lowercase_block(char* ptr, size_t len) noexcept { ascii_case_block<'A'>(ptr, len); }
+        inline void ascii_uppercase_block(char* ptr, size_t len) noexcept { ascii_case_block<'a'>(ptr, len); }
+
+    }
+
     inline std::string ascii_lowercase(std::string_view s) {
         Ustring r(s);
-        std::transform(r.begin(), r.end(), r.begin(), ascii_tolower);
+        RS_Detail::ascii_lowercase_block(r.data(), r.size());
         return r;
     }
 
     inline std::string ascii_uppercase(std::string_view s) {
         Ustring r(s);
-        std::transform(r.begin(), r.end(), r.begin(), ascii_toupper);
+        RS_Detail::ascii_uppercase_block(r.data(), r.size());
         return r;
     }
 